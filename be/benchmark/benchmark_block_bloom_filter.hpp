@@ -0,0 +1,99 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <vector>
+
+#include "exprs/block_bloom_filter.hpp"
+
+namespace doris {
+
+struct BlockBloomFilterBenchData {
+    static constexpr int BATCH_SIZE = 4096;
+
+    BlockBloomFilterBenchData(int log_space_bytes, bool use_sve) {
+#ifdef __aarch64__
+        origin_sve_enabled = BlockBloomFilter::sve_enabled();
+        BlockBloomFilter::set_sve_enabled(use_sve);
+#endif
+        static_cast<void>(filter.init(log_space_bytes, 0));
+        std::mt19937 rng(42);
+        // fill the filter to about 8 values per bucket
+        size_t num_values = (1ULL << log_space_bytes) / 4;
+        for (size_t i = 0; i < num_values; ++i) {
+            filter.insert(uint32_t(rng()));
+        }
+        for (int i = 0; i < BATCH_SIZE; ++i) {
+            hashes.push_back(uint32_t(rng()));
+        }
+    }
+
+    ~BlockBloomFilterBenchData() {
+#ifdef __aarch64__
+        BlockBloomFilter::set_sve_enabled(origin_sve_enabled);
+#endif
+    }
+
+    BlockBloomFilter filter;
+    std::vector<uint32_t> hashes;
+    bool origin_sve_enabled = false;
+};
+
+static void BM_BlockBloomFilterFind(benchmark::State& state, bool use_sve) {
+    BlockBloomFilterBenchData data(int(state.range(0)), use_sve);
+    for (auto _ : state) {
+        int found = 0;
+        for (auto hash : data.hashes) {
+            found += data.filter.find(hash);
+        }
+        benchmark::DoNotOptimize(found);
+    }
+    state.SetItemsProcessed(state.iterations() * BlockBloomFilterBenchData::BATCH_SIZE);
+}
+
+static void BM_BlockBloomFilterInsert(benchmark::State& state, bool use_sve) {
+    BlockBloomFilterBenchData data(int(state.range(0)), use_sve);
+    for (auto _ : state) {
+        for (auto hash : data.hashes) {
+            data.filter.insert(hash);
+        }
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * BlockBloomFilterBenchData::BATCH_SIZE);
+}
+
+} // namespace doris
+
+// filter from in-cache (64KB) to far beyond LLC (64MB). On x86 both captures run the AVX2
+// version, on aarch64 "sve" falls back to NEON if the cpu has no 256-bit SVE.
+BENCHMARK_CAPTURE(doris::BM_BlockBloomFilterFind, neon_or_avx2, false)
+        ->DenseRange(16, 26, 5)
+        ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_CAPTURE(doris::BM_BlockBloomFilterFind, sve, true)
+        ->DenseRange(16, 26, 5)
+        ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_CAPTURE(doris::BM_BlockBloomFilterInsert, neon_or_avx2, false)
+        ->DenseRange(16, 26, 5)
+        ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_CAPTURE(doris::BM_BlockBloomFilterInsert, sve, true)
+        ->DenseRange(16, 26, 5)
+        ->Unit(benchmark::kMicrosecond);
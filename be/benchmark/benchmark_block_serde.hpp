@@ -0,0 +1,95 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <benchmark/benchmark.h>
+#include <gen_cpp/data.pb.h>
+#include <gen_cpp/segment_v2.pb.h>
+
+#include <algorithm>
+
+#include "agent/be_exec_version_manager.h"
+#include "benchmark_data_gen.hpp"
+#include "vec/core/block.h"
+#include "vec/data_types/data_type_number.h"
+#include "vec/data_types/data_type_string.h"
+
+namespace doris::vectorized {
+
+// the block of an exchange: an int64 key, a low cardinality string and a unique string
+static Block gen_serde_block(size_t rows) {
+    Block block;
+    block.insert({gen_int64_column(rows, rows), std::make_shared<DataTypeInt64>(), "id"});
+    block.insert({gen_string_column(rows, 8, 16), std::make_shared<DataTypeString>(), "tag"});
+    block.insert({gen_string_column(rows, 32, rows), std::make_shared<DataTypeString>(), "val"});
+    return block;
+}
+
+// args: rows, column wise
+static void BM_BlockSerialize(benchmark::State& state,
+                              segment_v2::CompressionTypePB compression_type) {
+    Block block = gen_serde_block(state.range(0));
+    size_t uncompressed_bytes = 0;
+    size_t compressed_bytes = 0;
+    for (auto _ : state) {
+        PBlock pblock;
+        auto st = block.serialize(BeExecVersionManager::get_newest_version(), &pblock,
+                                  &uncompressed_bytes, &compressed_bytes, compression_type, false,
+                                  state.range(1));
+        benchmark::DoNotOptimize(st);
+        benchmark::DoNotOptimize(pblock);
+    }
+    state.SetBytesProcessed(state.iterations() * uncompressed_bytes);
+    state.counters["compression_ratio"] =
+            double(uncompressed_bytes) / double(std::max<size_t>(1, compressed_bytes));
+}
+
+// args: rows, column wise
+static void BM_BlockDeserialize(benchmark::State& state,
+                                segment_v2::CompressionTypePB compression_type) {
+    Block block = gen_serde_block(state.range(0));
+    size_t uncompressed_bytes = 0;
+    size_t compressed_bytes = 0;
+    PBlock pblock;
+    static_cast<void>(block.serialize(BeExecVersionManager::get_newest_version(), &pblock,
+                                      &uncompressed_bytes, &compressed_bytes, compression_type,
+                                      false, state.range(1)));
+    for (auto _ : state) {
+        Block res;
+        auto st = res.deserialize(pblock);
+        benchmark::DoNotOptimize(st);
+        benchmark::DoNotOptimize(res);
+    }
+    state.SetBytesProcessed(state.iterations() * uncompressed_bytes);
+}
+
+} // namespace doris::vectorized
+
+BENCHMARK_CAPTURE(doris::vectorized::BM_BlockSerialize, lz4, doris::segment_v2::LZ4)
+        ->ArgsProduct({{4096, 65536}, {0, 1}})
+        ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_CAPTURE(doris::vectorized::BM_BlockSerialize, zstd, doris::segment_v2::ZSTD)
+        ->ArgsProduct({{4096, 65536}, {0, 1}})
+        ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_CAPTURE(doris::vectorized::BM_BlockDeserialize, lz4, doris::segment_v2::LZ4)
+        ->ArgsProduct({{4096, 65536}, {0, 1}})
+        ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_CAPTURE(doris::vectorized::BM_BlockDeserialize, zstd, doris::segment_v2::ZSTD)
+        ->ArgsProduct({{4096, 65536}, {0, 1}})
+        ->Unit(benchmark::kMicrosecond);
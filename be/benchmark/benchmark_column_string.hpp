@@ -0,0 +1,69 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <benchmark/benchmark.h>
+
+#include <numeric>
+#include <vector>
+
+#include "benchmark_data_gen.hpp"
+#include "vec/columns/column_string.h"
+
+namespace doris::vectorized {
+
+// filter a block sized string column, args: selectivity percent, average string length
+static void BM_ColumnStringFilter(benchmark::State& state) {
+    constexpr size_t ROWS = 4096;
+    auto column = gen_string_column(ROWS, state.range(1), ROWS);
+    auto filter = gen_filter(ROWS, int(state.range(0)));
+    size_t selected = std::accumulate(filter.begin(), filter.end(), size_t(0));
+    for (auto _ : state) {
+        auto res = column->filter(filter, selected);
+        benchmark::DoNotOptimize(res);
+    }
+    state.SetItemsProcessed(state.iterations() * ROWS);
+}
+
+// replicate the rows of a string column by row indices, it is how the build side rows of a
+// join are output, args: rows of the source column, average string length
+static void BM_ColumnStringReplicate(benchmark::State& state) {
+    constexpr size_t ROWS = 4096;
+    size_t src_rows = state.range(0);
+    auto column = gen_string_column(src_rows, state.range(1), src_rows);
+    std::vector<uint32_t> indices(ROWS);
+    std::mt19937 rng(42);
+    for (auto& idx : indices) {
+        idx = uint32_t(rng() % src_rows);
+    }
+    for (auto _ : state) {
+        auto res = ColumnString::create();
+        res->insert_indices_from(*column, indices.data(), indices.data() + indices.size());
+        benchmark::DoNotOptimize(res);
+    }
+    state.SetItemsProcessed(state.iterations() * ROWS);
+}
+
+} // namespace doris::vectorized
+
+BENCHMARK(doris::vectorized::BM_ColumnStringFilter)
+        ->ArgsProduct({{10, 50, 90}, {8, 64}})
+        ->Unit(benchmark::kMicrosecond);
+
+// source column from in-cache to far beyond LLC
+BENCHMARK(doris::vectorized::BM_ColumnStringReplicate)
+        ->ArgsProduct({{1 << 12, 1 << 20}, {8, 64}})
+        ->Unit(benchmark::kMicrosecond);
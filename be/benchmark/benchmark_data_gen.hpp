@@ -0,0 +1,91 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "vec/columns/column.h"
+#include "vec/columns/column_string.h"
+#include "vec/columns/column_vector.h"
+
+namespace doris::vectorized {
+
+// Data generators shared by the operator benchmarks. All of them are seeded, so runs of
+// different builds are comparable.
+
+// `rows` int64 values drawn uniformly from [0, cardinality)
+inline std::vector<int64_t> gen_int64_values(size_t rows, uint64_t cardinality,
+                                             uint32_t seed = 42) {
+    std::mt19937_64 rng(seed);
+    std::vector<int64_t> values(rows);
+    for (auto& v : values) {
+        v = int64_t(rng() % cardinality);
+    }
+    return values;
+}
+
+// `rows` strings of [avg_len / 2, avg_len * 3 / 2] bytes, picked from `cardinality` distinct ones
+inline std::vector<std::string> gen_string_values(size_t rows, size_t avg_len,
+                                                  uint64_t cardinality, uint32_t seed = 42) {
+    std::mt19937_64 rng(seed);
+    std::vector<std::string> dict(std::min<uint64_t>(cardinality, rows));
+    for (auto& s : dict) {
+        size_t len = avg_len / 2 + rng() % (avg_len + 1);
+        s.resize(len);
+        for (auto& c : s) {
+            c = char('a' + rng() % 26);
+        }
+    }
+    std::vector<std::string> values(rows);
+    for (auto& v : values) {
+        v = dict[rng() % dict.size()];
+    }
+    return values;
+}
+
+inline MutableColumnPtr gen_int64_column(size_t rows, uint64_t cardinality, uint32_t seed = 42) {
+    auto column = ColumnInt64::create();
+    auto values = gen_int64_values(rows, cardinality, seed);
+    column->get_data().assign(values.begin(), values.end());
+    return column;
+}
+
+inline MutableColumnPtr gen_string_column(size_t rows, size_t avg_len, uint64_t cardinality,
+                                          uint32_t seed = 42) {
+    auto column = ColumnString::create();
+    for (const auto& v : gen_string_values(rows, avg_len, cardinality, seed)) {
+        column->insert_data(v.data(), v.size());
+    }
+    return column;
+}
+
+// A filter keeping about `selectivity_pct` percent of `rows`
+inline IColumn::Filter gen_filter(size_t rows, int selectivity_pct, uint32_t seed = 42) {
+    std::mt19937 rng(seed);
+    IColumn::Filter filter(rows);
+    for (auto& f : filter) {
+        f = int(rng() % 100) < selectivity_pct;
+    }
+    return filter;
+}
+
+} // namespace doris::vectorized
@@ -0,0 +1,103 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "olap/block_column_predicate.h"
+#include "olap/comparison_predicate.h"
+#include "olap/fused_range_predicate.h"
+#include "vec/columns/column_nullable.h"
+#include "vec/columns/predicate_column.h"
+
+namespace doris {
+
+struct FusedRangePredicateBenchData {
+    static constexpr uint16_t BATCH_SIZE = 4096;
+
+    explicit FusedRangePredicateBenchData(bool nullable)
+            : lower(0, 1000), upper(0, 9000), fused(FusedRangePredicate::create(&lower, &upper)) {
+        auto data = vectorized::PredicateColumnType<TYPE_INT>::create();
+        auto null_map = vectorized::ColumnUInt8::create();
+        std::mt19937 rng(42);
+        for (uint16_t i = 0; i < BATCH_SIZE; ++i) {
+            auto value = int32_t(rng() % 10000);
+            data->insert_data(reinterpret_cast<const char*>(&value), 0);
+            null_map->insert_value(rng() % 10 == 0);
+        }
+        if (nullable) {
+            block.push_back(
+                    vectorized::ColumnNullable::create(std::move(data), std::move(null_map)));
+        } else {
+            block.push_back(std::move(data));
+        }
+        and_predicate.add_column_predicate(SingleColumnBlockPredicate::create_unique(&lower));
+        and_predicate.add_column_predicate(SingleColumnBlockPredicate::create_unique(&upper));
+        flags.resize(BATCH_SIZE);
+    }
+
+    ComparisonPredicateBase<TYPE_INT, PredicateType::GE> lower;
+    ComparisonPredicateBase<TYPE_INT, PredicateType::LT> upper;
+    std::unique_ptr<FusedRangePredicate> fused;
+    AndBlockColumnPredicate and_predicate;
+    vectorized::MutableColumns block;
+    std::vector<uint8_t> flags;
+};
+
+static void BM_RangePredicateBlockColumnPredicate(benchmark::State& state, bool nullable) {
+    FusedRangePredicateBenchData data(nullable);
+    for (auto _ : state) {
+        data.and_predicate.evaluate_vec(data.block, FusedRangePredicateBenchData::BATCH_SIZE,
+                                        (bool*)data.flags.data());
+        benchmark::DoNotOptimize(data.flags.data());
+    }
+    state.SetItemsProcessed(state.iterations() * FusedRangePredicateBenchData::BATCH_SIZE);
+}
+
+static void BM_RangePredicateSeparate(benchmark::State& state, bool nullable) {
+    FusedRangePredicateBenchData data(nullable);
+    for (auto _ : state) {
+        data.lower.evaluate_vec(*data.block[0], FusedRangePredicateBenchData::BATCH_SIZE,
+                                (bool*)data.flags.data());
+        data.upper.evaluate_and_vec(*data.block[0], FusedRangePredicateBenchData::BATCH_SIZE,
+                                    (bool*)data.flags.data());
+        benchmark::DoNotOptimize(data.flags.data());
+    }
+    state.SetItemsProcessed(state.iterations() * FusedRangePredicateBenchData::BATCH_SIZE);
+}
+
+static void BM_RangePredicateFused(benchmark::State& state, bool nullable) {
+    FusedRangePredicateBenchData data(nullable);
+    for (auto _ : state) {
+        data.fused->evaluate_vec(*data.block[0], FusedRangePredicateBenchData::BATCH_SIZE,
+                                 (bool*)data.flags.data());
+        benchmark::DoNotOptimize(data.flags.data());
+    }
+    state.SetItemsProcessed(state.iterations() * FusedRangePredicateBenchData::BATCH_SIZE);
+}
+
+BENCHMARK_CAPTURE(BM_RangePredicateBlockColumnPredicate, not_null, false);
+BENCHMARK_CAPTURE(BM_RangePredicateBlockColumnPredicate, nullable, true);
+BENCHMARK_CAPTURE(BM_RangePredicateSeparate, not_null, false);
+BENCHMARK_CAPTURE(BM_RangePredicateSeparate, nullable, true);
+BENCHMARK_CAPTURE(BM_RangePredicateFused, not_null, false);
+BENCHMARK_CAPTURE(BM_RangePredicateFused, nullable, true);
+
+} // namespace doris
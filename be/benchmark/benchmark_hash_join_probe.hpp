@@ -0,0 +1,138 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <vector>
+
+#include "vec/common/hash_table/hash.h"
+#include "vec/common/hash_table/join_hash_table.h"
+
+namespace doris::vectorized {
+
+using BenchJoinHashTable = JoinHashTable<uint64_t, HashCRC32<uint64_t>>;
+
+struct HashJoinProbeBenchData {
+    static constexpr int BATCH_SIZE = 4096;
+
+    HashJoinProbeBenchData(size_t build_rows, bool probe_prefetch) {
+        std::mt19937_64 rng(42);
+        // the first row of build side is mocked
+        build_keys.push_back(0);
+        for (size_t i = 0; i < build_rows; ++i) {
+            build_keys.push_back(rng());
+        }
+        table.set_probe_prefetch(probe_prefetch);
+        table.prepare_build<TJoinOp::INNER_JOIN>(build_keys.size(), BATCH_SIZE, false);
+        auto bucket_size = table.get_bucket_size();
+        build_bucket_nums.resize(build_keys.size());
+        for (size_t i = 0; i < build_keys.size(); ++i) {
+            build_bucket_nums[i] = table.hash(build_keys[i]) & (bucket_size - 1);
+        }
+        table.build(build_keys.data(), build_bucket_nums.data(), uint32_t(build_keys.size()),
+                    false);
+
+        // half of the probe rows hit the build side
+        std::uniform_int_distribution<size_t> dist(1, build_rows);
+        for (int i = 0; i < BATCH_SIZE; ++i) {
+            probe_keys.push_back(i % 2 ? build_keys[dist(rng)] : rng());
+        }
+        probe_bucket_nums.resize(BATCH_SIZE);
+        probe_idxs.resize(BATCH_SIZE + 1);
+        build_idxs.resize(BATCH_SIZE + 1);
+    }
+
+    uint32_t probe() {
+        auto bucket_size = table.get_bucket_size();
+        for (int i = 0; i < BATCH_SIZE; ++i) {
+            probe_bucket_nums[i] = table.hash(probe_keys[i]) & (bucket_size - 1);
+        }
+        table.pre_build_idxs(probe_bucket_nums);
+        int probe_idx = 0;
+        uint32_t build_idx = 0;
+        uint32_t matched_rows = 0;
+        bool probe_visited = false;
+        while (probe_idx < BATCH_SIZE) {
+            auto [new_probe_idx, new_build_idx, matched_cnt] =
+                    table.find_batch<TJoinOp::INNER_JOIN>(
+                            probe_keys.data(), probe_bucket_nums.data(), probe_idx, build_idx,
+                            BATCH_SIZE, probe_idxs.data(), probe_visited, build_idxs.data(),
+                            nullptr, false, false, false);
+            probe_idx = new_probe_idx;
+            build_idx = new_build_idx;
+            matched_rows += matched_cnt;
+        }
+        return matched_rows;
+    }
+
+    std::vector<uint64_t> build_keys;
+    DorisVector<uint32_t> build_bucket_nums;
+    std::vector<uint64_t> probe_keys;
+    DorisVector<uint32_t> probe_bucket_nums;
+    std::vector<uint32_t> probe_idxs;
+    std::vector<uint32_t> build_idxs;
+    BenchJoinHashTable table;
+};
+
+static void BM_HashJoinProbe(benchmark::State& state, bool probe_prefetch) {
+    HashJoinProbeBenchData data(state.range(0), probe_prefetch);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(data.probe());
+    }
+    state.SetItemsProcessed(state.iterations() * HashJoinProbeBenchData::BATCH_SIZE);
+}
+
+static void BM_HashJoinBuild(benchmark::State& state) {
+    constexpr int BATCH_SIZE = HashJoinProbeBenchData::BATCH_SIZE;
+    std::mt19937_64 rng(42);
+    std::vector<uint64_t> build_keys(state.range(0) + 1);
+    for (size_t i = 1; i < build_keys.size(); ++i) {
+        build_keys[i] = rng();
+    }
+    DorisVector<uint32_t> build_bucket_nums(build_keys.size());
+    for (auto _ : state) {
+        BenchJoinHashTable table;
+        table.prepare_build<TJoinOp::INNER_JOIN>(build_keys.size(), BATCH_SIZE, false);
+        auto bucket_size = table.get_bucket_size();
+        for (size_t i = 0; i < build_keys.size(); ++i) {
+            build_bucket_nums[i] = table.hash(build_keys[i]) & (bucket_size - 1);
+        }
+        table.build(build_keys.data(), build_bucket_nums.data(), uint32_t(build_keys.size()),
+                    false);
+        benchmark::DoNotOptimize(table);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+} // namespace doris::vectorized
+
+// build side from in-cache (64K rows) to far beyond LLC (16M rows)
+BENCHMARK_CAPTURE(doris::vectorized::BM_HashJoinProbe, no_prefetch, false)
+        ->RangeMultiplier(16)
+        ->Range(1 << 16, 1 << 24)
+        ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_CAPTURE(doris::vectorized::BM_HashJoinProbe, prefetch, true)
+        ->RangeMultiplier(16)
+        ->Range(1 << 16, 1 << 24)
+        ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK(doris::vectorized::BM_HashJoinBuild)
+        ->RangeMultiplier(16)
+        ->Range(1 << 16, 1 << 24)
+        ->Unit(benchmark::kMillisecond);
@@ -0,0 +1,74 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "common/config.h"
+#include "vec/common/allocator.h"
+
+namespace doris {
+
+// Random 8 byte updates over a hash table sized buffer, the access pattern of a large hash join
+// or aggregation, with the buffer allocated by the current path or backed by huge pages.
+static void BM_LargeAllocRandomAccess(benchmark::State& state, const std::string& mode) {
+    const std::string origin_mode = config::huge_page_alloc_mode;
+    const int64_t origin_threshold = config::huge_page_alloc_threshold_bytes;
+    config::huge_page_alloc_mode = mode;
+    config::huge_page_alloc_threshold_bytes = 64 * 1024 * 1024;
+
+    const size_t size = state.range(0) * 1024 * 1024;
+    const size_t slots = size / sizeof(uint64_t);
+    std::mt19937_64 rng(42);
+    std::vector<size_t> positions(1 << 20);
+    for (auto& pos : positions) {
+        pos = rng() % slots;
+    }
+
+    Allocator<true, true, false, DefaultMemoryAllocator, false> allocator;
+    for (auto _ : state) {
+        auto* buf = reinterpret_cast<uint64_t*>(allocator.alloc(size));
+        for (size_t pos : positions) {
+            buf[pos] += pos;
+        }
+        benchmark::DoNotOptimize(buf);
+        allocator.free(buf, size);
+    }
+    state.SetItemsProcessed(state.iterations() * positions.size());
+
+    config::huge_page_alloc_mode = origin_mode;
+    config::huge_page_alloc_threshold_bytes = origin_threshold;
+}
+
+BENCHMARK_CAPTURE(BM_LargeAllocRandomAccess, none, std::string("none"))
+        ->Arg(256)
+        ->Arg(2048)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_LargeAllocRandomAccess, madvise, std::string("madvise"))
+        ->Arg(256)
+        ->Arg(2048)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_LargeAllocRandomAccess, hugetlb, std::string("hugetlb"))
+        ->Arg(256)
+        ->Arg(2048)
+        ->Unit(benchmark::kMillisecond);
+
+} // namespace doris
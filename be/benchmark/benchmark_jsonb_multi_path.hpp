@@ -0,0 +1,82 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <benchmark/benchmark.h>
+#include <fmt/format.h>
+
+#include <string>
+#include <vector>
+
+#include "runtime/jsonb_value.h"
+#include "util/jsonb_document.h"
+#include "util/jsonb_path_trie.h"
+
+namespace doris {
+
+struct JsonbMultiPathBenchData {
+    JsonbMultiPathBenchData() {
+        std::string json = "{";
+        for (int i = 0; i < 32; ++i) {
+            json += fmt::format(R"("field_{}":{{"id":{},"name":"n{}","tags":[1,2,3]}},)", i, i, i);
+        }
+        json.back() = '}';
+        THROW_IF_ERROR(jsonb.from_json_string(json.data(), json.size()));
+        JsonbDocument* doc = nullptr;
+        THROW_IF_ERROR(JsonbDocument::checkAndCreateDocument(jsonb.value(), jsonb.size(), &doc));
+        root = doc->getValue();
+
+        for (int i = 0; i < 10; ++i) {
+            path_strs.push_back(fmt::format("$.field_{}.{}", i * 3, i % 2 ? "id" : "tags[1]"));
+        }
+        paths.resize(path_strs.size());
+        for (size_t i = 0; i < path_strs.size(); ++i) {
+            paths[i].seek(path_strs[i].data(), path_strs[i].size());
+            trie.add_path(paths[i], i);
+        }
+    }
+
+    JsonBinaryValue jsonb;
+    const JsonbValue* root = nullptr;
+    std::vector<std::string> path_strs;
+    std::vector<JsonbPath> paths;
+    JsonbPathTrie trie;
+};
+
+static void BM_JsonbFindValuePerPath(benchmark::State& state) {
+    JsonbMultiPathBenchData data;
+    for (auto _ : state) {
+        for (auto& path : data.paths) {
+            benchmark::DoNotOptimize(data.root->findValue(path).value);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * data.paths.size());
+}
+
+static void BM_JsonbFindValuePathTrie(benchmark::State& state) {
+    JsonbMultiPathBenchData data;
+    std::vector<const JsonbValue*> values;
+    for (auto _ : state) {
+        data.trie.find_values(data.root, values);
+        benchmark::DoNotOptimize(values.data());
+    }
+    state.SetItemsProcessed(state.iterations() * data.paths.size());
+}
+
+BENCHMARK(BM_JsonbFindValuePerPath);
+BENCHMARK(BM_JsonbFindValuePathTrie);
+
+} // namespace doris
@@ -18,7 +18,18 @@
 #include <benchmark/benchmark.h>
 
 #include "benchmark_bit_pack.hpp"
+#include "benchmark_block_bloom_filter.hpp"
+#include "benchmark_block_serde.hpp"
+#include "benchmark_column_string.hpp"
 #include "benchmark_fastunion.hpp"
+#include "benchmark_fused_range_predicate.hpp"
+#include "benchmark_hash_join_probe.hpp"
+#include "benchmark_huge_page_alloc.hpp"
+#include "benchmark_jsonb_multi_path.hpp"
+#include "benchmark_page_decoder.hpp"
+#include "benchmark_posting_intersection.hpp"
+#include "benchmark_sort_block.hpp"
+#include "benchmark_string_to_int.hpp"
 #include "binary_cast_benchmark.hpp"
 #include "vec/columns/column_string.h"
 #include "vec/core/block.h"
@@ -0,0 +1,96 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <benchmark/benchmark.h>
+
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "benchmark_data_gen.hpp"
+#include "olap/rowset/segment_v2/binary_plain_page.h"
+#include "olap/rowset/segment_v2/frame_of_reference_page.h"
+#include "olap/rowset/segment_v2/options.h"
+#include "olap/rowset/segment_v2/page_builder.h"
+#include "olap/rowset/segment_v2/page_decoder.h"
+#include "olap/rowset/segment_v2/plain_page.h"
+#include "util/slice.h"
+
+namespace doris::segment_v2 {
+
+// Build one page of `values` and decode it into a column in each iteration, including the
+// decoder initialization that every page read pays, args: rows, cardinality
+template <typename Builder, typename Decoder, typename Value>
+static void page_decode_benchmark(benchmark::State& state, const std::vector<Value>& values,
+                                  const std::function<vectorized::MutableColumnPtr()>& new_column) {
+    PageBuilderOptions options;
+    options.data_page_size = 4 * 1024 * 1024;
+    Builder builder(options);
+    static_cast<void>(builder.init());
+    size_t count = values.size();
+    static_cast<void>(builder.add(reinterpret_cast<const uint8_t*>(values.data()), &count));
+    OwnedSlice page;
+    static_cast<void>(builder.finish(&page));
+
+    PageDecoderOptions decoder_options;
+    for (auto _ : state) {
+        Decoder decoder(page.slice(), decoder_options);
+        static_cast<void>(decoder.init());
+        auto column = new_column();
+        size_t n = count;
+        static_cast<void>(decoder.next_batch(&n, column));
+        benchmark::DoNotOptimize(column);
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+    state.counters["page_bytes"] = double(page.slice().size);
+}
+
+static void BM_PlainPageDecodeInt64(benchmark::State& state) {
+    auto values = vectorized::gen_int64_values(state.range(0), state.range(1));
+    page_decode_benchmark<PlainPageBuilder<FieldType::OLAP_FIELD_TYPE_BIGINT>,
+                          PlainPageDecoder<FieldType::OLAP_FIELD_TYPE_BIGINT>>(
+            state, values, [] { return vectorized::ColumnInt64::create(); });
+}
+
+static void BM_FrameOfReferencePageDecodeInt64(benchmark::State& state) {
+    auto values = vectorized::gen_int64_values(state.range(0), state.range(1));
+    page_decode_benchmark<FrameOfReferencePageBuilder<FieldType::OLAP_FIELD_TYPE_BIGINT>,
+                          FrameOfReferencePageDecoder<FieldType::OLAP_FIELD_TYPE_BIGINT>>(
+            state, values, [] { return vectorized::ColumnInt64::create(); });
+}
+
+static void BM_BinaryPlainPageDecode(benchmark::State& state) {
+    auto strings = vectorized::gen_string_values(state.range(0), 16, state.range(1));
+    std::vector<Slice> values(strings.begin(), strings.end());
+    page_decode_benchmark<BinaryPlainPageBuilder<FieldType::OLAP_FIELD_TYPE_VARCHAR>,
+                          BinaryPlainPageDecoder<FieldType::OLAP_FIELD_TYPE_VARCHAR>>(
+            state, values, [] { return vectorized::ColumnString::create(); });
+}
+
+} // namespace doris::segment_v2
+
+BENCHMARK(doris::segment_v2::BM_PlainPageDecodeInt64)
+        ->ArgsProduct({{1024, 65536}, {16, 1 << 30}})
+        ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK(doris::segment_v2::BM_FrameOfReferencePageDecodeInt64)
+        ->ArgsProduct({{1024, 65536}, {16, 1 << 30}})
+        ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK(doris::segment_v2::BM_BinaryPlainPageDecode)
+        ->ArgsProduct({{1024, 65536}, {16, 1 << 30}})
+        ->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,69 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <roaring/roaring.hh>
+#include <set>
+#include <vector>
+
+#include "olap/rowset/segment_v2/inverted_index/util/posting_intersection.h"
+
+namespace doris::segment_v2::inverted_index {
+
+static std::vector<uint32_t> make_postings(size_t n, uint32_t seed) {
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<uint32_t> dist(0, 10000000);
+    std::set<uint32_t> docs;
+    while (docs.size() < n) {
+        docs.insert(dist(rng));
+    }
+    return {docs.begin(), docs.end()};
+}
+
+// argument: doc count of the smaller posting list, the other one has 100k docs
+static void BM_PostingIntersectRoaring(benchmark::State& state) {
+    auto a = make_postings(state.range(0), 1);
+    auto b = make_postings(100000, 2);
+    for (auto _ : state) {
+        roaring::Roaring ra;
+        ra.addMany(a.size(), a.data());
+        roaring::Roaring rb;
+        rb.addMany(b.size(), b.data());
+        ra &= rb;
+        benchmark::DoNotOptimize(ra.cardinality());
+    }
+}
+
+static void BM_PostingIntersectSorted(benchmark::State& state) {
+    auto a = make_postings(state.range(0), 1);
+    auto b = make_postings(100000, 2);
+    std::vector<uint32_t> out;
+    for (auto _ : state) {
+        out.clear();
+        intersect_sorted_docs(a.data(), a.size(), b.data(), b.size(), out);
+        roaring::Roaring result;
+        result.addMany(out.size(), out.data());
+        benchmark::DoNotOptimize(result.cardinality());
+    }
+}
+
+BENCHMARK(BM_PostingIntersectRoaring)->Arg(100)->Arg(10000)->Arg(100000);
+BENCHMARK(BM_PostingIntersectSorted)->Arg(100)->Arg(10000)->Arg(100000);
+
+} // namespace doris::segment_v2::inverted_index
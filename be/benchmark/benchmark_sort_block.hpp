@@ -0,0 +1,59 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <benchmark/benchmark.h>
+
+#include "benchmark_data_gen.hpp"
+#include "vec/core/block.h"
+#include "vec/core/sort_block.h"
+#include "vec/data_types/data_type_number.h"
+#include "vec/data_types/data_type_string.h"
+
+namespace doris::vectorized {
+
+// a block of (int64, string) with low cardinality first column, so sorting by both columns
+// has to compare strings for most rows
+static Block gen_sort_block(size_t rows) {
+    Block block;
+    block.insert({gen_int64_column(rows, 16), std::make_shared<DataTypeInt64>(), "k1"});
+    block.insert({gen_string_column(rows, 16, rows), std::make_shared<DataTypeString>(), "k2"});
+    return block;
+}
+
+// the kernel of FullSorter (limit = 0) and of topn sorters (limit > 0),
+// args: rows, limit, number of sort columns
+static void BM_SortBlock(benchmark::State& state) {
+    size_t rows = state.range(0);
+    auto limit = uint64_t(state.range(1));
+    Block block = gen_sort_block(rows);
+    SortDescription description;
+    for (int i = 0; i < state.range(2); ++i) {
+        description.emplace_back(i, 1, 1);
+    }
+    for (auto _ : state) {
+        Block sorted = block.clone_empty();
+        sort_block(block, sorted, description, limit);
+        benchmark::DoNotOptimize(sorted);
+    }
+    state.SetItemsProcessed(state.iterations() * rows);
+}
+
+} // namespace doris::vectorized
+
+BENCHMARK(doris::vectorized::BM_SortBlock)
+        ->ArgsProduct({{4096, 1 << 20}, {0, 100}, {1, 2}})
+        ->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,79 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "util/string_parser.hpp"
+
+namespace doris {
+
+// Digit-at-a-time loop, the shape string_to_int_no_overflow had before the SWAR path.
+static int64_t scalar_string_to_int64(const char* s, size_t len, bool* ok) {
+    uint64_t val = 0;
+    for (size_t i = 0; i < len; ++i) {
+        if (s[i] < '0' || s[i] > '9') {
+            *ok = false;
+            return 0;
+        }
+        val = val * 10 + static_cast<uint64_t>(s[i] - '0');
+    }
+    *ok = len > 0;
+    return static_cast<int64_t>(val);
+}
+
+static std::vector<std::string> make_int_strings(int64_t max_value) {
+    std::mt19937_64 rng(42);
+    std::uniform_int_distribution<int64_t> dist(0, max_value);
+    std::vector<std::string> strs(4096);
+    for (auto& s : strs) {
+        s = std::to_string(dist(rng));
+    }
+    return strs;
+}
+
+static void BM_StringToInt64Scalar(benchmark::State& state) {
+    auto strs = make_int_strings(state.range(0));
+    for (auto _ : state) {
+        for (const auto& s : strs) {
+            bool ok;
+            benchmark::DoNotOptimize(scalar_string_to_int64(s.data(), s.size(), &ok));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * strs.size());
+}
+
+static void BM_StringToInt64StringParser(benchmark::State& state) {
+    auto strs = make_int_strings(state.range(0));
+    for (auto _ : state) {
+        for (const auto& s : strs) {
+            StringParser::ParseResult result;
+            benchmark::DoNotOptimize(
+                    StringParser::string_to_int<int64_t>(s.data(), s.size(), &result));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * strs.size());
+}
+
+BENCHMARK(BM_StringToInt64Scalar)->Arg(9999)->Arg(999999999)->Arg(999999999999999999LL);
+BENCHMARK(BM_StringToInt64StringParser)->Arg(9999)->Arg(999999999)->Arg(999999999999999999LL);
+
+} // namespace doris
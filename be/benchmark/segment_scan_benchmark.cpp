@@ -0,0 +1,299 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Scans synthetic segments through SegmentIterator without a running cluster, to evaluate
+// encodings, indexes and format changes of the storage read path in isolation.
+//
+//   segment_scan_benchmark --segment_rows=4000000 --string_columns=2 --read_columns=3 \
+//       --predicate_selectivity=10 --benchmark_format=json
+//
+// Besides rows/s and bytes/s, the OlapReaderStatistics timers of each stage are reported per
+// iteration in ns.
+
+#include <benchmark/benchmark.h>
+#include <gen_cpp/segment_v2.pb.h>
+#include <gflags/gflags.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "benchmark_data_gen.hpp"
+#include "common/config.h"
+#include "common/status.h"
+#include "io/fs/file_writer.h"
+#include "io/fs/local_file_system.h"
+#include "olap/comparison_predicate.h"
+#include "olap/iterators.h"
+#include "olap/olap_common.h"
+#include "olap/page_cache.h"
+#include "olap/rowset/rowset_writer_context.h"
+#include "olap/rowset/segment_v2/segment.h"
+#include "olap/rowset/segment_v2/segment_writer.h"
+#include "olap/schema.h"
+#include "olap/tablet_column_object_pool.h"
+#include "olap/tablet_schema.h"
+#include "olap/tablet_schema_cache.h"
+#include "runtime/exec_env.h"
+#include "runtime/memory/cache_manager.h"
+#include "runtime/memory/mem_tracker_limiter.h"
+#include "runtime/memory/thread_mem_tracker_mgr.h"
+#include "runtime/thread_context.h"
+#include "util/cpu_info.h"
+#include "util/mem_info.h"
+#include "vec/common/assert_cast.h"
+#include "vec/core/block.h"
+
+DEFINE_string(segment_dir, "./segment_scan_benchmark", "directory to write the segment to");
+DEFINE_int64(segment_rows, 1000000, "number of rows of the segment");
+DEFINE_int32(int_columns, 2, "number of bigint value columns");
+DEFINE_int32(string_columns, 1, "number of varchar value columns");
+DEFINE_int32(string_length, 16, "average length of the varchar values");
+DEFINE_int64(cardinality, 1000, "number of distinct values of each value column");
+DEFINE_string(compression, "LZ4F", "page compression, one of CompressionTypePB");
+DEFINE_bool(bloom_filter, false, "build bloom filter indexes on the value columns");
+DEFINE_int32(read_columns, 0, "number of leading columns to read, 0 means all");
+DEFINE_int32(predicate_selectivity, 100,
+             "percent of rows kept by `v1 < x` on the first bigint value column, 100 means no "
+             "predicate");
+DEFINE_int32(batch_size, 4064, "max rows of each block returned by the iterator");
+DEFINE_bool(use_page_cache, false, "read pages through the storage page cache");
+DEFINE_int64(page_cache_mb, 1024, "capacity of the storage page cache");
+
+namespace doris {
+
+struct SegmentScanBenchData {
+    Status init() {
+        tablet_schema = std::make_shared<TabletSchema>();
+        auto add_column = [&](const std::string& name, FieldType type, bool is_key,
+                              int32_t length) {
+            TabletColumn column;
+            column.set_unique_id(int32_t(tablet_schema->num_columns()));
+            column.set_name(name);
+            column.set_type(type);
+            column.set_is_key(is_key);
+            column.set_is_nullable(false);
+            column.set_length(length);
+            column.set_index_length(type == FieldType::OLAP_FIELD_TYPE_VARCHAR ? 20 : length);
+            column.set_is_bf_column(!is_key && FLAGS_bloom_filter);
+            tablet_schema->append_column(std::move(column));
+        };
+        add_column("k0", FieldType::OLAP_FIELD_TYPE_BIGINT, true, 8);
+        for (int i = 0; i < FLAGS_int_columns; ++i) {
+            add_column("v" + std::to_string(i + 1), FieldType::OLAP_FIELD_TYPE_BIGINT, false, 8);
+        }
+        for (int i = 0; i < FLAGS_string_columns; ++i) {
+            add_column("s" + std::to_string(i + 1), FieldType::OLAP_FIELD_TYPE_VARCHAR, false,
+                       65533);
+        }
+        tablet_schema->_keys_type = DUP_KEYS;
+        tablet_schema->_num_short_key_columns = 1;
+        segment_v2::CompressionTypePB compression;
+        if (!segment_v2::CompressionTypePB_Parse(FLAGS_compression, &compression)) {
+            return Status::InvalidArgument("unknown compression {}", FLAGS_compression);
+        }
+        tablet_schema->_compression_type = compression;
+
+        RETURN_IF_ERROR(io::global_local_filesystem()->delete_directory(FLAGS_segment_dir));
+        RETURN_IF_ERROR(io::global_local_filesystem()->create_directory(FLAGS_segment_dir));
+        RETURN_IF_ERROR(write_segment());
+        return segment_v2::Segment::open(io::global_local_filesystem(), path, 0, 0, rowset_id,
+                                         tablet_schema, io::FileReaderOptions {}, &segment);
+    }
+
+    // k0 is the row number, so the short key index is valid, value columns are random
+    Status write_segment() {
+        path = FLAGS_segment_dir + "/0.dat";
+        io::FileWriterPtr file_writer;
+        RETURN_IF_ERROR(io::global_local_filesystem()->create_file(path, &file_writer));
+        RowsetWriterContext rowset_ctx;
+        segment_v2::SegmentWriterOptions opts;
+        opts.rowset_ctx = &rowset_ctx;
+        segment_v2::SegmentWriter writer(file_writer.get(), 0, tablet_schema, nullptr, nullptr,
+                                         opts, nullptr);
+        RETURN_IF_ERROR(writer.init());
+
+        constexpr int64_t WRITE_BATCH_SIZE = 4096;
+        for (int64_t row = 0; row < FLAGS_segment_rows; row += WRITE_BATCH_SIZE) {
+            size_t rows = size_t(std::min(WRITE_BATCH_SIZE, FLAGS_segment_rows - row));
+            auto seed = uint32_t(row);
+            vectorized::Block block = tablet_schema->create_block();
+            auto columns = block.mutate_columns();
+            auto& keys = assert_cast<vectorized::ColumnInt64&>(*columns[0]).get_data();
+            for (size_t i = 0; i < rows; ++i) {
+                keys.push_back(row + int64_t(i));
+            }
+            for (size_t cid = 1; cid < columns.size(); ++cid) {
+                columns[cid] = cid <= size_t(FLAGS_int_columns)
+                                       ? vectorized::gen_int64_column(rows, FLAGS_cardinality,
+                                                                      seed + uint32_t(cid))
+                                       : vectorized::gen_string_column(
+                                                 rows, FLAGS_string_length, FLAGS_cardinality,
+                                                 seed + uint32_t(cid));
+            }
+            block.set_columns(std::move(columns));
+            RETURN_IF_ERROR(writer.append_block(&block, 0, rows));
+        }
+        uint64_t file_size = 0;
+        uint64_t index_size = 0;
+        RETURN_IF_ERROR(writer.finalize(&file_size, &index_size));
+        RETURN_IF_ERROR(file_writer->close());
+        LOG(INFO) << "wrote segment " << path << ", rows=" << FLAGS_segment_rows
+                  << ", file_size=" << file_size << ", index_size=" << index_size;
+        return Status::OK();
+    }
+
+    TabletSchemaSPtr tablet_schema;
+    RowsetId rowset_id;
+    std::string path;
+    std::shared_ptr<segment_v2::Segment> segment;
+};
+
+static void BM_SegmentScan(benchmark::State& state, SegmentScanBenchData* data) {
+    const auto& tablet_schema = data->tablet_schema;
+    std::vector<uint32_t> read_columns;
+    size_t num_read_columns = FLAGS_read_columns > 0
+                                      ? std::min<size_t>(FLAGS_read_columns,
+                                                         tablet_schema->num_columns())
+                                      : tablet_schema->num_columns();
+    for (uint32_t cid = 0; cid < num_read_columns; ++cid) {
+        read_columns.push_back(cid);
+    }
+    std::unique_ptr<ColumnPredicate> predicate;
+    if (FLAGS_predicate_selectivity < 100 && FLAGS_int_columns > 0) {
+        if (num_read_columns < 2) {
+            read_columns.push_back(1);
+        }
+        int64_t value = FLAGS_cardinality * FLAGS_predicate_selectivity / 100;
+        predicate = std::make_unique<ComparisonPredicateBase<TYPE_BIGINT, PredicateType::LT>>(
+                1, value);
+    }
+    auto schema = std::make_shared<Schema>(tablet_schema->columns(), read_columns);
+
+    OlapReaderStatistics total_stats;
+    int64_t output_bytes = 0;
+    for (auto _ : state) {
+        OlapReaderStatistics stats;
+        StorageReadOptions read_options;
+        read_options.stats = &stats;
+        read_options.tablet_schema = tablet_schema;
+        read_options.block_row_max = FLAGS_batch_size;
+        read_options.use_page_cache = FLAGS_use_page_cache;
+        read_options.io_ctx.reader_type = ReaderType::READER_QUERY;
+        if (predicate) {
+            read_options.column_predicates.push_back(predicate.get());
+            read_options.col_id_to_predicates.insert(
+                    {predicate->column_id(), AndBlockColumnPredicate::create_shared()});
+            read_options.col_id_to_predicates[predicate->column_id()]->add_column_predicate(
+                    SingleColumnBlockPredicate::create_unique(predicate.get()));
+        }
+
+        std::unique_ptr<RowwiseIterator> iter;
+        auto st = data->segment->new_iterator(schema, read_options, &iter);
+        if (!st.ok()) {
+            state.SkipWithError(st.to_string().c_str());
+            return;
+        }
+        vectorized::Block block = tablet_schema->create_block(read_columns);
+        while (true) {
+            st = iter->next_batch(&block);
+            if (st.is<ErrorCode::END_OF_FILE>()) {
+                break;
+            }
+            if (!st.ok()) {
+                state.SkipWithError(st.to_string().c_str());
+                return;
+            }
+            output_bytes += block.bytes();
+            block.clear_column_data();
+        }
+
+        total_stats.raw_rows_read += stats.raw_rows_read;
+        total_stats.rows_vec_cond_filtered += stats.rows_vec_cond_filtered;
+        total_stats.compressed_bytes_read += stats.compressed_bytes_read;
+        total_stats.uncompressed_bytes_read += stats.uncompressed_bytes_read;
+        total_stats.io_ns += stats.io_ns;
+        total_stats.decompress_ns += stats.decompress_ns;
+        total_stats.block_init_ns += stats.block_init_ns;
+        total_stats.block_load_ns += stats.block_load_ns;
+        total_stats.predicate_column_read_ns += stats.predicate_column_read_ns;
+        total_stats.non_predicate_read_ns += stats.non_predicate_read_ns;
+        total_stats.lazy_read_ns += stats.lazy_read_ns;
+        total_stats.vec_cond_ns += stats.vec_cond_ns;
+        total_stats.output_col_ns += stats.output_col_ns;
+    }
+
+    state.SetItemsProcessed(state.iterations() * FLAGS_segment_rows);
+    state.SetBytesProcessed(output_bytes);
+    auto per_iteration = [](int64_t value) {
+        return benchmark::Counter(double(value), benchmark::Counter::kAvgIterations);
+    };
+    state.counters["raw_rows_read"] = per_iteration(total_stats.raw_rows_read);
+    state.counters["rows_vec_cond_filtered"] = per_iteration(total_stats.rows_vec_cond_filtered);
+    state.counters["compressed_bytes"] = per_iteration(total_stats.compressed_bytes_read);
+    state.counters["uncompressed_bytes"] = per_iteration(total_stats.uncompressed_bytes_read);
+    state.counters["io_ns"] = per_iteration(total_stats.io_ns);
+    state.counters["decompress_ns"] = per_iteration(total_stats.decompress_ns);
+    state.counters["block_init_ns"] = per_iteration(total_stats.block_init_ns);
+    state.counters["block_load_ns"] = per_iteration(total_stats.block_load_ns);
+    state.counters["predicate_column_read_ns"] =
+            per_iteration(total_stats.predicate_column_read_ns);
+    state.counters["non_predicate_read_ns"] = per_iteration(total_stats.non_predicate_read_ns);
+    state.counters["lazy_read_ns"] = per_iteration(total_stats.lazy_read_ns);
+    state.counters["vec_cond_ns"] = per_iteration(total_stats.vec_cond_ns);
+    state.counters["output_col_ns"] = per_iteration(total_stats.output_col_ns);
+}
+
+// The caches a segment read goes through, like the ones of be-test
+static void init_env() {
+    ExecEnv::GetInstance()->init_mem_tracker();
+    thread_context()->thread_mem_tracker_mgr->init();
+    thread_context()->thread_mem_tracker_mgr->attach_limiter_tracker(
+            MemTrackerLimiter::create_shared(MemTrackerLimiter::Type::GLOBAL, "SegmentScan"));
+    ExecEnv::GetInstance()->set_cache_manager(CacheManager::create_global_instance());
+    ExecEnv::GetInstance()->set_storage_page_cache(
+            StoragePageCache::create_global_cache(FLAGS_page_cache_mb << 20, 10, 0));
+    ExecEnv::GetInstance()->set_tablet_schema_cache(
+            TabletSchemaCache::create_global_schema_cache(config::tablet_schema_cache_capacity));
+    ExecEnv::GetInstance()->set_tablet_column_object_pool(
+            TabletColumnObjectPool::create_global_column_cache(
+                    config::tablet_schema_cache_capacity));
+    CpuInfo::init();
+    MemInfo::init();
+}
+
+} // namespace doris
+
+int main(int argc, char** argv) {
+    SCOPED_INIT_THREAD_CONTEXT();
+    benchmark::Initialize(&argc, argv);
+    google::ParseCommandLineFlags(&argc, &argv, true);
+    doris::init_env();
+
+    doris::SegmentScanBenchData data;
+    auto st = data.init();
+    if (!st.ok()) {
+        LOG(ERROR) << "failed to prepare the segment: " << st;
+        return 1;
+    }
+    benchmark::RegisterBenchmark("BM_SegmentScan", doris::BM_SegmentScan, &data)
+            ->Unit(benchmark::kMillisecond);
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    static_cast<void>(doris::io::global_local_filesystem()->delete_directory(FLAGS_segment_dir));
+    return 0;
+}
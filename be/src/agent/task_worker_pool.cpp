@@ -56,6 +56,7 @@
 #include "common/config.h"
 #include "common/logging.h"
 #include "common/status.h"
+#include "cpp/sync_point.h"
 #include "io/fs/file_system.h"
 #include "io/fs/hdfs_file_system.h"
 #include "io/fs/local_file_system.h"
@@ -1960,9 +1961,57 @@ PublishVersionWorkerPool::PublishVersionWorkerPool(StorageEngine& engine)
                          [this](const TAgentTaskRequest& task) { publish_version_callback(task); }),
           _engine(engine) {}
 
-PublishVersionWorkerPool::~PublishVersionWorkerPool() = default;
+PublishVersionWorkerPool::~PublishVersionWorkerPool() {
+    // running callbacks use the deferred queue, stop them before it is destroyed
+    stop();
+}
 
 void PublishVersionWorkerPool::publish_version_callback(const TAgentTaskRequest& req) {
+    {
+        std::lock_guard lock(_deferred_mtx);
+        ++_running_count;
+    }
+    bool deferred = _publish_version(req);
+    std::deque<std::unique_ptr<TAgentTaskRequest>> ready_tasks;
+    {
+        std::lock_guard lock(_deferred_mtx);
+        --_running_count;
+        // A finished task may unblock the deferred ones. If this task is deferred itself, only
+        // resubmit when nothing else is running, otherwise nobody would wake the deferred tasks.
+        if (!deferred || _running_count == 0) {
+            ready_tasks.swap(_deferred_tasks);
+        }
+    }
+    // Older transactions are more likely to be the missing previous versions
+    std::sort(ready_tasks.begin(), ready_tasks.end(), [](const auto& lhs, const auto& rhs) {
+        return lhs->publish_version_req.transaction_id < rhs->publish_version_req.transaction_id;
+    });
+    for (auto& task : ready_tasks) {
+        _resubmit_deferred(std::move(task));
+    }
+}
+
+void PublishVersionWorkerPool::_resubmit_deferred(std::unique_ptr<TAgentTaskRequest> task) {
+    PUBLISH_VERSION_count << 1;
+    std::shared_ptr<TAgentTaskRequest> req = std::move(task);
+    auto st = _thread_pool->submit_func([this, req] {
+        this->publish_version_callback(*req);
+        PUBLISH_VERSION_count << -1;
+    });
+    if (!st.ok()) [[unlikely]] {
+        PUBLISH_VERSION_count << -1;
+        // FE will resend the publish task of an unfinished transaction
+        LOG_WARNING("failed to resubmit publish version task")
+                .tag("signature", req->signature)
+                .tag("transaction_id", req->publish_version_req.transaction_id)
+                .error(st);
+        remove_task_info(req->task_type, req->signature);
+    }
+}
+
+bool PublishVersionWorkerPool::_publish_version(const TAgentTaskRequest& req) {
+    TEST_SYNC_POINT_RETURN_WITH_VALUE("PublishVersionWorkerPool::_publish_version", false, this,
+                                      &req);
     const auto& publish_version_req = req.publish_version_req;
     DorisMetrics::instance()->publish_task_request_total->increment(1);
     VLOG_NOTICE << "get publish version task. signature=" << req.signature;
@@ -2004,18 +2053,10 @@ void PublishVersionWorkerPool::publish_version_callback(const TAgentTaskRequest&
                 break;
             }
 
-            // Version not continuous, put to queue and wait pre version publish task execute
-            PUBLISH_VERSION_count << 1;
-            auto st = _thread_pool->submit_func([this, req] {
-                this->publish_version_callback(req);
-                PUBLISH_VERSION_count << -1;
-            });
-            if (!st.ok()) [[unlikely]] {
-                PUBLISH_VERSION_count << -1;
-                status = std::move(st);
-            } else {
-                return;
-            }
+            // Version not continuous, defer it until the previous version publish task executes
+            std::lock_guard lock(_deferred_mtx);
+            _deferred_tasks.push_back(std::make_unique<TAgentTaskRequest>(req));
+            return true;
         }
 
         LOG_WARNING("failed to publish version")
@@ -2092,6 +2133,7 @@ void PublishVersionWorkerPool::publish_version_callback(const TAgentTaskRequest&
             table_id_to_tablet_id_to_num_delta_rows);
     finish_task(finish_task_request);
     remove_task_info(req.task_type, req.signature);
+    return false;
 }
 
 void clear_transaction_task_callback(StorageEngine& engine, const TAgentTaskRequest& req) {
@@ -74,7 +74,18 @@ public:
 private:
     void publish_version_callback(const TAgentTaskRequest& task);
 
+    // Returns true if the task waits for a previous version and was put into `_deferred_tasks`
+    bool _publish_version(const TAgentTaskRequest& task);
+
+    void _resubmit_deferred(std::unique_ptr<TAgentTaskRequest> task);
+
     StorageEngine& _engine;
+
+    // Tasks whose previous version has not been published yet. They are resubmitted after another
+    // publish task finishes instead of spinning through the queue ahead of fresh tasks.
+    std::mutex _deferred_mtx;
+    int _running_count {0};
+    std::deque<std::unique_ptr<TAgentTaskRequest>> _deferred_tasks;
 };
 
 class PriorTaskWorkerPool final : public TaskWorkerPoolIf {
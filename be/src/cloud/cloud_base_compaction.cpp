@@ -478,8 +478,11 @@ void CloudBaseCompaction::do_lease() {
     auto compaction_job = job.add_compaction();
     compaction_job->set_id(_uuid);
     using namespace std::chrono;
-    int64_t lease_time = duration_cast<seconds>(system_clock::now().time_since_epoch()).count() +
-                         config::lease_compaction_interval_seconds * 4;
+    int64_t now = duration_cast<seconds>(system_clock::now().time_since_epoch()).count();
+    if (!need_renew_lease(now)) {
+        return;
+    }
+    int64_t lease_time = now + config::lease_compaction_interval_seconds * 4;
     compaction_job->set_lease(lease_time);
     auto st = _engine.meta_mgr().lease_tablet_job(job);
     if (!st.ok()) {
@@ -487,7 +490,9 @@ void CloudBaseCompaction::do_lease() {
                 .tag("job_id", _uuid)
                 .tag("tablet_id", _tablet->tablet_id())
                 .error(st);
+        return;
     }
+    _lease_expiration = lease_time;
 }
 
 } // namespace doris
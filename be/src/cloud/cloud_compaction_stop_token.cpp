@@ -21,6 +21,7 @@
 #include "cloud/config.h"
 #include "common/logging.h"
 #include "gen_cpp/cloud.pb.h"
+#include "olap/compaction.h"
 
 namespace doris {
 
@@ -43,8 +44,11 @@ void CloudCompactionStopToken::do_lease() {
     auto* compaction_job = job.add_compaction();
     compaction_job->set_id(_uuid);
     using namespace std::chrono;
-    int64_t lease_time = duration_cast<seconds>(system_clock::now().time_since_epoch()).count() +
-                         (config::lease_compaction_interval_seconds * 4);
+    int64_t now = duration_cast<seconds>(system_clock::now().time_since_epoch()).count();
+    if (!CloudCompactionMixin::need_renew_lease(now, _lease_expiration)) {
+        return;
+    }
+    int64_t lease_time = now + (config::lease_compaction_interval_seconds * 4);
     compaction_job->set_lease(lease_time);
     auto st = _engine.meta_mgr().lease_tablet_job(job);
     if (!st.ok()) {
@@ -53,7 +57,9 @@ void CloudCompactionStopToken::do_lease() {
                 .tag("delete_bitmap_lock_initiator", _initiator)
                 .tag("tablet_id", _tablet->tablet_id())
                 .error(st);
+        return;
     }
+    _lease_expiration = lease_time;
 }
 
 Status CloudCompactionStopToken::do_register() {
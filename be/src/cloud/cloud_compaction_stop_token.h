@@ -40,6 +40,8 @@ private:
     CloudTabletSPtr _tablet;
     std::string _uuid;
     int64_t _initiator;
+    // Lease granted by the last successful `do_lease`, in seconds since epoch
+    int64_t _lease_expiration = 0;
 };
 
 } // namespace doris
@@ -756,7 +756,7 @@ Status CloudMetaMgr::sync_tablet_rowsets_unlocked(CloudTablet* tablet,
             }
             std::vector<RowsetSharedPtr> rowsets;
             rowsets.reserve(resp.rowset_meta().size());
-            for (const auto& cloud_rs_meta_pb : resp.rowset_meta()) {
+            for (auto& cloud_rs_meta_pb : *resp.mutable_rowset_meta()) {
                 VLOG_DEBUG << "get rowset meta, tablet_id=" << cloud_rs_meta_pb.tablet_id()
                            << ", version=[" << cloud_rs_meta_pb.start_version() << '-'
                            << cloud_rs_meta_pb.end_version() << ']';
@@ -770,25 +770,28 @@ Status CloudMetaMgr::sync_tablet_rowsets_unlocked(CloudTablet* tablet,
                 // Check if the rowset meta contains a schema dictionary key list.
                 if (cloud_rs_meta_pb.has_schema_dict_key_list() && !resp.has_schema_dict()) {
                     // Use the locally cached dictionary.
-                    RowsetMetaCloudPB copied_cloud_rs_meta_pb = cloud_rs_meta_pb;
+                    // The response is not needed anymore, avoid copying the (possibly wide)
+                    // schema of every rowset meta.
+                    RowsetMetaCloudPB copied_cloud_rs_meta_pb = std::move(cloud_rs_meta_pb);
                     CloudStorageEngine& engine =
                             ExecEnv::GetInstance()->storage_engine().to_cloud();
                     {
                         wlock.unlock();
                         RETURN_IF_ERROR(
                                 engine.get_schema_cloud_dictionary_cache()
-                                        .replace_dict_keys_to_schema(cloud_rs_meta_pb.index_id(),
-                                                                     &copied_cloud_rs_meta_pb));
+                                        .replace_dict_keys_to_schema(
+                                                copied_cloud_rs_meta_pb.index_id(),
+                                                &copied_cloud_rs_meta_pb));
                         wlock.lock();
                     }
-                    meta_pb = cloud_rowset_meta_to_doris(copied_cloud_rs_meta_pb);
-                } else {
-                    // Otherwise, use the schema dictionary from the response (if available).
+                    meta_pb = cloud_rowset_meta_to_doris(std::move(copied_cloud_rs_meta_pb));
+                } else if (resp.has_schema_dict()) {
+                    // Otherwise, use the schema dictionary from the response.
                     meta_pb = cloud_rowset_meta_to_doris(cloud_rs_meta_pb);
-                    if (resp.has_schema_dict()) {
-                        RETURN_IF_ERROR(fill_schema_with_dict(cloud_rs_meta_pb, &meta_pb,
-                                                              resp.schema_dict()));
-                    }
+                    RETURN_IF_ERROR(fill_schema_with_dict(cloud_rs_meta_pb, &meta_pb,
+                                                          resp.schema_dict()));
+                } else {
+                    meta_pb = cloud_rowset_meta_to_doris(std::move(cloud_rs_meta_pb));
                 }
                 auto rs_meta = std::make_shared<RowsetMeta>();
                 rs_meta->init_from_pb(meta_pb);
@@ -1356,6 +1359,8 @@ Status CloudMetaMgr::abort_tablet_job(const TabletJobInfoPB& job) {
 
 Status CloudMetaMgr::lease_tablet_job(const TabletJobInfoPB& job) {
     VLOG_DEBUG << "lease_tablet_job: " << job.ShortDebugString();
+    TEST_SYNC_POINT_RETURN_WITH_VALUE("CloudMetaMgr::lease_tablet_job", Status::OK(), job);
+
     FinishTabletJobRequest req;
     FinishTabletJobResponse res;
     req.mutable_job()->CopyFrom(job);
@@ -480,7 +480,7 @@ void CloudStorageEngine::_compaction_tasks_producer_callback() {
     int64_t interval = config::generate_compaction_tasks_interval_ms;
     do {
         int64_t cur_time = UnixMillis();
-        if (!config::disable_auto_compaction) {
+        if (!config::disable_auto_compaction && !ExecEnv::is_draining()) {
             Status st = _adjust_compaction_thread_num();
             if (!st.ok()) {
                 break;
@@ -1015,6 +1015,7 @@ void CloudStorageEngine::_lease_compaction_thread_callback() {
             }
         }
         // TODO(plat1ko): Support batch lease rpc
+        // Each job skips the rpc while its last granted lease is still far from expiring.
         for (auto& stop_token : compation_stop_tokens) {
             stop_token->do_lease();
         }
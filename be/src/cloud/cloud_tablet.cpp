@@ -36,9 +36,11 @@
 #include "cloud/cloud_storage_engine.h"
 #include "cloud/cloud_tablet_mgr.h"
 #include "cloud/cloud_warm_up_manager.h"
+#include "cloud/config.h"
 #include "common/cast_set.h"
 #include "common/config.h"
 #include "common/logging.h"
+#include "cpp/sync_point.h"
 #include "io/cache/block_file_cache_downloader.h"
 #include "io/cache/block_file_cache_factory.h"
 #include "olap/compaction.h"
@@ -195,6 +197,8 @@ Status CloudTablet::sync_rowsets(const SyncOptions& options, SyncRowsetStats* st
     }
 
     // serially execute sync to reduce unnecessary network overhead
+    int64_t requested_after = _num_started_syncs.load(std::memory_order_acquire);
+    TEST_SYNC_POINT("CloudTablet::sync_rowsets.requested");
     std::unique_lock lock(_sync_meta_lock);
     if (options.query_version > 0) {
         std::shared_lock rlock(_meta_lock);
@@ -202,10 +206,19 @@ Status CloudTablet::sync_rowsets(const SyncOptions& options, SyncRowsetStats* st
             return Status::OK();
         }
     }
+    // A sync which started after this one was requested has already fetched the latest meta
+    if (config::enable_coalesce_tablet_sync_rowsets && _last_succeeded_sync > requested_after &&
+        _last_succeeded_sync_options.covers(options)) {
+        return Status::OK();
+    }
 
+    int64_t sync_id = _num_started_syncs.fetch_add(1, std::memory_order_acq_rel) + 1;
     auto st = _engine.meta_mgr().sync_tablet_rowsets_unlocked(this, lock, options, stats);
     if (st.is<ErrorCode::NOT_FOUND>()) {
         clear_cache();
+    } else if (st.ok()) {
+        _last_succeeded_sync = sync_id;
+        _last_succeeded_sync_options = options;
     }
 
     return st;
@@ -47,6 +47,13 @@ struct SyncOptions {
     bool full_sync = false;
     bool merge_schema = false;
     int64_t query_version = -1;
+
+    // Whether a sync with these options also brings what a sync with `other` would
+    bool covers(const SyncOptions& other) const {
+        return (warmup_delta_data || !other.warmup_delta_data) &&
+               (sync_delete_bitmap || !other.sync_delete_bitmap) &&
+               (full_sync || !other.full_sync) && (merge_schema || !other.merge_schema);
+    }
 };
 
 class CloudTablet final : public BaseTablet {
@@ -297,6 +304,11 @@ private:
     // this mutex MUST ONLY be used when sync meta
     bthread::Mutex _sync_meta_lock;
     // ATTENTION: lock order should be: _sync_meta_lock -> _meta_lock
+    // Sequence of rowset syncs started under _sync_meta_lock, and the latest successful one,
+    // so that a sync waiting for the lock can reuse a sync started after it was requested.
+    std::atomic<int64_t> _num_started_syncs {0};
+    int64_t _last_succeeded_sync {0};
+    SyncOptions _last_succeeded_sync_options;
 
     std::atomic<int64_t> _cumulative_point {-1};
     std::atomic<int64_t> _approximate_num_rowsets {-1};
@@ -42,6 +42,13 @@ void TabletHotspot::count(const BaseTablet& tablet) {
     counter->cur_counter++;
 }
 
+uint64_t TabletHotspot::qpw(int64_t tablet_id) {
+    auto& slot = _tablets_hotspot[tablet_id % s_slot_size];
+    std::lock_guard lock(slot.mtx);
+    auto iter = slot.map.find(tablet_id);
+    return iter == slot.map.end() ? 0 : iter->second->qpw();
+}
+
 TabletHotspot::TabletHotspot() {
     _counter_thread = std::thread(&TabletHotspot::make_dot_point, this);
 }
@@ -70,6 +70,8 @@ public:
     // When query the tablet, count it
     void count(const BaseTablet& tablet);
     void get_top_n_hot_partition(std::vector<THotTableMessage>* hot_tables);
+    // Queries of the tablet in the last week, 0 if it is never queried
+    uint64_t qpw(int64_t tablet_id);
 
 private:
     void make_dot_point();
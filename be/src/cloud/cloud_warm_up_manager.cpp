@@ -21,10 +21,16 @@
 #include <bvar/reducer.h>
 
 #include <algorithm>
+#include <chrono>
 #include <cstddef>
+#include <thread>
 #include <tuple>
+#include <unordered_map>
+#include <vector>
 
 #include "bvar/bvar.h"
+#include "cloud/cloud_storage_engine.h"
+#include "cloud/cloud_tablet_hotspot.h"
 #include "cloud/cloud_tablet_mgr.h"
 #include "cloud/config.h"
 #include "common/logging.h"
@@ -89,6 +95,7 @@ CloudWarmUpManager::~CloudWarmUpManager() {
         _closed = true;
     }
     _cond.notify_all();
+    notify_inflight_chunks();
     if (_download_thread.joinable()) {
         _download_thread.join();
     }
@@ -126,12 +133,24 @@ void CloudWarmUpManager::submit_download_tasks(io::Path path, int64_t file_size,
     }
 
     const int64_t chunk_size = 10 * 1024 * 1024; // 10MB
-    int64_t offset = 0;
-    int64_t remaining_size = file_size;
+    std::vector<int64_t> chunk_offsets;
+    for (int64_t offset = 0; offset < file_size; offset += chunk_size) {
+        chunk_offsets.push_back(offset);
+    }
+    // The last chunk holds the footer and the index pages of a segment, which every read of the
+    // segment needs first
+    if (chunk_offsets.size() > 1) {
+        std::rotate(chunk_offsets.begin(), chunk_offsets.end() - 1, chunk_offsets.end());
+    }
 
-    while (remaining_size > 0) {
-        int64_t current_chunk_size = std::min(chunk_size, remaining_size);
+    for (int64_t offset : chunk_offsets) {
+        int64_t current_chunk_size = std::min(chunk_size, file_size - offset);
+        wait_for_inflight_chunks();
         wait->add_count();
+        {
+            std::lock_guard lock(_inflight_chunks->mtx);
+            ++_inflight_chunks->num;
+        }
 
         _engine.file_cache_block_downloader().submit_download_task(io::DownloadFileMeta {
                 .path = path,
@@ -145,7 +164,12 @@ void CloudWarmUpManager::submit_download_tasks(io::Path path, int64_t file_size,
                                 .is_dryrun = config::enable_reader_dryrun_when_download_file_cache,
                         },
                 .download_done =
-                        [=](Status st) {
+                        [=, inflight_chunks = _inflight_chunks](Status st) {
+                            {
+                                std::lock_guard lock(inflight_chunks->mtx);
+                                --inflight_chunks->num;
+                            }
+                            inflight_chunks->cond.notify_all();
                             if (!st) {
                                 LOG_WARNING("Warm up error ").error(st);
                             } else if (is_index) {
@@ -162,12 +186,27 @@ void CloudWarmUpManager::submit_download_tasks(io::Path path, int64_t file_size,
                             wait->signal();
                         },
         });
-
-        offset += current_chunk_size;
-        remaining_size -= current_chunk_size;
     }
 }
 
+void CloudWarmUpManager::wait_for_inflight_chunks() {
+    std::unique_lock lock(_inflight_chunks->mtx);
+    _inflight_chunks->cond.wait(lock, [this] {
+        if (config::warm_up_max_inflight_chunks <= 0 ||
+            _inflight_chunks->num < config::warm_up_max_inflight_chunks) {
+            return true;
+        }
+        std::lock_guard job_lock(_mtx);
+        return _closed || _cur_job_id == 0; // closed or the job is canceled
+    });
+}
+
+void CloudWarmUpManager::notify_inflight_chunks() {
+    // Taking the lock orders this after a waiter that has checked _closed and _cur_job_id
+    { std::lock_guard lock(_inflight_chunks->mtx); }
+    _inflight_chunks->cond.notify_all();
+}
+
 void CloudWarmUpManager::handle_jobs() {
 #ifndef BE_TEST
     constexpr int WAIT_TIME_SECONDS = 600;
@@ -192,7 +231,19 @@ void CloudWarmUpManager::handle_jobs() {
         std::shared_ptr<bthread::CountdownEvent> wait =
                 std::make_shared<bthread::CountdownEvent>(0);
 
-        for (int64_t tablet_id : cur_job->tablet_ids) {
+        // Warm up the tablets queried most in the last week first
+        std::vector<int64_t> tablet_ids = cur_job->tablet_ids;
+        {
+            std::unordered_map<int64_t, uint64_t> tablet_qpw;
+            for (int64_t tablet_id : tablet_ids) {
+                tablet_qpw[tablet_id] = _engine.tablet_hotspot().qpw(tablet_id);
+            }
+            std::stable_sort(tablet_ids.begin(), tablet_ids.end(), [&](int64_t a, int64_t b) {
+                return tablet_qpw[a] > tablet_qpw[b];
+            });
+        }
+
+        for (int64_t tablet_id : tablet_ids) {
             if (_cur_job_id == 0) { // The job is canceled
                 break;
             }
@@ -226,13 +277,8 @@ void CloudWarmUpManager::handle_jobs() {
                         expiration_time = 0;
                     }
 
-                    // 1st. download segment files
-                    submit_download_tasks(
-                            storage_resource.value()->remote_segment_path(*rs, seg_id),
-                            rs->segment_file_size(seg_id), storage_resource.value()->fs,
-                            expiration_time, wait);
-
-                    // 2nd. download inverted index files
+                    // 1st. download inverted index files, they are small and opened before
+                    // the segment data is read
                     int64_t file_size = -1;
                     auto schema_ptr = rs->tablet_schema();
                     auto idx_version = schema_ptr->get_inverted_index_storage_format();
@@ -273,6 +319,12 @@ void CloudWarmUpManager::handle_jobs() {
                                                   expiration_time, wait, true);
                         }
                     }
+
+                    // 2nd. download segment files
+                    submit_download_tasks(
+                            storage_resource.value()->remote_segment_path(*rs, seg_id),
+                            rs->segment_file_size(seg_id), storage_resource.value()->fs,
+                            expiration_time, wait);
                 }
             }
             g_file_cache_once_or_periodic_warm_up_finished_tablet_num << 1;
@@ -374,17 +426,20 @@ std::tuple<int64_t, int64_t, int64_t, int64_t> CloudWarmUpManager::get_current_j
 }
 
 Status CloudWarmUpManager::clear_job(int64_t job_id) {
-    std::lock_guard lock(_mtx);
     Status st = Status::OK();
-    if (job_id == _cur_job_id) {
-        _cur_job_id = 0;
-        _cur_batch_id = -1;
-        _pending_job_metas.clear();
-        _finish_job.clear();
-    } else {
-        st = Status::InternalError("The job {} is not current job, current job is {}", job_id,
-                                   _cur_job_id);
+    {
+        std::lock_guard lock(_mtx);
+        if (job_id == _cur_job_id) {
+            _cur_job_id = 0;
+            _cur_batch_id = -1;
+            _pending_job_metas.clear();
+            _finish_job.clear();
+        } else {
+            st = Status::InternalError("The job {} is not current job, current job is {}", job_id,
+                                       _cur_job_id);
+        }
     }
+    notify_inflight_chunks();
     return st;
 }
 
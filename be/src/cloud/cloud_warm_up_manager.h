@@ -94,9 +94,22 @@ private:
                                int64_t expiration_time,
                                std::shared_ptr<bthread::CountdownEvent> wait,
                                bool is_index = false);
+    // Wait until the number of downloading chunks is below warm_up_max_inflight_chunks, or the
+    // job is canceled or the manager closes
+    void wait_for_inflight_chunks();
+    // Wake up wait_for_inflight_chunks, must be called without holding _mtx
+    void notify_inflight_chunks();
     std::mutex _mtx;
     std::condition_variable _cond;
     int64_t _cur_job_id {0};
+    struct InflightChunks {
+        // taken before _mtx when both are held
+        std::mutex mtx;
+        std::condition_variable cond;
+        int64_t num {0};
+    };
+    // Shared with the download callbacks which may outlive this manager
+    std::shared_ptr<InflightChunks> _inflight_chunks = std::make_shared<InflightChunks>();
     int64_t _cur_batch_id {-1};
     std::deque<std::shared_ptr<JobMeta>> _pending_job_metas;
     std::vector<std::shared_ptr<JobMeta>> _finish_job;
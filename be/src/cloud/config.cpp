@@ -41,6 +41,7 @@ DEFINE_Int64(tablet_cache_shards, "16");
 DEFINE_mInt32(tablet_sync_interval_s, "1800");
 DEFINE_mInt32(init_scanner_sync_rowsets_parallelism, "10");
 DEFINE_mInt32(sync_rowsets_slow_threshold_ms, "1000");
+DEFINE_mBool(enable_coalesce_tablet_sync_rowsets, "true");
 
 DEFINE_mInt64(min_compaction_failure_interval_ms, "5000");
 DEFINE_mInt64(base_compaction_freeze_interval_s, "1800");
@@ -49,6 +50,7 @@ DEFINE_mInt64(cumu_compaction_interval_s, "1800");
 
 DEFINE_mInt32(compaction_timeout_seconds, "86400");
 DEFINE_mInt32(lease_compaction_interval_seconds, "20");
+DEFINE_mInt32(lease_compaction_renew_ahead_intervals, "2");
 DEFINE_mBool(enable_parallel_cumu_compaction, "false");
 DEFINE_mDouble(base_compaction_thread_num_factor, "0.25");
 DEFINE_mDouble(cumu_compaction_thread_num_factor, "0.5");
@@ -101,5 +103,7 @@ DEFINE_mInt64(warm_up_rowset_sync_wait_min_timeout_ms, "10000");
 
 DEFINE_mInt64(warm_up_rowset_sync_wait_max_timeout_ms, "120000");
 
+DEFINE_mInt64(warm_up_max_inflight_chunks, "64");
+
 #include "common/compile_check_end.h"
 } // namespace doris::config
@@ -72,6 +72,9 @@ DECLARE_mInt32(tablet_sync_interval_s);
 // parallelism for scanner init where may issue RPCs to sync rowset meta from MS
 DECLARE_mInt32(init_scanner_sync_rowsets_parallelism);
 DECLARE_mInt32(sync_rowsets_slow_threshold_ms);
+// Whether a sync of tablet rowsets that waited for a concurrent sync of the same tablet is
+// skipped when that sync started after it was requested and already fetched what it needs.
+DECLARE_mBool(enable_coalesce_tablet_sync_rowsets);
 
 // Cloud compaction config
 DECLARE_mInt64(min_compaction_failure_interval_ms);
@@ -83,6 +86,9 @@ DECLARE_mInt64(cumu_compaction_interval_s);
 
 DECLARE_mInt32(compaction_timeout_seconds);
 DECLARE_mInt32(lease_compaction_interval_seconds);
+// Renew the lease of a compaction job only when it expires within this many lease intervals.
+// Leases are granted for 4 intervals, so any value >= 4 renews on every lease round.
+DECLARE_mInt32(lease_compaction_renew_ahead_intervals);
 DECLARE_mBool(enable_parallel_cumu_compaction);
 DECLARE_mDouble(base_compaction_thread_num_factor);
 DECLARE_mDouble(cumu_compaction_thread_num_factor);
@@ -142,5 +148,9 @@ DECLARE_mInt64(warm_up_rowset_sync_wait_min_timeout_ms);
 
 DECLARE_mInt64(warm_up_rowset_sync_wait_max_timeout_ms);
 
+// Max number of chunks a warm up job keeps in downloading, so that a large job leaves the
+// download bandwidth to the file cache misses of queries. 0 means unlimited.
+DECLARE_mInt64(warm_up_max_inflight_chunks);
+
 #include "common/compile_check_end.h"
 } // namespace doris::config
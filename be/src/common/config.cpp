@@ -137,6 +137,14 @@ DEFINE_Double(schema_change_mem_limit_frac, "0.6");
 // P.S. This is also required, because tcmalloc can not allocate a chunk of
 // memory greater than 16 GB.
 DEFINE_mInt64(mmap_threshold, "134217728"); // bytes
+DEFINE_String(huge_page_alloc_mode, "none");
+DEFINE_Validator(huge_page_alloc_mode, [](const std::string& config) -> bool {
+    return config == "none" || config == "madvise" || config == "hugetlb";
+});
+DEFINE_Int64(huge_page_alloc_threshold_bytes, "67108864");
+DEFINE_mBool(enable_column_buffer_pool, "false");
+DEFINE_mInt64(column_buffer_pool_thread_cache_bytes, "8388608");
+DEFINE_mInt64(column_buffer_pool_max_cache_bytes, "1073741824");
 
 // When hash table capacity is greater than 2^double_grow_degree(default 2G), grow when 75% of the capacity is satisfied.
 // Increase can reduce the number of hash table resize, but may waste more memory.
@@ -146,6 +154,12 @@ DEFINE_mInt32(max_fill_rate, "2");
 
 DEFINE_mInt32(double_resize_threshold, "23");
 
+DEFINE_mInt64(hash_join_radix_partition_bytes, "0");
+
+DEFINE_mBool(enable_hash_join_probe_prefetch, "true");
+DEFINE_mBool(enable_hash_join_direct_mapping, "true");
+DEFINE_mBool(enable_nested_loop_join_band_index, "true");
+
 // The maximum low water mark of the system `/proc/meminfo/MemAvailable`, Unit byte, default -1.
 // if it is -1, then low water mark = min(MemTotal - MemLimit, MemTotal * 5%), which is 3.2G on a 64G machine.
 // Turn up max. more memory buffers will be reserved for Memory GC.
@@ -257,6 +271,12 @@ DEFINE_mInt32(download_low_speed_limit_kbps, "50");
 DEFINE_mInt32(download_low_speed_time, "300");
 // whether to download small files in batch
 DEFINE_mBool(enable_batch_download, "true");
+DEFINE_mInt32(single_replica_compaction_download_parallelism, "4");
+DEFINE_mInt32(clone_download_parallelism_per_task, "4");
+DEFINE_mInt32(clone_download_parallelism_per_disk, "8");
+DEFINE_mInt32(clone_download_parallelism_per_host, "8");
+DEFINE_Int32(clone_download_thread_num, "16");
+DEFINE_mInt32(clone_download_slot_wait_timeout_s, "600");
 // whether to check md5sum when download
 DEFINE_mBool(enable_download_md5sum_check, "false");
 // download binlog meta timeout, default 30s
@@ -330,6 +350,7 @@ DEFINE_Validator(doris_scanner_thread_pool_thread_num, [](const int config) -> b
 });
 DEFINE_Int32(doris_scanner_min_thread_pool_thread_num, "8");
 DEFINE_Int32(remote_split_source_batch_size, "1000");
+DEFINE_mInt64(file_scan_split_size_mb, "128");
 DEFINE_Int32(doris_max_remote_scanner_thread_pool_thread_num, "-1");
 // number of olap scanner thread pool queue size
 DEFINE_Int32(doris_scanner_thread_pool_queue_size, "102400");
@@ -349,18 +370,24 @@ DEFINE_mInt32(doris_scanner_row_num, "16384");
 DEFINE_mInt32(doris_scanner_row_bytes, "10485760");
 // single read execute fragment max run time millseconds
 DEFINE_mInt32(doris_scanner_max_run_time_ms, "1000");
+DEFINE_mBool(enable_adaptive_scan_concurrency, "true");
+DEFINE_mInt32(adaptive_scan_concurrency_adjust_interval_ms, "100");
 // (Advanced) Maximum size of per-query receive-side buffer
 DEFINE_mInt32(exchg_node_buffer_size_bytes, "20485760");
 DEFINE_mInt32(exchg_buffer_queue_capacity_factor, "64");
+DEFINE_mInt64(exchange_sink_credit_bytes_per_instance, "0");
 
 // memory_limitation_per_thread_for_schema_change_bytes unit bytes
 DEFINE_mInt64(memory_limitation_per_thread_for_schema_change_bytes, "2147483648");
+DEFINE_Int32(schema_change_convert_rowset_threads, "4");
 
 DEFINE_mInt32(cache_prune_interval_sec, "10");
 DEFINE_mInt32(cache_periodic_prune_stale_sweep_sec, "60");
 // the clean interval of tablet lookup cache
 DEFINE_mInt32(tablet_lookup_cache_stale_sweep_time_sec, "30");
 DEFINE_mInt32(point_query_row_cache_stale_sweep_time_sec, "300");
+DEFINE_mInt32(point_query_batch_window_us, "0");
+DEFINE_mInt32(point_query_batch_wait_timeout_ms, "1000");
 DEFINE_mInt32(disk_stat_monitor_interval, "5");
 DEFINE_mInt32(unused_rowset_monitor_interval, "30");
 DEFINE_mInt32(quering_rowsets_evict_interval, "30");
@@ -410,6 +437,14 @@ DEFINE_mBool(disable_storage_page_cache, "false");
 DEFINE_mBool(disable_storage_row_cache, "true");
 // whether to disable pk page cache feature in storage
 DEFINE_Bool(disable_pk_storage_page_cache, "false");
+DEFINE_mInt64(storage_page_cache_streaming_scan_bytes, "0");
+DEFINE_mBool(storage_page_cache_bypass_streaming_read, "false");
+DEFINE_mBool(enable_storage_page_load_coalescing, "true");
+DEFINE_Int32(storage_page_cache_snapshot_interval_sec, "0");
+DEFINE_String(storage_page_cache_snapshot_path, "${DORIS_HOME}/storage/page_cache.snapshot");
+DEFINE_mInt64(storage_page_cache_snapshot_max_pages, "200000");
+DEFINE_Int32(storage_page_cache_warmup_thread_num, "4");
+DEFINE_mInt32(storage_page_cache_warmup_pages_per_second, "2000");
 
 // Cache for mow primary key storage page size
 DEFINE_String(pk_storage_page_cache_limit, "10%");
@@ -420,8 +455,15 @@ DEFINE_mInt32(data_page_cache_stale_sweep_time_sec, "300");
 DEFINE_mInt32(index_page_cache_stale_sweep_time_sec, "600");
 DEFINE_mInt32(pk_index_page_cache_stale_sweep_time_sec, "600");
 
+DEFINE_String(cache_eviction_policies, "");
+
 DEFINE_Bool(enable_low_cardinality_optimize, "true");
 DEFINE_Bool(enable_low_cardinality_cache_code, "true");
+DEFINE_mDouble(lazy_read_range_min_selectivity, "0.8");
+DEFINE_mBool(enable_streaming_agg_adaptive_passthrough, "true");
+DEFINE_mDouble(streaming_agg_passthrough_min_reduction, "1.1");
+DEFINE_mInt64(streaming_agg_passthrough_blocks, "64");
+DEFINE_mBool(enable_fused_range_predicate, "true");
 
 // be policy
 // whether check compaction checksum
@@ -441,6 +483,7 @@ DEFINE_mInt64(vertical_compaction_max_segment_size, "1073741824");
 
 // If enabled, segments will be flushed column by column
 DEFINE_mBool(enable_vertical_segment_writer, "true");
+DEFINE_mInt32(vertical_segment_writer_column_parallelism, "1");
 
 // In ordered data compaction, min segment size for input rowset
 DEFINE_mInt32(ordered_data_compaction_min_segment_size, "10485760");
@@ -458,6 +501,13 @@ DEFINE_mDouble(base_compaction_min_data_ratio, "0.3");
 DEFINE_mInt64(base_compaction_dup_key_max_file_size_mbytes, "1024");
 
 DEFINE_Bool(enable_skip_tablet_compaction, "true");
+DEFINE_mInt64(base_compaction_read_mbytes_per_sec_per_disk, "-1");
+DEFINE_mInt64(base_compaction_write_mbytes_per_sec_per_disk, "-1");
+DEFINE_mInt64(cumu_compaction_read_mbytes_per_sec_per_disk, "-1");
+DEFINE_mInt64(cumu_compaction_write_mbytes_per_sec_per_disk, "-1");
+DEFINE_mInt64(compaction_io_throttle_query_read_latency_us, "0");
+DEFINE_mDouble(compaction_read_heat_weight, "0");
+DEFINE_mInt32(compaction_read_heat_half_life_sec, "3600");
 DEFINE_mInt32(skip_tablet_compaction_second, "10");
 
 // output rowset of cumulative compaction total disk size exceed this config size,
@@ -576,6 +626,7 @@ DEFINE_String(ssl_private_key_path, "");
 DEFINE_Bool(enable_all_http_auth, "false");
 // Number of webserver workers
 DEFINE_Int32(webserver_num_workers, "128");
+DEFINE_Bool(enable_webserver_reuseport, "false");
 
 DEFINE_Bool(enable_single_replica_load, "true");
 // Number of download workers for single replica load
@@ -603,6 +654,8 @@ DEFINE_Bool(enable_brpc_builtin_services, "true");
 // Enable brpc connection check
 DEFINE_Bool(enable_brpc_connection_check, "false");
 
+DEFINE_Bool(enable_brpc_rdma, "false");
+
 DEFINE_mInt64(brpc_connection_check_timeout_ms, "10000");
 
 // The maximum amount of data that can be processed by a stream load
@@ -660,6 +713,8 @@ DEFINE_String(pprof_profile_dir, "${DORIS_HOME}/log");
 DEFINE_mString(jeprofile_dir, "${DORIS_HOME}/log");
 DEFINE_mBool(enable_je_purge_dirty_pages, "true");
 DEFINE_mInt32(je_dirty_decay_ms, "5000");
+DEFINE_Bool(enable_workload_group_jemalloc_arena, "false");
+DEFINE_mInt32(workload_group_je_dirty_decay_ms, "5000");
 
 // to forward compatibility, will be removed later
 DEFINE_mBool(enable_token_check, "true");
@@ -686,6 +741,8 @@ DEFINE_mInt32(memory_gc_sleep_time_ms, "500");
 DEFINE_mInt64(write_buffer_size, "209715200");
 // max buffer size used in memtable for the aggregated table, default 400MB
 DEFINE_mInt64(write_buffer_size_for_agg, "419430400");
+DEFINE_mBool(enable_memtable_normalized_key_sort, "false");
+DEFINE_mInt64(memtable_sort_run_min_rows, "0");
 
 DEFINE_mInt64(min_write_buffer_size_for_partial_update, "1048576");
 // max parallel flush task per memtable writer
@@ -707,14 +764,19 @@ DEFINE_Int32(load_process_soft_mem_limit_percent, "80");
 // memtable memory limiter will do nothing.
 DEFINE_Int32(load_process_safe_mem_permit_percent, "5");
 
+DEFINE_mInt32(memtable_flush_forecast_horizon_ms, "0");
+
 // If there are a lot of memtable memory, then wait them flush finished.
 DEFINE_mDouble(load_max_wg_active_memtable_percent, "0.6");
 
+DEFINE_mInt32(mysql_result_serialize_parallelism, "1");
+
 // result buffer cancelled time (unit: second)
 DEFINE_mInt32(result_buffer_cancelled_interval_time, "300");
 
 // arrow flight result sink buffer rows size, default 4096 * 8
 DEFINE_mInt32(arrow_flight_result_sink_buffer_size_rows, "32768");
+DEFINE_mBool(enable_arrow_flight_result_streaming, "false");
 // The timeout for ADBC Client to wait for data using arrow flight reader.
 // If the query is very complex and no result is generated after this time, consider increasing this timeout.
 DEFINE_mInt32(arrow_flight_reader_brpc_controller_timeout_ms, "300000");
@@ -739,6 +801,7 @@ DEFINE_Bool(enable_metric_calculator, "true");
 
 // max consumer num in one data consumer group, for routine load
 DEFINE_mInt32(max_consumer_num_per_group, "3");
+DEFINE_mInt64(routine_load_zero_copy_min_message_bytes, "65536");
 
 // the max size of thread pool for routine load task.
 // this should be larger than FE config 'max_routine_load_task_num_per_be' (default 5)
@@ -808,6 +871,7 @@ DEFINE_Int64(brpc_socket_max_unwritten_bytes, "-1");
 // Controller Attachment and send it through http brpc when the length of the Tuple/Block data
 // is greater than 1.8G. This is to avoid the error of Request length overflow (2G).
 DEFINE_mBool(transfer_large_data_by_brpc, "true");
+DEFINE_mBool(exchange_column_wise_serialization, "false");
 
 // max number of txns for every txn_partition_map in txn manager
 // this is a self protection to avoid too many txns saving in manager
@@ -846,6 +910,7 @@ DEFINE_Int32(query_cache_max_partition_count, "1024");
 DEFINE_mInt32(max_tablet_version_num, "2000");
 
 DEFINE_mInt32(time_series_max_tablet_version_num, "20000");
+DEFINE_mInt64(time_series_compaction_sealed_tablet_seconds, "0");
 
 // Frontend mainly use two thrift sever type: THREAD_POOL, THREADED_SELECTOR. if fe use THREADED_SELECTOR model for thrift server,
 // the thrift_server_type_of_fe should be set THREADED_SELECTOR to make be thrift client to fe constructed with TFramedTransport
@@ -923,6 +988,8 @@ DEFINE_Int32(send_batch_thread_pool_queue_size, "102400");
 // When doing compaction, each segment may take at least 1MB buffer.
 DEFINE_mInt32(max_segment_num_per_rowset, "1000");
 DEFINE_mInt32(segment_compression_threshold_kb, "256");
+DEFINE_mInt32(incompressible_page_skip_count, "8");
+DEFINE_mBool(enable_segment_for_encoding_on_sort_key, "false");
 
 // Time to clean up useless JDBC connection pool cache
 DEFINE_mInt32(jdbc_connection_pool_cache_clear_time_sec, "28800");
@@ -1005,6 +1072,9 @@ DEFINE_mInt64(small_column_size_buffer, "100");
 
 // Perform the always_true check at intervals determined by runtime_filter_sampling_frequency
 DEFINE_mInt32(runtime_filter_sampling_frequency, "64");
+DEFINE_mInt32(runtime_filter_merge_partial_num, "1");
+DEFINE_mInt32(runtime_filter_max_useless_sampling_periods, "0");
+DEFINE_mInt32(runtime_filter_in_to_bloom_threshold, "0");
 DEFINE_mInt32(execution_max_rpc_timeout_sec, "3600");
 DEFINE_mBool(execution_ignore_eovercrowded, "true");
 // cooldown task configs
@@ -1076,6 +1146,8 @@ DEFINE_mInt32(segcompaction_wait_for_dbm_task_timeout_s, "3600"); // 1h
 
 // enable java udf and jdbc scannode
 DEFINE_Bool(enable_java_support, "true");
+DEFINE_mBool(enable_udf_result_memoization, "false");
+DEFINE_mInt32(udf_result_memo_capacity, "10000");
 
 // Set config randomly to check more issues in github workflow
 DEFINE_Bool(enable_fuzzy_mode, "false");
@@ -1083,6 +1155,8 @@ DEFINE_Bool(enable_fuzzy_mode, "false");
 DEFINE_Bool(enable_debug_points, "false");
 
 DEFINE_Int32(pipeline_executor_size, "0");
+DEFINE_Bool(enable_pipeline_task_numa_aware, "false");
+DEFINE_Bool(enable_lock_free_pipeline_task_queue, "false");
 DEFINE_Bool(enable_workload_group_for_scan, "false");
 DEFINE_mInt64(workload_group_scan_task_wait_timeout_ms, "10000");
 
@@ -1098,7 +1172,7 @@ DEFINE_Bool(enable_file_cache, "false");
 // format: [{"path":"/path/to/file_cache","total_size":21474836480,"query_limit":10737418240},{"path":"/path/to/file_cache2","total_size":21474836480,"query_limit":10737418240}]
 // format: {"path": "/path/to/file_cache", "total_size":53687091200, "ttl_percent":50, "normal_percent":40, "disposable_percent":5, "index_percent":5}
 // format: [{"path": "xxx", "total_size":53687091200, "storage": "memory"}]
-// Note1: storage is "disk" by default
+// Note1: storage is "disk" by default, "log" packs cached blocks into large segment files
 // Note2: when the storage is "memory", the path is ignored. So you can set xxx to anything you like
 // and doris will just reset the path to "memory" internally.
 // In a very wierd case when your storage is disk, and the directory, by accident, is named
@@ -1109,6 +1183,8 @@ DEFINE_Bool(enable_file_cache, "false");
 // Both will use the directory "memory" on the disk instead of the real RAM.
 DEFINE_String(file_cache_path, "[{\"path\":\"${DORIS_HOME}/file_cache\"}]");
 DEFINE_Int64(file_cache_each_block_size, "1048576"); // 1MB
+DEFINE_Int32(file_cache_shards_per_path, "1");
+DEFINE_Int32(file_cache_log_segment_size_mb, "256");
 
 DEFINE_Bool(clear_file_cache, "false");
 DEFINE_Bool(enable_file_cache_query_limit, "false");
@@ -1122,6 +1198,8 @@ DEFINE_mInt64(file_cache_evict_in_advance_batch_bytes, "31457280"); // 30MB
 DEFINE_mInt64(file_cache_evict_in_advance_recycle_keys_num_threshold, "1000");
 
 DEFINE_mBool(enable_read_cache_file_directly, "false");
+DEFINE_mInt64(file_cache_miss_coalesce_max_gap_bytes, "-1");
+DEFINE_mInt64(file_cache_cost_aware_evict_window, "0");
 DEFINE_mBool(file_cache_enable_evict_from_other_queue_by_size, "true");
 // If true, evict the ttl cache using LRU when full.
 // Otherwise, only expiration can evict ttl and new data won't add to cache when full.
@@ -1135,6 +1213,7 @@ DEFINE_mBool(enable_file_cache_keep_base_compaction_output, "false");
 DEFINE_mInt64(file_cache_remove_block_qps_limit, "1000");
 DEFINE_mInt64(file_cache_background_gc_interval_ms, "100");
 DEFINE_mBool(enable_reader_dryrun_when_download_file_cache, "true");
+DEFINE_mInt64(segment_page_prefetch_rows, "0");
 DEFINE_mInt64(file_cache_background_monitor_interval_ms, "5000");
 DEFINE_mInt64(file_cache_background_ttl_gc_interval_ms, "3000");
 DEFINE_mInt64(file_cache_background_ttl_gc_batch, "1000");
@@ -1181,9 +1260,16 @@ DEFINE_mBool(inverted_index_ram_dir_enable, "true");
 DEFINE_mBool(inverted_index_ram_dir_enable_when_base_compaction, "true");
 // use num_broadcast_buffer blocks as buffer to do broadcast
 DEFINE_Int32(num_broadcast_buffer, "32");
+DEFINE_mBool(enable_broadcast_join_early_finish, "false");
 
 // max depth of expression tree allowed.
 DEFINE_Int32(max_depth_of_expr_tree, "600");
+DEFINE_mBool(enable_fused_arithmetic_expr, "true");
+DEFINE_mBool(enable_common_expr_reuse, "true");
+DEFINE_mBool(enable_adaptive_conjunct_order, "true");
+DEFINE_mDouble(conjunct_compaction_ratio, "0.3");
+DEFINE_mBool(enable_low_cardinality_function_execution, "true");
+DEFINE_mInt32(low_cardinality_function_max_dict_size, "256");
 
 // Report a tablet as bad when io errors occurs more than this value.
 DEFINE_mInt64(max_tablet_io_errors, "-1");
@@ -1194,6 +1280,7 @@ DEFINE_mInt32(tablet_path_check_batch_size, "1000");
 
 // it must be larger than or equal to 5MB
 DEFINE_mInt64(s3_write_buffer_size, "5242880");
+DEFINE_mInt64(s3_write_part_size_double_interval, "1000");
 // Log interval when doing s3 upload task
 DEFINE_mInt32(s3_file_writer_log_interval_second, "60");
 DEFINE_mInt64(file_cache_max_file_reader_cache_size, "1000000");
@@ -1203,6 +1290,8 @@ DEFINE_mInt64(hdfs_write_batch_buffer_size_mb, "1"); // 1MB
 DEFINE_mBool(enable_shrink_memory, "false");
 DEFINE_mInt32(schema_cache_capacity, "1024");
 DEFINE_mInt32(schema_cache_sweep_time_sec, "100");
+DEFINE_Int32(regexp_cache_capacity, "1024");
+DEFINE_mInt32(regexp_cache_sweep_time_sec, "300");
 
 // max number of segment cache, default -1 for backward compatibility fd_number*2/5
 DEFINE_Int32(segment_cache_capacity, "-1");
@@ -1319,6 +1408,7 @@ DEFINE_Bool(enable_flush_file_cache_async, "true");
 
 // cgroup
 DEFINE_String(doris_cgroup_cpu_path, "");
+DEFINE_Bool(enable_workload_group_in_process_cpu_limit, "false");
 
 DEFINE_mBool(enable_be_proc_monitor, "false");
 DEFINE_mInt32(be_proc_monitor_interval_ms, "10000");
@@ -1338,6 +1428,7 @@ DEFINE_mInt64(ingest_binlog_elapsed_threshold_ms, "-1");
 DEFINE_Int32(download_binlog_rate_limit_kbs, "0");
 
 DEFINE_mInt32(buffered_reader_read_timeout_ms, "600000");
+DEFINE_mBool(enable_adaptive_prefetch, "true");
 
 DEFINE_Bool(enable_snapshot_action, "false");
 
@@ -1345,6 +1436,10 @@ DEFINE_mInt32(variant_max_merged_tablet_schema_size, "2048");
 
 DEFINE_mInt32(variant_max_sparse_column_statistics_size, "10000");
 
+DEFINE_mBool(enable_variant_shared_path_dictionary, "true");
+
+DEFINE_mBool(enable_variant_sparse_path_bloom_filter, "true");
+
 DEFINE_mBool(enable_column_type_check, "true");
 // 128 MB
 DEFINE_mInt64(local_exchange_buffer_mem_limit, "134217728");
@@ -1384,6 +1479,11 @@ DEFINE_Int32(spill_io_thread_pool_queue_size, "102400");
 // paused query in queue timeout(ms) will be resumed or canceled
 DEFINE_Int64(spill_in_paused_queue_timeout_ms, "60000");
 
+DEFINE_mInt64(spill_write_buffer_bytes, "1048576");
+DEFINE_mInt64(spill_read_ahead_bytes, "4194304");
+DEFINE_mBool(enable_spill_to_remote_storage, "false");
+DEFINE_mInt64(spill_remote_read_ahead_bytes, "16777216");
+
 DEFINE_mBool(check_segment_when_build_rowset_meta, "false");
 
 DEFINE_mBool(force_azure_blob_global_endpoint, "false");
@@ -1430,9 +1530,11 @@ DEFINE_mInt64(table_sink_partition_write_min_partition_data_processed_rebalance_
               "15728640"); // 15MB
 // Maximum processed partition nums of per writer when partition writing
 DEFINE_mInt32(table_sink_partition_write_max_partition_nums_per_writer, "128");
+DEFINE_mBool(enable_exchange_skew_detection, "false");
 
 /** Hive sink configurations **/
 DEFINE_mInt64(hive_sink_max_file_size, "1073741824"); // 1GB
+DEFINE_mBool(hive_sink_close_idle_partition_writers, "false");
 
 /** Iceberg sink configurations **/
 DEFINE_mInt64(iceberg_sink_max_file_size, "1073741824"); // 1GB
@@ -1459,6 +1561,12 @@ DEFINE_Int64(num_buffered_reader_prefetch_thread_pool_max_thread, "64");
 DEFINE_Int64(num_s3_file_upload_thread_pool_min_thread, "16");
 // The max thread num for S3FileUploadThreadPool
 DEFINE_Int64(num_s3_file_upload_thread_pool_max_thread, "64");
+// The min thread num for S3ParallelReadThreadPool
+DEFINE_Int64(num_s3_parallel_read_thread_pool_min_thread, "16");
+// The max thread num for S3ParallelReadThreadPool
+DEFINE_Int64(num_s3_parallel_read_thread_pool_max_thread, "64");
+DEFINE_mInt64(s3_parallel_read_chunk_size_mb, "8");
+DEFINE_mInt32(s3_parallel_read_max_concurrency, "4");
 // The maximum jvm heap usage ratio for hdfs write workload
 DEFINE_mDouble(max_hdfs_wirter_jni_heap_usage_ratio, "0.5");
 // The sleep milliseconds duration when hdfs write exceeds the maximum usage
@@ -1482,6 +1590,7 @@ DEFINE_Int64(s3_file_system_local_upload_buffer_size, "5242880");
 DEFINE_Bool(enable_jvm_monitor, "false");
 
 DEFINE_Int32(load_data_dirs_threads, "-1");
+DEFINE_Int32(load_tablet_meta_threads_per_data_dir, "4");
 
 // Skip loading stale rowset meta when initializing `TabletMeta` from protobuf
 DEFINE_mBool(skip_loading_stale_rowset_meta, "false");
@@ -1490,15 +1599,19 @@ DEFINE_Bool(enable_file_logger, "true");
 
 // The minimum row group size when exporting Parquet files. default 128MB
 DEFINE_Int64(min_row_group_size, "134217728");
+DEFINE_Int32(parquet_writer_encode_thread_num, "4");
 
 DEFINE_mInt64(compaction_memory_bytes_limit, "1073741824");
 
 DEFINE_mInt64(compaction_batch_size, "-1");
+DEFINE_mInt64(compaction_memory_wait_max_ms, "60000");
 
 // If set to false, the parquet reader will not use page index to filter data.
 // This is only for debug purpose, in case sometimes the page index
 // filter wrong data.
 DEFINE_mBool(enable_parquet_page_index, "true");
+DEFINE_mBool(enable_parquet_bloom_filter, "true");
+DEFINE_mBool(enable_native_avro_reader, "false");
 
 DEFINE_mBool(ignore_not_found_file_in_external_table, "true");
 
@@ -1519,6 +1632,12 @@ DEFINE_mInt32(lz4_compression_block_size, "262144");
 
 DEFINE_mBool(enable_pipeline_task_leakage_detect, "false");
 
+DEFINE_mBool(enable_pipeline_task_hardware_counters, "false");
+
+DEFINE_mBool(enable_fragment_capture, "false");
+DEFINE_String(fragment_capture_dir, "${DORIS_HOME}/log/fragment_capture");
+DEFINE_mInt64(fragment_capture_max_num, "10000");
+
 DEFINE_mInt32(check_score_rounds_num, "1000");
 
 DEFINE_Int32(query_cache_size, "512");
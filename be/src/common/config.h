@@ -172,6 +172,24 @@ DECLARE_Double(schema_change_mem_limit_frac);
 // memory greater than 16 GB.
 DECLARE_mInt64(mmap_threshold); // bytes
 
+// Map allocations of at least `huge_page_alloc_threshold_bytes`, such as large hash tables and
+// arena chunks, backed by huge pages to cut TLB misses. Values:
+//  - none: keep the current allocation path.
+//  - madvise: 2MB aligned anonymous mmap with MADV_HUGEPAGE, used by transparent huge pages.
+//  - hugetlb: MAP_HUGETLB from the reserved huge page pool, falls back to madvise.
+DECLARE_String(huge_page_alloc_mode);
+DECLARE_Int64(huge_page_alloc_threshold_bytes);
+
+// Cache the power of two buffers freed by columns in a per thread pool and hand them to the
+// next allocation of the same size, to cut malloc, free and page fault churn between batches.
+// Off by default, every thread may keep up to column_buffer_pool_thread_cache_bytes resident
+// until the pool is purged under memory pressure or disabled.
+DECLARE_mBool(enable_column_buffer_pool);
+// High water mark of the buffers cached by one thread.
+DECLARE_mInt64(column_buffer_pool_thread_cache_bytes);
+// High water mark of the buffers cached by all threads.
+DECLARE_mInt64(column_buffer_pool_max_cache_bytes);
+
 // When hash table capacity is greater than 2^double_grow_degree(default 2G), grow when 75% of the capacity is satisfied.
 // Increase can reduce the number of hash table resize, but may waste more memory.
 DECLARE_mInt32(hash_table_double_grow_degree);
@@ -181,6 +199,23 @@ DECLARE_mInt32(max_fill_rate);
 
 DECLARE_mInt32(double_resize_threshold);
 
+// If the bucket array of a join hash table is bigger than this size, the build and the probe
+// visit it partition by partition (radix partitioned by the high bits of the bucket number),
+// so that each partition stays in cache. 0 means disable the radix partition.
+DECLARE_mInt64(hash_join_radix_partition_bytes);
+
+// Prefetch the bucket heads and build rows ahead of the probe rows in hash join probe.
+DECLARE_mBool(enable_hash_join_probe_prefetch);
+
+// Use `key - min` as the bucket number of a single integer join key when the build keys are
+// dense enough, which skips hashing on both sides.
+DECLARE_mBool(enable_hash_join_direct_mapping);
+
+// Sort the build blocks of a nested loop join on the columns of its range predicates (like
+// `a.ts BETWEEN b.start AND b.end`), so a probe row is only joined with the build rows that
+// may satisfy them.
+DECLARE_mBool(enable_nested_loop_join_band_index);
+
 // The maximum low water mark of the system `/proc/meminfo/MemAvailable`, Unit byte, default -1.
 // if it is -1, then low water mark = min(MemTotal - MemLimit, MemTotal * 5%), which is 3.2G on a 64G machine.
 // Turn up max. more memory buffers will be reserved for Memory GC.
@@ -301,6 +336,18 @@ DECLARE_mInt32(download_low_speed_limit_kbps);
 DECLARE_mInt32(download_low_speed_time);
 // whether to download small files in batch.
 DECLARE_mBool(enable_batch_download);
+// max number of batches a single replica compaction downloads concurrently from its peer.
+DECLARE_mInt32(single_replica_compaction_download_parallelism);
+// max number of files or batches a single clone task downloads concurrently from its source.
+DECLARE_mInt32(clone_download_parallelism_per_task);
+// max number of clone downloads running concurrently into one data dir, over all clone tasks.
+DECLARE_mInt32(clone_download_parallelism_per_disk);
+// max number of clone downloads running concurrently from one source host, over all clone tasks.
+DECLARE_mInt32(clone_download_parallelism_per_host);
+// number of threads shared by all clone tasks to download snapshot files.
+DECLARE_Int32(clone_download_thread_num);
+// max seconds a clone download waits for a free slot of its data dir and source host.
+DECLARE_mInt32(clone_download_slot_wait_timeout_s);
 // whether to check md5sum when download
 DECLARE_mBool(enable_download_md5sum_check);
 // download binlog meta timeout
@@ -358,6 +405,10 @@ DECLARE_mInt32(doris_scanner_thread_pool_thread_num);
 DECLARE_mInt32(doris_scanner_min_thread_pool_thread_num);
 // number of batch size to fetch the remote split source
 DECLARE_mInt32(remote_split_source_batch_size);
+// Parquet and orc ranges larger than this are split by byte range when there are fewer ranges
+// than scanners, so that idle scanners can read the row groups of one large file in parallel.
+// 0 means never split.
+DECLARE_mInt64(file_scan_split_size_mb);
 // max number of remote scanner thread pool size
 // if equal to -1, value is std::max(512, CpuInfo::num_cores() * 10)
 DECLARE_Int32(doris_max_remote_scanner_thread_pool_thread_num);
@@ -378,12 +429,26 @@ DECLARE_mInt32(doris_scanner_row_num);
 DECLARE_mInt32(doris_scanner_row_bytes);
 // single read execute fragment max run time millseconds
 DECLARE_mInt32(doris_scanner_max_run_time_ms);
+// Adjust the number of running scanners of each scan operator from observed queue occupancy,
+// scanner run vs. wait time and block memory. Not applied when num_scanner_threads is set.
+DECLARE_mBool(enable_adaptive_scan_concurrency);
+// Min interval in milliseconds between two adjustments of the adaptive scan concurrency.
+DECLARE_mInt32(adaptive_scan_concurrency_adjust_interval_ms);
 // (Advanced) Maximum size of per-query receive-side buffer
 DECLARE_mInt32(exchg_node_buffer_size_bytes);
 DECLARE_mInt32(exchg_buffer_queue_capacity_factor);
+// Byte credits an exchange sink buffer holds for every destination instance. Queued and in
+// flight data spends credits and the receiver's reply grants them back, so a sender only
+// blocks while some destination has run out of credits. 0 means backpressure on queue depth
+// (exchg_buffer_queue_capacity_factor) instead.
+DECLARE_mInt64(exchange_sink_credit_bytes_per_instance);
 
 // memory_limitation_per_thread_for_schema_change_bytes unit bytes
 DECLARE_mInt64(memory_limitation_per_thread_for_schema_change_bytes);
+// Num threads shared by all direct schema changes to convert historical rowsets concurrently,
+// each thread may use up to memory_limitation_per_thread_for_schema_change_bytes. 1 converts the
+// rowsets of a tablet one after another.
+DECLARE_Int32(schema_change_convert_rowset_threads);
 
 // all cache prune interval, used by GC and periodic thread.
 DECLARE_mInt32(cache_prune_interval_sec);
@@ -391,6 +456,12 @@ DECLARE_mInt32(cache_periodic_prune_stale_sweep_sec);
 // the clean interval of tablet lookup cache
 DECLARE_mInt32(tablet_lookup_cache_stale_sweep_time_sec);
 DECLARE_mInt32(point_query_row_cache_stale_sweep_time_sec);
+// Point queries of the same tablet arriving within this window look up their primary keys in
+// one sorted pass. The first of them waits for the window. 0 means disable.
+DECLARE_mInt32(point_query_batch_window_us);
+// A point query that joined a batch looks up its keys alone if the batch has not started its
+// lookup within this time.
+DECLARE_mInt32(point_query_batch_wait_timeout_ms);
 DECLARE_mInt32(disk_stat_monitor_interval);
 DECLARE_mInt32(unused_rowset_monitor_interval);
 DECLARE_mInt32(quering_rowsets_evict_interval);
@@ -442,6 +513,25 @@ DECLARE_Bool(disable_storage_page_cache);
 DECLARE_mBool(disable_storage_row_cache);
 // whether to disable pk page cache feature in storage
 DECLARE_Bool(disable_pk_storage_page_cache);
+// A full-range scan without limit of more than this many bytes of rowset data is treated as
+// a streaming read, its pages are only probationally admitted into the storage page cache
+// so that they are evicted before the pages of other queries. 0 means disabled.
+DECLARE_mInt64(storage_page_cache_streaming_scan_bytes);
+// Whether the pages of streaming reads bypass the storage page cache instead of being
+// probationally admitted. Pages already in the cache are still used.
+DECLARE_mBool(storage_page_cache_bypass_streaming_read);
+// Whether concurrent scans missing the same page in storage page cache wait for a single read
+// and decompression of it instead of each loading it on their own.
+DECLARE_mBool(enable_storage_page_load_coalescing);
+// Interval to dump the hottest pages of storage page cache to storage_page_cache_snapshot_path,
+// the pages are read again after BE restarts to warm up the cache. 0 means disabled.
+DECLARE_Int32(storage_page_cache_snapshot_interval_sec);
+DECLARE_String(storage_page_cache_snapshot_path);
+// Max number of pages of each page type in the snapshot of storage page cache.
+DECLARE_mInt64(storage_page_cache_snapshot_max_pages);
+// Number of threads and max pages read per second to warm up storage page cache.
+DECLARE_Int32(storage_page_cache_warmup_thread_num);
+DECLARE_mInt32(storage_page_cache_warmup_pages_per_second);
 
 // Cache for mow primary key storage page size, it's seperated from
 // storage_page_cache_limit
@@ -455,8 +545,25 @@ DECLARE_mInt32(index_page_cache_stale_sweep_time_sec);
 // great impact on the performance of MOW, so it can be longer.
 DECLARE_mInt32(pk_index_page_cache_stale_sweep_time_sec);
 
+// Eviction policy of the lru caches, comma separated <cache type>:<policy> pairs, e.g.
+// "DataPageCache:S3_FIFO,SegmentCache:W_TINY_LFU". The policy is one of LRU, SLRU, S3_FIFO and
+// W_TINY_LFU, caches not listed use LRU. Only takes effect when a cache is created.
+DECLARE_String(cache_eviction_policies);
+
 DECLARE_Bool(enable_low_cardinality_optimize);
 DECLARE_Bool(enable_low_cardinality_cache_code);
+// When the rows left by predicates cover at least this fraction of their rowid range,
+// the non-predicate columns are read as one range and filtered instead of being read
+// row by row. A value greater than 1 always reads by rowids.
+DECLARE_mDouble(lazy_read_range_min_selectivity);
+// Whether streaming pre-aggregation passes blocks through once the sampled per-block
+// reduction stays under streaming_agg_passthrough_min_reduction, probing the hash table
+// again after streaming_agg_passthrough_blocks blocks.
+DECLARE_mBool(enable_streaming_agg_adaptive_passthrough);
+DECLARE_mDouble(streaming_agg_passthrough_min_reduction);
+DECLARE_mInt64(streaming_agg_passthrough_blocks);
+// Evaluate a lower and an upper bound predicate on the same numeric column in one pass.
+DECLARE_mBool(enable_fused_range_predicate);
 
 // be policy
 // whether check compaction checksum
@@ -476,6 +583,10 @@ DECLARE_mInt64(vertical_compaction_max_segment_size);
 
 // If enabled, segments will be flushed column by column
 DECLARE_mBool(enable_vertical_segment_writer);
+// Max number of value columns the vertical segment writer encodes concurrently, 1 disables it.
+// Key and sequence columns are always encoded on the flush thread. Inverted indexes of the
+// parallel columns are built and finished on the same workers.
+DECLARE_mInt32(vertical_segment_writer_column_parallelism);
 
 // In ordered data compaction, min segment size for input rowset
 DECLARE_mInt32(ordered_data_compaction_min_segment_size);
@@ -493,6 +604,21 @@ DECLARE_mDouble(base_compaction_min_data_ratio);
 DECLARE_mInt64(base_compaction_dup_key_max_file_size_mbytes);
 
 DECLARE_Bool(enable_skip_tablet_compaction);
+// Per data dir limits of local compaction disk throughput in MB/s, <= 0 means unlimited.
+// Full compaction counts as base, segment and cold data compaction count as cumulative.
+DECLARE_mInt64(base_compaction_read_mbytes_per_sec_per_disk);
+DECLARE_mInt64(base_compaction_write_mbytes_per_sec_per_disk);
+DECLARE_mInt64(cumu_compaction_read_mbytes_per_sec_per_disk);
+DECLARE_mInt64(cumu_compaction_write_mbytes_per_sec_per_disk);
+// When > 0, the limits above shrink in proportion while the average local query read latency
+// is above this value, down to a tenth of the configured limit.
+DECLARE_mInt64(compaction_io_throttle_query_read_latency_us);
+// When > 0, compaction candidates are ranked by
+// score * (1 + weight * log2(1 + recent query scans)), so tablets that are read get compacted
+// first. 0 ranks by compaction score only.
+DECLARE_mDouble(compaction_read_heat_weight);
+// Half-life of the query scan count used by `compaction_read_heat_weight`.
+DECLARE_mInt32(compaction_read_heat_half_life_sec);
 DECLARE_mInt32(skip_tablet_compaction_second);
 // output rowset of cumulative compaction total disk size exceed this config size,
 // this rowset will be given to base compaction, unit is m byte.
@@ -603,6 +729,9 @@ DECLARE_String(ssl_private_key_path);
 DECLARE_Bool(enable_all_http_auth);
 // Number of webserver workers
 DECLARE_Int32(webserver_num_workers);
+// Give every webserver worker its own listening socket bound with SO_REUSEPORT, so the kernel
+// spreads new connections over the workers instead of all of them accepting on one socket
+DECLARE_Bool(enable_webserver_reuseport);
 
 DECLARE_Bool(enable_single_replica_load);
 // Number of download workers for single replica load
@@ -685,6 +814,11 @@ DECLARE_mString(jeprofile_dir);
 DECLARE_mBool(enable_je_purge_dirty_pages);
 // Jemalloc `arenas.dirty_decay_ms`, equal to `dirty_decay_ms` in JEMALLOC_CONF in be.conf.
 DECLARE_mInt32(je_dirty_decay_ms);
+// Give every workload group its own jemalloc arena, query and load threads attached to a group
+// allocate from it, so that the fragmentation and purge cost of one group stays in that group.
+DECLARE_Bool(enable_workload_group_jemalloc_arena);
+// Jemalloc `dirty_decay_ms` of the workload group arenas.
+DECLARE_mInt32(workload_group_je_dirty_decay_ms);
 
 // to forward compatibility, will be removed later
 DECLARE_mBool(enable_token_check);
@@ -711,6 +845,12 @@ DECLARE_mInt32(memory_gc_sleep_time_ms);
 DECLARE_mInt64(write_buffer_size);
 // max buffer size used in memtable for the aggregated table, default 400MB
 DECLARE_mInt64(write_buffer_size_for_agg);
+// Sort memtable rows by memcmp-able normalized keys with a radix sort when all key
+// columns are fixed width integer like types.
+DECLARE_mBool(enable_memtable_normalized_key_sort);
+// Sort the rows inserted into a memtable as a run when at least this many are pending, and
+// merge the runs at flush, so that sorting overlaps with ingestion. 0 sorts only at flush.
+DECLARE_mInt64(memtable_sort_run_min_rows);
 
 DECLARE_mInt64(min_write_buffer_size_for_partial_update);
 // max parallel flush task per memtable writer
@@ -732,14 +872,25 @@ DECLARE_Int32(load_process_soft_mem_limit_percent);
 // memtable memory limiter will do nothing.
 DECLARE_Int32(load_process_safe_mem_permit_percent);
 
+// If the load memory, growing at the recent ingest rate, would reach the soft limit within
+// this many milliseconds, flush the largest memtables ahead of time. 0 means disabled.
+DECLARE_mInt32(memtable_flush_forecast_horizon_ms);
+
 // If there are a lot of memtable memory, then wait them flush finished.
 DECLARE_mDouble(load_max_wg_active_memtable_percent);
 
+// Max number of threads converting one result block to MySQL rows. Blocks are split into row
+// ranges of at least 1024 rows, 1 disables the parallel conversion.
+DECLARE_mInt32(mysql_result_serialize_parallelism);
+
 // result buffer cancelled time (unit: second)
 DECLARE_mInt32(result_buffer_cancelled_interval_time);
 
 // arrow flight result sink buffer rows size, default 4096 * 8
 DECLARE_mInt32(arrow_flight_result_sink_buffer_size_rows);
+// If true, arrow flight results are queued block by block as the result sink produces them,
+// without copying them into the result buffer or merging them into bigger batches.
+DECLARE_mBool(enable_arrow_flight_result_streaming);
 // The timeout for ADBC Client to wait for data using arrow flight reader.
 // If the query is very complex and no result is generated after this time, consider increasing this timeout.
 DECLARE_mInt32(arrow_flight_reader_brpc_controller_timeout_ms);
@@ -765,6 +916,10 @@ DECLARE_Bool(enable_metric_calculator);
 // max consumer num in one data consumer group, for routine load
 DECLARE_mInt32(max_consumer_num_per_group);
 
+// Kafka messages of at least this many bytes are queued to the load pipe by reference instead of
+// being copied, 0 disables it. Smaller messages are still packed into pipe chunks.
+DECLARE_mInt64(routine_load_zero_copy_min_message_bytes);
+
 // the max size of thread pool for routine load task.
 // this should be larger than FE config 'max_routine_load_task_num_per_be' (default 5)
 DECLARE_Int32(max_routine_load_thread_pool_size);
@@ -833,6 +988,10 @@ DECLARE_Int64(brpc_socket_max_unwritten_bytes);
 // Controller Attachment and send it through http brpc when the length of the Tuple/Block data
 // is greater than 1.8G. This is to avoid the error of Request length overflow (2G).
 DECLARE_mBool(transfer_large_data_by_brpc);
+// Serialize exchange blocks column by column: each column picks its own codec and low
+// cardinality string columns are sent dictionary encoded. Only enable it after every BE in
+// the cluster has been upgraded, older receivers cannot decode this layout.
+DECLARE_mBool(exchange_column_wise_serialization);
 
 // max number of txns for every txn_partition_map in txn manager
 // this is a self protection to avoid too many txns saving in manager
@@ -871,6 +1030,9 @@ DECLARE_Int32(query_cache_max_partition_count);
 DECLARE_mInt32(max_tablet_version_num);
 
 DECLARE_mInt32(time_series_max_tablet_version_num);
+// A time series tablet that has not been loaded for this many seconds is treated as sealed, and
+// base compaction merges its compacted rowsets into one. <= 0 disables it.
+DECLARE_mInt64(time_series_compaction_sealed_tablet_seconds);
 
 // Frontend mainly use two thrift sever type: THREAD_POOL, THREADED_SELECTOR. if fe use THREADED_SELECTOR model for thrift server,
 // the thrift_server_type_of_fe should be set THREADED_SELECTOR to make be thrift client to fe constructed with TFramedTransport
@@ -947,6 +1109,16 @@ DECLARE_mInt32(max_segment_num_per_rowset);
 // Store segment without compression if a segment is smaller than
 // segment_compression_threshold_kb.
 DECLARE_mInt32(segment_compression_threshold_kb);
+// Once a data page of a column saves less than its min space saving when compressed, write the
+// next pages of that column uncompressed without trying, and sample compression again after
+// this many pages. 0 means every data page is compressed.
+DECLARE_mInt32(incompressible_page_skip_count);
+
+// Encode the leading sort key column of a segment with delta + frame-of-reference
+// encoding instead of bitshuffle when it is an integer or datev2/datetimev2 column.
+// Off by default: BEs that cannot decode FOR_ENCODING data pages fail to read such
+// segments, so only enable it once no BE of the cluster will be downgraded.
+DECLARE_mBool(enable_segment_for_encoding_on_sort_key);
 
 // Time to clean up useless JDBC connection pool cache
 DECLARE_mInt32(jdbc_connection_pool_cache_clear_time_sec);
@@ -1030,6 +1202,17 @@ DECLARE_mInt64(big_column_size_buffer);
 DECLARE_mInt64(small_column_size_buffer);
 
 DECLARE_mInt32(runtime_filter_sampling_frequency);
+// The number of partial mergers of a global runtime filter on the merge node. Filters from
+// different producers are merged into the partial mergers concurrently and the partial results
+// are merged into the final filter, which shortens the serial merge on the merge node when
+// there are many producers. 1 means merge all producers into the final filter directly.
+DECLARE_mInt32(runtime_filter_merge_partial_num);
+// A runtime filter whose sampling periods judge it as always_true this many times in a row is
+// disabled for the rest of the query instead of being sampled again. 0 means never disable.
+DECLARE_mInt32(runtime_filter_max_useless_sampling_periods);
+// The consumer of an in_or_bloom runtime filter pushes down a bloom filter instead of the in
+// filter when the in set has at least this many values. 0 means always use the in filter.
+DECLARE_mInt32(runtime_filter_in_to_bloom_threshold);
 DECLARE_mInt32(execution_max_rpc_timeout_sec);
 DECLARE_mBool(execution_ignore_eovercrowded);
 
@@ -1064,6 +1247,10 @@ DECLARE_Bool(enable_brpc_builtin_services);
 
 DECLARE_Bool(enable_brpc_connection_check);
 
+// Send exchange data to remote BEs over RDMA, the brpc server accepts RDMA connections
+// as well. Requires brpc built with RDMA support and must be enabled on all BEs.
+DECLARE_Bool(enable_brpc_rdma);
+
 DECLARE_mInt64(brpc_connection_check_timeout_ms);
 
 // Max waiting time to wait the "plan fragment start" rpc.
@@ -1107,6 +1294,10 @@ DECLARE_mInt32(segcompaction_num_threads);
 
 // enable java udf and jdbc scannode
 DECLARE_Bool(enable_java_support);
+// cache java udf and rpc function results by argument tuple, only for deterministic functions
+DECLARE_mBool(enable_udf_result_memoization);
+// max number of argument tuples cached per function context
+DECLARE_mInt32(udf_result_memo_capacity);
 
 // Set config randomly to check more issues in github workflow
 DECLARE_Bool(enable_fuzzy_mode);
@@ -1114,6 +1305,12 @@ DECLARE_Bool(enable_fuzzy_mode);
 DECLARE_Bool(enable_debug_points);
 
 DECLARE_Int32(pipeline_executor_size);
+// Group pipeline worker threads by NUMA node: bind each worker to the cpus of its node,
+// place the tasks of one query on one node and steal tasks from the local node first.
+DECLARE_Bool(enable_pipeline_task_numa_aware);
+// Use lock free sub queues in the pipeline task queue of each core instead of a mutex
+// protected multilevel feedback queue.
+DECLARE_Bool(enable_lock_free_pipeline_task_queue);
 
 // block file cache
 DECLARE_Bool(enable_file_cache);
@@ -1132,6 +1329,12 @@ DECLARE_Bool(enable_file_cache);
 // Both will use the directory "memory" on the disk instead of the real RAM.
 DECLARE_String(file_cache_path);
 DECLARE_Int64(file_cache_each_block_size);
+// Split every disk cache path into this many independent sub caches ("shard_<i>" sub dirs),
+// each with its own lock and queues, to reduce cache lock contention. Data cached under a
+// different shard count is removed on startup.
+DECLARE_Int32(file_cache_shards_per_path);
+// size of the segment files of the "log" file cache storage
+DECLARE_Int32(file_cache_log_segment_size_mb);
 DECLARE_Bool(clear_file_cache);
 DECLARE_Bool(enable_file_cache_query_limit);
 DECLARE_Int32(file_cache_enter_disk_resource_limit_mode_percent);
@@ -1143,6 +1346,12 @@ DECLARE_mInt32(file_cache_evict_in_advance_interval_ms);
 DECLARE_mInt64(file_cache_evict_in_advance_batch_bytes);
 DECLARE_mInt64(file_cache_evict_in_advance_recycle_keys_num_threshold);
 DECLARE_mBool(enable_read_cache_file_directly);
+// Cache misses of one read separated by at most this many bytes of already cached data are
+// fetched with a single remote read, -1 means always merge them.
+DECLARE_mInt64(file_cache_miss_coalesce_max_gap_bytes);
+// When > 0, eviction looks at this many least recently used blocks of a queue and evicts the
+// ones with the lowest (hits + 1) * fetch cost / size first, 0 means plain LRU.
+DECLARE_mInt64(file_cache_cost_aware_evict_window);
 DECLARE_Bool(file_cache_enable_evict_from_other_queue_by_size);
 // If true, evict the ttl cache using LRU when full.
 // Otherwise, only expiration can evict ttl and new data won't add to cache when full.
@@ -1162,6 +1371,9 @@ DECLARE_mBool(enable_file_cache_keep_base_compaction_output);
 DECLARE_mInt64(file_cache_remove_block_qps_limit);
 DECLARE_mInt64(file_cache_background_gc_interval_ms);
 DECLARE_mBool(enable_reader_dryrun_when_download_file_cache);
+// Number of rows ahead of a segment scan whose data pages are fetched into the file cache
+// in background, for segments read through the file cache. 0 disables the prefetching.
+DECLARE_mInt64(segment_page_prefetch_rows);
 DECLARE_mInt64(file_cache_background_monitor_interval_ms);
 DECLARE_mInt64(file_cache_background_ttl_gc_interval_ms);
 DECLARE_mInt64(file_cache_background_ttl_gc_batch);
@@ -1209,9 +1421,25 @@ DECLARE_mBool(inverted_index_ram_dir_enable);
 DECLARE_mBool(inverted_index_ram_dir_enable_when_base_compaction);
 // use num_broadcast_buffer blocks as buffer to do broadcast
 DECLARE_Int32(num_broadcast_buffer);
+// Whether a broadcast join build instance that shares the hash table of another instance finishes
+// as soon as the table is ready, instead of receiving the rest of its copy of the build side.
+// Off by default: finishing early closes the instance's exchange receiver while the senders still
+// send the broadcast data, and that has not been run on production workloads yet.
+DECLARE_mBool(enable_broadcast_join_early_finish);
 
 // max depth of expression tree allowed.
 DECLARE_Int32(max_depth_of_expr_tree);
+// Evaluate nested integer/double add, subtract and multiply sub-trees in one fused loop.
+DECLARE_mBool(enable_fused_arithmetic_expr);
+// Evaluate sub-expressions repeated across an operator's conjuncts or projections once per block.
+DECLARE_mBool(enable_common_expr_reuse);
+// Order conjuncts by their measured cost per filtered row.
+DECLARE_mBool(enable_adaptive_conjunct_order);
+// Run the remaining conjuncts on a compacted block once at most this ratio of rows is left.
+DECLARE_mDouble(conjunct_compaction_ratio);
+// Run opted-in string functions once per distinct value when a block has at most this many.
+DECLARE_mBool(enable_low_cardinality_function_execution);
+DECLARE_mInt32(low_cardinality_function_max_dict_size);
 
 // Report a tablet as bad when io errors occurs more than this value.
 DECLARE_mInt64(max_tablet_io_errors);
@@ -1222,6 +1450,10 @@ DECLARE_mInt32(tablet_path_check_batch_size);
 
 // it must be larger than or equal to 5MB
 DECLARE_mInt64(s3_write_buffer_size);
+// Double the multipart upload part size every this many parts so that large files stay within
+// the 10000 parts limit of S3, parts grow to at most 256MB since every part is buffered in memory.
+// 0 means all parts are s3_write_buffer_size
+DECLARE_mInt64(s3_write_part_size_double_interval);
 // Log interval when doing s3 upload task
 DECLARE_mInt32(s3_file_writer_log_interval_second);
 // the max number of cached file handle for block segemnt
@@ -1232,6 +1464,9 @@ DECLARE_mBool(enable_shrink_memory);
 // enable cache for high concurrent point query work load
 DECLARE_mInt32(schema_cache_capacity);
 DECLARE_mInt32(schema_cache_sweep_time_sec);
+// max number of compiled regular expressions shared by regexp functions, 0 to disable
+DECLARE_Int32(regexp_cache_capacity);
+DECLARE_mInt32(regexp_cache_sweep_time_sec);
 
 // max number of segment cache
 DECLARE_Int32(segment_cache_capacity);
@@ -1381,6 +1616,9 @@ DECLARE_mBool(exit_on_exception);
 
 // cgroup
 DECLARE_String(doris_cgroup_cpu_path);
+// Without doris_cgroup_cpu_path, enforce workload group cpu share and cpu hard limit in the
+// pipeline task scheduler instead.
+DECLARE_Bool(enable_workload_group_in_process_cpu_limit);
 DECLARE_mBool(enable_be_proc_monitor);
 DECLARE_mInt32(be_proc_monitor_interval_ms);
 DECLARE_Int32(workload_group_metrics_interval_ms);
@@ -1401,6 +1639,9 @@ DECLARE_mInt64(ingest_binlog_elapsed_threshold_ms);
 DECLARE_Int32(download_binlog_rate_limit_kbs);
 
 DECLARE_mInt32(buffered_reader_read_timeout_ms);
+// PrefetchBufferedReader stops prefetching while most recent reads jump around the file and
+// resumes once they are sequential again.
+DECLARE_mBool(enable_adaptive_prefetch);
 
 // whether to enable /api/snapshot api
 DECLARE_Bool(enable_snapshot_action);
@@ -1411,6 +1652,14 @@ DECLARE_mInt32(variant_max_merged_tablet_schema_size);
 // The max sparse column statistics size for a variant column
 DECLARE_mInt32(variant_max_sparse_column_statistics_size);
 
+// Whether later segments of a rowset prefer the variant subcolumn paths materialized by the
+// earlier segments, so all segments share one subcolumn layout.
+DECLARE_mBool(enable_variant_shared_path_dictionary);
+
+// Whether to build a per page bloom filter index on the paths of the variant sparse column, so
+// reading one path can skip the pages that don't hold it.
+DECLARE_mBool(enable_variant_sparse_path_bloom_filter);
+
 DECLARE_mInt64(local_exchange_buffer_mem_limit);
 
 DECLARE_mInt64(enable_debug_log_timeout_secs);
@@ -1443,6 +1692,14 @@ DECLARE_mInt32(spill_gc_work_time_ms);
 DECLARE_Int32(spill_io_thread_pool_thread_num);
 DECLARE_Int32(spill_io_thread_pool_queue_size);
 DECLARE_Int64(spill_in_paused_queue_timeout_ms);
+// Small spilled blocks are buffered up to this size and written to disk in one append.
+DECLARE_mInt64(spill_write_buffer_bytes);
+// Spill readers fetch the following blocks of a file in one read, up to this size.
+DECLARE_mInt64(spill_read_ahead_bytes);
+// In cloud mode, spill to the storage vault once all local spill disks are full.
+DECLARE_mBool(enable_spill_to_remote_storage);
+// Read ahead size of spill files on remote storage, larger to amortize request latency.
+DECLARE_mInt64(spill_remote_read_ahead_bytes);
 
 DECLARE_mBool(check_segment_when_build_rowset_meta);
 
@@ -1485,11 +1742,19 @@ DECLARE_mInt64(table_sink_non_partition_write_scaling_data_processed_threshold);
 DECLARE_mInt64(table_sink_partition_write_min_data_processed_rebalance_threshold);
 // Minimum partition data processed to rebalance writers in exchange when partition writing
 DECLARE_mInt64(table_sink_partition_write_min_partition_data_processed_rebalance_threshold);
+// Track the hottest partition keys of hash shuffle exchanges with a sketch and report the keys
+// that alone send more than a fair share of rows to one instance in the profile.
+DECLARE_mBool(enable_exchange_skew_detection);
 // Maximum processed partition nums of per writer when partition writing
 DECLARE_mInt32(table_sink_partition_write_max_partition_nums_per_writer);
 
 /** Hive sink configurations **/
 DECLARE_mInt64(hive_sink_max_file_size);
+// When a hive writer already has table_sink_partition_write_max_partition_nums_per_writer open
+// partitions, close the least recently written one instead of failing the insert. Off by default:
+// a partition that shows up again after its writer was closed gets one more file, so an insert
+// whose rows are not sorted by partition can leave many small files instead of failing.
+DECLARE_mBool(hive_sink_close_idle_partition_writers);
 
 /** Iceberg sink configurations **/
 DECLARE_mInt64(iceberg_sink_max_file_size);
@@ -1514,6 +1779,14 @@ DECLARE_Int64(num_buffered_reader_prefetch_thread_pool_max_thread);
 DECLARE_Int64(num_s3_file_upload_thread_pool_min_thread);
 // The max thread num for S3FileUploadThreadPool
 DECLARE_Int64(num_s3_file_upload_thread_pool_max_thread);
+// The min thread num for S3ParallelReadThreadPool
+DECLARE_Int64(num_s3_parallel_read_thread_pool_min_thread);
+// The max thread num for S3ParallelReadThreadPool
+DECLARE_Int64(num_s3_parallel_read_thread_pool_max_thread);
+// S3FileReader splits reads of at least twice this size into concurrent ranged GETs, 0 disables it
+DECLARE_mInt64(s3_parallel_read_chunk_size_mb);
+// The max number of concurrent ranged GETs of one read
+DECLARE_mInt32(s3_parallel_read_max_concurrency);
 // The maximum jvm heap usage ratio for hdfs write workload
 DECLARE_mDouble(max_hdfs_wirter_jni_heap_usage_ratio);
 // The sleep milliseconds duration when hdfs write exceeds the maximum usage
@@ -1539,6 +1812,8 @@ DECLARE_Bool(enable_jvm_monitor);
 
 // Num threads to load data dirs, default value -1 indicates the same number of threads as the number of data dirs
 DECLARE_Int32(load_data_dirs_threads);
+// Num threads of each data dir to parse tablet and rowset metas loaded from rocksdb at startup
+DECLARE_Int32(load_tablet_meta_threads_per_data_dir);
 
 // Skip loading stale rowset meta when initializing `TabletMeta` from protobuf
 DECLARE_mBool(skip_loading_stale_rowset_meta);
@@ -1550,12 +1825,23 @@ DECLARE_Bool(enable_file_logger);
 
 // The minimum row group size when exporting Parquet files.
 DECLARE_Int64(min_row_group_size);
+// Number of threads shared by all parquet writers to encode and compress the column chunks of a
+// row group in parallel, 0 means encoding on the sink thread.
+DECLARE_Int32(parquet_writer_encode_thread_num);
 
 DECLARE_mInt64(compaction_memory_bytes_limit);
 
 DECLARE_mInt64(compaction_batch_size);
+// Max total time in ms a compaction pauses between blocks while the process is above its soft
+// memory limit, before it goes on and risks being cancelled. 0 disables pausing.
+DECLARE_mInt64(compaction_memory_wait_max_ms);
 
 DECLARE_mBool(enable_parquet_page_index);
+// Whether to prune parquet row groups by the column bloom filters for equal and IN predicates
+DECLARE_mBool(enable_parquet_bloom_filter);
+// Read avro data files with the native reader, files or columns it does not support still go
+// through the jni scanner. Off by default, the jni scanner stays the default avro reader.
+DECLARE_mBool(enable_native_avro_reader);
 
 // Wheather to ignore not found file in external teble(eg, hive)
 // Default is true, if set to false, the not found file will result in query failure.
@@ -1576,6 +1862,20 @@ DECLARE_mInt32(lz4_compression_block_size);
 
 DECLARE_mBool(enable_pipeline_task_leakage_detect);
 
+// Whether to sample per thread hardware counters (cycles, instructions, cache misses and branch
+// misses) around each pipeline task execution and report them in the task profile. Requires
+// perf events to be accessible (see /proc/sys/kernel/perf_event_paranoid), only takes effect for
+// the tasks created after it is changed.
+DECLARE_mBool(enable_pipeline_task_hardware_counters);
+
+// Whether to save the params of every pipeline fragment executed on this BE, together with its
+// execution time, into `fragment_capture_dir`. The captured workload can be inspected and
+// compared across versions with `fragment_capture_tool`.
+DECLARE_mBool(enable_fragment_capture);
+DECLARE_String(fragment_capture_dir);
+// Stop capturing after this many fragments were saved since BE started.
+DECLARE_mInt64(fragment_capture_max_num);
+
 DECLARE_mInt32(check_score_rounds_num);
 
 // MB
@@ -37,12 +37,15 @@
 #include <map>
 #include <ostream>
 #include <string>
+#include <vector>
 
 #include "cloud/config.h"
 #include "common/config.h"
 #include "common/logging.h"
 #include "common/status.h"
 #include "olap/memtable_memory_limiter.h"
+#include "olap/page_cache.h"
+#include "olap/page_cache_snapshot.h"
 #include "olap/storage_engine.h"
 #include "olap/tablet_manager.h"
 #include "runtime/be_proc_monitor.h"
@@ -61,6 +64,7 @@
 #include "util/perf_counters.h"
 #include "util/system_metrics.h"
 #include "util/time.h"
+#include "vec/common/column_buffer_pool.h"
 
 namespace doris {
 namespace {
@@ -209,6 +213,13 @@ void refresh_process_memory_metrics() {
     doris::GlobalMemoryArbitrator::reset_refresh_interval_memory_growth();
     ExecEnv::GetInstance()->brpc_iobuf_block_memory_tracker()->set_consumption(
             butil::IOBuf::block_memory());
+    ColumnBufferPool::set_memory_pressure(GlobalMemoryArbitrator::process_memory_usage() >=
+                                          MemInfo::soft_mem_limit());
+    if (!config::enable_column_buffer_pool && ColumnBufferPool::total_cached_bytes() > 0) {
+        ColumnBufferPool::purge_all();
+    }
+    ExecEnv::GetInstance()->column_buffer_pool_mem_tracker()->set_consumption(
+            ColumnBufferPool::total_cached_bytes());
 }
 
 void refresh_common_allocator_metrics() {
@@ -581,6 +592,40 @@ void Daemon::calculate_workload_group_metrics_thread() {
     }
 }
 
+void Daemon::page_cache_snapshot_thread() {
+    auto* cache = StoragePageCache::instance();
+    if (cache == nullptr) {
+        return;
+    }
+    const std::string& path = config::storage_page_cache_snapshot_path;
+    {
+        std::vector<PageCacheSnapshotEntry> entries;
+        Status st = PageCacheSnapshot::load(path, &entries);
+        if (st.ok()) {
+            LOG(INFO) << "warm up storage page cache with " << entries.size()
+                      << " pages from " << path;
+            PageCacheSnapshot::warm_up(entries, &_stop_background_threads_latch);
+        } else if (!st.is<ErrorCode::NOT_FOUND>()) {
+            LOG(WARNING) << "failed to load page cache snapshot: " << st;
+        }
+    }
+
+    auto dump = [cache, &path]() {
+        std::vector<PageCacheSnapshotEntry> entries;
+        PageCacheSnapshot::collect(cache, config::storage_page_cache_snapshot_max_pages, &entries);
+        Status st = PageCacheSnapshot::save(path, entries);
+        if (!st.ok()) {
+            LOG(WARNING) << "failed to save page cache snapshot: " << st;
+        }
+    };
+    while (!_stop_background_threads_latch.wait_for(
+            std::chrono::seconds(config::storage_page_cache_snapshot_interval_sec))) {
+        dump();
+    }
+    // dump before BE stops so that the restarted BE is warmed up with the newest pages
+    dump();
+}
+
 void Daemon::start() {
     Status st;
     st = Thread::create(
@@ -631,6 +676,14 @@ void Daemon::start() {
             [this]() { this->calculate_workload_group_metrics_thread(); },
             &_threads.emplace_back());
     CHECK(st.ok()) << st;
+
+    if (config::storage_page_cache_snapshot_interval_sec > 0 &&
+        !config::disable_storage_page_cache && !config::is_cloud_mode()) {
+        st = Thread::create(
+                "Daemon", "page_cache_snapshot_thread",
+                [this]() { this->page_cache_snapshot_thread(); }, &_threads.emplace_back());
+        CHECK(st.ok()) << st;
+    }
 }
 
 void Daemon::stop() {
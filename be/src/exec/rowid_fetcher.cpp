@@ -30,9 +30,11 @@
 
 #include <algorithm>
 #include <cstdint>
+#include <map>
 #include <memory>
 #include <ostream>
 #include <string>
+#include <type_traits>
 #include <unordered_map>
 #include <utility>
 #include <vector>
@@ -621,7 +623,6 @@ Status RowIdStorageReader::read_batch_doris_format_row(
     for (const ColumnPB& column_pb : request_block_desc.column_descs()) {
         full_read_schema.append_column(TabletColumn(column_pb));
     }
-    std::unordered_map<IteratorKey, IteratorItem, HashOfIteratorKey> iterator_map;
     std::string row_store_buffer;
     RowStoreReadStruct row_store_read_struct(row_store_buffer);
     if (request_block_desc.fetch_row_store()) {
@@ -632,20 +633,52 @@ Status RowIdStorageReader::read_batch_doris_format_row(
         }
     }
 
-    for (int j = 0; j < request_block_desc.row_id_size(); ++j) {
-        auto file_id = request_block_desc.file_id(j);
+    // Group the rows by segment, so every segment is acquired once and each of its columns is
+    // read by one read_by_rowids in row id order, which reads a page shared by rows only once.
+    const int num_rows = request_block_desc.row_id_size();
+    std::map<std::decay_t<decltype(request_block_desc.file_id(0))>, std::vector<int>> file_rows;
+    for (int j = 0; j < num_rows; ++j) {
+        file_rows[request_block_desc.file_id(j)].push_back(j);
+    }
+    // the rows of all segments, and the position of each requested row in it
+    vectorized::Block fetched_block(slots, num_rows);
+    std::vector<uint32_t> positions(num_rows);
+    uint32_t fetched_rows = 0;
+    std::vector<segment_v2::rowid_t> row_ids;
+    for (auto& [file_id, rows] : file_rows) {
         auto file_mapping = id_file_map->get_file_mapping(file_id);
         if (!file_mapping) {
             return Status::InternalError(
                     "Backend:{} file_mapping not found, query_id: {}, file_id: {}",
                     BackendOptions::get_localhost(), print_id(query_id), file_id);
         }
+        std::stable_sort(rows.begin(), rows.end(), [&](int lhs, int rhs) {
+            return request_block_desc.row_id(lhs) < request_block_desc.row_id(rhs);
+        });
+        // the same row may be requested more than once
+        row_ids.clear();
+        for (int j : rows) {
+            auto row_id = cast_set<segment_v2::rowid_t>(request_block_desc.row_id(j));
+            if (row_ids.empty() || row_ids.back() != row_id) {
+                row_ids.push_back(row_id);
+            }
+            positions[j] = fetched_rows + cast_set<uint32_t>(row_ids.size()) - 1;
+        }
+        RETURN_IF_ERROR(read_doris_format_rows(id_file_map, file_mapping, row_ids, slots,
+                                               full_read_schema, row_store_read_struct, stats,
+                                               acquire_tablet_ms, acquire_rowsets_ms,
+                                               acquire_segments_ms, lookup_row_data_ms,
+                                               fetched_block));
+        fetched_rows += cast_set<uint32_t>(row_ids.size());
+    }
 
-        RETURN_IF_ERROR(read_doris_format_row(
-                id_file_map, file_mapping, request_block_desc.row_id(j), slots, full_read_schema,
-                row_store_read_struct, stats, acquire_tablet_ms, acquire_rowsets_ms,
-                acquire_segments_ms, lookup_row_data_ms, iterator_map, result_block));
+    // restore the request order
+    auto columns = result_block.mutate_columns();
+    for (size_t i = 0; i < columns.size(); ++i) {
+        columns[i]->insert_indices_from(*fetched_block.get_by_position(i).column,
+                                        positions.data(), positions.data() + positions.size());
     }
+    result_block.set_columns(std::move(columns));
     return Status::OK();
 }
 
@@ -964,14 +997,13 @@ Status RowIdStorageReader::read_batch_external_row(
     return Status::OK();
 }
 
-Status RowIdStorageReader::read_doris_format_row(
+Status RowIdStorageReader::read_doris_format_rows(
         const std::shared_ptr<IdFileMap>& id_file_map,
-        const std::shared_ptr<FileMapping>& file_mapping, int64_t row_id,
-        std::vector<SlotDescriptor>& slots, const TabletSchema& full_read_schema,
-        RowStoreReadStruct& row_store_read_struct, OlapReaderStatistics& stats,
-        int64_t* acquire_tablet_ms, int64_t* acquire_rowsets_ms, int64_t* acquire_segments_ms,
-        int64_t* lookup_row_data_ms,
-        std::unordered_map<IteratorKey, IteratorItem, HashOfIteratorKey>& iterator_map,
+        const std::shared_ptr<FileMapping>& file_mapping,
+        const std::vector<segment_v2::rowid_t>& row_ids, std::vector<SlotDescriptor>& slots,
+        const TabletSchema& full_read_schema, RowStoreReadStruct& row_store_read_struct,
+        OlapReaderStatistics& stats, int64_t* acquire_tablet_ms, int64_t* acquire_rowsets_ms,
+        int64_t* acquire_segments_ms, int64_t* lookup_row_data_ms,
         vectorized::Block& result_block) {
     auto [tablet_id, rowset_id, segment_id] = file_mapping->get_doris_format_info();
     BaseTabletSPtr tablet = scope_timer_run(
@@ -986,7 +1018,7 @@ Status RowIdStorageReader::read_doris_format_row(
                 "Backend:{} tablet not found, tablet_id: {}, rowset_id: {}, segment_id: {}, "
                 "row_id: {}",
                 BackendOptions::get_localhost(), tablet_id, rowset_id.to_string(), segment_id,
-                row_id);
+                row_ids.front());
     }
 
     BetaRowsetSharedPtr rowset = std::static_pointer_cast<BetaRowset>(
@@ -997,7 +1029,7 @@ Status RowIdStorageReader::read_doris_format_row(
                 "Backend:{} rowset_id not found, tablet_id: {}, rowset_id: {}, segment_id: {}, "
                 "row_id: {}",
                 BackendOptions::get_localhost(), tablet_id, rowset_id.to_string(), segment_id,
-                row_id);
+                row_ids.front());
     }
 
     SegmentCacheHandle segment_cache;
@@ -1017,42 +1049,36 @@ Status RowIdStorageReader::read_doris_format_row(
                 "Backend:{} segment not found, tablet_id: {}, rowset_id: {}, segment_id: {}, "
                 "row_id: {}",
                 BackendOptions::get_localhost(), tablet_id, rowset_id.to_string(), segment_id,
-                row_id);
+                row_ids.front());
     }
     segment_v2::SegmentSharedPtr segment = *it;
 
     // if row_store_read_struct not empty, means the line we should read from row_store
     if (!row_store_read_struct.default_values.empty()) {
         CHECK(tablet->tablet_schema()->has_row_store_for_all_columns());
-        RowLocation loc(rowset_id, segment->id(), cast_set<uint32_t>(row_id));
-        row_store_read_struct.row_store_buffer.clear();
+        vectorized::MutableColumnPtr values;
         RETURN_IF_ERROR(scope_timer_run(
                 [&]() {
-                    return tablet->lookup_row_data({}, loc, rowset, stats,
-                                                   row_store_read_struct.row_store_buffer);
+                    return tablet->lookup_row_data_batch(rowset, segment->id(), row_ids, stats,
+                                                         values);
                 },
                 lookup_row_data_ms));
-
-        RETURN_IF_ERROR(vectorized::JsonbSerializeUtil::jsonb_to_block(
-                row_store_read_struct.serdes, row_store_read_struct.row_store_buffer.data(),
-                row_store_read_struct.row_store_buffer.size(), row_store_read_struct.col_uid_to_idx,
-                result_block, row_store_read_struct.default_values, {}));
+        const auto& string_column = assert_cast<const vectorized::ColumnString&>(*values);
+        for (size_t i = 0; i < string_column.size(); ++i) {
+            StringRef value = string_column.get_data_at(i);
+            RETURN_IF_ERROR(vectorized::JsonbSerializeUtil::jsonb_to_block(
+                    row_store_read_struct.serdes, value.data, value.size,
+                    row_store_read_struct.col_uid_to_idx, result_block,
+                    row_store_read_struct.default_values, {}));
+        }
     } else {
         for (int x = 0; x < slots.size(); ++x) {
             vectorized::MutableColumnPtr column =
                     result_block.get_by_position(x).column->assume_mutable();
-            IteratorKey iterator_key {.tablet_id = tablet_id,
-                                      .rowset_id = rowset_id,
-                                      .segment_id = segment_id,
-                                      .slot_id = slots[x].id()};
-            IteratorItem& iterator_item = iterator_map[iterator_key];
-            if (iterator_item.segment == nullptr) {
-                iterator_map[iterator_key].segment = segment;
-            }
-            segment = iterator_item.segment;
-            RETURN_IF_ERROR(segment->seek_and_read_by_rowid(full_read_schema, &slots[x],
-                                                            cast_set<uint32_t>(row_id), column,
-                                                            stats, iterator_item.iterator));
+            std::unique_ptr<ColumnIterator> iterator;
+            RETURN_IF_ERROR(segment->seek_and_read_by_rowids(full_read_schema, &slots[x],
+                                                             row_ids.data(), row_ids.size(),
+                                                             column, stats, iterator));
         }
     }
 
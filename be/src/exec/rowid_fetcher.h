@@ -28,6 +28,7 @@
 #include "common/status.h"
 #include "exec/tablet_info.h" // DorisNodesInfo
 #include "olap/id_manager.h"
+#include "olap/rowset/segment_v2/common.h"
 #include "vec/core/block.h"
 #include "vec/data_types/data_type.h"
 
@@ -96,14 +97,14 @@ public:
     static Status read_by_rowids(const PMultiGetRequestV2& request, PMultiGetResponseV2* response);
 
 private:
-    static Status read_doris_format_row(
+    // Appends the rows `row_ids` of one segment to `result_block`, `row_ids` must be ascending
+    static Status read_doris_format_rows(
             const std::shared_ptr<IdFileMap>& id_file_map,
-            const std::shared_ptr<FileMapping>& file_mapping, int64_t row_id,
-            std::vector<SlotDescriptor>& slots, const TabletSchema& full_read_schema,
-            RowStoreReadStruct& row_store_read_struct, OlapReaderStatistics& stats,
-            int64_t* acquire_tablet_ms, int64_t* acquire_rowsets_ms, int64_t* acquire_segments_ms,
-            int64_t* lookup_row_data_ms,
-            std::unordered_map<IteratorKey, IteratorItem, HashOfIteratorKey>& iterator_map,
+            const std::shared_ptr<FileMapping>& file_mapping,
+            const std::vector<segment_v2::rowid_t>& row_ids, std::vector<SlotDescriptor>& slots,
+            const TabletSchema& full_read_schema, RowStoreReadStruct& row_store_read_struct,
+            OlapReaderStatistics& stats, int64_t* acquire_tablet_ms, int64_t* acquire_rowsets_ms,
+            int64_t* acquire_segments_ms, int64_t* lookup_row_data_ms,
             vectorized::Block& result_block);
 
     static Status read_batch_doris_format_row(
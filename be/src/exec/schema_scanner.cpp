@@ -169,6 +169,15 @@ Status SchemaScanner::init(RuntimeState* state, SchemaScannerParam* param, Objec
     return Status::OK();
 }
 
+const std::set<int64_t>* SchemaScanner::_pushed_down_values(
+        const std::string& column_name) const {
+    if (_param == nullptr) {
+        return nullptr;
+    }
+    auto it = _param->int_column_values.find(column_name);
+    return it == _param->int_column_values.end() ? nullptr : &it->second;
+}
+
 std::unique_ptr<SchemaScanner> SchemaScanner::create(TSchemaTableType::type type) {
     switch (type) {
     case TSchemaTableType::SCH_TABLES:
@@ -23,7 +23,9 @@
 #include <condition_variable>
 #include <cstddef>
 #include <cstdint>
+#include <map>
 #include <memory>
+#include <set>
 #include <string>
 #include <vector>
 
@@ -77,6 +79,10 @@ struct SchemaScannerCommonParam {
 struct SchemaScannerParam {
     std::shared_ptr<SchemaScannerCommonParam> common_param;
     std::unique_ptr<RuntimeProfile> profile;
+    // Values an integer column must take, from conjuncts like `TABLET_ID = 1` or
+    // `TABLET_ID IN (1, 2)`, keyed by the upper case column name. The conjuncts are still
+    // evaluated on the scanned rows, scanners only use these to skip enumerating rows.
+    std::map<std::string, std::set<int64_t>> int_column_values;
 
     SchemaScannerParam() : common_param(new SchemaScannerCommonParam()) {}
 };
@@ -119,6 +125,9 @@ protected:
     Status insert_block_column(TCell cell, int col_index, vectorized::Block* block,
                                PrimitiveType type);
 
+    // Values pushed down for an integer column, nullptr if the column may take any value.
+    const std::set<int64_t>* _pushed_down_values(const std::string& column_name) const;
+
     // get dbname from catalogname.dbname
     // if full_name does not have catalog part, just return origin name.
     std::string get_db_from_full_name(const std::string& full_name);
@@ -83,6 +83,7 @@ Status SchemaRowsetsScanner::start(RuntimeState* state) {
 }
 
 Status SchemaRowsetsScanner::_get_all_rowsets() {
+    const auto* tablet_ids = _pushed_down_values("TABLET_ID");
     if (config::is_cloud_mode()) {
         // only query cloud tablets in lru cache instead of all tablets
         std::vector<std::weak_ptr<CloudTablet>> tablets =
@@ -90,6 +91,9 @@ Status SchemaRowsetsScanner::_get_all_rowsets() {
         for (const std::weak_ptr<CloudTablet>& tablet : tablets) {
             if (!tablet.expired()) {
                 auto t = tablet.lock();
+                if (t == nullptr || (tablet_ids && !tablet_ids->contains(t->tablet_id()))) {
+                    continue;
+                }
                 std::shared_lock rowset_ldlock(t->get_header_lock());
                 for (const auto& it : t->rowset_map()) {
                     rowsets_.emplace_back(it.second);
@@ -98,8 +102,18 @@ Status SchemaRowsetsScanner::_get_all_rowsets() {
         }
         return Status::OK();
     }
-    std::vector<TabletSharedPtr> tablets =
-            ExecEnv::GetInstance()->storage_engine().to_local().tablet_manager()->get_all_tablet();
+    auto* tablet_manager = ExecEnv::GetInstance()->storage_engine().to_local().tablet_manager();
+    std::vector<TabletSharedPtr> tablets;
+    if (tablet_ids != nullptr) {
+        // look the tablets up instead of visiting every tablet of every shard
+        for (int64_t tablet_id : *tablet_ids) {
+            if (auto tablet = tablet_manager->get_tablet(tablet_id); tablet != nullptr) {
+                tablets.push_back(std::move(tablet));
+            }
+        }
+    } else {
+        tablets = tablet_manager->get_all_tablet();
+    }
     for (const auto& tablet : tablets) {
         // all rowset
         std::vector<std::pair<Version, RowsetSharedPtr>> all_rowsets;
@@ -85,18 +85,38 @@ Status SchemaTabletsScanner::start(RuntimeState* state) {
 }
 
 Status SchemaTabletsScanner::_get_all_tablets() {
+    const auto* tablet_ids = _pushed_down_values("TABLET_ID");
+    const auto* partition_ids = _pushed_down_values("PARTITION_ID");
+    auto matches = [&](const BaseTablet& tablet) {
+        return (tablet_ids == nullptr || tablet_ids->contains(tablet.tablet_id())) &&
+               (partition_ids == nullptr || partition_ids->contains(tablet.partition_id()));
+    };
     if (config::is_cloud_mode()) {
         auto tablets =
                 ExecEnv::GetInstance()->storage_engine().to_cloud().tablet_mgr().get_all_tablet();
         std::ranges::for_each(tablets, [&](auto& tablet) {
-            _tablets.push_back(std::static_pointer_cast<BaseTablet>(tablet));
+            if (matches(*tablet)) {
+                _tablets.push_back(std::static_pointer_cast<BaseTablet>(tablet));
+            }
         });
+    } else if (tablet_ids != nullptr) {
+        // look the tablets up instead of visiting every tablet of every shard
+        auto* tablet_manager = ExecEnv::GetInstance()->storage_engine().to_local().tablet_manager();
+        for (int64_t tablet_id : *tablet_ids) {
+            auto tablet = tablet_manager->get_tablet(tablet_id);
+            if (tablet != nullptr && matches(*tablet)) {
+                _tablets.push_back(std::static_pointer_cast<BaseTablet>(tablet));
+            }
+        }
     } else {
         auto tablets = ExecEnv::GetInstance()
                                ->storage_engine()
                                .to_local()
                                .tablet_manager()
-                               ->get_all_tablet();
+                               ->get_all_tablet([&](Tablet* tablet) {
+                                   return TabletManager::filter_used_tablets(tablet) &&
+                                          matches(*tablet);
+                               });
         std::ranges::for_each(tablets, [&](auto& tablet) {
             _tablets.push_back(std::static_pointer_cast<BaseTablet>(tablet));
         });
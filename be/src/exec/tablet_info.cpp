@@ -543,6 +543,29 @@ Status VOlapTablePartitionParam::init() {
     return Status::OK();
 }
 
+void VOlapTablePartitionParam::find_partitions(
+        vectorized::Block* block, int rows, std::vector<VOlapTablePartition*>& partitions) const {
+    if (_is_in_partition) {
+        for (int row = 0; row < rows; row++) {
+            find_partition(block, row, partitions[row]);
+        }
+        return;
+    }
+    VOlapTablePartKeyComparator comparator(_partition_slot_locs, _transformed_slot_locs);
+    VOlapTablePartition* last_partition = nullptr;
+    for (int row = 0; row < rows; row++) {
+        BlockRowWithIndicator key {block, row, true};
+        if (last_partition != nullptr && _part_contains(last_partition, key) &&
+            comparator(key, std::tuple {last_partition->end_key.first,
+                                        last_partition->end_key.second, false})) {
+            partitions[row] = last_partition;
+            continue;
+        }
+        find_partition(block, row, partitions[row]);
+        last_partition = partitions[row];
+    }
+}
+
 bool VOlapTablePartitionParam::_part_contains(VOlapTablePartition* part,
                                               BlockRowWithIndicator key) const {
     VOlapTablePartKeyComparator comparator(_partition_slot_locs, _transformed_slot_locs);
@@ -222,6 +222,11 @@ public:
         return (partition != nullptr);
     }
 
+    // find partitions of rows [0, rows). rows of time-ordered loads mostly fall into the range
+    // partition of the previous row, so that one is checked before searching the map.
+    void find_partitions(vectorized::Block* block, int rows,
+                         std::vector<VOlapTablePartition*>& partitions) const;
+
     ALWAYS_INLINE void find_tablets(
             vectorized::Block* block, const std::vector<uint32_t>& indexes,
             const std::vector<VOlapTablePartition*>& partitions,
@@ -111,6 +111,11 @@ public:
         const bool result = _mm256_testc_si256(bucket, mask);
         _mm256_zeroupper();
         return result;
+#elif defined(__aarch64__)
+        if (_sve_enabled) {
+            return bucket_find_sve(bucket_idx, hash);
+        }
+        return bucket_find(bucket_idx, hash);
 #else
         return bucket_find(bucket_idx, hash);
 #endif
@@ -183,6 +188,16 @@ public:
     // Representation of a filter which allows all elements to pass.
     static constexpr BlockBloomFilter* const kAlwaysTrueFilter = nullptr;
 
+#ifdef __aarch64__
+    // Whether insert() and find() use SVE, decided at startup by the cpu features.
+    static bool sve_enabled() { return _sve_enabled; }
+    // Only takes effect when the cpu supports SVE, used by tests and benchmarks to
+    // compare SVE with NEON.
+    static void set_sve_enabled(bool enabled) { _sve_enabled = enabled && sve_supported(); }
+    // SVE is used only if a bucket fits in one vector, i.e. vectors of at least 256 bits.
+    static bool sve_supported();
+#endif
+
 private:
     // _always_false is true when the bloom filter hasn't had any elements inserted.
     bool _always_false;
@@ -254,6 +269,17 @@ private:
     static void or_equal_array_avx2(size_t n, const uint8_t* __restrict__ in,
                                     uint8_t* __restrict__ out) __attribute__((target("avx2")));
 
+#endif
+
+#ifdef __aarch64__
+    // NEON version of bucket_insert(), bucket_find() already uses NEON on aarch64.
+    void bucket_insert_neon(uint32_t bucket_idx, uint32_t hash) noexcept;
+
+    // SVE versions of bucket_insert() and bucket_find(), only called when _sve_enabled.
+    void bucket_insert_sve(uint32_t bucket_idx, uint32_t hash) noexcept;
+    bool bucket_find_sve(uint32_t bucket_idx, uint32_t hash) const noexcept;
+
+    static bool _sve_enabled;
 #endif
     // Size of the internal directory structure in bytes.
     size_t directory_size() const { return 1ULL << log_space_bytes(); }
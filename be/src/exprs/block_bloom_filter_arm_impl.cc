@@ -0,0 +1,108 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifdef __aarch64__
+
+#include <arm_neon.h>
+#include <glog/logging.h>
+#include <stdint.h>
+
+#ifndef __APPLE__
+#include <arm_sve.h>
+#include <sys/auxv.h>
+
+#ifndef HWCAP_SVE
+#define HWCAP_SVE (1 << 22)
+#endif
+#endif
+
+#include "exprs/block_bloom_filter.hpp"
+
+// The build targets plain armv8-a, so the SVE functions are compiled for SVE on their own and
+// are only called after the cpu is checked at runtime.
+#define SVE_TARGET __attribute__((target("arch=armv8.2-a+sve")))
+
+namespace doris {
+#include "common/compile_check_begin.h"
+
+void BlockBloomFilter::bucket_insert_neon(const uint32_t bucket_idx,
+                                          const uint32_t hash) noexcept {
+    uint32x4_t masks[2];
+    make_find_mask(hash, masks);
+    uint32_t* const bucket = DCHECK_NOTNULL(_directory)[bucket_idx];
+    vst1q_u32(bucket, vorrq_u32(vld1q_u32(bucket), masks[0]));
+    vst1q_u32(bucket + 4, vorrq_u32(vld1q_u32(bucket + 4), masks[1]));
+}
+
+#ifndef __APPLE__
+namespace {
+// Same as make_find_mask(), computes the masks of all 8 words of a bucket in one vector.
+SVE_TARGET svuint32_t make_mask_sve(svbool_t pg, const uint32_t* rehash, uint32_t hash) {
+    svuint32_t hash_data = svmul_n_u32_x(pg, svld1_u32(pg, rehash), hash);
+    // (>> 27) keeps the 5 most significant bits, see shift_num
+    hash_data = svlsr_n_u32_x(pg, hash_data, 27);
+    return svlsl_u32_x(pg, svdup_n_u32(1), hash_data);
+}
+
+SVE_TARGET uint64_t sve_vector_words() {
+    return svcntw();
+}
+} // namespace
+
+SVE_TARGET void BlockBloomFilter::bucket_insert_sve(const uint32_t bucket_idx,
+                                                    const uint32_t hash) noexcept {
+    const svbool_t pg = svwhilelt_b32_u32(0, static_cast<uint32_t>(kBucketWords));
+    uint32_t* const bucket = DCHECK_NOTNULL(_directory)[bucket_idx];
+    const svuint32_t mask = make_mask_sve(pg, kRehash, hash);
+    svst1_u32(pg, bucket, svorr_u32_x(pg, svld1_u32(pg, bucket), mask));
+}
+
+SVE_TARGET bool BlockBloomFilter::bucket_find_sve(const uint32_t bucket_idx,
+                                                  const uint32_t hash) const noexcept {
+    const svbool_t pg = svwhilelt_b32_u32(0, static_cast<uint32_t>(kBucketWords));
+    const svuint32_t mask = make_mask_sve(pg, kRehash, hash);
+    const svuint32_t bucket = svld1_u32(pg, _directory[bucket_idx]);
+    // Found iff every bit of 'mask' is also set in 'bucket', i.e. (mask & ~bucket) is zero
+    // in all the words.
+    return !svptest_any(pg, svcmpne_n_u32(pg, svbic_u32_x(pg, mask, bucket), 0));
+}
+
+bool BlockBloomFilter::sve_supported() {
+    static const bool supported =
+            (getauxval(AT_HWCAP) & HWCAP_SVE) != 0 && sve_vector_words() >= kBucketWords;
+    return supported;
+}
+#else
+void BlockBloomFilter::bucket_insert_sve(const uint32_t bucket_idx, const uint32_t hash) noexcept {
+    bucket_insert_neon(bucket_idx, hash);
+}
+
+bool BlockBloomFilter::bucket_find_sve(const uint32_t bucket_idx,
+                                       const uint32_t hash) const noexcept {
+    return bucket_find(bucket_idx, hash);
+}
+
+bool BlockBloomFilter::sve_supported() {
+    return false;
+}
+#endif
+
+bool BlockBloomFilter::_sve_enabled = BlockBloomFilter::sve_supported();
+
+} // namespace doris
+#include "common/compile_check_end.h"
+#endif
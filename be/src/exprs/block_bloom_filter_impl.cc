@@ -187,6 +187,12 @@ void BlockBloomFilter::insert(const uint32_t hash) noexcept {
     const uint32_t bucket_idx = rehash32to32(hash) & _directory_mask;
 #ifdef __AVX2__
     bucket_insert_avx2(bucket_idx, hash);
+#elif defined(__aarch64__)
+    if (_sve_enabled) {
+        bucket_insert_sve(bucket_idx, hash);
+    } else {
+        bucket_insert_neon(bucket_idx, hash);
+    }
 #else
     bucket_insert(bucket_idx, hash);
 #endif
@@ -0,0 +1,59 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "exprs/regexp_cache.h"
+
+#include "runtime/exec_env.h"
+#include "util/defer_op.h"
+
+namespace doris {
+
+RegexpCache* RegexpCache::instance() {
+    return ExecEnv::GetInstance()->regexp_cache();
+}
+
+// format: pattern\0match_parameter\0options
+std::string RegexpCache::get_key(const StringRef& pattern, const StringRef& match_parameter,
+                                 const StringRef& options_value) {
+    std::string key;
+    key.reserve(pattern.size + match_parameter.size + options_value.size + 2);
+    key.append(pattern.data, pattern.size);
+    key.push_back('\0');
+    key.append(match_parameter.data, match_parameter.size);
+    key.push_back('\0');
+    key.append(options_value.data, options_value.size);
+    return key;
+}
+
+std::shared_ptr<re2::RE2> RegexpCache::lookup_regex(const std::string& key) {
+    auto* lru_handle = lookup(key);
+    if (lru_handle == nullptr) {
+        return nullptr;
+    }
+    Defer release([cache = this, lru_handle] { cache->release(lru_handle); });
+    return ((CacheValue*)LRUCachePolicy::value(lru_handle))->re;
+}
+
+void RegexpCache::insert_regex(const std::string& key, const std::shared_ptr<re2::RE2>& re) {
+    auto* value = new CacheValue;
+    value->re = re;
+    // ProgramSize() counts compiled instructions, a rough proxy of the memory an RE2 holds.
+    auto tracking_bytes = sizeof(re2::RE2) + static_cast<size_t>(re->ProgramSize()) * 16;
+    release(insert(key, value, 1, tracking_bytes, CachePriority::NORMAL));
+}
+
+} // namespace doris
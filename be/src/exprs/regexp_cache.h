@@ -0,0 +1,54 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <re2/re2.h>
+
+#include <memory>
+#include <string>
+
+#include "runtime/memory/lru_cache_policy.h"
+#include "vec/common/string_ref.h"
+
+namespace doris {
+
+// Process-wide cache of compiled regular expressions, keyed by pattern, match parameter
+// and options. A compiled RE2 is immutable and safe to share between threads, so regexp
+// functions with a non-constant pattern no longer recompile it for every row.
+class RegexpCache : public LRUCachePolicy {
+public:
+    class CacheValue : public LRUCacheValueBase {
+    public:
+        std::shared_ptr<re2::RE2> re;
+    };
+
+    RegexpCache(size_t capacity)
+            : LRUCachePolicy(CachePolicy::CacheType::REGEXP_CACHE, capacity,
+                             LRUCacheType::NUMBER, config::regexp_cache_sweep_time_sec) {}
+
+    static RegexpCache* instance();
+
+    static std::string get_key(const StringRef& pattern, const StringRef& match_parameter,
+                               const StringRef& options_value);
+
+    std::shared_ptr<re2::RE2> lookup_regex(const std::string& key);
+
+    void insert_regex(const std::string& key, const std::shared_ptr<re2::RE2>& re);
+};
+
+} // namespace doris
@@ -25,6 +25,7 @@
 
 #include <sstream>
 
+#include "exprs/regexp_cache.h"
 #include "util/string_util.h"
 
 // NOTE: be careful not to use string::append.  It is not performant.
@@ -101,4 +102,28 @@ bool StringFunctions::compile_regex(const StringRef& pattern, std::string* error
     return true;
 }
 
+bool StringFunctions::compile_regex(const StringRef& pattern, std::string* error_str,
+                                    const StringRef& match_parameter,
+                                    const StringRef& options_value, std::shared_ptr<re2::RE2>& re) {
+    auto* cache = RegexpCache::instance();
+    std::string key;
+    if (cache != nullptr) {
+        key = RegexpCache::get_key(pattern, match_parameter, options_value);
+        re = cache->lookup_regex(key);
+        if (re != nullptr) {
+            return true;
+        }
+    }
+    std::unique_ptr<re2::RE2> compiled;
+    if (!compile_regex(pattern, error_str, match_parameter, options_value, compiled)) {
+        re.reset();
+        return false;
+    }
+    re = std::move(compiled);
+    if (cache != nullptr) {
+        cache->insert_regex(key, re);
+    }
+    return true;
+}
+
 } // namespace doris
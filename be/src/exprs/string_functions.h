@@ -38,5 +38,10 @@ public:
     static bool compile_regex(const StringRef& pattern, std::string* error_str,
                               const StringRef& match_parameter, const StringRef& options_value,
                               std::unique_ptr<re2::RE2>& re);
+
+    // Same as above, but the compiled regex is shared through the process-wide RegexpCache.
+    static bool compile_regex(const StringRef& pattern, std::string* error_str,
+                              const StringRef& match_parameter, const StringRef& options_value,
+                              std::shared_ptr<re2::RE2>& re);
 };
 } // namespace doris
@@ -0,0 +1,74 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "http/action/drain_action.h"
+
+#include <rapidjson/prettywriter.h>
+#include <rapidjson/stringbuffer.h>
+
+#include "http/http_channel.h"
+#include "http/http_headers.h"
+#include "http/http_request.h"
+#include "http/http_status.h"
+#include "olap/memtable_memory_limiter.h"
+#include "runtime/exec_env.h"
+#include "runtime/fragment_mgr.h"
+#include "util/time.h"
+
+namespace doris {
+
+bool DrainAction::drained(int32_t running_queries, int64_t memtable_bytes) {
+    return ExecEnv::is_draining() && running_queries == 0 && memtable_bytes == 0;
+}
+
+void DrainAction::handle(HttpRequest* req) {
+    auto* exec_env = ExecEnv::GetInstance();
+    if (req->method() == HttpMethod::POST) {
+        exec_env->start_drain();
+    } else if (req->method() == HttpMethod::DELETE) {
+        ExecEnv::cancel_drain();
+    }
+
+    int32_t running_queries = exec_env->fragment_mgr()->running_query_num();
+    int64_t memtable_bytes = 0;
+    if (exec_env->memtable_memory_limiter() != nullptr) {
+        // refreshed by the memtable memory limiter periodically
+        memtable_bytes = exec_env->memtable_memory_limiter()->mem_usage();
+    }
+
+    rapidjson::StringBuffer buffer;
+    rapidjson::PrettyWriter<rapidjson::StringBuffer> writer(buffer);
+    writer.StartObject();
+    writer.Key("draining");
+    writer.Bool(ExecEnv::is_draining());
+    writer.Key("drain_elapsed_ms");
+    writer.Int64(ExecEnv::is_draining() ? UnixMillis() - ExecEnv::drain_start_ms() : 0);
+    writer.Key("running_queries");
+    writer.Int(running_queries);
+    writer.Key("executing_fragments");
+    writer.Uint64(get_fragment_executing_count());
+    writer.Key("memtable_bytes");
+    writer.Int64(memtable_bytes);
+    writer.Key("drained");
+    writer.Bool(drained(running_queries, memtable_bytes));
+    writer.EndObject();
+
+    req->add_output_header(HttpHeaders::CONTENT_TYPE, "application/json");
+    HttpChannel::send_reply(req, HttpStatus::OK, buffer.GetString());
+}
+
+} // namespace doris
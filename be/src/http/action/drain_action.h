@@ -0,0 +1,42 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+
+#include "http/http_handler_with_auth.h"
+
+namespace doris {
+class ExecEnv;
+class HttpRequest;
+
+// POST starts draining this BE before it is stopped, DELETE cancels it, GET shows how much
+// in-flight work is left so that orchestration can poll until it is drained.
+class DrainAction : public HttpHandlerWithAuth {
+public:
+    explicit DrainAction(ExecEnv* exec_env) : HttpHandlerWithAuth(exec_env) {}
+
+    ~DrainAction() override = default;
+
+    void handle(HttpRequest* req) override;
+
+    // Drained once no query runs and all memtables are flushed.
+    static bool drained(int32_t running_queries, int64_t memtable_bytes);
+};
+
+} // namespace doris
@@ -0,0 +1,166 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "http/action/memory_attribution_action.h"
+
+#include <fmt/format.h>
+#include <rapidjson/prettywriter.h>
+#include <rapidjson/stringbuffer.h>
+
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "http/http_channel.h"
+#include "http/http_headers.h"
+#include "http/http_request.h"
+#include "http/http_status.h"
+#include "runtime/exec_env.h"
+#include "runtime/fragment_mgr.h"
+#include "runtime/memory/global_memory_arbitrator.h"
+#include "runtime/memory/mem_tracker_limiter.h"
+#include "runtime/query_context.h"
+#include "util/uid_util.h"
+
+namespace doris {
+
+namespace {
+
+struct TrackerUsage {
+    MemTrackerLimiter::Type type;
+    std::string label;
+    int64_t consumption;
+    int64_t peak_consumption;
+};
+
+void write_usage(rapidjson::PrettyWriter<rapidjson::StringBuffer>* writer, int64_t consumption,
+                 int64_t peak_consumption) {
+    writer->Key("consumption");
+    writer->Int64(consumption);
+    writer->Key("peak_consumption");
+    writer->Int64(peak_consumption);
+}
+
+} // namespace
+
+void MemoryAttributionAction::handle(HttpRequest* req) {
+    req->add_output_header(HttpHeaders::CONTENT_TYPE, "application/json");
+    size_t top_n = 10;
+    if (const auto& top_n_str = req->param("top_n"); !top_n_str.empty()) {
+        try {
+            top_n = std::stoull(top_n_str);
+        } catch (const std::exception&) {
+            HttpChannel::send_reply(req, HttpStatus::BAD_REQUEST,
+                                    fmt::format("invalid argument.top_n: {}\n", top_n_str));
+            return;
+        }
+    }
+
+    std::map<MemTrackerLimiter::Type, int64_t> type_mem_sum;
+    std::vector<TrackerUsage> others;
+    for (auto& group : ExecEnv::GetInstance()->mem_tracker_limiter_pool) {
+        std::lock_guard<std::mutex> l(group.group_lock);
+        for (const auto& tracker_wptr : group.trackers) {
+            auto tracker = tracker_wptr.lock();
+            if (tracker == nullptr) {
+                continue;
+            }
+            type_mem_sum[tracker->type()] += tracker->consumption();
+            // Queries are shown with their operators below.
+            if (tracker->type() != MemTrackerLimiter::Type::QUERY) {
+                others.push_back({tracker->type(), tracker->label(), tracker->consumption(),
+                                  tracker->peak_consumption()});
+            }
+        }
+    }
+    std::sort(others.begin(), others.end(), [](const auto& lhs, const auto& rhs) {
+        return lhs.consumption > rhs.consumption;
+    });
+    if (top_n > 0 && others.size() > top_n) {
+        others.resize(top_n);
+    }
+
+    auto query_ctxs = ExecEnv::GetInstance()->fragment_mgr()->get_running_query_ctxs();
+    std::vector<std::pair<int64_t, QueryContext*>> queries;
+    queries.reserve(query_ctxs.size());
+    for (const auto& query_ctx : query_ctxs) {
+        queries.emplace_back(query_ctx->query_mem_tracker()->consumption(), query_ctx.get());
+    }
+    std::sort(queries.begin(), queries.end(),
+              [](const auto& lhs, const auto& rhs) { return lhs.first > rhs.first; });
+    if (top_n > 0 && queries.size() > top_n) {
+        queries.resize(top_n);
+    }
+
+    rapidjson::StringBuffer buffer;
+    rapidjson::PrettyWriter<rapidjson::StringBuffer> writer(buffer);
+    writer.StartObject();
+    writer.Key("process");
+    writer.String(GlobalMemoryArbitrator::process_mem_log_str().c_str());
+    writer.Key("tracker_types");
+    writer.StartObject();
+    for (const auto& [type, consumption] : type_mem_sum) {
+        writer.Key(MemTrackerLimiter::type_string(type).c_str());
+        writer.Int64(consumption);
+    }
+    writer.EndObject();
+    writer.Key("top_trackers");
+    writer.StartArray();
+    for (const auto& usage : others) {
+        writer.StartObject();
+        writer.Key("type");
+        writer.String(MemTrackerLimiter::type_string(usage.type).c_str());
+        writer.Key("label");
+        writer.String(usage.label.c_str());
+        write_usage(&writer, usage.consumption, usage.peak_consumption);
+        writer.EndObject();
+    }
+    writer.EndArray();
+    writer.Key("running_queries");
+    writer.StartArray();
+    for (const auto& [_, query_ctx] : queries) {
+        writer.StartObject();
+        writer.Key("query_id");
+        writer.String(print_id(query_ctx->query_id()).c_str());
+        const auto& tracker = query_ctx->query_mem_tracker();
+        write_usage(&writer, tracker->consumption(), tracker->peak_consumption());
+        writer.Key("operators");
+        writer.StartArray();
+        auto operators = query_ctx->collect_operator_memory_usage();
+        std::vector<std::pair<std::string, int64_t>> sorted(operators.begin(), operators.end());
+        std::sort(sorted.begin(), sorted.end(),
+                  [](const auto& lhs, const auto& rhs) { return lhs.second > rhs.second; });
+        for (const auto& [name, consumption] : sorted) {
+            writer.StartObject();
+            writer.Key("name");
+            writer.String(name.c_str());
+            writer.Key("consumption");
+            writer.Int64(consumption);
+            writer.EndObject();
+        }
+        writer.EndArray();
+        writer.EndObject();
+    }
+    writer.EndArray();
+    writer.EndObject();
+    HttpChannel::send_reply(req, HttpStatus::OK, buffer.GetString());
+}
+
+} // end namespace doris
@@ -0,0 +1,39 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include "http/http_handler.h"
+#include "http/http_handler_with_auth.h"
+
+namespace doris {
+class ExecEnv;
+class HttpRequest;
+
+// Show where the memory of this backend goes right now: the sum of each kind of memory tracker,
+// the largest non-query trackers such as caches, and the `top_n` running queries that use the
+// most memory broken down by operator.
+class MemoryAttributionAction : public HttpHandlerWithAuth {
+public:
+    explicit MemoryAttributionAction(ExecEnv* exec_env) : HttpHandlerWithAuth(exec_env) {}
+
+    ~MemoryAttributionAction() override = default;
+
+    void handle(HttpRequest* req) override;
+};
+
+} // end namespace doris
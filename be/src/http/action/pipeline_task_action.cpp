@@ -17,6 +17,10 @@
 
 #include "http/action/pipeline_task_action.h"
 
+#include <rapidjson/prettywriter.h>
+#include <rapidjson/stringbuffer.h>
+
+#include <algorithm>
 #include <sstream>
 #include <string>
 
@@ -24,9 +28,12 @@
 #include "http/http_headers.h"
 #include "http/http_request.h"
 #include "http/http_status.h"
+#include "pipeline/dependency_wait_stats.h"
 #include "pipeline/pipeline_fragment_context.h"
 #include "runtime/exec_env.h"
 #include "runtime/fragment_mgr.h"
+#include "runtime/query_context.h"
+#include "util/uid_util.h"
 
 namespace doris {
 
@@ -84,4 +91,77 @@ void QueryPipelineTaskAction::handle(HttpRequest* req) {
                             ExecEnv::GetInstance()->fragment_mgr()->dump_pipeline_tasks(query_id));
 }
 
+static void write_dependency_waits(rapidjson::PrettyWriter<rapidjson::StringBuffer>* writer,
+                                   const pipeline::DependencyWaitStats& stats, size_t top_n) {
+    writer->Key("total_wait_ns");
+    writer->Int64(stats.total_wait_ns());
+    writer->Key("waits");
+    writer->StartArray();
+    for (const auto& item : stats.top_waits(top_n)) {
+        writer->StartObject();
+        writer->Key("dependency");
+        writer->String(item.dependency.c_str());
+        if (item.node_id >= 0) {
+            writer->Key("node_id");
+            writer->Int(item.node_id);
+        }
+        writer->Key("wait_ns");
+        writer->Int64(item.wait_ns);
+        writer->Key("wait_times");
+        writer->Int64(item.wait_times);
+        writer->EndObject();
+    }
+    writer->EndArray();
+}
+
+void DependencyWaitAction::handle(HttpRequest* req) {
+    req->add_output_header(HttpHeaders::CONTENT_TYPE, "application/json");
+    size_t top_n = 10;
+    if (const auto& top_n_str = req->param("top_n"); !top_n_str.empty()) {
+        try {
+            top_n = std::stoull(top_n_str);
+        } catch (const std::exception&) {
+            HttpChannel::send_reply(req, HttpStatus::BAD_REQUEST,
+                                    fmt::format("invalid argument.top_n: {}\n", top_n_str));
+            return;
+        }
+    }
+
+    auto query_ctxs = ExecEnv::GetInstance()->fragment_mgr()->get_running_query_ctxs();
+    // Waits of running queries are not in the backend stats until they finish.
+    pipeline::DependencyWaitStats backend_stats;
+    pipeline::DependencyWaitStats::backend()->merge_to(&backend_stats);
+    std::vector<std::pair<int64_t, QueryContext*>> queries;
+    queries.reserve(query_ctxs.size());
+    for (const auto& query_ctx : query_ctxs) {
+        query_ctx->dependency_wait_stats()->merge_to(&backend_stats);
+        queries.emplace_back(query_ctx->dependency_wait_stats()->total_wait_ns(), query_ctx.get());
+    }
+    std::sort(queries.begin(), queries.end(),
+              [](const auto& lhs, const auto& rhs) { return lhs.first > rhs.first; });
+    if (top_n > 0 && queries.size() > top_n) {
+        queries.resize(top_n);
+    }
+
+    rapidjson::StringBuffer buffer;
+    rapidjson::PrettyWriter<rapidjson::StringBuffer> writer(buffer);
+    writer.StartObject();
+    writer.Key("backend");
+    writer.StartObject();
+    write_dependency_waits(&writer, backend_stats, top_n);
+    writer.EndObject();
+    writer.Key("running_queries");
+    writer.StartArray();
+    for (const auto& [_, query_ctx] : queries) {
+        writer.StartObject();
+        writer.Key("query_id");
+        writer.String(print_id(query_ctx->query_id()).c_str());
+        write_dependency_waits(&writer, *query_ctx->dependency_wait_stats(), top_n);
+        writer.EndObject();
+    }
+    writer.EndArray();
+    writer.EndObject();
+    HttpChannel::send_reply(req, HttpStatus::OK, buffer.GetString());
+}
+
 } // end namespace doris
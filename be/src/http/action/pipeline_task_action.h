@@ -51,4 +51,15 @@ public:
     void handle(HttpRequest* req) override;
 };
 
+// Show how long pipeline tasks are blocked by each kind of dependency, for the whole backend and
+// for the `top_n` running queries that waited the longest.
+class DependencyWaitAction : public HttpHandlerWithAuth {
+public:
+    DependencyWaitAction(ExecEnv* exec_env) : HttpHandlerWithAuth(exec_env) {}
+
+    ~DependencyWaitAction() override = default;
+
+    void handle(HttpRequest* req) override;
+};
+
 } // end namespace doris
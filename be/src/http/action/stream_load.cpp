@@ -29,6 +29,7 @@
 #include <sys/time.h>
 #include <thrift/protocol/TDebugProtocol.h>
 
+#include <algorithm>
 #include <cstdint>
 #include <cstdlib>
 #include <ctime>
@@ -79,6 +80,10 @@ DEFINE_GAUGE_METRIC_PROTOTYPE_2ARG(streaming_load_current_processing, MetricUnit
 bvar::LatencyRecorder g_stream_load_receive_data_latency_ms("stream_load_receive_data_latency_ms");
 bvar::LatencyRecorder g_stream_load_commit_and_publish_latency_ms("stream_load",
                                                                   "commit_and_publish_ms");
+bvar::LatencyRecorder g_stream_load_put_latency_ms("stream_load", "stream_load_put_ms");
+bvar::LatencyRecorder g_stream_load_read_data_latency_ms("stream_load", "read_data_ms");
+bvar::LatencyRecorder g_stream_load_latency_ms("stream_load", "load_ms");
+bvar::LatencyRecorder g_group_commit_stream_load_latency_ms("stream_load", "group_commit_load_ms");
 
 static constexpr size_t MIN_CHUNK_SIZE = 64 * 1024;
 static const std::string CHUNK = "chunked";
@@ -115,6 +120,15 @@ void StreamLoadAction::handle(HttpRequest* req) {
         }
     }
     ctx->load_cost_millis = UnixMillis() - ctx->start_millis;
+    if (ctx->status.ok()) {
+        // Time of the other stages is recorded where they finish.
+        g_stream_load_read_data_latency_ms << ctx->read_data_cost_nanos / 1000000;
+        if (ctx->group_commit) {
+            g_group_commit_stream_load_latency_ms << ctx->load_cost_millis;
+        } else {
+            g_stream_load_latency_ms << ctx->load_cost_millis;
+        }
+    }
 
     if (!ctx->status.ok() && !ctx->status.is<PUBLISH_TIMEOUT>()) {
         if (ctx->need_rollback) {
@@ -358,9 +372,11 @@ void StreamLoadAction::on_chunk_data(HttpRequest* req) {
     SCOPED_ATTACH_TASK(ExecEnv::GetInstance()->stream_load_pipe_tracker());
 
     int64_t start_read_data_time = MonotonicNanos();
-    while (evbuffer_get_length(evbuf) > 0) {
+    size_t buffered_bytes = 0;
+    while ((buffered_bytes = evbuffer_get_length(evbuf)) > 0) {
         ByteBufferPtr bb;
-        Status st = ByteBuffer::allocate(128 * 1024, &bb);
+        // small chunks do not need a full 128KB buffer each
+        Status st = ByteBuffer::allocate(std::min<size_t>(buffered_bytes, 128 * 1024), &bb);
         if (!st.ok()) {
             ctx->status = st;
             return;
@@ -753,6 +769,7 @@ Status StreamLoadAction::_process_put(HttpRequest* http_req,
                 client->streamLoadPut(ctx->put_result, request);
             }));
     ctx->stream_load_put_cost_nanos = MonotonicNanos() - stream_load_put_start_time;
+    g_stream_load_put_latency_ms << ctx->stream_load_put_cost_nanos / 1000000;
 #else
     ctx->put_result = k_stream_load_put_result;
 #endif
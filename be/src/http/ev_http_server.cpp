@@ -20,12 +20,14 @@
 #include <arpa/inet.h>
 #include <butil/endpoint.h>
 #include <butil/fd_utility.h>
+#include <bvar/latency_recorder.h>
 // IWYU pragma: no_include <bthread/errno.h>
 #include <errno.h> // IWYU pragma: keep
 #include <event2/event.h>
 #include <event2/http.h>
 #include <event2/http_struct.h>
 #include <event2/thread.h>
+#include <netdb.h>
 #include <netinet/in.h>
 #include <string.h>
 #include <sys/socket.h>
@@ -35,6 +37,7 @@
 #include <memory>
 #include <sstream>
 
+#include "common/config.h"
 #include "common/logging.h"
 #include "http/http_channel.h"
 #include "http/http_handler.h"
@@ -43,12 +46,15 @@
 #include "http/http_status.h"
 #include "service/backend_options.h"
 #include "util/threadpool.h"
+#include "util/time.h"
 
 struct event_base;
 struct evhttp;
 
 namespace doris {
 
+bvar::LatencyRecorder g_http_request_handle_latency_us("http_server", "request_handle_latency_us");
+
 static void on_chunked(struct evhttp_request* ev_req, void* param) {
     HttpRequest* request = (HttpRequest*)ev_req->on_free_cb_arg;
     request->handler()->on_chunk_data(request);
@@ -65,7 +71,9 @@ static void on_request(struct evhttp_request* ev_req, void* arg) {
         // In this case, request's on_header return -1
         return;
     }
+    int64_t start_us = MonotonicMicros();
     request->handler()->handle(request);
+    g_http_request_handle_latency_us << (MonotonicMicros() - start_us);
 }
 
 static int on_header(struct evhttp_request* ev_req, void* param) {
@@ -130,7 +138,8 @@ void EvHttpServer::start() {
                                          [](evhttp* http) { evhttp_free(http); });
             CHECK(http != nullptr) << "Couldn't create an evhttp.";
 
-            auto res = evhttp_accept_socket(http.get(), _server_fd);
+            int server_fd = _server_fds.empty() ? _server_fd : _server_fds[i];
+            auto res = evhttp_accept_socket(http.get(), server_fd);
             CHECK(res >= 0) << "evhttp accept socket failed, res=" << res;
 
             evhttp_set_newreqcb(http.get(), on_connection, this);
@@ -151,13 +160,22 @@ void EvHttpServer::stop() {
     }
     _workers->shutdown();
     _event_bases.clear();
-    close(_server_fd);
+    if (_server_fds.empty()) {
+        close(_server_fd);
+    }
+    for (int fd : _server_fds) {
+        close(fd);
+    }
+    _server_fds.clear();
     _started = false;
 }
 
 void EvHttpServer::join() {}
 
 Status EvHttpServer::_bind() {
+    if (config::enable_webserver_reuseport) {
+        return _bind_reuseport();
+    }
     butil::EndPoint point;
     auto res = butil::str2endpoint(_host.c_str(), _port, &point);
     if (res < 0) {
@@ -190,6 +208,78 @@ Status EvHttpServer::_bind() {
     return Status::OK();
 }
 
+Status EvHttpServer::_bind_reuseport() {
+    int port = _port;
+    for (int i = 0; i < _num_workers; ++i) {
+        int fd = -1;
+        auto st = _listen_reuseport(port, &fd);
+        if (!st.ok()) {
+            for (int opened_fd : _server_fds) {
+                close(opened_fd);
+            }
+            _server_fds.clear();
+            return st;
+        }
+        _server_fds.push_back(fd);
+        if (i == 0 && _port == 0) {
+            // the other sockets must share the port the os chose for the first one
+            struct sockaddr_storage addr;
+            socklen_t socklen = sizeof(addr);
+            if (getsockname(fd, (struct sockaddr*)&addr, &socklen) == 0) {
+                port = addr.ss_family == AF_INET6
+                               ? ntohs(((struct sockaddr_in6*)&addr)->sin6_port)
+                               : ntohs(((struct sockaddr_in*)&addr)->sin_port);
+                _real_port = port;
+            }
+        }
+    }
+    return Status::OK();
+}
+
+Status EvHttpServer::_listen_reuseport(int port, int* fd) {
+    std::string host = _host;
+    if (host.size() > 2 && host.front() == '[' && host.back() == ']') {
+        host = host.substr(1, host.size() - 2);
+    }
+    struct addrinfo hints;
+    memset(&hints, 0, sizeof(hints));
+    hints.ai_family = AF_UNSPEC;
+    hints.ai_socktype = SOCK_STREAM;
+    hints.ai_flags = AI_PASSIVE | AI_NUMERICHOST | AI_NUMERICSERV;
+    struct addrinfo* addrs = nullptr;
+    auto port_str = std::to_string(port);
+    int res = getaddrinfo(host.empty() ? nullptr : host.c_str(), port_str.c_str(), &hints, &addrs);
+    if (res != 0) {
+        return Status::InternalError("convert address failed, host={}, port={}, err={}", _host,
+                                     port, gai_strerror(res));
+    }
+    std::unique_ptr<struct addrinfo, decltype(&freeaddrinfo)> addrs_guard(addrs, freeaddrinfo);
+
+    auto socket_error = [](const char* op) {
+        char buf[64];
+        return Status::InternalError("{} failed, errno={}, errmsg={}", op, errno,
+                                     strerror_r(errno, buf, sizeof(buf)));
+    };
+    *fd = socket(addrs->ai_family, addrs->ai_socktype, addrs->ai_protocol);
+    if (*fd < 0) {
+        return socket_error("create socket");
+    }
+    int on = 1;
+    if (setsockopt(*fd, SOL_SOCKET, SO_REUSEADDR, &on, sizeof(on)) < 0 ||
+        setsockopt(*fd, SOL_SOCKET, SO_REUSEPORT, &on, sizeof(on)) < 0) {
+        auto st = socket_error("set socket reuse option");
+        close(*fd);
+        return st;
+    }
+    if (bind(*fd, addrs->ai_addr, addrs->ai_addrlen) < 0 || listen(*fd, SOMAXCONN) < 0 ||
+        butil::make_non_blocking(*fd) < 0) {
+        auto st = socket_error("tcp listen");
+        close(*fd);
+        return st;
+    }
+    return Status::OK();
+}
+
 bool EvHttpServer::register_handler(const HttpMethod& method, const std::string& path,
                                     HttpHandler* handler) {
     if (handler == nullptr) {
@@ -198,7 +288,7 @@ bool EvHttpServer::register_handler(const HttpMethod& method, const std::string&
     }
 
     bool result = true;
-    std::lock_guard<std::mutex> lock(_handler_lock);
+    std::lock_guard lock(_handler_lock);
     PathTrie<HttpHandler*>* root = nullptr;
     switch (method) {
     case GET:
@@ -233,7 +323,7 @@ bool EvHttpServer::register_handler(const HttpMethod& method, const std::string&
 void EvHttpServer::register_static_file_handler(HttpHandler* handler) {
     DCHECK(handler != nullptr);
     DCHECK(_static_file_handler == nullptr);
-    std::lock_guard<std::mutex> lock(_handler_lock);
+    std::lock_guard lock(_handler_lock);
     _static_file_handler = handler;
 }
 
@@ -274,7 +364,7 @@ HttpHandler* EvHttpServer::_find_handler(HttpRequest* req) {
 
     HttpHandler* handler = nullptr;
 
-    std::lock_guard<std::mutex> lock(_handler_lock);
+    std::shared_lock lock(_handler_lock);
     switch (req->method()) {
     case GET:
         _get_handlers.retrieve(path, &handler, req->params());
@@ -19,6 +19,7 @@
 
 #include <memory>
 #include <mutex>
+#include <shared_mutex>
 #include <string>
 #include <vector>
 
@@ -62,6 +63,9 @@ public:
 
 private:
     Status _bind();
+    // Opens one listening socket per worker with SO_REUSEPORT set
+    Status _bind_reuseport();
+    Status _listen_reuseport(int port, int* fd);
     HttpHandler* _find_handler(HttpRequest* req);
 
 private:
@@ -73,11 +77,14 @@ private:
     int _real_port;
 
     int _server_fd = -1;
+    // listening socket of each worker, only used when enable_webserver_reuseport is true
+    std::vector<int> _server_fds;
     std::unique_ptr<ThreadPool> _workers;
     std::mutex _event_bases_lock; // protect _event_bases
     std::vector<std::shared_ptr<event_base>> _event_bases;
 
-    std::mutex _handler_lock;
+    // handlers are registered before start, requests only read them
+    std::shared_mutex _handler_lock;
     PathTrie<HttpHandler*> _get_handlers;
     HttpHandler* _static_file_handler = nullptr;
     PathTrie<HttpHandler*> _put_handlers;
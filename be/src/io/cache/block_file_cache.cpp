@@ -34,9 +34,11 @@
 #include <sys/statfs.h>
 #endif
 
+#include <algorithm>
 #include <chrono> // IWYU pragma: keep
 #include <mutex>
 #include <ranges>
+#include <tuple>
 
 #include "common/cast_set.h"
 #include "common/config.h"
@@ -45,6 +47,7 @@
 #include "io/cache/file_block.h"
 #include "io/cache/file_cache_common.h"
 #include "io/cache/fs_file_cache_storage.h"
+#include "io/cache/log_file_cache_storage.h"
 #include "io/cache/mem_file_cache_storage.h"
 #include "util/runtime_profile.h"
 #include "util/stopwatch.hpp"
@@ -210,6 +213,25 @@ BlockFileCache::BlockFileCache(const std::string& cache_base_path,
                                                            "file_cache_hit_ratio_5m", 0.0);
     _hit_ratio_1h = std::make_shared<bvar::Status<double>>(_cache_base_path.c_str(),
                                                            "file_cache_hit_ratio_1h", 0.0);
+    for (auto type : {FileCacheType::INDEX, FileCacheType::NORMAL, FileCacheType::DISPOSABLE,
+                      FileCacheType::TTL}) {
+        auto idx = static_cast<int>(type);
+        std::string prefix = "file_cache_" + cache_type_to_string(type);
+        _num_read_blocks_by_type[idx] = std::make_shared<bvar::Adder<size_t>>(
+                _cache_base_path.c_str(), prefix + "_num_read_blocks");
+        _num_hit_blocks_by_type[idx] = std::make_shared<bvar::Adder<size_t>>(
+                _cache_base_path.c_str(), prefix + "_num_hit_blocks");
+        _num_read_bytes_by_type[idx] = std::make_shared<bvar::Adder<size_t>>(
+                _cache_base_path.c_str(), prefix + "_num_read_bytes");
+        _num_hit_bytes_by_type[idx] = std::make_shared<bvar::Adder<size_t>>(
+                _cache_base_path.c_str(), prefix + "_num_hit_bytes");
+        _hit_ratio_by_type[idx] = std::make_shared<bvar::Status<double>>(
+                _cache_base_path.c_str(), prefix + "_hit_ratio", 0.0);
+        _byte_hit_ratio_by_type[idx] = std::make_shared<bvar::Status<double>>(
+                _cache_base_path.c_str(), prefix + "_byte_hit_ratio", 0.0);
+    }
+    _cost_aware_evict_reordered_blocks = std::make_shared<bvar::Adder<size_t>>(
+            _cache_base_path.c_str(), "file_cache_cost_aware_evict_reordered_blocks");
     _disk_limit_mode_metrics = std::make_shared<bvar::Status<size_t>>(
             _cache_base_path.c_str(), "file_cache_disk_limit_mode", 0);
     _need_evict_cache_in_advance_metrics = std::make_shared<bvar::Status<size_t>>(
@@ -250,6 +272,8 @@ BlockFileCache::BlockFileCache(const std::string& cache_base_path,
     if (cache_settings.storage == "memory") {
         _storage = std::make_unique<MemFileCacheStorage>();
         _cache_base_path = "memory";
+    } else if (cache_settings.storage == "log") {
+        _storage = std::make_unique<LogFileCacheStorage>();
     } else {
         _storage = std::make_unique<FSFileCacheStorage>();
     }
@@ -375,6 +399,7 @@ void BlockFileCache::use_cell(const FileBlockCell& cell, FileBlocks* result, boo
     }
 
     cell.update_atime();
+    ++cell.hit_count;
 }
 
 template <class T>
@@ -766,8 +791,15 @@ FileBlocksHolder BlockFileCache::get_or_set(const UInt128Wrapper& hash, size_t o
         DCHECK(!file_blocks.empty());
         *_num_read_blocks << file_blocks.size();
         for (auto& block : file_blocks) {
+            auto type = static_cast<int>(block->cache_type());
+            size_t read_bytes = std::min(block->range().right, range.right) -
+                                std::max(block->range().left, range.left) + 1;
+            *_num_read_blocks_by_type[type] << 1;
+            *_num_read_bytes_by_type[type] << read_bytes;
             if (block->state_unsafe() == FileBlock::State::DOWNLOADED) {
                 *_num_hit_blocks << 1;
+                *_num_hit_blocks_by_type[type] << 1;
+                *_num_hit_bytes_by_type[type] << read_bytes;
             }
         }
     }
@@ -929,6 +961,11 @@ void BlockFileCache::find_evict_candidates(LRUQueue& queue, size_t size, size_t
                                            std::vector<FileBlockCell*>& to_evict,
                                            std::lock_guard<std::mutex>& cache_lock,
                                            size_t& cur_removed_size, bool evict_in_advance) {
+    if (config::file_cache_cost_aware_evict_window > 0) {
+        find_cost_aware_evict_candidates(queue, size, cur_cache_size, removed_size, to_evict,
+                                         cache_lock, cur_removed_size, evict_in_advance);
+        return;
+    }
     for (const auto& [entry_key, entry_offset, entry_size] : queue) {
         if (!is_overflow(removed_size, size, cur_cache_size, evict_in_advance)) {
             break;
@@ -953,6 +990,64 @@ void BlockFileCache::find_evict_candidates(LRUQueue& queue, size_t size, size_t
     }
 }
 
+// GDSF-like selection: among the `file_cache_cost_aware_evict_window` least recently used
+// releasable cells, evict the cheapest to lose first, i.e. the lowest
+// (hit_count + 1) * fetch_cost / size. Cells behind the window are taken in LRU order.
+void BlockFileCache::find_cost_aware_evict_candidates(LRUQueue& queue, size_t size,
+                                                      size_t cur_cache_size, size_t& removed_size,
+                                                      std::vector<FileBlockCell*>& to_evict,
+                                                      std::lock_guard<std::mutex>& cache_lock,
+                                                      size_t& cur_removed_size,
+                                                      bool evict_in_advance) {
+    auto window = static_cast<size_t>(config::file_cache_cost_aware_evict_window);
+    // (priority, position in lru order, cell)
+    std::vector<std::tuple<double, size_t, FileBlockCell*>> candidates;
+    auto it = queue.begin();
+    for (; it != queue.end() && candidates.size() < window; ++it) {
+        auto* cell = get_cell(it->hash, it->offset, cache_lock);
+        DCHECK(cell) << "Cache became inconsistent. key: " << it->hash.to_string()
+                     << ", offset: " << it->offset;
+        if (!cell->releasable()) {
+            continue;
+        }
+        // blocks without a measured fetch (restored, warmed up) count as 1us
+        auto cost = static_cast<double>(std::max<int64_t>(cell->file_block->fetch_cost_us(), 1));
+        double priority = (cell->hit_count + 1) * cost / static_cast<double>(cell->size());
+        candidates.emplace_back(priority, candidates.size(), cell);
+    }
+    // ties keep the LRU order
+    std::sort(candidates.begin(), candidates.end());
+    for (size_t i = 0; i < candidates.size(); ++i) {
+        if (!is_overflow(removed_size, size, cur_cache_size, evict_in_advance)) {
+            return;
+        }
+        auto [_, lru_pos, cell] = candidates[i];
+        if (lru_pos != i) {
+            *_cost_aware_evict_reordered_blocks << 1;
+        }
+        std::lock_guard block_lock(cell->file_block->_mutex);
+        DCHECK(cell->file_block->_download_state == FileBlock::State::DOWNLOADED);
+        to_evict.push_back(cell);
+        removed_size += cell->size();
+        cur_removed_size += cell->size();
+    }
+    for (; it != queue.end(); ++it) {
+        if (!is_overflow(removed_size, size, cur_cache_size, evict_in_advance)) {
+            return;
+        }
+        auto* cell = get_cell(it->hash, it->offset, cache_lock);
+        DCHECK(cell) << "Cache became inconsistent. key: " << it->hash.to_string()
+                     << ", offset: " << it->offset;
+        if (cell->releasable()) {
+            std::lock_guard block_lock(cell->file_block->_mutex);
+            DCHECK(cell->file_block->_download_state == FileBlock::State::DOWNLOADED);
+            to_evict.push_back(cell);
+            removed_size += cell->size();
+            cur_removed_size += cell->size();
+        }
+    }
+}
+
 // 1. if async load file cache not finish
 //     a. evict from lru queue
 // 2. if ttl cache
@@ -1755,7 +1850,7 @@ std::string BlockFileCache::reset_capacity(size_t new_capacity) {
 }
 
 void BlockFileCache::check_disk_resource_limit() {
-    if (_storage->get_type() != FileCacheStorageType::DISK) {
+    if (_storage->get_type() == FileCacheStorageType::MEMORY) {
         return;
     }
     if (_capacity > _cur_cache_size) {
@@ -1805,7 +1900,7 @@ void BlockFileCache::check_disk_resource_limit() {
 }
 
 void BlockFileCache::check_need_evict_cache_in_advance() {
-    if (_storage->get_type() != FileCacheStorageType::DISK) {
+    if (_storage->get_type() == FileCacheStorageType::MEMORY) {
         return;
     }
 
@@ -1910,6 +2005,18 @@ void BlockFileCache::run_background_monitor() {
                 _hit_ratio_1h->set_value((double)_num_hit_blocks_1h->get_value() /
                                          (double)_num_read_blocks_1h->get_value());
             }
+            for (size_t i = 0; i < _hit_ratio_by_type.size(); ++i) {
+                if (_num_read_blocks_by_type[i]->get_value() > 0) {
+                    _hit_ratio_by_type[i]->set_value(
+                            (double)_num_hit_blocks_by_type[i]->get_value() /
+                            (double)_num_read_blocks_by_type[i]->get_value());
+                }
+                if (_num_read_bytes_by_type[i]->get_value() > 0) {
+                    _byte_hit_ratio_by_type[i]->set_value(
+                            (double)_num_hit_bytes_by_type[i]->get_value() /
+                            (double)_num_read_bytes_by_type[i]->get_value());
+                }
+            }
         }
     }
 }
@@ -2287,6 +2394,34 @@ void BlockFileCache::restore_lru_queues_from_disk(std::lock_guard<std::mutex>& c
     _lru_dumper->restore_queue(_disposable_queue, "disposable", cache_lock);
 }
 
+void BlockFileCache::correct_restored_expiration_time(const UInt128Wrapper& hash,
+                                                      uint64_t expiration_time,
+                                                      std::lock_guard<std::mutex>& cache_lock) {
+    auto iter = _key_to_time.find(hash);
+    if (iter == _key_to_time.end() ||
+        iter->second != CacheLRUDumper::RESTORED_TTL_EXPIRATION_TIME ||
+        expiration_time == 0 || expiration_time == iter->second) {
+        return;
+    }
+    auto range = _time_to_key.equal_range(iter->second);
+    for (auto it = range.first; it != range.second; ++it) {
+        if (it->second == hash) {
+            _time_to_key.erase(it);
+            break;
+        }
+    }
+    _time_to_key.insert(std::make_pair(expiration_time, hash));
+    iter->second = expiration_time;
+    // the files already live under the real expiration directory, so only the in-memory key
+    // is fixed here, no rename is needed
+    if (auto it = _files.find(hash); it != _files.end()) {
+        for (auto& [_, cell] : it->second) {
+            std::lock_guard block_lock(cell.file_block->_mutex);
+            cell.file_block->_key.meta.expiration_time = expiration_time;
+        }
+    }
+}
+
 std::map<std::string, double> BlockFileCache::get_stats() {
     std::map<std::string, double> stats;
     stats["hits_ratio"] = (double)_hit_ratio->get_value();
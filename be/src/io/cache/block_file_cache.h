@@ -80,6 +80,7 @@ class FSFileCacheStorage;
 // The current strategies are lru and ttl.
 class BlockFileCache {
     friend class FSFileCacheStorage;
+    friend class LogFileCacheStorage;
     friend class MemFileCacheStorage;
     friend class FileBlock;
     friend struct FileBlocksHolder;
@@ -290,6 +291,8 @@ private:
         std::optional<LRUQueue::Iterator> queue_iterator;
 
         mutable int64_t atime {0};
+        /// Times the cell was reused after creation, weighs cost aware eviction.
+        mutable uint32_t hit_count {0};
         void update_atime() const {
             atime = std::chrono::duration_cast<std::chrono::seconds>(
                             std::chrono::steady_clock::now().time_since_epoch())
@@ -307,7 +310,8 @@ private:
         FileBlockCell(FileBlockCell&& other) noexcept
                 : file_block(std::move(other.file_block)),
                   queue_iterator(other.queue_iterator),
-                  atime(other.atime) {}
+                  atime(other.atime),
+                  hit_count(other.hit_count) {}
 
         FileBlockCell& operator=(const FileBlockCell&) = delete;
         FileBlockCell(const FileBlockCell&) = delete;
@@ -390,6 +394,9 @@ private:
     void run_background_lru_log_replay();
     void run_background_lru_dump();
     void restore_lru_queues_from_disk(std::lock_guard<std::mutex>& cache_lock);
+    // replace the placeholder expiration time of a ttl key restored from the lru dump
+    void correct_restored_expiration_time(const UInt128Wrapper& hash, uint64_t expiration_time,
+                                          std::lock_guard<std::mutex>& cache_lock);
     void run_background_evict_in_advance();
 
     bool try_reserve_from_other_queue_by_time_interval(FileCacheType cur_type,
@@ -411,6 +418,11 @@ private:
     void remove_file_blocks_and_clean_time_maps(std::vector<FileBlockCell*>&,
                                                 std::lock_guard<std::mutex>&);
 
+    void find_cost_aware_evict_candidates(LRUQueue& queue, size_t size, size_t cur_cache_size,
+                                          size_t& removed_size,
+                                          std::vector<FileBlockCell*>& to_evict,
+                                          std::lock_guard<std::mutex>& cache_lock,
+                                          size_t& cur_removed_size, bool evict_in_advance);
     void find_evict_candidates(LRUQueue& queue, size_t size, size_t cur_cache_size,
                                size_t& removed_size, std::vector<FileBlockCell*>& to_evict,
                                std::lock_guard<std::mutex>& cache_lock, size_t& cur_removed_size,
@@ -508,6 +520,14 @@ private:
     std::shared_ptr<bvar::Status<double>> _hit_ratio;
     std::shared_ptr<bvar::Status<double>> _hit_ratio_5m;
     std::shared_ptr<bvar::Status<double>> _hit_ratio_1h;
+    // indexed by FileCacheType
+    std::array<std::shared_ptr<bvar::Adder<size_t>>, 4> _num_read_blocks_by_type;
+    std::array<std::shared_ptr<bvar::Adder<size_t>>, 4> _num_hit_blocks_by_type;
+    std::array<std::shared_ptr<bvar::Adder<size_t>>, 4> _num_read_bytes_by_type;
+    std::array<std::shared_ptr<bvar::Adder<size_t>>, 4> _num_hit_bytes_by_type;
+    std::array<std::shared_ptr<bvar::Status<double>>, 4> _hit_ratio_by_type;
+    std::array<std::shared_ptr<bvar::Status<double>>, 4> _byte_hit_ratio_by_type;
+    std::shared_ptr<bvar::Adder<size_t>> _cost_aware_evict_reordered_blocks;
     std::shared_ptr<bvar::Status<size_t>> _disk_limit_mode_metrics;
     std::shared_ptr<bvar::Status<size_t>> _need_evict_cache_in_advance_metrics;
 
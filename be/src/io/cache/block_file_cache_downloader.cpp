@@ -47,6 +47,18 @@ bvar::Adder<uint64_t> g_file_cache_download_finished_num("file_cache_download_fi
 bvar::Adder<uint64_t> g_file_cache_download_failed_num("file_cache_download_failed_num");
 bvar::Adder<uint64_t> block_file_cache_downloader_task_total("file_cache_downloader_queue_total");
 
+// A segment file task dropped without being downloaded still has to tell its submitter, which
+// may be counting its in-flight chunks
+static void fail_download_task(DownloadTask& task, Status st) {
+    if (task.task_message.index() == 1) { // download segment file task
+        auto& download_file_meta = std::get<1>(task.task_message);
+        if (download_file_meta.download_done) {
+            download_file_meta.download_done(std::move(st));
+        }
+        g_file_cache_download_failed_num << 1;
+    }
+}
+
 FileCacheBlockDownloader::FileCacheBlockDownloader(CloudStorageEngine& engine) : _engine(engine) {
     _poller = std::thread(&FileCacheBlockDownloader::polling_download_task, this);
     auto st = ThreadPoolBuilder("FileCacheBlockDownloader")
@@ -66,6 +78,10 @@ FileCacheBlockDownloader::~FileCacheBlockDownloader() {
     if (_poller.joinable()) {
         _poller.join();
     }
+    for (auto& task : _task_queue) {
+        fail_download_task(task, Status::InternalError("The downloader is closed"));
+    }
+    _task_queue.clear();
 
     if (_workers) {
         _workers->shutdown();
@@ -75,6 +91,7 @@ FileCacheBlockDownloader::~FileCacheBlockDownloader() {
 void FileCacheBlockDownloader::submit_download_task(DownloadTask task) {
     if (!config::enable_file_cache) [[unlikely]] {
         LOG(INFO) << "Skip submit download file task because file cache is not enabled";
+        fail_download_task(task, Status::InternalError("The file cache is not enabled"));
         return;
     }
 
@@ -98,14 +115,8 @@ void FileCacheBlockDownloader::submit_download_task(DownloadTask task) {
     {
         std::lock_guard lock(_mtx);
         if (_task_queue.size() == _max_size) {
-            if (_task_queue.front().task_message.index() == 1) { // download segment file task
-                auto& download_file_meta = std::get<1>(_task_queue.front().task_message);
-                if (download_file_meta.download_done) {
-                    download_file_meta.download_done(
-                            Status::InternalError("The downloader queue is full"));
-                }
-                g_file_cache_download_failed_num << 1;
-            }
+            fail_download_task(_task_queue.front(),
+                               Status::InternalError("The downloader queue is full"));
             LOG(INFO) << "submit_download_task: task queue full, pop front";
             _task_queue.pop_front(); // Eliminate the earliest task in the queue
             block_file_cache_downloader_task_total << -1;
@@ -142,11 +153,14 @@ void FileCacheBlockDownloader::polling_download_task() {
                                                              task.atime)
                     .count() < hot_interval) {
             VLOG_DEBUG << "polling_download_task: submit download_blocks to thread pool";
-            auto st = _workers->submit_func(
-                    [this, task_ = std::move(task)]() mutable { download_blocks(task_); });
+            auto task_ptr = std::make_shared<DownloadTask>(std::move(task));
+            auto st = _workers->submit_func([this, task_ptr]() { download_blocks(*task_ptr); });
             if (!st.ok()) {
                 LOG(WARNING) << "submit download blocks failed: " << st;
+                fail_download_task(*task_ptr, st);
             }
+        } else {
+            fail_download_task(task, Status::InternalError("The download task is expired"));
         }
     }
 }
@@ -31,12 +31,15 @@
 #endif
 
 #include <algorithm>
+#include <filesystem>
 #include <ostream>
 #include <utility>
 
 #include "common/config.h"
 #include "exec/schema_scanner/schema_scanner_helper.h"
 #include "io/cache/file_cache_common.h"
+#include "io/fs/file_reader.h"
+#include "io/fs/file_writer.h"
 #include "io/fs/local_file_system.h"
 #include "runtime/exec_env.h"
 #include "service/backend_options.h"
@@ -60,11 +63,74 @@ size_t FileCacheFactory::try_release() {
 }
 
 size_t FileCacheFactory::try_release(const std::string& base_path) {
-    auto iter = _path_to_cache.find(base_path);
-    if (iter != _path_to_cache.end()) {
-        return iter->second->try_release();
+    size_t elements = 0;
+    if (auto iter = _path_to_shards.find(base_path); iter != _path_to_shards.end()) {
+        for (auto* cache : iter->second) {
+            elements += cache->try_release();
+        }
+    } else if (auto* cache = get_by_path(base_path); cache != nullptr) {
+        elements += cache->try_release();
     }
-    return 0;
+    return elements;
+}
+
+// Every size and element limit is divided evenly, keys are spread evenly by hash.
+static FileCacheSettings split_file_cache_settings(const FileCacheSettings& settings,
+                                                   size_t shards) {
+    FileCacheSettings shard_settings = settings;
+    shard_settings.capacity = settings.capacity / shards;
+    shard_settings.disposable_queue_size = settings.disposable_queue_size / shards;
+    shard_settings.disposable_queue_elements =
+            std::max<size_t>(1, settings.disposable_queue_elements / shards);
+    shard_settings.index_queue_size = settings.index_queue_size / shards;
+    shard_settings.index_queue_elements =
+            std::max<size_t>(1, settings.index_queue_elements / shards);
+    shard_settings.query_queue_size = settings.query_queue_size / shards;
+    shard_settings.query_queue_elements =
+            std::max<size_t>(1, settings.query_queue_elements / shards);
+    shard_settings.ttl_queue_size = settings.ttl_queue_size / shards;
+    shard_settings.ttl_queue_elements = std::max<size_t>(1, settings.ttl_queue_elements / shards);
+    shard_settings.max_query_cache_size = settings.max_query_cache_size / shards;
+    return shard_settings;
+}
+
+// The "shards" file of a disk path records how many sub caches it is split into, no file means
+// one. Blocks cached under another shard count are never looked up again, so they are removed.
+static Status remove_other_shard_layout(const std::string& cache_base_path, size_t shards) {
+    const auto& fs = global_local_filesystem();
+    std::string layout_path = (std::filesystem::path(cache_base_path) / "shards").string();
+    std::string layout = "1";
+    bool exists = false;
+    RETURN_IF_ERROR(fs->exists(layout_path, &exists));
+    if (exists) {
+        int64_t file_size = 0;
+        RETURN_IF_ERROR(fs->file_size(layout_path, &file_size));
+        FileReaderSPtr layout_reader;
+        RETURN_IF_ERROR(fs->open_file(layout_path, &layout_reader));
+        layout.resize(file_size);
+        size_t bytes_read = 0;
+        RETURN_IF_ERROR(layout_reader->read_at(0, Slice(layout.data(), file_size), &bytes_read));
+        RETURN_IF_ERROR(layout_reader->close());
+    }
+    if (layout == std::to_string(shards)) {
+        return Status::OK();
+    }
+    std::vector<FileInfo> entries;
+    RETURN_IF_ERROR(fs->list(cache_base_path, false, &entries, &exists));
+    for (const auto& entry : entries) {
+        if (entry.file_name != "shards") {
+            RETURN_IF_ERROR(fs->delete_directory_or_file(std::filesystem::path(cache_base_path) /
+                                                         entry.file_name));
+        }
+    }
+    LOG(INFO) << "[FileCache] path: " << cache_base_path << " was cached with " << layout
+              << " shards, removed " << entries.size() << " entries to use " << shards
+              << " shards";
+    std::string new_layout = std::to_string(shards);
+    FileWriterPtr layout_writer;
+    RETURN_IF_ERROR(fs->create_file(layout_path, &layout_writer));
+    RETURN_IF_ERROR(layout_writer->append(Slice(new_layout)));
+    return layout_writer->close();
 }
 
 Status FileCacheFactory::create_file_cache(const std::string& cache_base_path,
@@ -106,13 +172,39 @@ Status FileCacheFactory::create_file_cache(const std::string& cache_base_path,
                   << " total_size: " << file_cache_settings.capacity
                   << " disk_total_size: " << disk_capacity;
     }
-    auto cache = std::make_unique<BlockFileCache>(cache_base_path, file_cache_settings);
-    RETURN_IF_ERROR(cache->initialize());
+    size_t shards = 1;
+    if (file_cache_settings.storage != "memory" && config::file_cache_shards_per_path > 1) {
+        shards = static_cast<size_t>(config::file_cache_shards_per_path);
+    }
+    if (file_cache_settings.storage != "memory") {
+        RETURN_IF_ERROR(remove_other_shard_layout(cache_base_path, shards));
+    }
+    std::vector<std::unique_ptr<BlockFileCache>> caches;
+    if (shards == 1) {
+        caches.push_back(std::make_unique<BlockFileCache>(cache_base_path, file_cache_settings));
+    } else {
+        auto shard_settings = split_file_cache_settings(file_cache_settings, shards);
+        for (size_t i = 0; i < shards; ++i) {
+            std::string shard_path =
+                    (std::filesystem::path(cache_base_path) / fmt::format("shard_{}", i)).string();
+            RETURN_IF_ERROR(global_local_filesystem()->create_directory(shard_path));
+            caches.push_back(std::make_unique<BlockFileCache>(shard_path, shard_settings));
+        }
+        LOG(INFO) << "[FileCache] path: " << cache_base_path << " split into " << shards
+                  << " shards, shard size: " << shard_settings.capacity;
+    }
+    for (auto& cache : caches) {
+        RETURN_IF_ERROR(cache->initialize());
+    }
     {
         std::lock_guard lock(_mtx);
-        _path_to_cache[cache_base_path] = cache.get();
-        _caches.push_back(std::move(cache));
-        _capacity += file_cache_settings.capacity;
+        auto& path_shards = _path_to_shards[cache_base_path];
+        for (auto& cache : caches) {
+            _path_to_cache[cache->get_base_path()] = cache.get();
+            path_shards.push_back(cache.get());
+            _capacity += cache->capacity();
+            _caches.push_back(std::move(cache));
+        }
     }
 
     return Status::OK();
@@ -146,6 +238,15 @@ BlockFileCache* FileCacheFactory::get_by_path(const std::string& cache_base_path
     }
 }
 
+BlockFileCache* FileCacheFactory::get_by_path(const std::string& cache_base_path,
+                                              const UInt128Wrapper& key) {
+    auto iter = _path_to_shards.find(cache_base_path);
+    if (iter == _path_to_shards.end()) {
+        return get_by_path(cache_base_path);
+    }
+    return iter->second[KeyHash()(key) % iter->second.size()];
+}
+
 std::vector<BlockFileCache::QueryFileCacheContextHolderPtr>
 FileCacheFactory::get_query_context_holders(const TUniqueId& query_id) {
     std::vector<BlockFileCache::QueryFileCacheContextHolderPtr> holders;
@@ -165,7 +266,7 @@ std::string FileCacheFactory::clear_file_caches(bool sync) {
 
 std::vector<std::string> FileCacheFactory::get_base_paths() {
     std::vector<std::string> paths;
-    for (const auto& pair : _path_to_cache) {
+    for (const auto& pair : _path_to_shards) {
         paths.push_back(pair.first);
     }
     return paths;
@@ -195,38 +296,48 @@ std::string validate_capacity(const std::string& path, int64_t new_capacity,
     return "";
 }
 
+// The capacity of a sharded path is split evenly among its shards.
+static std::string reset_shards_capacity(const std::string& path,
+                                         const std::vector<BlockFileCache*>& shards,
+                                         int64_t new_capacity, bool* ok) {
+    std::stringstream ss;
+    int64_t valid_capacity = 0;
+    ss << validate_capacity(path, new_capacity, valid_capacity);
+    *ok = valid_capacity > 0;
+    if (!*ok) {
+        return ss.str();
+    }
+    auto shard_capacity = valid_capacity / static_cast<int64_t>(shards.size());
+    for (auto* cache : shards) {
+        ss << cache->reset_capacity(static_cast<size_t>(shard_capacity));
+    }
+    return ss.str();
+}
+
 std::string FileCacheFactory::reset_capacity(const std::string& path, int64_t new_capacity) {
     std::stringstream ss;
     size_t total_capacity = 0;
+    bool ok = true;
     if (path.empty()) {
-        for (auto& [p, cache] : _path_to_cache) {
-            int64_t valid_capacity = 0;
-            ss << validate_capacity(p, new_capacity, valid_capacity);
-            if (valid_capacity <= 0) {
+        for (auto& [p, shards] : _path_to_shards) {
+            ss << reset_shards_capacity(p, shards, new_capacity, &ok);
+            if (!ok) {
                 return ss.str();
             }
-            ss << cache->reset_capacity(valid_capacity);
-            total_capacity += cache->capacity();
         }
-        _capacity = total_capacity;
-        return ss.str();
-    } else {
-        if (auto iter = _path_to_cache.find(path); iter != _path_to_cache.end()) {
-            int64_t valid_capacity = 0;
-            ss << validate_capacity(path, new_capacity, valid_capacity);
-            if (valid_capacity <= 0) {
-                return ss.str();
-            }
-            ss << iter->second->reset_capacity(valid_capacity);
-
-            for (auto& [p, cache] : _path_to_cache) {
-                total_capacity += cache->capacity();
-            }
-            _capacity = total_capacity;
+    } else if (auto iter = _path_to_shards.find(path); iter != _path_to_shards.end()) {
+        ss << reset_shards_capacity(path, iter->second, new_capacity, &ok);
+        if (!ok) {
             return ss.str();
         }
+    } else {
+        return "Unknown the cache path " + path;
+    }
+    for (auto& cache : _caches) {
+        total_capacity += cache->capacity();
     }
-    return "Unknown the cache path " + path;
+    _capacity = total_capacity;
+    return ss.str();
 }
 
 void FileCacheFactory::get_cache_stats_block(vectorized::Block* block) {
@@ -66,6 +66,8 @@ public:
 
     BlockFileCache* get_by_path(const UInt128Wrapper& hash);
     BlockFileCache* get_by_path(const std::string& cache_base_path);
+    // Pick the sub cache of cache_base_path that owns key, nullptr if the path is unknown.
+    BlockFileCache* get_by_path(const std::string& cache_base_path, const UInt128Wrapper& key);
     std::vector<BlockFileCache::QueryFileCacheContextHolderPtr> get_query_context_holders(
             const TUniqueId& query_id);
 
@@ -98,6 +100,8 @@ private:
     std::mutex _mtx;
     std::vector<std::unique_ptr<BlockFileCache>> _caches;
     std::unordered_map<std::string, BlockFileCache*> _path_to_cache;
+    // configured base path -> its sub caches, see config::file_cache_shards_per_path
+    std::unordered_map<std::string, std::vector<BlockFileCache*>> _path_to_shards;
     size_t _capacity = 0;
     std::atomic_size_t _next_index {0}; // use for round-robin
 };
@@ -423,13 +423,9 @@ void CacheLRUDumper::restore_queue(LRUQueue& queue, const std::string& queue_nam
             CacheContext ctx;
             if (queue_name == "ttl") {
                 ctx.cache_type = FileCacheType::TTL;
-                // TODO(zhengyu): we haven't persist expiration time yet, use 3h default
-                // There are mulitiple places we can correct this fake 3h ttl, e.g.:
-                // 1. during load_cache_info_into_memory (this will cause overwriting the ttl of async load)
-                // 2. after restoring, use sync_meta to modify the ttl
-                // However, I plan not to do this in this commit but to figure a more elegant way
-                // after ttl expiration time being changed from file name encoding to rocksdb persistency.
-                ctx.expiration_time = 10800;
+                // expiration time is not persisted yet, the placeholder is corrected by
+                // load_cache_info_into_memory once the real one is read from disk
+                ctx.expiration_time = RESTORED_TTL_EXPIRATION_TIME;
             } else if (queue_name == "index") {
                 ctx.cache_type = FileCacheType::INDEX;
             } else if (queue_name == "normal") {
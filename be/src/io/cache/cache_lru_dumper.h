@@ -37,6 +37,10 @@ class LRUQueueRecorder;
 
 class CacheLRUDumper {
 public:
+    // expiration time is not persisted in the dump, restored ttl cells carry this placeholder
+    // until the background load corrects it from the on-disk layout
+    static constexpr uint64_t RESTORED_TTL_EXPIRATION_TIME = 10800;
+
     CacheLRUDumper(BlockFileCache* mgr, LRUQueueRecorder* recorder)
             : _mgr(mgr), _recorder(recorder) {};
     void dump_queue(const std::string& queue_name);
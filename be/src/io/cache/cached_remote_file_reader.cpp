@@ -47,6 +47,14 @@ bvar::LatencyRecorder g_skip_cache_num("cached_remote_reader_skip_cache_num");
 bvar::Adder<uint64_t> g_skip_cache_sum("cached_remote_reader_skip_cache_sum");
 bvar::Adder<uint64_t> g_skip_local_cache_io_sum_bytes(
         "cached_remote_reader_skip_local_cache_io_sum_bytes");
+// miss_blocks / miss_remote_reads is the coalescing ratio of cache misses
+bvar::Adder<uint64_t> g_miss_remote_reads("cached_remote_reader_miss_remote_reads");
+bvar::Adder<uint64_t> g_miss_blocks("cached_remote_reader_miss_blocks");
+// bytes fetched from remote that were not requested by the reader
+bvar::Adder<uint64_t> g_over_read_bytes("cached_remote_reader_over_read_bytes");
+// latency(us) of read_at served entirely by the file cache, or needing any remote read
+bvar::LatencyRecorder g_read_at_hit_latency("cached_remote_reader", "read_at_hit");
+bvar::LatencyRecorder g_read_at_miss_latency("cached_remote_reader", "read_at_miss");
 
 CachedRemoteFileReader::CachedRemoteFileReader(FileReaderSPtr remote_file_reader,
                                                const FileReaderOptions& opts)
@@ -67,7 +75,7 @@ CachedRemoteFileReader::CachedRemoteFileReader(FileReaderSPtr remote_file_reader
             _cache = FileCacheFactory::instance()->get_by_path(_cache_hash);
         } else {
             // from query session variable: file_cache_base_path
-            _cache = FileCacheFactory::instance()->get_by_path(opts.cache_base_path);
+            _cache = FileCacheFactory::instance()->get_by_path(opts.cache_base_path, _cache_hash);
             if (_cache == nullptr) {
                 LOG(WARNING) << "Can't get cache from base path: " << opts.cache_base_path
                              << ", using random instead.";
@@ -110,6 +118,62 @@ std::pair<size_t, size_t> CachedRemoteFileReader::s_align_size(size_t offset, si
     return std::make_pair(align_left, align_size);
 }
 
+Status CachedRemoteFileReader::_fetch_blocks(std::span<const FileBlockSPtr> blocks, size_t offset,
+                                             Slice result, const IOContext* io_ctx,
+                                             ReadStatistics& stats) {
+    size_t empty_start = blocks.front()->range().left;
+    size_t empty_end = blocks.back()->range().right;
+    size_t size = empty_end - empty_start + 1;
+    std::unique_ptr<char[]> buffer(new char[size]);
+    int64_t fetch_ns = 0;
+    {
+        s3_read_counter << 1;
+        SCOPED_RAW_TIMER(&fetch_ns);
+        RETURN_IF_ERROR(_remote_file_reader->read_at(empty_start, Slice(buffer.get(), size), &size,
+                                                     io_ctx));
+    }
+    stats.remote_read_timer += fetch_ns;
+    g_miss_remote_reads << 1;
+    g_miss_blocks << blocks.size();
+    for (const auto& block : blocks) {
+        if (block->state() == FileBlock::State::SKIP_CACHE) {
+            continue;
+        }
+        SCOPED_RAW_TIMER(&stats.local_write_timer);
+        char* cur_ptr = buffer.get() + block->range().left - empty_start;
+        size_t block_size = block->range().size();
+        // share the latency of the coalesced read by bytes
+        block->set_fetch_cost_us(static_cast<int64_t>(
+                static_cast<double>(fetch_ns) / 1000 * static_cast<double>(block_size) /
+                static_cast<double>(empty_end - empty_start + 1)));
+        Status st = block->append(Slice(cur_ptr, block_size));
+        if (st.ok()) {
+            st = block->finalize();
+        }
+        if (!st.ok()) {
+            LOG_EVERY_N(WARNING, 100) << "Write data to file cache failed. err=" << st.msg();
+        } else {
+            _insert_file_reader(block);
+        }
+        stats.bytes_write_into_file_cache += block_size;
+    }
+    // copy from memory directly
+    size_t right_offset = offset + result.size - 1;
+    size_t copy_size = 0;
+    if (empty_start <= right_offset && empty_end >= offset) {
+        size_t copy_left_offset = offset < empty_start ? empty_start : offset;
+        size_t copy_right_offset = right_offset < empty_end ? right_offset : empty_end;
+        copy_size = copy_right_offset - copy_left_offset + 1;
+        if (!io_ctx->is_dryrun) {
+            char* dst = result.data + (copy_left_offset - offset);
+            char* src = buffer.get() + (copy_left_offset - empty_start);
+            memcpy(dst, src, copy_size);
+        }
+    }
+    g_over_read_bytes << (empty_end - empty_start + 1 - copy_size);
+    return Status::OK();
+}
+
 Status CachedRemoteFileReader::read_at_impl(size_t offset, Slice result, size_t* bytes_read,
                                             const IOContext* io_ctx) {
     const bool is_dryrun = io_ctx->is_dryrun;
@@ -127,7 +191,13 @@ Status CachedRemoteFileReader::read_at_impl(size_t offset, Slice result, size_t*
         return Status::OK();
     }
     ReadStatistics stats;
+    MonotonicStopWatch read_at_sw;
+    read_at_sw.start();
     auto defer_func = [&](int*) {
+        if (!is_dryrun) {
+            (stats.hit_cache ? g_read_at_hit_latency : g_read_at_miss_latency)
+                    << static_cast<int64_t>(read_at_sw.elapsed_time() / 1000);
+        }
         if (io_ctx->file_cache_stats && !is_dryrun) {
             // update stats in io_ctx, for query profile
             _update_stats(stats, io_ctx->file_cache_stats, io_ctx->is_inverted_index);
@@ -213,49 +283,49 @@ Status CachedRemoteFileReader::read_at_impl(size_t offset, Slice result, size_t*
             break;
         }
     }
-    size_t empty_start = 0;
-    size_t empty_end = 0;
-    if (!empty_blocks.empty()) {
-        empty_start = empty_blocks.front()->range().left;
-        empty_end = empty_blocks.back()->range().right;
-        size_t size = empty_end - empty_start + 1;
-        std::unique_ptr<char[]> buffer(new char[size]);
-        {
-            s3_read_counter << 1;
-            SCOPED_RAW_TIMER(&stats.remote_read_timer);
-            RETURN_IF_ERROR(_remote_file_reader->read_at(empty_start, Slice(buffer.get(), size),
-                                                         &size, io_ctx));
-        }
-        for (auto& block : empty_blocks) {
-            if (block->state() == FileBlock::State::SKIP_CACHE) {
-                continue;
-            }
-            SCOPED_RAW_TIMER(&stats.local_write_timer);
-            char* cur_ptr = buffer.get() + block->range().left - empty_start;
-            size_t block_size = block->range().size();
-            Status st = block->append(Slice(cur_ptr, block_size));
-            if (st.ok()) {
-                st = block->finalize();
-            }
-            if (!st.ok()) {
-                LOG_EVERY_N(WARNING, 100) << "Write data to file cache failed. err=" << st.msg();
-            } else {
-                _insert_file_reader(block);
-            }
-            stats.bytes_write_into_file_cache += block_size;
-        }
-        // copy from memory directly
-        size_t right_offset = offset + bytes_req - 1;
-        if (empty_start <= right_offset && empty_end >= offset && !is_dryrun) {
-            size_t copy_left_offset = offset < empty_start ? empty_start : offset;
-            size_t copy_right_offset = right_offset < empty_end ? right_offset : empty_end;
-            char* dst = result.data + (copy_left_offset - offset);
-            char* src = buffer.get() + (copy_left_offset - empty_start);
-            size_t copy_size = copy_right_offset - copy_left_offset + 1;
-            memcpy(dst, src, copy_size);
+    // Misses are fetched in runs, a run is split where the cached gap between two misses
+    // exceeds file_cache_miss_coalesce_max_gap_bytes.
+    std::vector<std::pair<size_t, size_t>> fetched_ranges;
+    const int64_t max_gap = config::file_cache_miss_coalesce_max_gap_bytes;
+    auto can_merge = [max_gap](const FileBlockSPtr& prev, const FileBlockSPtr& next) {
+        size_t gap = next->range().left - prev->range().right - 1;
+        return max_gap < 0 || gap <= static_cast<size_t>(max_gap);
+    };
+    for (size_t run_begin = 0, i = 1; i <= empty_blocks.size(); ++i) {
+        if (i < empty_blocks.size() && can_merge(empty_blocks[i - 1], empty_blocks[i])) {
+            continue;
         }
+        RETURN_IF_ERROR(_fetch_blocks(
+                std::span(empty_blocks).subspan(run_begin, i - run_begin), offset,
+                Slice(result.data, bytes_req), io_ctx, stats));
+        fetched_ranges.emplace_back(empty_blocks[run_begin]->range().left,
+                                    empty_blocks[i - 1]->range().right);
+        run_begin = i;
     }
 
+    // Blocks that could not be read from the cache after waiting for their downloader are
+    // read from remote, contiguous ones with a single read.
+    size_t pending_offset = 0;
+    size_t pending_size = 0;
+    size_t pending_blocks = 0;
+    auto read_pending = [&]() -> Status {
+        if (pending_size == 0) {
+            return Status::OK();
+        }
+        size_t pending_read {0};
+        s3_read_counter << 1;
+        g_miss_remote_reads << 1;
+        g_miss_blocks << pending_blocks;
+        SCOPED_RAW_TIMER(&stats.remote_read_timer);
+        RETURN_IF_ERROR(_remote_file_reader->read_at(
+                pending_offset, Slice(result.data + (pending_offset - offset), pending_size),
+                &pending_read));
+        DCHECK(pending_read == pending_size);
+        pending_size = 0;
+        pending_blocks = 0;
+        return Status::OK();
+    };
+
     size_t current_offset = offset;
     size_t end_offset = offset + bytes_req - 1;
     *bytes_read = 0;
@@ -270,7 +340,9 @@ Status CachedRemoteFileReader::read_at_impl(size_t offset, Slice result, size_t*
         }
         size_t read_size =
                 end_offset > right ? right - current_offset + 1 : end_offset - current_offset + 1;
-        if (empty_start <= left && right <= empty_end) {
+        if (std::any_of(fetched_ranges.begin(), fetched_ranges.end(), [&](const auto& range) {
+                return range.first <= left && right <= range.second;
+            })) {
             *bytes_read += read_size;
             current_offset = right + 1;
             continue;
@@ -312,19 +384,21 @@ Status CachedRemoteFileReader::read_at_impl(size_t offset, Slice result, size_t*
             if (!st || block_state != FileBlock::State::DOWNLOADED) {
                 LOG(WARNING) << "Read data failed from file cache downloaded by others. err="
                              << st.msg() << ", block state=" << block_state;
-                size_t bytes_read {0};
                 stats.hit_cache = false;
-                s3_read_counter << 1;
-                SCOPED_RAW_TIMER(&stats.remote_read_timer);
-                RETURN_IF_ERROR(_remote_file_reader->read_at(
-                        current_offset, Slice(result.data + (current_offset - offset), read_size),
-                        &bytes_read));
-                DCHECK(bytes_read == read_size);
+                if (pending_size > 0 && pending_offset + pending_size != current_offset) {
+                    RETURN_IF_ERROR(read_pending());
+                }
+                if (pending_size == 0) {
+                    pending_offset = current_offset;
+                }
+                pending_size += read_size;
+                ++pending_blocks;
             }
         }
         *bytes_read += read_size;
         current_offset = right + 1;
     }
+    RETURN_IF_ERROR(read_pending());
     DCHECK(*bytes_read == bytes_req);
     return Status::OK();
 }
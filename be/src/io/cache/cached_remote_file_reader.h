@@ -21,6 +21,7 @@
 #include <cstdint>
 #include <map>
 #include <shared_mutex>
+#include <span>
 #include <utility>
 
 #include "common/status.h"
@@ -60,6 +61,10 @@ protected:
 
 private:
     void _insert_file_reader(FileBlockSPtr file_block);
+    // Fetch the contiguous range covering blocks with one remote read, fill the cache blocks
+    // and copy the part overlapping [offset, offset + result.size) into result.
+    Status _fetch_blocks(std::span<const FileBlockSPtr> blocks, size_t offset, Slice result,
+                         const IOContext* io_ctx, ReadStatistics& stats);
     bool _is_doris_table;
     FileReaderSPtr _remote_file_reader;
     UInt128Wrapper _cache_hash;
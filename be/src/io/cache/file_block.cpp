@@ -162,7 +162,13 @@ Status FileBlock::finalize() {
 }
 
 Status FileBlock::read(Slice buffer, size_t read_offset) {
-    return _mgr->_storage->read(_key, read_offset, buffer);
+    Status st = _mgr->_storage->read(_key, read_offset, buffer);
+    if (st.is<ErrorCode::NOT_FOUND>()) [[unlikely]] {
+        // the cell is stale, e.g. restored from the lru dump while its file is gone, drop it
+        // when the last holder releases it so that it can be cached again
+        set_deleting();
+    }
+    return st;
 }
 
 Status FileBlock::change_cache_type_between_ttl_and_others(FileCacheType new_type) {
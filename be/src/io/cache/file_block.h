@@ -135,6 +135,12 @@ public:
     void set_deleting() { _is_deleting = true; }
     bool is_deleting() const { return _is_deleting; };
 
+    // time spent fetching the block from remote, used by cost aware eviction
+    void set_fetch_cost_us(int64_t cost_us) {
+        _fetch_cost_us.store(cost_us, std::memory_order_relaxed);
+    }
+    int64_t fetch_cost_us() const { return _fetch_cost_us.load(std::memory_order_relaxed); }
+
 private:
     std::string get_info_for_log_impl(std::lock_guard<std::mutex>& block_lock) const;
 
@@ -161,6 +167,7 @@ private:
     FileCacheKey _key;
     size_t _downloaded_size {0};
     bool _is_deleting {false};
+    std::atomic<int64_t> _fetch_cost_us {0};
 };
 
 extern std::ostream& operator<<(std::ostream& os, const FileBlock::State& value);
@@ -26,7 +26,7 @@ class BlockFileCache;
 
 using FileWriterMapKey = std::pair<UInt128Wrapper, size_t>;
 
-enum FileCacheStorageType { DISK = 0, MEMORY = 1 };
+enum FileCacheStorageType { DISK = 0, MEMORY = 1, LOG_STRUCTURED_DISK = 2 };
 
 struct FileWriterMapKeyHash {
     std::size_t operator()(const FileWriterMapKey& w) const {
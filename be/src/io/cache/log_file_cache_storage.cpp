@@ -0,0 +1,556 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "io/cache/log_file_cache_storage.h"
+
+#include <fcntl.h>
+#include <fmt/format.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <set>
+#include <system_error>
+
+#include "common/config.h"
+#include "common/logging.h"
+#include "common/macros.h"
+#include "io/cache/block_file_cache.h"
+#include "io/cache/file_block.h"
+#include "io/fs/err_utils.h"
+#include "runtime/memory/mem_tracker_limiter.h"
+#include "runtime/thread_context.h"
+#include "util/defer_op.h"
+
+namespace doris::io {
+
+namespace {
+
+// One entry of a segment index, the last record of a block wins during replay.
+struct IndexRecord {
+    uint64_t hash_high;
+    uint64_t hash_low;
+    uint64_t offset;
+    uint64_t segment_offset;
+    // 0 means the block has been removed
+    uint64_t size;
+    uint64_t expiration_time;
+    uint8_t type;
+} __attribute__((packed));
+
+Status pwrite_fully(int fd, const char* data, size_t size, size_t file_offset,
+                    const std::string& path) {
+    while (size > 0) {
+        ssize_t res;
+        RETRY_ON_EINTR(res, ::pwrite(fd, data, size, static_cast<off_t>(file_offset)));
+        if (res < 0) {
+            return localfs_error(errno, fmt::format("failed to write {}", path));
+        }
+        data += res;
+        size -= static_cast<size_t>(res);
+        file_offset += static_cast<size_t>(res);
+    }
+    return Status::OK();
+}
+
+Status pread_fully(int fd, char* data, size_t size, size_t file_offset, const std::string& path) {
+    while (size > 0) {
+        ssize_t res;
+        RETRY_ON_EINTR(res, ::pread(fd, data, size, static_cast<off_t>(file_offset)));
+        if (res < 0) {
+            return localfs_error(errno, fmt::format("failed to read {}", path));
+        }
+        if (res == 0) {
+            return Status::InternalError("cannot read from {}: unexpected EOF", path);
+        }
+        data += res;
+        size -= static_cast<size_t>(res);
+        file_offset += static_cast<size_t>(res);
+    }
+    return Status::OK();
+}
+
+void remove_file_quietly(const std::string& path) {
+    std::error_code ec;
+    std::filesystem::remove(path, ec);
+    if (ec) {
+        LOG(WARNING) << "failed to remove file cache segment file " << path << ": "
+                     << ec.message();
+    }
+}
+
+CacheContext load_context(const KeyMeta& meta) {
+    CacheContext context;
+    context.query_id = TUniqueId();
+    context.cache_type = meta.type;
+    context.expiration_time = static_cast<int64_t>(meta.expiration_time);
+    return context;
+}
+
+} // namespace
+
+LogFileCacheStorage::Segment::~Segment() {
+    if (data_fd >= 0) {
+        ::close(data_fd);
+    }
+    if (index_fd >= 0) {
+        ::close(index_fd);
+    }
+}
+
+LogFileCacheStorage::~LogFileCacheStorage() {
+    if (_cache_background_load_thread.joinable()) {
+        _cache_background_load_thread.join();
+    }
+    for (const auto& [_, data] : _pending_blocks) {
+        _pending_mem_tracker->release(data.size());
+    }
+}
+
+Status LogFileCacheStorage::_open_segment(uint64_t id, size_t capacity, bool create,
+                                          SegmentSPtr* segment) const {
+    auto seg = std::make_shared<Segment>();
+    seg->id = id;
+    seg->data_path = fmt::format("{}/{}.dat", _log_path, id);
+    seg->index_path = fmt::format("{}/{}.idx", _log_path, id);
+    int create_flags = create ? O_CREAT | O_EXCL : 0;
+    RETRY_ON_EINTR(seg->data_fd,
+                   ::open(seg->data_path.c_str(), O_RDWR | O_CLOEXEC | create_flags, 0644));
+    if (seg->data_fd < 0) {
+        return localfs_error(errno, fmt::format("failed to open {}", seg->data_path));
+    }
+    RETRY_ON_EINTR(seg->index_fd, ::open(seg->index_path.c_str(),
+                                         O_WRONLY | O_APPEND | O_CLOEXEC | create_flags, 0644));
+    if (seg->index_fd < 0) {
+        return localfs_error(errno, fmt::format("failed to open {}", seg->index_path));
+    }
+    if (create) {
+#ifndef __APPLE__
+        // keep the segment contiguous on disk, failing only costs fragmentation
+        if (::fallocate(seg->data_fd, 0, 0, static_cast<off_t>(capacity)) != 0) {
+            VLOG_DEBUG << "failed to preallocate " << seg->data_path << ": " << strerror(errno);
+        }
+#endif
+        seg->capacity = capacity;
+    } else {
+        std::error_code ec;
+        seg->capacity = std::filesystem::file_size(seg->data_path, ec);
+        if (ec) {
+            return localfs_error(ec, fmt::format("failed to get size of {}", seg->data_path));
+        }
+        // segments of a previous run are never appended to again
+        seg->write_offset = seg->capacity;
+    }
+    *segment = std::move(seg);
+    return Status::OK();
+}
+
+Status LogFileCacheStorage::_append_index_record(const Segment& segment, const FileCacheKey& key,
+                                                 size_t segment_offset, size_t size,
+                                                 const KeyMeta& meta) const {
+    IndexRecord record {.hash_high = key.hash.high(),
+                        .hash_low = key.hash.low(),
+                        .offset = key.offset,
+                        .segment_offset = segment_offset,
+                        .size = size,
+                        .expiration_time = meta.expiration_time,
+                        .type = static_cast<uint8_t>(meta.type)};
+    const char* data = reinterpret_cast<const char*>(&record);
+    size_t remaining = sizeof(record);
+    while (remaining > 0) {
+        ssize_t res;
+        RETRY_ON_EINTR(res, ::write(segment.index_fd, data, remaining));
+        if (res < 0) {
+            return localfs_error(errno, fmt::format("failed to write {}", segment.index_path));
+        }
+        data += res;
+        remaining -= static_cast<size_t>(res);
+    }
+    return Status::OK();
+}
+
+Status LogFileCacheStorage::_replay_index(const SegmentSPtr& segment) {
+    std::ifstream in(segment->index_path, std::ios::binary);
+    if (!in) {
+        return Status::IOError("failed to open {}", segment->index_path);
+    }
+    std::unordered_map<FileWriterMapKey, IndexRecord, FileWriterMapKeyHash> blocks;
+    IndexRecord record;
+    // a torn record at the tail is left out
+    while (in.read(reinterpret_cast<char*>(&record), sizeof(record))) {
+        UInt128Wrapper hash((static_cast<uint128_t>(record.hash_high) << 64) | record.hash_low);
+        auto key = std::make_pair(hash, static_cast<size_t>(record.offset));
+        if (record.size == 0) {
+            blocks.erase(key);
+        } else {
+            blocks[key] = record;
+        }
+    }
+    for (const auto& [key, rec] : blocks) {
+        if (rec.segment_offset + rec.size > segment->capacity) {
+            LOG(WARNING) << "skip block out of segment " << segment->data_path
+                         << ", hash=" << key.first.to_string() << ", offset=" << key.second;
+            continue;
+        }
+        BlockLocation location {.segment = segment,
+                                .segment_offset = rec.segment_offset,
+                                .size = rec.size,
+                                .meta = {.expiration_time = rec.expiration_time,
+                                         .type = static_cast<FileCacheType>(rec.type)}};
+        auto& locations = _index[key.first];
+        // segments are replayed in id order, so a newer copy replaces the older one
+        if (auto it = locations.find(key.second); it != locations.end()) {
+            --it->second.segment->live_blocks;
+            it->second = std::move(location);
+        } else {
+            locations.emplace(key.second, std::move(location));
+        }
+        ++segment->live_blocks;
+    }
+    return Status::OK();
+}
+
+Status LogFileCacheStorage::_load_segments(std::vector<LoadedBlock>* blocks) {
+    std::error_code ec;
+    std::filesystem::create_directories(_log_path, ec);
+    if (ec) {
+        return localfs_error(ec, fmt::format("failed to create {}", _log_path));
+    }
+    std::set<uint64_t> data_ids;
+    std::set<uint64_t> index_ids;
+    for (std::filesystem::directory_iterator it {_log_path, ec};
+         !ec && it != std::filesystem::directory_iterator(); it.increment(ec)) {
+        const auto& path = it->path();
+        uint64_t id = 0;
+        try {
+            id = std::stoull(path.stem().native());
+        } catch (...) {
+            LOG(WARNING) << "unknown file in file cache log storage: " << path.native();
+            continue;
+        }
+        if (path.extension() == ".dat") {
+            data_ids.insert(id);
+        } else if (path.extension() == ".idx") {
+            index_ids.insert(id);
+        }
+    }
+    if (ec) {
+        return localfs_error(ec, fmt::format("failed to list {}", _log_path));
+    }
+    for (uint64_t id : data_ids) {
+        _next_segment_id = std::max(_next_segment_id, id + 1);
+        if (!index_ids.contains(id)) {
+            remove_file_quietly(fmt::format("{}/{}.dat", _log_path, id));
+            continue;
+        }
+        SegmentSPtr segment;
+        RETURN_IF_ERROR(_open_segment(id, 0, false, &segment));
+        RETURN_IF_ERROR(_replay_index(segment));
+        _segments.emplace(id, std::move(segment));
+    }
+    for (uint64_t id : index_ids) {
+        _next_segment_id = std::max(_next_segment_id, id + 1);
+        if (!data_ids.contains(id)) {
+            remove_file_quietly(fmt::format("{}/{}.idx", _log_path, id));
+        }
+    }
+    for (auto it = _segments.begin(); it != _segments.end();) {
+        auto segment = (it++)->second;
+        if (segment->live_blocks == 0) {
+            _drop_segment_unlocked(segment);
+        }
+    }
+    for (const auto& [hash, locations] : _index) {
+        for (const auto& [offset, location] : locations) {
+            blocks->push_back({hash, offset, location.size, location.meta});
+        }
+    }
+    return Status::OK();
+}
+
+Status LogFileCacheStorage::init(BlockFileCache* _mgr) {
+    _log_path = (std::filesystem::path(_mgr->_cache_base_path) / LOG_DIR).native();
+    _pending_mem_tracker = MemTrackerLimiter::create_shared(
+            MemTrackerLimiter::Type::OTHER,
+            fmt::format("LogFileCacheStoragePending:{}", _log_path));
+    std::vector<LoadedBlock> blocks;
+    size_t segment_num = 0;
+    {
+        std::lock_guard wlock(_mtx);
+        RETURN_IF_ERROR(_load_segments(&blocks));
+        segment_num = _segments.size();
+    }
+    LOG_INFO("file cache {} log storage found {} blocks in {} segments", _log_path,
+             blocks.size(), segment_num);
+    _cache_background_load_thread = std::thread([this, mgr = _mgr, blocks = std::move(blocks)]() {
+        auto mem_tracker = MemTrackerLimiter::create_shared(MemTrackerLimiter::Type::OTHER,
+                                                            "LogFileCacheStorageLoader");
+        SCOPED_ATTACH_TASK(mem_tracker);
+        constexpr size_t batch_size = 10000;
+        for (size_t begin = 0; begin < blocks.size(); begin += batch_size) {
+            {
+                SCOPED_CACHE_LOCK(mgr->_mutex, mgr);
+                std::shared_lock rlock(_mtx);
+                for (size_t i = begin; i < std::min(blocks.size(), begin + batch_size); ++i) {
+                    const auto& block = blocks[i];
+                    // skip the blocks removed or loaded lazily in the meantime
+                    const auto* location = _find_unlocked(block.hash, block.offset);
+                    if (location == nullptr || (mgr->_files.contains(block.hash) &&
+                                                mgr->_files[block.hash].contains(block.offset))) {
+                        continue;
+                    }
+                    mgr->add_cell(block.hash, load_context(location->meta), block.offset,
+                                  location->size, FileBlock::State::DOWNLOADED, cache_lock);
+                }
+            }
+            std::this_thread::sleep_for(std::chrono::microseconds(10));
+        }
+        mgr->_async_open_done = true;
+        LOG_INFO("file cache {} lazy load done.", _log_path);
+    });
+    return Status::OK();
+}
+
+Status LogFileCacheStorage::append(const FileCacheKey& key, const Slice& value) {
+    std::lock_guard lock(_pending_mtx);
+    _pending_blocks[std::make_pair(key.hash, key.offset)].append(value.data, value.size);
+    _pending_mem_tracker->consume(value.size);
+    return Status::OK();
+}
+
+Status LogFileCacheStorage::finalize(const FileCacheKey& key) {
+    std::string data;
+    {
+        std::lock_guard lock(_pending_mtx);
+        auto iter = _pending_blocks.find(std::make_pair(key.hash, key.offset));
+        if (iter == _pending_blocks.end()) {
+            DCHECK(false);
+            return Status::InternalError("finalize unknown block, hash={}, offset={}",
+                                         key.hash.to_string(), key.offset);
+        }
+        data = std::move(iter->second);
+        _pending_blocks.erase(iter);
+    }
+    Defer release_pending {[&]() { _pending_mem_tracker->release(data.size()); }};
+    if (data.empty()) {
+        return Status::InternalError("finalize empty block, hash={}, offset={}",
+                                     key.hash.to_string(), key.offset);
+    }
+
+    SegmentSPtr segment;
+    size_t segment_offset = 0;
+    {
+        std::lock_guard wlock(_mtx);
+        if (_active_segment == nullptr ||
+            _active_segment->write_offset + data.size() > _active_segment->capacity) {
+            size_t capacity = std::max(
+                    static_cast<size_t>(config::file_cache_log_segment_size_mb) << 20,
+                    data.size());
+            SegmentSPtr new_segment;
+            RETURN_IF_ERROR(_open_segment(_next_segment_id++, capacity, true, &new_segment));
+            auto sealed = std::exchange(_active_segment, new_segment);
+            _segments.emplace(new_segment->id, std::move(new_segment));
+            if (sealed != nullptr && sealed->live_blocks == 0) {
+                _drop_segment_unlocked(sealed);
+            }
+        }
+        segment = _active_segment;
+        segment_offset = segment->write_offset;
+        segment->write_offset += data.size();
+        // the reserved range keeps the segment alive while it is written
+        ++segment->live_blocks;
+    }
+
+    auto st = pwrite_fully(segment->data_fd, data.data(), data.size(), segment_offset,
+                           segment->data_path);
+    std::lock_guard wlock(_mtx);
+    if (st.ok()) {
+        st = _append_index_record(*segment, key, segment_offset, data.size(), key.meta);
+    }
+    if (!st.ok()) {
+        _release_segment_unlocked(segment);
+        return st;
+    }
+    BlockLocation location {.segment = segment,
+                            .segment_offset = segment_offset,
+                            .size = data.size(),
+                            .meta = key.meta};
+    auto& locations = _index[key.hash];
+    if (auto it = locations.find(key.offset); it != locations.end()) {
+        auto old_segment = std::exchange(it->second, std::move(location)).segment;
+        _release_segment_unlocked(old_segment);
+    } else {
+        locations.emplace(key.offset, std::move(location));
+    }
+    return Status::OK();
+}
+
+Status LogFileCacheStorage::read(const FileCacheKey& key, size_t value_offset, Slice buffer) {
+    SegmentSPtr segment;
+    size_t file_offset = 0;
+    {
+        std::shared_lock rlock(_mtx);
+        const auto* location = _find_unlocked(key.hash, key.offset);
+        if (location == nullptr) {
+            return Status::NotFound("block not found in file cache log storage, hash={}, "
+                                    "offset={}",
+                                    key.hash.to_string(), key.offset);
+        }
+        if (value_offset + buffer.size > location->size) {
+            return Status::InternalError(
+                    "read out of block, hash={}, offset={}, block size={}, read [{}, {})",
+                    key.hash.to_string(), key.offset, location->size, value_offset,
+                    value_offset + buffer.size);
+        }
+        // holding the segment keeps its fd open even if it is reclaimed meanwhile
+        segment = location->segment;
+        file_offset = location->segment_offset + value_offset;
+    }
+    return pread_fully(segment->data_fd, buffer.data, buffer.size, file_offset,
+                       segment->data_path);
+}
+
+Status LogFileCacheStorage::remove(const FileCacheKey& key) {
+    {
+        // a block removed while it is downloaded is never finalized
+        std::lock_guard lock(_pending_mtx);
+        auto iter = _pending_blocks.find(std::make_pair(key.hash, key.offset));
+        if (iter != _pending_blocks.end()) {
+            _pending_mem_tracker->release(iter->second.size());
+            _pending_blocks.erase(iter);
+        }
+    }
+    std::lock_guard wlock(_mtx);
+    auto iter = _index.find(key.hash);
+    if (iter == _index.end()) {
+        return Status::OK();
+    }
+    auto location_iter = iter->second.find(key.offset);
+    if (location_iter == iter->second.end()) {
+        return Status::OK();
+    }
+    auto segment = std::move(location_iter->second.segment);
+    auto st = _append_index_record(*segment, key, 0, 0, location_iter->second.meta);
+    iter->second.erase(location_iter);
+    if (iter->second.empty()) {
+        _index.erase(iter);
+    }
+    _release_segment_unlocked(segment);
+    return st;
+}
+
+Status LogFileCacheStorage::change_key_meta_type(const FileCacheKey& key,
+                                                 const FileCacheType type) {
+    std::lock_guard wlock(_mtx);
+    auto* location = _find_unlocked(key.hash, key.offset);
+    if (location == nullptr) {
+        return Status::NotFound("block not found in file cache log storage, hash={}, offset={}",
+                                key.hash.to_string(), key.offset);
+    }
+    location->meta.type = type;
+    return _append_index_record(*location->segment, key, location->segment_offset,
+                                location->size, location->meta);
+}
+
+Status LogFileCacheStorage::change_key_meta_expiration(const FileCacheKey& key,
+                                                       const uint64_t expiration) {
+    std::lock_guard wlock(_mtx);
+    auto* location = _find_unlocked(key.hash, key.offset);
+    if (location == nullptr) {
+        return Status::NotFound("block not found in file cache log storage, hash={}, offset={}",
+                                key.hash.to_string(), key.offset);
+    }
+    location->meta.expiration_time = expiration;
+    return _append_index_record(*location->segment, key, location->segment_offset,
+                                location->size, location->meta);
+}
+
+void LogFileCacheStorage::load_blocks_directly_unlocked(BlockFileCache* mgr,
+                                                        const FileCacheKey& key,
+                                                        std::lock_guard<std::mutex>& cache_lock) {
+    std::shared_lock rlock(_mtx);
+    auto iter = _index.find(key.hash);
+    if (iter == _index.end()) {
+        return;
+    }
+    for (const auto& [offset, location] : iter->second) {
+        if (mgr->_files.contains(key.hash) && mgr->_files[key.hash].contains(offset)) {
+            continue;
+        }
+        mgr->add_cell(key.hash, load_context(location.meta), offset, location.size,
+                      FileBlock::State::DOWNLOADED, cache_lock);
+    }
+}
+
+Status LogFileCacheStorage::clear(std::string& msg) {
+    LOG(INFO) << "clear file cache log storage, path=" << _log_path;
+    std::lock_guard wlock(_mtx);
+    size_t total = _segments.size();
+    _index.clear();
+    _active_segment.reset();
+    while (!_segments.empty()) {
+        auto segment = _segments.begin()->second;
+        _drop_segment_unlocked(segment);
+    }
+    msg = fmt::format("finished clear file cache log storage, path={} deleted segments={}",
+                      _log_path, total);
+    LOG(INFO) << msg;
+    return Status::OK();
+}
+
+std::string LogFileCacheStorage::get_local_file(const FileCacheKey& key) {
+    std::shared_lock rlock(_mtx);
+    auto* location = _find_unlocked(key.hash, key.offset);
+    if (location == nullptr) {
+        return "";
+    }
+    return fmt::format("{}:{}:{}", location->segment->data_path, location->segment_offset,
+                       location->size);
+}
+
+size_t LogFileCacheStorage::segment_num() const {
+    std::shared_lock rlock(_mtx);
+    return _segments.size();
+}
+
+void LogFileCacheStorage::_release_segment_unlocked(const SegmentSPtr& segment) {
+    DCHECK_GT(segment->live_blocks, 0);
+    if (--segment->live_blocks == 0 && segment != _active_segment) {
+        _drop_segment_unlocked(segment);
+    }
+}
+
+void LogFileCacheStorage::_drop_segment_unlocked(const SegmentSPtr& segment) {
+    _segments.erase(segment->id);
+    remove_file_quietly(segment->data_path);
+    remove_file_quietly(segment->index_path);
+}
+
+LogFileCacheStorage::BlockLocation* LogFileCacheStorage::_find_unlocked(
+        const UInt128Wrapper& hash, size_t offset) {
+    auto iter = _index.find(hash);
+    if (iter == _index.end()) {
+        return nullptr;
+    }
+    auto location_iter = iter->second.find(offset);
+    return location_iter == iter->second.end() ? nullptr : &location_iter->second;
+}
+
+} // namespace doris::io
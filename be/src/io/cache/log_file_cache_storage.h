@@ -0,0 +1,120 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <map>
+#include <memory>
+#include <shared_mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "io/cache/file_cache_common.h"
+#include "io/cache/file_cache_storage.h"
+
+namespace doris {
+class MemTrackerLimiter;
+} // namespace doris
+
+namespace doris::io {
+
+// Packs cached blocks into large preallocated segment files instead of one file per block.
+// Every segment "<id>.dat" has an append-only index "<id>.idx" recording the blocks written
+// into it, their meta changes and their removal, so a restart only replays the indexes.
+// A segment is deleted as a whole once all of its blocks have been removed.
+class LogFileCacheStorage : public FileCacheStorage {
+public:
+    static constexpr const char* LOG_DIR = "log";
+
+    LogFileCacheStorage() = default;
+    ~LogFileCacheStorage() override;
+    Status init(BlockFileCache* _mgr) override;
+    Status append(const FileCacheKey& key, const Slice& value) override;
+    Status finalize(const FileCacheKey& key) override;
+    Status read(const FileCacheKey& key, size_t value_offset, Slice buffer) override;
+    Status remove(const FileCacheKey& key) override;
+    Status change_key_meta_type(const FileCacheKey& key, const FileCacheType type) override;
+    Status change_key_meta_expiration(const FileCacheKey& key, const uint64_t expiration) override;
+    void load_blocks_directly_unlocked(BlockFileCache* _mgr, const FileCacheKey& key,
+                                       std::lock_guard<std::mutex>& cache_lock) override;
+    Status clear(std::string& msg) override;
+    // "<segment data file>:<offset>:<size>" of the block, empty if it is not written yet
+    std::string get_local_file(const FileCacheKey& key) override;
+
+    FileCacheStorageType get_type() override { return LOG_STRUCTURED_DISK; }
+
+    // use for test
+    size_t segment_num() const;
+
+private:
+    struct Segment {
+        ~Segment();
+        uint64_t id = 0;
+        std::string data_path;
+        std::string index_path;
+        int data_fd = -1;
+        int index_fd = -1;
+        // next free byte, only grows for the active segment
+        size_t write_offset = 0;
+        size_t capacity = 0;
+        // blocks stored or being written in this segment
+        size_t live_blocks = 0;
+    };
+    using SegmentSPtr = std::shared_ptr<Segment>;
+
+    struct BlockLocation {
+        SegmentSPtr segment;
+        size_t segment_offset = 0;
+        size_t size = 0;
+        KeyMeta meta;
+    };
+
+    struct LoadedBlock {
+        UInt128Wrapper hash;
+        size_t offset;
+        size_t size;
+        KeyMeta meta;
+    };
+
+    Status _open_segment(uint64_t id, size_t capacity, bool create, SegmentSPtr* segment) const;
+    // size == 0 records the removal of the block
+    Status _append_index_record(const Segment& segment, const FileCacheKey& key,
+                                size_t segment_offset, size_t size, const KeyMeta& meta) const;
+    Status _load_segments(std::vector<LoadedBlock>* blocks);
+    Status _replay_index(const SegmentSPtr& segment);
+    // drop one block reference of segment, delete it when nothing is left
+    void _release_segment_unlocked(const SegmentSPtr& segment);
+    void _drop_segment_unlocked(const SegmentSPtr& segment);
+    BlockLocation* _find_unlocked(const UInt128Wrapper& hash, size_t offset);
+
+    std::string _log_path;
+    std::thread _cache_background_load_thread;
+    mutable std::shared_mutex _mtx;
+    std::unordered_map<UInt128Wrapper, std::map<size_t, BlockLocation>, KeyHash> _index;
+    std::map<uint64_t, SegmentSPtr> _segments;
+    SegmentSPtr _active_segment;
+    uint64_t _next_segment_id = 0;
+    // blocks being downloaded, they are written into a segment on finalize
+    std::mutex _pending_mtx;
+    std::unordered_map<FileWriterMapKey, std::string, FileWriterMapKeyHash> _pending_blocks;
+    // memory of _pending_blocks
+    std::shared_ptr<MemTrackerLimiter> _pending_mem_tracker;
+};
+
+} // namespace doris::io
@@ -17,6 +17,8 @@
 
 #pragma once
 
+#include <bvar/variable.h>
+
 #include "io/file_factory.h"
 #include "io/fs/benchmark/base_benchmark.h"
 #include "io/fs/buffered_reader.h"
@@ -37,6 +39,12 @@ public:
             : BaseBenchmark(name, threads, iterations, file_size, conf_map) {}
     virtual ~S3Benchmark() = default;
 
+    // value of a bvar exposed by S3FileReader, 0 if it is not exposed
+    static int64_t s3_reader_bvar(const std::string& name) {
+        std::string value = bvar::Variable::describe_exposed("s3_file_reader_" + name);
+        return value.empty() ? 0 : std::stoll(value);
+    }
+
     Status get_fs(const std::string& path, std::shared_ptr<io::S3FileSystem>* fs) {
         S3URI s3_uri(path);
         RETURN_IF_ERROR(s3_uri.parse());
@@ -70,7 +78,18 @@ public:
         io::FileReaderOptions reader_opts;
         FileDescription fd;
         RETURN_IF_ERROR(fs->open_file(file_path, &reader, &reader_opts));
-        return read(state, reader);
+        int64_t get_requests = s3_reader_bvar("read_at");
+        int64_t parallel_reads = s3_reader_bvar("parallel_read");
+        int64_t parallel_chunks = s3_reader_bvar("parallel_read_chunks");
+        Status st = read(state, reader);
+        // per request metrics, the ranged GETs of a large read_at are counted one by one
+        state.counters["GetRequests"] =
+                static_cast<double>(s3_reader_bvar("read_at") - get_requests);
+        state.counters["ParallelReads"] =
+                static_cast<double>(s3_reader_bvar("parallel_read") - parallel_reads);
+        state.counters["ParallelReadChunks"] =
+                static_cast<double>(s3_reader_bvar("parallel_read_chunks") - parallel_chunks);
+        return st;
     }
 };
 
@@ -22,6 +22,7 @@
 #include <string.h>
 
 #include <algorithm>
+#include <bit>
 #include <chrono>
 #include <memory>
 
@@ -659,6 +660,8 @@ PrefetchBufferedReader::PrefetchBufferedReader(RuntimeProfile* profile, io::File
                 ADD_CHILD_COUNTER(profile, "RequestIO", TUnit::UNIT, prefetch_buffered_reader);
         auto request_bytes =
                 ADD_CHILD_COUNTER(profile, "RequestBytes", TUnit::BYTES, prefetch_buffered_reader);
+        _bypass_request_io_counter = ADD_CHILD_COUNTER(profile, "BypassRequestIO", TUnit::UNIT,
+                                                       prefetch_buffered_reader);
         sync_buffer = [=](PrefetchBuffer& buf) {
             COUNTER_UPDATE(copy_time, buf._statis.copy_time);
             COUNTER_UPDATE(read_time, buf._statis.read_time);
@@ -693,6 +696,10 @@ Status PrefetchBufferedReader::read_at_impl(size_t offset, Slice result, size_t*
         return Status::OK();
     }
     size_t nbytes = result.get_size();
+    if (_should_bypass_prefetch(offset, nbytes)) {
+        ++_bypass_request_io;
+        return _reader->read_at(offset, result, bytes_read, io_ctx);
+    }
     int actual_bytes_read = 0;
     while (actual_bytes_read < nbytes && offset < size()) {
         size_t read_num = 0;
@@ -707,6 +714,26 @@ Status PrefetchBufferedReader::read_at_impl(size_t offset, Slice result, size_t*
     return Status::OK();
 }
 
+bool PrefetchBufferedReader::_should_bypass_prefetch(size_t offset, size_t len) {
+    // the ranges are planned by the format reader, jumps between them are expected
+    if (!config::enable_adaptive_prefetch ||
+        (_random_access_ranges != nullptr && !_random_access_ranges->empty())) {
+        return false;
+    }
+    bool is_random = offset < _last_read_end ||
+                     offset >= _last_read_end + static_cast<size_t>(s_max_pre_buffer_size);
+    _random_access_history = static_cast<uint8_t>((_random_access_history << 1) | is_random);
+    _last_read_end = offset + len;
+    if (!_bypass_prefetch && std::popcount(_random_access_history) >= 6) {
+        _bypass_prefetch = true;
+    } else if (_bypass_prefetch && (_random_access_history & 0x7) == 0) {
+        // three sequential reads in a row, prefetch from here on
+        _bypass_prefetch = false;
+        reset_all_buffer(offset);
+    }
+    return _bypass_prefetch;
+}
+
 Status PrefetchBufferedReader::close() {
     return _close_internal();
 }
@@ -723,6 +750,9 @@ Status PrefetchBufferedReader::_close_internal() {
 }
 
 void PrefetchBufferedReader::_collect_profile_before_close() {
+    if (_bypass_request_io_counter != nullptr) {
+        COUNTER_UPDATE(_bypass_request_io_counter, _bypass_request_io);
+    }
     std::for_each(_pre_buffers.begin(), _pre_buffers.end(),
                   [](std::shared_ptr<PrefetchBuffer>& buffer) {
                       buffer->collect_profile_before_close();
@@ -514,6 +514,10 @@ constexpr int64_t s_max_pre_buffer_size = 4 * 1024 * 1024; // 4MB
  * When random_access_ranges is not empty:
  * The data is prefetched order by the random_access_ranges. If some adjacent ranges is small, the underlying reader
  * will merge them.
+ *
+ * Without random_access_ranges the access pattern is tracked over the latest reads. Forward skips
+ * shorter than a buffer (strided reads) still count as sequential. Once most of them are random,
+ * reads bypass the buffers so that nothing more is prefetched, until reads become sequential again.
  */
 class PrefetchBufferedReader final : public io::FileReader {
 public:
@@ -545,6 +549,8 @@ protected:
 
 private:
     Status _close_internal();
+    // record the access and return whether the read should bypass the prefetch buffers
+    bool _should_bypass_prefetch(size_t offset, size_t len);
     size_t get_buffer_pos(int64_t position) const {
         return (position % _whole_pre_buffer_size) / s_max_pre_buffer_size;
     }
@@ -569,6 +575,13 @@ private:
     bool _initialized = false;
     bool _closed = false;
     size_t _size;
+
+    // bit i is set if the i-th latest read was random
+    uint8_t _random_access_history = 0;
+    size_t _last_read_end = 0;
+    bool _bypass_prefetch = false;
+    int64_t _bypass_request_io = 0;
+    RuntimeProfile::Counter* _bypass_request_io_counter = nullptr;
 };
 
 /**
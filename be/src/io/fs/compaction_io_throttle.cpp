@@ -0,0 +1,135 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "io/fs/compaction_io_throttle.h"
+
+#include <bvar/bvar.h>
+
+#include <algorithm>
+#include <mutex>
+
+#include "common/config.h"
+#include "runtime/workload_management/io_throttle.h"
+#include "util/time.h"
+
+namespace doris::io {
+
+bvar::LatencyRecorder g_local_query_read_latency("local_file_reader", "query_read");
+
+thread_local ReaderType CompactionIOThrottle::current_compaction_type = ReaderType::UNKNOWN;
+
+CompactionIOThrottle* CompactionIOThrottle::instance() {
+    static CompactionIOThrottle throttle;
+    return &throttle;
+}
+
+void CompactionIOThrottle::record_query_read_latency(int64_t latency_us) {
+    g_local_query_read_latency << latency_us;
+}
+
+int64_t CompactionIOThrottle::_configured_bytes_per_second(int slot) {
+    int64_t mbytes = -1;
+    switch (slot) {
+    case BASE_READ:
+        mbytes = config::base_compaction_read_mbytes_per_sec_per_disk;
+        break;
+    case BASE_WRITE:
+        mbytes = config::base_compaction_write_mbytes_per_sec_per_disk;
+        break;
+    case CUMU_READ:
+        mbytes = config::cumu_compaction_read_mbytes_per_sec_per_disk;
+        break;
+    case CUMU_WRITE:
+        mbytes = config::cumu_compaction_write_mbytes_per_sec_per_disk;
+        break;
+    default:
+        break;
+    }
+    return mbytes > 0 ? mbytes * 1024 * 1024 : -1;
+}
+
+double CompactionIOThrottle::_query_latency_ratio() {
+    int64_t target_us = config::compaction_io_throttle_query_read_latency_us;
+    int64_t latency_us = g_local_query_read_latency.latency();
+    if (target_us <= 0 || latency_us <= target_us) {
+        return 1;
+    }
+    // never go below a tenth of the configured limit, so compaction keeps making progress
+    return std::max(static_cast<double>(target_us) / static_cast<double>(latency_us), 0.1);
+}
+
+void CompactionIOThrottle::_refresh_limits(Throttles& throttles, double ratio) {
+    for (int slot = 0; slot < NUM_SLOTS; ++slot) {
+        int64_t limit = _configured_bytes_per_second(slot);
+        if (limit > 0) {
+            limit = std::max<int64_t>(static_cast<int64_t>(static_cast<double>(limit) * ratio), 1);
+        }
+        throttles[slot]->set_io_bytes_per_second(limit);
+    }
+}
+
+IOThrottle* CompactionIOThrottle::get(const std::string& data_dir, bool is_write) {
+    int slot = 0;
+    switch (current_compaction_type) {
+    case ReaderType::READER_BASE_COMPACTION:
+    case ReaderType::READER_FULL_COMPACTION:
+        slot = is_write ? BASE_WRITE : BASE_READ;
+        break;
+    case ReaderType::READER_CUMULATIVE_COMPACTION:
+    case ReaderType::READER_SEGMENT_COMPACTION:
+    case ReaderType::READER_COLD_DATA_COMPACTION:
+        slot = is_write ? CUMU_WRITE : CUMU_READ;
+        break;
+    default:
+        return nullptr;
+    }
+    if (_configured_bytes_per_second(slot) <= 0) {
+        return nullptr;
+    }
+
+    // re-derive the limits at most once per second, configs are mutable
+    int64_t now_ms = MonotonicMillis();
+    int64_t last_ms = _last_refresh_ms.load(std::memory_order_relaxed);
+    if (now_ms - last_ms >= 1000 && _last_refresh_ms.compare_exchange_strong(last_ms, now_ms)) {
+        double ratio = _query_latency_ratio();
+        std::unique_lock wlock(_lock);
+        for (auto& [_, throttles] : _throttles) {
+            _refresh_limits(*throttles, ratio);
+        }
+        _ratio = ratio;
+    }
+
+    {
+        std::shared_lock rlock(_lock);
+        auto it = _throttles.find(data_dir);
+        if (it != _throttles.end()) {
+            return (*it->second)[slot].get();
+        }
+    }
+    std::unique_lock wlock(_lock);
+    auto& throttles = _throttles[data_dir];
+    if (throttles == nullptr) {
+        throttles = std::make_unique<Throttles>();
+        for (auto& throttle : *throttles) {
+            throttle = std::make_unique<IOThrottle>();
+        }
+        _refresh_limits(*throttles, _ratio);
+    }
+    return (*throttles)[slot].get();
+}
+
+} // namespace doris::io
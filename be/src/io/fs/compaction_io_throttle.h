@@ -0,0 +1,83 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <memory>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+
+#include "io/io_common.h"
+
+namespace doris {
+class IOThrottle;
+
+namespace io {
+
+// Limits the local disk throughput of compaction, per data dir, per compaction kind and per
+// direction. A compaction thread marks itself with `ScopedCompactionIO`; local file reads and
+// writes done on that thread then go through the matching throttle.
+//
+// The limits come from the `*_compaction_{read,write}_mbytes_per_sec_per_disk` configs and are
+// scaled down while local query reads are slower than
+// `compaction_io_throttle_query_read_latency_us`.
+class CompactionIOThrottle {
+public:
+    static CompactionIOThrottle* instance();
+
+    // Return the throttle of the current thread's compaction on `data_dir`, or nullptr when the
+    // thread is not compacting or its kind is unlimited.
+    IOThrottle* get(const std::string& data_dir, bool is_write);
+
+    // Feed the latency of a foreground local read.
+    static void record_query_read_latency(int64_t latency_us);
+
+    // Compaction kind of the current thread, set by `ScopedCompactionIO`.
+    static thread_local ReaderType current_compaction_type;
+
+private:
+    enum Slot { BASE_READ = 0, BASE_WRITE, CUMU_READ, CUMU_WRITE, NUM_SLOTS };
+    using Throttles = std::array<std::unique_ptr<IOThrottle>, NUM_SLOTS>;
+
+    static int64_t _configured_bytes_per_second(int slot);
+    void _refresh_limits(Throttles& throttles, double ratio);
+    double _query_latency_ratio();
+
+    std::shared_mutex _lock;
+    std::unordered_map<std::string, std::unique_ptr<Throttles>> _throttles;
+    // scale of the configured limits, derived from the query read latency; guarded by `_lock`
+    double _ratio = 1;
+    std::atomic<int64_t> _last_refresh_ms {0};
+};
+
+class ScopedCompactionIO {
+public:
+    explicit ScopedCompactionIO(ReaderType type)
+            : _prev(CompactionIOThrottle::current_compaction_type) {
+        CompactionIOThrottle::current_compaction_type = type;
+    }
+    ~ScopedCompactionIO() { CompactionIOThrottle::current_compaction_type = _prev; }
+
+private:
+    ReaderType _prev;
+};
+
+} // namespace io
+} // namespace doris
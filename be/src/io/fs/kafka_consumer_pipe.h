@@ -42,6 +42,16 @@ public:
     virtual Status append_json(const char* data, size_t size) {
         return append_and_flush(data, size);
     }
+
+    // same as above, but `data` is queued by reference and `owner` keeps it alive
+    Status append_with_line_delimiter(char* data, size_t size, std::shared_ptr<void> owner) {
+        RETURN_IF_ERROR(append_by_reference(data, size, std::move(owner)));
+        return append("\n", 1);
+    }
+
+    Status append_json(char* data, size_t size, std::shared_ptr<void> owner) {
+        return append_by_reference(data, size, std::move(owner));
+    }
 };
 } // namespace io
 } // end namespace doris
@@ -33,6 +33,7 @@
 
 #include "common/compiler_util.h" // IWYU pragma: keep
 #include "cpp/sync_point.h"
+#include "io/fs/compaction_io_throttle.h"
 #include "io/fs/err_utils.h"
 #include "olap/data_dir.h"
 #include "olap/olap_common.h"
@@ -42,6 +43,7 @@
 #include "util/async_io.h"
 #include "util/debug_points.h"
 #include "util/doris_metrics.h"
+#include "util/time.h"
 
 namespace doris {
 namespace io {
@@ -125,7 +127,7 @@ Status LocalFileReader::close() {
 }
 
 Status LocalFileReader::read_at_impl(size_t offset, Slice result, size_t* bytes_read,
-                                     const IOContext* /*io_ctx*/) {
+                                     const IOContext* io_ctx) {
     TEST_SYNC_POINT_RETURN_WITH_VALUE("LocalFileReader::read_at_impl",
                                       Status::IOError("inject io error"));
     if (closed()) [[unlikely]] {
@@ -144,6 +146,13 @@ Status LocalFileReader::read_at_impl(size_t offset, Slice result, size_t* bytes_
 
     LIMIT_LOCAL_SCAN_IO(get_data_dir_path(), bytes_read);
 
+    IOThrottle* compaction_iot = CompactionIOThrottle::instance()->get(get_data_dir_path(), false);
+    if (compaction_iot != nullptr) {
+        compaction_iot->acquire(-1);
+    }
+    bool is_query = io_ctx != nullptr && io_ctx->reader_type == ReaderType::READER_QUERY;
+    int64_t start_us = is_query ? MonotonicMicros() : 0;
+
     while (bytes_req != 0) {
         auto res = SYNC_POINT_HOOK_RETURN_VALUE(::pread(_fd, to, bytes_req, offset),
                                                 "LocalFileReader::pread", _fd, to);
@@ -169,6 +178,12 @@ Status LocalFileReader::read_at_impl(size_t offset, Slice result, size_t* bytes_
             *bytes_read += res;
         }
     }
+    if (compaction_iot != nullptr) {
+        compaction_iot->update_next_io_time(*bytes_read);
+    }
+    if (is_query) {
+        CompactionIOThrottle::record_query_read_latency(MonotonicMicros() - start_us);
+    }
     DorisMetrics::instance()->local_bytes_read_total->increment(*bytes_read);
     return Status::OK();
 }
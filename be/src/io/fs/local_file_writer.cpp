@@ -35,11 +35,14 @@
 #include "common/macros.h"
 #include "common/status.h"
 #include "cpp/sync_point.h"
+#include "io/fs/compaction_io_throttle.h"
 #include "io/fs/err_utils.h"
 #include "io/fs/file_writer.h"
+#include "io/fs/local_file_reader.h"
 #include "io/fs/local_file_system.h"
 #include "io/fs/path.h"
 #include "olap/data_dir.h"
+#include "runtime/workload_management/io_throttle.h"
 #include "util/debug_points.h"
 #include "util/doris_metrics.h"
 
@@ -139,6 +142,17 @@ Status LocalFileWriter::appendv(const Slice* data, size_t data_cnt) {
         iov[i] = {result.data, result.size};
     }
 
+    IOThrottle* compaction_iot = nullptr;
+    if (CompactionIOThrottle::current_compaction_type != ReaderType::UNKNOWN) {
+        if (_data_dir_path.empty()) {
+            BeConfDataDirReader::get_data_dir_by_file_path(&_path, &_data_dir_path);
+        }
+        compaction_iot = CompactionIOThrottle::instance()->get(_data_dir_path, true);
+    }
+    if (compaction_iot != nullptr) {
+        compaction_iot->acquire(-1);
+    }
+
     size_t completed_iov = 0;
     size_t n_left = bytes_req;
     while (n_left > 0) {
@@ -184,6 +198,9 @@ Status LocalFileWriter::appendv(const Slice* data, size_t data_cnt) {
         n_left -= res;
     }
     DCHECK_EQ(0, n_left);
+    if (compaction_iot != nullptr) {
+        compaction_iot->update_next_io_time(static_cast<int64_t>(bytes_req));
+    }
     _bytes_appended += bytes_req;
     return Status::OK();
 }
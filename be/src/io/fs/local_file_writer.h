@@ -18,6 +18,7 @@
 #pragma once
 
 #include <cstddef>
+#include <string>
 
 #include "common/status.h"
 #include "io/fs/file_writer.h"
@@ -46,6 +47,8 @@ private:
     Status _close(bool sync);
 
     Path _path;
+    // be.conf data dir of `_path`, resolved on the first write done by a compaction
+    std::string _data_dir_path;
     int _fd; // owned
     bool _dirty = false;
     const bool _sync_data = true;
@@ -30,18 +30,22 @@
 
 #include <algorithm>
 #include <utility>
+#include <vector>
 
 #include "common/compiler_util.h" // IWYU pragma: keep
 #include "io/fs/err_utils.h"
 #include "io/fs/obj_storage_client.h"
 #include "io/fs/s3_common.h"
+#include "runtime/exec_env.h"
 #include "runtime/thread_context.h"
 #include "runtime/workload_management/io_throttle.h"
 #include "util/bvar_helper.h"
+#include "util/countdown_latch.h"
 #include "util/debug_points.h"
 #include "util/doris_metrics.h"
 #include "util/runtime_profile.h"
 #include "util/s3_util.h"
+#include "util/threadpool.h"
 
 namespace doris::io {
 
@@ -51,6 +55,8 @@ bvar::Adder<uint64_t> s3_bytes_read_total("s3_file_reader", "bytes_read");
 bvar::Adder<uint64_t> s3_file_being_read("s3_file_reader", "file_being_read");
 bvar::Adder<uint64_t> s3_file_reader_too_many_request_counter("s3_file_reader", "too_many_request");
 bvar::LatencyRecorder s3_bytes_per_read("s3_file_reader", "bytes_per_read"); // also QPS
+bvar::Adder<uint64_t> s3_parallel_read_counter("s3_file_reader", "parallel_read");
+bvar::Adder<uint64_t> s3_parallel_read_chunks("s3_file_reader", "parallel_read_chunks");
 bvar::PerSecond<bvar::Adder<uint64_t>> s3_read_througthput("s3_file_reader", "s3_read_throughput",
                                                            &s3_bytes_read_total);
 // Although we can get QPS from s3_bytes_per_read, but s3_bytes_per_read only
@@ -124,11 +130,6 @@ Status S3FileReader::read_at_impl(size_t offset, Slice result, size_t* bytes_rea
         return Status::InternalError("init s3 client error");
     }
 
-    int retry_count = 0;
-    const int base_wait_time = config::s3_read_base_wait_time_ms; // Base wait time in milliseconds
-    const int max_wait_time = config::s3_read_max_wait_time_ms; // Maximum wait time in milliseconds
-    const int max_retries = config::max_s3_client_retry; // wait 1s, 2s, 4s, 8s for each backoff
-
     LIMIT_REMOTE_SCAN_IO(bytes_read);
 
     DBUG_EXECUTE_IF("S3FileReader::read_at_impl.io_slow", {
@@ -139,15 +140,77 @@ Status S3FileReader::read_at_impl(size_t offset, Slice result, size_t* bytes_rea
         std::this_thread::sleep_for(std::chrono::seconds(sleep_time));
     });
 
+    auto chunk_size = static_cast<size_t>(config::s3_parallel_read_chunk_size_mb) * 1024 * 1024;
+    auto* pool = ExecEnv::GetInstance()->s3_parallel_read_thread_pool();
+    if (pool != nullptr && chunk_size > 0 && config::s3_parallel_read_max_concurrency > 1 &&
+        bytes_req >= 2 * chunk_size) {
+        return _parallel_get_object(*client, pool, offset, to, bytes_req, chunk_size, bytes_read);
+    }
+    return _get_object(*client, offset, to, bytes_req, bytes_read, _s3_stats);
+}
+
+Status S3FileReader::_parallel_get_object(ObjStorageClient& client, ThreadPool* pool,
+                                          size_t offset, char* to, size_t bytes_req,
+                                          size_t chunk_size, size_t* bytes_read) {
+    size_t num_chunks =
+            std::min(static_cast<size_t>(config::s3_parallel_read_max_concurrency),
+                     (bytes_req + chunk_size - 1) / chunk_size);
+    // split evenly so that all the requests finish at about the same time
+    size_t piece = (bytes_req + num_chunks - 1) / num_chunks;
+    std::vector<Status> statuses(num_chunks);
+    std::vector<size_t> chunk_bytes_read(num_chunks, 0);
+    std::vector<S3Statistics> chunk_stats(num_chunks);
+    auto read_chunk = [&](size_t i) {
+        size_t chunk_offset = i * piece;
+        size_t len = std::min(piece, bytes_req - chunk_offset);
+        statuses[i] = _get_object(client, offset + chunk_offset, to + chunk_offset, len,
+                                  &chunk_bytes_read[i], chunk_stats[i]);
+    };
+    CountDownLatch latch(static_cast<int>(num_chunks - 1));
+    // the caller thread reads the last chunk itself
+    for (size_t i = 0; i + 1 < num_chunks; ++i) {
+        Status st = pool->submit_func([&, i]() {
+            read_chunk(i);
+            latch.count_down();
+        });
+        if (!st.ok()) {
+            read_chunk(i);
+            latch.count_down();
+        }
+    }
+    read_chunk(num_chunks - 1);
+    latch.wait();
+    s3_parallel_read_counter << 1;
+    s3_parallel_read_chunks << num_chunks;
+
+    *bytes_read = 0;
+    for (size_t i = 0; i < num_chunks; ++i) {
+        _s3_stats.total_get_request_counter += chunk_stats[i].total_get_request_counter;
+        _s3_stats.too_many_request_err_counter += chunk_stats[i].too_many_request_err_counter;
+        _s3_stats.too_many_request_sleep_time_ms += chunk_stats[i].too_many_request_sleep_time_ms;
+        _s3_stats.total_bytes_read += chunk_stats[i].total_bytes_read;
+        RETURN_IF_ERROR(statuses[i]);
+        *bytes_read += chunk_bytes_read[i];
+    }
+    return Status::OK();
+}
+
+Status S3FileReader::_get_object(ObjStorageClient& client, size_t offset, char* to,
+                                 size_t bytes_req, size_t* bytes_read, S3Statistics& stats) {
+    int retry_count = 0;
+    const int base_wait_time = config::s3_read_base_wait_time_ms; // Base wait time in milliseconds
+    const int max_wait_time = config::s3_read_max_wait_time_ms; // Maximum wait time in milliseconds
+    const int max_retries = config::max_s3_client_retry; // wait 1s, 2s, 4s, 8s for each backoff
+
     int total_sleep_time = 0;
     while (retry_count <= max_retries) {
         *bytes_read = 0;
         s3_file_reader_read_counter << 1;
         // clang-format off
-        auto resp = client->get_object( { .bucket = _bucket, .key = _key, },
+        auto resp = client.get_object( { .bucket = _bucket, .key = _key, },
                 to, offset, bytes_req, bytes_read);
         // clang-format on
-        _s3_stats.total_get_request_counter++;
+        stats.total_get_request_counter++;
         if (resp.status.code != ErrorCode::OK) {
             if (resp.http_code ==
                 static_cast<int>(Aws::Http::HttpResponseCode::TOO_MANY_REQUESTS)) {
@@ -156,8 +219,8 @@ Status S3FileReader::read_at_impl(size_t offset, Slice result, size_t* bytes_rea
                 int wait_time = std::min(base_wait_time * (1 << retry_count),
                                          max_wait_time); // Exponential backoff
                 std::this_thread::sleep_for(std::chrono::milliseconds(wait_time));
-                _s3_stats.too_many_request_err_counter++;
-                _s3_stats.too_many_request_sleep_time_ms += wait_time;
+                stats.too_many_request_err_counter++;
+                stats.too_many_request_sleep_time_ms += wait_time;
                 total_sleep_time += wait_time;
                 continue;
             } else {
@@ -174,7 +237,7 @@ Status S3FileReader::read_at_impl(size_t offset, Slice result, size_t* bytes_rea
             LOG(WARNING) << msg;
             return Status::InternalError(msg);
         }
-        _s3_stats.total_bytes_read += bytes_req;
+        stats.total_bytes_read += bytes_req;
         s3_bytes_read_total << bytes_req;
         s3_bytes_per_read << bytes_req;
         DorisMetrics::instance()->s3_bytes_read_total->increment(bytes_req);
@@ -30,9 +30,11 @@
 
 namespace doris {
 class RuntimeProfile;
+class ThreadPool;
 
 namespace io {
 struct IOContext;
+class ObjStorageClient;
 
 class S3FileReader final : public FileReader {
 public:
@@ -66,6 +68,14 @@ private:
         int64_t too_many_request_sleep_time_ms = 0;
         int64_t total_bytes_read = 0;
     };
+    // one ranged GET with retries on throttling
+    Status _get_object(ObjStorageClient& client, size_t offset, char* to, size_t bytes_req,
+                       size_t* bytes_read, S3Statistics& stats);
+    // split a large read into concurrent ranged GETs
+    Status _parallel_get_object(ObjStorageClient& client, ThreadPool* pool, size_t offset,
+                                char* to, size_t bytes_req, size_t chunk_size,
+                                size_t* bytes_read);
+
     Path _path;
     size_t _file_size;
 
@@ -176,9 +176,25 @@ bool S3FileWriter::_complete_part_task_callback(Status s) {
     return ret;
 }
 
+size_t S3FileWriter::_part_size(int part_num) const {
+    // A part is buffered in memory before it is uploaded, so stay far below the 5GB S3 limit.
+    static constexpr size_t MAX_PART_SIZE = 256UL * 1024 * 1024;
+    if (_part_size_double_interval <= 0) {
+        return _base_part_size;
+    }
+    size_t size = _base_part_size;
+    for (int64_t n = (part_num - 1) / _part_size_double_interval; n > 0 && size < MAX_PART_SIZE;
+         --n) {
+        size *= 2;
+    }
+    return std::min(size, std::max(MAX_PART_SIZE, _base_part_size));
+}
+
 Status S3FileWriter::_build_upload_buffer() {
+    size_t part_size = _part_size(_cur_part_num);
     auto builder = FileBufferBuilder();
     builder.set_type(BufferType::UPLOAD)
+            .set_capacity(part_size)
             .set_upload_callback([part_num = _cur_part_num, this](UploadFileBuffer& buf) {
                 _upload_one_part(part_num, buf);
             })
@@ -193,8 +209,9 @@ Status S3FileWriter::_build_upload_buffer() {
         // try to do writing into file cache, so we make the lambda capture the variable
         // we need by value to extend their lifetime
         builder.set_allocate_file_blocks_holder(
-                [builder = *_cache_builder, offset = _bytes_appended]() -> FileBlocksHolderPtr {
-                    return builder.allocate_cache_holder(offset, config::s3_write_buffer_size);
+                [builder = *_cache_builder, offset = _bytes_appended,
+                 part_size]() -> FileBlocksHolderPtr {
+                    return builder.allocate_cache_holder(offset, part_size);
                 });
     }
     RETURN_IF_ERROR(builder.build(&_pending_buf));
@@ -240,7 +257,6 @@ Status S3FileWriter::appendv(const Slice* data, size_t data_cnt) {
                                      _obj_storage_path_opts.path.native());
     }
 
-    size_t buffer_size = config::s3_write_buffer_size;
     TEST_SYNC_POINT_RETURN_WITH_VALUE("s3_file_writer::appenv", Status());
     for (size_t i = 0; i < data_cnt; i++) {
         size_t data_size = data[i].get_size();
@@ -251,6 +267,7 @@ Status S3FileWriter::appendv(const Slice* data, size_t data_cnt) {
             if (!_pending_buf) {
                 RETURN_IF_ERROR(_build_upload_buffer());
             }
+            size_t buffer_size = _pending_buf->get_capacaticy();
             // we need to make sure all parts except the last one to be 5MB or more
             // and shouldn't be larger than buf
             data_size_to_append = std::min(data_size - pos, _pending_buf->get_file_offset() +
@@ -387,13 +404,16 @@ Status S3FileWriter::_complete() {
     }
 
     // check number of parts
-    int64_t expected_num_parts1 = (_bytes_appended / config::s3_write_buffer_size) +
-                                  !!(_bytes_appended % config::s3_write_buffer_size);
+    int64_t expected_num_parts1 = 0;
+    size_t full_parts_bytes = 0;
+    while (full_parts_bytes < _bytes_appended) {
+        full_parts_bytes += _part_size(static_cast<int>(++expected_num_parts1));
+    }
     int64_t expected_num_parts2 =
-            (_bytes_appended % config::s3_write_buffer_size) ? _cur_part_num : _cur_part_num - 1;
+            (full_parts_bytes != _bytes_appended) ? _cur_part_num : _cur_part_num - 1;
     DCHECK_EQ(expected_num_parts1, expected_num_parts2)
             << " bytes_appended=" << _bytes_appended << " cur_part_num=" << _cur_part_num
-            << " s3_write_buffer_size=" << config::s3_write_buffer_size;
+            << " s3_write_buffer_size=" << _base_part_size;
     if (_failed || _completed_parts.size() != static_cast<size_t>(expected_num_parts1) ||
         expected_num_parts1 != expected_num_parts2) {
         _st = Status::InternalError(
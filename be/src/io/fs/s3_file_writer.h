@@ -23,6 +23,7 @@
 #include <memory>
 #include <string>
 
+#include "common/config.h"
 #include "common/status.h"
 #include "io/fs/file_system.h"
 #include "io/fs/file_writer.h"
@@ -86,6 +87,8 @@ private:
     void _upload_one_part(int part_num, UploadFileBuffer& buf);
     bool _complete_part_task_callback(Status s);
     Status _build_upload_buffer();
+    // Size of the given part, grows with part_num to keep the number of parts bounded
+    size_t _part_size(int part_num) const;
 
     ObjectStoragePathOptions _obj_storage_path_opts;
 
@@ -117,6 +120,9 @@ private:
     std::unique_ptr<AsyncCloseStatusPack> _async_close_pack;
     State _state {State::OPENED};
     std::shared_ptr<ObjClientHolder> _obj_client;
+    // Snapshot of the part size configs, they must not change during one upload
+    const size_t _base_part_size = static_cast<size_t>(config::s3_write_buffer_size);
+    const int64_t _part_size_double_interval = config::s3_write_part_size_double_interval;
 };
 
 } // namespace io
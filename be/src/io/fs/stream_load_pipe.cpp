@@ -138,10 +138,7 @@ Status StreamLoadPipe::append(const char* data, size_t size) {
         } else {
             pos = _write_buf->remaining();
             _write_buf->put_bytes(data, pos);
-
-            _write_buf->flip();
-            RETURN_IF_ERROR(_append(_write_buf));
-            _write_buf.reset();
+            RETURN_IF_ERROR(_flush_write_buf());
         }
     }
     // need to allocate a new chunk, min chunk is 64k
@@ -154,10 +151,34 @@ Status StreamLoadPipe::append(const char* data, size_t size) {
 }
 
 Status StreamLoadPipe::append(const ByteBufferPtr& buf) {
-    if (_write_buf != nullptr) {
-        _write_buf->flip();
-        RETURN_IF_ERROR(_append(_write_buf));
-        _write_buf.reset();
+    RETURN_IF_ERROR(_flush_write_buf());
+    return _append(buf);
+}
+
+Status StreamLoadPipe::append_by_reference(char* data, size_t size, std::shared_ptr<void> owner) {
+    if (_write_buf != nullptr && _write_buf->pos > _write_buf_queued) {
+        // Queue the pending bytes as a slice of the chunk and keep filling the rest of it, so the
+        // small appends between referenced buffers (e.g. line delimiters) share one chunk.
+        RETURN_IF_ERROR(_append(ByteBuffer::wrap(_write_buf->ptr + _write_buf_queued,
+                                                 _write_buf->pos - _write_buf_queued,
+                                                 _write_buf)));
+        _write_buf_queued = _write_buf->pos;
+    }
+    return _append(ByteBuffer::wrap(data, size, std::move(owner),
+                                    ExecEnv::GetInstance()->stream_load_pipe_tracker()));
+}
+
+Status StreamLoadPipe::_flush_write_buf() {
+    if (_write_buf == nullptr) {
+        return Status::OK();
+    }
+    _write_buf->flip();
+    // the front of the chunk is already queued by append_by_reference
+    _write_buf->pos = _write_buf_queued;
+    _write_buf_queued = 0;
+    auto buf = std::move(_write_buf);
+    if (!buf->has_remaining()) {
+        return Status::OK();
     }
     return _append(buf);
 }
@@ -227,11 +248,7 @@ Status StreamLoadPipe::_append(const ByteBufferPtr& buf, size_t proto_byte_size)
 
 // called when producer finished
 Status StreamLoadPipe::finish() {
-    if (_write_buf != nullptr) {
-        _write_buf->flip();
-        RETURN_IF_ERROR(_append(_write_buf));
-        _write_buf.reset();
-    }
+    RETURN_IF_ERROR(_flush_write_buf());
     {
         std::lock_guard<std::mutex> l(_lock);
         _finished = true;
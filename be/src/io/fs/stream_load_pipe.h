@@ -53,6 +53,9 @@ public:
     Status append(std::unique_ptr<PDataRow>&& row);
     Status append(const char* data, size_t size) override;
     Status append(const ByteBufferPtr& buf) override;
+    // queue `size` bytes at `data` without copying them, `owner` keeps the memory alive until
+    // the reader has consumed it
+    Status append_by_reference(char* data, size_t size, std::shared_ptr<void> owner);
 
     const Path& path() const override { return _path; }
 
@@ -100,6 +103,8 @@ private:
     Status _read_next_buffer(std::unique_ptr<uint8_t[]>* data, size_t* length);
 
     Status _append(const ByteBufferPtr& buf, size_t proto_byte_size = 0);
+    // queue the unqueued bytes of _write_buf and release it
+    Status _flush_write_buf();
 
     // Blocking queue
     std::mutex _lock;
@@ -122,6 +127,8 @@ private:
     std::condition_variable _get_cond;
 
     ByteBufferPtr _write_buf;
+    // bytes at the front of _write_buf already queued as a slice of it by append_by_reference
+    size_t _write_buf_queued = 0;
 
     // no use, only for compatibility with the `Path` interface
     Path _path = "";
@@ -22,6 +22,7 @@
 #include <rapidjson/prettywriter.h>
 
 #include <algorithm>
+#include <cmath>
 #include <cstdint>
 #include <iterator>
 #include <random>
@@ -71,6 +72,8 @@ bvar::Adder<uint64_t> g_tablet_pk_not_found("doris_pk", "lookup_not_found");
 bvar::PerSecond<bvar::Adder<uint64_t>> g_tablet_pk_not_found_per_second(
         "doris_pk", "lookup_not_found_per_second", &g_tablet_pk_not_found, 60);
 bvar::LatencyRecorder g_tablet_update_delete_bitmap_latency("doris_pk", "update_delete_bitmap");
+bvar::LatencyRecorder g_tablet_calc_segment_delete_bitmap_latency("doris_pk",
+                                                                  "calc_segment_delete_bitmap");
 
 static bvar::Adder<size_t> g_total_tablet_num("doris_total_tablet_num");
 
@@ -146,6 +149,20 @@ BaseTablet::~BaseTablet() {
     g_total_tablet_num << -1;
 }
 
+double BaseTablet::query_heat(int64_t now_ms) {
+    std::lock_guard lock(_query_heat_lock);
+    int64_t scan_count = query_scan_count->value();
+    if (_query_heat_update_ms > 0 && now_ms > _query_heat_update_ms) {
+        double half_life_ms = std::max(config::compaction_read_heat_half_life_sec, 1) * 1000.0;
+        _query_heat *= std::exp2(-static_cast<double>(now_ms - _query_heat_update_ms) /
+                                 half_life_ms);
+    }
+    _query_heat += static_cast<double>(scan_count - _query_heat_scan_count);
+    _query_heat_scan_count = scan_count;
+    _query_heat_update_ms = now_ms;
+    return _query_heat;
+}
+
 TabletSchemaSPtr BaseTablet::tablet_schema_with_merged_max_schema_version(
         const std::vector<RowsetMetaSharedPtr>& rowset_metas) {
     RowsetMetaSharedPtr max_schema_version_rs = *std::max_element(
@@ -460,6 +477,52 @@ Status BaseTablet::lookup_row_data(const Slice& encoded_key, const RowLocation&
     return Status::OK();
 }
 
+Status BaseTablet::lookup_row_data_batch(const RowsetSharedPtr& rowset, uint32_t segment_id,
+                                         const std::vector<segment_v2::rowid_t>& row_ids,
+                                         OlapReaderStatistics& stats,
+                                         vectorized::MutableColumnPtr& values) {
+    DCHECK(std::is_sorted(row_ids.begin(), row_ids.end()));
+    BetaRowsetSharedPtr beta_rowset = std::static_pointer_cast<BetaRowset>(rowset);
+    CHECK(beta_rowset);
+    const TabletSchemaSPtr tablet_schema = beta_rowset->tablet_schema();
+    SegmentCacheHandle segment_cache_handle;
+    std::unique_ptr<segment_v2::ColumnIterator> column_iterator;
+    const auto& column = *DORIS_TRY(tablet_schema->column(BeConsts::ROW_STORE_COL));
+    RETURN_IF_ERROR(_get_segment_column_iterator(beta_rowset, segment_id, column,
+                                                 &segment_cache_handle, &column_iterator, &stats));
+    values = vectorized::ColumnString::create();
+    RETURN_IF_ERROR(column_iterator->read_by_rowids(row_ids.data(), row_ids.size(), values));
+    DCHECK_EQ(values->size(), row_ids.size());
+    return Status::OK();
+}
+
+std::vector<RowsetSharedPtr> BaseTablet::_rowsets_may_overlap(
+        const std::vector<RowsetSharedPtr>& rowsets, Slice min_key, Slice max_key) {
+    std::vector<RowsetSharedPtr> result;
+    result.reserve(rowsets.size());
+    for (const auto& rs : rowsets) {
+        const auto& segments_key_bounds = rs->rowset_meta()->get_segments_key_bounds();
+        bool truncated = rs->rowset_meta()->is_segments_key_bounds_truncated();
+        if (segments_key_bounds.size() != rs->num_segments()) {
+            result.push_back(rs);
+            continue;
+        }
+        bool may_overlap = std::any_of(
+                segments_key_bounds.begin(), segments_key_bounds.end(),
+                [&](const KeyBoundsPB& bounds) {
+                    return !Slice::lhs_is_strictly_less_than_rhs(max_key, false,
+                                                                 Slice(bounds.min_key()),
+                                                                 truncated) &&
+                           !Slice::lhs_is_strictly_less_than_rhs(Slice(bounds.max_key()),
+                                                                 truncated, min_key, false);
+                });
+        if (may_overlap) {
+            result.push_back(rs);
+        }
+    }
+    return result;
+}
+
 Status BaseTablet::lookup_row_key(const Slice& encoded_key, TabletSchema* latest_schema,
                                   bool with_seq_col,
                                   const std::vector<RowsetSharedPtr>& specified_rowsets,
@@ -488,8 +551,7 @@ Status BaseTablet::lookup_row_key(const Slice& encoded_key, TabletSchema* latest
             delete_bitmap == nullptr ? _tablet_meta->delete_bitmap_ptr() : delete_bitmap;
     for (size_t i = 0; i < specified_rowsets.size(); i++) {
         const auto& rs = specified_rowsets[i];
-        std::vector<KeyBoundsPB> segments_key_bounds;
-        rs->rowset_meta()->get_segments_key_bounds(&segments_key_bounds);
+        const auto& segments_key_bounds = rs->rowset_meta()->get_segments_key_bounds();
         int num_segments = cast_set<int>(rs->num_segments());
         DCHECK_EQ(segments_key_bounds.size(), num_segments);
         std::vector<uint32_t> picked_segments;
@@ -639,6 +701,23 @@ Status BaseTablet::calc_segment_delete_bitmap(RowsetSharedPtr rowset,
 
     RETURN_IF_ERROR(seg->load_pk_index_and_bf(nullptr)); // We need index blocks to iterate
     const auto* pk_idx = seg->get_primary_key_index();
+
+    // Skip the historical rowsets that cannot contain any key of this segment. The suffix of
+    // the sequence column and row id is cut from the min key only, a prefix of the min key and
+    // the full max key still bound the keys without the suffix.
+    std::string seg_min_key = seg->min_key();
+    std::string seg_max_key = seg->max_key();
+    size_t key_suffix_length = 0;
+    if (rowset_schema->has_sequence_col()) {
+        key_suffix_length += rowset_schema->column(rowset_schema->sequence_col_idx()).length() + 1;
+    }
+    if (!rowset_schema->cluster_key_uids().empty()) {
+        key_suffix_length += PrimaryKeyIndexReader::ROW_ID_LENGTH;
+    }
+    seg_min_key.resize(seg_min_key.size() - std::min(seg_min_key.size(), key_suffix_length));
+    const std::vector<RowsetSharedPtr> candidate_rowsets =
+            _rowsets_may_overlap(specified_rowsets, seg_min_key, seg_max_key);
+
     int64_t total = pk_idx->num_rows();
     uint32_t row_id = 0;
     int64_t remaining = total;
@@ -648,8 +727,8 @@ Status BaseTablet::calc_segment_delete_bitmap(RowsetSharedPtr rowset,
     // The data for each segment may be lookup multiple times. Creating a SegmentCacheHandle
     // will update the lru cache, and there will be obvious lock competition in multithreading
     // scenarios, so using a segment_caches to cache SegmentCacheHandle.
-    std::vector<std::unique_ptr<SegmentCacheHandle>> segment_caches(specified_rowsets.size());
-    while (remaining > 0) {
+    std::vector<std::unique_ptr<SegmentCacheHandle>> segment_caches(candidate_rowsets.size());
+    while (remaining > 0 && !candidate_rowsets.empty()) {
         std::unique_ptr<segment_v2::IndexedColumnIterator> iter;
         RETURN_IF_ERROR(pk_idx->new_iterator(&iter, nullptr));
 
@@ -720,10 +799,10 @@ Status BaseTablet::calc_segment_delete_bitmap(RowsetSharedPtr rowset,
             RowsetSharedPtr rowset_find;
             Status st = Status::OK();
             if (tablet_delete_bitmap == nullptr) {
-                st = lookup_row_key(key, rowset_schema.get(), true, specified_rowsets, &loc,
+                st = lookup_row_key(key, rowset_schema.get(), true, candidate_rowsets, &loc,
                                     dummy_version.first - 1, segment_caches, &rowset_find);
             } else {
-                st = lookup_row_key(key, rowset_schema.get(), true, specified_rowsets, &loc,
+                st = lookup_row_key(key, rowset_schema.get(), true, candidate_rowsets, &loc,
                                     dummy_version.first - 1, segment_caches, &rowset_find, true,
                                     nullptr, nullptr, tablet_delete_bitmap);
             }
@@ -838,6 +917,7 @@ Status BaseTablet::calc_segment_delete_bitmap(RowsetSharedPtr rowset,
         RETURN_IF_ERROR(sort_block(block, ordered_block));
         RETURN_IF_ERROR(rowset_writer->flush_single_block(&ordered_block));
         auto cost_us = watch.get_elapse_time_us();
+        g_tablet_calc_segment_delete_bitmap_latency << static_cast<int64_t>(cost_us);
         if (config::enable_mow_verbose_log || cost_us > 10 * 1000) {
             LOG(INFO) << "calc segment delete bitmap for "
                       << partial_update_info->partial_update_mode_str()
@@ -852,6 +932,7 @@ Status BaseTablet::calc_segment_delete_bitmap(RowsetSharedPtr rowset,
         return Status::OK();
     }
     auto cost_us = watch.get_elapse_time_us();
+    g_tablet_calc_segment_delete_bitmap_latency << static_cast<int64_t>(cost_us);
     if (config::enable_mow_verbose_log || cost_us > 10 * 1000) {
         LOG(INFO) << "calc segment delete bitmap, tablet: " << tablet_id()
                   << " rowset: " << rowset_id << " seg_id: " << seg->id()
@@ -965,6 +1046,27 @@ Status BaseTablet::fetch_value_by_rowids(RowsetSharedPtr input_rowset, uint32_t
     return Status::OK();
 }
 
+Status BaseTablet::fetch_values_by_rowids(RowsetSharedPtr input_rowset, uint32_t segid,
+                                          const std::vector<uint32_t>& rowids,
+                                          const TabletSchema& tablet_schema,
+                                          const std::vector<uint32_t>& cids,
+                                          vectorized::MutableColumns& columns) {
+    DCHECK_EQ(cids.size(), columns.size());
+    BetaRowsetSharedPtr rowset = std::static_pointer_cast<BetaRowset>(input_rowset);
+    CHECK(rowset);
+    // the segments are loaded by the first column, the handle keeps them for the others
+    SegmentCacheHandle segment_cache_handle;
+    OlapReaderStatistics stats;
+    for (size_t i = 0; i < cids.size(); ++i) {
+        std::unique_ptr<segment_v2::ColumnIterator> column_iterator;
+        RETURN_IF_ERROR(_get_segment_column_iterator(rowset, segid, tablet_schema.column(cids[i]),
+                                                     &segment_cache_handle, &column_iterator,
+                                                     &stats));
+        RETURN_IF_ERROR(column_iterator->read_by_rowids(rowids.data(), rowids.size(), columns[i]));
+    }
+    return Status::OK();
+}
+
 const signed char* BaseTablet::get_delete_sign_column_data(const vectorized::Block& block,
                                                            size_t rows_at_least) {
     if (const vectorized::ColumnWithTypeAndName* delete_sign_column =
@@ -158,6 +158,11 @@ public:
     Status lookup_row_data(const Slice& encoded_key, const RowLocation& row_location,
                            RowsetSharedPtr rowset, OlapReaderStatistics& stats, std::string& values,
                            bool write_to_cache = false);
+    // Lookup the row store values of `row_ids` in segment `segment_id` of `rowset` with one
+    // column iterator. `row_ids` must be ascending, so rows sharing a page read it once.
+    Status lookup_row_data_batch(const RowsetSharedPtr& rowset, uint32_t segment_id,
+                                 const std::vector<segment_v2::rowid_t>& row_ids,
+                                 OlapReaderStatistics& stats, vectorized::MutableColumnPtr& values);
     // Lookup the row location of `encoded_key`, the function sets `row_location` on success.
     // NOTE: the method only works in unique key model with primary key index, you will got a
     //       not supported error in other data model.
@@ -246,6 +251,14 @@ public:
                                         const TabletColumn& tablet_column,
                                         vectorized::MutableColumnPtr& dst);
 
+    // Same as above for several columns of one segment, the segment is loaded only once.
+    // columns[i] receives the values of tablet_schema.column(cids[i]).
+    static Status fetch_values_by_rowids(RowsetSharedPtr input_rowset, uint32_t segid,
+                                         const std::vector<uint32_t>& rowids,
+                                         const TabletSchema& tablet_schema,
+                                         const std::vector<uint32_t>& cids,
+                                         vectorized::MutableColumns& columns);
+
     virtual Result<std::unique_ptr<RowsetWriter>> create_transient_rowset_writer(
             const Rowset& rowset, std::shared_ptr<PartialUpdateInfo> partial_update_info,
             int64_t txn_expiration = 0) = 0;
@@ -347,6 +360,10 @@ protected:
                                        const RowsetIdUnorderedSet& pre,
                                        RowsetIdUnorderedSet* to_add, RowsetIdUnorderedSet* to_del);
 
+    // Returns the rowsets that have a segment whose key bounds may overlap [min_key, max_key].
+    static std::vector<RowsetSharedPtr> _rowsets_may_overlap(
+            const std::vector<RowsetSharedPtr>& rowsets, Slice min_key, Slice max_key);
+
     Status _capture_consistent_rowsets_unlocked(const std::vector<Version>& version_path,
                                                 std::vector<RowsetSharedPtr>* rowsets) const;
 
@@ -373,7 +390,17 @@ protected:
 protected:
     std::timed_mutex _schema_change_lock;
 
+private:
+    std::mutex _query_heat_lock;
+    double _query_heat = 0;
+    int64_t _query_heat_scan_count = 0;
+    int64_t _query_heat_update_ms = 0;
+
 public:
+    // Query scans seen on this tablet, decayed by `compaction_read_heat_half_life_sec`.
+    // Each call folds in the scans since the previous call.
+    double query_heat(int64_t now_ms);
+
     IntCounter* query_scan_bytes = nullptr;
     IntCounter* query_scan_rows = nullptr;
     IntCounter* query_scan_count = nullptr;
@@ -0,0 +1,151 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "olap/cache_eviction_policy.h"
+
+#include <algorithm>
+
+#include "common/exception.h"
+#include "olap/lru_cache.h"
+
+namespace doris {
+#include "common/compile_check_begin.h"
+
+std::string cache_eviction_policy_string(CacheEvictionPolicyType type) {
+    switch (type) {
+    case CacheEvictionPolicyType::LRU:
+        return "LRU";
+    case CacheEvictionPolicyType::SLRU:
+        return "SLRU";
+    case CacheEvictionPolicyType::S3_FIFO:
+        return "S3_FIFO";
+    case CacheEvictionPolicyType::W_TINY_LFU:
+        return "W_TINY_LFU";
+    default:
+        throw Exception(Status::FatalError("not match type of cache eviction policy:{}",
+                                           static_cast<int>(type)));
+    }
+}
+
+bool parse_cache_eviction_policy(const std::string& name, CacheEvictionPolicyType* type) {
+    for (auto t : {CacheEvictionPolicyType::LRU, CacheEvictionPolicyType::SLRU,
+                   CacheEvictionPolicyType::S3_FIFO, CacheEvictionPolicyType::W_TINY_LFU}) {
+        if (name == cache_eviction_policy_string(t)) {
+            *type = t;
+            return true;
+        }
+    }
+    return false;
+}
+
+std::unique_ptr<CacheEvictionPolicy> CacheEvictionPolicy::create(CacheEvictionPolicyType type) {
+    switch (type) {
+    case CacheEvictionPolicyType::SLRU:
+        return std::make_unique<SLRUEvictionPolicy>();
+    case CacheEvictionPolicyType::S3_FIFO:
+        return std::make_unique<S3FIFOEvictionPolicy>();
+    case CacheEvictionPolicyType::W_TINY_LFU:
+        return std::make_unique<WTinyLFUEvictionPolicy>();
+    default:
+        return std::make_unique<LRUEvictionPolicy>();
+    }
+}
+
+void S3FIFOEvictionPolicy::on_insert(uint32_t hash, size_t element_count) {
+    _ghost_capacity = std::max<size_t>(element_count, 1);
+}
+
+bool S3FIFOEvictionPolicy::insert_to_protected(uint32_t hash) {
+    auto it = _ghost_map.find(hash);
+    if (it == _ghost_map.end()) {
+        return false;
+    }
+    _ghost_list.erase(it->second);
+    _ghost_map.erase(it);
+    return true;
+}
+
+bool S3FIFOEvictionPolicy::promote(const LRUHandle* candidate) {
+    return candidate->visited;
+}
+
+void S3FIFOEvictionPolicy::on_evict(const LRUHandle* e) {
+    if (_ghost_map.contains(e->hash)) {
+        return;
+    }
+    while (_ghost_list.size() >= _ghost_capacity) {
+        _ghost_map.erase(_ghost_list.back());
+        _ghost_list.pop_back();
+    }
+    _ghost_list.push_front(e->hash);
+    _ghost_map[e->hash] = _ghost_list.begin();
+}
+
+void FrequencySketch::ensure_capacity(size_t capacity) {
+    size_t width = 64;
+    while (width < capacity) {
+        width <<= 1;
+    }
+    if (width <= _width) {
+        return;
+    }
+    _width = width;
+    _sample_size = 10 * width;
+    _additions = 0;
+    _table.assign(DEPTH * width, 0);
+}
+
+size_t FrequencySketch::_index(uint32_t hash, int row) const {
+    static constexpr uint64_t SEEDS[DEPTH] = {0x97cb3127ULL, 0xc2b2ae3dULL, 0x27d4eb2fULL,
+                                              0x165667b1ULL};
+    uint64_t h = (static_cast<uint64_t>(hash) + SEEDS[row]) * 0x9e3779b97f4a7c15ULL;
+    return row * _width + ((h >> 32) & (_width - 1));
+}
+
+void FrequencySketch::increment(uint32_t hash) {
+    for (int row = 0; row < DEPTH; ++row) {
+        auto& counter = _table[_index(hash, row)];
+        if (counter < MAX_COUNT) {
+            ++counter;
+        }
+    }
+    if (++_additions >= _sample_size) {
+        _reset();
+    }
+}
+
+uint32_t FrequencySketch::frequency(uint32_t hash) const {
+    uint8_t frequency = MAX_COUNT;
+    for (int row = 0; row < DEPTH; ++row) {
+        frequency = std::min(frequency, _table[_index(hash, row)]);
+    }
+    return frequency;
+}
+
+void FrequencySketch::_reset() {
+    for (auto& counter : _table) {
+        counter = static_cast<uint8_t>(counter >> 1);
+    }
+    _additions /= 2;
+}
+
+bool WTinyLFUEvictionPolicy::admit(uint32_t hash, const LRUHandle* victim) {
+    return _sketch.frequency(hash) >= _sketch.frequency(victim->hash);
+}
+
+#include "common/compile_check_end.h"
+} // namespace doris
@@ -0,0 +1,157 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace doris {
+#include "common/compile_check_begin.h"
+
+struct LRUHandle;
+
+// Eviction policy of a LRUCache shard.
+// LRU: evicts the least recently used entry, optionally with LRU-K admission (see is_lru_k).
+// SLRU: new entries go to a probation segment and move to a protected segment (at most 80%
+//     of the capacity) once hit, entries are evicted from probation first.
+// S3_FIFO: new entries go to a small probation segment (10% of the capacity), entries leaving
+//     it without being hit are evicted and remembered in a ghost list, a key found in the ghost
+//     list is inserted into the protected segment directly.
+// W_TINY_LFU: SLRU behind a TinyLFU admission filter, when the cache is full a new key is
+//     only admitted if its frequency estimated by a count-min sketch is not lower than that of
+//     the entry it would evict. The probation segment plays the role of the admission window.
+enum class CacheEvictionPolicyType { LRU = 0, SLRU = 1, S3_FIFO = 2, W_TINY_LFU = 3 };
+
+static constexpr CacheEvictionPolicyType DEFAULT_CACHE_EVICTION_POLICY =
+        CacheEvictionPolicyType::LRU;
+
+std::string cache_eviction_policy_string(CacheEvictionPolicyType type);
+// Return false if name is not one of LRU, SLRU, S3_FIFO and W_TINY_LFU.
+bool parse_cache_eviction_policy(const std::string& name, CacheEvictionPolicyType* type);
+
+// Entries of a LRUCache shard are kept in a probation and a protected segment, the policy
+// decides how entries move between them. A policy is owned by one shard and is only called
+// with the shard's mutex held.
+class CacheEvictionPolicy {
+public:
+    static std::unique_ptr<CacheEvictionPolicy> create(CacheEvictionPolicyType type);
+
+    virtual ~CacheEvictionPolicy() = default;
+
+    virtual CacheEvictionPolicyType type() const = 0;
+
+    // Entries are evicted from the protected segment only after the probation segment is
+    // smaller than this share of the capacity.
+    virtual double probation_ratio() const { return 0; }
+    // The protected segment is at most this share of the capacity, the oldest protected
+    // entries are moved back to probation when it grows larger.
+    virtual double protected_ratio() const { return 1; }
+    // Whether an entry moves to the protected segment as soon as it is hit.
+    virtual bool promote_on_hit() const { return false; }
+
+    // Called on every lookup of the key hash, hit or not.
+    virtual void on_lookup(uint32_t hash) {}
+    // Called on every insert, element_count is the number of entries in the shard.
+    virtual void on_insert(uint32_t hash, size_t element_count) {}
+    // Whether a new entry goes to the protected segment directly.
+    virtual bool insert_to_protected(uint32_t hash) { return false; }
+    // Called when the cache is full, whether the new key is admitted at the cost of evicting
+    // `victim`, the first entry to evict. A key not admitted is not inserted into the cache.
+    virtual bool admit(uint32_t hash, const LRUHandle* victim) { return true; }
+    // Whether `candidate`, the oldest probation entry, moves to the protected segment
+    // instead of being evicted.
+    virtual bool promote(const LRUHandle* candidate) { return false; }
+    // Called when the probation entry `e` is evicted to free space.
+    virtual void on_evict(const LRUHandle* e) {}
+};
+
+class LRUEvictionPolicy final : public CacheEvictionPolicy {
+public:
+    CacheEvictionPolicyType type() const override { return CacheEvictionPolicyType::LRU; }
+};
+
+class SLRUEvictionPolicy final : public CacheEvictionPolicy {
+public:
+    CacheEvictionPolicyType type() const override { return CacheEvictionPolicyType::SLRU; }
+    double protected_ratio() const override { return 0.8; }
+    bool promote_on_hit() const override { return true; }
+};
+
+class S3FIFOEvictionPolicy final : public CacheEvictionPolicy {
+public:
+    CacheEvictionPolicyType type() const override { return CacheEvictionPolicyType::S3_FIFO; }
+    double probation_ratio() const override { return 0.1; }
+    void on_insert(uint32_t hash, size_t element_count) override;
+    bool insert_to_protected(uint32_t hash) override;
+    bool promote(const LRUHandle* candidate) override;
+    void on_evict(const LRUHandle* e) override;
+
+private:
+    // Hashes of the keys evicted from probation without being hit, newest first. At most as
+    // many as the entries in the shard.
+    std::list<uint32_t> _ghost_list;
+    std::unordered_map<uint32_t, std::list<uint32_t>::iterator> _ghost_map;
+    size_t _ghost_capacity = 1;
+};
+
+// Count-min sketch of key hashes with 4 rows of counters saturated at 15. All counters are
+// halved after 10 * width increments, so that the frequency of keys no longer accessed fades.
+class FrequencySketch {
+public:
+    FrequencySketch() { ensure_capacity(0); }
+
+    // Grows the sketch to at least `capacity` counters per row, which resets all counters.
+    void ensure_capacity(size_t capacity);
+    void increment(uint32_t hash);
+    uint32_t frequency(uint32_t hash) const;
+
+private:
+    static constexpr int DEPTH = 4;
+    static constexpr uint8_t MAX_COUNT = 15;
+
+    size_t _index(uint32_t hash, int row) const;
+    void _reset();
+
+    std::vector<uint8_t> _table;
+    size_t _width = 0;
+    size_t _sample_size = 0;
+    size_t _additions = 0;
+};
+
+class WTinyLFUEvictionPolicy final : public CacheEvictionPolicy {
+public:
+    CacheEvictionPolicyType type() const override { return CacheEvictionPolicyType::W_TINY_LFU; }
+    double protected_ratio() const override { return 0.8; }
+    bool promote_on_hit() const override { return true; }
+    void on_lookup(uint32_t hash) override { _sketch.increment(hash); }
+    void on_insert(uint32_t hash, size_t element_count) override {
+        _sketch.ensure_capacity(element_count);
+    }
+    bool admit(uint32_t hash, const LRUHandle* victim) override;
+
+private:
+    FrequencySketch _sketch;
+};
+
+#include "common/compile_check_end.h"
+} // namespace doris
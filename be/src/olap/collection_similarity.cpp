@@ -35,14 +35,14 @@ void CollectionSimilarity::get_topn_bm25_scores(roaring::Roaring* row_bitmap,
 
     if (order_type == OrderType::DESC) {
         find_top_k_scores(
-                _bm25_scores, top_k,
+                _bm25_scores, *row_bitmap, top_k,
                 [](const ScoreMapIterator& a, const ScoreMapIterator& b) {
                     return a->second > b->second;
                 },
                 top_k_results);
     } else {
         find_top_k_scores(
-                _bm25_scores, top_k,
+                _bm25_scores, *row_bitmap, top_k,
                 [](const ScoreMapIterator& a, const ScoreMapIterator& b) {
                     return a->second < b->second;
                 },
@@ -84,8 +84,8 @@ void CollectionSimilarity::get_topn_bm25_scores(roaring::Roaring* row_bitmap,
 
 template <typename Compare>
 void CollectionSimilarity::find_top_k_scores(
-        const ScoreMap& all_scores, size_t top_k, Compare comp,
-        std::vector<std::pair<uint32_t, float>>& top_k_results) const {
+        const ScoreMap& all_scores, const roaring::Roaring& row_bitmap, size_t top_k,
+        Compare comp, std::vector<std::pair<uint32_t, float>>& top_k_results) const {
     if (top_k <= 0) {
         return;
     }
@@ -93,6 +93,10 @@ void CollectionSimilarity::find_top_k_scores(
     std::priority_queue<ScoreMapIterator, std::vector<ScoreMapIterator>, Compare> top_k_heap(comp);
 
     for (auto it = all_scores.begin(); it != all_scores.end(); ++it) {
+        // rows scored by the index may still be removed later, e.g. by the delete bitmap
+        if (!row_bitmap.contains(it->first)) {
+            continue;
+        }
         if (top_k_heap.size() < top_k) {
             top_k_heap.push(it);
         } else if (comp(it, top_k_heap.top())) {
@@ -44,7 +44,8 @@ public:
 
 private:
     template <typename Compare>
-    void find_top_k_scores(const ScoreMap& all_scores, size_t top_k, Compare comp,
+    void find_top_k_scores(const ScoreMap& all_scores, const roaring::Roaring& row_bitmap,
+                           size_t top_k, Compare comp,
                            std::vector<std::pair<uint32_t, float>>& top_k_results) const;
 
     ScoreMap _bm25_scores;
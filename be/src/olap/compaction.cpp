@@ -17,6 +17,7 @@
 
 #include "olap/compaction.h"
 
+#include <bvar/bvar.h>
 #include <fmt/format.h>
 #include <gen_cpp/olap_file.pb.h>
 #include <glog/logging.h>
@@ -43,6 +44,7 @@
 #include "common/status.h"
 #include "cpp/sync_point.h"
 #include "io/cache/block_file_cache_factory.h"
+#include "io/fs/compaction_io_throttle.h"
 #include "io/fs/file_system.h"
 #include "io/fs/file_writer.h"
 #include "io/fs/remote_file_system.h"
@@ -88,14 +90,29 @@ using namespace ErrorCode;
 namespace {
 #include "common/compile_check_begin.h"
 
+// string indexes merged by doc id remapping vs. rebuilt by re-analyzing the compacted rows
+bvar::Adder<int64_t> g_index_compaction_merged_columns("index_compaction", "merged_columns");
+bvar::Adder<int64_t> g_index_compaction_rebuilt_columns("index_compaction", "rebuilt_columns");
+
 bool is_rowset_tidy(std::string& pre_max_key, bool& pre_rs_key_bounds_truncated,
                     const RowsetSharedPtr& rhs) {
     size_t min_tidy_size = config::ordered_data_compaction_min_segment_size;
     if (rhs->num_segments() == 0) {
         return true;
     }
+    bool cur_rs_key_bounds_truncated {rhs->is_segments_key_bounds_truncated()};
     if (rhs->is_segments_overlapping()) {
-        return false;
+        // segments flagged overlapping may still hold ascending, disjoint key ranges, e.g. the
+        // output of append-only loads, and can then be linked without a merge
+        std::vector<KeyBoundsPB> segments_key_bounds;
+        RETURN_FALSE_IF_ERROR(rhs->get_segments_key_bounds(&segments_key_bounds));
+        for (size_t i = 1; i < segments_key_bounds.size(); ++i) {
+            if (!Slice::lhs_is_strictly_less_than_rhs(
+                        Slice {segments_key_bounds[i - 1].max_key()}, cur_rs_key_bounds_truncated,
+                        Slice {segments_key_bounds[i].min_key()}, cur_rs_key_bounds_truncated)) {
+                return false;
+            }
+        }
     }
     // check segment size
     auto* beta_rowset = reinterpret_cast<BetaRowset*>(rhs.get());
@@ -112,7 +129,6 @@ bool is_rowset_tidy(std::string& pre_max_key, bool& pre_rs_key_bounds_truncated,
     if (!ret) {
         return false;
     }
-    bool cur_rs_key_bounds_truncated {rhs->is_segments_key_bounds_truncated()};
     if (!Slice::lhs_is_strictly_less_than_rhs(Slice {pre_max_key}, pre_rs_key_bounds_truncated,
                                               Slice {min_key}, cur_rs_key_bounds_truncated)) {
         return false;
@@ -222,6 +238,7 @@ Status Compaction::merge_input_rowsets() {
         }
         // 2. Merge the remaining inverted index files of the string type
         RETURN_IF_ERROR(do_inverted_index_compaction());
+        g_index_compaction_rebuilt_columns << _num_rebuilt_index_columns;
     }
 
     COUNTER_UPDATE(_merged_rows_counter, _stats.merged_rows);
@@ -451,6 +468,7 @@ Status CompactionMixin::execute_compact() {
 
     auto* data_dir = tablet()->data_dir();
     int64_t permits = get_compaction_permits();
+    io::ScopedCompactionIO scoped_compaction_io(compaction_type());
     data_dir->disks_compaction_score_increment(permits);
     data_dir->disks_compaction_num_increment(1);
 
@@ -827,6 +845,8 @@ Status Compaction::do_inverted_index_compaction() {
             if (!st.ok()) {
                 error_handler(index_meta->index_id(), column_uniq_id);
                 status = Status::Error<INVERTED_INDEX_COMPACTION_ERROR>(st.msg());
+            } else {
+                g_index_compaction_merged_columns << 1;
             }
         } catch (CLuceneError& e) {
             error_handler(index_meta->index_id(), column_uniq_id);
@@ -912,6 +932,10 @@ void Compaction::construct_index_compaction_columns(RowsetWriterContext& ctx) {
             }
         }
         if (is_continue) {
+            _num_rebuilt_index_columns++;
+            VLOG_DEBUG << "tablet[" << _tablet->tablet_id() << "] index[" << index->index_id()
+                      << "] differs between input rowsets, will rebuild it instead of index "
+                         "compaction";
             continue;
         }
         auto has_inverted_index = [&](const RowsetSharedPtr& src_rs) {
@@ -1029,6 +1053,8 @@ void Compaction::construct_index_compaction_columns(RowsetWriterContext& ctx) {
 
         if (all_have_inverted_index) {
             ctx.columns_to_do_index_compaction.insert(col_unique_id);
+        } else {
+            _num_rebuilt_index_columns++;
         }
     }
 }
@@ -1455,6 +1481,12 @@ int64_t CloudCompactionMixin::initiator() const {
     return HashUtil::hash64(_uuid.data(), _uuid.size(), 0) & std::numeric_limits<int64_t>::max();
 }
 
+bool CloudCompactionMixin::need_renew_lease(int64_t now, int64_t lease_expiration) {
+    return now + config::lease_compaction_interval_seconds *
+                         config::lease_compaction_renew_ahead_intervals >=
+           lease_expiration;
+}
+
 Status CloudCompactionMixin::execute_compact() {
     TEST_INJECTION_POINT("Compaction::do_compaction");
     int64_t permits = get_compaction_permits();
@@ -112,6 +112,8 @@ protected:
     int64_t _input_rowsets_total_size {0};
     int64_t _input_row_num {0};
     int64_t _input_num_segments {0};
+    // string indexes rebuilt by the merge instead of merged by index compaction
+    int64_t _num_rebuilt_index_columns {0};
 
     int64_t _local_read_bytes_total {};
     int64_t _remote_read_bytes_total {};
@@ -204,6 +206,11 @@ public:
 
     int64_t initiator() const;
 
+    // Whether a lease expiring at `lease_expiration` should be renewed at `now`, both in
+    // seconds since epoch. Renewing only when the lease is about to expire saves most of the
+    // lease rpcs of long running compactions and stop tokens.
+    static bool need_renew_lease(int64_t now, int64_t lease_expiration);
+
 protected:
     CloudTablet* cloud_tablet() { return static_cast<CloudTablet*>(_tablet.get()); }
 
@@ -211,12 +218,17 @@ protected:
 
     virtual Status garbage_collection();
 
+    bool need_renew_lease(int64_t now) const { return need_renew_lease(now, _lease_expiration); }
+
     CloudStorageEngine& _engine;
 
     std::string _uuid;
 
     int64_t _expiration = 0;
 
+    // Lease granted by the last successful `do_lease`, in seconds since epoch
+    int64_t _lease_expiration = 0;
+
 private:
     Status construct_output_rowset_writer(RowsetWriterContext& ctx) override;
 
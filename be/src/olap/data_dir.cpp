@@ -17,6 +17,7 @@
 
 #include "olap/data_dir.h"
 
+#include <bvar/bvar.h>
 #include <fmt/core.h>
 #include <fmt/format.h>
 #include <gen_cpp/FrontendService_types.h>
@@ -27,9 +28,13 @@
 #include <cstdio>
 // IWYU pragma: no_include <bits/chrono.h>
 #include <chrono> // IWYU pragma: keep
+#include <condition_variable>
 #include <cstddef>
 #include <filesystem>
+#include <functional>
+#include <map>
 #include <memory>
+#include <mutex>
 #include <new>
 #include <roaring/roaring.hh>
 #include <set>
@@ -62,15 +67,23 @@
 #include "olap/tablet_meta_manager.h"
 #include "olap/txn_manager.h"
 #include "olap/utils.h" // for check_dir_existed
+#include "runtime/thread_context.h"
 #include "service/backend_options.h"
 #include "util/doris_metrics.h"
 #include "util/string_util.h"
+#include "util/threadpool.h"
 #include "util/uid_util.h"
 
 namespace doris {
 #include "common/compile_check_begin.h"
 using namespace ErrorCode;
 
+// Time spent in each phase of loading data dirs at startup, summed over all data dirs.
+bvar::Adder<int64_t> g_data_dir_load_rowset_meta_ms("data_dir_load", "rowset_meta_ms");
+bvar::Adder<int64_t> g_data_dir_load_tablet_meta_ms("data_dir_load", "tablet_meta_ms");
+bvar::Adder<int64_t> g_data_dir_load_pending_publish_ms("data_dir_load", "pending_publish_ms");
+bvar::Adder<int64_t> g_data_dir_load_rowset_ms("data_dir_load", "rowset_ms");
+
 namespace {
 
 Status read_cluster_id(const std::string& cluster_id_path, int32_t* cluster_id) {
@@ -105,6 +118,72 @@ Status _write_cluster_id_to_path(const std::string& path, int32_t cluster_id) {
     return Status::OK();
 }
 
+// Hands the entries yielded by a sequential meta traversal to `pool` in batches. The batches in
+// flight are bounded, so memory does not grow with the number of metas in the data dir.
+template <typename Entry>
+class MetaBatchLoader {
+public:
+    using LoadFunc = std::function<void(std::vector<Entry>& batch, size_t batch_idx)>;
+
+    MetaBatchLoader(ThreadPool* pool, size_t max_batches_in_flight, LoadFunc load_func)
+            : _pool(pool),
+              _max_batches_in_flight(max_batches_in_flight),
+              _load_func(std::move(load_func)) {}
+
+    void add(Entry entry) {
+        _batch.push_back(std::move(entry));
+        if (_batch.size() >= BATCH_SIZE) {
+            _submit();
+        }
+    }
+
+    // Waits until all added entries are loaded.
+    void finish() {
+        if (!_batch.empty()) {
+            _submit();
+        }
+        std::unique_lock l(_lock);
+        _cv.wait(l, [this] { return _batches_in_flight == 0; });
+    }
+
+private:
+    static constexpr size_t BATCH_SIZE = 256;
+
+    void _submit() {
+        {
+            std::unique_lock l(_lock);
+            _cv.wait(l, [this] { return _batches_in_flight < _max_batches_in_flight; });
+            ++_batches_in_flight;
+        }
+        auto batch = std::make_shared<std::vector<Entry>>(std::move(_batch));
+        _batch.clear();
+        auto load = [this, batch, batch_idx = _num_batches++]() {
+            _load_func(*batch, batch_idx);
+            std::lock_guard l(_lock);
+            --_batches_in_flight;
+            _cv.notify_all();
+        };
+        auto st = _pool->submit_func([load]() {
+            SCOPED_INIT_THREAD_CONTEXT();
+            load();
+        });
+        if (!st.ok()) {
+            load();
+        }
+    }
+
+    ThreadPool* _pool;
+    const size_t _max_batches_in_flight;
+    LoadFunc _load_func;
+
+    std::vector<Entry> _batch;
+    size_t _num_batches = 0;
+
+    std::mutex _lock;
+    std::condition_variable _cv;
+    size_t _batches_in_flight = 0;
+};
+
 } // namespace
 
 DEFINE_GAUGE_METRIC_PROTOTYPE_2ARG(disks_total_capacity, MetricUnit::BYTES);
@@ -355,10 +434,20 @@ Status DataDir::load() {
     // necessarily check incompatible old format. when there are old metas, it may load to data missing
     RETURN_IF_ERROR(_check_incompatible_old_format_tablet());
 
+    // Metas are parsed by a thread pool while rocksdb is iterated by this thread.
+    int num_load_threads = std::max(config::load_tablet_meta_threads_per_data_dir, 1);
+    std::unique_ptr<ThreadPool> load_meta_pool;
+    RETURN_IF_ERROR(ThreadPoolBuilder("load_tablet_meta")
+                            .set_min_threads(num_load_threads)
+                            .set_max_threads(num_load_threads)
+                            .build(&load_meta_pool));
+    const size_t max_batches_in_flight = 2 * num_load_threads;
+
     std::vector<RowsetMetaSharedPtr> dir_rowset_metas;
     LOG(INFO) << "begin loading rowset from meta";
-    auto load_rowset_func = [&dir_rowset_metas, this](TabletUid tablet_uid, RowsetId rowset_id,
-                                                      std::string_view meta_str) -> bool {
+    auto load_rowset_func = [this](TabletUid tablet_uid, RowsetId rowset_id,
+                                   std::string_view meta_str,
+                                   std::vector<RowsetMetaSharedPtr>* rowset_metas) -> bool {
         RowsetMetaSharedPtr rowset_meta(new RowsetMeta());
         bool parsed = rowset_meta->init(meta_str);
         if (!parsed) {
@@ -402,13 +491,48 @@ Status DataDir::load() {
                          << " load from meta but partition id eq 0";
         }
 
-        dir_rowset_metas.push_back(rowset_meta);
+        rowset_metas->push_back(rowset_meta);
         return true;
     };
+    struct RowsetMetaEntry {
+        TabletUid tablet_uid;
+        RowsetId rowset_id;
+        std::string meta_str;
+    };
+    std::atomic<bool> load_rowset_failed = false;
+    std::mutex batch_rowset_metas_lock;
+    // batch index -> rowset metas, to keep the order of traversal
+    std::map<size_t, std::vector<RowsetMetaSharedPtr>> batch_rowset_metas;
+    MetaBatchLoader<RowsetMetaEntry> rowset_loader(
+            load_meta_pool.get(), max_batches_in_flight,
+            [&](std::vector<RowsetMetaEntry>& batch, size_t batch_idx) {
+                std::vector<RowsetMetaSharedPtr> rowset_metas;
+                for (auto& entry : batch) {
+                    if (!load_rowset_func(entry.tablet_uid, entry.rowset_id, entry.meta_str,
+                                          &rowset_metas)) {
+                        load_rowset_failed = true;
+                        break;
+                    }
+                }
+                std::lock_guard l(batch_rowset_metas_lock);
+                batch_rowset_metas[batch_idx] = std::move(rowset_metas);
+            });
     MonotonicStopWatch rs_timer;
     rs_timer.start();
-    Status load_rowset_status = RowsetMetaManager::traverse_rowset_metas(_meta, load_rowset_func);
+    Status load_rowset_status = RowsetMetaManager::traverse_rowset_metas(
+            _meta, [&](TabletUid tablet_uid, RowsetId rowset_id, std::string_view meta_str) {
+                rowset_loader.add({tablet_uid, rowset_id, std::string(meta_str)});
+                return !load_rowset_failed;
+            });
+    rowset_loader.finish();
+    for (auto& [_, rowset_metas] : batch_rowset_metas) {
+        dir_rowset_metas.insert(dir_rowset_metas.end(), rowset_metas.begin(), rowset_metas.end());
+    }
+    if (load_rowset_status.ok() && load_rowset_failed) {
+        load_rowset_status = Status::InternalError("failed to load rowset meta");
+    }
     rs_timer.stop();
+    g_data_dir_load_rowset_meta_ms << rs_timer.elapsed_time_milliseconds();
     if (!load_rowset_status) {
         LOG(WARNING) << "errors when load rowset meta from meta env, skip this data dir:" << _path;
     } else {
@@ -419,13 +543,15 @@ Status DataDir::load() {
     // load tablet
     // create tablet from tablet meta and add it to tablet mgr
     LOG(INFO) << "begin loading tablet from meta";
+    std::mutex tablet_ids_lock;
     std::set<int64_t> tablet_ids;
     std::set<int64_t> failed_tablet_ids;
-    auto load_tablet_func = [this, &tablet_ids, &failed_tablet_ids](
+    auto load_tablet_func = [this, &tablet_ids_lock, &tablet_ids, &failed_tablet_ids](
                                     int64_t tablet_id, int32_t schema_hash,
                                     std::string_view value) -> bool {
         Status status = _engine.tablet_manager()->load_tablet_from_meta(
                 this, tablet_id, schema_hash, value, false, false, false, false);
+        std::lock_guard l(tablet_ids_lock);
         if (!status.ok() && !status.is<TABLE_ALREADY_DELETED_ERROR>() &&
             !status.is<ENGINE_INSERT_OLD_TABLET>()) {
             // load_tablet_from_meta() may return Status::Error<TABLE_ALREADY_DELETED_ERROR>()
@@ -450,10 +576,29 @@ Status DataDir::load() {
         }
         return true;
     };
+    struct TabletMetaEntry {
+        int64_t tablet_id;
+        int32_t schema_hash;
+        std::string value;
+    };
+    // Tablets are loaded concurrently, the same as tablets of different data dirs.
+    MetaBatchLoader<TabletMetaEntry> tablet_loader(
+            load_meta_pool.get(), max_batches_in_flight,
+            [&](std::vector<TabletMetaEntry>& batch, size_t) {
+                for (auto& entry : batch) {
+                    load_tablet_func(entry.tablet_id, entry.schema_hash, entry.value);
+                }
+            });
     MonotonicStopWatch tablet_timer;
     tablet_timer.start();
-    Status load_tablet_status = TabletMetaManager::traverse_headers(_meta, load_tablet_func);
+    Status load_tablet_status = TabletMetaManager::traverse_headers(
+            _meta, [&](int64_t tablet_id, int32_t schema_hash, std::string_view value) {
+                tablet_loader.add({tablet_id, schema_hash, std::string(value)});
+                return true;
+            });
+    tablet_loader.finish();
     tablet_timer.stop();
+    g_data_dir_load_tablet_meta_ms << tablet_timer.elapsed_time_milliseconds();
     if (!failed_tablet_ids.empty()) {
         LOG(WARNING) << "load tablets from header failed"
                      << ", loaded tablet: " << tablet_ids.size()
@@ -502,6 +647,7 @@ Status DataDir::load() {
     RETURN_IF_ERROR(
             TabletMetaManager::traverse_pending_publish(_meta, load_pending_publish_info_func));
     pending_publish_timer.stop();
+    g_data_dir_load_pending_publish_ms << pending_publish_timer.elapsed_time_milliseconds();
     LOG(INFO) << "load pending publish task from meta finished, cost: "
               << pending_publish_timer.elapsed_time_milliseconds() << " ms, data dir: " << _path;
 
@@ -522,6 +668,8 @@ Status DataDir::load() {
     // 2. add visible rowset to tablet
     // ignore any errors when load tablet or rowset, because fe will repair them after report
     int64_t invalid_rowset_counter = 0;
+    MonotonicStopWatch add_rowset_timer;
+    add_rowset_timer.start();
     for (auto&& rowset_meta : dir_rowset_metas) {
         TabletSharedPtr tablet = _engine.tablet_manager()->get_tablet(rowset_meta->tablet_id());
         // tablet maybe dropped, but not drop related rowset meta
@@ -605,6 +753,8 @@ Status DataDir::load() {
             ++invalid_rowset_counter;
         }
     }
+    add_rowset_timer.stop();
+    g_data_dir_load_rowset_ms << add_rowset_timer.elapsed_time_milliseconds();
 
     int64_t dbm_cnt {0};
     int64_t unknown_dbm_cnt {0};
@@ -0,0 +1,86 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "olap/fused_range_predicate.h"
+
+namespace doris {
+#include "common/compile_check_begin.h"
+
+namespace {
+
+template <PrimitiveType Type, PredicateType LowerPT, PredicateType UpperPT>
+std::unique_ptr<FusedRangePredicate> try_fuse(const ColumnPredicate* lower,
+                                              const ColumnPredicate* upper) {
+    const auto* typed_lower = dynamic_cast<const ComparisonPredicateBase<Type, LowerPT>*>(lower);
+    const auto* typed_upper = dynamic_cast<const ComparisonPredicateBase<Type, UpperPT>*>(upper);
+    if (typed_lower == nullptr || typed_upper == nullptr) {
+        return nullptr;
+    }
+    return std::make_unique<FusedRangePredicateImpl<Type, LowerPT, UpperPT>>(typed_lower,
+                                                                             typed_upper);
+}
+
+template <PrimitiveType Type>
+std::unique_ptr<FusedRangePredicate> try_fuse_type(const ColumnPredicate* lower,
+                                                   const ColumnPredicate* upper) {
+    if (lower->type() == PredicateType::GT) {
+        return upper->type() == PredicateType::LT
+                       ? try_fuse<Type, PredicateType::GT, PredicateType::LT>(lower, upper)
+                       : try_fuse<Type, PredicateType::GT, PredicateType::LE>(lower, upper);
+    }
+    return upper->type() == PredicateType::LT
+                   ? try_fuse<Type, PredicateType::GE, PredicateType::LT>(lower, upper)
+                   : try_fuse<Type, PredicateType::GE, PredicateType::LE>(lower, upper);
+}
+
+template <PrimitiveType... Types>
+std::unique_ptr<FusedRangePredicate> try_fuse_types(const ColumnPredicate* lower,
+                                                    const ColumnPredicate* upper) {
+    std::unique_ptr<FusedRangePredicate> fused;
+    static_cast<void>(((fused = try_fuse_type<Types>(lower, upper)) != nullptr || ...));
+    return fused;
+}
+
+bool is_lower_bound(PredicateType type) {
+    return type == PredicateType::GT || type == PredicateType::GE;
+}
+
+bool is_upper_bound(PredicateType type) {
+    return type == PredicateType::LT || type == PredicateType::LE;
+}
+
+} // namespace
+
+std::unique_ptr<FusedRangePredicate> FusedRangePredicate::create(const ColumnPredicate* first,
+                                                                 const ColumnPredicate* second) {
+    if (first->column_id() != second->column_id() || first->opposite() || second->opposite() ||
+        first->is_runtime_filter() || second->is_runtime_filter()) {
+        return nullptr;
+    }
+    if (is_upper_bound(first->type()) && is_lower_bound(second->type())) {
+        std::swap(first, second);
+    }
+    if (!is_lower_bound(first->type()) || !is_upper_bound(second->type())) {
+        return nullptr;
+    }
+    return try_fuse_types<TYPE_TINYINT, TYPE_SMALLINT, TYPE_INT, TYPE_BIGINT, TYPE_LARGEINT,
+                          TYPE_FLOAT, TYPE_DOUBLE, TYPE_DATEV2, TYPE_DATETIMEV2, TYPE_DECIMAL32,
+                          TYPE_DECIMAL64, TYPE_DECIMAL128I>(first, second);
+}
+
+#include "common/compile_check_end.h"
+} // namespace doris
@@ -40,7 +40,8 @@ enum class InvertedIndexParserType {
     PARSER_UNICODE = 5,
     PARSER_ICU = 6,
     PARSER_BASIC = 7,
-    PARSER_IK = 8
+    PARSER_IK = 8,
+    PARSER_NGRAM = 9
 };
 
 using CharFilterMap = std::map<std::string, std::string>;
@@ -77,6 +78,9 @@ const std::string INVERTED_INDEX_PARSER_CHINESE = "chinese";
 const std::string INVERTED_INDEX_PARSER_ICU = "icu";
 const std::string INVERTED_INDEX_PARSER_BASIC = "basic";
 const std::string INVERTED_INDEX_PARSER_IK = "ik";
+// indexes every trigram of the value, so substring patterns (LIKE '%x%') can find candidate rows
+const std::string INVERTED_INDEX_PARSER_NGRAM = "ngram";
+constexpr int32_t INVERTED_INDEX_PARSER_NGRAM_SIZE = 3;
 
 const std::string INVERTED_INDEX_PARSER_PHRASE_SUPPORT_KEY = "support_phrase";
 const std::string INVERTED_INDEX_PARSER_PHRASE_SUPPORT_YES = "true";
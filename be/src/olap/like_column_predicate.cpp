@@ -17,6 +17,11 @@
 
 #include "olap/like_column_predicate.h"
 
+#include <algorithm>
+
+#include "olap/inverted_index_parser.h"
+#include "olap/rowset/segment_v2/index_reader_helper.h"
+#include "olap/rowset/segment_v2/inverted_index_iterator.h"
 #include "runtime/define_primitive_type.h"
 #include "udf/udf.h"
 #include "vec/columns/predicate_column.h"
@@ -25,6 +30,29 @@
 
 namespace doris {
 
+std::vector<std::string> like_pattern_literal_fragments(const StringRef& pattern,
+                                                        char escape_char) {
+    std::vector<std::string> fragments;
+    std::string fragment;
+    for (size_t i = 0; i < pattern.size; ++i) {
+        char c = pattern.data[i];
+        if (c == escape_char && i + 1 < pattern.size) {
+            fragment.push_back(pattern.data[++i]);
+        } else if (c == '%' || c == '_') {
+            if (!fragment.empty()) {
+                fragments.emplace_back(std::move(fragment));
+                fragment.clear();
+            }
+        } else {
+            fragment.push_back(c);
+        }
+    }
+    if (!fragment.empty()) {
+        fragments.emplace_back(std::move(fragment));
+    }
+    return fragments;
+}
+
 template <PrimitiveType T>
 LikeColumnPredicate<T>::LikeColumnPredicate(bool opposite, uint32_t column_id,
                                             doris::FunctionContext* fn_ctx, doris::StringRef val)
@@ -144,6 +172,47 @@ uint16_t LikeColumnPredicate<T>::_evaluate_inner(const vectorized::IColumn& colu
     return new_size;
 }
 
+template <PrimitiveType T>
+Status LikeColumnPredicate<T>::evaluate(const vectorized::IndexFieldNameAndTypePair& name_with_type,
+                                        IndexIterator* iterator, uint32_t num_rows,
+                                        roaring::Roaring* bitmap) const {
+    if (iterator == nullptr) {
+        return Status::OK();
+    }
+    if (_opposite || !_state->is_like_pattern ||
+        !segment_v2::IndexReaderHelper::is_ngram_index(iterator->get_reader())) {
+        return Status::Error<ErrorCode::INVERTED_INDEX_EVALUATE_SKIPPED>(
+                "like predicate can only be evaluated by an ngram index");
+    }
+
+    char escape_char = _state->has_custom_escape ? _state->escape_char
+                                                 : vectorized::LikeSearchState::escape_char;
+    bool evaluated = false;
+    for (const auto& fragment : like_pattern_literal_fragments(pattern, escape_char)) {
+        // fragments shorter than a gram have no grams to look up
+        auto num_chars = std::count_if(fragment.begin(), fragment.end(),
+                                       [](char c) { return (c & 0xC0) != 0x80; });
+        if (num_chars < INVERTED_INDEX_PARSER_NGRAM_SIZE) {
+            continue;
+        }
+        StringRef query_value(fragment);
+        InvertedIndexParam param;
+        param.column_name = name_with_type.first;
+        param.query_value = &query_value;
+        param.query_type = InvertedIndexQueryType::MATCH_ALL_QUERY;
+        param.num_rows = num_rows;
+        param.roaring = std::make_shared<roaring::Roaring>();
+        RETURN_IF_ERROR(iterator->read_from_index(&param));
+        *bitmap &= *param.roaring;
+        evaluated = true;
+    }
+    if (!evaluated) {
+        return Status::Error<ErrorCode::INVERTED_INDEX_EVALUATE_SKIPPED>(
+                "like pattern {} has no fragment longer than a gram", get_search_str());
+    }
+    return Status::OK();
+}
+
 template class LikeColumnPredicate<TYPE_CHAR>;
 template class LikeColumnPredicate<TYPE_STRING>;
 
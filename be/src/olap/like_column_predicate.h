@@ -25,6 +25,7 @@
 #include <ostream>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "common/status.h"
 #include "olap/column_predicate.h"
@@ -47,6 +48,10 @@ namespace segment_v2 {
 class BitmapIndexIterator;
 } // namespace segment_v2
 
+// Split a LIKE pattern into the literal runs between its wildcards, with escapes removed.
+std::vector<std::string> like_pattern_literal_fragments(const StringRef& pattern,
+                                                        char escape_char);
+
 template <PrimitiveType T>
 class LikeColumnPredicate : public ColumnPredicate {
 public:
@@ -62,6 +67,12 @@ public:
         return Status::OK();
     }
 
+    // Only an ngram index can serve LIKE, it narrows the bitmap to rows holding every gram of
+    // the pattern's literal fragments. The predicate must still be rechecked on those rows.
+    Status evaluate(const vectorized::IndexFieldNameAndTypePair& name_with_type,
+                    IndexIterator* iterator, uint32_t num_rows,
+                    roaring::Roaring* bitmap) const override;
+
     bool can_do_apply_safely(PrimitiveType input_type, bool is_null) const override {
         return input_type == T || (is_string_type(input_type) && is_string_type(T));
     }
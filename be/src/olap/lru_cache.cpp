@@ -164,12 +164,16 @@ uint32_t HandleTable::element_count() const {
     return _elems;
 }
 
-LRUCache::LRUCache(LRUCacheType type, bool is_lru_k) : _type(type), _is_lru_k(is_lru_k) {
+LRUCache::LRUCache(LRUCacheType type, bool is_lru_k, CacheEvictionPolicyType eviction_policy)
+        : _type(type),
+          _eviction_policy(CacheEvictionPolicy::create(eviction_policy)),
+          _is_lru_k(is_lru_k) {
     // Make empty circular linked list
-    _lru_normal.next = &_lru_normal;
-    _lru_normal.prev = &_lru_normal;
-    _lru_durable.next = &_lru_durable;
-    _lru_durable.prev = &_lru_durable;
+    for (auto* list : {&_lru_normal, &_lru_durable, &_protected_normal, &_protected_durable}) {
+        list->next = list;
+        list->prev = list;
+        list->total_size = 0;
+    }
 }
 
 LRUCache::~LRUCache() {
@@ -241,7 +245,15 @@ bool LRUCache::_unref(LRUHandle* e) {
     return e->refs == 0;
 }
 
+LRUHandle* LRUCache::_free_list(const LRUHandle* e) {
+    if (e->priority == CachePriority::DURABLE) {
+        return e->in_protected ? &_protected_durable : &_lru_durable;
+    }
+    return e->in_protected ? &_protected_normal : &_lru_normal;
+}
+
 void LRUCache::_lru_remove(LRUHandle* e) {
+    _free_list(e)->total_size -= e->total_size;
     e->next->prev = e->prev;
     e->prev->next = e->next;
     e->prev = e->next = nullptr;
@@ -265,6 +277,7 @@ void LRUCache::_lru_remove(LRUHandle* e) {
 
 void LRUCache::_lru_append(LRUHandle* list, LRUHandle* e) {
     // Make "e" newest entry by inserting just before *list
+    list->total_size += e->total_size;
     e->next = list;
     e->prev = list->prev;
     e->prev->next = e;
@@ -289,6 +302,19 @@ void LRUCache::_lru_append(LRUHandle* list, LRUHandle* e) {
     }
 }
 
+void LRUCache::_lru_prepend(LRUHandle* list, LRUHandle* e) {
+    // Make "e" oldest entry by moving it just after *list
+    _lru_append(list, e);
+    if (list->next != e) {
+        e->prev->next = e->next;
+        e->next->prev = e->prev;
+        e->next = list->next;
+        e->prev = list;
+        list->next->prev = e;
+        list->next = e;
+    }
+}
+
 Cache::Handle* LRUCache::lookup(const CacheKey& key, uint32_t hash) {
     std::lock_guard l(_mutex);
     ++_lookup_count;
@@ -303,9 +329,15 @@ Cache::Handle* LRUCache::lookup(const CacheKey& key, uint32_t hash) {
         e->refs++;
         ++_hit_count;
         e->last_visit_time = UnixMillis();
+        e->visited = true;
+        if (_eviction_policy->promote_on_hit()) {
+            // moved to the protected list when released
+            e->in_protected = true;
+        }
     } else {
         ++_miss_count;
     }
+    _eviction_policy->on_lookup(hash);
 
     // If key not exist in cache, and is lru k cache, and key in visits list,
     // then move the key to beginning of the visits list.
@@ -344,11 +376,19 @@ void LRUCache::release(Cache::Handle* handle) {
                 _usage -= e->total_size;
                 last_ref = true;
             } else {
-                // put it to LRU free list
-                if (e->priority == CachePriority::NORMAL) {
-                    _lru_append(&_lru_normal, e);
-                } else if (e->priority == CachePriority::DURABLE) {
-                    _lru_append(&_lru_durable, e);
+                // put it to LRU free list, a probationary entry which is never hit
+                // is put to the head to be evicted first.
+                if (e->probationary && !e->visited) {
+                    _lru_prepend(_free_list(e), e);
+                } else {
+                    _lru_append(_free_list(e), e);
+                }
+                if (e->in_protected) {
+                    if (e->priority == CachePriority::NORMAL) {
+                        _demote_protected(&_lru_normal, &_protected_normal);
+                    } else {
+                        _demote_protected(&_lru_durable, &_protected_durable);
+                    }
                 }
             }
         }
@@ -388,25 +428,66 @@ void LRUCache::_evict_from_lru_with_time(size_t total_size, LRUHandle** to_remov
 
 void LRUCache::_evict_from_lru(size_t total_size, LRUHandle** to_remove_head) {
     // 1. evict normal cache entries
-    while ((_usage + total_size > _capacity || _check_element_count_limit()) &&
-           _lru_normal.next != &_lru_normal) {
-        LRUHandle* old = _lru_normal.next;
-        DCHECK(old->priority == CachePriority::NORMAL);
-        _evict_one_entry(old);
-        old->next = *to_remove_head;
-        *to_remove_head = old;
-    }
+    _evict_from_segments(&_lru_normal, &_protected_normal, total_size, to_remove_head);
     // 2. evict durable cache entries if need
-    while ((_usage + total_size > _capacity || _check_element_count_limit()) &&
-           _lru_durable.next != &_lru_durable) {
-        LRUHandle* old = _lru_durable.next;
-        DCHECK(old->priority == CachePriority::DURABLE);
+    _evict_from_segments(&_lru_durable, &_protected_durable, total_size, to_remove_head);
+}
+
+// With CacheEvictionPolicyType::LRU the protected list is always empty, so this is plain LRU.
+void LRUCache::_evict_from_segments(LRUHandle* probation, LRUHandle* protected_list,
+                                    size_t total_size, LRUHandle** to_remove_head) {
+    const auto probation_capacity = static_cast<size_t>(static_cast<double>(_capacity) *
+                                                        _eviction_policy->probation_ratio());
+    while (_usage + total_size > _capacity || _check_element_count_limit()) {
+        LRUHandle* candidate = probation->next != probation ? probation->next : nullptr;
+        LRUHandle* victim = protected_list->next != protected_list ? protected_list->next : nullptr;
+        LRUHandle* old = nullptr;
+        if (candidate != nullptr &&
+            (victim == nullptr || probation->total_size > probation_capacity)) {
+            if (_eviction_policy->promote(candidate)) {
+                _lru_remove(candidate);
+                candidate->in_protected = true;
+                candidate->visited = false;
+                _lru_append(protected_list, candidate);
+                continue;
+            }
+            _eviction_policy->on_evict(candidate);
+            old = candidate;
+        } else if (victim != nullptr) {
+            old = victim;
+        } else {
+            break;
+        }
         _evict_one_entry(old);
         old->next = *to_remove_head;
         *to_remove_head = old;
     }
 }
 
+bool LRUCache::_admit(const LRUHandle* e) {
+    if (_usage + e->total_size <= _capacity && !_check_element_count_limit()) {
+        return true;
+    }
+    for (auto* list : {&_lru_normal, &_protected_normal, &_lru_durable, &_protected_durable}) {
+        if (list->next != list) {
+            return _eviction_policy->admit(e->hash, list->next);
+        }
+    }
+    return true;
+}
+
+void LRUCache::_demote_protected(LRUHandle* probation, LRUHandle* protected_list) {
+    const auto protected_capacity = static_cast<size_t>(static_cast<double>(_capacity) *
+                                                        _eviction_policy->protected_ratio());
+    while (protected_list->total_size > protected_capacity &&
+           protected_list->next != protected_list) {
+        LRUHandle* old = protected_list->next;
+        _lru_remove(old);
+        old->in_protected = false;
+        _lru_append(probation, old);
+    }
+}
+
 void LRUCache::_evict_one_entry(LRUHandle* e) {
     DCHECK(e->in_cache);
     DCHECK(e->refs == 1); // LRU list contains elements which may be evicted
@@ -461,7 +542,7 @@ bool LRUCache::_lru_k_insert_visits_list(size_t total_size, visits_lru_cache_key
 }
 
 Cache::Handle* LRUCache::insert(const CacheKey& key, uint32_t hash, void* value, size_t charge,
-                                CachePriority priority) {
+                                CachePriority priority, bool probationary) {
     size_t handle_size = sizeof(LRUHandle) - 1 + key.size();
     auto* e = reinterpret_cast<LRUHandle*>(malloc(handle_size));
     e->value = value;
@@ -474,6 +555,9 @@ Cache::Handle* LRUCache::insert(const CacheKey& key, uint32_t hash, void* value,
     e->refs = 1; // only one for the returned handle.
     e->next = e->prev = nullptr;
     e->in_cache = false;
+    e->in_protected = false;
+    e->visited = false;
+    e->probationary = probationary;
     e->priority = priority;
     e->type = _type;
     memcpy(e->key_data, key.data(), key.size());
@@ -482,10 +566,14 @@ Cache::Handle* LRUCache::insert(const CacheKey& key, uint32_t hash, void* value,
     LRUHandle* to_remove_head = nullptr;
     {
         std::lock_guard l(_mutex);
+        _eviction_policy->on_insert(hash, _table.element_count());
 
         if (_is_lru_k && _lru_k_insert_visits_list(e->total_size, hash)) {
             return reinterpret_cast<Cache::Handle*>(e);
         }
+        if (!_admit(e)) {
+            return reinterpret_cast<Cache::Handle*>(e);
+        }
 
         // Free the space following strict LRU policy until enough space
         // is freed or the lru list is empty
@@ -498,6 +586,7 @@ Cache::Handle* LRUCache::insert(const CacheKey& key, uint32_t hash, void* value,
         // insert into the cache
         // note that the cache might get larger than its capacity if not enough
         // space was freed
+        e->in_protected = !probationary && _eviction_policy->insert_to_protected(hash);
         auto* old = _table.insert(e);
         e->in_cache = true;
         _usage += e->total_size;
@@ -563,17 +652,13 @@ PrunedInfo LRUCache::prune() {
     LRUHandle* to_remove_head = nullptr;
     {
         std::lock_guard l(_mutex);
-        while (_lru_normal.next != &_lru_normal) {
-            LRUHandle* old = _lru_normal.next;
-            _evict_one_entry(old);
-            old->next = to_remove_head;
-            to_remove_head = old;
-        }
-        while (_lru_durable.next != &_lru_durable) {
-            LRUHandle* old = _lru_durable.next;
-            _evict_one_entry(old);
-            old->next = to_remove_head;
-            to_remove_head = old;
+        for (auto* list : {&_lru_normal, &_protected_normal, &_lru_durable, &_protected_durable}) {
+            while (list->next != list) {
+                LRUHandle* old = list->next;
+                _evict_one_entry(old);
+                old->next = to_remove_head;
+                to_remove_head = old;
+            }
         }
     }
     int64_t pruned_count = 0;
@@ -592,30 +677,19 @@ PrunedInfo LRUCache::prune_if(CachePrunePredicate pred, bool lazy_mode) {
     LRUHandle* to_remove_head = nullptr;
     {
         std::lock_guard l(_mutex);
-        LRUHandle* p = _lru_normal.next;
-        while (p != &_lru_normal) {
-            LRUHandle* next = p->next;
-            if (pred(p)) {
-                _evict_one_entry(p);
-                p->next = to_remove_head;
-                to_remove_head = p;
-            } else if (lazy_mode) {
-                break;
-            }
-            p = next;
-        }
-
-        p = _lru_durable.next;
-        while (p != &_lru_durable) {
-            LRUHandle* next = p->next;
-            if (pred(p)) {
-                _evict_one_entry(p);
-                p->next = to_remove_head;
-                to_remove_head = p;
-            } else if (lazy_mode) {
-                break;
+        for (auto* list : {&_lru_normal, &_protected_normal, &_lru_durable, &_protected_durable}) {
+            LRUHandle* p = list->next;
+            while (p != list) {
+                LRUHandle* next = p->next;
+                if (pred(p)) {
+                    _evict_one_entry(p);
+                    p->next = to_remove_head;
+                    to_remove_head = p;
+                } else if (lazy_mode) {
+                    break;
+                }
+                p = next;
             }
-            p = next;
         }
     }
     int64_t pruned_count = 0;
@@ -630,6 +704,20 @@ PrunedInfo LRUCache::prune_if(CachePrunePredicate pred, bool lazy_mode) {
     return {pruned_count, pruned_size};
 }
 
+void LRUCache::for_each_entry(const CacheEntryVisitor& visitor, size_t max_entries) {
+    std::lock_guard l(_mutex);
+    size_t visited = 0;
+    // protected entries are hotter than probation ones, each list is visited from newest
+    for (auto* list : {&_protected_durable, &_protected_normal, &_lru_durable, &_lru_normal}) {
+        for (LRUHandle* p = list->prev; p != list; p = p->prev) {
+            if (visited++ >= max_entries) {
+                return;
+            }
+            visitor(p);
+        }
+    }
+}
+
 void LRUCache::set_cache_value_time_extractor(CacheValueTimeExtractor cache_value_time_extractor) {
     _cache_value_time_extractor = cache_value_time_extractor;
 }
@@ -644,7 +732,7 @@ inline uint32_t ShardedLRUCache::_hash_slice(const CacheKey& s) {
 
 ShardedLRUCache::ShardedLRUCache(const std::string& name, size_t capacity, LRUCacheType type,
                                  uint32_t num_shards, uint32_t total_element_count_capacity,
-                                 bool is_lru_k)
+                                 bool is_lru_k, CacheEvictionPolicyType eviction_policy)
         : _name(name),
           _num_shard_bits(__builtin_ctz(num_shards)),
           _num_shards(num_shards),
@@ -659,14 +747,15 @@ ShardedLRUCache::ShardedLRUCache(const std::string& name, size_t capacity, LRUCa
             (total_element_count_capacity + (_num_shards - 1)) / _num_shards;
     auto** shards = new (std::nothrow) LRUCache*[_num_shards];
     for (int s = 0; s < _num_shards; s++) {
-        shards[s] = new LRUCache(type, is_lru_k);
+        shards[s] = new LRUCache(type, is_lru_k, eviction_policy);
         shards[s]->set_capacity(per_shard);
         shards[s]->set_element_count_capacity(per_shard_element_count_capacity);
     }
     _shards = shards;
 
     _entity = DorisMetrics::instance()->metric_registry()->register_entity(
-            std::string("lru_cache:") + name, {{"name", name}});
+            std::string("lru_cache:") + name,
+            {{"name", name}, {"eviction_policy", cache_eviction_policy_string(eviction_policy)}});
     _entity->register_hook(name, std::bind(&ShardedLRUCache::update_cache_metrics, this));
     INT_GAUGE_METRIC_REGISTER(_entity, cache_capacity);
     INT_GAUGE_METRIC_REGISTER(_entity, cache_usage);
@@ -690,9 +779,10 @@ ShardedLRUCache::ShardedLRUCache(const std::string& name, size_t capacity, LRUCa
                                  uint32_t num_shards,
                                  CacheValueTimeExtractor cache_value_time_extractor,
                                  bool cache_value_check_timestamp,
-                                 uint32_t total_element_count_capacity, bool is_lru_k)
+                                 uint32_t total_element_count_capacity, bool is_lru_k,
+                                 CacheEvictionPolicyType eviction_policy)
         : ShardedLRUCache(name, capacity, type, num_shards, total_element_count_capacity,
-                          is_lru_k) {
+                          is_lru_k, eviction_policy) {
     for (int s = 0; s < _num_shards; s++) {
         _shards[s]->set_cache_value_time_extractor(cache_value_time_extractor);
         _shards[s]->set_cache_value_check_timestamp(cache_value_check_timestamp);
@@ -729,9 +819,9 @@ size_t ShardedLRUCache::get_capacity() {
 }
 
 Cache::Handle* ShardedLRUCache::insert(const CacheKey& key, void* value, size_t charge,
-                                       CachePriority priority) {
+                                       CachePriority priority, bool probationary) {
     const uint32_t hash = _hash_slice(key);
-    return _shards[_shard(hash)]->insert(key, hash, value, charge, priority);
+    return _shards[_shard(hash)]->insert(key, hash, value, charge, priority, probationary);
 }
 
 Cache::Handle* ShardedLRUCache::lookup(const CacheKey& key) {
@@ -777,6 +867,13 @@ PrunedInfo ShardedLRUCache::prune_if(CachePrunePredicate pred, bool lazy_mode) {
     return pruned_info;
 }
 
+void ShardedLRUCache::for_each_entry(const CacheEntryVisitor& visitor,
+                                     size_t max_entries_per_shard) {
+    for (int s = 0; s < _num_shards; s++) {
+        _shards[s]->for_each_entry(visitor, max_entries_per_shard);
+    }
+}
+
 int64_t ShardedLRUCache::get_usage() {
     size_t total_usage = 0;
     for (int i = 0; i < _num_shards; i++) {
@@ -827,7 +924,7 @@ void ShardedLRUCache::update_cache_metrics() const {
 }
 
 Cache::Handle* DummyLRUCache::insert(const CacheKey& key, void* value, size_t charge,
-                                     CachePriority priority) {
+                                     CachePriority priority, bool probationary) {
     size_t handle_size = sizeof(LRUHandle);
     auto* e = reinterpret_cast<LRUHandle*>(malloc(handle_size));
     e->value = value;
@@ -20,6 +20,7 @@
 #include <string>
 #include <utility>
 
+#include "olap/cache_eviction_policy.h"
 #include "runtime/memory/lru_cache_value_base.h"
 #include "util/doris_metrics.h"
 #include "util/metrics.h"
@@ -129,6 +130,7 @@ private:
 enum class CachePriority { NORMAL = 0, DURABLE = 1 };
 
 using CachePrunePredicate = std::function<bool(const LRUHandle*)>;
+using CacheEntryVisitor = std::function<void(const LRUHandle*)>;
 // CacheValueTimeExtractor can extract timestamp
 // in cache value through the specified function,
 // such as last_visit_time in InvertedIndexSearcherCache::CacheValue
@@ -161,9 +163,13 @@ public:
     //
     // if cache is lru k and cache is full, first insert of key will not succeed.
     //
+    // If probationary is true, the entry is the first to be evicted until it is hit,
+    // used for entries which are probably accessed only once, such as pages of a large scan.
+    //
     // Note: if is ShardedLRUCache, cache capacity = ShardedLRUCache_capacity / num_shards.
     virtual Handle* insert(const CacheKey& key, void* value, size_t charge,
-                           CachePriority priority = CachePriority::NORMAL) = 0;
+                           CachePriority priority = CachePriority::NORMAL,
+                           bool probationary = false) = 0;
 
     // If the cache has no mapping for "key", returns nullptr.
     //
@@ -207,6 +213,11 @@ public:
     // may hold lock for a long time to execute predicate.
     virtual PrunedInfo prune_if(CachePrunePredicate pred, bool lazy_mode = false) { return {0, 0}; }
 
+    // Visit at most max_entries_per_shard entries not actively in use of each shard,
+    // the recently used entries first. The visitor is called under the lock of shard,
+    // so it should be simple enough like the predicate of prune_if().
+    virtual void for_each_entry(const CacheEntryVisitor& visitor, size_t max_entries_per_shard) {}
+
     virtual int64_t get_usage() = 0;
 
     virtual PrunedInfo set_capacity(size_t capacity) = 0;
@@ -231,6 +242,9 @@ struct LRUHandle {
     size_t key_length;
     size_t total_size; // Entry charge, used to limit cache capacity, LRUCacheType::SIZE including key length.
     bool in_cache; // Whether entry is in the cache.
+    bool in_protected; // Whether entry belongs to the protected segment, see CacheEvictionPolicy.
+    bool visited;      // Whether entry has been hit since it was inserted or promoted.
+    bool probationary; // Whether entry is evicted first until it is hit.
     uint32_t refs;
     uint32_t hash; // Hash of key(); used for fast sharding and comparisons
     CachePriority priority = CachePriority::NORMAL;
@@ -308,7 +322,8 @@ using LRUHandleSortedSet = std::set<std::pair<int64_t, LRUHandle*>>;
 // A single shard of sharded cache.
 class LRUCache {
 public:
-    LRUCache(LRUCacheType type, bool is_lru_k = DEFAULT_LRU_CACHE_IS_LRU_K);
+    LRUCache(LRUCacheType type, bool is_lru_k = DEFAULT_LRU_CACHE_IS_LRU_K,
+             CacheEvictionPolicyType eviction_policy = DEFAULT_CACHE_EVICTION_POLICY);
     ~LRUCache();
 
     // visits_lru_cache_key is the hash value of CacheKey.
@@ -327,12 +342,14 @@ public:
     // Like Cache methods, but with an extra "hash" parameter.
     // Must call release on the returned handle pointer.
     Cache::Handle* insert(const CacheKey& key, uint32_t hash, void* value, size_t charge,
-                          CachePriority priority = CachePriority::NORMAL);
+                          CachePriority priority = CachePriority::NORMAL,
+                          bool probationary = false);
     Cache::Handle* lookup(const CacheKey& key, uint32_t hash);
     void release(Cache::Handle* handle);
     void erase(const CacheKey& key, uint32_t hash);
     PrunedInfo prune();
     PrunedInfo prune_if(CachePrunePredicate pred, bool lazy_mode = false);
+    void for_each_entry(const CacheEntryVisitor& visitor, size_t max_entries);
 
     void set_cache_value_time_extractor(CacheValueTimeExtractor cache_value_time_extractor);
     void set_cache_value_check_timestamp(bool cache_value_check_timestamp);
@@ -346,11 +363,21 @@ public:
     size_t get_capacity();
     size_t get_element_count();
 
+    CacheEvictionPolicyType get_eviction_policy() const { return _eviction_policy->type(); }
+
 private:
     void _lru_remove(LRUHandle* e);
     void _lru_append(LRUHandle* list, LRUHandle* e);
+    void _lru_prepend(LRUHandle* list, LRUHandle* e);
     bool _unref(LRUHandle* e);
     void _evict_from_lru(size_t total_size, LRUHandle** to_remove_head);
+    void _evict_from_segments(LRUHandle* probation, LRUHandle* protected_list, size_t total_size,
+                              LRUHandle** to_remove_head);
+    // The free list that `e` belongs to, by its priority and segment.
+    LRUHandle* _free_list(const LRUHandle* e);
+    void _demote_protected(LRUHandle* probation, LRUHandle* protected_list);
+    // Whether the eviction policy admits `e` into a full cache.
+    bool _admit(const LRUHandle* e);
     void _evict_from_lru_with_time(size_t total_size, LRUHandle** to_remove_head);
     void _evict_one_entry(LRUHandle* e);
     bool _check_element_count_limit();
@@ -369,9 +396,14 @@ private:
     // Dummy head of LRU list.
     // Entries have refs==1 and in_cache==true.
     // _lru_normal.prev is newest entry, _lru_normal.next is oldest entry.
+    // The total_size of a dummy head is the total size of the entries in its list.
     LRUHandle _lru_normal;
     // _lru_durable.prev is newest entry, _lru_durable.next is oldest entry.
     LRUHandle _lru_durable;
+    // Protected segments of the lists above, always empty with CacheEvictionPolicyType::LRU.
+    LRUHandle _protected_normal;
+    LRUHandle _protected_durable;
+    std::unique_ptr<CacheEvictionPolicy> _eviction_policy;
 
     HandleTable _table;
 
@@ -398,7 +430,8 @@ class ShardedLRUCache : public Cache {
 public:
     ~ShardedLRUCache() override;
     Handle* insert(const CacheKey& key, void* value, size_t charge,
-                   CachePriority priority = CachePriority::NORMAL) override;
+                   CachePriority priority = CachePriority::NORMAL,
+                   bool probationary = false) override;
     Handle* lookup(const CacheKey& key) override;
     void release(Handle* handle) override;
     void erase(const CacheKey& key) override;
@@ -406,6 +439,7 @@ public:
     uint64_t new_id() override;
     PrunedInfo prune() override;
     PrunedInfo prune_if(CachePrunePredicate pred, bool lazy_mode = false) override;
+    void for_each_entry(const CacheEntryVisitor& visitor, size_t max_entries_per_shard) override;
     int64_t get_usage() override;
     size_t get_element_count() override;
     PrunedInfo set_capacity(size_t capacity) override;
@@ -415,13 +449,15 @@ private:
     // LRUCache can only be created and managed with LRUCachePolicy.
     friend class LRUCachePolicy;
 
-    explicit ShardedLRUCache(const std::string& name, size_t capacity, LRUCacheType type,
-                             uint32_t num_shards, uint32_t element_count_capacity, bool is_lru_k);
-    explicit ShardedLRUCache(const std::string& name, size_t capacity, LRUCacheType type,
-                             uint32_t num_shards,
-                             CacheValueTimeExtractor cache_value_time_extractor,
-                             bool cache_value_check_timestamp, uint32_t element_count_capacity,
-                             bool is_lru_k);
+    explicit ShardedLRUCache(
+            const std::string& name, size_t capacity, LRUCacheType type, uint32_t num_shards,
+            uint32_t element_count_capacity, bool is_lru_k,
+            CacheEvictionPolicyType eviction_policy = DEFAULT_CACHE_EVICTION_POLICY);
+    explicit ShardedLRUCache(
+            const std::string& name, size_t capacity, LRUCacheType type, uint32_t num_shards,
+            CacheValueTimeExtractor cache_value_time_extractor, bool cache_value_check_timestamp,
+            uint32_t element_count_capacity, bool is_lru_k,
+            CacheEvictionPolicyType eviction_policy = DEFAULT_CACHE_EVICTION_POLICY);
 
     void update_cache_metrics() const;
 
@@ -461,7 +497,8 @@ class DummyLRUCache : public Cache {
 public:
     // Must call release on the returned handle pointer.
     Handle* insert(const CacheKey& key, void* value, size_t charge,
-                   CachePriority priority = CachePriority::NORMAL) override;
+                   CachePriority priority = CachePriority::NORMAL,
+                   bool probationary = false) override;
     Handle* lookup(const CacheKey& key) override { return nullptr; };
     void release(Handle* handle) override;
     void erase(const CacheKey& key) override {};
@@ -22,11 +22,14 @@
 #include <pdqsort.h>
 
 #include <algorithm>
+#include <array>
 #include <limits>
+#include <numeric>
 #include <string>
 #include <vector>
 
 #include "bvar/bvar.h"
+#include "common/cast_set.h"
 #include "common/config.h"
 #include "olap/memtable_memory_limiter.h"
 #include "olap/olap_define.h"
@@ -40,6 +43,8 @@
 #include "vec/aggregate_functions/aggregate_function_reader.h"
 #include "vec/aggregate_functions/aggregate_function_simple_factory.h"
 #include "vec/columns/column.h"
+#include "vec/columns/column_nullable.h"
+#include "vec/data_types/data_type_nullable.h"
 
 namespace doris {
 #include "common/compile_check_begin.h"
@@ -239,6 +244,7 @@ Status MemTable::insert(const vectorized::Block* input_block,
     for (int i = 0; i < num_rows; i++) {
         _row_in_blocks->emplace_back(std::make_shared<RowInBlock>(cursor_in_mutableblock + i));
     }
+    _sort_run_if_necessary();
 
     _stat.raw_rows += num_rows;
     return Status::OK();
@@ -302,19 +308,181 @@ Status MemTable::_put_into_output(vectorized::Block& in_block) {
                                           row_pos_vec.data() + in_block.rows());
 }
 
-size_t MemTable::_sort() {
-    SCOPED_RAW_TIMER(&_stat.sort_ns);
-    _stat.sort_times++;
+bool NormalizedKeySorter::init(const vectorized::MutableBlock& block, size_t num_key_columns,
+                               DorisVector<uint32_t> row_pos) {
+    struct KeyColumn {
+        const uint8_t* null_map;
+        const uint8_t* data;
+        size_t width;
+        bool is_signed;
+    };
+    std::vector<KeyColumn> key_columns;
+    _key_width = 0;
+    for (size_t i = 0; i < num_key_columns; ++i) {
+        const auto* column = block.get_column_by_position(i).get();
+        const uint8_t* null_map = nullptr;
+        if (column->is_nullable()) {
+            const auto& nullable_column = assert_cast<const vectorized::ColumnNullable&>(*column);
+            null_map = nullable_column.get_null_map_data().data();
+            column = &nullable_column.get_nested_column();
+        }
+        size_t width = 0;
+        bool is_signed = true;
+        switch (vectorized::remove_nullable(block.get_datatype_by_position(i))
+                        ->get_primitive_type()) {
+        case TYPE_BOOLEAN:
+            is_signed = false;
+            [[fallthrough]];
+        case TYPE_TINYINT:
+            width = 1;
+            break;
+        case TYPE_SMALLINT:
+            width = 2;
+            break;
+        case TYPE_DATEV2:
+            is_signed = false;
+            [[fallthrough]];
+        case TYPE_INT:
+        case TYPE_DECIMAL32:
+            width = 4;
+            break;
+        case TYPE_DATETIMEV2:
+            is_signed = false;
+            [[fallthrough]];
+        case TYPE_BIGINT:
+        case TYPE_DECIMAL64:
+            width = 8;
+            break;
+        case TYPE_LARGEINT:
+        case TYPE_DECIMAL128I:
+            width = 16;
+            break;
+        default:
+            return false;
+        }
+        auto raw_data = column->get_raw_data();
+        if (raw_data.size != column->size() * width) {
+            return false;
+        }
+        key_columns.push_back({null_map, reinterpret_cast<const uint8_t*>(raw_data.data), width,
+                               is_signed});
+        _key_width += width + (null_map != nullptr);
+    }
+    if (_key_width == 0 || _key_width > MAX_KEY_WIDTH) {
+        return false;
+    }
+
+    _row_pos = std::move(row_pos);
+    _keys.resize(_row_pos.size() * _key_width);
+    uint8_t* key = _keys.data();
+    for (auto pos : _row_pos) {
+        for (const auto& key_column : key_columns) {
+            if (key_column.null_map != nullptr) {
+                // null is the smallest, the same as compare_at with nan_direction_hint -1
+                bool is_null = key_column.null_map[pos];
+                *key++ = !is_null;
+                if (is_null) {
+                    memset(key, 0, key_column.width);
+                    key += key_column.width;
+                    continue;
+                }
+            }
+            // big endian with the sign bit flipped, so that memcmp orders like the value
+            const uint8_t* value = key_column.data + pos * key_column.width;
+            for (size_t b = 0; b < key_column.width; ++b) {
+                key[b] = value[key_column.width - 1 - b];
+            }
+            if (key_column.is_signed) {
+                key[0] = static_cast<uint8_t>(key[0] ^ 0x80);
+            }
+            key += key_column.width;
+        }
+    }
+    return true;
+}
+
+DorisVector<uint32_t> NormalizedKeySorter::sort(bool reverse_ties) const {
+    auto num_rows = cast_set<uint32_t>(_row_pos.size());
+    DorisVector<uint32_t> order(num_rows);
+    std::iota(order.begin(), order.end(), 0);
+    auto by_row_pos = [&](uint32_t lhs, uint32_t rhs) { return _row_pos[lhs] < _row_pos[rhs]; };
+    if (!std::is_sorted(order.begin(), order.end(), by_row_pos)) {
+        pdqsort(order.begin(), order.end(), by_row_pos);
+    }
+    if (reverse_ties) {
+        std::reverse(order.begin(), order.end());
+    }
+
+    DorisVector<uint32_t> buffer(num_rows);
+    std::array<uint32_t, 257> counts;
+    for (size_t byte = _key_width; byte-- > 0;) {
+        counts.fill(0);
+        for (auto row : order) {
+            counts[_keys[row * _key_width + byte] + 1]++;
+        }
+        // all rows share this byte
+        if (std::find(counts.begin() + 1, counts.end(), num_rows) != counts.end()) {
+            continue;
+        }
+        for (size_t b = 1; b < counts.size(); ++b) {
+            counts[b] += counts[b - 1];
+        }
+        for (auto row : order) {
+            buffer[counts[_keys[row * _key_width + byte]]++] = row;
+        }
+        order.swap(buffer);
+    }
+    return order;
+}
+
+size_t MemTable::_sort_by_normalized_key(const NormalizedKeySorter& sorter, size_t begin,
+                                         bool is_dup) {
+    auto order = sorter.sort(is_dup);
+    auto new_rows_begin = std::next(_row_in_blocks->begin(), begin);
+    DorisVector<std::shared_ptr<RowInBlock>> sorted_rows;
+    sorted_rows.reserve(order.size());
+    for (auto idx : order) {
+        sorted_rows.push_back(std::move(*std::next(new_rows_begin, idx)));
+    }
+    std::move(sorted_rows.begin(), sorted_rows.end(), new_rows_begin);
+
+    size_t same_keys_num = 0;
+    size_t run_begin = 0;
+    for (size_t i = 1; i <= order.size(); ++i) {
+        if (i == order.size() || !sorter.key_equals(order[i - 1], order[i])) {
+            if (i - run_begin > 1) {
+                same_keys_num += i - run_begin;
+            }
+            run_begin = i;
+        }
+    }
+    return same_keys_num;
+}
+
+size_t MemTable::_sort_rows(size_t begin) {
     size_t same_keys_num = 0;
-    // sort new rows
-    Tie tie = Tie(_last_sorted_pos, _row_in_blocks->size());
+    bool is_dup = (_keys_type == KeysType::DUP_KEYS);
+    NormalizedKeySorter sorter;
+    bool use_normalized_key = false;
+    if (config::enable_memtable_normalized_key_sort) {
+        DorisVector<uint32_t> row_pos;
+        row_pos.reserve(_row_in_blocks->size() - begin);
+        for (size_t i = begin; i < _row_in_blocks->size(); ++i) {
+            row_pos.push_back((*_row_in_blocks)[i]->_row_pos);
+        }
+        use_normalized_key = sorter.init(_input_mutable_block, _tablet_schema->num_key_columns(),
+                                         std::move(row_pos));
+    }
+    if (use_normalized_key) {
+        return _sort_by_normalized_key(sorter, begin, is_dup);
+    }
+    Tie tie = Tie(begin, _row_in_blocks->size());
     for (size_t i = 0; i < _tablet_schema->num_key_columns(); i++) {
         auto cmp = [&](RowInBlock* lhs, RowInBlock* rhs) -> int {
             return _input_mutable_block.compare_one_column(lhs->_row_pos, rhs->_row_pos, i, -1);
         };
         _sort_one_column(*_row_in_blocks, tie, cmp);
     }
-    bool is_dup = (_keys_type == KeysType::DUP_KEYS);
     // sort extra round by _row_pos to make the sort stable
     auto iter = tie.iter();
     while (iter.next()) {
@@ -326,8 +494,11 @@ size_t MemTable::_sort() {
                 });
         same_keys_num += iter.right() - iter.left();
     }
-    // merge new rows and old rows
-    _vec_row_comparator->set_block(&_input_mutable_block);
+    return same_keys_num;
+}
+
+void MemTable::_merge_runs(size_t begin, size_t mid, size_t end, size_t& same_keys_num) {
+    bool is_dup = (_keys_type == KeysType::DUP_KEYS);
     auto cmp_func = [this, is_dup, &same_keys_num](const std::shared_ptr<RowInBlock>& l,
                                                    const std::shared_ptr<RowInBlock>& r) -> bool {
         auto value = (*(this->_vec_row_comparator))(l.get(), r.get());
@@ -338,8 +509,62 @@ size_t MemTable::_sort() {
             return value < 0;
         }
     };
-    auto new_row_it = std::next(_row_in_blocks->begin(), _last_sorted_pos);
-    std::inplace_merge(_row_in_blocks->begin(), new_row_it, _row_in_blocks->end(), cmp_func);
+    if (begin == mid || mid == end) {
+        return;
+    }
+    // runs of roughly ordered streams often need no merge at all
+    if (!cmp_func((*_row_in_blocks)[mid], (*_row_in_blocks)[mid - 1])) {
+        return;
+    }
+    std::inplace_merge(std::next(_row_in_blocks->begin(), begin),
+                       std::next(_row_in_blocks->begin(), mid),
+                       std::next(_row_in_blocks->begin(), end), cmp_func);
+}
+
+void MemTable::_sort_run_if_necessary() {
+    if (config::memtable_sort_run_min_rows <= 0 || _tablet_schema->num_key_columns() == 0) {
+        return;
+    }
+    size_t run_begin = _sorted_run_ends.empty() ? _last_sorted_pos : _sorted_run_ends.back();
+    if (_row_in_blocks->size() - run_begin < cast_set<size_t>(config::memtable_sort_run_min_rows)) {
+        return;
+    }
+    SCOPED_RAW_TIMER(&_stat.sort_ns);
+    _same_keys_in_runs += _sort_rows(run_begin);
+    _sorted_run_ends.push_back(_row_in_blocks->size());
+}
+
+size_t MemTable::_sort() {
+    SCOPED_RAW_TIMER(&_stat.sort_ns);
+    _stat.sort_times++;
+    size_t same_keys_num = _same_keys_in_runs;
+    // sort new rows not yet sorted as a run
+    size_t run_begin = _sorted_run_ends.empty() ? _last_sorted_pos : _sorted_run_ends.back();
+    if (run_begin < _row_in_blocks->size()) {
+        same_keys_num += _sort_rows(run_begin);
+        _sorted_run_ends.push_back(_row_in_blocks->size());
+    }
+    // merge old rows and the sorted runs of new rows pairwise
+    _vec_row_comparator->set_block(&_input_mutable_block);
+    DorisVector<size_t> bounds {0};
+    if (_last_sorted_pos > 0) {
+        bounds.push_back(_last_sorted_pos);
+    }
+    bounds.insert(bounds.end(), _sorted_run_ends.begin(), _sorted_run_ends.end());
+    while (bounds.size() > 2) {
+        DorisVector<size_t> merged_bounds {0};
+        for (size_t i = 0; i + 1 < bounds.size(); i += 2) {
+            if (i + 2 < bounds.size()) {
+                _merge_runs(bounds[i], bounds[i + 1], bounds[i + 2], same_keys_num);
+                merged_bounds.push_back(bounds[i + 2]);
+            } else {
+                merged_bounds.push_back(bounds[i + 1]);
+            }
+        }
+        bounds.swap(merged_bounds);
+    }
+    _sorted_run_ends.clear();
+    _same_keys_in_runs = 0;
     _last_sorted_pos = _row_in_blocks->size();
     return same_keys_num;
 }
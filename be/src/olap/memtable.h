@@ -128,6 +128,31 @@ private:
     std::vector<uint8_t> _bits;
 };
 
+// Sorts rows by their key columns encoded as fixed width, memcmp-able normalized keys,
+// with a stable LSD radix sort over plain row indices. Only fixed width integer like key
+// columns (integers, decimals, boolean, datev2 and datetimev2) can be normalized.
+class NormalizedKeySorter {
+public:
+    static constexpr size_t MAX_KEY_WIDTH = 64;
+
+    // Encode the first `num_key_columns` columns of `block` at `row_pos`.
+    // Returns false if any key column can not be normalized.
+    bool init(const vectorized::MutableBlock& block, size_t num_key_columns,
+              DorisVector<uint32_t> row_pos);
+    // Returns indices into `row_pos` in key order. Equal keys are ordered by row_pos,
+    // ascending or descending if `reverse_ties`.
+    DorisVector<uint32_t> sort(bool reverse_ties) const;
+    bool key_equals(uint32_t lhs, uint32_t rhs) const {
+        return memcmp(_keys.data() + lhs * _key_width, _keys.data() + rhs * _key_width,
+                      _key_width) == 0;
+    }
+
+private:
+    DorisVector<uint32_t> _row_pos;
+    size_t _key_width = 0;
+    DorisVector<uint8_t> _keys;
+};
+
 class RowInBlockComparator {
 public:
     RowInBlockComparator(std::shared_ptr<TabletSchema> tablet_schema)
@@ -177,6 +202,7 @@ public:
     ~MemTable();
 
     int64_t tablet_id() const { return _tablet_id; }
+    KeysType keys_type() const { return _keys_type; }
     size_t memory_usage() const { return _mem_tracker->consumption(); }
     size_t get_flush_reserve_memory_size() const;
     // insert tuple from (row_pos) to (row_pos+num_rows)
@@ -245,12 +271,23 @@ private:
     vectorized::MutableBlock _input_mutable_block;
     vectorized::MutableBlock _output_mutable_block;
     size_t _last_sorted_pos = 0;
+    // ends of the runs after _last_sorted_pos that were sorted at insert time
+    DorisVector<size_t> _sorted_run_ends;
+    size_t _same_keys_in_runs = 0;
 
     //return number of same keys
     size_t _sort();
     Status _sort_by_cluster_keys();
     void _sort_one_column(DorisVector<std::shared_ptr<RowInBlock>>& row_in_blocks, Tie& tie,
                           std::function<int(RowInBlock*, RowInBlock*)> cmp);
+    // sort rows from `begin` by normalized keys, return number of same keys
+    size_t _sort_by_normalized_key(const NormalizedKeySorter& sorter, size_t begin, bool is_dup);
+    // sort rows from `begin` to the end of _row_in_blocks, return number of same keys
+    size_t _sort_rows(size_t begin);
+    // merge the adjacent sorted runs [begin, mid) and [mid, end) of _row_in_blocks
+    void _merge_runs(size_t begin, size_t mid, size_t end, size_t& same_keys_num);
+    // sort the rows inserted since the last run as a new run, see memtable_sort_run_min_rows
+    void _sort_run_if_necessary();
     template <bool is_final>
     void _finalize_one_row(RowInBlock* row, const vectorized::ColumnsWithTypeAndName& block_data,
                            int row_pos);
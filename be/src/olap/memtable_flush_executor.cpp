@@ -17,6 +17,7 @@
 
 #include "olap/memtable_flush_executor.h"
 
+#include <bvar/latency_recorder.h>
 #include <gen_cpp/olap_file.pb.h>
 
 #include <algorithm>
@@ -41,6 +42,10 @@ namespace doris {
 using namespace ErrorCode;
 
 bvar::Adder<int64_t> g_flush_task_num("memtable_flush_task_num");
+// latency(us) of flushing one memtable, by keys type of the tablet
+bvar::LatencyRecorder g_dup_keys_flush_latency("memtable_flush", "dup_keys");
+bvar::LatencyRecorder g_unique_keys_flush_latency("memtable_flush", "unique_keys");
+bvar::LatencyRecorder g_agg_keys_flush_latency("memtable_flush", "agg_keys");
 
 class MemtableFlushTask final : public Runnable {
     ENABLE_FACTORY_CREATOR(MemtableFlushTask);
@@ -213,6 +218,17 @@ Status FlushToken::_do_flush_memtable(MemTable* memtable, int32_t segment_id, in
     _memtable_stat += memtable->stat();
     DorisMetrics::instance()->memtable_flush_total->increment(1);
     DorisMetrics::instance()->memtable_flush_duration_us->increment(duration_ns / 1000);
+    switch (memtable->keys_type()) {
+    case KeysType::DUP_KEYS:
+        g_dup_keys_flush_latency << duration_ns / 1000;
+        break;
+    case KeysType::UNIQUE_KEYS:
+        g_unique_keys_flush_latency << duration_ns / 1000;
+        break;
+    default:
+        g_agg_keys_flush_latency << duration_ns / 1000;
+        break;
+    }
     VLOG_CRITICAL << "after flush memtable for tablet: " << memtable->tablet_id()
                   << ", flushsize: " << PrettyPrinter::print_bytes(*flush_size);
     return Status::OK();
@@ -26,6 +26,7 @@
 #include "util/doris_metrics.h"
 #include "util/mem_info.h"
 #include "util/metrics.h"
+#include "util/time.h"
 
 namespace doris {
 DEFINE_GAUGE_METRIC_PROTOTYPE_5ARG(memtable_memory_limiter_mem_consumption, MetricUnit::BYTES, "",
@@ -42,6 +43,7 @@ bvar::Status<int64_t> g_load_hard_mem_limit("mm_limiter_limit_hard", 0);
 bvar::Status<int64_t> g_load_soft_mem_limit("mm_limiter_limit_soft", 0);
 bvar::Adder<int> g_memtable_memory_limit_flush_memtable_count("mm_limiter_flush_memtable_count");
 bvar::LatencyRecorder g_memtable_memory_limit_flush_size_bytes("mm_limiter_flush_size_bytes");
+bvar::Adder<int> g_memtable_memory_limit_forecast_flush_count("mm_limiter_forecast_flush_count");
 
 // Calculate the total memory limit of all load tasks on this BE
 static int64_t calc_process_max_load_memory(int64_t process_mem_limit) {
@@ -297,6 +299,7 @@ int64_t MemTableMemoryLimiter::_flush_active_memtables(uint64_t wg_id, int64_t n
 void MemTableMemoryLimiter::refresh_mem_tracker() {
     std::lock_guard<std::mutex> l(_lock);
     _refresh_mem_tracker();
+    _flush_by_forecast();
     std::stringstream ss;
     Limit limit = Limit::NONE;
     if (_soft_limit_reached()) {
@@ -327,6 +330,36 @@ void MemTableMemoryLimiter::refresh_mem_tracker() {
     }
 }
 
+// Flushing only once the soft limit is crossed makes writers wait for the flush. Estimate
+// the growth of load memory from the recent ingest rate and start flushing early enough.
+void MemTableMemoryLimiter::_flush_by_forecast() {
+    int64_t now_ns = MonotonicNanos();
+    if (_last_forecast_ns > 0 && now_ns > _last_forecast_ns) {
+        double rate = static_cast<double>(_mem_usage - _last_forecast_mem_usage) /
+                      static_cast<double>(now_ns - _last_forecast_ns);
+        _ingest_bytes_per_ns = _ingest_bytes_per_ns * 0.7 + rate * 0.3;
+    }
+    _last_forecast_ns = now_ns;
+    _last_forecast_mem_usage = _mem_usage;
+
+    int64_t horizon_ms = config::memtable_flush_forecast_horizon_ms;
+    if (horizon_ms <= 0 || _ingest_bytes_per_ns <= 0 || _load_soft_mem_limit <= 0 ||
+        _soft_limit_reached()) {
+        // once the soft limit is reached, writers flush by themselves
+        return;
+    }
+    auto forecast_mem_usage =
+            _mem_usage + static_cast<int64_t>(_ingest_bytes_per_ns *
+                                              static_cast<double>(horizon_ms * 1000 * 1000));
+    // memory of memtables waiting for or under flush is going to be released
+    int64_t need_flush =
+            forecast_mem_usage - _load_soft_mem_limit - _queue_mem_usage - _flush_mem_usage;
+    if (need_flush > 0) {
+        g_memtable_memory_limit_forecast_flush_count << 1;
+        _flush_active_memtables(0, need_flush);
+    }
+}
+
 void MemTableMemoryLimiter::_refresh_mem_tracker() {
     _flush_mem_usage = 0;
     _queue_mem_usage = 0;
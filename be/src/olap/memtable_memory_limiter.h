@@ -69,6 +69,7 @@ private:
     int64_t _need_flush();
     int64_t _flush_active_memtables(uint64_t wg_id, int64_t need_flush);
     void _refresh_mem_tracker();
+    void _flush_by_forecast();
 
     std::mutex _lock;
     std::condition_variable _hard_limit_end_cond;
@@ -87,6 +88,11 @@ private:
     MonotonicStopWatch _log_timer;
     static const int64_t LOG_INTERVAL = 1 * 1000 * 1000 * 1000; // 1s
 
+    // state of the ingest rate forecast, see memtable_flush_forecast_horizon_ms
+    int64_t _last_forecast_ns = 0;
+    int64_t _last_forecast_mem_usage = 0;
+    double _ingest_bytes_per_ns = 0;
+
     std::vector<std::weak_ptr<MemTableWriter>> _writers;
     std::vector<std::weak_ptr<MemTableWriter>> _active_writers;
 };
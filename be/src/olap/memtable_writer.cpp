@@ -17,6 +17,7 @@
 
 #include "olap/memtable_writer.h"
 
+#include <bvar/latency_recorder.h>
 #include <fmt/format.h>
 
 #include <filesystem>
@@ -41,13 +42,18 @@
 #include "runtime/exec_env.h"
 #include "runtime/memory/mem_tracker.h"
 #include "service/backend_options.h"
+#include "util/defer_op.h"
 #include "util/mem_info.h"
 #include "util/stopwatch.hpp"
+#include "util/time.h"
 #include "vec/core/block.h"
 
 namespace doris {
 using namespace ErrorCode;
 
+bvar::LatencyRecorder g_memtable_insert_latency("memtable_writer", "insert");
+bvar::LatencyRecorder g_memtable_writer_close_wait_latency("memtable_writer", "close_wait");
+
 MemTableWriter::MemTableWriter(const WriteRequest& req) : _req(req) {}
 
 MemTableWriter::~MemTableWriter() {
@@ -104,7 +110,9 @@ Status MemTableWriter::write(const vectorized::Block* block,
     }
 
     _total_received_rows += row_idxs.size();
+    int64_t insert_start_us = MonotonicMicros();
     auto st = _mem_table->insert(block, row_idxs);
+    g_memtable_insert_latency << MonotonicMicros() - insert_start_us;
 
     // Reset memtable immediately after insert failure to prevent potential flush operations.
     // This is a defensive measure because:
@@ -237,6 +245,10 @@ Status MemTableWriter::close() {
 }
 
 Status MemTableWriter::_do_close_wait() {
+    int64_t close_wait_start_us = MonotonicMicros();
+    Defer record_close_wait_latency {[&]() {
+        g_memtable_writer_close_wait_latency << MonotonicMicros() - close_wait_start_us;
+    }};
     SCOPED_RAW_TIMER(&_close_wait_time_ns);
     std::lock_guard<std::mutex> l(_lock);
     DCHECK(_is_init)
@@ -17,12 +17,14 @@
 
 #include "olap/merger.h"
 
+#include <bvar/bvar.h>
 #include <gen_cpp/olap_file.pb.h>
 #include <gen_cpp/types.pb.h>
 #include <stddef.h>
 #include <unistd.h>
 
 #include <algorithm>
+#include <chrono>
 #include <iterator>
 #include <memory>
 #include <mutex>
@@ -30,6 +32,7 @@
 #include <ostream>
 #include <shared_mutex>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -37,6 +40,7 @@
 #include "common/config.h"
 #include "common/logging.h"
 #include "common/status.h"
+#include "cpp/sync_point.h"
 #include "olap/base_tablet.h"
 #include "olap/iterators.h"
 #include "olap/olap_common.h"
@@ -52,6 +56,7 @@
 #include "olap/tablet_meta.h"
 #include "olap/tablet_reader.h"
 #include "olap/utils.h"
+#include "runtime/memory/global_memory_arbitrator.h"
 #include "util/slice.h"
 #include "vec/core/block.h"
 #include "vec/olap/block_reader.h"
@@ -60,6 +65,40 @@
 
 namespace doris {
 #include "common/compile_check_begin.h"
+
+bvar::Adder<int64_t> g_compaction_memory_wait_ms("compaction", "memory_wait_ms");
+
+// Merges stop between blocks once the engine is stopped or the BE starts draining.
+static bool merge_stopped() {
+    return ExecEnv::GetInstance()->storage_engine().stopped() || ExecEnv::is_draining();
+}
+
+// While the process is above its soft memory limit, pause the merge between blocks so that
+// the memory GC can reclaim from queries and caches instead of cancelling the compaction.
+// `waited_ms` accumulates over the whole merge, including all column groups of a vertical merge,
+// and is bounded by compaction_memory_wait_max_ms.
+static void wait_for_memory(const BaseTablet& tablet, int64_t* waited_ms) {
+    constexpr int64_t wait_step_ms = 100;
+    auto exceed_soft_mem_limit = []() {
+        bool exceed = GlobalMemoryArbitrator::is_exceed_soft_mem_limit();
+        TEST_SYNC_POINT_CALLBACK("Merger::wait_for_memory", &exceed);
+        return exceed;
+    };
+    bool logged = false;
+    while (*waited_ms < config::compaction_memory_wait_max_ms && exceed_soft_mem_limit() &&
+           !merge_stopped()) {
+        if (!logged) {
+            LOG(INFO) << "pause compaction of tablet " << tablet.tablet_id()
+                      << " until process memory drops below the soft limit, "
+                      << GlobalMemoryArbitrator::process_mem_log_str();
+            logged = true;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(wait_step_ms));
+        *waited_ms += wait_step_ms;
+        g_compaction_memory_wait_ms << wait_step_ms;
+    }
+}
+
 Status Merger::vmerge_rowsets(BaseTabletSPtr tablet, ReaderType reader_type,
                               const TabletSchema& cur_tablet_schema,
                               const std::vector<RowsetReaderSharedPtr>& src_rowset_readers,
@@ -108,14 +147,16 @@ Status Merger::vmerge_rowsets(BaseTabletSPtr tablet, ReaderType reader_type,
 
     vectorized::Block block = cur_tablet_schema.create_block(reader_params.return_columns);
     size_t output_rows = 0;
+    int64_t memory_waited_ms = 0;
     bool eof = false;
-    while (!eof && !ExecEnv::GetInstance()->storage_engine().stopped()) {
+    while (!eof && !merge_stopped()) {
         auto tablet_state = tablet->tablet_state();
         if (tablet_state != TABLET_RUNNING && tablet_state != TABLET_NOTREADY) {
             tablet->clear_cache();
             return Status::Error<INTERNAL_ERROR>("tablet {} is not used any more",
                                                  tablet->tablet_id());
         }
+        wait_for_memory(*tablet, &memory_waited_ms);
 
         // Read one block from block reader
         RETURN_NOT_OK_STATUS_WITH_WARN(reader.next_block_with_aggregation(&block, &eof),
@@ -135,9 +176,10 @@ Status Merger::vmerge_rowsets(BaseTabletSPtr tablet, ReaderType reader_type,
         output_rows += block.rows();
         block.clear_column_data();
     }
-    if (ExecEnv::GetInstance()->storage_engine().stopped()) {
-        return Status::Error<INTERNAL_ERROR>("tablet {} failed to do compaction, engine stopped",
-                                             tablet->tablet_id());
+    if (merge_stopped()) {
+        return Status::Error<INTERNAL_ERROR>(
+                "tablet {} failed to do compaction, engine stopped or draining",
+                tablet->tablet_id());
     }
 
     if (stats_output != nullptr) {
@@ -247,7 +289,7 @@ Status Merger::vertical_compact_one_group(
         const std::vector<RowsetReaderSharedPtr>& src_rowset_readers,
         RowsetWriter* dst_rowset_writer, uint32_t max_rows_per_segment, Statistics* stats_output,
         std::vector<uint32_t> key_group_cluster_key_idxes, int64_t batch_size,
-        CompactionSampleInfo* sample_info) {
+        CompactionSampleInfo* sample_info, int64_t* memory_waited_ms) {
     // build tablet reader
     VLOG_NOTICE << "vertical compact one group, max_rows_per_segment=" << max_rows_per_segment;
     vectorized::VerticalBlockReader reader(row_source_buf);
@@ -295,13 +337,14 @@ Status Merger::vertical_compact_one_group(
     vectorized::Block block = tablet_schema.create_block(reader_params.return_columns);
     size_t output_rows = 0;
     bool eof = false;
-    while (!eof && !ExecEnv::GetInstance()->storage_engine().stopped()) {
+    while (!eof && !merge_stopped()) {
         auto tablet_state = tablet->tablet_state();
         if (tablet_state != TABLET_RUNNING && tablet_state != TABLET_NOTREADY) {
             tablet->clear_cache();
             return Status::Error<INTERNAL_ERROR>("tablet {} is not used any more",
                                                  tablet->tablet_id());
         }
+        wait_for_memory(*tablet, memory_waited_ms);
         // Read one block from block reader
         RETURN_NOT_OK_STATUS_WITH_WARN(reader.next_block_with_aggregation(&block, &eof),
                                        "failed to read next block when merging rowsets of tablet " +
@@ -321,9 +364,10 @@ Status Merger::vertical_compact_one_group(
         output_rows += block.rows();
         block.clear_column_data();
     }
-    if (ExecEnv::GetInstance()->storage_engine().stopped()) {
-        return Status::Error<INTERNAL_ERROR>("tablet {} failed to do compaction, engine stopped",
-                                             tablet->tablet_id());
+    if (merge_stopped()) {
+        return Status::Error<INTERNAL_ERROR>(
+                "tablet {} failed to do compaction, engine stopped or draining",
+                tablet->tablet_id());
     }
 
     if (is_key && stats_output != nullptr) {
@@ -357,7 +401,7 @@ Status Merger::vertical_compact_one_group(
     vectorized::Block block = tablet_schema.create_block(column_group);
     size_t output_rows = 0;
     bool eof = false;
-    while (!eof && !ExecEnv::GetInstance()->storage_engine().stopped()) {
+    while (!eof && !merge_stopped()) {
         // Read one block from block reader
         RETURN_NOT_OK_STATUS_WITH_WARN(src_block_reader.next_block_with_aggregation(&block, &eof),
                                        "failed to read next block when merging rowsets of tablet " +
@@ -375,9 +419,9 @@ Status Merger::vertical_compact_one_group(
         output_rows += block.rows();
         block.clear_column_data();
     }
-    if (ExecEnv::GetInstance()->storage_engine().stopped()) {
-        return Status::Error<INTERNAL_ERROR>("tablet {} failed to do compaction, engine stopped",
-                                             tablet_id);
+    if (merge_stopped()) {
+        return Status::Error<INTERNAL_ERROR>(
+                "tablet {} failed to do compaction, engine stopped or draining", tablet_id);
     }
 
     if (is_key && stats_output != nullptr) {
@@ -407,7 +451,10 @@ Status Merger::vertical_compact_one_group(
     return Status::OK();
 }
 
-int64_t estimate_batch_size(int group_index, BaseTabletSPtr tablet, int64_t way_cnt) {
+// `disk_bytes_per_row` is the on-disk size per row of the group in the input rowsets, used until
+// the group has been sampled by a previous compaction.
+int64_t estimate_batch_size(int group_index, BaseTabletSPtr tablet, int64_t way_cnt,
+                            int64_t disk_bytes_per_row) {
     std::unique_lock<std::mutex> lock(tablet->sample_info_lock);
     CompactionSampleInfo info = tablet->sample_infos[group_index];
     if (way_cnt <= 0) {
@@ -432,6 +479,10 @@ int64_t estimate_batch_size(int group_index, BaseTabletSPtr tablet, int64_t way_
     } else if (info.group_data_size <= 0 && info.bytes > 0 && info.rows > 0) {
         group_data_size = info.bytes / info.rows;
         tablet->sample_infos[group_index].group_data_size = group_data_size;
+    } else if (disk_bytes_per_row > 0) {
+        // decoded blocks are usually a few times larger than the compressed pages
+        constexpr int64_t decoded_to_disk_ratio = 4;
+        group_data_size = disk_bytes_per_row * decoded_to_disk_ratio;
     } else {
         LOG(INFO) << "estimate batch size for vertical compaction, tablet id: "
                   << tablet->tablet_id() << " group data size: " << info.group_data_size
@@ -479,18 +530,34 @@ Status Merger::vertical_merge_rowsets(BaseTabletSPtr tablet, ReaderType reader_t
         std::unique_lock<std::mutex> lock(tablet->sample_info_lock);
         tablet->sample_infos.resize(column_groups.size(), {0, 0, 0});
     }
+    int64_t input_data_size = 0;
+    int64_t input_rows = 0;
+    for (const auto& rs_reader : src_rowset_readers) {
+        input_data_size += rs_reader->rowset()->data_disk_size();
+        input_rows += static_cast<int64_t>(rs_reader->rowset()->num_rows());
+    }
+    auto num_columns = static_cast<int64_t>(tablet_schema.num_columns());
+    // the memory pause is bounded for the whole merge, not for each group
+    int64_t memory_waited_ms = 0;
     // compact group one by one
     for (auto i = 0; i < column_groups.size(); ++i) {
         VLOG_NOTICE << "row source size: " << row_sources_buf.total_size();
         bool is_key = (i == 0);
-        int64_t batch_size = config::compaction_batch_size != -1
-                                     ? config::compaction_batch_size
-                                     : estimate_batch_size(i, tablet, merge_way_num);
+        // share the input disk size among the groups by their column count
+        int64_t disk_bytes_per_row =
+                input_rows > 0 && num_columns > 0
+                        ? input_data_size / input_rows *
+                                  static_cast<int64_t>(column_groups[i].size()) / num_columns
+                        : 0;
+        int64_t batch_size =
+                config::compaction_batch_size != -1
+                        ? config::compaction_batch_size
+                        : estimate_batch_size(i, tablet, merge_way_num, disk_bytes_per_row);
         CompactionSampleInfo sample_info;
         Status st = vertical_compact_one_group(
                 tablet, reader_type, tablet_schema, is_key, column_groups[i], &row_sources_buf,
                 src_rowset_readers, dst_rowset_writer, max_rows_per_segment, stats_output,
-                key_group_cluster_key_idxes, batch_size, &sample_info);
+                key_group_cluster_key_idxes, batch_size, &sample_info, &memory_waited_ms);
         {
             std::unique_lock<std::mutex> lock(tablet->sample_info_lock);
             tablet->sample_infos[i] = sample_info;
@@ -322,6 +322,8 @@ struct OlapReaderStatistics {
     int64_t lazy_read_ns = 0;
     int64_t block_lazy_read_seek_num = 0;
     int64_t block_lazy_read_seek_ns = 0;
+    // batches whose non-predicate columns were read as a rowid range
+    int64_t block_lazy_read_range_num = 0;
 
     int64_t raw_rows_read = 0;
 
@@ -360,6 +362,8 @@ struct OlapReaderStatistics {
 
     int64_t total_pages_num = 0;
     int64_t cached_pages_num = 0;
+    // bytes of the pages served by the storage page cache
+    int64_t bytes_read_from_page_cache = 0;
 
     int64_t rows_bitmap_index_filtered = 0;
     int64_t bitmap_index_filter_timer = 0;
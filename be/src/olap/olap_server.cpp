@@ -345,6 +345,17 @@ Status StorageEngine::start_bg_threads(std::shared_ptr<WorkloadGroup> wg_sptr) {
                             .set_max_threads(config::tablet_publish_txn_max_thread)
                             .build(&_tablet_publish_txn_thread_pool));
 
+    RETURN_IF_ERROR(ThreadPoolBuilder("SchemaChangeConvertThreadPool")
+                            .set_min_threads(1)
+                            .set_max_threads(
+                                    std::max(config::schema_change_convert_rowset_threads, 1))
+                            .build(&_schema_change_convert_thread_pool));
+
+    RETURN_IF_ERROR(ThreadPoolBuilder("CloneDownloadThreadPool")
+                            .set_min_threads(1)
+                            .set_max_threads(std::max(config::clone_download_thread_num, 1))
+                            .build(&_clone_download_thread_pool));
+
     RETURN_IF_ERROR(Thread::create(
             "StorageEngine", "async_publish_version_thread",
             [this]() { this->_async_publish_callback(); }, &_async_publish_thread));
@@ -664,7 +675,7 @@ void StorageEngine::_compaction_tasks_producer_callback() {
     int64_t interval = config::generate_compaction_tasks_interval_ms;
     do {
         int64_t cur_time = UnixMillis();
-        if (!config::disable_auto_compaction &&
+        if (!config::disable_auto_compaction && !ExecEnv::is_draining() &&
             (!config::enable_compaction_pause_on_high_memory ||
              !GlobalMemoryArbitrator::is_exceed_soft_mem_limit(GB_EXCHANGE_BYTE))) {
             _adjust_compaction_thread_num();
@@ -1517,7 +1528,7 @@ void StorageEngine::do_remove_unused_remote_files() {
 void StorageEngine::_cold_data_compaction_producer_callback() {
     while (!_stop_background_threads_latch.wait_for(
             std::chrono::seconds(config::cold_data_compaction_interval_sec))) {
-        if (config::disable_auto_compaction ||
+        if (config::disable_auto_compaction || ExecEnv::is_draining() ||
             GlobalMemoryArbitrator::is_exceed_soft_mem_limit(GB_EXCHANGE_BYTE)) {
             continue;
         }
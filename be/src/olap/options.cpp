@@ -61,6 +61,7 @@ static std::string CACHE_TTL_PERCENT = "ttl_percent";
 static std::string CACHE_STORAGE = "storage";
 static std::string CACHE_STORAGE_DISK = "disk";
 static std::string CACHE_STORAGE_MEMORY = "memory";
+static std::string CACHE_STORAGE_LOG = "log";
 
 // TODO: should be a general util method
 // static std::string to_upper(const std::string& str) {
@@ -209,6 +210,7 @@ void parse_conf_broken_store_paths(const string& config_path, std::set<std::stri
  *    {"path": "storage2", "total_size":53687091200},
  *    {"path": "storage3", "total_size":53687091200, "ttl_percent":50, "normal_percent":40, "disposable_percent":5, "index_percent":5}
  *    {"path": "xxx", "total_size":53687091200, "storage": "memory"}
+ *    {"path": "storage4", "total_size":53687091200, "storage": "log"}
  *  ]
  */
 Status parse_conf_cache_paths(const std::string& config_path, std::vector<CachePath>& paths) {
@@ -223,7 +225,8 @@ Status parse_conf_cache_paths(const std::string& config_path, std::vector<CacheP
         std::string storage = CACHE_STORAGE_DISK; // disk storage by default
         if (map.HasMember(CACHE_STORAGE.c_str())) {
             storage = map.FindMember(CACHE_STORAGE.c_str())->value.GetString();
-            if (storage != CACHE_STORAGE_DISK && storage != CACHE_STORAGE_MEMORY) [[unlikely]] {
+            if (storage != CACHE_STORAGE_DISK && storage != CACHE_STORAGE_MEMORY &&
+                storage != CACHE_STORAGE_LOG) [[unlikely]] {
                 return Status::InvalidArgument("invalid file cache storage type: " + storage);
             }
             if (storage == CACHE_STORAGE_MEMORY) {
@@ -81,7 +81,7 @@ StoragePageCache* StoragePageCache::create_global_cache(size_t capacity,
 
 StoragePageCache::StoragePageCache(size_t capacity, int32_t index_cache_percentage,
                                    int64_t pk_index_cache_capacity, uint32_t num_shards)
-        : _index_cache_percentage(index_cache_percentage) {
+        : _index_cache_percentage(index_cache_percentage), _num_shards(num_shards) {
     if (index_cache_percentage == 0) {
         _data_page_cache = std::make_unique<DataPageCache>(capacity, num_shards);
     } else if (index_cache_percentage == 100) {
@@ -109,15 +109,38 @@ bool StoragePageCache::lookup(const CacheKey& key, PageCacheHandle* handle,
     return true;
 }
 
+bool StoragePageCache::start_loading(const CacheKey& key) {
+    auto encoded_key = key.encode();
+    auto& loading = _loading_pages[std::hash<std::string> {}(encoded_key) % _loading_pages.size()];
+    std::unique_lock lock(loading.mutex);
+    if (loading.keys.insert(encoded_key).second) {
+        return true;
+    }
+    loading.cv.wait(lock, [&] { return !loading.keys.contains(encoded_key); });
+    return false;
+}
+
+void StoragePageCache::finish_loading(const CacheKey& key) {
+    auto encoded_key = key.encode();
+    auto& loading = _loading_pages[std::hash<std::string> {}(encoded_key) % _loading_pages.size()];
+    {
+        std::lock_guard lock(loading.mutex);
+        loading.keys.erase(encoded_key);
+    }
+    loading.cv.notify_all();
+}
+
 void StoragePageCache::insert(const CacheKey& key, DataPage* data, PageCacheHandle* handle,
-                              segment_v2::PageTypePB page_type, bool in_memory) {
+                              segment_v2::PageTypePB page_type, bool in_memory,
+                              bool probationary) {
     CachePriority priority = CachePriority::NORMAL;
     if (in_memory) {
         priority = CachePriority::DURABLE;
     }
 
     auto* cache = _get_page_cache(page_type);
-    auto* lru_handle = cache->insert(key.encode(), data, data->capacity(), 0, priority);
+    auto* lru_handle =
+            cache->insert(key.encode(), data, data->capacity(), 0, priority, probationary);
     DCHECK(lru_handle != nullptr);
     *handle = PageCacheHandle(cache, lru_handle);
 }
@@ -148,6 +171,15 @@ void StoragePageCache::insert(const CacheKey& key, T data, size_t size, PageCach
     page.release();
 }
 
+void StoragePageCache::for_each_page(segment_v2::PageTypePB page_type,
+                                     const CacheEntryVisitor& visitor, size_t max_pages) {
+    auto* cache = _get_page_cache(page_type);
+    if (cache == nullptr || max_pages == 0) {
+        return;
+    }
+    cache->for_each_entry(visitor, (max_pages + _num_shards - 1) / _num_shards);
+}
+
 Slice PageCacheHandle::data() const {
     auto* cache_value = (DataPage*)_cache->value(_handle);
     return {cache_value->data(), cache_value->size()};
@@ -22,8 +22,12 @@
 #include <stddef.h>
 #include <stdint.h>
 
+#include <array>
+#include <condition_variable>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <unordered_set>
 #include <utility>
 
 #include "olap/lru_cache.h"
@@ -35,7 +39,11 @@
 
 namespace doris {
 
+class BlockCompressionCodec;
 class PageCacheHandle;
+namespace segment_v2 {
+class EncodingInfo;
+} // namespace segment_v2
 
 template <typename T>
 class MemoryTrackedPageBase : public LRUCacheValueBase {
@@ -69,8 +77,20 @@ public:
         this->_size = n;
     }
 
+    // How the page is read from file, used to read it again when page cache is
+    // warmed up from PageCacheSnapshot. page_size is 0 if the page can not be read again.
+    struct ReadSource {
+        uint32_t page_size = 0;
+        BlockCompressionCodec* codec = nullptr;
+        const segment_v2::EncodingInfo* encoding_info = nullptr;
+        bool pre_decode = true;
+    };
+    void set_read_source(const ReadSource& read_source) { _read_source = read_source; }
+    const ReadSource& read_source() const { return _read_source; }
+
 private:
     size_t _capacity = 0;
+    ReadSource _read_source;
 };
 
 template <typename T>
@@ -168,8 +188,10 @@ public:
     // This function is thread-safe, and when two clients insert two same key
     // concurrently, this function can assure that only one page is cached.
     // The in_memory page will have higher priority.
+    // The probationary page will be evicted first until it is hit, used for streaming reads.
     void insert(const CacheKey& key, DataPage* data, PageCacheHandle* handle,
-                segment_v2::PageTypePB page_type, bool in_memory = false);
+                segment_v2::PageTypePB page_type, bool in_memory = false,
+                bool probationary = false);
 
     // Insert a std::share_ptr which points to a page into this cache.
     // size should be the size of the page instead of shared_ptr.
@@ -182,14 +204,27 @@ public:
     void insert(const CacheKey& key, T data, size_t size, PageCacheHandle* handle,
                 segment_v2::PageTypePB page_type, bool in_memory = false);
 
+    // Concurrent readers missing the same page wait for the first one to load it instead of
+    // reading and decompressing it again. Returns true if the caller is the one to load the
+    // page, it must then call finish_loading whether the page got inserted or not. Returns
+    // false after another reader finished loading it, the caller should look it up again.
+    bool start_loading(const CacheKey& key);
+    void finish_loading(const CacheKey& key);
+
     std::shared_ptr<MemTrackerLimiter> mem_tracker(segment_v2::PageTypePB page_type) {
         return _get_page_cache(page_type)->mem_tracker();
     }
 
+    // Visit at most max_pages cached pages of page_type, the recently used pages first.
+    // See Cache::for_each_entry.
+    void for_each_page(segment_v2::PageTypePB page_type, const CacheEntryVisitor& visitor,
+                       size_t max_pages);
+
 private:
     StoragePageCache();
 
     int32_t _index_cache_percentage = 0;
+    uint32_t _num_shards = 0;
     std::unique_ptr<DataPageCache> _data_page_cache;
     std::unique_ptr<IndexPageCache> _index_page_cache;
     // Cache data for primary key index data page, seperated from data
@@ -197,6 +232,13 @@ private:
     // delete bitmap in unique key with mow
     std::unique_ptr<PKIndexPageCache> _pk_index_page_cache;
 
+    struct LoadingPages {
+        std::mutex mutex;
+        std::condition_variable cv;
+        std::unordered_set<std::string> keys;
+    };
+    std::array<LoadingPages, kDefaultNumShards> _loading_pages;
+
     LRUCachePolicy* _get_page_cache(segment_v2::PageTypePB page_type) {
         switch (page_type) {
         case segment_v2::DATA_PAGE: {
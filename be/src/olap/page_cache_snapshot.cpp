@@ -0,0 +1,317 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "olap/page_cache_snapshot.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <memory>
+
+#include "common/config.h"
+#include "common/logging.h"
+#include "io/fs/file_reader.h"
+#include "io/fs/file_writer.h"
+#include "io/fs/local_file_system.h"
+#include "olap/olap_common.h"
+#include "olap/page_cache.h"
+#include "olap/rowset/segment_v2/encoding_info.h"
+#include "olap/rowset/segment_v2/page_handle.h"
+#include "olap/rowset/segment_v2/page_io.h"
+#include "olap/rowset/segment_v2/page_pointer.h"
+#include "olap/types.h"
+#include "util/block_compression.h"
+#include "util/coding.h"
+#include "util/countdown_latch.h"
+#include "util/crc32c.h"
+#include "util/stopwatch.hpp"
+#include "util/threadpool.h"
+
+namespace doris {
+#include "common/compile_check_begin.h"
+
+namespace {
+
+// The codecs of segment are singletons, see get_block_compression_codec().
+bool compression_type_of(BlockCompressionCodec* codec, segment_v2::CompressionTypePB* type) {
+    if (codec == nullptr) {
+        *type = segment_v2::NO_COMPRESSION;
+        return true;
+    }
+    for (auto candidate : {segment_v2::SNAPPY, segment_v2::LZ4, segment_v2::LZ4F,
+                           segment_v2::LZ4HC, segment_v2::ZLIB, segment_v2::ZSTD}) {
+        BlockCompressionCodec* candidate_codec = nullptr;
+        if (get_block_compression_codec(candidate, &candidate_codec).ok() &&
+            candidate_codec == codec) {
+            *type = candidate;
+            return true;
+        }
+    }
+    return false;
+}
+
+} // namespace
+
+void PageCacheSnapshot::collect(StoragePageCache* cache, size_t max_pages,
+                                std::vector<PageCacheSnapshotEntry>* entries) {
+    // see StoragePageCache::CacheKey::encode()
+    constexpr size_t KEY_SUFFIX_SIZE = sizeof(size_t) + sizeof(int64_t);
+    for (auto type : {segment_v2::PRIMARY_KEY_INDEX_PAGE, segment_v2::INDEX_PAGE,
+                      segment_v2::DATA_PAGE}) {
+        auto visitor = [type, entries](const LRUHandle* e) {
+            // segment footers are cached too, they are not read by PageIO and skipped
+            auto* page = dynamic_cast<DataPage*>(static_cast<LRUCacheValueBase*>(e->value));
+            if (page == nullptr || page->read_source().page_size == 0) {
+                return;
+            }
+            const auto& source = page->read_source();
+            CacheKey key = e->key();
+            PageCacheSnapshotEntry entry;
+            if (key.size() < KEY_SUFFIX_SIZE ||
+                !compression_type_of(source.codec, &entry.compression)) {
+                return;
+            }
+            entry.fname.assign(key.data(), key.size() - KEY_SUFFIX_SIZE);
+            size_t fsize = 0;
+            memcpy(&fsize, key.data() + entry.fname.size(), sizeof(size_t));
+            memcpy(&entry.offset, key.data() + entry.fname.size() + sizeof(size_t),
+                   sizeof(int64_t));
+            entry.fsize = fsize;
+            entry.size = source.page_size;
+            entry.type = type;
+            if (source.encoding_info != nullptr) {
+                entry.field_type = static_cast<int32_t>(source.encoding_info->type());
+                entry.encoding = source.encoding_info->encoding();
+            }
+            entry.pre_decode = source.pre_decode;
+            entry.in_memory = e->priority == CachePriority::DURABLE;
+            entries->push_back(std::move(entry));
+        };
+        cache->for_each_page(type, visitor, max_pages);
+    }
+}
+
+void PageCacheSnapshot::_encode_entry(const PageCacheSnapshotEntry& entry, std::string* buf) {
+    put_length_prefixed_slice(buf, Slice(entry.fname));
+    put_varint64(buf, entry.fsize);
+    put_varint64(buf, static_cast<uint64_t>(entry.offset));
+    put_varint32(buf, entry.size);
+    put_varint32(buf, static_cast<uint32_t>(entry.type));
+    put_varint32(buf, static_cast<uint32_t>(entry.compression));
+    put_varint32(buf, static_cast<uint32_t>(entry.field_type));
+    put_varint32(buf, static_cast<uint32_t>(entry.encoding));
+    put_varint32(buf, (entry.pre_decode ? 1 : 0) | (entry.in_memory ? 2 : 0));
+}
+
+bool PageCacheSnapshot::_decode_entry(Slice* input, PageCacheSnapshotEntry* entry) {
+    Slice fname;
+    uint64_t offset = 0;
+    uint32_t type = 0;
+    uint32_t compression = 0;
+    uint32_t field_type = 0;
+    uint32_t encoding = 0;
+    uint32_t flags = 0;
+    if (!get_length_prefixed_slice(input, &fname) || !get_varint64(input, &entry->fsize) ||
+        !get_varint64(input, &offset) || !get_varint32(input, &entry->size) ||
+        !get_varint32(input, &type) || !get_varint32(input, &compression) ||
+        !get_varint32(input, &field_type) || !get_varint32(input, &encoding) ||
+        !get_varint32(input, &flags)) {
+        return false;
+    }
+    if (!segment_v2::PageTypePB_IsValid(static_cast<int>(type)) ||
+        !segment_v2::CompressionTypePB_IsValid(static_cast<int>(compression)) ||
+        !segment_v2::EncodingTypePB_IsValid(static_cast<int>(encoding))) {
+        return false;
+    }
+    entry->fname = fname.to_string();
+    entry->offset = static_cast<int64_t>(offset);
+    entry->type = static_cast<segment_v2::PageTypePB>(type);
+    entry->compression = static_cast<segment_v2::CompressionTypePB>(compression);
+    entry->field_type = static_cast<int32_t>(field_type);
+    entry->encoding = static_cast<segment_v2::EncodingTypePB>(encoding);
+    entry->pre_decode = (flags & 1) != 0;
+    entry->in_memory = (flags & 2) != 0;
+    return true;
+}
+
+Status PageCacheSnapshot::save(const std::string& path,
+                               const std::vector<PageCacheSnapshotEntry>& entries) {
+    std::string buf;
+    buf.append(MAGIC, MAGIC_SIZE);
+    put_varint32(&buf, VERSION);
+    put_varint64(&buf, entries.size());
+    for (const auto& entry : entries) {
+        _encode_entry(entry, &buf);
+    }
+    put_fixed32_le(&buf, crc32c::Value(buf.data(), buf.size()));
+
+    // write to a tmp file and rename it, so that a crash never leaves a broken snapshot
+    const auto& fs = io::global_local_filesystem();
+    std::string tmp_path = path + ".tmp";
+    io::FileWriterPtr writer;
+    RETURN_IF_ERROR(fs->create_file(tmp_path, &writer));
+    RETURN_IF_ERROR(writer->append(Slice(buf)));
+    RETURN_IF_ERROR(writer->close());
+    return fs->rename(tmp_path, path);
+}
+
+Status PageCacheSnapshot::load(const std::string& path,
+                               std::vector<PageCacheSnapshotEntry>* entries) {
+    const auto& fs = io::global_local_filesystem();
+    bool exists = false;
+    RETURN_IF_ERROR(fs->exists(path, &exists));
+    if (!exists) {
+        return Status::NotFound("page cache snapshot {} does not exist", path);
+    }
+    io::FileReaderSPtr reader;
+    RETURN_IF_ERROR(fs->open_file(path, &reader));
+    std::string buf(reader->size(), '\0');
+    size_t bytes_read = 0;
+    RETURN_IF_ERROR(reader->read_at(0, Slice(buf), &bytes_read));
+    if (bytes_read != buf.size() || buf.size() < MAGIC_SIZE + sizeof(uint32_t) ||
+        memcmp(buf.data(), MAGIC, MAGIC_SIZE) != 0) {
+        return Status::Corruption("bad page cache snapshot {}, size={}", path, buf.size());
+    }
+    const size_t checksum_offset = buf.size() - sizeof(uint32_t);
+    uint32_t expect = decode_fixed32_le(reinterpret_cast<const uint8_t*>(buf.data()) +
+                                        checksum_offset);
+    uint32_t actual = crc32c::Value(buf.data(), checksum_offset);
+    if (expect != actual) {
+        return Status::Corruption("page cache snapshot {} checksum mismatch, {} vs {}", path,
+                                  actual, expect);
+    }
+
+    Slice input(buf.data() + MAGIC_SIZE, checksum_offset - MAGIC_SIZE);
+    uint32_t version = 0;
+    uint64_t num_entries = 0;
+    if (!get_varint32(&input, &version) || version != VERSION ||
+        !get_varint64(&input, &num_entries)) {
+        return Status::NotSupported("unsupported page cache snapshot {}, version={}", path,
+                                    version);
+    }
+    entries->clear();
+    entries->reserve(num_entries);
+    for (uint64_t i = 0; i < num_entries; ++i) {
+        PageCacheSnapshotEntry entry;
+        if (!_decode_entry(&input, &entry)) {
+            return Status::Corruption("bad entry {} in page cache snapshot {}", i, path);
+        }
+        entries->push_back(std::move(entry));
+    }
+    return Status::OK();
+}
+
+Status PageCacheSnapshot::warm_up_page(const PageCacheSnapshotEntry& entry) {
+    auto* cache = StoragePageCache::instance();
+    if (cache == nullptr) {
+        return Status::OK();
+    }
+    PageCacheHandle cache_handle;
+    if (cache->lookup(StoragePageCache::CacheKey(entry.fname, entry.fsize, entry.offset),
+                      &cache_handle, entry.type)) {
+        return Status::OK();
+    }
+
+    io::FileReaderSPtr file_reader;
+    RETURN_IF_ERROR(io::global_local_filesystem()->open_file(entry.fname, &file_reader));
+    if (file_reader->size() != entry.fsize) {
+        return Status::NotFound("file {} has changed, size {} vs {}", entry.fname,
+                                file_reader->size(), entry.fsize);
+    }
+    BlockCompressionCodec* codec = nullptr;
+    RETURN_IF_ERROR(get_block_compression_codec(entry.compression, &codec));
+    const segment_v2::EncodingInfo* encoding_info = nullptr;
+    if (entry.field_type != 0) {
+        const auto* type_info = get_scalar_type_info(static_cast<FieldType>(entry.field_type));
+        if (type_info == nullptr) {
+            return Status::NotSupported("unsupported field type {}", entry.field_type);
+        }
+        RETURN_IF_ERROR(segment_v2::EncodingInfo::get(type_info, entry.encoding, &encoding_info));
+    }
+
+    OlapReaderStatistics stats;
+    segment_v2::PageReadOptions opts(io::IOContext {});
+    opts.use_page_cache = true;
+    opts.kept_in_memory = entry.in_memory;
+    opts.pre_decode = entry.pre_decode;
+    opts.type = entry.type;
+    opts.file_reader = file_reader.get();
+    opts.page_pointer = segment_v2::PagePointer(static_cast<uint64_t>(entry.offset), entry.size);
+    opts.codec = codec;
+    opts.stats = &stats;
+    opts.encoding_info = encoding_info;
+    segment_v2::PageHandle page_handle;
+    Slice body;
+    segment_v2::PageFooterPB footer;
+    return segment_v2::PageIO::read_and_decompress_page(opts, &page_handle, &body, &footer);
+}
+
+void PageCacheSnapshot::warm_up(const std::vector<PageCacheSnapshotEntry>& entries,
+                                CountDownLatch* stop_latch) {
+    std::unique_ptr<ThreadPool> pool;
+    Status st = ThreadPoolBuilder("PageCacheWarmUpThreadPool")
+                        .set_min_threads(1)
+                        .set_max_threads(std::max(1, config::storage_page_cache_warmup_thread_num))
+                        .build(&pool);
+    if (!st.ok()) {
+        LOG(WARNING) << "failed to create page cache warm up thread pool: " << st;
+        return;
+    }
+
+    MonotonicStopWatch watch;
+    watch.start();
+    std::atomic<size_t> finished_num = 0;
+    std::atomic<size_t> failed_num = 0;
+    // submit a batch of pages every 100ms to throttle the reads
+    constexpr int64_t BATCH_INTERVAL_MS = 100;
+    bool stopped = false;
+    size_t i = 0;
+    while (i < entries.size() && !stopped) {
+        const auto batch_size = static_cast<size_t>(std::max<int64_t>(
+                1, config::storage_page_cache_warmup_pages_per_second * BATCH_INTERVAL_MS / 1000));
+        for (const size_t end = std::min(entries.size(), i + batch_size); i < end; ++i) {
+            const auto& entry = entries[i];
+            st = pool->submit_func([&entry, &finished_num, &failed_num]() {
+                Status page_st = warm_up_page(entry);
+                if (!page_st.ok()) {
+                    VLOG_DEBUG << "failed to warm up page " << entry.fname << ":" << entry.offset
+                               << ", " << page_st;
+                    failed_num++;
+                }
+                finished_num++;
+            });
+            if (!st.ok()) {
+                failed_num++;
+                finished_num++;
+            }
+        }
+        stopped = stop_latch->wait_for(std::chrono::milliseconds(BATCH_INTERVAL_MS));
+    }
+    if (!stopped) {
+        pool->wait();
+    }
+    // the pending pages are dropped if BE is stopping
+    pool->shutdown();
+    LOG(INFO) << fmt::format(
+            "page cache warm up {}, {} of {} pages are read, {} failed, cost {}ms",
+            stopped ? "stopped" : "finished", finished_num.load(), entries.size(),
+            failed_num.load(), watch.elapsed_time() / 1000000);
+}
+
+#include "common/compile_check_end.h"
+} // namespace doris
@@ -0,0 +1,91 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <gen_cpp/segment_v2.pb.h>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "common/status.h"
+#include "util/slice.h"
+
+namespace doris {
+#include "common/compile_check_begin.h"
+
+class CountDownLatch;
+class StoragePageCache;
+
+// A cached page which can be read again to warm up StoragePageCache.
+struct PageCacheSnapshotEntry {
+    // the fields of StoragePageCache::CacheKey
+    std::string fname;
+    uint64_t fsize = 0;
+    int64_t offset = 0;
+    // size of page in file
+    uint32_t size = 0;
+    segment_v2::PageTypePB type = segment_v2::UNKNOWN_PAGE_TYPE;
+    segment_v2::CompressionTypePB compression = segment_v2::NO_COMPRESSION;
+    // field type and encoding of EncodingInfo to pre decode data page, field_type is 0 if
+    // the page has no encoding info
+    int32_t field_type = 0;
+    segment_v2::EncodingTypePB encoding = segment_v2::UNKNOWN_ENCODING;
+    bool pre_decode = true;
+    bool in_memory = false;
+};
+
+// Snapshot of the hottest pages in StoragePageCache. It is dumped to a local file
+// periodically and before BE stops, and the pages are read again by a background thread
+// pool after BE restarts, so that queries do not suffer from a cold page cache.
+// Only the keys of pages are dumped, a page whose file is deleted or changed is skipped.
+//
+// File format, integers are varint encoded except the fixed magic and checksum:
+//   MAGIC(4) | VERSION | N | ENTRY_1 | ... | ENTRY_N | CHECKSUM(4, crc32c of the preceding)
+class PageCacheSnapshot {
+public:
+    // Collect at most max_pages hottest pages of each page type in cache.
+    static void collect(StoragePageCache* cache, size_t max_pages,
+                        std::vector<PageCacheSnapshotEntry>* entries);
+
+    static Status save(const std::string& path, const std::vector<PageCacheSnapshotEntry>& entries);
+
+    // Return NotFound if there is no snapshot at path.
+    static Status load(const std::string& path, std::vector<PageCacheSnapshotEntry>* entries);
+
+    // Read pages of entries into the global StoragePageCache with a thread pool of
+    // config::storage_page_cache_warmup_thread_num threads, throttled to
+    // config::storage_page_cache_warmup_pages_per_second. Return when all pages are read
+    // or stop_latch is counted down.
+    static void warm_up(const std::vector<PageCacheSnapshotEntry>& entries,
+                        CountDownLatch* stop_latch);
+
+    // Read the page of entry into the global StoragePageCache if it is not cached.
+    static Status warm_up_page(const PageCacheSnapshotEntry& entry);
+
+private:
+    static constexpr char MAGIC[] = "DPCS";
+    static constexpr size_t MAGIC_SIZE = 4;
+    static constexpr uint32_t VERSION = 1;
+
+    static void _encode_entry(const PageCacheSnapshotEntry& entry, std::string* buf);
+    static bool _decode_entry(Slice* input, PageCacheSnapshotEntry* entry);
+};
+
+#include "common/compile_check_end.h"
+} // namespace doris
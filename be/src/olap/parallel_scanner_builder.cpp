@@ -24,6 +24,9 @@
 #include "cloud/config.h"
 #include "common/status.h"
 #include "olap/rowset/beta_rowset.h"
+#include "olap/rowset/segment_v2/column_reader.h"
+#include "olap/rowset/segment_v2/ordinal_page_index.h"
+#include "olap/rowset/segment_v2/segment.h"
 #include "olap/segment_loader.h"
 #include "pipeline/exec/olap_scan_operator.h"
 #include "vec/exec/scan/olap_scanner.h"
@@ -82,10 +85,16 @@ Status ParallelScannerBuilder::_build_scanners_by_rowid(std::list<ScannerSPtr>&
                 while (offset_in_segment < rows_of_segment) {
                     const int64_t remaining_rows = rows_of_segment - offset_in_segment;
                     auto rows_need = _rows_per_scanner - rows_collected;
+                    bool split_segment = false;
 
                     // 0.9: try to avoid splitting the segments into excessively small parts.
                     if (rows_need >= remaining_rows * 0.9) {
                         rows_need = remaining_rows;
+                    } else {
+                        split_segment = true;
+                        rows_need = _align_to_page_boundary(rowset, i, offset_in_segment,
+                                                            offset_in_segment + rows_need) -
+                                    offset_in_segment;
                     }
                     DCHECK_LE(rows_need, remaining_rows);
 
@@ -95,8 +104,8 @@ Status ParallelScannerBuilder::_build_scanners_by_rowid(std::list<ScannerSPtr>&
                     rows_collected += rows_need;
                     offset_in_segment += rows_need;
 
-                    // If collected enough rows, build a new scanner
-                    if (rows_collected >= _rows_per_scanner) {
+                    // If collected enough rows or stopped at a page boundary, build a new scanner
+                    if (rows_collected >= _rows_per_scanner || split_segment) {
                         split.segment_offsets.first = segment_start,
                         split.segment_offsets.second = i + 1;
                         split.segment_row_ranges.emplace_back(std::move(row_ranges));
@@ -192,6 +201,42 @@ Status ParallelScannerBuilder::_load() {
     return Status::OK();
 }
 
+/**
+ * Move a split point inside a segment back to the first row of the data page containing it,
+ * so that two scanners do not decode the same page of the leading column. Only a segment that
+ * is already in the segment cache and whose ordinal index of that column is already loaded is
+ * used, neither is loaded here because that would serialize the reads of all split segments
+ * before any scanner starts.
+ */
+int64_t ParallelScannerBuilder::_align_to_page_boundary(const RowsetSharedPtr& rowset,
+                                                        size_t segment_idx, int64_t range_start,
+                                                        int64_t split_point) {
+    SegmentCacheHandle cache_handle;
+    if (!SegmentLoader::instance()->lookup_segment(
+                SegmentCache::CacheKey(rowset->rowset_id(), static_cast<int64_t>(segment_idx)),
+                &cache_handle)) {
+        return split_point;
+    }
+    const auto& segment = cache_handle.get_segments()[0];
+    segment_v2::ColumnReader* column_reader = nullptr;
+    if (!segment->get_column_reader(segment->tablet_schema()->column(0).unique_id(),
+                                    &column_reader)
+                 .ok() ||
+        column_reader == nullptr || !column_reader->ordinal_index_loaded()) {
+        return split_point;
+    }
+
+    OlapReaderStatistics stats;
+    segment_v2::ColumnIteratorOptions iter_opts;
+    iter_opts.stats = &stats;
+    segment_v2::OrdinalPageIndexIterator page_iter;
+    if (!column_reader->seek_at_or_before(split_point, &page_iter, iter_opts).ok()) {
+        return split_point;
+    }
+    auto page_start = static_cast<int64_t>(page_iter.first_ordinal());
+    return page_start > range_start ? page_start : split_point;
+}
+
 std::shared_ptr<OlapScanner> ParallelScannerBuilder::_build_scanner(
         BaseTabletSPtr tablet, int64_t version, const std::vector<OlapScanRange*>& key_ranges,
         TabletReader::ReadSource&& read_source) {
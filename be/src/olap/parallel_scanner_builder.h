@@ -69,6 +69,9 @@ private:
 
     Status _build_scanners_by_rowid(std::list<ScannerSPtr>& scanners);
 
+    int64_t _align_to_page_boundary(const RowsetSharedPtr& rowset, size_t segment_idx,
+                                    int64_t range_start, int64_t split_point);
+
     std::shared_ptr<vectorized::OlapScanner> _build_scanner(
             BaseTabletSPtr tablet, int64_t version, const std::vector<OlapScanRange*>& key_ranges,
             TabletReader::ReadSource&& read_source);
@@ -294,6 +294,15 @@ void PartialUpdateInfo::_generate_default_values_for_missing_cids(
     CHECK_EQ(missing_cids.size(), default_values.size());
 }
 
+// Reading a segment in rowid order keeps its column iterators moving forward over decoded pages,
+// the read index maps the rows back to their block positions.
+static std::vector<RidAndPos> sorted_by_rid(const std::vector<RidAndPos>& mappings) {
+    std::vector<RidAndPos> sorted = mappings;
+    std::stable_sort(sorted.begin(), sorted.end(),
+                     [](const RidAndPos& lhs, const RidAndPos& rhs) { return lhs.rid < rhs.rid; });
+    return sorted;
+}
+
 bool FixedReadPlan::empty() const {
     return plan.empty();
 }
@@ -327,7 +336,7 @@ Status FixedReadPlan::read_columns_by_plan(
             auto rowset_iter = rsid_to_rowset.find(rowset_id);
             CHECK(rowset_iter != rsid_to_rowset.end());
             std::vector<uint32_t> rids;
-            for (auto [rid, pos] : mappings) {
+            for (auto [rid, pos] : sorted_by_rid(mappings)) {
                 if (cur_delete_signs && cur_delete_signs[pos]) {
                     continue;
                 }
@@ -343,15 +352,13 @@ Status FixedReadPlan::read_columns_by_plan(
                 }
                 continue;
             }
-            for (size_t cid = 0; cid < mutable_columns.size(); ++cid) {
-                TabletColumn tablet_column = tablet_schema.column(cids_to_read[cid]);
-                auto st = doris::BaseTablet::fetch_value_by_rowids(
-                        rowset_iter->second, segment_id, rids, tablet_column, mutable_columns[cid]);
-                // set read value to output block
-                if (!st.ok()) {
-                    LOG(WARNING) << "failed to fetch value";
-                    return st;
-                }
+            auto st = doris::BaseTablet::fetch_values_by_rowids(
+                    rowset_iter->second, segment_id, rids, tablet_schema, cids_to_read,
+                    mutable_columns);
+            // set read value to output block
+            if (!st.ok()) {
+                LOG(WARNING) << "failed to fetch value";
+                return st;
             }
         }
     }
@@ -486,7 +493,7 @@ Status FlexibleReadPlan::read_columns_by_plan(
                 DCHECK_NE(cid, -1);
                 DCHECK_GE(cid, tablet_schema.num_key_columns());
                 std::vector<uint32_t> rids;
-                for (auto [rid, pos] : mappings) {
+                for (auto [rid, pos] : sorted_by_rid(mappings)) {
                     rids.emplace_back(rid);
                     (*read_index)[cid][static_cast<uint32_t>(pos)] = next_read_idx[cid]++;
                 }
@@ -515,7 +522,7 @@ Status FlexibleReadPlan::read_columns_by_plan(
             auto rowset_iter = rsid_to_rowset.find(rowset_id);
             CHECK(rowset_iter != rsid_to_rowset.end());
             std::vector<uint32_t> rids;
-            for (auto [rid, pos] : mappings) {
+            for (auto [rid, pos] : sorted_by_rid(mappings)) {
                 rids.emplace_back(rid);
                 (*read_index)[static_cast<uint32_t>(pos)] = read_idx++;
             }
@@ -191,6 +191,7 @@ Status BetaRowsetReader::get_segment_iterators(RowsetReaderContext* read_context
         }
     }
     _read_options.use_page_cache = _read_context->use_page_cache;
+    _read_options.streaming_read = _read_context->streaming_read;
     _read_options.tablet_schema = _read_context->tablet_schema;
     _read_options.enable_unique_key_merge_on_write =
             _read_context->enable_unique_key_merge_on_write;
@@ -68,6 +68,7 @@ struct RowsetReaderContext {
     std::vector<vectorized::VExprSPtr> remaining_conjunct_roots;
     vectorized::VExprContextSPtrs common_expr_ctxs_push_down;
     bool use_page_cache = false;
+    bool streaming_read = false;
     int sequence_id_idx = -1;
     int batch_size = 1024;
     bool is_unique = false;
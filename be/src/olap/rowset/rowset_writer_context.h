@@ -21,6 +21,7 @@
 
 #include "olap/olap_define.h"
 #include "olap/partial_update_info.h"
+#include "olap/rowset/segment_v2/variant/variant_path_dictionary.h"
 #include "olap/storage_policy.h"
 #include "olap/tablet.h"
 #include "olap/tablet_schema.h"
@@ -38,7 +39,9 @@ class LocalSchemaChangeRecorder;
 }
 
 struct RowsetWriterContext {
-    RowsetWriterContext() : schema_lock(new std::mutex) {
+    RowsetWriterContext()
+            : schema_lock(new std::mutex),
+              variant_path_dictionary(std::make_shared<segment_v2::VariantPathDictionary>()) {
         load_id.set_hi(0);
         load_id.set_lo(0);
     }
@@ -113,6 +116,8 @@ struct RowsetWriterContext {
     // In semi-structure senario tablet_schema will be updated concurrently,
     // this lock need to be held when update.Use shared_ptr to avoid delete copy contructor
     std::shared_ptr<std::mutex> schema_lock;
+    // Variant subcolumn paths materialized by the segments written so far.
+    std::shared_ptr<segment_v2::VariantPathDictionary> variant_path_dictionary;
 
     int64_t compaction_level = 0;
 
@@ -36,6 +36,7 @@
 #include "beta_rowset_writer.h"
 #include "common/compiler_util.h" // IWYU pragma: keep
 #include "common/logging.h"
+#include "io/fs/compaction_io_throttle.h"
 #include "io/fs/file_system.h"
 #include "io/fs/file_writer.h"
 #include "io/io_common.h"
@@ -255,6 +256,7 @@ Status SegcompactionWorker::_create_segment_writer_for_segcompaction(
 Status SegcompactionWorker::_do_compact_segments(SegCompactionCandidatesSharedPtr segments) {
     DCHECK(_seg_compact_mem_tracker != nullptr);
     SCOPED_ATTACH_TASK(_seg_compact_mem_tracker);
+    io::ScopedCompactionIO scoped_compaction_io(ReaderType::READER_SEGMENT_COMPACTION);
     /* throttle segcompaction task if memory depleted */
     if (GlobalMemoryArbitrator::is_exceed_soft_mem_limit(GB_EXCHANGE_BYTE)) {
         return Status::Error<FETCH_MEMORY_EXCEEDED>("skip segcompaction due to memory shortage");
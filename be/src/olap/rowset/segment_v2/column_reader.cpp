@@ -390,6 +390,7 @@ Status ColumnReader::read_page(const ColumnIteratorOptions& iter_opts, const Pag
     PageReadOptions opts(iter_opts.io_ctx);
     opts.verify_checksum = _opts.verify_checksum;
     opts.use_page_cache = iter_opts.use_page_cache;
+    opts.streaming_read = iter_opts.streaming_read;
     opts.kept_in_memory = _opts.kept_in_memory;
     opts.type = iter_opts.type;
     opts.file_reader = iter_opts.file_reader;
@@ -634,6 +635,38 @@ Status ColumnReader::get_row_ranges_by_bloom_filter(const AndBlockColumnPredicat
     return Status::OK();
 }
 
+Status ColumnReader::may_contain_in_range(ordinal_t first, ordinal_t last, const Slice& value,
+                                          const ColumnIteratorOptions& iter_opts,
+                                          std::map<uint32_t, bool>* page_results,
+                                          bool* may_contain) {
+    *may_contain = true;
+    if (!has_bloom_filter_index(false) || first >= last) {
+        return Status::OK();
+    }
+    RETURN_IF_ERROR(_load_ordinal_index(_use_index_page_cache, _opts.kept_in_memory, iter_opts));
+    RETURN_IF_ERROR(
+            _load_bloom_filter_index(_use_index_page_cache, _opts.kept_in_memory, iter_opts));
+    std::unique_ptr<BloomFilterIndexIterator> bf_iter;
+    for (auto iter = _ordinal_index->seek_at_or_before(first);
+         iter.valid() && iter.first_ordinal() < last; iter.next()) {
+        auto page_id = cast_set<uint32_t>(iter.page_index());
+        auto [it, inserted] = page_results->try_emplace(page_id, true);
+        if (inserted) {
+            if (bf_iter == nullptr) {
+                RETURN_IF_ERROR(_bloom_filter_index->new_iterator(&bf_iter, iter_opts.stats));
+            }
+            std::unique_ptr<BloomFilter> bf;
+            RETURN_IF_ERROR(bf_iter->read_bloom_filter(page_id, &bf));
+            it->second = bf->test_bytes(value.data, value.size);
+        }
+        if (it->second) {
+            return Status::OK();
+        }
+    }
+    *may_contain = false;
+    return Status::OK();
+}
+
 Status ColumnReader::_load_ordinal_index(bool use_page_cache, bool kept_in_memory,
                                          const ColumnIteratorOptions& iter_opts) {
     if (!_ordinal_index) {
@@ -738,6 +771,17 @@ Status ColumnReader::seek_at_or_before(ordinal_t ordinal, OrdinalPageIndexIterat
     return Status::OK();
 }
 
+Status ColumnReader::get_page_pointers(ordinal_t from, ordinal_t to,
+                                       const ColumnIteratorOptions& iter_opts,
+                                       std::vector<PagePointer>* pages) {
+    RETURN_IF_ERROR(_load_ordinal_index(_use_index_page_cache, _opts.kept_in_memory, iter_opts));
+    for (auto iter = _ordinal_index->seek_at_or_before(from);
+         iter.valid() && iter.first_ordinal() < to; iter.next()) {
+        pages->push_back(iter.page());
+    }
+    return Status::OK();
+}
+
 Status ColumnReader::new_iterator(ColumnIterator** iterator, const TabletColumn* tablet_column) {
     return new_iterator(iterator, tablet_column, nullptr);
 }
@@ -871,6 +915,7 @@ MapFileColumnIterator::MapFileColumnIterator(ColumnReader* reader, ColumnIterato
 }
 
 Status MapFileColumnIterator::init(const ColumnIteratorOptions& opts) {
+    _opts = opts;
     RETURN_IF_ERROR(_key_iterator->init(opts));
     RETURN_IF_ERROR(_val_iterator->init(opts));
     RETURN_IF_ERROR(_offsets_iterator->init(opts));
@@ -914,7 +959,15 @@ Status MapFileColumnIterator::next_batch(size_t* n, vectorized::MutableColumnPtr
     auto key_ptr = column_map->get_keys().assume_mutable();
     auto val_ptr = column_map->get_values().assume_mutable();
 
-    if (num_items > 0) {
+    bool skipped = false;
+    if (num_items > 0 && _key_filter.has_value()) {
+        RETURN_IF_ERROR(_skip_items_without_key(num_items, &skipped));
+    }
+    if (skipped) {
+        // the rows are read as empty maps
+        auto& offsets_data = column_offsets.get_data();
+        std::fill(offsets_data.begin() + start, offsets_data.end(), offsets_data[start - 1]);
+    } else if (num_items > 0) {
         size_t num_read = num_items;
         bool key_has_null = false;
         bool val_has_null = false;
@@ -944,6 +997,25 @@ Status MapFileColumnIterator::next_batch(size_t* n, vectorized::MutableColumnPtr
     return Status::OK();
 }
 
+Status MapFileColumnIterator::_skip_items_without_key(size_t num_items, bool* skipped) {
+    *skipped = false;
+    auto* key_reader = _map_reader->get_sub_reader(0);
+    ordinal_t first = _key_iterator->get_current_ordinal();
+    ordinal_t last = first + num_items;
+    bool may_contain = true;
+    RETURN_IF_ERROR(key_reader->may_contain_in_range(
+            first, last, Slice(*_key_filter), _opts, &_key_filter_page_results, &may_contain));
+    if (may_contain) {
+        return Status::OK();
+    }
+    if (last < key_reader->num_rows()) {
+        RETURN_IF_ERROR(_key_iterator->seek_to_ordinal(last));
+        RETURN_IF_ERROR(_val_iterator->seek_to_ordinal(last));
+    }
+    *skipped = true;
+    return Status::OK();
+}
+
 Status MapFileColumnIterator::read_by_rowids(const rowid_t* rowids, const size_t count,
                                              vectorized::MutableColumnPtr& dst) {
     for (size_t i = 0; i < count; ++i) {
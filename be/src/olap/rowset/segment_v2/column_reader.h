@@ -22,8 +22,10 @@
 
 #include <cstddef> // for size_t
 #include <cstdint> // for uint32_t
-#include <memory>  // for unique_ptr
+#include <map>
+#include <memory> // for unique_ptr
 #include <mutex>
+#include <optional>
 #include <string>
 #include <utility>
 #include <vector>
@@ -97,6 +99,8 @@ struct ColumnReaderOptions {
 
 struct ColumnIteratorOptions {
     bool use_page_cache = false;
+    // pages are read by a large scan, see PageReadOptions::streaming_read
+    bool streaming_read = false;
     bool is_predicate_column = false;
     // for page cache allocation
     // page types are divided into DATA_PAGE & INDEX_PAGE
@@ -169,6 +173,10 @@ public:
     Status seek_at_or_before(ordinal_t ordinal, OrdinalPageIndexIterator* iter,
                              const ColumnIteratorOptions& iter_opts);
 
+    // Append pointers of the data pages covering ordinals [from, to) to `pages`.
+    Status get_page_pointers(ordinal_t from, ordinal_t to, const ColumnIteratorOptions& iter_opts,
+                             std::vector<PagePointer>* pages);
+
     // read a page from file into a page handle
     Status read_page(const ColumnIteratorOptions& iter_opts, const PagePointer& pp,
                      PageHandle* handle, Slice* page_body, PageFooterPB* footer,
@@ -179,6 +187,10 @@ public:
     const EncodingInfo* encoding_info() const { return _encoding_info; }
 
     bool has_zone_map() const { return _zone_map_index != nullptr; }
+    // Whether seek_at_or_before can be answered without reading the ordinal index page.
+    bool ordinal_index_loaded() const {
+        return _ordinal_index != nullptr && _ordinal_index->is_loaded();
+    }
     bool has_bitmap_index() const { return _bitmap_index != nullptr; }
     bool has_bloom_filter_index(bool ngram) const;
     // Check if this column could match `cond' using segment zone map.
@@ -201,10 +213,19 @@ public:
                                           RowRanges* row_ranges,
                                           const ColumnIteratorOptions& iter_opts);
 
+    // Whether the pages holding the values [first, last) may contain `value` by the bloom filter
+    // index, always true without one. `page_results` caches the answer of each tested page.
+    Status may_contain_in_range(ordinal_t first, ordinal_t last, const Slice& value,
+                                const ColumnIteratorOptions& iter_opts,
+                                std::map<uint32_t, bool>* page_results, bool* may_contain);
+
     PagePointer get_dict_page_pointer() const { return _meta_dict_page; }
 
     bool is_empty() const { return _num_rows == 0; }
 
+    // Readers of the nested columns of complex types, e.g. keys, values, offsets of a map.
+    ColumnReader* get_sub_reader(size_t i) const { return _sub_readers[i].get(); }
+
     bool prune_predicates_by_zone_map(std::vector<ColumnPredicate*>& predicates,
                                       const int column_id) const;
 
@@ -355,6 +376,12 @@ public:
 
     virtual bool is_all_dict_encoding() const { return false; }
 
+    // Append pointers of the data pages that hold ordinals [from, to), used to prefetch them.
+    virtual Status get_page_pointers(ordinal_t from, ordinal_t to,
+                                     std::vector<PagePointer>* pages) {
+        return Status::OK();
+    }
+
 protected:
     ColumnIteratorOptions _opts;
 };
@@ -400,6 +427,11 @@ public:
 
     bool is_all_dict_encoding() const override { return _is_all_dict_encoding; }
 
+    Status get_page_pointers(ordinal_t from, ordinal_t to,
+                             std::vector<PagePointer>* pages) override {
+        return _reader->get_page_pointers(from, to, _opts, pages);
+    }
+
 private:
     Status _seek_to_pos_in_page(ParsedPage* page, ordinal_t offset_in_page) const;
     Status _load_next_page(bool* eos);
@@ -491,12 +523,23 @@ public:
         return _offsets_iterator->get_current_ordinal();
     }
 
+    // Rows whose keys can't hold `key` by the bloom filter index of the key column are read as
+    // empty maps, their key and value pages are not decoded.
+    void set_key_filter(std::string key) { _key_filter = std::move(key); }
+
 private:
+    // Skips the key and value items [first, first + num_items) if none of them can be the
+    // filtered key, `skipped` tells whether it happened.
+    Status _skip_items_without_key(size_t num_items, bool* skipped);
+
     ColumnReader* _map_reader = nullptr;
     std::unique_ptr<ColumnIterator> _null_iterator;
     std::unique_ptr<OffsetFileColumnIterator> _offsets_iterator; //OffsetFileIterator
     std::unique_ptr<ColumnIterator> _key_iterator;
     std::unique_ptr<ColumnIterator> _val_iterator;
+    ColumnIteratorOptions _opts;
+    std::optional<std::string> _key_filter;
+    std::map<uint32_t, bool> _key_filter_page_results;
 };
 
 class StructFileColumnIterator final : public ColumnIterator {
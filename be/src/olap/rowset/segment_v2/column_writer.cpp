@@ -17,6 +17,7 @@
 
 #include "olap/rowset/segment_v2/column_writer.h"
 
+#include <bvar/bvar.h>
 #include <gen_cpp/segment_v2.pb.h>
 
 #include <algorithm>
@@ -52,6 +53,9 @@
 namespace doris::segment_v2 {
 #include "common/compile_check_begin.h"
 
+// Data pages written uncompressed without trying, see config::incompressible_page_skip_count.
+bvar::Adder<int64_t> g_column_writer_compress_skipped_pages("column_writer_compress_skipped_pages");
+
 class NullBitmapBuilder {
 public:
     NullBitmapBuilder() : _has_null(false), _bitmap_buf(512), _rle_encoder(&_bitmap_buf, 1) {}
@@ -716,10 +720,18 @@ Status ScalarColumnWriter::finish_current_page() {
     if (_new_page_callback != nullptr) {
         _new_page_callback->put_extra_info_in_page(data_page_footer);
     }
-    // trying to compress page body
+    // trying to compress page body, unless recent pages of this column turned out incompressible
     OwnedSlice compressed_body;
-    RETURN_IF_ERROR(PageIO::compress_page_body(_compress_codec, _opts.compression_min_space_saving,
-                                               body, &compressed_body));
+    if (_skip_compress_pages > 0) {
+        --_skip_compress_pages;
+        g_column_writer_compress_skipped_pages << 1;
+    } else {
+        RETURN_IF_ERROR(PageIO::compress_page_body(
+                _compress_codec, _opts.compression_min_space_saving, body, &compressed_body));
+        if (_compress_codec != nullptr && compressed_body.slice().empty()) {
+            _skip_compress_pages = config::incompressible_page_skip_count;
+        }
+    }
     if (compressed_body.slice().empty()) {
         // page body is uncompressed
         page->data.emplace_back(std::move(encoded_values));
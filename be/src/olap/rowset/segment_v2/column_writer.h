@@ -288,6 +288,9 @@ private:
     ordinal_t _first_rowid = 0;
 
     BlockCompressionCodec* _compress_codec;
+    // Data pages left to write uncompressed after a sampled page did not compress well enough,
+    // see config::incompressible_page_skip_count.
+    int32_t _skip_compress_pages = 0;
 
     std::unique_ptr<OrdinalIndexWriter> _ordinal_index_builder;
     std::unique_ptr<ZoneMapIndexWriter> _zone_map_index_builder;
@@ -464,6 +467,10 @@ public:
         if (_opts.need_bloom_filter) {
             return Status::NotSupported("map not support bloom filter index");
         }
+        // keys may carry a bloom filter index, e.g. the paths of a variant sparse column
+        for (auto& writer : _kv_writers) {
+            RETURN_IF_ERROR(writer->write_bloom_filter_index());
+        }
         return Status::OK();
     }
 
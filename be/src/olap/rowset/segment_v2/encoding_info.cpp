@@ -24,6 +24,7 @@
 #include <unordered_map>
 #include <utility>
 
+#include "common/config.h"
 #include "olap/olap_common.h"
 #include "olap/rowset/segment_v2/binary_dict_page.h"
 #include "olap/rowset/segment_v2/binary_plain_page.h"
@@ -385,5 +386,24 @@ EncodingTypePB EncodingInfo::get_default_encoding(const TypeInfo* type_info,
     return s_encoding_info_resolver.get_default_encoding(type_info->type(), optimize_value_seek);
 }
 
+EncodingTypePB EncodingInfo::get_sorted_column_encoding(FieldType type) {
+    if (!config::enable_segment_for_encoding_on_sort_key) {
+        return DEFAULT_ENCODING;
+    }
+    switch (type) {
+    case FieldType::OLAP_FIELD_TYPE_TINYINT:
+    case FieldType::OLAP_FIELD_TYPE_SMALLINT:
+    case FieldType::OLAP_FIELD_TYPE_INT:
+    case FieldType::OLAP_FIELD_TYPE_BIGINT:
+    case FieldType::OLAP_FIELD_TYPE_LARGEINT:
+    case FieldType::OLAP_FIELD_TYPE_DATEV2:
+    case FieldType::OLAP_FIELD_TYPE_DATETIMEV2:
+        // consecutive values of a sorted column have small deltas
+        return FOR_ENCODING;
+    default:
+        return DEFAULT_ENCODING;
+    }
+}
+
 } // namespace segment_v2
 } // namespace doris
@@ -57,6 +57,10 @@ public:
     // and support fast value seek operation
     static EncodingTypePB get_default_encoding(const TypeInfo* type_info, bool optimize_value_seek);
 
+    // Get the encoding for a column whose values are sorted within a segment,
+    // e.g. the leading sort key column.
+    static EncodingTypePB get_sorted_column_encoding(FieldType type);
+
     Status create_page_builder(const PageBuilderOptions& opts, PageBuilder** builder) const {
         return _create_builder_func(opts, builder);
     }
@@ -17,6 +17,9 @@
 
 #pragma once
 
+#include <algorithm>
+#include <vector>
+
 #include "olap/rowset/segment_v2/options.h"      // for PageBuilderOptions/PageDecoderOptions
 #include "olap/rowset/segment_v2/page_builder.h" // for PageBuilder
 #include "olap/rowset/segment_v2/page_decoder.h" // for PageDecoder
@@ -156,11 +159,38 @@ public:
     }
 
     Status next_batch(size_t* n, vectorized::MutableColumnPtr& dst) override {
-        return Status::NotSupported("frame page not implement vec op now");
+        return _next_batch<true>(n, dst);
     }
 
     Status peek_next_batch(size_t* n, vectorized::MutableColumnPtr& dst) override {
-        return Status::NotSupported("frame page not implement vec op now");
+        return _next_batch<false>(n, dst);
+    }
+
+    Status read_by_rowids(const rowid_t* rowids, ordinal_t page_first_ordinal, size_t* n,
+                          vectorized::MutableColumnPtr& dst) override {
+        DCHECK(_parsed) << "Must call init() firstly";
+        if (*n == 0 || _cur_index >= _num_elements) [[unlikely]] {
+            *n = 0;
+            return Status::OK();
+        }
+
+        size_t total = *n;
+        size_t read_count = 0;
+        _buffer.resize(total);
+        for (; read_count < total; ++read_count) {
+            ordinal_t ord = rowids[read_count] - page_first_ordinal;
+            if (ord >= _num_elements) [[unlikely]] {
+                break;
+            }
+            _decoder->skip(cast_set<int32_t>(ord - _cur_index));
+            if (!_decoder->get(&_buffer[read_count])) [[unlikely]] {
+                return Status::Corruption("The frame of reference page metadata maybe broken");
+            }
+            _cur_index = ord + 1;
+        }
+        dst->insert_many_fix_len_data((const char*)_buffer.data(), read_count);
+        *n = read_count;
+        return Status::OK();
     }
 
     size_t count() const override { return _num_elements; }
@@ -170,11 +200,35 @@ public:
 private:
     typedef typename TypeTraits<Type>::CppType CppType;
 
+    template <bool forward_index>
+    Status _next_batch(size_t* n, vectorized::MutableColumnPtr& dst) {
+        DCHECK(_parsed) << "Must call init() firstly";
+        if (*n == 0 || _cur_index >= _num_elements) [[unlikely]] {
+            *n = 0;
+            return Status::OK();
+        }
+
+        size_t to_fetch = std::min(*n, static_cast<size_t>(_num_elements - _cur_index));
+        _buffer.resize(to_fetch);
+        if (!_decoder->get_batch(_buffer.data(), to_fetch)) [[unlikely]] {
+            return Status::Corruption("The frame of reference page metadata maybe broken");
+        }
+        if constexpr (forward_index) {
+            _cur_index += to_fetch;
+        } else {
+            _decoder->skip(-cast_set<int32_t>(to_fetch));
+        }
+        dst->insert_many_fix_len_data((const char*)_buffer.data(), to_fetch);
+        *n = to_fetch;
+        return Status::OK();
+    }
+
     bool _parsed;
     Slice _data;
     uint32_t _num_elements;
     size_t _cur_index;
     std::unique_ptr<ForDecoder<CppType>> _decoder;
+    std::vector<CppType> _buffer;
 };
 
 #include "common/compile_check_end.h"
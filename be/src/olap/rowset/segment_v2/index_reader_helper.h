@@ -61,6 +61,19 @@ public:
         return get_parser_phrase_support_string_from_properties(properties) ==
                INVERTED_INDEX_PARSER_PHRASE_SUPPORT_YES;
     }
+
+    static bool is_ngram_index(const IndexReaderPtr& reader) {
+        if (!is_fulltext_index(reader)) {
+            return false;
+        }
+
+        auto inverted_index_reader = std::static_pointer_cast<InvertedIndexReader>(reader);
+        const auto& properties = inverted_index_reader->get_index_properties();
+        return get_custom_analyzer_string_from_properties(properties).empty() &&
+               get_inverted_index_parser_type_from_string(
+                       get_parser_string_from_properties(properties)) ==
+                       InvertedIndexParserType::PARSER_NGRAM;
+    }
 };
 
 #include "common/compile_check_end.h"
@@ -29,6 +29,7 @@
 #pragma clang diagnostic pop
 #endif
 #include "olap/rowset/segment_v2/inverted_index/analyzer/basic/basic_analyzer.h"
+#include "olap/rowset/segment_v2/inverted_index/analyzer/custom_analyzer.h"
 #include "olap/rowset/segment_v2/inverted_index/analyzer/icu/icu_analyzer.h"
 #include "olap/rowset/segment_v2/inverted_index/analyzer/ik/IKAnalyzer.h"
 #include "olap/rowset/segment_v2/inverted_index/char_filter/char_filter_factory.h"
@@ -61,6 +62,17 @@ std::shared_ptr<lucene::analysis::Analyzer> InvertedIndexAnalyzer::create_analyz
                             "index policy mgr is not initialized");
         }
         analyzer = index_policy_mgr->get_policy_by_name(inverted_index_ctx->custom_analyzer);
+    } else if (inverted_index_ctx->parser_type == InvertedIndexParserType::PARSER_NGRAM) {
+        // grams span the whole value, a substring of it always yields a subset of its grams
+        CustomAnalyzer::Builder builder;
+        auto gram_size = std::to_string(INVERTED_INDEX_PARSER_NGRAM_SIZE);
+        builder.with_tokenizer(INVERTED_INDEX_PARSER_NGRAM,
+                               Settings({{"min_gram", gram_size}, {"max_gram", gram_size}}));
+        // writers default lower_case to true while readers leave it empty
+        if (inverted_index_ctx->lower_case != INVERTED_INDEX_PARSER_FALSE) {
+            builder.add_token_filter("lowercase", Settings());
+        }
+        analyzer = builder.build();
     } else {
         auto analyser_type = inverted_index_ctx->parser_type;
         if (analyser_type == InvertedIndexParserType::PARSER_STANDARD ||
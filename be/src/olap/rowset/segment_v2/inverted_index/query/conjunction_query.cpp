@@ -19,6 +19,7 @@
 
 #include "olap/collection_statistics.h"
 #include "olap/rowset/segment_v2/inverted_index/query/query_helper.h"
+#include "olap/rowset/segment_v2/inverted_index/util/posting_intersection.h"
 #include "olap/rowset/segment_v2/inverted_index/util/mock_iterator.h"
 #include "olap/rowset/segment_v2/inverted_index/util/string_helper.h"
 
@@ -110,27 +111,51 @@ void ConjunctionQuery::search(roaring::Roaring& roaring) {
 }
 
 void ConjunctionQuery::search_by_bitmap(roaring::Roaring& roaring) {
-    // can get a term of all doc_id
-    auto func = [&roaring](const TermIterPtr& iter, bool first) {
-        roaring::Roaring result;
-        DocRange doc_range;
-        while (iter->read_range(&doc_range)) {
+    // The iterators are sorted by doc_freq, so the candidates start from the rarest term and
+    // every other term is intersected block by block as it is decoded.
+    std::vector<uint32_t> candidates;
+    std::vector<uint32_t> next;
+    DocRange doc_range;
+    while (_iterators[0]->read_range(&doc_range)) {
+        if (doc_range.type_ == DocRangeType::kMany) {
+            candidates.insert(candidates.end(), doc_range.doc_many->begin(),
+                              doc_range.doc_many->begin() + doc_range.doc_many_size_);
+        } else {
+            for (uint32_t doc = doc_range.doc_range.first; doc < doc_range.doc_range.second;
+                 ++doc) {
+                candidates.push_back(doc);
+            }
+        }
+    }
+
+    for (size_t i = 1; i < _iterators.size() && !candidates.empty(); i++) {
+        next.clear();
+        size_t pos = 0;
+        // stop decoding the term once it is past the last candidate
+        while (pos < candidates.size() && _iterators[i]->read_range(&doc_range)) {
+            const auto* begin = candidates.data() + pos;
+            const auto* end = candidates.data() + candidates.size();
             if (doc_range.type_ == DocRangeType::kMany) {
-                result.addMany(doc_range.doc_many_size_, doc_range.doc_many->data());
+                if (doc_range.doc_many_size_ == 0) {
+                    continue;
+                }
+                const auto* docs = doc_range.doc_many->data();
+                const auto* stop = std::upper_bound(begin, end, docs[doc_range.doc_many_size_ - 1]);
+                inverted_index::intersect_sorted_docs(begin, stop - begin, docs,
+                                                      doc_range.doc_many_size_, next);
+                pos = stop - candidates.data();
             } else {
-                result.addRange(doc_range.doc_range.first, doc_range.doc_range.second);
+                const auto* lo = std::lower_bound(begin, end, doc_range.doc_range.first);
+                const auto* hi = std::lower_bound(lo, end, doc_range.doc_range.second);
+                next.insert(next.end(), lo, hi);
+                pos = hi - candidates.data();
             }
         }
-        if (first) {
-            roaring.swap(result);
-        } else {
-            roaring &= result;
-        }
-    };
-
-    for (size_t i = 0; i < _iterators.size(); i++) {
-        func(_iterators[i], i == 0);
+        candidates.swap(next);
     }
+
+    roaring = roaring::Roaring();
+    roaring.addMany(candidates.size(), candidates.data());
 }
 
 void ConjunctionQuery::search_by_skiplist(roaring::Roaring& roaring) {
@@ -0,0 +1,77 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace doris::segment_v2::inverted_index {
+#include "common/compile_check_begin.h"
+
+// Above this size ratio the short side gallops through the long one instead of merging.
+static constexpr size_t GALLOP_SIZE_RATIO = 32;
+
+// Appends the ids contained in both sorted, duplicate free arrays to `out`.
+inline void intersect_sorted_docs(const uint32_t* a, size_t na, const uint32_t* b, size_t nb,
+                                  std::vector<uint32_t>& out) {
+    if (na == 0 || nb == 0) {
+        return;
+    }
+    if (na > nb) {
+        std::swap(a, b);
+        std::swap(na, nb);
+    }
+    if (nb / na >= GALLOP_SIZE_RATIO) {
+        const uint32_t* pos = b;
+        const uint32_t* end = b + nb;
+        for (size_t i = 0; i < na && pos < end; ++i) {
+            // exponential probe, then binary search inside the last step
+            size_t step = 1;
+            while (pos + step < end && pos[step] < a[i]) {
+                step <<= 1;
+            }
+            pos = std::lower_bound(pos + (step >> 1), std::min(pos + step + 1, end), a[i]);
+            if (pos < end && *pos == a[i]) {
+                out.push_back(a[i]);
+                ++pos;
+            }
+        }
+        return;
+    }
+
+    // branchless merge, every step writes a candidate and only keeps it on a match
+    size_t old_size = out.size();
+    out.resize(old_size + na);
+    uint32_t* dst = out.data() + old_size;
+    size_t i = 0;
+    size_t j = 0;
+    while (i < na && j < nb) {
+        uint32_t x = a[i];
+        uint32_t y = b[j];
+        *dst = x;
+        dst += x == y;
+        i += x <= y;
+        j += y <= x;
+    }
+    out.resize(static_cast<size_t>(dst - out.data()));
+}
+
+#include "common/compile_check_end.h"
+} // namespace doris::segment_v2::inverted_index
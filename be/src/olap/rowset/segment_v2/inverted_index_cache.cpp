@@ -128,16 +128,26 @@ bool InvertedIndexQueryCache::lookup(const CacheKey& key, InvertedIndexQueryCach
 
 void InvertedIndexQueryCache::insert(const CacheKey& key, std::shared_ptr<roaring::Roaring> bitmap,
                                      InvertedIndexQueryCacheHandle* handle) {
-    std::unique_ptr<InvertedIndexQueryCache::CacheValue> cache_value_ptr =
-            std::make_unique<InvertedIndexQueryCache::CacheValue>();
-    cache_value_ptr->bitmap = bitmap;
+    insert(key, std::move(bitmap), nullptr, handle);
+}
+
+void InvertedIndexQueryCache::insert(const CacheKey& key, std::shared_ptr<roaring::Roaring> bitmap,
+                                     std::shared_ptr<roaring::Roaring> null_bitmap,
+                                     InvertedIndexQueryCacheHandle* handle) {
     if (key.encode().empty()) {
         return;
     }
+    size_t charge = bitmap->getSizeInBytes();
+    if (null_bitmap != nullptr) {
+        charge += null_bitmap->getSizeInBytes();
+    }
+    std::unique_ptr<InvertedIndexQueryCache::CacheValue> cache_value_ptr =
+            std::make_unique<InvertedIndexQueryCache::CacheValue>();
+    cache_value_ptr->bitmap = std::move(bitmap);
+    cache_value_ptr->null_bitmap = std::move(null_bitmap);
 
     auto* lru_handle = LRUCachePolicy::insert(key.encode(), (void*)cache_value_ptr.release(),
-                                              bitmap->getSizeInBytes(), bitmap->getSizeInBytes(),
-                                              CachePriority::NORMAL);
+                                              charge, charge, CachePriority::NORMAL);
     *handle = InvertedIndexQueryCacheHandle(this, lru_handle);
 }
 
@@ -210,6 +210,8 @@ public:
     class CacheValue : public LRUCacheValueBase {
     public:
         std::shared_ptr<roaring::Roaring> bitmap;
+        // only set for cached compound expr results
+        std::shared_ptr<roaring::Roaring> null_bitmap;
     };
 
     // Create global instance of this class
@@ -235,6 +237,10 @@ public:
 
     void insert(const CacheKey& key, std::shared_ptr<roaring::Roaring> bitmap,
                 InvertedIndexQueryCacheHandle* handle);
+
+    void insert(const CacheKey& key, std::shared_ptr<roaring::Roaring> bitmap,
+                std::shared_ptr<roaring::Roaring> null_bitmap,
+                InvertedIndexQueryCacheHandle* handle);
 };
 
 class InvertedIndexQueryCacheHandle {
@@ -271,6 +277,13 @@ public:
         return ((InvertedIndexQueryCache::CacheValue*)_cache->value(_handle))->bitmap;
     }
 
+    std::shared_ptr<roaring::Roaring> get_null_bitmap() const {
+        if (!_cache) {
+            return nullptr;
+        }
+        return ((InvertedIndexQueryCache::CacheValue*)_cache->value(_handle))->null_bitmap;
+    }
+
 private:
     LRUCachePolicy* _cache = nullptr;
     Cache::Handle* _handle = nullptr;
@@ -76,6 +76,7 @@ public:
 
     // load and parse the index page into memory
     Status load(bool use_page_cache, bool kept_in_memory, OlapReaderStatistics* index_load_stats);
+    bool is_loaded() const { return _load_once.has_called() && _load_once.stored_result().ok(); }
 
     // the returned iter points to the largest element which is less than `ordinal`,
     // or points to the first element if all elements are greater than `ordinal`,
@@ -17,6 +17,7 @@
 
 #include "olap/rowset/segment_v2/page_io.h"
 
+#include <bvar/latency_recorder.h>
 #include <gen_cpp/segment_v2.pb.h>
 #include <stdint.h>
 
@@ -28,6 +29,7 @@
 #include <utility>
 
 #include "cloud/config.h"
+#include "common/config.h"
 #include "common/logging.h"
 #include "cpp/sync_point.h"
 #include "io/cache/block_file_cache.h"
@@ -42,6 +44,7 @@
 #include "util/block_compression.h"
 #include "util/coding.h"
 #include "util/crc32c.h"
+#include "util/defer_op.h"
 #include "util/faststring.h"
 #include "util/runtime_profile.h"
 
@@ -49,6 +52,10 @@ namespace doris {
 namespace segment_v2 {
 #include "common/compile_check_begin.h"
 
+// Latency(us) of reading one page from its file, excluding decompression.
+bvar::LatencyRecorder g_page_read_local_latency("doris_page_read", "local");
+bvar::LatencyRecorder g_page_read_remote_latency("doris_page_read", "remote");
+
 Status PageIO::compress_page_body(BlockCompressionCodec* codec, double min_space_saving,
                                   const std::vector<Slice>& body, OwnedSlice* compressed_body) {
     size_t uncompressed_size = Slice::compute_total_size(body);
@@ -135,12 +142,13 @@ Status PageIO::read_and_decompress_page_(const PageReadOptions& opts, PageHandle
                                          opts.file_reader->size(), opts.page_pointer.offset);
     VLOG_DEBUG << fmt::format("Reading page {}:{}:{}", cache_key.fname, cache_key.fsize,
                               cache_key.offset);
-    if (opts.use_page_cache && cache && cache->lookup(cache_key, &cache_handle, opts.type)) {
+    auto use_cached_page = [&]() {
         // we find page in cache, use it
         *handle = PageHandle(std::move(cache_handle));
         opts.stats->cached_pages_num++;
         // parse body and footer
         Slice page_slice = handle->data();
+        opts.stats->bytes_read_from_page_cache += page_slice.size;
         uint32_t footer_size = decode_fixed32_le((uint8_t*)page_slice.data + page_slice.size - 4);
         std::string footer_buf(page_slice.data + page_slice.size - 4 - footer_size, footer_size);
         if (!footer->ParseFromString(footer_buf)) {
@@ -151,7 +159,31 @@ Status PageIO::read_and_decompress_page_(const PageReadOptions& opts, PageHandle
         // If read from cache, then should also recorded in uncompressed bytes read counter.
         opts.stats->uncompressed_bytes_read += body->size;
         return Status::OK();
+    };
+    if (opts.use_page_cache && cache && cache->lookup(cache_key, &cache_handle, opts.type)) {
+        return use_cached_page();
+    }
+
+    // pages of streaming reads are not inserted if they bypass page cache
+    const bool insert_page_cache =
+            opts.use_page_cache &&
+            !(opts.streaming_read && config::storage_page_cache_bypass_streaming_read);
+
+    // Let concurrent scans of the same page share one read and decompression. If the page is
+    // still missing after waiting, e.g. it was evicted or the load failed, read it without
+    // coalescing again.
+    bool is_loader = false;
+    if (insert_page_cache && cache && config::enable_storage_page_load_coalescing) {
+        is_loader = cache->start_loading(cache_key);
+        if (!is_loader && cache->lookup(cache_key, &cache_handle, opts.type)) {
+            return use_cached_page();
+        }
     }
+    Defer finish_loading {[&]() {
+        if (is_loader) {
+            cache->finish_loading(cache_key);
+        }
+    }};
 
     // every page contains 4 bytes footer length and 4 bytes checksum
     const uint32_t page_size = opts.page_pointer.size;
@@ -162,15 +194,23 @@ Status PageIO::read_and_decompress_page_(const PageReadOptions& opts, PageHandle
 
     // hold compressed page at first, reset to decompressed page later
     std::unique_ptr<DataPage> page =
-            std::make_unique<DataPage>(page_size, opts.use_page_cache, opts.type);
+            std::make_unique<DataPage>(page_size, insert_page_cache, opts.type);
     Slice page_slice(page->data(), page_size);
     {
-        SCOPED_RAW_TIMER(&opts.stats->io_ns);
-        size_t bytes_read = 0;
-        RETURN_IF_ERROR(opts.file_reader->read_at(opts.page_pointer.offset, page_slice, &bytes_read,
-                                                  &opts.io_ctx));
-        DCHECK_EQ(bytes_read, page_size);
+        int64_t io_ns = 0;
+        {
+            SCOPED_RAW_TIMER(&io_ns);
+            size_t bytes_read = 0;
+            RETURN_IF_ERROR(opts.file_reader->read_at(opts.page_pointer.offset, page_slice,
+                                                      &bytes_read, &opts.io_ctx));
+            DCHECK_EQ(bytes_read, page_size);
+        }
+        opts.stats->io_ns += io_ns;
         opts.stats->compressed_bytes_read += page_size;
+        // Only local file readers report a real data dir.
+        bool is_remote =
+                &opts.file_reader->get_data_dir_path() == &io::FileReader::VIRTUAL_REMOTE_DATA_DIR;
+        (is_remote ? g_page_read_remote_latency : g_page_read_local_latency) << io_ns / 1000;
     }
 
     if (opts.verify_checksum) {
@@ -204,7 +244,7 @@ Status PageIO::read_and_decompress_page_(const PageReadOptions& opts, PageHandle
         }
         SCOPED_RAW_TIMER(&opts.stats->decompress_ns);
         std::unique_ptr<DataPage> decompressed_page = std::make_unique<DataPage>(
-                footer->uncompressed_size() + footer_size + 4, opts.use_page_cache, opts.type);
+                footer->uncompressed_size() + footer_size + 4, insert_page_cache, opts.type);
 
         // decompress page body
         Slice compressed_body(page_slice.data, body_size);
@@ -229,7 +269,7 @@ Status PageIO::read_and_decompress_page_(const PageReadOptions& opts, PageHandle
         if (pre_decoder) {
             RETURN_IF_ERROR(pre_decoder->decode(
                     &page, &page_slice, footer->data_page_footer().nullmap_size() + footer_size + 4,
-                    opts.use_page_cache, opts.type));
+                    insert_page_cache, opts.type));
         }
     }
 
@@ -239,9 +279,12 @@ Status PageIO::read_and_decompress_page_(const PageReadOptions& opts, PageHandle
     // uncompressed or decoded. So that should update the uncompressed_bytes_read counter
     // just before add it to pagecache, it will be consistency with reading data from page cache.
     opts.stats->uncompressed_bytes_read += body->size;
-    if (opts.use_page_cache && cache) {
+    if (insert_page_cache && cache) {
+        page->set_read_source(
+                {opts.page_pointer.size, opts.codec, opts.encoding_info, opts.pre_decode});
         // insert this page into cache and return the cache handle
-        cache->insert(cache_key, page.get(), &cache_handle, opts.type, opts.kept_in_memory);
+        cache->insert(cache_key, page.get(), &cache_handle, opts.type, opts.kept_in_memory,
+                      opts.streaming_read);
         *handle = PageHandle(std::move(cache_handle));
     } else {
         *handle = PageHandle(page.get());
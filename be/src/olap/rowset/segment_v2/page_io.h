@@ -53,6 +53,9 @@ struct PageReadOptions {
     // if true, use DURABLE CachePriority in page cache
     // currently used for in memory olap table
     bool kept_in_memory = false;
+    // if true, the page is read by a large scan and probably read only once, see
+    // config::storage_page_cache_streaming_scan_bytes
+    bool streaming_read = false;
     // index_page should not be pre-decoded
     bool pre_decode = true;
     // for page cache allocation
@@ -86,6 +89,7 @@ struct PageReadOptions {
         verify_checksum = old.verify_checksum;
         use_page_cache = old.use_page_cache;
         kept_in_memory = old.kept_in_memory;
+        streaming_read = old.streaming_read;
         type = old.type;
         encoding_info = old.encoding_info;
         pre_decode = old.pre_decode;
@@ -100,7 +104,8 @@ struct InjectionContext {
 inline std::ostream& operator<<(std::ostream& os, const PageReadOptions& opt) {
     return os << "PageReadOptions { verify_checksum=" << opt.verify_checksum
               << " use_page_cache=" << opt.use_page_cache
-              << " kept_in_memory=" << opt.kept_in_memory << " pre_decode=" << opt.pre_decode
+              << " kept_in_memory=" << opt.kept_in_memory
+              << " streaming_read=" << opt.streaming_read << " pre_decode=" << opt.pre_decode
               << " type=" << opt.type << " page_pointer=" << opt.page_pointer
               << " has_codec=" << (opt.codec != nullptr)
               << " has_encoding_info=" << (opt.encoding_info != nullptr) << " }";
@@ -238,14 +238,16 @@ public:
         }
 
         size_t to_fetch = std::min(*n, static_cast<size_t>(_num_elements - _cur_index));
+        // Decode runs in chunks so that columns are filled with bulk inserts.
+        CppType values[BATCH_SIZE];
         size_t remaining = to_fetch;
-        bool result = false;
-        CppType value;
         while (remaining > 0) {
-            result = _rle_decoder.Get(&value);
-            DCHECK(result);
-            dst->insert_data((char*)(&value), SIZE_OF_TYPE);
-            remaining--;
+            size_t num_decoded = _rle_decoder.get_values(values, std::min(remaining, BATCH_SIZE));
+            if (num_decoded == 0) [[unlikely]] {
+                return Status::Corruption("RLE page has fewer values than expected");
+            }
+            dst->insert_many_fix_len_data((char*)values, num_decoded);
+            remaining -= num_decoded;
         }
 
         _cur_index += to_fetch;
@@ -299,6 +301,7 @@ private:
     uint32_t _num_elements;
     size_t _cur_index;
     int _bit_width;
+    static constexpr size_t BATCH_SIZE = 256;
     RleDecoder<CppType> _rle_decoder;
 };
 
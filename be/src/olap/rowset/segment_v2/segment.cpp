@@ -23,6 +23,7 @@
 
 #include <cstring>
 #include <memory>
+#include <set>
 #include <utility>
 
 #include "cloud/config.h"
@@ -199,7 +200,6 @@ Status Segment::_open(OlapReaderStatistics* stats) {
     }
 
     _meta_mem_usage += sizeof(*this);
-    _meta_mem_usage += _tablet_schema->num_columns() * config::estimated_mem_per_column_reader;
 
     // 1024 comes from SegmentWriterOptions
     _meta_mem_usage += (_num_rows + 1023) / 1024 * (36 + 4);
@@ -240,16 +240,15 @@ Status Segment::new_iterator(SchemaSPtr schema, const StorageReadOptions& read_o
         if (col.is_extracted_column()) {
             auto relative_path = col.path_info_ptr()->copy_pop_front();
             int32_t unique_id = col.unique_id() > 0 ? col.unique_id() : col.parent_unique_id();
-            const auto* node =
-                    _column_readers.contains(unique_id)
-                            ? ((VariantColumnReader*)(_column_readers.at(unique_id).get()))
-                                      ->get_reader_by_path(relative_path)
-                            : nullptr;
+            auto* variant_reader = _find_column_reader(unique_id);
+            const auto* node = variant_reader != nullptr
+                                       ? ((VariantColumnReader*)variant_reader)
+                                                 ->get_reader_by_path(relative_path)
+                                       : nullptr;
             reader = node != nullptr ? node->data.reader.get() : nullptr;
         } else {
-            reader = _column_readers.contains(col.unique_id())
-                             ? _column_readers[col.unique_id()].get()
-                             : nullptr;
+            RETURN_IF_ERROR(
+                    _get_or_create_column_reader(col.unique_id(), read_options.stats, &reader));
         }
         if (!reader || !reader->has_zone_map()) {
             continue;
@@ -277,10 +276,12 @@ Status Segment::new_iterator(SchemaSPtr schema, const StorageReadOptions& read_o
             AndBlockColumnPredicate and_predicate;
             and_predicate.add_column_predicate(
                     SingleColumnBlockPredicate::create_unique(runtime_predicate.get()));
-            if (_column_readers.contains(uid) &&
+            ColumnReader* reader = nullptr;
+            RETURN_IF_ERROR(_get_or_create_column_reader(uid, read_options.stats, &reader));
+            if (reader != nullptr &&
                 can_apply_predicate_safely(runtime_predicate->column_id(), runtime_predicate.get(),
                                            *schema, read_options.io_ctx.reader_type) &&
-                !_column_readers.at(uid)->match_condition(&and_predicate)) {
+                !reader->match_condition(&and_predicate)) {
                 // any condition not satisfied, return.
                 *iter = std::make_unique<EmptySegmentIterator>(*schema);
                 read_options.stats->filtered_segment_number++;
@@ -307,10 +308,24 @@ Status Segment::new_iterator(SchemaSPtr schema, const StorageReadOptions& read_o
         !read_options.column_predicates.empty()) {
         auto pruned_predicates = read_options.column_predicates;
         auto pruned = false;
-        for (auto& it : _column_readers) {
-            const auto uid = it.first;
-            const auto column_id = read_options.tablet_schema->field_index(uid);
-            pruned |= it.second->prune_predicates_by_zone_map(pruned_predicates, column_id);
+        // Only columns with predicates can prune anything, no need to touch the others.
+        std::set<ColumnId> predicate_column_ids;
+        for (const auto* predicate : read_options.column_predicates) {
+            predicate_column_ids.insert(predicate->column_id());
+        }
+        for (auto column_id : predicate_column_ids) {
+            if (column_id >= read_options.tablet_schema->num_columns()) {
+                continue;
+            }
+            const auto uid = read_options.tablet_schema->column(column_id).unique_id();
+            if (uid < 0) {
+                continue;
+            }
+            ColumnReader* reader = nullptr;
+            RETURN_IF_ERROR(_get_or_create_column_reader(uid, read_options.stats, &reader));
+            if (reader != nullptr) {
+                pruned |= reader->prune_predicates_by_zone_map(pruned_predicates, column_id);
+            }
         }
 
         if (pruned) {
@@ -589,12 +604,12 @@ vectorized::DataTypePtr Segment::get_data_type_of(const TabletColumn& column,
     int32_t unique_id = column.unique_id() > 0 ? column.unique_id() : column.parent_unique_id();
 
     // Find the reader for the base variant column.
-    if (!_column_readers.contains(unique_id)) {
+    const auto* reader = _find_column_reader(unique_id);
+    if (reader == nullptr) {
         return vectorized::DataTypeFactory::instance().create_data_type(column);
     }
 
-    const auto* variant_reader =
-            static_cast<const VariantColumnReader*>(_column_readers.at(unique_id).get());
+    const auto* variant_reader = static_cast<const VariantColumnReader*>(reader);
 
     // Find the specific node within the variant structure using the relative path.
     const auto* node = variant_reader->get_reader_by_path(relative_path);
@@ -669,6 +684,12 @@ Status Segment::_create_column_readers(const SegmentFooterPB& footer) {
         if (iter == column_id_to_footer_ordinal.end()) {
             continue;
         }
+        _column_uid_to_footer_ordinal.emplace(column.unique_id(), iter->second);
+        // Variant readers are looked up by path from places without a chance to
+        // create them, keep them eager. Other readers are created on first access.
+        if (!column.is_variant_type()) {
+            continue;
+        }
 
         ColumnReaderOptions opts {
                 .kept_in_memory = _tablet_schema->is_in_memory(),
@@ -678,9 +699,51 @@ Status Segment::_create_column_readers(const SegmentFooterPB& footer) {
         std::unique_ptr<ColumnReader> reader;
         RETURN_IF_ERROR(ColumnReader::create(opts, footer, iter->second, footer.num_rows(),
                                              _file_reader, &reader));
+        std::lock_guard lock(_column_readers_lock);
         _column_readers.emplace(column.unique_id(), std::move(reader));
+        _meta_mem_usage += config::estimated_mem_per_column_reader;
+        update_metadata_size();
+    }
+
+    return Status::OK();
+}
+
+ColumnReader* Segment::_find_column_reader(int32_t unique_id) const {
+    std::lock_guard lock(_column_readers_lock);
+    auto it = _column_readers.find(unique_id);
+    return it != _column_readers.end() ? it->second.get() : nullptr;
+}
+
+Status Segment::_get_or_create_column_reader(int32_t unique_id, OlapReaderStatistics* stats,
+                                             ColumnReader** reader) {
+    *reader = nullptr;
+    auto ordinal_it = _column_uid_to_footer_ordinal.find(unique_id);
+    if (ordinal_it == _column_uid_to_footer_ordinal.end()) {
+        return Status::OK();
+    }
+    if ((*reader = _find_column_reader(unique_id)) != nullptr) {
+        return Status::OK();
     }
 
+    std::shared_ptr<SegmentFooterPB> footer_pb_shared;
+    RETURN_IF_ERROR(_get_segment_footer(footer_pb_shared, stats));
+    ColumnReaderOptions opts {
+            .kept_in_memory = _tablet_schema->is_in_memory(),
+            .be_exec_version = _be_exec_version,
+            .tablet_schema = _tablet_schema,
+    };
+    std::unique_ptr<ColumnReader> new_reader;
+    RETURN_IF_ERROR(ColumnReader::create(opts, *footer_pb_shared, ordinal_it->second,
+                                         footer_pb_shared->num_rows(), _file_reader,
+                                         &new_reader));
+    // Another thread may have created the same reader meanwhile, keep the first one.
+    std::lock_guard lock(_column_readers_lock);
+    auto [it, inserted] = _column_readers.try_emplace(unique_id, std::move(new_reader));
+    if (inserted) {
+        _meta_mem_usage += config::estimated_mem_per_column_reader;
+        update_metadata_size();
+    }
+    *reader = it->second.get();
     return Status::OK();
 }
 
@@ -722,24 +785,25 @@ Status Segment::new_column_iterator(const TabletColumn& tablet_column,
     // For compability reason unique_id may less than 0 for variant extracted column
     int32_t unique_id = tablet_column.unique_id() >= 0 ? tablet_column.unique_id()
                                                        : tablet_column.parent_unique_id();
+    ColumnReader* reader = nullptr;
+    RETURN_IF_ERROR(_get_or_create_column_reader(unique_id, opt->stats, &reader));
     // init default iterator
-    if (!_column_readers.contains(unique_id)) {
+    if (reader == nullptr) {
         RETURN_IF_ERROR(new_default_iterator(tablet_column, iter));
         return Status::OK();
     }
     // init iterator by unique id
     ColumnIterator* it;
-    RETURN_IF_ERROR(_column_readers.at(unique_id)->new_iterator(&it, &tablet_column, opt));
+    RETURN_IF_ERROR(reader->new_iterator(&it, &tablet_column, opt));
     iter->reset(it);
 
     if (config::enable_column_type_check && !tablet_column.has_path_info() &&
-        !tablet_column.is_agg_state_type() &&
-        tablet_column.type() != _column_readers.at(unique_id)->get_meta_type()) {
+        !tablet_column.is_agg_state_type() && tablet_column.type() != reader->get_meta_type()) {
         LOG(WARNING) << "different type between schema and column reader,"
                      << " column schema name: " << tablet_column.name()
                      << " column schema type: " << int(tablet_column.type())
                      << " column reader meta type: "
-                     << int(_column_readers.at(unique_id)->get_meta_type());
+                     << int(reader->get_meta_type());
         return Status::InternalError("different type between schema and column reader");
     }
     return Status::OK();
@@ -747,13 +811,8 @@ Status Segment::new_column_iterator(const TabletColumn& tablet_column,
 
 Status Segment::get_column_reader(int32_t col_unique_id, ColumnReader** reader) {
     RETURN_IF_ERROR(_create_column_readers_once(nullptr));
-    if (_column_readers.contains(col_unique_id)) {
-        *reader = _column_readers[col_unique_id].get();
-        return Status::OK();
-    }
-    // The column reader is not found, since the segment does not contain the column, example new added column.
-    *reader = nullptr;
-    return Status::OK();
+    // reader is nullptr if the segment does not contain the column, example new added column.
+    return _get_or_create_column_reader(col_unique_id, nullptr, reader);
 }
 
 Status Segment::new_column_iterator(int32_t unique_id, const StorageReadOptions* opt,
@@ -761,37 +820,41 @@ Status Segment::new_column_iterator(int32_t unique_id, const StorageReadOptions*
     RETURN_IF_ERROR(_create_column_readers_once(opt->stats));
     ColumnIterator* it;
     TabletColumn tablet_column = _tablet_schema->column_by_uid(unique_id);
-    RETURN_IF_ERROR(_column_readers.at(unique_id)->new_iterator(&it, &tablet_column));
+    ColumnReader* reader = nullptr;
+    RETURN_IF_ERROR(_get_or_create_column_reader(unique_id, opt->stats, &reader));
+    if (reader == nullptr) {
+        return Status::InternalError("column {} not found in segment {}", unique_id, _segment_id);
+    }
+    RETURN_IF_ERROR(reader->new_iterator(&it, &tablet_column));
     iter->reset(it);
     return Status::OK();
 }
 
-ColumnReader* Segment::_get_column_reader(const TabletColumn& col) {
+Status Segment::_get_column_reader(const TabletColumn& col, OlapReaderStatistics* stats,
+                                   ColumnReader** reader) {
+    *reader = nullptr;
     // init column iterator by path info
     if (col.has_path_info() || col.is_variant_type()) {
         auto relative_path = col.path_info_ptr()->copy_pop_front();
         int32_t unique_id = col.unique_id() > 0 ? col.unique_id() : col.parent_unique_id();
-        const auto* node = col.has_path_info() && _column_readers.contains(unique_id)
-                                   ? ((VariantColumnReader*)(_column_readers.at(unique_id).get()))
-                                             ->get_reader_by_path(relative_path)
-                                   : nullptr;
+        auto* variant_reader = col.has_path_info() ? _find_column_reader(unique_id) : nullptr;
+        const auto* node = variant_reader != nullptr ? ((VariantColumnReader*)variant_reader)
+                                                               ->get_reader_by_path(relative_path)
+                                                     : nullptr;
         if (node != nullptr) {
-            return node->data.reader.get();
+            *reader = node->data.reader.get();
         }
-        return nullptr;
-    }
-    auto col_unique_id = col.unique_id();
-    if (_column_readers.contains(col_unique_id)) {
-        return _column_readers[col_unique_id].get();
+        return Status::OK();
     }
-    return nullptr;
+    return _get_or_create_column_reader(col.unique_id(), stats, reader);
 }
 
 Status Segment::new_bitmap_index_iterator(const TabletColumn& tablet_column,
                                           const StorageReadOptions& read_options,
                                           std::unique_ptr<BitmapIndexIterator>* iter) {
     RETURN_IF_ERROR(_create_column_readers_once(read_options.stats));
-    ColumnReader* reader = _get_column_reader(tablet_column);
+    ColumnReader* reader = nullptr;
+    RETURN_IF_ERROR(_get_column_reader(tablet_column, read_options.stats, &reader));
     if (reader != nullptr && reader->has_bitmap_index()) {
         BitmapIndexIterator* it;
         RETURN_IF_ERROR(reader->new_bitmap_index_iterator(&it));
@@ -808,7 +871,8 @@ Status Segment::new_index_iterator(const TabletColumn& tablet_column, const Tabl
         _be_exec_version = read_options.runtime_state->be_exec_version();
     }
     RETURN_IF_ERROR(_create_column_readers_once(read_options.stats));
-    ColumnReader* reader = _get_column_reader(tablet_column);
+    ColumnReader* reader = nullptr;
+    RETURN_IF_ERROR(_get_column_reader(tablet_column, read_options.stats, &reader));
     if (reader != nullptr && index_meta) {
         // call DorisCallOnce.call without check if _index_file_reader is nullptr
         // to avoid data race during parallel method calls
@@ -970,6 +1034,14 @@ Status Segment::seek_and_read_by_rowid(const TabletSchema& schema, SlotDescripto
                                        uint32_t row_id, vectorized::MutableColumnPtr& result,
                                        OlapReaderStatistics& stats,
                                        std::unique_ptr<ColumnIterator>& iterator_hint) {
+    return seek_and_read_by_rowids(schema, slot, &row_id, 1, result, stats, iterator_hint);
+}
+
+Status Segment::seek_and_read_by_rowids(const TabletSchema& schema, SlotDescriptor* slot,
+                                        const rowid_t* row_ids, size_t num_rows,
+                                        vectorized::MutableColumnPtr& result,
+                                        OlapReaderStatistics& stats,
+                                        std::unique_ptr<ColumnIterator>& iterator_hint) {
     StorageReadOptions storage_read_opt;
     storage_read_opt.stats = &stats;
     storage_read_opt.io_ctx.reader_type = ReaderType::READER_QUERY;
@@ -981,7 +1053,6 @@ Status Segment::seek_and_read_by_rowid(const TabletSchema& schema, SlotDescripto
                                      .file_cache_stats = &stats.file_cache_stats},
     };
 
-    std::vector<segment_v2::rowid_t> single_row_loc {row_id};
     if (!slot->column_paths().empty()) {
         // here need create column readers to make sure column reader is created before seek_and_read_by_rowid
         // if segment cache miss, column reader will be created to make sure the variant column result not coredump
@@ -1000,15 +1071,14 @@ Status Segment::seek_and_read_by_rowid(const TabletSchema& schema, SlotDescripto
             RETURN_IF_ERROR(new_column_iterator(column, &iterator_hint, &storage_read_opt));
             RETURN_IF_ERROR(iterator_hint->init(opt));
         }
-        RETURN_IF_ERROR(
-                iterator_hint->read_by_rowids(single_row_loc.data(), 1, file_storage_column));
+        RETURN_IF_ERROR(iterator_hint->read_by_rowids(row_ids, num_rows, file_storage_column));
         vectorized::ColumnPtr source_ptr;
         // storage may have different type with schema, so we need to cast the column
         RETURN_IF_ERROR(vectorized::schema_util::cast_column(
                 vectorized::ColumnWithTypeAndName(file_storage_column->get_ptr(), storage_type,
                                                   column.name()),
                 slot->type(), &source_ptr));
-        RETURN_IF_CATCH_EXCEPTION(result->insert_range_from(*source_ptr, 0, 1));
+        RETURN_IF_CATCH_EXCEPTION(result->insert_range_from(*source_ptr, 0, num_rows));
     } else {
         int index = (slot->col_unique_id() >= 0) ? schema.field_index(slot->col_unique_id())
                                                  : schema.field_index(slot->col_name());
@@ -1024,7 +1094,7 @@ Status Segment::seek_and_read_by_rowid(const TabletSchema& schema, SlotDescripto
                     new_column_iterator(schema.column(index), &iterator_hint, &storage_read_opt));
             RETURN_IF_ERROR(iterator_hint->init(opt));
         }
-        RETURN_IF_ERROR(iterator_hint->read_by_rowids(single_row_loc.data(), 1, result));
+        RETURN_IF_ERROR(iterator_hint->read_by_rowids(row_ids, num_rows, result));
     }
     return Status::OK();
 }
@@ -22,9 +22,11 @@
 #include <gen_cpp/segment_v2.pb.h>
 #include <glog/logging.h>
 
+#include <atomic>
 #include <cstdint>
 #include <map>
 #include <memory> // for unique_ptr
+#include <mutex>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -144,6 +146,13 @@ public:
                                   vectorized::MutableColumnPtr& result, OlapReaderStatistics& stats,
                                   std::unique_ptr<ColumnIterator>& iterator_hint);
 
+    // Same as above for `num_rows` rows, `row_ids` must be ascending
+    Status seek_and_read_by_rowids(const TabletSchema& schema, SlotDescriptor* slot,
+                                   const rowid_t* row_ids, size_t num_rows,
+                                   vectorized::MutableColumnPtr& result,
+                                   OlapReaderStatistics& stats,
+                                   std::unique_ptr<ColumnIterator>& iterator_hint);
+
     Status load_index(OlapReaderStatistics* stats);
 
     Status load_pk_index_and_bf(OlapReaderStatistics* stats);
@@ -220,7 +229,14 @@ private:
     Status _create_column_readers(const SegmentFooterPB& footer);
     Status _load_pk_bloom_filter(OlapReaderStatistics* stats);
     // Must ensure _create_column_readers_once has been called before calling this function.
-    ColumnReader* _get_column_reader(const TabletColumn& col);
+    Status _get_column_reader(const TabletColumn& col, OlapReaderStatistics* stats,
+                              ColumnReader** reader);
+    // Return the reader of column `unique_id`, creating it from the footer on first access.
+    // Set `reader` to nullptr if this segment has no data for the column.
+    Status _get_or_create_column_reader(int32_t unique_id, OlapReaderStatistics* stats,
+                                        ColumnReader** reader);
+    // Only return readers already created, variant readers are always created eagerly.
+    ColumnReader* _find_column_reader(int32_t unique_id) const;
 
     Status _write_error_file(size_t file_size, size_t offset, size_t bytes_read, char* data,
                              io::IOContext& io_ctx);
@@ -241,9 +257,9 @@ private:
     AtomicStatus _healthy_status;
 
     // 1. Tracking memory use by segment meta data such as footer or index page.
-    // 2. Tracking memory use by segment column reader
+    // 2. Tracking memory use by segment column reader, charged when each reader is created
     // The memory consumed by querying is tracked in segment iterator.
-    int64_t _meta_mem_usage;
+    std::atomic<int64_t> _meta_mem_usage;
     int64_t _tracked_meta_mem_usage = 0;
 
     RowsetId _rowset_id;
@@ -256,7 +272,12 @@ private:
     // ColumnReader for each column in TabletSchema. If ColumnReader is nullptr,
     // This means that this segment has no data for that column, which may be added
     // after this segment is generated.
+    // Readers of non-variant columns are created on first access, so a query that
+    // projects a few columns of a wide table only keeps the metadata of those columns.
     std::map<int32_t, std::unique_ptr<ColumnReader>> _column_readers;
+    mutable std::mutex _column_readers_lock;
+    // map column unique id ---> ordinal of its ColumnMetaPB in SegmentFooterPB
+    std::unordered_map<int32_t, uint32_t> _column_uid_to_footer_ordinal;
 
     // Init from ColumnMetaPB in SegmentFooterPB
     // map column unique id ---> it's inner data type
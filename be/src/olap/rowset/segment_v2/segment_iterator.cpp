@@ -38,6 +38,7 @@
 #include "common/logging.h"
 #include "common/object_pool.h"
 #include "common/status.h"
+#include "io/cache/cached_remote_file_reader.h"
 #include "io/fs/file_reader.h"
 #include "io/io_common.h"
 #include "olap/bloom_filter_predicate.h"
@@ -67,6 +68,7 @@
 #include "olap/types.h"
 #include "olap/utils.h"
 #include "runtime/define_primitive_type.h"
+#include "runtime/exec_env.h"
 #include "runtime/query_context.h"
 #include "runtime/runtime_predicate.h"
 #include "runtime/runtime_state.h"
@@ -75,6 +77,7 @@
 #include "util/doris_metrics.h"
 #include "util/key_util.h"
 #include "util/simd/bits.h"
+#include "util/threadpool.h"
 #include "vec/columns/column.h"
 #include "vec/columns/column_const.h"
 #include "vec/columns/column_nothing.h"
@@ -508,6 +511,7 @@ Status SegmentIterator::_prepare_seek(const StorageReadOptions::KeyRange& key_ra
                                                           &_column_iterators[cid], &_opts));
             ColumnIteratorOptions iter_opts {
                     .use_page_cache = _opts.use_page_cache,
+                    .streaming_read = _opts.streaming_read,
                     .file_reader = _file_reader.get(),
                     .stats = _opts.stats,
                     .io_ctx = _opts.io_ctx,
@@ -835,10 +839,14 @@ bool SegmentIterator::_check_apply_by_inverted_index(ColumnPredicate* pred) {
         }
     }
 
-    // Function filter no apply inverted index
+    // Function filter no apply inverted index, except LIKE on an ngram index, which narrows
+    // the rows to candidates and keeps the predicate to recheck them
     if (dynamic_cast<LikeColumnPredicate<TYPE_CHAR>*>(pred) != nullptr ||
         dynamic_cast<LikeColumnPredicate<TYPE_STRING>*>(pred) != nullptr) {
-        return false;
+        if (pred->opposite() ||
+            !IndexReaderHelper::is_ngram_index(_index_iterators[pred_column_id]->get_reader())) {
+            return false;
+        }
     }
 
     bool handle_by_fulltext = _column_has_fulltext_index(pred_column_id);
@@ -1122,6 +1130,7 @@ Status SegmentIterator::_init_return_column_iterators() {
                                                           &_column_iterators[cid], &_opts));
             ColumnIteratorOptions iter_opts {
                     .use_page_cache = _opts.use_page_cache,
+                    .streaming_read = _opts.streaming_read,
                     // If the col is predicate column, then should read the last page to check
                     // if the column is full dict encoding
                     .is_predicate_column = tmp_is_pred_column[cid],
@@ -1188,11 +1197,10 @@ Status SegmentIterator::_init_index_iterators() {
             std::vector<const TabletIndex*> inverted_indexs;
             // If the column is an extracted column, we need to find the sub-column in the parent column reader.
             if (column.is_extracted_column()) {
-                if (_segment->_column_readers.find(column.parent_unique_id()) ==
-                    _segment->_column_readers.end()) {
+                auto* column_reader = _segment->_find_column_reader(column.parent_unique_id());
+                if (column_reader == nullptr) {
                     continue;
                 }
-                auto* column_reader = _segment->_column_readers.at(column.parent_unique_id()).get();
                 inverted_indexs = assert_cast<VariantColumnReader*>(column_reader)
                                           ->find_subcolumn_tablet_indexes(column.suffix_path());
             }
@@ -1491,6 +1499,7 @@ Status SegmentIterator::_vec_init_lazy_materialization() {
             }
         }
 
+        _fuse_range_predicates();
         _vec_pred_column_ids.assign(vec_pred_col_id_set.cbegin(), vec_pred_col_id_set.cend());
         _short_cir_pred_column_ids.assign(short_cir_pred_col_id_set.cbegin(),
                                           short_cir_pred_col_id_set.cend());
@@ -1654,6 +1663,28 @@ bool SegmentIterator::_can_evaluated_by_vectorized(ColumnPredicate* predicate) {
     }
 }
 
+void SegmentIterator::_fuse_range_predicates() {
+    std::vector<bool> fused(_pre_eval_block_predicate.size(), false);
+    for (size_t i = 0; config::enable_fused_range_predicate && i < fused.size(); ++i) {
+        for (size_t j = i + 1; !fused[i] && j < fused.size(); ++j) {
+            if (fused[j]) {
+                continue;
+            }
+            auto fused_predicate = FusedRangePredicate::create(_pre_eval_block_predicate[i],
+                                                               _pre_eval_block_predicate[j]);
+            if (fused_predicate != nullptr) {
+                _fused_range_predicates.push_back(std::move(fused_predicate));
+                fused[i] = fused[j] = true;
+            }
+        }
+    }
+    for (size_t i = 0; i < fused.size(); ++i) {
+        if (!fused[i]) {
+            _unfused_pre_eval_block_predicate.push_back(_pre_eval_block_predicate[i]);
+        }
+    }
+}
+
 bool SegmentIterator::_has_char_type(const Field& column_desc) {
     switch (column_desc.type()) {
     case FieldType::OLAP_FIELD_TYPE_CHAR:
@@ -1842,6 +1873,10 @@ Status SegmentIterator::_read_columns_by_index(uint32_t nrows_read_limit, uint32
     SCOPED_RAW_TIMER(&_opts.stats->predicate_column_read_ns);
 
     nrows_read = _range_iter->read_batch_rowids(_block_rowids.data(), nrows_read_limit);
+    if (nrows_read > 0 && config::segment_page_prefetch_rows > 0 &&
+        !_opts.read_orderby_key_reverse) {
+        _prefetch_pages(_block_rowids[nrows_read - 1] + 1);
+    }
     bool is_continuous = (nrows_read > 1) &&
                          (_block_rowids[nrows_read - 1] - _block_rowids[0] == nrows_read - 1);
     VLOG_DEBUG << fmt::format(
@@ -1985,7 +2020,16 @@ uint16_t SegmentIterator::_evaluate_vectorization_predicate(uint16_t* sel_rowid_
     _ret_flags.resize(original_size);
     DCHECK(!_pre_eval_block_predicate.empty());
     bool is_first = true;
-    for (auto& pred : _pre_eval_block_predicate) {
+    for (const auto& fused : _fused_range_predicates) {
+        auto& column = _current_return_columns[fused->column_id()];
+        if (is_first) {
+            fused->evaluate_vec(*column, original_size, (bool*)_ret_flags.data());
+            is_first = false;
+        } else {
+            fused->evaluate_and_vec(*column, original_size, (bool*)_ret_flags.data());
+        }
+    }
+    for (auto& pred : _unfused_pre_eval_block_predicate) {
         if (pred->always_true()) {
             continue;
         }
@@ -2068,6 +2112,23 @@ Status SegmentIterator::_read_columns_by_rowids(std::vector<ColumnId>& read_colu
         rowids[i] = rowid_vector[sel_rowid_idx[i]];
     }
 
+    // When most rows of the range survive, a sequential read followed by a filter is cheaper
+    // than reading the rows one by one.
+    size_t range_size = select_size == 0 ? 0 : rowids.back() - rowids.front() + 1;
+    bool read_by_range = select_size > 0 && static_cast<double>(select_size) >=
+                                                    static_cast<double>(range_size) *
+                                                            config::lazy_read_range_min_selectivity;
+    vectorized::IColumn::Filter range_filter;
+    if (read_by_range) {
+        _opts.stats->block_lazy_read_range_num++;
+        if (range_size != select_size) {
+            range_filter.resize_fill(range_size, 0);
+            for (auto rowid : rowids) {
+                range_filter[rowid - rowids.front()] = 1;
+            }
+        }
+    }
+
     for (auto cid : read_column_ids) {
         auto& colunm = (*mutable_columns)[cid];
         if (_no_need_read_key_data(cid, colunm, select_size)) {
@@ -2095,10 +2156,117 @@ Status SegmentIterator::_read_columns_by_rowids(std::vector<ColumnId>& read_colu
                     "SegmentIterator meet invalid column, return columns size {}, cid {}",
                     _current_return_columns.size(), cid);
         }
-        RETURN_IF_ERROR(_column_iterators[cid]->read_by_rowids(rowids.data(), select_size,
-                                                               _current_return_columns[cid]));
+        if (read_by_range) {
+            RETURN_IF_ERROR(_read_column_by_range(cid, rowids.front(), range_size, range_filter));
+        } else {
+            RETURN_IF_ERROR(_column_iterators[cid]->read_by_rowids(rowids.data(), select_size,
+                                                                   _current_return_columns[cid]));
+        }
+    }
+
+    return Status::OK();
+}
+
+// Fetch the data pages of the next rows into the file cache in background, so that reading
+// them later does not wait for a remote request per page.
+void SegmentIterator::_prefetch_pages(rowid_t next_rowid) {
+    const auto window = config::segment_page_prefetch_rows;
+    // keep at least half a window prefetched ahead of the reader
+    if (static_cast<int64_t>(_prefetched_rowid) > next_rowid + window / 2 ||
+        next_rowid >= _segment->num_rows()) {
+        return;
+    }
+    auto file_reader = _segment->file_reader();
+    if (dynamic_cast<io::CachedRemoteFileReader*>(file_reader.get()) == nullptr) {
+        return;
+    }
+    rowid_t from = std::max(next_rowid, _prefetched_rowid);
+    auto to = cast_set<rowid_t>(
+            std::min<int64_t>(next_rowid + window, static_cast<int64_t>(_segment->num_rows())));
+    _prefetched_rowid = to;
+
+    std::vector<PagePointer> pages;
+    for (auto cid : _schema->column_ids()) {
+        if (_column_iterators[cid] == nullptr) {
+            continue;
+        }
+        if (!_column_iterators[cid]->get_page_pointers(from, to, &pages).ok()) {
+            return;
+        }
     }
+    if (pages.empty()) {
+        return;
+    }
+    std::sort(pages.begin(), pages.end(),
+              [](const PagePointer& a, const PagePointer& b) { return a.offset < b.offset; });
+
+    io::IOContext io_ctx;
+    io_ctx.reader_type = _opts.io_ctx.reader_type;
+    io_ctx.is_disposable = _opts.io_ctx.is_disposable;
+    io_ctx.expiration_time = _opts.io_ctx.expiration_time;
+    io_ctx.is_dryrun = config::enable_reader_dryrun_when_download_file_cache;
+    auto submit = [&](uint64_t offset, uint64_t size) {
+        auto st = ExecEnv::GetInstance()->buffered_reader_prefetch_thread_pool()->submit_func(
+                [file_reader, offset, size, io_ctx]() {
+                    // a dry read only fills the file cache and never writes the result
+                    std::unique_ptr<char[]> buffer;
+                    if (!io_ctx.is_dryrun) {
+                        buffer.reset(new char[size]);
+                    }
+                    size_t bytes_read = 0;
+                    auto read_st = file_reader->read_at(offset, {buffer.get(), size}, &bytes_read,
+                                                        &io_ctx);
+                    if (!read_st.ok()) {
+                        VLOG_DEBUG << "failed to prefetch " << file_reader->path().native()
+                                   << ", offset=" << offset << ", st=" << read_st;
+                    }
+                });
+        if (!st.ok()) {
+            VLOG_DEBUG << "failed to submit segment page prefetch: " << st;
+        }
+    };
 
+    // Pages of adjacent columns are coalesced into one request when the gap between them is
+    // small, a request is capped so that one task does not buffer too much.
+    constexpr uint64_t MAX_GAP_BYTES = 64 * 1024;
+    constexpr uint64_t MAX_REQUEST_BYTES = 8 * 1024 * 1024;
+    uint64_t range_start = pages[0].offset;
+    uint64_t range_end = pages[0].offset + pages[0].size;
+    for (size_t i = 1; i < pages.size(); ++i) {
+        const auto& page = pages[i];
+        if (page.offset <= range_end + MAX_GAP_BYTES &&
+            page.offset + page.size - range_start <= MAX_REQUEST_BYTES) {
+            range_end = std::max(range_end, page.offset + page.size);
+            continue;
+        }
+        submit(range_start, range_end - range_start);
+        range_start = page.offset;
+        range_end = page.offset + page.size;
+    }
+    submit(range_start, range_end - range_start);
+}
+
+Status SegmentIterator::_read_column_by_range(ColumnId cid, rowid_t first_rowid,
+                                              size_t range_size,
+                                              const vectorized::IColumn::Filter& filter) {
+    auto& column = _current_return_columns[cid];
+    RETURN_IF_ERROR(_column_iterators[cid]->seek_to_ordinal(first_rowid));
+    vectorized::MutableColumnPtr range_column;
+    if (!filter.empty()) {
+        range_column = column->clone_empty();
+    }
+    auto& dst = filter.empty() ? column : range_column;
+    size_t rows_read = range_size;
+    bool has_null = false;
+    RETURN_IF_ERROR(_column_iterators[cid]->next_batch(&rows_read, dst, &has_null));
+    if (rows_read != range_size) [[unlikely]] {
+        return Status::InternalError("read {} rows of column {}, but {} expected", rows_read, cid,
+                                     range_size);
+    }
+    if (!filter.empty()) {
+        auto filtered = range_column->filter(filter, -1);
+        column->insert_range_from(*filtered, 0, filtered->size());
+    }
     return Status::OK();
 }
 
@@ -2686,6 +2854,12 @@ Status SegmentIterator::_construct_compound_expr_context() {
     auto inverted_index_context = std::make_shared<vectorized::InvertedIndexContext>(
             _schema->column_ids(), _index_iterators, _storage_name_and_type,
             _common_expr_inverted_index_status);
+    // scoring queries need every child to be evaluated, so their results are not cached
+    if (_opts.runtime_state != nullptr &&
+        _opts.runtime_state->query_options().enable_inverted_index_query_cache &&
+        _score_runtime == nullptr) {
+        inverted_index_context->set_segment_cache_key(_segment->file_reader()->path().native());
+    }
     for (const auto& expr_ctx : _opts.common_expr_ctxs_push_down) {
         vectorized::VExprContextSPtr context;
         RETURN_IF_ERROR(expr_ctx->clone(_opts.runtime_state, context));
@@ -36,6 +36,7 @@
 #include "olap/block_column_predicate.h"
 #include "olap/column_predicate.h"
 #include "olap/field.h"
+#include "olap/fused_range_predicate.h"
 #include "olap/iterators.h"
 #include "olap/olap_common.h"
 #include "olap/row_cursor.h"
@@ -227,6 +228,10 @@ private:
                                                  std::vector<rowid_t>& rowid_vector,
                                                  uint16_t* sel_rowid_idx, size_t select_size,
                                                  vectorized::MutableColumns* mutable_columns);
+    void _prefetch_pages(rowid_t next_rowid);
+    [[nodiscard]] Status _read_column_by_range(ColumnId cid, rowid_t first_rowid,
+                                               size_t range_size,
+                                               const vectorized::IColumn::Filter& filter);
 
     Status copy_column_data_by_selector(vectorized::IColumn* input_col_ptr,
                                         vectorized::MutableColumnPtr& output_col,
@@ -273,6 +278,8 @@ private:
     }
 
     bool _can_evaluated_by_vectorized(ColumnPredicate* predicate);
+    // Pair up range bounds of _pre_eval_block_predicate into _fused_range_predicates.
+    void _fuse_range_predicates();
 
     [[nodiscard]] Status _extract_common_expr_columns(const vectorized::VExprSPtr& expr);
     // same with _extract_common_expr_columns, but only extract columns that can be used for index
@@ -386,6 +393,8 @@ private:
     std::unique_ptr<BitmapRangeIterator> _range_iter;
     // the next rowid to read
     rowid_t _cur_rowid;
+    // rows before this rowid have been submitted for page prefetching
+    rowid_t _prefetched_rowid = 0;
     // members related to lazy materialization read
     // --------------------------------------------
     // whether lazy materialization read should be used.
@@ -410,6 +419,10 @@ private:
     std::vector<bool> _is_common_expr_column;
     vectorized::MutableColumns _current_return_columns;
     std::vector<ColumnPredicate*> _pre_eval_block_predicate;
+    // lower and upper bounds of _pre_eval_block_predicate evaluated in one pass
+    std::vector<std::unique_ptr<FusedRangePredicate>> _fused_range_predicates;
+    // _pre_eval_block_predicate not covered by _fused_range_predicates
+    std::vector<ColumnPredicate*> _unfused_pre_eval_block_predicate;
     std::vector<ColumnPredicate*> _short_cir_eval_predicate;
     std::vector<uint32_t> _delete_range_column_ids;
     std::vector<uint32_t> _delete_bloom_filter_column_ids;
@@ -46,6 +46,7 @@
 #include "olap/rowset/rowset_writer_context.h" // RowsetWriterContext
 #include "olap/rowset/segment_creator.h"
 #include "olap/rowset/segment_v2/column_writer.h" // ColumnWriter
+#include "olap/rowset/segment_v2/encoding_info.h"
 #include "olap/rowset/segment_v2/index_file_writer.h"
 #include "olap/rowset/segment_v2/inverted_index_writer.h"
 #include "olap/rowset/segment_v2/page_io.h"
@@ -187,6 +188,10 @@ Status SegmentWriter::_create_column_writer(uint32_t cid, const TabletColumn& co
     opts.meta = _footer.add_columns();
 
     init_column_meta(opts.meta, cid, column, schema);
+    if (cid == 0 && column.is_key() && schema->cluster_key_uids().empty()) {
+        // the leading sort key is ordered within a segment
+        opts.meta->set_encoding(EncodingInfo::get_sorted_column_encoding(column.type()));
+    }
 
     // now we create zone map for key columns in AGG_KEYS or all column in UNIQUE_KEYS or DUP_KEYS
     // except for columns whose type don't support zone map.
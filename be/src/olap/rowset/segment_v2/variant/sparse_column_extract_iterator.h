@@ -137,7 +137,16 @@ class SparseColumnExtractIterator : public BaseSparseColumnProcessor {
 public:
     SparseColumnExtractIterator(std::string_view path, std::unique_ptr<ColumnIterator> reader,
                                 StorageReadOptions* opts, const TabletColumn& col)
-            : BaseSparseColumnProcessor(std::move(reader), opts, col), _path(path) {}
+            : BaseSparseColumnProcessor(std::move(reader), opts, col), _path(path) {
+        // Compaction shares one decoded sparse column between all extracted paths, so only
+        // other readers may skip the pages without this path.
+        if (opts == nullptr || !ColumnReader::is_compaction_reader_type(opts->io_ctx.reader_type)) {
+            auto* map_iter = dynamic_cast<MapFileColumnIterator*>(_sparse_column_reader.get());
+            if (map_iter != nullptr) {
+                map_iter->set_key_filter(_path);
+            }
+        }
+    }
 
     // Batch processing using template method
     Status next_batch(size_t* n, vectorized::MutableColumnPtr& dst, bool* has_null) override {
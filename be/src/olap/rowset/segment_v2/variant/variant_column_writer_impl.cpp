@@ -396,8 +396,22 @@ Status VariantColumnWriterImpl::finalize() {
 
     RETURN_IF_ERROR(ptr->convert_typed_path_to_storage_type(_subcolumns_info));
 
+    auto& path_dictionary = _opts.rowset_ctx->variant_path_dictionary;
+    const bool share_paths =
+            config::enable_variant_shared_path_dictionary && path_dictionary != nullptr;
     RETURN_IF_ERROR(ptr->pick_subcolumns_to_sparse_column(
-            _subcolumns_info, _tablet_column->variant_enable_typed_paths_to_sparse()));
+            _subcolumns_info, _tablet_column->variant_enable_typed_paths_to_sparse(),
+            share_paths ? path_dictionary->materialized_paths(_tablet_column->unique_id())
+                        : std::unordered_set<std::string> {}));
+    if (share_paths) {
+        std::vector<std::string> materialized_paths;
+        for (const auto& entry : ptr->get_subcolumns()) {
+            if (!entry->data.is_root && !entry->path.has_nested_part()) {
+                materialized_paths.push_back(entry->path.get_path());
+            }
+        }
+        path_dictionary->add_materialized_paths(_tablet_column->unique_id(), materialized_paths);
+    }
 
 #ifndef NDEBUG
     ptr->check_consistency();
@@ -531,6 +545,9 @@ Status VariantColumnWriterImpl::write_bloom_filter_index() {
             RETURN_IF_ERROR(_subcolumn_writers[i]->write_bloom_filter_index());
         }
     }
+    if (_sparse_column_writer) {
+        RETURN_IF_ERROR(_sparse_column_writer->write_bloom_filter_index());
+    }
     return Status::OK();
 }
 
@@ -0,0 +1,58 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace doris {
+namespace segment_v2 {
+
+#include "common/compile_check_begin.h"
+
+// Paths every variant column materialized as subcolumns in the segments already written by a
+// rowset writer. Later segments prefer these paths when they have to push subcolumns to the
+// sparse column, so the segments of a rowset keep the same subcolumn layout and readers do not
+// need to merge differing subcolumn schemas.
+class VariantPathDictionary {
+public:
+    std::unordered_set<std::string> materialized_paths(int32_t column_uid) const {
+        std::lock_guard lock(_mutex);
+        auto it = _paths.find(column_uid);
+        return it == _paths.end() ? std::unordered_set<std::string> {} : it->second;
+    }
+
+    void add_materialized_paths(int32_t column_uid, const std::vector<std::string>& paths) {
+        std::lock_guard lock(_mutex);
+        auto& known = _paths[column_uid];
+        known.insert(paths.begin(), paths.end());
+    }
+
+private:
+    mutable std::mutex _mutex;
+    std::unordered_map<int32_t, std::unordered_set<std::string>> _paths;
+};
+
+#include "common/compile_check_end.h"
+
+} // namespace segment_v2
+} // namespace doris
@@ -49,6 +49,7 @@
 #include "olap/rowset/rowset_writer_context.h" // RowsetWriterContext
 #include "olap/rowset/segment_creator.h"
 #include "olap/rowset/segment_v2/column_writer.h" // ColumnWriter
+#include "olap/rowset/segment_v2/encoding_info.h"
 #include "olap/rowset/segment_v2/index_file_writer.h"
 #include "olap/rowset/segment_v2/inverted_index_desc.h"
 #include "olap/rowset/segment_v2/page_io.h"
@@ -59,12 +60,15 @@
 #include "olap/utils.h"
 #include "runtime/exec_env.h"
 #include "runtime/memory/mem_tracker.h"
+#include "runtime/thread_context.h"
 #include "service/point_query_executor.h"
 #include "util/coding.h"
+#include "util/countdown_latch.h"
 #include "util/crc32c.h"
 #include "util/debug_points.h"
 #include "util/faststring.h"
 #include "util/key_util.h"
+#include "util/threadpool.h"
 #include "vec/columns/column_nullable.h"
 #include "vec/columns/column_vector.h"
 #include "vec/common/assert_cast.h"
@@ -186,6 +190,10 @@ Status VerticalSegmentWriter::_create_column_writer(uint32_t cid, const TabletCo
     opts.meta = _footer.add_columns();
 
     _init_column_meta(opts.meta, cid, column);
+    if (cid == 0 && column.is_key() && tablet_schema->cluster_key_uids().empty()) {
+        // the leading sort key is ordered within a segment
+        opts.meta->set_encoding(EncodingInfo::get_sorted_column_encoding(column.type()));
+    }
 
     // now we create zone map for key columns in AGG_KEYS or all column in UNIQUE_KEYS or DUP_KEYS
     // except for columns whose type don't support zone map.
@@ -947,8 +955,19 @@ Status VerticalSegmentWriter::write_batch() {
     vectorized::IOlapColumnDataAccessor* seq_column = nullptr;
     // the key is cluster key column unique id
     std::map<uint32_t, vectorized::IOlapColumnDataAccessor*> cid_to_column;
+    const auto parallelism = _column_parallelism();
+    const bool encode_in_parallel = parallelism > 1;
+    std::vector<uint32_t> parallel_cids;
     for (uint32_t cid = 0; cid < _tablet_schema->num_columns(); ++cid) {
         RETURN_IF_ERROR(_create_column_writer(cid, _tablet_schema->column(cid), _tablet_schema));
+        if (encode_in_parallel && _can_encode_column_in_parallel(cid)) {
+            parallel_cids.push_back(cid);
+            if (parallel_cids.size() == parallelism) {
+                RETURN_IF_ERROR(_encode_columns_in_parallel(parallel_cids));
+                parallel_cids.clear();
+            }
+            continue;
+        }
         for (auto& data : _batched_blocks) {
             RETURN_IF_ERROR(_olap_data_convertor->set_source_content_with_specifid_columns(
                     data.block, data.row_pos, data.num_rows, std::vector<uint32_t> {cid}));
@@ -975,13 +994,11 @@ Status VerticalSegmentWriter::write_batch() {
                                                          data.num_rows));
             _olap_data_convertor->clear_source_content();
         }
-        if (_data_dir != nullptr &&
-            _data_dir->reach_capacity_limit(_column_writers[cid]->estimate_buffer_size())) {
-            return Status::Error<DISK_REACH_CAPACITY_LIMIT>("disk {} exceed capacity limit.",
-                                                            _data_dir->path_hash());
-        }
         RETURN_IF_ERROR(_column_writers[cid]->finish());
-        RETURN_IF_ERROR(_column_writers[cid]->write_data());
+        RETURN_IF_ERROR(_write_column_data(cid));
+    }
+    if (!parallel_cids.empty()) {
+        RETURN_IF_ERROR(_encode_columns_in_parallel(parallel_cids));
     }
 
     for (auto& data : _batched_blocks) {
@@ -995,6 +1012,93 @@ Status VerticalSegmentWriter::write_batch() {
     return Status::OK();
 }
 
+bool VerticalSegmentWriter::_can_encode_column_in_parallel(uint32_t cid) {
+    // Key and sequence columns feed the key indexes through the shared convertor, so they stay
+    // on the calling thread. Inverted index writers only touch their own index directory after
+    // init, so indexed columns build their indexes on the worker that encodes them.
+    const auto& column = _tablet_schema->column(cid);
+    if (cid < _tablet_schema->num_key_columns() ||
+        (_tablet_schema->has_sequence_col() && cid == _tablet_schema->sequence_col_idx())) {
+        return false;
+    }
+    if (_is_mow_with_cluster_key() &&
+        std::find(_tablet_schema->cluster_key_uids().begin(),
+                  _tablet_schema->cluster_key_uids().end(),
+                  column.unique_id()) != _tablet_schema->cluster_key_uids().end()) {
+        return false;
+    }
+    return true;
+}
+
+size_t VerticalSegmentWriter::_column_parallelism() const {
+    if (_tablet_schema->num_variant_columns() > 0 ||
+        ExecEnv::GetInstance()->segment_column_writer_thread_pool() == nullptr) {
+        return 1;
+    }
+    return static_cast<size_t>(std::max(config::vertical_segment_writer_column_parallelism, 1));
+}
+
+Status VerticalSegmentWriter::_encode_column(uint32_t cid) {
+    vectorized::OlapBlockDataConvertor convertor;
+    convertor.add_column_data_convertor(_tablet_schema->column(cid));
+    for (auto& data : _batched_blocks) {
+        RETURN_IF_ERROR(convertor.set_source_content_with_specifid_column(
+                data.block->get_by_position(cid), data.row_pos, data.num_rows, 0));
+        auto [status, column] = convertor.convert_column_data(0);
+        RETURN_IF_ERROR(status);
+        RETURN_IF_ERROR(_column_writers[cid]->append(column->get_nullmap(), column->get_data(),
+                                                     data.num_rows));
+        convertor.clear_source_content();
+    }
+    return _column_writers[cid]->finish();
+}
+
+Status VerticalSegmentWriter::_encode_columns_in_parallel(const std::vector<uint32_t>& cids) {
+    // Every task converts and encodes one column into the pages buffered by its own writer.
+    // Pages then go to the file in column order.
+    RETURN_IF_ERROR(
+            _run_columns_in_parallel(cids, [this](uint32_t cid) { return _encode_column(cid); }));
+    for (auto cid : cids) {
+        RETURN_IF_ERROR(_write_column_data(cid));
+    }
+    return Status::OK();
+}
+
+Status VerticalSegmentWriter::_run_columns_in_parallel(
+        const std::vector<uint32_t>& cids, const std::function<Status(uint32_t)>& func) {
+    // The first column runs on the calling thread, the others on the column writer pool.
+    auto* thread_pool = ExecEnv::GetInstance()->segment_column_writer_thread_pool();
+    auto mem_tracker = thread_context()->thread_mem_tracker_mgr->limiter_mem_tracker_sptr();
+    std::vector<Status> statuses(cids.size());
+    CountDownLatch latch(cast_set<int>(cids.size() - 1));
+    for (size_t i = 1; i < cids.size(); ++i) {
+        auto st = thread_pool->submit_func([&, i]() {
+            SCOPED_SWITCH_THREAD_MEM_TRACKER_LIMITER(mem_tracker);
+            statuses[i] = func(cids[i]);
+            latch.count_down();
+        });
+        if (!st.ok()) {
+            statuses[i] = func(cids[i]);
+            latch.count_down();
+        }
+    }
+    statuses[0] = func(cids[0]);
+    latch.wait();
+    for (const auto& st : statuses) {
+        RETURN_IF_ERROR(st);
+    }
+    return Status::OK();
+}
+
+Status VerticalSegmentWriter::_write_column_data(uint32_t cid) {
+    if (_data_dir != nullptr &&
+        _data_dir->reach_capacity_limit(_column_writers[cid]->estimate_buffer_size())) {
+        return Status::Error<DISK_REACH_CAPACITY_LIMIT>("disk {} exceed capacity limit.",
+                                                        _data_dir->path_hash());
+    }
+    return _column_writers[cid]->write_data();
+}
+
 Status VerticalSegmentWriter::_generate_key_index(
         RowsInBlock& data, std::vector<vectorized::IOlapColumnDataAccessor*>& key_columns,
         vectorized::IOlapColumnDataAccessor* seq_column,
@@ -1288,8 +1392,24 @@ Status VerticalSegmentWriter::_write_bitmap_index() {
 }
 
 Status VerticalSegmentWriter::_write_inverted_index() {
-    for (auto& column_writer : _column_writers) {
-        RETURN_IF_ERROR(column_writer->write_inverted_index());
+    // Flushing the buffered postings and merging the CLucene segments of every index is
+    // independent per column, so the indexed columns are finished side by side.
+    const auto parallelism = _column_parallelism();
+    std::vector<uint32_t> cids;
+    for (uint32_t cid = 0; cid < _column_writers.size(); ++cid) {
+        if (parallelism > 1 && cid < _tablet_schema->num_columns() &&
+            !_tablet_schema->inverted_indexs(_tablet_schema->column(cid)).empty()) {
+            cids.push_back(cid);
+            continue;
+        }
+        RETURN_IF_ERROR(_column_writers[cid]->write_inverted_index());
+    }
+    for (size_t start = 0; start < cids.size(); start += parallelism) {
+        std::vector<uint32_t> batch(
+                cids.begin() + start, cids.begin() + std::min(start + parallelism, cids.size()));
+        RETURN_IF_ERROR(_run_columns_in_parallel(batch, [this](uint32_t cid) {
+            return _column_writers[cid]->write_inverted_index();
+        }));
     }
     return Status::OK();
 }
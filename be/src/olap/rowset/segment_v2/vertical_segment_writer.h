@@ -136,6 +136,16 @@ private:
     void _init_column_meta(ColumnMetaPB* meta, uint32_t column_id, const TabletColumn& column);
     Status _create_column_writer(uint32_t cid, const TabletColumn& column,
                                  const TabletSchemaSPtr& schema);
+    // Value columns may be converted, encoded and indexed on worker threads.
+    bool _can_encode_column_in_parallel(uint32_t cid);
+    // Number of columns encoded or index-finished at once, 1 when it has to stay serial.
+    size_t _column_parallelism() const;
+    Status _encode_column(uint32_t cid);
+    Status _encode_columns_in_parallel(const std::vector<uint32_t>& cids);
+    Status _run_columns_in_parallel(const std::vector<uint32_t>& cids,
+                                    const std::function<Status(uint32_t)>& func);
+    // Checks the disk capacity and writes the finished pages of one column to the file.
+    Status _write_column_data(uint32_t cid);
     uint64_t _estimated_remaining_size();
     Status _write_ordinal_index();
     Status _write_zone_map();
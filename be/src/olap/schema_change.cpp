@@ -22,6 +22,7 @@
 #include <thrift/protocol/TDebugProtocol.h>
 
 #include <algorithm>
+#include <atomic>
 #include <exception>
 #include <map>
 #include <memory>
@@ -72,7 +73,9 @@
 #include "runtime/exec_env.h"
 #include "runtime/memory/mem_tracker.h"
 #include "runtime/runtime_state.h"
+#include "runtime/thread_context.h"
 #include "util/debug_points.h"
+#include "util/threadpool.h"
 #include "util/defer_op.h"
 #include "util/trace.h"
 #include "vec/aggregate_functions/aggregate_function.h"
@@ -1150,6 +1153,35 @@ Status SchemaChangeJob::_get_versions_to_be_changed(std::vector<Version>* versio
     return Status::OK();
 }
 
+// The rowsets before a failed one are still added to the new tablet, same as the sequential
+// conversion.
+void SchemaChangeJob::_convert_rowsets_concurrently(ThreadPool* pool, int max_concurrency,
+                                                    size_t num_rowsets,
+                                                    const std::function<Status(size_t)>& convert,
+                                                    std::vector<Status>* convert_status) {
+    auto token = pool->new_token(ThreadPool::ExecutionMode::CONCURRENT, max_concurrency);
+    std::atomic<bool> convert_failed = false;
+    for (size_t idx = 0; idx < num_rowsets; ++idx) {
+        auto st = token->submit_func([&, idx]() {
+            if (convert_failed) {
+                (*convert_status)[idx] =
+                        Status::Cancelled("schema change cancelled by a failed rowset");
+                return;
+            }
+            (*convert_status)[idx] = convert(idx);
+            if (!(*convert_status)[idx]) {
+                convert_failed = true;
+            }
+        });
+        if (!st) {
+            (*convert_status)[idx] = st;
+            convert_failed = true;
+            break;
+        }
+    }
+    token->wait();
+}
+
 // The `real_alter_version` parameter indicates that the version of [0-real_alter_version] is
 // converted from a base tablet, only used for the mow table now.
 Status SchemaChangeJob::_convert_historical_rowsets(const SchemaChangeParams& sc_params,
@@ -1217,8 +1249,15 @@ Status SchemaChangeJob::_convert_historical_rowsets(const SchemaChangeParams& sc
     DBUG_EXECUTE_IF("SchemaChangeJob::_convert_historical_rowsets.block", DBUG_BLOCK);
 
     // c.Convert historical data
-    bool have_failure_rowset = false;
-    for (const auto& rs_reader : sc_params.ref_rowset_readers) {
+    // Rowsets converted directly do not depend on each other, so they can be rewritten
+    // concurrently with a procedure per rowset, while the new rowsets are still built and added
+    // to the new tablet one by one in version order below.
+    const auto& rs_readers = sc_params.ref_rowset_readers;
+    std::vector<std::unique_ptr<RowsetWriter>> rowset_writers(rs_readers.size());
+    std::vector<PendingRowsetGuard> pending_rs_guards(rs_readers.size());
+    std::vector<Status> convert_status(rs_readers.size());
+    auto convert_rowset = [&](size_t idx, SchemaChange* procedure) -> Status {
+        const auto& rs_reader = rs_readers[idx];
         // set status for monitor
         // As long as there is a new_table as running, ref table is set as running
         // NOTE If the first sub_table fails first, it will continue to go as normal here
@@ -1248,21 +1287,56 @@ Status SchemaChangeJob::_convert_historical_rowsets(const SchemaChangeParams& sc
         }
         auto result = _new_tablet->create_rowset_writer(context, vertical);
         if (!result.has_value()) {
-            res = Status::Error<ROWSET_BUILDER_INIT>("create_rowset_writer failed, reason={}",
-                                                     result.error().to_string());
-            return process_alter_exit();
+            return Status::Error<ROWSET_BUILDER_INIT>("create_rowset_writer failed, reason={}",
+                                                      result.error().to_string());
         }
-        auto rowset_writer = std::move(result).value();
-        auto pending_rs_guard = _local_storage_engine.add_pending_rowset(context);
+        rowset_writers[idx] = std::move(result).value();
+        pending_rs_guards[idx] = _local_storage_engine.add_pending_rowset(context);
 
-        if (res = sc_procedure->process(rs_reader, rowset_writer.get(), _new_tablet, _base_tablet,
-                                        _base_tablet_schema, _new_tablet_schema);
-            !res) {
+        auto st = procedure->process(rs_reader, rowset_writers[idx].get(), _new_tablet,
+                                     _base_tablet, _base_tablet_schema, _new_tablet_schema);
+        if (!st) {
             LOG(WARNING) << "failed to process the version."
                          << " version=" << rs_reader->version().first << "-"
-                         << rs_reader->version().second << ", " << res.to_string();
+                         << rs_reader->version().second << ", " << st.to_string();
+        }
+        return st;
+    };
+
+    int convert_threads = 1;
+    auto* convert_pool = _local_storage_engine.schema_change_convert_thread_pool();
+    if (sc_directly && !sc_sorting && convert_pool != nullptr) {
+        convert_threads =
+                std::min(convert_pool->max_threads(), cast_set<int>(rs_readers.size()));
+    }
+    if (convert_threads > 1) {
+        auto resource_ctx = thread_context()->resource_ctx();
+        _convert_rowsets_concurrently(
+                convert_pool, convert_threads, rs_readers.size(),
+                [&, resource_ctx](size_t idx) {
+                    SCOPED_ATTACH_TASK(resource_ctx);
+                    auto procedure = _get_sc_procedure(
+                            changer, sc_sorting, sc_directly,
+                            _local_storage_engine
+                                    .memory_limitation_bytes_per_thread_for_schema_change());
+                    return convert_rowset(idx, procedure.get());
+                },
+                &convert_status);
+        LOG(INFO) << "converted " << rs_readers.size() << " rowsets with " << convert_threads
+                  << " threads, new_tablet=" << _new_tablet->tablet_id();
+    }
+
+    bool have_failure_rowset = false;
+    for (size_t idx = 0; idx < rs_readers.size(); ++idx) {
+        const auto& rs_reader = rs_readers[idx];
+        if (convert_threads <= 1) {
+            convert_status[idx] = convert_rowset(idx, sc_procedure.get());
+        }
+        if (res = convert_status[idx]; !res) {
             return process_alter_exit();
         }
+        auto rowset_writer = std::move(rowset_writers[idx]);
+        auto pending_rs_guard = std::move(pending_rs_guards[idx]);
         // Add the new version of the data to the header
         // In order to prevent the occurrence of deadlock, we must first lock the old table, and then lock the new table
         std::lock_guard lock(_new_tablet->get_push_lock());
@@ -24,6 +24,7 @@
 #include <stddef.h>
 #include <stdint.h>
 
+#include <functional>
 #include <memory>
 #include <ostream>
 #include <set>
@@ -316,6 +317,13 @@ private:
     Status _convert_historical_rowsets(const SchemaChangeParams& sc_params,
                                        int64_t* real_alter_version);
 
+    // Runs convert(idx) for every rowset on a token of the pool shared by all schema changes, at
+    // most max_concurrency of them at a time. Once one fails the ones not started are cancelled.
+    static void _convert_rowsets_concurrently(ThreadPool* pool, int max_concurrency,
+                                              size_t num_rowsets,
+                                              const std::function<Status(size_t)>& convert,
+                                              std::vector<Status>* convert_status);
+
     // Initialization Settings for creating a default value
     static Status _init_column_mapping(ColumnMapping* column_mapping,
                                        const TabletColumn& column_schema, const std::string& value);
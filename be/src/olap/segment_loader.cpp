@@ -98,6 +98,14 @@ Status SegmentLoader::load_segments(const BetaRowsetSharedPtr& rowset,
     return Status::OK();
 }
 
+bool SegmentLoader::lookup_segment(const SegmentCache::CacheKey& key,
+                                   SegmentCacheHandle* cache_handle) {
+    if (!_segment_cache->lookup(key, cache_handle)) {
+        return false;
+    }
+    return cache_handle->pop_unhealthy_segment() == nullptr;
+}
+
 void SegmentLoader::erase_segment(const SegmentCache::CacheKey& key) {
     _segment_cache->erase(key);
 }
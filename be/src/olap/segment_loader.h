@@ -130,6 +130,9 @@ public:
                         bool need_load_pk_index_and_bf = false,
                         OlapReaderStatistics* index_load_stats = nullptr);
 
+    // Find a healthy segment in the cache without loading it, return false if it is not cached.
+    bool lookup_segment(const SegmentCache::CacheKey& key, SegmentCacheHandle* cache_handle);
+
     void erase_segment(const SegmentCache::CacheKey& key);
 
     void erase_segments(const RowsetId& rowset_id, int64_t num_segments);
@@ -20,10 +20,15 @@
 #include <absl/strings/str_split.h>
 #include <curl/curl.h>
 
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+
 #include "common/logging.h"
 #include "gen_cpp/Types_constants.h"
 #include "gen_cpp/internal_service.pb.h"
 #include "http/http_client.h"
+#include "http/utils.h"
 #include "io/fs/file_system.h"
 #include "io/fs/local_file_system.h"
 #include "io/fs/path.h"
@@ -35,11 +40,14 @@
 #include "runtime/client_cache.h"
 #include "runtime/exec_env.h"
 #include "runtime/memory/mem_tracker_limiter.h"
+#include "runtime/thread_context.h"
 #include "service/brpc.h"
 #include "task/engine_clone_task.h"
 #include "util/brpc_client_cache.h"
 #include "util/doris_metrics.h"
+#include "util/network_util.h"
 #include "util/security.h"
+#include "util/threadpool.h"
 #include "util/thrift_rpc_helper.h"
 #include "util/trace.h"
 
@@ -310,15 +318,23 @@ Status SingleReplicaCompaction::_fetch_rowset(const TReplicaInfo& addr, const st
         }
     }};
     // 2: download snapshot
-    std::string remote_url_prefix;
-    {
-        std::stringstream ss;
-        ss << "http://" << addr.host << ":" << addr.http_port << HTTP_REQUEST_PREFIX
-           << HTTP_REQUEST_TOKEN_PARAM << token << HTTP_REQUEST_FILE_PARAM << snapshot_path << "/"
-           << _tablet->tablet_id() << "/" << _tablet->schema_hash() << "/";
-        remote_url_prefix = ss.str();
+    std::string address = get_host_port(addr.host, addr.http_port);
+    if (config::enable_batch_download && is_support_batch_download(address).ok()) {
+        std::string remote_dir = fmt::format("{}/{}/{}/", snapshot_path, _tablet->tablet_id(),
+                                             _tablet->schema_hash());
+        RETURN_IF_ERROR(_batch_download_files(tablet()->data_dir(), address, token, remote_dir,
+                                              local_path));
+    } else {
+        std::string remote_url_prefix;
+        {
+            std::stringstream ss;
+            ss << "http://" << addr.host << ":" << addr.http_port << HTTP_REQUEST_PREFIX
+               << HTTP_REQUEST_TOKEN_PARAM << token << HTTP_REQUEST_FILE_PARAM << snapshot_path
+               << "/" << _tablet->tablet_id() << "/" << _tablet->schema_hash() << "/";
+            remote_url_prefix = ss.str();
+        }
+        RETURN_IF_ERROR(_download_files(tablet()->data_dir(), remote_url_prefix, local_path));
     }
-    RETURN_IF_ERROR(_download_files(tablet()->data_dir(), remote_url_prefix, local_path));
     _pending_rs_guards = DORIS_TRY(_engine.snapshot_mgr()->convert_rowset_ids(
             local_path, _tablet->tablet_id(), tablet()->replica_id(), _tablet->table_id(),
             _tablet->partition_id(), _tablet->schema_hash()));
@@ -478,6 +494,138 @@ Status SingleReplicaCompaction::_download_files(DataDir* data_dir,
     return Status::OK();
 }
 
+// Same batching as clone, but the data batches are fetched by several threads at once so a
+// follower catching up on many compactions is not bound by one round trip per batch. The
+// batch holding the .hdr file is still downloaded alone after all data files are complete.
+Status SingleReplicaCompaction::_batch_download_files(DataDir* data_dir,
+                                                      const std::string& address,
+                                                      const std::string& token,
+                                                      const std::string& remote_dir,
+                                                      const std::string& local_path) {
+    constexpr size_t BATCH_FILE_SIZE = 64 << 20; // 64MB
+    constexpr size_t BATCH_FILE_NUM = 64;
+
+    RETURN_IF_ERROR(io::global_local_filesystem()->delete_directory(local_path));
+    RETURN_IF_ERROR(io::global_local_filesystem()->create_directory(local_path));
+
+    std::vector<std::pair<std::string, size_t>> file_info_list;
+    RETURN_IF_ERROR(list_remote_files_v2(address, token, remote_dir, &file_info_list));
+    if (file_info_list.empty()) {
+        return Status::InternalError("single replica compaction: no file in remote dir {}",
+                                     remote_dir);
+    }
+    for (size_t i = 0; i + 1 < file_info_list.size(); ++i) {
+        if (file_info_list[i].first.ends_with(".hdr")) {
+            std::swap(file_info_list[i], file_info_list.back());
+            break;
+        }
+    }
+
+    uint64_t total_file_size = 0;
+    for (const auto& file_info : file_info_list) {
+        total_file_size += file_info.second;
+    }
+    if (data_dir->reach_capacity_limit(total_file_size)) {
+        return Status::Error<EXCEEDED_LIMIT>("reach the capacity limit of path {}, file_size={}",
+                                             data_dir->path(), total_file_size);
+    }
+
+    // The last file (normally the .hdr) always forms its own batch.
+    std::vector<std::vector<std::pair<std::string, size_t>>> batches;
+    size_t batch_file_size = 0;
+    for (size_t i = 0; i + 1 < file_info_list.size(); ++i) {
+        if (batches.empty() || batches.back().size() >= BATCH_FILE_NUM ||
+            batch_file_size >= BATCH_FILE_SIZE) {
+            batches.emplace_back();
+            batch_file_size = 0;
+        }
+        batches.back().push_back(file_info_list[i]);
+        batch_file_size += file_info_list[i].second;
+    }
+
+    MonotonicStopWatch watch;
+    watch.start();
+
+    // The helpers run on the single replica compaction thread pool, which also runs this
+    // compaction. A helper that starts after the batches are taken returns at once, so this
+    // thread only waits for the helpers that are downloading and never for a free pool thread.
+    struct DownloadState {
+        std::vector<std::vector<std::pair<std::string, size_t>>> batches;
+        std::atomic<size_t> next_batch = 0;
+        std::mutex lock;
+        std::condition_variable cv;
+        Status status;
+        bool closed = false;
+        int running = 0;
+    };
+    auto state = std::make_shared<DownloadState>();
+    state->batches = std::move(batches);
+    auto download_batches = [address, token, remote_dir, local_path](DownloadState& state) {
+        for (size_t i = state.next_batch++; i < state.batches.size(); i = state.next_batch++) {
+            {
+                std::lock_guard<std::mutex> l(state.lock);
+                if (!state.status.ok()) {
+                    return;
+                }
+            }
+            auto st = download_files_v2(address, token, remote_dir, local_path, state.batches[i]);
+            if (!st.ok()) {
+                std::lock_guard<std::mutex> l(state.lock);
+                if (state.status.ok()) {
+                    state.status = std::move(st);
+                }
+                return;
+            }
+        }
+    };
+    int max_parallelism = std::max(1, config::single_replica_compaction_download_parallelism);
+    size_t parallelism = std::min(state->batches.size(), static_cast<size_t>(max_parallelism));
+    auto* pool = _engine.single_replica_compaction_thread_pool();
+    for (size_t i = 1; i < parallelism && pool != nullptr; ++i) {
+        auto st = pool->submit_func([state, download_batches, mem_tracker = _mem_tracker]() {
+            SCOPED_ATTACH_TASK(mem_tracker);
+            {
+                std::lock_guard<std::mutex> l(state->lock);
+                if (state->closed) {
+                    return;
+                }
+                state->running++;
+            }
+            download_batches(*state);
+            std::lock_guard<std::mutex> l(state->lock);
+            state->running--;
+            state->cv.notify_all();
+        });
+        if (!st.ok()) {
+            // this thread downloads the batches left
+            break;
+        }
+    }
+    download_batches(*state);
+    Status status;
+    {
+        std::unique_lock<std::mutex> l(state->lock);
+        state->closed = true;
+        state->cv.wait(l, [&state]() { return state->running == 0; });
+        status = state->status;
+    }
+    RETURN_IF_ERROR(status);
+    RETURN_IF_ERROR(download_files_v2(address, token, remote_dir, local_path,
+                                      {file_info_list.back()}));
+
+    uint64_t total_time_ms = watch.elapsed_time() / 1000 / 1000;
+    double copy_rate = 0.0;
+    if (total_time_ms > 0) {
+        copy_rate = static_cast<double>(total_file_size) / static_cast<double>(total_time_ms) /
+                    1000;
+    }
+    LOG(INFO) << "succeed to single replica compaction batch copy tablet " << _tablet->tablet_id()
+              << ", total files: " << file_info_list.size()
+              << ", batches: " << state->batches.size() << ", parallelism: " << parallelism << ", total file size: " << total_file_size
+              << " B, cost: " << total_time_ms << " ms, rate: " << copy_rate << " MB/s";
+    return Status::OK();
+}
+
 Status SingleReplicaCompaction::_release_snapshot(const std::string& ip, int port,
                                                   const std::string& snapshot_path) {
     TAgentResult result;
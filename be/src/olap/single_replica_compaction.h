@@ -60,6 +60,9 @@ private:
                           std::string* snapshot_path);
     Status _download_files(DataDir* data_dir, const std::string& remote_url_prefix,
                            const std::string& local_path);
+    Status _batch_download_files(DataDir* data_dir, const std::string& address,
+                                 const std::string& token, const std::string& remote_dir,
+                                 const std::string& local_path);
     Status _release_snapshot(const std::string& ip, int port, const std::string& snapshot_path);
     Status _finish_clone(const std::string& clone_dir, const Version& version);
     CompactionType _compaction_type;
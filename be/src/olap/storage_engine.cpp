@@ -80,6 +80,7 @@
 #include "util/thread.h"
 #include "util/threadpool.h"
 #include "util/thrift_rpc_helper.h"
+#include "util/time.h"
 #include "util/uid_util.h"
 #include "util/work_thread_pool.hpp"
 #include "vec/common/assert_cast.h"
@@ -102,6 +103,7 @@ bvar::Status<int64_t> g_max_rowsets_with_useless_delete_bitmap(
         "max_rowsets_with_useless_delete_bitmap", 0);
 bvar::Status<int64_t> g_max_rowsets_with_useless_delete_bitmap_version(
         "max_rowsets_with_useless_delete_bitmap_version", 0);
+bvar::Status<int64_t> g_load_data_dirs_ms("storage_engine", "load_data_dirs_ms", 0);
 
 namespace {
 bvar::Adder<uint64_t> unused_rowsets_counter("ununsed_rowsets_counter");
@@ -296,7 +298,9 @@ Status StorageEngine::_open() {
     RETURN_NOT_OK_STATUS_WITH_WARN(_check_file_descriptor_number(), "check fd number failed");
 
     auto dirs = get_stores();
+    int64_t load_data_dirs_start_ms = MonotonicMillis();
     RETURN_IF_ERROR(load_data_dirs(dirs));
+    g_load_data_dirs_ms.set_value(MonotonicMillis() - load_data_dirs_start_ms);
 
     _disk_num = cast_set<int>(dirs.size());
     _memtable_flush_executor = std::make_unique<MemTableFlushExecutor>();
@@ -756,6 +760,12 @@ void StorageEngine::stop() {
     if (_cold_data_compaction_thread_pool) {
         _cold_data_compaction_thread_pool->shutdown();
     }
+    if (_schema_change_convert_thread_pool) {
+        _schema_change_convert_thread_pool->shutdown();
+    }
+    if (_clone_download_thread_pool) {
+        _clone_download_thread_pool->shutdown();
+    }
 
     if (_cooldown_thread_pool) {
         _cooldown_thread_pool->shutdown();
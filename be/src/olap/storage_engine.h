@@ -329,6 +329,13 @@ public:
                                       SegCompactionCandidatesSharedPtr segments);
 
     ThreadPool* tablet_publish_txn_thread_pool() { return _tablet_publish_txn_thread_pool.get(); }
+    ThreadPool* schema_change_convert_thread_pool() {
+        return _schema_change_convert_thread_pool.get();
+    }
+    ThreadPool* clone_download_thread_pool() { return _clone_download_thread_pool.get(); }
+    ThreadPool* single_replica_compaction_thread_pool() {
+        return _single_replica_compaction_thread_pool.get();
+    }
     bool stopped() override { return _stopped; }
 
     Status process_index_change_task(const TAlterInvertedIndexReq& reqest);
@@ -515,6 +522,12 @@ private:
 
     std::unique_ptr<ThreadPool> _tablet_publish_txn_thread_pool;
 
+    // shared by the direct schema changes to convert historical rowsets concurrently
+    std::unique_ptr<ThreadPool> _schema_change_convert_thread_pool;
+
+    // shared by the clone tasks to download snapshot files concurrently
+    std::unique_ptr<ThreadPool> _clone_download_thread_pool;
+
     std::unique_ptr<ThreadPool> _tablet_meta_checkpoint_thread_pool;
 
     CompactionPermitLimiter _permit_limiter;
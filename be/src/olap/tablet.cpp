@@ -1139,10 +1139,13 @@ uint32_t Tablet::_calc_base_compaction_score() const {
     const int64_t point = cumulative_layer_point();
     bool base_rowset_exist = false;
     bool has_delete = false;
+    int64_t newest_creation_time = 0;
+    int64_t num_data_rowsets = 0;
     for (auto& rs_meta : _tablet_meta->all_rs_metas()) {
         if (rs_meta->start_version() == 0) {
             base_rowset_exist = true;
         }
+        newest_creation_time = std::max(newest_creation_time, rs_meta->creation_time());
         if (rs_meta->start_version() >= point || !rs_meta->is_local()) {
             // all_rs_metas() is not sorted, so we use _continue_ other than _break_ here.
             continue;
@@ -1150,13 +1153,20 @@ uint32_t Tablet::_calc_base_compaction_score() const {
         if (rs_meta->has_delete_predicate()) {
             has_delete = true;
         }
+        if (rs_meta->num_rows() > 0) {
+            ++num_data_rowsets;
+        }
         score += rs_meta->get_compaction_score();
     }
 
     // In the time series compaction policy, we want the base compaction to be triggered
-    // when there are delete versions present.
+    // when there are delete versions present, or once the tablet is sealed (e.g. a past
+    // daily partition) so it ends up with a single large rowset.
     if (_tablet_meta->compaction_policy() == CUMULATIVE_TIME_SERIES_POLICY) {
-        return (base_rowset_exist && has_delete) ? score : 0;
+        int64_t sealed_seconds = config::time_series_compaction_sealed_tablet_seconds;
+        bool is_sealed = sealed_seconds > 0 && num_data_rowsets >= 2 &&
+                         UnixSeconds() - newest_creation_time > sealed_seconds;
+        return (base_rowset_exist && (has_delete || is_sealed)) ? score : 0;
     }
 
     // base不存在可能是tablet正在做alter table，先不选它，设score=0
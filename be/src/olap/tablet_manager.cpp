@@ -28,6 +28,7 @@
 #include <unistd.h>
 
 #include <algorithm>
+#include <cmath>
 #include <list>
 #include <mutex>
 #include <ostream>
@@ -725,9 +726,22 @@ void TabletManager::get_tablet_stat(TTabletStatResult* result) {
 
 struct TabletScore {
     TabletSharedPtr tablet_ptr;
-    int score;
+    uint32_t score;
 };
 
+// Rank compaction candidates by compaction score boosted by recent reads, so the merge work
+// goes to tablets where it lowers query latency. Write rate already raises the score through
+// the version count.
+static uint32_t compaction_rank_score(const TabletSharedPtr& tablet, uint32_t score,
+                                      int64_t now_ms) {
+    double weight = config::compaction_read_heat_weight;
+    if (weight <= 0) {
+        return score;
+    }
+    double boost = 1 + weight * std::log2(1 + tablet->query_heat(now_ms));
+    return static_cast<uint32_t>(std::min<double>(score * boost, UINT32_MAX));
+}
+
 std::vector<TabletSharedPtr> TabletManager::find_best_tablets_to_compaction(
         CompactionType compaction_type, DataDir* data_dir,
         const std::unordered_set<TabletSharedPtr>& tablet_submitted_compaction, uint32_t* score,
@@ -737,8 +751,11 @@ std::vector<TabletSharedPtr> TabletManager::find_best_tablets_to_compaction(
     const string& compaction_type_str =
             compaction_type == CompactionType::BASE_COMPACTION ? "base" : "cumulative";
     uint32_t highest_score = 0;
+    // the raw compaction score of the picked tablets, reported through `score`
+    uint32_t highest_raw_score = 0;
     // find the single compaction tablet
     uint32_t single_compact_highest_score = 0;
+    uint32_t single_compact_raw_score = 0;
     TabletSharedPtr best_tablet;
     TabletSharedPtr best_single_compact_tablet;
     int64_t compaction_num_per_round =
@@ -796,10 +813,12 @@ std::vector<TabletSharedPtr> TabletManager::find_best_tablets_to_compaction(
         }
         auto cumulative_compaction_policy = all_cumulative_compaction_policies.at(
                 tablet_ptr->tablet_meta()->compaction_policy());
-        uint32_t current_compaction_score = tablet_ptr->calc_compaction_score();
-        if (current_compaction_score < 5) {
+        uint32_t raw_compaction_score = tablet_ptr->calc_compaction_score();
+        if (raw_compaction_score < 5) {
             tablet_ptr->set_skip_compaction(true, compaction_type, UnixSeconds());
         }
+        uint32_t current_compaction_score =
+                compaction_rank_score(tablet_ptr, raw_compaction_score, now_ms);
 
         // tablet should do single compaction
         if (current_compaction_score > single_compact_highest_score &&
@@ -808,6 +827,7 @@ std::vector<TabletSharedPtr> TabletManager::find_best_tablets_to_compaction(
                                                            cumulative_compaction_policy);
             if (ret) {
                 single_compact_highest_score = current_compaction_score;
+                single_compact_raw_score = raw_compaction_score;
                 best_single_compact_tablet = tablet_ptr;
             }
         }
@@ -827,6 +847,7 @@ std::vector<TabletSharedPtr> TabletManager::find_best_tablets_to_compaction(
                         top_tablets.pop();
                     }
                     highest_score = std::max(current_compaction_score, highest_score);
+                    highest_raw_score = std::max(raw_compaction_score, highest_raw_score);
                 }
             }
         } else {
@@ -835,6 +856,7 @@ std::vector<TabletSharedPtr> TabletManager::find_best_tablets_to_compaction(
                                                                cumulative_compaction_policy);
                 if (ret) {
                     highest_score = current_compaction_score;
+                    highest_raw_score = raw_compaction_score;
                     best_tablet = tablet_ptr;
                 }
             }
@@ -872,8 +894,7 @@ std::vector<TabletSharedPtr> TabletManager::find_best_tablets_to_compaction(
                       << best_single_compact_tablet->should_fetch_from_peer();
         picked_tablet.emplace_back(std::move(best_single_compact_tablet));
     }
-    *score = highest_score > single_compact_highest_score ? highest_score
-                                                          : single_compact_highest_score;
+    *score = std::max(highest_raw_score, single_compact_raw_score);
     return picked_tablet;
 }
 
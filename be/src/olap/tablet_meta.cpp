@@ -1361,10 +1361,13 @@ void DeleteBitmap::merge(const BitmapKey& bmk, const roaring::Roaring& segment_d
 }
 
 void DeleteBitmap::merge(const DeleteBitmap& other) {
+    // Copy the incoming bitmaps before taking the write lock, new keys are then spliced in as map
+    // nodes and only bitmaps of existing keys are unioned while readers wait.
+    auto incoming = other.delete_bitmap;
     std::lock_guard l(lock);
-    for (auto& i : other.delete_bitmap) {
-        auto [j, succ] = this->delete_bitmap.insert(i);
-        if (!succ) j->second |= i.second;
+    delete_bitmap.merge(incoming);
+    for (auto& [bmk, bitmap] : incoming) {
+        delete_bitmap[bmk] |= bitmap;
     }
 }
 
@@ -130,6 +130,9 @@ public:
         // for compaction, schema_change, check_sum: we don't use page cache
         // for query and config::disable_storage_page_cache is false, we use page cache
         bool use_page_cache = false;
+        // for large scans whose pages are probably read only once, these pages are only
+        // probationally admitted into page cache or bypass it
+        bool streaming_read = false;
         Version version = Version(-1, 0);
 
         std::vector<OlapTuple> start_key;
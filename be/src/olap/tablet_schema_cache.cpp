@@ -28,6 +28,10 @@
 bvar::Adder<int64_t> g_tablet_schema_cache_count("tablet_schema_cache_count");
 bvar::Adder<int64_t> g_tablet_schema_cache_columns_count("tablet_schema_cache_columns_count");
 bvar::Adder<int64_t> g_tablet_schema_cache_hit_count("tablet_schema_cache_hit_count");
+// Memory of the schemas that would have been built again without the cache
+bvar::Adder<int64_t> g_tablet_schema_cache_hit_bytes("tablet_schema_cache_hit_bytes");
+bvar::Adder<int64_t> g_tablet_schema_cache_hit_columns_count(
+        "tablet_schema_cache_hit_columns_count");
 
 namespace doris {
 
@@ -47,6 +51,8 @@ std::pair<Cache::Handle*, TabletSchemaSPtr> TabletSchemaCache::insert(const std:
         auto* value = (CacheValue*)LRUCachePolicy::value(lru_handle);
         tablet_schema_ptr = value->tablet_schema;
         g_tablet_schema_cache_hit_count << 1;
+        g_tablet_schema_cache_hit_bytes << tablet_schema_ptr->mem_size();
+        g_tablet_schema_cache_hit_columns_count << tablet_schema_ptr->num_columns();
     } else {
         auto* value = new CacheValue;
         tablet_schema_ptr = std::make_shared<TabletSchema>();
@@ -29,7 +29,11 @@
 #include <gen_cpp/Types_constants.h>
 #include <sys/stat.h>
 
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <filesystem>
+#include <functional>
 #include <memory>
 #include <mutex>
 #include <ostream>
@@ -66,6 +70,7 @@
 #include "util/network_util.h"
 #include "util/security.h"
 #include "util/stopwatch.hpp"
+#include "util/threadpool.h"
 #include "util/thrift_rpc_helper.h"
 #include "util/trace.h"
 
@@ -133,6 +138,9 @@ Result<std::string> check_dest_binlog_valid(const std::string& tablet_dir,
         return ResultError(Status::InternalError(std::move(err_msg)));
     }
 }
+
+CloneDownloadLimiter g_clone_disk_limiter;
+CloneDownloadLimiter g_clone_host_limiter;
 } // namespace
 
 #define RETURN_IF_ERROR_(status, stmt) \
@@ -455,7 +463,7 @@ Status EngineCloneTask::_make_and_download_snapshots(DataDir& data_dir,
                 remote_url_prefix = ss.str();
             }
 
-            status = _download_files(&data_dir, remote_url_prefix, local_data_path);
+            status = _download_files(&data_dir, address, remote_url_prefix, local_data_path);
             if (!status.ok()) [[unlikely]] {
                 LOG_WARNING("failed to download snapshot from remote BE")
                         .tag("url", mask_token(remote_url_prefix))
@@ -532,7 +540,121 @@ Status EngineCloneTask::_release_snapshot(const std::string& ip, int port,
     return Status::create(result.status);
 }
 
-Status EngineCloneTask::_download_files(DataDir* data_dir, const std::string& remote_url_prefix,
+Status CloneDownloadLimiter::acquire(const std::string& key, int limit, int64_t timeout_ms,
+                                     const std::atomic<bool>& cancelled) {
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout_ms);
+    std::unique_lock l(_lock);
+    // `cancelled` is set without notifying `_cv`, so wake up periodically to check it.
+    while (_running[key] >= std::max(1, limit)) {
+        if (cancelled) {
+            return Status::Cancelled("clone download cancelled while waiting for a slot of {}",
+                                     key);
+        }
+        auto now = std::chrono::steady_clock::now();
+        if (now >= deadline) {
+            return Status::TimedOut("waited {} ms for a clone download slot of {}", timeout_ms,
+                                    key);
+        }
+        std::chrono::steady_clock::duration wait = std::chrono::milliseconds(100);
+        _cv.wait_for(l, std::min(wait, deadline - now));
+    }
+    ++_running[key];
+    return Status::OK();
+}
+
+void CloneDownloadLimiter::release(const std::string& key) {
+    std::lock_guard l(_lock);
+    if (--_running[key] <= 0) {
+        _running.erase(key);
+    }
+    _cv.notify_all();
+}
+
+Status EngineCloneTask::_parallel_download(ThreadPool* pool,
+                                           const std::shared_ptr<MemTrackerLimiter>& mem_tracker,
+                                           size_t num, const std::string& data_dir,
+                                           const std::string& host,
+                                           const std::function<Status(size_t)>& download) {
+    std::mutex status_lock;
+    Status status;
+    std::atomic<bool> failed = false;
+    auto set_status = [&](Status st) {
+        if (st.ok()) {
+            return;
+        }
+        std::lock_guard l(status_lock);
+        if (status.ok()) {
+            status = std::move(st);
+        }
+        failed = true;
+    };
+    auto download_one = [&](size_t i) -> Status {
+        if (failed) {
+            return Status::OK();
+        }
+        int64_t timeout_ms = config::clone_download_slot_wait_timeout_s * 1000L;
+        RETURN_IF_ERROR(g_clone_disk_limiter.acquire(
+                data_dir, config::clone_download_parallelism_per_disk, timeout_ms, failed));
+        Defer release_disk {[&]() { g_clone_disk_limiter.release(data_dir); }};
+        RETURN_IF_ERROR(g_clone_host_limiter.acquire(
+                host, config::clone_download_parallelism_per_host, timeout_ms, failed));
+        Defer release_host {[&]() { g_clone_host_limiter.release(host); }};
+        return download(i);
+    };
+
+    if (pool == nullptr) {
+        for (size_t i = 0; i < num && !failed; ++i) {
+            set_status(download_one(i));
+        }
+        return status;
+    }
+    auto token = pool->new_token(ThreadPool::ExecutionMode::CONCURRENT,
+                                 std::max(1, config::clone_download_parallelism_per_task));
+    for (size_t i = 0; i < num; ++i) {
+        auto st = token->submit_func([&, i]() {
+            SCOPED_ATTACH_TASK(mem_tracker);
+            set_status(download_one(i));
+        });
+        if (!st.ok()) {
+            set_status(std::move(st));
+            break;
+        }
+    }
+    token->wait();
+    return status;
+}
+
+Status EngineCloneTask::_check_downloaded_file(const std::string& local_file_path,
+                                               uint64_t file_size, const std::string& file_md5) {
+    std::error_code ec;
+    // Check file length
+    uint64_t local_file_size = std::filesystem::file_size(local_file_path, ec);
+    if (ec) {
+        LOG(WARNING) << "download file error" << ec.message();
+        return Status::IOError("can't retrive file_size of {}, due to {}", local_file_path,
+                               ec.message());
+    }
+    if (local_file_size != file_size) {
+        LOG(WARNING) << "download file length error"
+                     << ", local_path=" << local_file_path << ", file_size=" << file_size
+                     << ", local_file_size=" << local_file_size;
+        return Status::InternalError("downloaded file size is not equal");
+    }
+    if (!file_md5.empty()) {
+        std::string local_file_md5;
+        RETURN_IF_ERROR(io::global_local_filesystem()->md5sum(local_file_path, &local_file_md5));
+        if (local_file_md5 != file_md5) {
+            LOG(WARNING) << "download file md5 error"
+                         << ", local_path=" << local_file_path << ", file_md5=" << file_md5
+                         << ", local_file_md5=" << local_file_md5;
+            return Status::InternalError("downloaded file md5 is not equal");
+        }
+    }
+    return Status::OK();
+}
+
+Status EngineCloneTask::_download_files(DataDir* data_dir, const std::string& address,
+                                        const std::string& remote_url_prefix,
                                         const std::string& local_path) {
     // Check local path exist, if exist, remove it, then create the dir
     // local_file_full_path = tabletid/clone， for a specific tablet, there should be only one folder
@@ -557,7 +679,7 @@ Status EngineCloneTask::_download_files(DataDir* data_dir, const std::string& re
     // If the header file is not exist, the table couldn't loaded by olap engine.
     // Avoid of data is not complete, we copy the header file at last.
     // The header file's name is end of .hdr.
-    for (int i = 0; i + 1 < file_name_list.size(); ++i) {
+    for (size_t i = 0; i + 1 < file_name_list.size(); ++i) {
         if (file_name_list[i].ends_with(".hdr")) {
             std::swap(file_name_list[i], file_name_list[file_name_list.size() - 1]);
             break;
@@ -565,19 +687,30 @@ Status EngineCloneTask::_download_files(DataDir* data_dir, const std::string& re
     }
 
     // Get copy from remote
-    uint64_t total_file_size = 0;
-    MonotonicStopWatch watch;
-    watch.start();
-    for (auto& file_name : file_name_list) {
+    std::atomic<uint64_t> downloaded_file_size = 0;
+    auto download_file = [&](const std::string& file_name) -> Status {
         auto remote_file_url = remote_url_prefix + file_name;
 
-        // get file length
+        // get file length, and the md5sum computed by the source when checking is enabled
+        bool check_md5sum = config::enable_download_md5sum_check;
         uint64_t file_size = 0;
-        auto get_file_size_cb = [&remote_file_url, &file_size](HttpClient* client) {
-            RETURN_IF_ERROR(client->init(remote_file_url));
-            client->set_timeout_ms(GET_LENGTH_TIMEOUT * 1000);
+        std::string remote_file_md5;
+        auto get_file_size_cb = [&remote_file_url, &file_size, &remote_file_md5,
+                                 check_md5sum](HttpClient* client) {
+            int64_t timeout_ms = GET_LENGTH_TIMEOUT * 1000;
+            std::string url = remote_file_url;
+            if (check_md5sum) {
+                // compute md5sum is time-consuming, so we set a longer timeout
+                timeout_ms = config::download_binlog_meta_timeout_ms * 3;
+                url = fmt::format("{}&acquire_md5=true", remote_file_url);
+            }
+            RETURN_IF_ERROR(client->init(url));
+            client->set_timeout_ms(timeout_ms);
             RETURN_IF_ERROR(client->head());
             RETURN_IF_ERROR(client->get_content_length(&file_size));
+            if (check_md5sum) {
+                RETURN_IF_ERROR(client->get_content_md5(&remote_file_md5));
+            }
             return Status::OK();
         };
         RETURN_IF_ERROR(
@@ -589,7 +722,7 @@ Status EngineCloneTask::_download_files(DataDir* data_dir, const std::string& re
                     file_size);
         }
 
-        total_file_size += file_size;
+        downloaded_file_size += file_size;
         uint64_t estimate_timeout = file_size / config::download_low_speed_limit_kbps / 1024;
         if (estimate_timeout < config::download_low_speed_time) {
             estimate_timeout = config::download_low_speed_time;
@@ -601,32 +734,29 @@ Status EngineCloneTask::_download_files(DataDir* data_dir, const std::string& re
                   << " to: " << local_file_path << ". size(B): " << file_size
                   << ", timeout(s): " << estimate_timeout;
 
-        auto download_cb = [&remote_file_url, estimate_timeout, &local_file_path,
-                            file_size](HttpClient* client) {
+        auto download_cb = [&remote_file_url, &remote_file_md5, estimate_timeout,
+                            &local_file_path, file_size](HttpClient* client) {
             RETURN_IF_ERROR(client->init(remote_file_url));
             client->set_timeout_ms(estimate_timeout * 1000);
             RETURN_IF_ERROR(client->download(local_file_path));
-
-            std::error_code ec;
-            // Check file length
-            uint64_t local_file_size = std::filesystem::file_size(local_file_path, ec);
-            if (ec) {
-                LOG(WARNING) << "download file error" << ec.message();
-                return Status::IOError("can't retrive file_size of {}, due to {}", local_file_path,
-                                       ec.message());
-            }
-            if (local_file_size != file_size) {
-                LOG(WARNING) << "download file length error"
-                             << ", remote_path=" << mask_token(remote_file_url)
-                             << ", file_size=" << file_size
-                             << ", local_file_size=" << local_file_size;
-                return Status::InternalError("downloaded file size is not equal");
-            }
+            RETURN_IF_ERROR(_check_downloaded_file(local_file_path, file_size, remote_file_md5));
             return io::global_local_filesystem()->permission(local_file_path,
                                                              io::LocalFileSystem::PERMS_OWNER_RW);
         };
-        RETURN_IF_ERROR(HttpClient::execute_with_retry(DOWNLOAD_FILE_MAX_RETRY, 1, download_cb));
+        return HttpClient::execute_with_retry(DOWNLOAD_FILE_MAX_RETRY, 1, download_cb);
+    };
+
+    MonotonicStopWatch watch;
+    watch.start();
+    if (!file_name_list.empty()) {
+        // Data files are downloaded concurrently, the header file goes alone after them.
+        RETURN_IF_ERROR(_parallel_download(
+                _engine.clone_download_thread_pool(), _mem_tracker, file_name_list.size() - 1,
+                data_dir->path(), address,
+                [&](size_t i) { return download_file(file_name_list[i]); }));
+        RETURN_IF_ERROR(download_file(file_name_list.back()));
     } // Clone files from remote backend
+    uint64_t total_file_size = downloaded_file_size;
 
     uint64_t total_time_ms = watch.elapsed_time() / 1000 / 1000;
     total_time_ms = total_time_ms > 0 ? total_time_ms : 0;
@@ -665,44 +795,48 @@ Status EngineCloneTask::_batch_download_files(DataDir* data_dir, const std::stri
     // If the header file is not exist, the table couldn't loaded by olap engine.
     // Avoid of data is not complete, we copy the header file at last.
     // The header file's name is end of .hdr.
-    for (int i = 0; i + 1 < file_info_list.size(); ++i) {
+    for (size_t i = 0; i + 1 < file_info_list.size(); ++i) {
         if (file_info_list[i].first.ends_with(".hdr")) {
             std::swap(file_info_list[i], file_info_list[file_info_list.size() - 1]);
             break;
         }
     }
 
-    MonotonicStopWatch watch;
-    watch.start();
-
     size_t total_file_size = 0;
-    size_t total_files = file_info_list.size();
-    std::vector<std::pair<std::string, size_t>> batch_files;
-    for (size_t i = 0; i < total_files;) {
-        size_t batch_file_size = 0;
-        for (size_t j = i; j < total_files; j++) {
-            // Split batchs by file number and file size,
-            if (BATCH_FILE_NUM <= batch_files.size() || BATCH_FILE_SIZE <= batch_file_size ||
-                // ... or separate the last .hdr file into a single batch.
-                (j + 1 == total_files && !batch_files.empty())) {
-                break;
-            }
-            batch_files.push_back(file_info_list[j]);
-            batch_file_size += file_info_list[j].second;
-        }
+    for (const auto& file_info : file_info_list) {
+        total_file_size += file_info.second;
+    }
+    // check disk capacity
+    if (data_dir->reach_capacity_limit(total_file_size)) {
+        return Status::Error<EXCEEDED_LIMIT>("reach the capacity limit of path {}, file_size={}",
+                                             data_dir->path(), total_file_size);
+    }
 
-        // check disk capacity
-        if (data_dir->reach_capacity_limit(batch_file_size)) {
-            return Status::Error<EXCEEDED_LIMIT>(
-                    "reach the capacity limit of path {}, file_size={}", data_dir->path(),
-                    batch_file_size);
+    // Split batchs by file number and file size, the last file (normally the .hdr) always forms
+    // its own batch.
+    std::vector<std::vector<std::pair<std::string, size_t>>> batches;
+    size_t batch_file_size = 0;
+    for (size_t i = 0; i + 1 < file_info_list.size(); ++i) {
+        if (batches.empty() || batches.back().size() >= BATCH_FILE_NUM ||
+            batch_file_size >= BATCH_FILE_SIZE) {
+            batches.emplace_back();
+            batch_file_size = 0;
         }
+        batches.back().push_back(file_info_list[i]);
+        batch_file_size += file_info_list[i].second;
+    }
 
-        RETURN_IF_ERROR(download_files_v2(address, token, remote_dir, local_dir, batch_files));
+    MonotonicStopWatch watch;
+    watch.start();
 
-        total_file_size += batch_file_size;
-        i += batch_files.size();
-        batch_files.clear();
+    if (!file_info_list.empty()) {
+        RETURN_IF_ERROR(_parallel_download(
+                _engine.clone_download_thread_pool(), _mem_tracker, batches.size(),
+                data_dir->path(), address, [&](size_t i) {
+                    return download_files_v2(address, token, remote_dir, local_dir, batches[i]);
+                }));
+        RETURN_IF_ERROR(download_files_v2(address, token, remote_dir, local_dir,
+                                          {file_info_list.back()}));
     }
 
     uint64_t total_time_ms = watch.elapsed_time() / 1000 / 1000;
@@ -714,7 +848,7 @@ Status EngineCloneTask::_batch_download_files(DataDir* data_dir, const std::stri
     _copy_size = (int64_t)total_file_size;
     _copy_time_ms = (int64_t)total_time_ms;
     LOG(INFO) << "succeed to copy tablet " << _signature
-              << ", total files: " << file_info_list.size()
+              << ", total files: " << file_info_list.size() << ", batches: " << batches.size()
               << ", total file size: " << total_file_size << " B, cost: " << total_time_ms << " ms"
               << ", rate: " << copy_rate << " MB/s";
 
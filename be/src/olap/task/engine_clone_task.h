@@ -19,8 +19,13 @@
 
 #include <gen_cpp/Types_types.h>
 
+#include <atomic>
+#include <condition_variable>
+#include <functional>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "common/status.h"
@@ -36,6 +41,8 @@ class Tablet;
 struct Version;
 class StorageEngine;
 class ClusterInfo;
+class MemTrackerLimiter;
+class ThreadPool;
 
 const std::string HTTP_REQUEST_PREFIX = "/api/_tablet/_download?";
 const std::string HTTP_REQUEST_TOKEN_PARAM = "token=";
@@ -44,6 +51,23 @@ const uint32_t DOWNLOAD_FILE_MAX_RETRY = 3;
 const uint32_t LIST_REMOTE_FILE_TIMEOUT = 15;
 const uint32_t GET_LENGTH_TIMEOUT = 10;
 
+// Bounds the number of concurrent clone downloads per key, which is a local data dir or a
+// source host, across all running clone tasks.
+class CloneDownloadLimiter {
+public:
+    // Takes a slot of `key`, waiting at most `timeout_ms` for one to be released. Gives up
+    // early once `cancelled` is set.
+    Status acquire(const std::string& key, int limit, int64_t timeout_ms,
+                   const std::atomic<bool>& cancelled);
+
+    void release(const std::string& key);
+
+private:
+    std::mutex _lock;
+    std::condition_variable _cv;
+    std::unordered_map<std::string, int> _running;
+};
+
 // base class for storage engine
 // add "Engine" as task prefix to prevent duplicate name with agent task
 class EngineCloneTask final : public EngineTask {
@@ -79,12 +103,26 @@ private:
     Status _set_tablet_info();
 
     // Download tablet files from
-    Status _download_files(DataDir* data_dir, const std::string& remote_url_prefix,
-                           const std::string& local_path);
+    Status _download_files(DataDir* data_dir, const std::string& address,
+                           const std::string& remote_url_prefix, const std::string& local_path);
 
     Status _batch_download_files(DataDir* data_dir, const std::string& endpoint,
                                  const std::string& remote_dir, const std::string& local_dir);
 
+    // Runs `download(i)` for every i in [0, num) on `pool`, with up to
+    // clone_download_parallelism_per_task of them at a time, or one after another if `pool` is
+    // null. Each download holds a slot of the local data dir and of the source host while running.
+    // The first failure stops the downloads not started yet and is returned.
+    static Status _parallel_download(ThreadPool* pool,
+                                     const std::shared_ptr<MemTrackerLimiter>& mem_tracker,
+                                     size_t num, const std::string& data_dir,
+                                     const std::string& host,
+                                     const std::function<Status(size_t)>& download);
+
+    // Checks the size and, if `file_md5` is not empty, the md5sum of a downloaded file.
+    static Status _check_downloaded_file(const std::string& local_file_path, uint64_t file_size,
+                                         const std::string& file_md5);
+
     Status _make_snapshot(const std::string& ip, int port, TTableId tablet_id,
                           TSchemaHash schema_hash, int timeout_s,
                           const std::vector<Version>& missing_versions, std::string* snapshot_path,
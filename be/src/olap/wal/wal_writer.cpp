@@ -17,6 +17,8 @@
 
 #include "olap/wal/wal_writer.h"
 
+#include <bvar/latency_recorder.h>
+
 #include "common/config.h"
 #include "io/fs/file_writer.h"
 #include "io/fs/local_file_system.h"
@@ -24,12 +26,15 @@
 #include "olap/storage_engine.h"
 #include "olap/wal/wal_manager.h"
 #include "util/crc32c.h"
+#include "util/time.h"
 
 namespace doris {
 
 const char* k_wal_magic = "WAL1";
 const uint32_t k_wal_magic_length = 4;
 
+bvar::LatencyRecorder g_wal_append_blocks_latency("wal_append_blocks");
+
 WalWriter::WalWriter(const std::string& file_name) : _file_name(file_name) {}
 
 WalWriter::~WalWriter() {}
@@ -62,24 +67,30 @@ Status WalWriter::append_blocks(const PBlockArray& blocks) {
     if (!_file_writer) {
         return Status::InternalError("wal writer is null,fail to write file={}", _file_name);
     }
+    int64_t start_us = MonotonicMicros();
+    // All blocks are written by one appendv, so a batch costs a single write call.
+    std::vector<std::string> contents(blocks.size());
+    std::vector<uint8_t> len_bufs(blocks.size() * sizeof(uint64_t));
+    std::vector<uint8_t> checksum_bufs(blocks.size() * sizeof(uint32_t));
+    std::vector<Slice> slices;
+    slices.reserve(blocks.size() * 3);
     size_t total_size = 0;
     size_t offset = 0;
-    for (const auto& block : blocks) {
-        uint8_t len_buf[sizeof(uint64_t)];
-        uint64_t block_length = block->ByteSizeLong();
+    for (size_t i = 0; i < blocks.size(); ++i) {
+        uint64_t block_length = blocks[i]->ByteSizeLong();
         total_size += LENGTH_SIZE + block_length + CHECKSUM_SIZE;
+        uint8_t* len_buf = len_bufs.data() + i * sizeof(uint64_t);
         encode_fixed64_le(len_buf, block_length);
-        RETURN_IF_ERROR(_file_writer->append({len_buf, sizeof(uint64_t)}));
+        slices.emplace_back(len_buf, sizeof(uint64_t));
         offset += LENGTH_SIZE;
 
-        std::string content = block->SerializeAsString();
-        RETURN_IF_ERROR(_file_writer->append(content));
-        offset += block_length;
+        contents[i] = blocks[i]->SerializeAsString();
+        slices.emplace_back(contents[i]);
+        offset += contents[i].size();
 
-        uint8_t checksum_buf[sizeof(uint32_t)];
-        uint32_t checksum = crc32c::Value(content.data(), block_length);
-        encode_fixed32_le(checksum_buf, checksum);
-        RETURN_IF_ERROR(_file_writer->append({checksum_buf, sizeof(uint32_t)}));
+        uint8_t* checksum_buf = checksum_bufs.data() + i * sizeof(uint32_t);
+        encode_fixed32_le(checksum_buf, crc32c::Value(contents[i].data(), contents[i].size()));
+        slices.emplace_back(checksum_buf, sizeof(uint32_t));
         offset += CHECKSUM_SIZE;
     }
     if (offset != total_size) {
@@ -87,6 +98,8 @@ Status WalWriter::append_blocks(const PBlockArray& blocks) {
                 "failed to write block to wal expected= " + std::to_string(total_size) +
                 ",actually=" + std::to_string(offset));
     }
+    RETURN_IF_ERROR(_file_writer->appendv(slices.data(), slices.size()));
+    g_wal_append_blocks_latency << (MonotonicMicros() - start_us);
     return Status::OK();
 }
 
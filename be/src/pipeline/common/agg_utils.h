@@ -21,6 +21,7 @@
 #include <vector>
 
 #include "vec/common/arena.h"
+#include "vec/common/hash_table/direct_mapped_hash_map.h"
 #include "vec/common/hash_table/hash_map_context.h"
 #include "vec/common/hash_table/hash_map_util.h"
 #include "vec/common/hash_table/ph_hash_map.h"
@@ -34,6 +35,14 @@ template <typename T>
 using AggDataNullable = vectorized::DataWithNullKey<AggData<T>>;
 
 using AggregatedDataWithoutKey = vectorized::AggregateDataPtr;
+// Keys of at most 16 bits index their slot directly instead of being hashed.
+using AggregatedDataWithUInt8Key =
+        DirectMappedHashMap<vectorized::UInt8, vectorized::AggregateDataPtr>;
+using AggregatedDataWithUInt16Key =
+        DirectMappedHashMap<vectorized::UInt16, vectorized::AggregateDataPtr>;
+using AggregatedDataWithNullableUInt8Key = vectorized::DataWithNullKey<AggregatedDataWithUInt8Key>;
+using AggregatedDataWithNullableUInt16Key =
+        vectorized::DataWithNullKey<AggregatedDataWithUInt16Key>;
 using AggregatedDataWithStringKey = PHHashMap<StringRef, vectorized::AggregateDataPtr>;
 using AggregatedDataWithShortStringKey = StringHashMap<vectorized::AggregateDataPtr>;
 
@@ -53,8 +62,8 @@ using AggregatedDataWithNullableShortStringKey =
 
 using AggregatedMethodVariants = std::variant<
         std::monostate, vectorized::MethodSerialized<AggregatedDataWithStringKey>,
-        vectorized::MethodOneNumber<vectorized::UInt8, AggData<vectorized::UInt8>>,
-        vectorized::MethodOneNumber<vectorized::UInt16, AggData<vectorized::UInt16>>,
+        vectorized::MethodOneNumber<vectorized::UInt8, AggregatedDataWithUInt8Key>,
+        vectorized::MethodOneNumber<vectorized::UInt16, AggregatedDataWithUInt16Key>,
         vectorized::MethodOneNumber<vectorized::UInt32, AggData<vectorized::UInt32>>,
         vectorized::MethodOneNumber<vectorized::UInt64, AggData<vectorized::UInt64>>,
         vectorized::MethodStringNoCache<AggregatedDataWithShortStringKey>,
@@ -62,10 +71,10 @@ using AggregatedMethodVariants = std::variant<
         vectorized::MethodOneNumber<vectorized::UInt256, AggData<vectorized::UInt256>>,
         vectorized::MethodOneNumber<vectorized::UInt32, AggregatedDataWithUInt32KeyPhase2>,
         vectorized::MethodOneNumber<vectorized::UInt64, AggregatedDataWithUInt64KeyPhase2>,
-        vectorized::MethodSingleNullableColumn<
-                vectorized::MethodOneNumber<vectorized::UInt8, AggDataNullable<vectorized::UInt8>>>,
         vectorized::MethodSingleNullableColumn<vectorized::MethodOneNumber<
-                vectorized::UInt16, AggDataNullable<vectorized::UInt16>>>,
+                vectorized::UInt8, AggregatedDataWithNullableUInt8Key>>,
+        vectorized::MethodSingleNullableColumn<vectorized::MethodOneNumber<
+                vectorized::UInt16, AggregatedDataWithNullableUInt16Key>>,
         vectorized::MethodSingleNullableColumn<vectorized::MethodOneNumber<
                 vectorized::UInt32, AggDataNullable<vectorized::UInt32>>>,
         vectorized::MethodSingleNullableColumn<vectorized::MethodOneNumber<
@@ -80,6 +89,7 @@ using AggregatedMethodVariants = std::variant<
                 vectorized::UInt256, AggDataNullable<vectorized::UInt256>>>,
         vectorized::MethodSingleNullableColumn<
                 vectorized::MethodStringNoCache<AggregatedDataWithNullableShortStringKey>>,
+        vectorized::MethodKeysFixed<AggregatedDataWithUInt16Key>,
         vectorized::MethodKeysFixed<AggData<vectorized::UInt64>>,
         vectorized::MethodKeysFixed<AggData<vectorized::UInt128>>,
         vectorized::MethodKeysFixed<AggData<vectorized::UInt256>>,
@@ -100,10 +110,10 @@ struct AggregatedDataVariants
             method_variant.emplace<vectorized::MethodSerialized<AggregatedDataWithStringKey>>();
             break;
         case HashKeyType::int8_key:
-            emplace_single<vectorized::UInt8, AggData<vectorized::UInt8>>(nullable);
+            emplace_single<vectorized::UInt8, AggregatedDataWithUInt8Key>(nullable);
             break;
         case HashKeyType::int16_key:
-            emplace_single<vectorized::UInt16, AggData<vectorized::UInt16>>(nullable);
+            emplace_single<vectorized::UInt16, AggregatedDataWithUInt16Key>(nullable);
             break;
         case HashKeyType::int32_key:
             emplace_single<vectorized::UInt32, AggData<vectorized::UInt32>>(nullable);
@@ -134,6 +144,12 @@ struct AggregatedDataVariants
             }
             break;
         case HashKeyType::fixed64:
+            if (get_fixed_key_packed_size(data_types) <= sizeof(vectorized::UInt16)) {
+                // e.g. group by two tinyint columns, the packed key is a 16 bit slot index
+                method_variant.emplace<vectorized::MethodKeysFixed<AggregatedDataWithUInt16Key>>(
+                        get_key_sizes(data_types));
+                break;
+            }
             method_variant.emplace<vectorized::MethodKeysFixed<AggData<vectorized::UInt64>>>(
                     get_key_sizes(data_types));
             break;
@@ -279,6 +295,20 @@ public:
         _inited = true;
         iterator = begin();
     }
+
+    // Drops all the keys and states, which must have been destroyed already. The last chunk of
+    // the arena is kept, so the next round of aggregation reuses it instead of growing again.
+    void clear() {
+        _arena_pool.clear();
+        _key_containers.clear();
+        _value_containers.clear();
+        _current_agg_data = nullptr;
+        _current_keys = nullptr;
+        _index_in_sub_container = 0;
+        _total_count = 0;
+        _inited = false;
+    }
+
     Iterator iterator;
 
 private:
@@ -27,6 +27,7 @@
 #include "vec/common/hash_table/string_hash_map.h"
 #include "vec/common/sort/partition_sorter.h"
 #include "vec/common/sort/vsort_exec_exprs.h"
+#include "vec/spill/spill_stream.h"
 
 namespace doris {
 
@@ -103,6 +104,14 @@ public:
         return _init_rows <= 0 || _blocks.back()->bytes() > INITIAL_BUFFERED_BLOCK_BYTES;
     }
 
+    size_t buffered_bytes() const {
+        size_t bytes = 0;
+        for (const auto& block : _blocks) {
+            bytes += block->allocated_bytes();
+        }
+        return bytes;
+    }
+
     vectorized::IColumn::Selector _selector;
     std::vector<std::unique_ptr<vectorized::Block>> _blocks;
     size_t _current_input_rows = 0;
@@ -112,6 +121,9 @@ public:
     std::unique_ptr<vectorized::SortCursorCmp> _previous_row;
     std::unique_ptr<vectorized::PartitionSorter> _partition_topn_sorter = nullptr;
     std::shared_ptr<PartitionSortInfo> _partition_sort_info = nullptr;
+    // the rows of this partition revoked to disk, nullptr if all of them are in memory, moved to
+    // the shared state at eos
+    vectorized::SpillStreamSPtr _spill_stream;
 };
 
 using PartitionDataPtr = PartitionBlocks*;
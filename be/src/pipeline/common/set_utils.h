@@ -17,9 +17,11 @@
 
 #pragma once
 
+#include <type_traits>
 #include <variant>
 #include <vector>
 
+#include "vec/common/hash_table/direct_mapped_hash_map.h"
 #include "vec/common/hash_table/hash_map_util.h"
 
 namespace doris {
@@ -35,8 +37,13 @@ struct RowRefWithFlag {
 #include "common/compile_check_avoid_end.h"
 };
 
+// Keys of at most 16 bits index their slot directly instead of being hashed, so building and
+// probing a tinyint or smallint set needs neither hashing nor probing for collisions.
 template <typename T>
-using SetData = PHHashMap<T, RowRefWithFlag, HashCRC32<T>>;
+using SetData = std::conditional_t<std::is_same_v<T, vectorized::UInt8> ||
+                                           std::is_same_v<T, vectorized::UInt16>,
+                                   DirectMappedHashMap<T, RowRefWithFlag>,
+                                   PHHashMap<T, RowRefWithFlag, HashCRC32<T>>>;
 
 template <typename T>
 using SetFixedKeyHashTableContext = vectorized::MethodKeysFixed<SetData<T>>;
@@ -308,11 +308,15 @@ Status AggSharedState::reset_hash_table() {
                             RETURN_IF_ERROR(st);
                         }
 
-                        aggregate_data_container.reset(new AggregateDataContainer(
-                                sizeof(typename HashTableType::key_type),
-                                ((total_size_of_aggregate_states + align_aggregate_states - 1) /
-                                 align_aggregate_states) *
-                                        align_aggregate_states));
+                        if (aggregate_data_container) {
+                            aggregate_data_container->clear();
+                        } else {
+                            aggregate_data_container.reset(new AggregateDataContainer(
+                                    sizeof(typename HashTableType::key_type),
+                                    ((total_size_of_aggregate_states + align_aggregate_states - 1) /
+                                     align_aggregate_states) *
+                                            align_aggregate_states));
+                        }
                         agg_method.hash_table.reset(new HashTableType());
                         return Status::OK();
                     }},
@@ -407,6 +411,29 @@ MultiCastSharedState::MultiCastSharedState(ObjectPool* pool, int cast_sender_cou
 
 void MultiCastSharedState::update_spill_stream_profiles(RuntimeProfile* source_profile) {}
 
+void PartitionSortNodeSharedState::update_spill_stream_profiles(RuntimeProfile* source_profile) {
+    for (auto& stream : spill_streams) {
+        if (stream) {
+            stream->update_shared_profiles(source_profile);
+        }
+    }
+}
+
+void PartitionSortNodeSharedState::close() {
+    bool false_close = false;
+    if (!is_closed.compare_exchange_strong(false_close, true)) {
+        return;
+    }
+    // the running spill or recover task stops at its next block once is_closed is set
+    std::unique_lock<std::mutex> lc(spill_lock);
+    for (auto& stream : spill_streams) {
+        if (stream) {
+            ExecEnv::GetInstance()->spill_stream_mgr()->delete_spill_stream(stream);
+            stream.reset();
+        }
+    }
+}
+
 int AggSharedState::get_slot_column_id(const vectorized::AggFnEvaluator* evaluator) {
     auto ctxs = evaluator->input_exprs_ctxs();
     CHECK(ctxs.size() == 1 && ctxs[0]->root()->is_slot_ref())
@@ -103,6 +103,7 @@ public:
     virtual ~Dependency() = default;
 
     [[nodiscard]] int id() const { return _id; }
+    [[nodiscard]] int node_id() const { return _node_id; }
     [[nodiscard]] virtual std::string name() const { return _name; }
     BasicSharedState* shared_state() { return _shared_state; }
     void set_shared_state(BasicSharedState* shared_state) { _shared_state = shared_state; }
@@ -649,12 +650,26 @@ struct NestedLoopJoinSharedState : public JoinSharedState {
     vectorized::Blocks build_blocks;
 };
 
-struct PartitionSortNodeSharedState : public BasicSharedState {
+struct PartitionSortNodeSharedState
+        : public BasicSharedState,
+          public BasicSpillSharedState,
+          public std::enable_shared_from_this<PartitionSortNodeSharedState> {
     ENABLE_FACTORY_CREATOR(PartitionSortNodeSharedState)
 public:
+    void update_spill_stream_profiles(RuntimeProfile* source_profile) override;
+
+    void close();
+
     std::queue<vectorized::Block> blocks_buffer;
     std::mutex buffer_mutex;
     std::vector<std::unique_ptr<vectorized::PartitionSorter>> partition_sorts;
+    // Same index as partition_sorts. A partition with a stream had part of its rows revoked to
+    // disk, the source reads them back into the sorter before it is prepared.
+    std::vector<vectorized::SpillStreamSPtr> spill_streams;
+    // held by the spill and recover tasks while they use the streams, so close() waits for them
+    std::mutex spill_lock;
+    bool is_spilled = false;
+    std::atomic_bool is_closed = false;
     bool sink_eos = false;
     std::mutex sink_eos_lock;
     std::mutex prepared_finish_lock;
@@ -0,0 +1,83 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "pipeline/dependency_wait_stats.h"
+
+#include <algorithm>
+
+namespace doris::pipeline {
+#include "common/compile_check_begin.h"
+
+void DependencyWaitStats::update(const std::string& dependency, int node_id, int64_t wait_ns,
+                                 int64_t wait_times) {
+    std::lock_guard<std::mutex> l(_lock);
+    auto& value = _stats[{dependency, node_id}];
+    value.wait_ns += wait_ns;
+    value.wait_times += wait_times;
+}
+
+void DependencyWaitStats::merge_to(DependencyWaitStats* other) const {
+    std::map<std::string, Value> merged;
+    {
+        std::lock_guard<std::mutex> l(_lock);
+        for (const auto& [key, value] : _stats) {
+            auto& merged_value = merged[key.first];
+            merged_value.wait_ns += value.wait_ns;
+            merged_value.wait_times += value.wait_times;
+        }
+    }
+    std::lock_guard<std::mutex> l(other->_lock);
+    for (const auto& [dependency, value] : merged) {
+        auto& other_value = other->_stats[{dependency, -1}];
+        other_value.wait_ns += value.wait_ns;
+        other_value.wait_times += value.wait_times;
+    }
+}
+
+int64_t DependencyWaitStats::total_wait_ns() const {
+    std::lock_guard<std::mutex> l(_lock);
+    int64_t total = 0;
+    for (const auto& [_, value] : _stats) {
+        total += value.wait_ns;
+    }
+    return total;
+}
+
+std::vector<DependencyWaitStats::Item> DependencyWaitStats::top_waits(size_t top_n) const {
+    std::vector<Item> items;
+    {
+        std::lock_guard<std::mutex> l(_lock);
+        items.reserve(_stats.size());
+        for (const auto& [key, value] : _stats) {
+            items.push_back({key.first, key.second, value.wait_ns, value.wait_times});
+        }
+    }
+    std::sort(items.begin(), items.end(),
+              [](const Item& lhs, const Item& rhs) { return lhs.wait_ns > rhs.wait_ns; });
+    if (top_n > 0 && items.size() > top_n) {
+        items.resize(top_n);
+    }
+    return items;
+}
+
+DependencyWaitStats* DependencyWaitStats::backend() {
+    static DependencyWaitStats stats;
+    return &stats;
+}
+
+#include "common/compile_check_end.h"
+} // namespace doris::pipeline
@@ -0,0 +1,69 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace doris::pipeline {
+
+// Time pipeline tasks spent blocked on dependencies, grouped by the dependency name and the plan
+// node it belongs to. The dependency name carries its type and operator, e.g.
+// `EXCHANGE_OPERATOR_DEPENDENCY` or `RUNTIME_FILTER_DEPENDENCY`, so it tells whether a query is
+// waiting for runtime filters, exchange data, scan data or memory.
+//
+// Every query owns one and merges it into `DependencyWaitStats::backend()` when it finishes.
+class DependencyWaitStats {
+public:
+    struct Item {
+        std::string dependency;
+        // -1 for the backend wide stats, where waits of all plan nodes are merged.
+        int node_id = -1;
+        int64_t wait_ns = 0;
+        int64_t wait_times = 0;
+    };
+
+    void update(const std::string& dependency, int node_id, int64_t wait_ns,
+                int64_t wait_times = 1);
+
+    // Merge into `other` grouping by dependency name only.
+    void merge_to(DependencyWaitStats* other) const;
+
+    int64_t total_wait_ns() const;
+
+    // At most `top_n` items sorted by wait time descending, 0 means all.
+    std::vector<Item> top_waits(size_t top_n = 0) const;
+
+    // Waits of all finished queries of this backend.
+    static DependencyWaitStats* backend();
+
+private:
+    struct Value {
+        int64_t wait_ns = 0;
+        int64_t wait_times = 0;
+    };
+
+    mutable std::mutex _lock;
+    std::map<std::pair<std::string, int>, Value> _stats;
+};
+
+} // namespace doris::pipeline
@@ -886,6 +886,8 @@ Status AggSinkOperatorX::reset_hash_table(RuntimeState* state) {
     auto& local_state = get_local_state(state);
     auto& ss = *local_state.Base::_shared_state;
     RETURN_IF_ERROR(ss.reset_hash_table());
+    // the keys and states living in the arena are gone with the hash table
+    local_state._agg_arena_pool.clear();
     local_state._serialize_key_arena_memory_usage->set((int64_t)0);
     return Status::OK();
 }
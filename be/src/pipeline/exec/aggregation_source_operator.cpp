@@ -542,6 +542,15 @@ size_t AggSourceOperatorX::get_estimated_memory_size_for_merging(RuntimeState* s
     return size;
 }
 
+Status AggSourceOperatorX::reset_hash_table(RuntimeState* state) {
+    auto& local_state = get_local_state(state);
+    RETURN_IF_ERROR(local_state._shared_state->reset_hash_table());
+    // the keys and states merged into the arena are gone with the hash table
+    local_state._agg_arena_pool.clear();
+    COUNTER_SET(local_state._memory_usage_arena, int64_t(0));
+    return Status::OK();
+}
+
 void AggLocalState::_emplace_into_hash_table(vectorized::AggregateDataPtr* places,
                                              vectorized::ColumnRawPtrs& key_columns,
                                              uint32_t num_rows) {
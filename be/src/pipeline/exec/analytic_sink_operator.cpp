@@ -137,9 +137,8 @@ Status AnalyticSinkLocalState::open(RuntimeState* state) {
         if (PARTITION_FUNCTION_SET.contains(_agg_functions[i]->function()->get_name())) {
             _streaming_mode = false;
         }
-        _support_incremental_calculate &=
-                _agg_functions[i]->function()->supported_incremental_mode();
     }
+    _init_frame_strategies();
 
     _partition_exprs_size = p._partition_by_eq_expr_ctxs.size();
     _partition_by_eq_expr_ctxs.resize(_partition_exprs_size);
@@ -203,17 +202,8 @@ bool AnalyticSinkLocalState::_get_next_for_sliding_rows(int64_t current_block_ro
             _need_more_data = true;
             break;
         }
-        if (_support_incremental_calculate) {
-            _execute_for_function<true>(_partition_by_pose.start, _partition_by_pose.end,
-                                        current_row_start, current_row_end);
-        } else {
-            _reset_agg_status();
-            // Eg: rows between unbounded preceding and 10 preceding
-            // Make sure range_start <= range_end
-            current_row_start = std::min(current_row_start, current_row_end);
-            _execute_for_function(_partition_by_pose.start, _partition_by_pose.end,
-                                  current_row_start, current_row_end);
-        }
+        _execute_for_sliding_frame(_partition_by_pose.start, _partition_by_pose.end,
+                                   current_row_start, current_row_end);
 
         int64_t pos = current_pos_in_block();
         _insert_result_info(pos, pos + 1);
@@ -309,7 +299,6 @@ bool AnalyticSinkLocalState::_get_next_for_unbounded_range(int64_t current_block
 bool AnalyticSinkLocalState::_get_next_for_range_between(int64_t current_block_rows,
                                                          int64_t current_block_base_pos) {
     while (_current_row_position < _partition_by_pose.end) {
-        _reset_agg_status();
         if (!_parent->cast<AnalyticSinkOperatorX>()._window.__isset.window_start) {
             _order_by_pose.start = _partition_by_pose.start;
         } else {
@@ -325,8 +314,8 @@ bool AnalyticSinkLocalState::_get_next_for_range_between(int64_t current_block_r
                     _range_result_columns[1].get(), _order_by_columns[0].get(),
                     _current_row_position, _order_by_pose.end, _partition_by_pose.end);
         }
-        _execute_for_function(_partition_by_pose.start, _partition_by_pose.end,
-                              _order_by_pose.start, _order_by_pose.end);
+        _execute_for_sliding_frame(_partition_by_pose.start, _partition_by_pose.end,
+                                   _order_by_pose.start, _order_by_pose.end);
         int64_t pos = current_pos_in_block();
         _insert_result_info(pos, pos + 1);
         _current_row_position++;
@@ -375,7 +364,32 @@ Status AnalyticSinkLocalState::_execute_impl() {
     return Status::OK();
 }
 
-template <bool incremental>
+void AnalyticSinkLocalState::_init_frame_strategies() {
+    auto& p = _parent->cast<AnalyticSinkOperatorX>();
+    const bool sliding_rows =
+            _executor.get_next_impl == &AnalyticSinkLocalState::_get_next_for_sliding_rows &&
+            _support_incremental_calculate;
+    const bool sliding_range =
+            _executor.get_next_impl == &AnalyticSinkLocalState::_get_next_for_range_between;
+    _frame_strategies.assign(_agg_functions_size, WindowFrameStrategy::RECOMPUTE);
+    _monotonic_rows.resize(_agg_functions_size);
+    _monotonic_next_rows.assign(_agg_functions_size, 0);
+    _monotonic_is_min.assign(_agg_functions_size, false);
+    for (size_t i = 0; i < _agg_functions_size; ++i) {
+        const auto& function = _agg_functions[i]->function();
+        const auto& name = function->get_name();
+        bool is_min = name == "min" || name == "Nullable(min)";
+        bool is_max = name == "max" || name == "Nullable(max)";
+        if ((sliding_rows || sliding_range) && (is_min || is_max) && p._num_agg_input[i] == 1) {
+            // frames of both kinds only move forward, so rows leave in the order they enter
+            _frame_strategies[i] = WindowFrameStrategy::MONOTONIC;
+            _monotonic_is_min[i] = is_min;
+        } else if (sliding_rows && function->supported_incremental_mode()) {
+            _frame_strategies[i] = WindowFrameStrategy::INCREMENTAL;
+        }
+    }
+}
+
 void AnalyticSinkLocalState::_execute_for_function(int64_t partition_start, int64_t partition_end,
                                                    int64_t frame_start, int64_t frame_end) {
     // here is the core function, should not add timer
@@ -384,19 +398,86 @@ void AnalyticSinkLocalState::_execute_for_function(int64_t partition_start, int6
         for (int j = 0; j < _agg_input_columns[i].size(); ++j) {
             agg_columns.push_back(_agg_input_columns[i][j].get());
         }
-        if constexpr (incremental) {
+        _agg_functions[i]->function()->add_range_single_place(
+                partition_start, partition_end, frame_start, frame_end,
+                _fn_place_ptr + _offsets_of_aggregate_states[i], agg_columns.data(),
+                _agg_arena_pool, &(_use_null_result[i]), &_could_use_previous_result[i]);
+    }
+}
+
+void AnalyticSinkLocalState::_execute_for_sliding_frame(int64_t partition_start,
+                                                        int64_t partition_end, int64_t frame_start,
+                                                        int64_t frame_end) {
+    // here is the core function, should not add timer
+    for (size_t i = 0; i < _agg_functions_size; ++i) {
+        if (_frame_strategies[i] == WindowFrameStrategy::MONOTONIC) {
+            _execute_for_monotonic_function(i, partition_start, partition_end, frame_start,
+                                            frame_end);
+            continue;
+        }
+        std::vector<const vectorized::IColumn*> agg_columns;
+        for (int j = 0; j < _agg_input_columns[i].size(); ++j) {
+            agg_columns.push_back(_agg_input_columns[i][j].get());
+        }
+        auto* place = _fn_place_ptr + _offsets_of_aggregate_states[i];
+        if (_frame_strategies[i] == WindowFrameStrategy::INCREMENTAL) {
             _agg_functions[i]->function()->execute_function_with_incremental(
-                    partition_start, partition_end, frame_start, frame_end,
-                    _fn_place_ptr + _offsets_of_aggregate_states[i], agg_columns.data(),
-                    _agg_arena_pool, false, false, false, &_use_null_result[i],
-                    &_could_use_previous_result[i]);
+                    partition_start, partition_end, frame_start, frame_end, place,
+                    agg_columns.data(), _agg_arena_pool, false, false, false,
+                    &_use_null_result[i], &_could_use_previous_result[i]);
         } else {
+            _reset_agg_status(i);
+            // Eg: rows between unbounded preceding and 10 preceding
+            // Make sure range_start <= range_end
             _agg_functions[i]->function()->add_range_single_place(
-                    partition_start, partition_end, frame_start, frame_end,
-                    _fn_place_ptr + _offsets_of_aggregate_states[i], agg_columns.data(),
-                    _agg_arena_pool, &(_use_null_result[i]), &_could_use_previous_result[i]);
+                    partition_start, partition_end, std::min(frame_start, frame_end), frame_end,
+                    place, agg_columns.data(), _agg_arena_pool, &(_use_null_result[i]),
+                    &_could_use_previous_result[i]);
+        }
+    }
+}
+
+void AnalyticSinkLocalState::_execute_for_monotonic_function(size_t index,
+                                                             int64_t partition_start,
+                                                             int64_t partition_end,
+                                                             int64_t frame_start,
+                                                             int64_t frame_end) {
+    frame_start = std::max(frame_start, partition_start);
+    frame_end = std::min(frame_end, partition_end);
+    _reset_agg_status(index);
+    if (frame_start >= frame_end) {
+        _use_null_result[index] = 1;
+        return;
+    }
+
+    // the front row is the extreme of the frame, the value of every row behind it is worse
+    // than the row before it, so a row is pushed and popped once over the whole partition
+    const auto& column = *_agg_input_columns[index][0];
+    const auto* nullable_column = check_and_get_column<vectorized::ColumnNullable>(column);
+    const int direction = _monotonic_is_min[index] ? 1 : -1;
+    auto& rows = _monotonic_rows[index];
+    while (!rows.empty() && rows.front() < frame_start) {
+        rows.pop_front();
+    }
+    auto& next_row = _monotonic_next_rows[index];
+    for (next_row = std::max(next_row, frame_start); next_row < frame_end; ++next_row) {
+        if (nullable_column != nullptr && nullable_column->is_null_at(next_row)) {
+            continue;
+        }
+        while (!rows.empty() &&
+               column.compare_at(rows.back(), next_row, column, 1) * direction >= 0) {
+            rows.pop_back();
         }
+        rows.push_back(next_row);
     }
+
+    // a frame of only nulls still adds one of its rows to get the null result
+    const int64_t result_row = rows.empty() ? frame_start : rows.front();
+    const vectorized::IColumn* agg_column = &column;
+    _agg_functions[index]->function()->add_range_single_place(
+            partition_start, partition_end, result_row, result_row + 1,
+            _fn_place_ptr + _offsets_of_aggregate_states[index], &agg_column, _agg_arena_pool,
+            &(_use_null_result[index]), &_could_use_previous_result[index]);
 }
 
 void AnalyticSinkLocalState::_insert_result_info(int64_t start, int64_t end) {
@@ -872,6 +953,12 @@ void AnalyticSinkLocalState::_remove_unused_rows() {
     COUNTER_UPDATE(_remove_count, 1);
     COUNTER_UPDATE(_remove_rows, remove_rows);
     _current_row_position -= remove_rows;
+    for (size_t i = 0; i < _agg_functions_size; i++) {
+        for (auto& row : _monotonic_rows[i]) {
+            row -= remove_rows;
+        }
+        _monotonic_next_rows[i] -= remove_rows;
+    }
     _partition_by_pose.remove_unused_rows(remove_rows);
     _order_by_pose.remove_unused_rows(remove_rows);
     int64_t candidate_partition_end_size = _next_partition_ends.size();
@@ -912,13 +999,19 @@ Status AnalyticSinkOperatorX::_insert_range_column(vectorized::Block* block,
 }
 
 void AnalyticSinkLocalState::_reset_agg_status() {
-    _use_null_result.assign(_agg_functions_size, 0);
-    _could_use_previous_result.assign(_agg_functions_size, 0);
     for (size_t i = 0; i < _agg_functions_size; ++i) {
-        _agg_functions[i]->reset(_fn_place_ptr + _offsets_of_aggregate_states[i]);
+        _reset_agg_status(i);
+        _monotonic_rows[i].clear();
+        _monotonic_next_rows[i] = 0;
     }
 }
 
+void AnalyticSinkLocalState::_reset_agg_status(size_t index) {
+    _use_null_result[index] = 0;
+    _could_use_previous_result[index] = 0;
+    _agg_functions[index]->reset(_fn_place_ptr + _offsets_of_aggregate_states[index]);
+}
+
 void AnalyticSinkLocalState::_create_agg_status() {
     for (size_t i = 0; i < _agg_functions_size; ++i) {
         try {
@@ -20,6 +20,8 @@
 
 #include <stdint.h>
 
+#include <deque>
+
 #include "operator.h"
 #include "pipeline/dependency.h"
 
@@ -62,6 +64,16 @@ public:
 // those function cacluate need partition info, so can't be used in streaming mode
 static const std::set<std::string> PARTITION_FUNCTION_SET {"ntile", "cume_dist", "percent_rank"};
 
+// How a function moves its state from one frame to the next when the frame slides forward.
+enum class WindowFrameStrategy : uint8_t {
+    // reset the state and aggregate every row of the new frame
+    RECOMPUTE,
+    // remove the row that leaves the frame and add the row that enters it, eg: sum, count, avg
+    INCREMENTAL,
+    // min/max: keep the rows that may still become the extreme in a monotonic deque
+    MONOTONIC,
+};
+
 class AnalyticSinkLocalState : public PipelineXSinkLocalState<AnalyticSharedState> {
     ENABLE_FACTORY_CREATOR(AnalyticSinkLocalState);
 
@@ -88,9 +100,15 @@ private:
     bool _get_next_for_sliding_rows(int64_t current_block_rows, int64_t current_block_base_pos);
 
     void _init_result_columns();
-    template <bool incremental = false>
+    void _init_frame_strategies();
     void _execute_for_function(int64_t partition_start, int64_t partition_end, int64_t frame_start,
                                int64_t frame_end);
+    // the frame only moves forward, so each function can reuse the state of the previous frame
+    void _execute_for_sliding_frame(int64_t partition_start, int64_t partition_end,
+                                    int64_t frame_start, int64_t frame_end);
+    void _execute_for_monotonic_function(size_t index, int64_t partition_start,
+                                         int64_t partition_end, int64_t frame_start,
+                                         int64_t frame_end);
     void _insert_result_info(int64_t start, int64_t end);
     int64_t current_pos_in_block() {
         return _current_row_position + _have_removed_rows -
@@ -102,6 +120,7 @@ private:
 
     void _create_agg_status();
     void _reset_agg_status();
+    void _reset_agg_status(size_t index);
     void _destroy_agg_status();
     void _remove_unused_rows();
 
@@ -138,6 +157,11 @@ private:
     std::vector<size_t> _offsets_of_aggregate_states;
     std::vector<bool> _result_column_nullable_flags;
     std::vector<bool> _result_column_could_resize;
+    std::vector<WindowFrameStrategy> _frame_strategies;
+    // for MONOTONIC functions: candidate rows of the frame and the first row not pushed yet
+    std::vector<std::deque<int64_t>> _monotonic_rows;
+    std::vector<int64_t> _monotonic_next_rows;
+    std::vector<bool> _monotonic_is_min;
 
     using vectorized_get_next = bool (AnalyticSinkLocalState::*)(int64_t, int64_t);
     struct executor {
@@ -148,6 +172,7 @@ private:
     std::vector<uint8_t> _use_null_result;
     std::vector<uint8_t> _could_use_previous_result;
     bool _streaming_mode = false;
+    // rows frame with both bounds set, its start and end move one row at a time
     bool _support_incremental_calculate = true;
     bool _need_more_data = false;
     int64_t _current_row_position = 0;
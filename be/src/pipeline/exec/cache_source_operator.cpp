@@ -64,11 +64,24 @@ Status CacheSourceLocalState::init(RuntimeState* state, LocalStateInfo& info) {
             "CacheTabletId", std::to_string(scan_ranges[0].scan_range.palo_scan_range.tablet_id));
 
     // 3. lookup the cache and find proper slot order
-    hit_cache = _global_cache->lookup(_cache_key, _version, &_query_cache_handle);
+    RETURN_IF_ERROR(
+            _global_cache->lookup_for_query(state, scan_ranges, cache_param,
+                                            _parent->cast<CacheSourceOperatorX>()._cache_merge_info,
+                                            &_cache_lookup));
+    hit_cache = _cache_lookup->hit;
     custom_profile()->add_info_string("HitCache", std::to_string(hit_cache));
-    if (hit_cache && !cache_param.force_refresh_query_cache) {
-        _hit_cache_results = _query_cache_handle.get_cache_result();
-        auto hit_cache_slot_orders = _query_cache_handle.get_cache_slot_orders();
+    if (_cache_lookup->delta_start_version > 0) {
+        custom_profile()->add_info_string("IncrementalHitCacheFromVersion",
+                                          std::to_string(_cache_lookup->delta_start_version));
+    }
+    if (hit_cache || _cache_lookup->delta_start_version > 0) {
+        auto* cache_results = _cache_lookup->handle.get_cache_result();
+        if (hit_cache) {
+            _hit_cache_results = cache_results;
+        } else {
+            _delta_base_results = cache_results;
+        }
+        auto hit_cache_slot_orders = _cache_lookup->handle.get_cache_slot_orders();
 
         if (_slot_orders != *hit_cache_slot_orders) {
             for (auto slot_id : _slot_orders) {
@@ -109,6 +122,23 @@ std::string CacheSourceLocalState::debug_string(int indentation_level) const {
     return fmt::to_string(debug_string_buffer);
 }
 
+Status CacheSourceOperatorX::_fill_cached_block(CacheSourceLocalState& local_state,
+                                               const vectorized::Block& cached_block,
+                                               vectorized::Block* block, bool need_clone_empty) {
+    if (need_clone_empty) {
+        *block = cached_block.clone_empty();
+    }
+    RETURN_IF_ERROR(vectorized::MutableBlock::build_mutable_block(block).merge(cached_block));
+    if (!local_state._hit_cache_column_orders.empty()) {
+        auto datas = block->get_columns_with_type_and_name();
+        block->clear();
+        for (auto loc : local_state._hit_cache_column_orders) {
+            block->insert(datas[loc]);
+        }
+    }
+    return Status::OK();
+}
+
 Status CacheSourceOperatorX::get_block(RuntimeState* state, vectorized::Block* block, bool* eos) {
     auto& local_state = get_local_state(state);
     SCOPED_TIMER(local_state.exec_time_counter());
@@ -116,7 +146,23 @@ Status CacheSourceOperatorX::get_block(RuntimeState* state, vectorized::Block* b
     block->clear_column_data(_row_descriptor.num_materialized_slots());
     bool need_clone_empty = block->columns() == 0;
 
-    if (local_state._hit_cache_results == nullptr) {
+    if (local_state._delta_base_results != nullptr &&
+        local_state._hit_cache_pos < local_state._delta_base_results->size()) {
+        // Incremental hit: the cached result of the old version goes first, then the result of
+        // the newer rowsets is streamed from the child, and both are cached for the new version.
+        const auto& cached_block =
+                local_state._delta_base_results->at(local_state._hit_cache_pos++);
+        RETURN_IF_ERROR(_fill_cached_block(local_state, *cached_block, block, need_clone_empty));
+        if (local_state._need_insert_cache) {
+            auto cache_block = vectorized::Block::create_unique(block->clone_empty());
+            RETURN_IF_ERROR(
+                    vectorized::MutableBlock::build_mutable_block(cache_block.get()).merge(*block));
+            local_state._current_query_cache_rows += cache_block->rows();
+            local_state._current_query_cache_bytes += cache_block->allocated_bytes();
+            local_state._local_cache_blocks.emplace_back(std::move(cache_block));
+        }
+        *eos = false;
+    } else if (local_state._hit_cache_results == nullptr) {
         Defer insert_cache([&] {
             if (*eos) {
                 local_state.custom_profile()->add_info_string(
@@ -168,18 +214,8 @@ Status CacheSourceOperatorX::get_block(RuntimeState* state, vectorized::Block* b
         if (local_state._hit_cache_pos < local_state._hit_cache_results->size()) {
             const auto& hit_cache_block =
                     local_state._hit_cache_results->at(local_state._hit_cache_pos++);
-            if (need_clone_empty) {
-                *block = hit_cache_block->clone_empty();
-            }
             RETURN_IF_ERROR(
-                    vectorized::MutableBlock::build_mutable_block(block).merge(*hit_cache_block));
-            if (!local_state._hit_cache_column_orders.empty()) {
-                auto datas = block->get_columns_with_type_and_name();
-                block->clear();
-                for (auto loc : local_state._hit_cache_column_orders) {
-                    block->insert(datas[loc]);
-                }
-            }
+                    _fill_cached_block(local_state, *hit_cache_block, block, need_clone_empty));
         } else {
             *eos = true;
         }
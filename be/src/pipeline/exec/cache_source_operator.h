@@ -62,8 +62,10 @@ private:
     size_t _current_query_cache_rows = 0;
     bool _need_insert_cache = true;
 
-    QueryCacheHandle _query_cache_handle;
+    std::shared_ptr<QueryCacheLookup> _cache_lookup;
     std::vector<vectorized::BlockUPtr>* _hit_cache_results = nullptr;
+    // cached result of an older version that the result of the newer rowsets is appended to
+    std::vector<vectorized::BlockUPtr>* _delta_base_results = nullptr;
     std::vector<int> _hit_cache_column_orders;
     int _hit_cache_pos = 0;
 };
@@ -72,8 +74,10 @@ class CacheSourceOperatorX final : public OperatorX<CacheSourceLocalState> {
 public:
     using Base = OperatorX<CacheSourceLocalState>;
     CacheSourceOperatorX(ObjectPool* pool, int plan_node_id, int operator_id,
-                         const TQueryCacheParam& cache_param)
-            : Base(pool, plan_node_id, operator_id), _cache_param(cache_param) {
+                         const TQueryCacheParam& cache_param, QueryCacheMergeInfo merge_info)
+            : Base(pool, plan_node_id, operator_id),
+              _cache_param(cache_param),
+              _cache_merge_info(merge_info) {
         _op_name = "CACHE_SOURCE_OPERATOR";
     };
 
@@ -93,7 +97,12 @@ public:
     const RowDescriptor& row_desc() const override { return _child->row_desc(); }
 
 private:
+    Status _fill_cached_block(CacheSourceLocalState& local_state,
+                              const vectorized::Block& cached_block, vectorized::Block* block,
+                              bool need_clone_empty);
+
     TQueryCacheParam _cache_param;
+    QueryCacheMergeInfo _cache_merge_info;
     bool _has_data(RuntimeState* state) const {
         auto& local_state = get_local_state(state);
         return local_state._shared_state->data_queue.remaining_has_data();
@@ -101,6 +101,7 @@ ExchangeSinkBuffer::ExchangeSinkBuffer(PUniqueId query_id, PlanNodeId dest_node_
           _state(state),
           _context(state->get_query_ctx()),
           _exchange_sink_num(sender_ins_ids.size()),
+          _credit_bytes_per_instance(config::exchange_sink_credit_bytes_per_instance),
           _send_multi_blocks(state->query_options().__isset.exchange_multi_blocks_byte_size &&
                              state->query_options().exchange_multi_blocks_byte_size > 0) {
     if (_send_multi_blocks) {
@@ -151,6 +152,7 @@ void ExchangeSinkBuffer::construct_request(TUniqueId fragment_instance_id) {
     instance_data->request->mutable_query_id()->CopyFrom(_query_id);
     instance_data->request->set_node_id(_dest_node_id);
     instance_data->running_sink_count = _exchange_sink_num;
+    instance_data->credit_bytes = _credit_bytes_per_instance;
 
     _rpc_instances[low_id] = std::move(instance_data);
 }
@@ -176,14 +178,18 @@ Status ExchangeSinkBuffer::add_block(vectorized::Channel* channel, TransmitInfo&
             send_now = true;
             instance_data.rpc_channel_is_idle = false;
         }
+        int64_t block_bytes = 0;
         if (request.block) {
             RETURN_IF_ERROR(
                     BeExecVersionManager::check_be_exec_version(request.block->be_exec_version()));
-            COUNTER_UPDATE(channel->_parent->memory_used_counter(), request.block->ByteSizeLong());
+            block_bytes = request.block->ByteSizeLong();
+            COUNTER_UPDATE(channel->_parent->memory_used_counter(), block_bytes);
         }
         instance_data.package_queue[channel].emplace(std::move(request));
         _total_queue_size++;
-        if (_total_queue_size > _queue_capacity) {
+        if (_credit_flow_control()) {
+            _spend_credits(instance_data, block_bytes);
+        } else if (_total_queue_size > _queue_capacity) {
             for (auto& dep : _queue_deps) {
                 dep->block();
             }
@@ -221,6 +227,9 @@ Status ExchangeSinkBuffer::add_block(vectorized::Channel* channel,
         if (request.block_holder->get_block()) {
             RETURN_IF_ERROR(BeExecVersionManager::check_be_exec_version(
                     request.block_holder->get_block()->be_exec_version()));
+            if (_credit_flow_control()) {
+                _spend_credits(instance_data, request.block_holder->get_block()->ByteSizeLong());
+            }
         }
         instance_data.broadcast_package_queue[channel].emplace(request);
     }
@@ -268,7 +277,7 @@ Status ExchangeSinkBuffer::_send_rpc(RpcInstance& instance_data) {
         return Status::OK();
     }
 
-    auto mem_byte = 0;
+    int64_t mem_byte = 0;
     if (q_ptr && !q_ptr->empty()) {
         auto& q = *q_ptr;
 
@@ -326,7 +335,8 @@ Status ExchangeSinkBuffer::_send_rpc(RpcInstance& instance_data) {
             _failed(ins->id, err);
         });
         send_callback->start_rpc_time = GetCurrentTimeNanos();
-        send_callback->addSuccessHandler([&, weak_task_ctx = weak_task_exec_ctx()](
+        send_callback->addSuccessHandler([&, weak_task_ctx = weak_task_exec_ctx(),
+                                          credit_bytes = mem_byte](
                                                  RpcInstance* ins_ptr, const bool& eos,
                                                  const PTransmitDataResult& result,
                                                  const int64_t& start_rpc_time) {
@@ -341,6 +351,12 @@ Status ExchangeSinkBuffer::_send_rpc(RpcInstance& instance_data) {
             auto& ins = *ins_ptr;
             auto end_rpc_time = GetCurrentTimeNanos();
             update_rpc_time(ins, start_rpc_time, end_rpc_time);
+            if (_credit_flow_control()) {
+                // The receiver delays its reply while its queue is full, so the reply is
+                // the grant of the credits this rpc spent.
+                std::unique_lock<std::mutex> credit_lock(*ins.mutex);
+                _grant_credits(ins, credit_bytes);
+            }
 
             Status s(Status::create(result.status()));
             if (s.is<ErrorCode::END_OF_FILE>()) {
@@ -384,7 +400,7 @@ Status ExchangeSinkBuffer::_send_rpc(RpcInstance& instance_data) {
         }
         DCHECK_GE(_total_queue_size, requests.size());
         _total_queue_size -= (int)requests.size();
-        if (_total_queue_size <= _queue_capacity) {
+        if (!_credit_flow_control() && _total_queue_size <= _queue_capacity) {
             for (auto& dep : _queue_deps) {
                 dep->set_ready();
             }
@@ -456,7 +472,8 @@ Status ExchangeSinkBuffer::_send_rpc(RpcInstance& instance_data) {
             _failed(ins->id, err);
         });
         send_callback->start_rpc_time = GetCurrentTimeNanos();
-        send_callback->addSuccessHandler([&, weak_task_ctx = weak_task_exec_ctx()](
+        send_callback->addSuccessHandler([&, weak_task_ctx = weak_task_exec_ctx(),
+                                          credit_bytes = mem_byte](
                                                  RpcInstance* ins_ptr, const bool& eos,
                                                  const PTransmitDataResult& result,
                                                  const int64_t& start_rpc_time) {
@@ -470,6 +487,12 @@ Status ExchangeSinkBuffer::_send_rpc(RpcInstance& instance_data) {
             auto& ins = *ins_ptr;
             auto end_rpc_time = GetCurrentTimeNanos();
             update_rpc_time(ins, start_rpc_time, end_rpc_time);
+            if (_credit_flow_control()) {
+                // The receiver delays its reply while its queue is full, so the reply is
+                // the grant of the credits this rpc spent.
+                std::unique_lock<std::mutex> credit_lock(*ins.mutex);
+                _grant_credits(ins, credit_bytes);
+            }
 
             Status s(Status::create(result.status()));
             if (s.is<ErrorCode::END_OF_FILE>()) {
@@ -540,12 +563,14 @@ void ExchangeSinkBuffer::_set_receiver_eof(RpcInstance& ins) {
     // and the rpc_channel should be turned off immediately.
     Defer turn_off([&]() { _turn_off_channel(ins, lock); });
 
+    int64_t dropped_bytes = 0;
     auto& broadcast_q_map = ins.broadcast_package_queue;
     for (auto& [channel, broadcast_q] : broadcast_q_map) {
         for (; !broadcast_q.empty(); broadcast_q.pop()) {
             if (broadcast_q.front().block_holder->get_block()) {
-                COUNTER_UPDATE(channel->_parent->memory_used_counter(),
-                               -broadcast_q.front().block_holder->get_block()->ByteSizeLong());
+                auto block_bytes = broadcast_q.front().block_holder->get_block()->ByteSizeLong();
+                COUNTER_UPDATE(channel->_parent->memory_used_counter(), -block_bytes);
+                dropped_bytes += block_bytes;
             }
         }
     }
@@ -558,14 +583,17 @@ void ExchangeSinkBuffer::_set_receiver_eof(RpcInstance& ins) {
             // ExchangeSinkQueueDependency will be blocked and pipeline will be deadlocked
             _total_queue_size--;
             if (q.front().block) {
-                COUNTER_UPDATE(channel->_parent->memory_used_counter(),
-                               -q.front().block->ByteSizeLong());
+                auto block_bytes = q.front().block->ByteSizeLong();
+                COUNTER_UPDATE(channel->_parent->memory_used_counter(), -block_bytes);
+                dropped_bytes += block_bytes;
             }
         }
     }
 
     // Try to wake up pipeline after clearing the queue
-    if (_total_queue_size <= _queue_capacity) {
+    if (_credit_flow_control()) {
+        _grant_credits(ins, dropped_bytes);
+    } else if (_total_queue_size <= _queue_capacity) {
         for (auto& dep : _queue_deps) {
             dep->set_ready();
         }
@@ -585,6 +613,8 @@ void ExchangeSinkBuffer::_turn_off_channel(RpcInstance& ins,
         return;
     }
     ins.rpc_channel_is_turn_off = true;
+    // A channel that is turned off never gets its credits back, do not let it block the sinks.
+    _grant_credits(ins, 0, true);
     auto weak_task_ctx = weak_task_exec_ctx();
     if (auto pip_ctx = weak_task_ctx.lock()) {
         for (auto& parent : _parents) {
@@ -593,6 +623,37 @@ void ExchangeSinkBuffer::_turn_off_channel(RpcInstance& ins,
     }
 }
 
+void ExchangeSinkBuffer::_spend_credits(RpcInstance& ins, int64_t bytes) {
+    ins.credit_bytes -= bytes;
+    if (ins.credit_bytes > 0 || ins.credit_starved || ins.rpc_channel_is_turn_off) {
+        return;
+    }
+    ins.credit_starved = true;
+    std::lock_guard l(_m);
+    _credit_starved_count++;
+    if (_credit_starved_instances++ == 0) {
+        _credit_starved_start_ns = MonotonicNanos();
+        for (auto& dep : _queue_deps) {
+            dep->block();
+        }
+    }
+}
+
+void ExchangeSinkBuffer::_grant_credits(RpcInstance& ins, int64_t bytes, bool turn_off) {
+    ins.credit_bytes += bytes;
+    if (!ins.credit_starved || (ins.credit_bytes <= 0 && !turn_off)) {
+        return;
+    }
+    ins.credit_starved = false;
+    std::lock_guard l(_m);
+    if (--_credit_starved_instances == 0) {
+        _credit_starved_time_ns += MonotonicNanos() - _credit_starved_start_ns;
+        for (auto& dep : _queue_deps) {
+            dep->set_ready();
+        }
+    }
+}
+
 void ExchangeSinkBuffer::get_max_min_rpc_time(int64_t* max_time, int64_t* min_time) {
     int64_t local_max_time = 0;
     int64_t local_min_time = INT64_MAX;
@@ -644,6 +705,14 @@ void ExchangeSinkBuffer::update_profile(RuntimeProfile* profile) {
     _sum_rpc_timer->set(sum_time);
     _avg_rpc_timer->set(sum_time / std::max(static_cast<int64_t>(1), _rpc_count.load()));
 
+    if (_credit_flow_control()) {
+        auto* credit_starved_counter = ADD_COUNTER(profile, "CreditStarvedCount", TUnit::UNIT);
+        auto* credit_starved_timer = ADD_TIMER(profile, "CreditStarvedTime");
+        std::lock_guard l(_m);
+        credit_starved_counter->set(_credit_starved_count);
+        credit_starved_timer->set(_credit_starved_time_ns);
+    }
+
     auto max_count = _state->rpc_verbose_profile_max_instance_count();
     // This counter will lead to performance degradation.
     // So only collect this information when the profile level is greater than 3.
@@ -32,6 +32,7 @@
 #include <stack>
 #include <string>
 
+#include "common/config.h"
 #include "common/global_types.h"
 #include "common/status.h"
 #include "runtime/runtime_state.h"
@@ -164,6 +165,12 @@ struct RpcInstance {
 
     // Count of active exchange sinks using this RPC instance
     int64_t running_sink_count = 0;
+
+    // Byte credits left for queued and in flight data, only used by credit based flow control
+    int64_t credit_bytes = 0;
+
+    // Flag indicating if this instance ran out of credits and is blocking the exchange sinks
+    bool credit_starved = false;
 };
 
 template <typename Response>
@@ -269,7 +276,10 @@ public:
                        RuntimeState* state, const std::vector<InstanceLoId>& sender_ins_ids);
 #ifdef BE_TEST
     ExchangeSinkBuffer(RuntimeState* state, int64_t sinknum)
-            : HasTaskExecutionCtx(state), _state(state), _exchange_sink_num(sinknum) {};
+            : HasTaskExecutionCtx(state),
+              _state(state),
+              _exchange_sink_num(sinknum),
+              _credit_bytes_per_instance(config::exchange_sink_credit_bytes_per_instance) {};
 #endif
 
     ~ExchangeSinkBuffer() override = default;
@@ -316,6 +326,11 @@ private:
 
     Status _send_rpc(RpcInstance& ins);
 
+    bool _credit_flow_control() const { return _credit_bytes_per_instance > 0; }
+    // Both must be called with the lock of `ins` held.
+    void _spend_credits(RpcInstance& ins, int64_t bytes);
+    void _grant_credits(RpcInstance& ins, int64_t bytes, bool turn_off = false);
+
 #ifndef BE_TEST
     inline void _ended(RpcInstance& ins);
     inline void _failed(InstanceLoId id, const std::string& err);
@@ -343,6 +358,15 @@ private:
     // The ExchangeSinkLocalState in _parents is only used in _turn_off_channel.
     std::vector<ExchangeSinkLocalState*> _parents;
     const int64_t _exchange_sink_num;
+
+    // Credits granted to every rpc_channel, see config::exchange_sink_credit_bytes_per_instance.
+    int64_t _credit_bytes_per_instance = 0;
+    // Protected by `_m`. The exchange sinks are blocked while any rpc_channel is starved.
+    int _credit_starved_instances = 0;
+    int64_t _credit_starved_count = 0;
+    int64_t _credit_starved_start_ns = 0;
+    int64_t _credit_starved_time_ns = 0;
+
     bool _send_multi_blocks = false;
     int _send_multi_blocks_byte_size = 256 * 1024;
 };
@@ -120,9 +120,15 @@ Status ExchangeSinkLocalState::init(RuntimeState* state, LocalSinkStateInfo& inf
 
     if (_part_type == TPartitionType::HASH_PARTITIONED) {
         _partition_count = channels.size();
-        _partitioner =
+        auto partitioner =
                 std::make_unique<vectorized::Crc32HashPartitioner<vectorized::ShuffleChannelIds>>(
                         channels.size());
+        if (config::enable_exchange_skew_detection && channels.size() > 1) {
+            _skew_sketch =
+                    std::make_unique<vectorized::HeavyHitterSketch>(SKEW_SKETCH_CAPACITY);
+            partitioner->set_skew_sketch(_skew_sketch.get());
+        }
+        _partitioner = std::move(partitioner);
         RETURN_IF_ERROR(_partitioner->init(p._texprs));
         RETURN_IF_ERROR(_partitioner->prepare(state, p._row_desc));
         custom_profile()->add_info_string(
@@ -570,9 +576,30 @@ Status ExchangeSinkLocalState::close(RuntimeState* state, Status exec_status) {
         _sink_buffer->update_profile(custom_profile());
         _sink_buffer->close();
     }
+    if (_skew_sketch) {
+        _report_skew();
+    }
     return Base::close(state, exec_status);
 }
 
+void ExchangeSinkLocalState::_report_skew() {
+    // A key holding more than 1 / channels of the rows overloads its instance on its own.
+    const auto hot_keys = _skew_sketch->heavy_hitters(1.0 / static_cast<double>(channels.size()));
+    auto* hot_key_counter = ADD_COUNTER(custom_profile(), "HotPartitionKeys", TUnit::UNIT);
+    COUNTER_SET(hot_key_counter, static_cast<int64_t>(hot_keys.size()));
+    if (hot_keys.empty()) {
+        return;
+    }
+    fmt::memory_buffer buffer;
+    for (const auto& key : hot_keys) {
+        fmt::format_to(buffer, "{}hash {:#x} -> channel {}: {:.1f}%", buffer.size() ? ", " : "",
+                       key.value, key.value % channels.size(),
+                       100.0 * static_cast<double>(key.count) /
+                               static_cast<double>(_skew_sketch->total()));
+    }
+    custom_profile()->add_info_string("HotPartitionKeyShares", fmt::to_string(buffer));
+}
+
 std::shared_ptr<ExchangeSinkBuffer> ExchangeSinkOperatorX::_create_buffer(
         RuntimeState* state, const std::vector<InstanceLoId>& sender_ins_ids) {
     PUniqueId id;
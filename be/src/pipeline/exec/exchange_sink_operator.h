@@ -27,6 +27,7 @@
 #include "exchange_sink_buffer.h"
 #include "operator.h"
 #include "pipeline/shuffle/writer.h"
+#include "vec/runtime/heavy_hitter_sketch.h"
 #include "vec/sink/scale_writer_partitioning_exchanger.hpp"
 #include "vec/sink/vdata_stream_sender.h"
 
@@ -116,6 +117,7 @@ private:
     friend class vectorized::BlockSerializer;
 
     MOCK_FUNCTION void _create_channels();
+    void _report_skew();
 
     std::shared_ptr<ExchangeSinkBuffer> _sink_buffer = nullptr;
     RuntimeProfile::Counter* _serialize_batch_timer = nullptr;
@@ -167,6 +169,9 @@ private:
      */
     std::vector<std::shared_ptr<Dependency>> _local_channels_dependency;
     std::unique_ptr<vectorized::PartitionerBase> _partitioner;
+    // Hot partition keys of hash shuffle, only set if enable_exchange_skew_detection is true.
+    static constexpr size_t SKEW_SKETCH_CAPACITY = 64;
+    std::unique_ptr<vectorized::HeavyHitterSketch> _skew_sketch;
     std::unique_ptr<Writer> _writer;
     size_t _partition_count;
 
@@ -20,6 +20,7 @@
 #include <cstdlib>
 #include <string>
 
+#include "common/config.h"
 #include "pipeline/exec/hashjoin_probe_operator.h"
 #include "pipeline/exec/operator.h"
 #include "pipeline/pipeline_task.h"
@@ -79,6 +80,7 @@ Status HashJoinBuildSinkLocalState::init(RuntimeState* state, LocalSinkStateInfo
             ADD_COUNTER_WITH_LEVEL(custom_profile(), "MemoryUsageHashTable", TUnit::BYTES, 1);
     _build_arena_memory_usage =
             ADD_COUNTER_WITH_LEVEL(custom_profile(), "MemoryUsageBuildKeyArena", TUnit::BYTES, 1);
+    _hash_table_partition_num = ADD_COUNTER(custom_profile(), "HashTablePartitionNum", TUnit::UNIT);
 
     // Build phase
     auto* record_profile = _should_build_hash_table ? custom_profile() : faker_runtime_profile();
@@ -108,7 +110,9 @@ Status HashJoinBuildSinkLocalState::terminate(RuntimeState* state) {
     if (_terminated) {
         return Status::OK();
     }
-    RETURN_IF_ERROR(_runtime_filter_producer_helper->terminate(state));
+    if (!_finished_with_shared_hash_table) {
+        RETURN_IF_ERROR(_runtime_filter_producer_helper->terminate(state));
+    }
     return JoinBuildSinkLocalState::terminate(state);
 }
 
@@ -234,7 +238,8 @@ Status HashJoinBuildSinkLocalState::close(RuntimeState* state, Status exec_statu
     }};
 
     try {
-        if (!_terminated && _runtime_filter_producer_helper && !state->is_cancelled()) {
+        if (!_terminated && !_finished_with_shared_hash_table && _runtime_filter_producer_helper &&
+            !state->is_cancelled()) {
             RETURN_IF_ERROR(_runtime_filter_producer_helper->build(
                     state, _shared_state->build_block.get(), p._use_shared_hash_table,
                     p._runtime_filters));
@@ -636,6 +641,19 @@ Status HashJoinBuildSinkOperatorX::sink(RuntimeState* state, vectorized::Block*
                 local_state._shared_state->hash_table_variant_vector[local_state._task_idx]
                         ->method_variant,
                 local_state._shared_state->hash_table_variant_vector.front()->method_variant);
+
+        if (!eos && config::enable_broadcast_join_early_finish) {
+            // The rest of the input is the same broadcast data the shared hash table was built
+            // from, so finish now instead of receiving it. Runtime filters are published here the
+            // same way `close` does, because terminating would disable the shared ones.
+            RETURN_IF_ERROR(local_state._runtime_filter_producer_helper->build(
+                    state, local_state._shared_state->build_block.get(), _use_shared_hash_table,
+                    _runtime_filters));
+            RETURN_IF_ERROR(local_state._runtime_filter_producer_helper->publish(state));
+            local_state._finished_with_shared_hash_table = true;
+            local_state._dependency->set_ready_to_read(local_state._task_idx);
+            return Status::Error<ErrorCode::END_OF_FILE>("shared hash table is ready");
+        }
     }
 
     if (eos) {
@@ -70,6 +70,9 @@ protected:
     std::vector<vectorized::ColumnPtr> _key_columns_holder;
 
     bool _should_build_hash_table = true;
+    // Set if this task got the shared hash table and published its runtime filters before its
+    // input was exhausted, see `HashJoinBuildSinkOperatorX::sink`.
+    bool _finished_with_shared_hash_table = false;
 
     size_t _evaluate_mem_usage = 0;
     size_t _build_side_rows = 0;
@@ -96,6 +99,7 @@ protected:
     RuntimeProfile::Counter* _build_blocks_memory_usage = nullptr;
     RuntimeProfile::Counter* _hash_table_memory_usage = nullptr;
     RuntimeProfile::Counter* _build_arena_memory_usage = nullptr;
+    RuntimeProfile::Counter* _hash_table_partition_num = nullptr;
 };
 
 class HashJoinBuildSinkOperatorX MOCK_REMOVE(final)
@@ -204,6 +208,10 @@ struct ProcessHashTableBuild {
         }
 
         SCOPED_TIMER(_parent->_build_table_insert_timer);
+        hash_table_ctx.hash_table->set_radix_partition_bytes(
+                config::hash_join_radix_partition_bytes);
+        hash_table_ctx.hash_table->set_probe_prefetch(config::enable_hash_join_probe_prefetch);
+        hash_table_ctx.hash_table->set_direct_mapping(config::enable_hash_join_direct_mapping);
         hash_table_ctx.hash_table->template prepare_build<JoinOpType>(_rows, _batch_size,
                                                                       *has_null_key);
 
@@ -240,6 +248,8 @@ struct ProcessHashTableBuild {
 
         COUNTER_SET(_parent->_hash_table_memory_usage,
                     (int64_t)hash_table_ctx.hash_table->get_byte_size());
+        COUNTER_SET(_parent->_hash_table_partition_num,
+                    (int64_t)hash_table_ctx.hash_table->get_partition_num());
         COUNTER_SET(_parent->_build_arena_memory_usage,
                     (int64_t)hash_table_ctx.serialized_keys_size(true));
         return Status::OK();
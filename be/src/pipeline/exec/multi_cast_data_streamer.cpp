@@ -49,6 +49,7 @@ MultiCastBlock::MultiCastBlock(vectorized::Block* block, int un_finish_copy, siz
 Status MultiCastDataStreamer::pull(RuntimeState* state, int sender_idx, vectorized::Block* block,
                                    bool* eos) {
     MultiCastBlock* multi_cast_block = nullptr;
+    bool take_over = false;
     {
         INJECT_MOCK_SLEEP(std::lock_guard l(_mutex));
         for (auto it = _spill_readers[sender_idx].begin();
@@ -140,7 +141,14 @@ Status MultiCastDataStreamer::pull(RuntimeState* state, int sender_idx, vectoriz
 
         DCHECK_GT(pos_to_pull->_un_finish_copy, 0);
         DCHECK_LE(pos_to_pull->_un_finish_copy, _cast_sender_count);
-        *block = *pos_to_pull->_block;
+        // A reader only counts down after its copy is done, so the last reader of a block is
+        // its only user and takes it over instead of copying it once more.
+        take_over = pos_to_pull->_un_finish_copy == 1;
+        if (take_over) {
+            *block = std::move(*pos_to_pull->_block);
+        } else {
+            *block = *pos_to_pull->_block;
+        }
 
         multi_cast_block = &(*pos_to_pull);
         _copying_count.fetch_add(1);
@@ -153,15 +161,18 @@ Status MultiCastDataStreamer::pull(RuntimeState* state, int sender_idx, vectoriz
         }
     }
 
-    return _copy_block(state, sender_idx, block, *multi_cast_block);
+    return _copy_block(state, sender_idx, block, *multi_cast_block, take_over);
 }
 
 Status MultiCastDataStreamer::_copy_block(RuntimeState* state, int32_t sender_idx,
                                           vectorized::Block* block,
-                                          MultiCastBlock& multi_cast_block) {
-    const auto rows = block->rows();
-    for (int i = 0; i < block->columns(); ++i) {
-        block->get_by_position(i).column = block->get_by_position(i).column->clone_resized(rows);
+                                          MultiCastBlock& multi_cast_block, bool take_over) {
+    if (!take_over) {
+        const auto rows = block->rows();
+        for (int i = 0; i < block->columns(); ++i) {
+            block->get_by_position(i).column =
+                    block->get_by_position(i).column->clone_resized(rows);
+        }
     }
 
     INJECT_MOCK_SLEEP(std::lock_guard l(_mutex));
@@ -170,6 +181,9 @@ Status MultiCastDataStreamer::_copy_block(RuntimeState* state, int32_t sender_id
     if (multi_cast_block._un_finish_copy == 0) {
         DCHECK_EQ(_multi_cast_blocks.front()._un_finish_copy, 0);
         DCHECK_EQ(&(_multi_cast_blocks.front()), &multi_cast_block);
+        // The slowest reader has passed this block, so it no longer counts against the spill
+        // threshold.
+        _cumulative_mem_size -= multi_cast_block._mem_size;
         _multi_cast_blocks.pop_front();
         _write_dependency->set_ready();
     } else if (copying_count == 0) {
@@ -317,7 +331,9 @@ Status MultiCastDataStreamer::push(RuntimeState* state, doris::vectorized::Block
             }
         }
 
-        _cumulative_mem_size += block_mem_size;
+        if (rows > 0) {
+            _cumulative_mem_size += block_mem_size;
+        }
         COUNTER_SET(_peak_mem_usage,
                     std::max(_cumulative_mem_size.load(), _peak_mem_usage->value()));
 
@@ -105,6 +105,9 @@ public:
         _source_operator_profiles[sender_idx] = profile;
     }
 
+    // Bytes of the blocks held in memory that some reader has not pulled yet.
+    int64_t buffered_mem_size() const { return _cumulative_mem_size.load(); }
+
     std::string debug_string();
 
 private:
@@ -112,7 +115,7 @@ private:
     void _block_reading(int sender_idx);
 
     Status _copy_block(RuntimeState* state, int32_t sender_idx, vectorized::Block* block,
-                       MultiCastBlock& multi_cast_block);
+                       MultiCastBlock& multi_cast_block, bool take_over);
 
     Status _submit_spill_task(RuntimeState* state, vectorized::SpillStreamSPtr spill_stream);
 
@@ -17,13 +17,20 @@
 
 #include "nested_loop_join_probe_operator.h"
 
+#include <algorithm>
+#include <functional>
 #include <memory>
 
 #include "common/cast_set.h"
+#include "common/config.h"
 #include "common/exception.h"
 #include "pipeline/exec/operator.h"
+#include "vec/columns/column_const.h"
 #include "vec/columns/column_filter_helper.h"
+#include "vec/columns/column_nullable.h"
 #include "vec/core/block.h"
+#include "vec/data_types/data_type_nullable.h"
+#include "vec/exprs/vslot_ref.h"
 
 namespace doris {
 class RuntimeState;
@@ -47,6 +54,8 @@ Status NestedLoopJoinProbeLocalState::init(RuntimeState* state, LocalStateInfo&
     _update_visited_flags_timer = ADD_TIMER(custom_profile(), "UpdateVisitedFlagsTime");
     _join_conjuncts_evaluation_timer = ADD_TIMER(custom_profile(), "JoinConjunctsEvaluationTime");
     _filtered_by_join_conjuncts_timer = ADD_TIMER(custom_profile(), "FilteredByJoinConjunctsTime");
+    _build_band_index_timer = ADD_TIMER(custom_profile(), "BuildBandIndexTime");
+    _band_skipped_rows_counter = ADD_COUNTER(custom_profile(), "BandSkippedRows", TUnit::UNIT);
     return Status::OK();
 }
 
@@ -101,6 +110,9 @@ Status NestedLoopJoinProbeLocalState::generate_join_block_data(RuntimeState* sta
     DCHECK(!_need_more_input_data || !_matched_rows_done);
 
     if (!_matched_rows_done && !_need_more_input_data) {
+        if (p._band_key_column >= 0 && !_band_indexes_built) {
+            _build_band_indexes();
+        }
         // We should try to join rows if there still are some rows from probe side.
         // _probe_offset_stack and _build_offset_stack use u16 for storage
         // because on the FE side, it is guaranteed that the batch size will not exceed 65535 (the maximum value for u16).s
@@ -137,7 +149,17 @@ Status NestedLoopJoinProbeLocalState::generate_join_block_data(RuntimeState* sta
             if constexpr (set_build_side_flag) {
                 _build_offset_stack.push(cast_set<uint16_t, size_t, false>(_join_block.rows()));
             }
-            _process_left_child_block(_join_block, now_process_build_block);
+            if (p._band_key_column >= 0) {
+                const auto& index = _band_indexes[_current_build_pos - 1];
+                auto [begin, end] = _band_matched_range(index);
+                COUNTER_UPDATE(_band_skipped_rows_counter,
+                               cast_set<int64_t>(now_process_build_block.rows() - (end - begin)));
+                _process_left_child_band_rows(_join_block, now_process_build_block,
+                                              index.sorted_rows.data() + begin,
+                                              index.sorted_rows.data() + end);
+            } else {
+                _process_left_child_block(_join_block, now_process_build_block);
+            }
         }
 
         {
@@ -340,6 +362,35 @@ void NestedLoopJoinProbeLocalState::_process_left_child_block(
     auto& p = _parent->cast<NestedLoopJoinProbeOperatorX>();
     auto dst_columns = block.mutate_columns();
     const size_t max_added_rows = now_process_build_block.rows();
+    _append_probe_row(dst_columns, max_added_rows);
+    for (size_t i = 0; i < p._num_build_side_columns; ++i) {
+        const vectorized::ColumnWithTypeAndName& src_column =
+                now_process_build_block.get_by_position(i);
+        if (!src_column.column->is_nullable() &&
+            dst_columns[p._num_probe_side_columns + i]->is_nullable()) {
+            auto origin_sz = dst_columns[p._num_probe_side_columns + i]->size();
+            DCHECK(p._join_op == TJoinOp::LEFT_OUTER_JOIN ||
+                   p._join_op == TJoinOp::FULL_OUTER_JOIN);
+            assert_cast<vectorized::ColumnNullable*>(
+                    dst_columns[p._num_probe_side_columns + i].get())
+                    ->get_nested_column_ptr()
+                    ->insert_range_from(*src_column.column.get(), 0, max_added_rows);
+            assert_cast<vectorized::ColumnNullable*>(
+                    dst_columns[p._num_probe_side_columns + i].get())
+                    ->get_null_map_column()
+                    .get_data()
+                    .resize_fill(origin_sz + max_added_rows, 0);
+        } else {
+            dst_columns[p._num_probe_side_columns + i]->insert_range_from(*src_column.column.get(),
+                                                                          0, max_added_rows);
+        }
+    }
+    block.set_columns(std::move(dst_columns));
+}
+
+void NestedLoopJoinProbeLocalState::_append_probe_row(vectorized::MutableColumns& dst_columns,
+                                                      size_t max_added_rows) const {
+    auto& p = _parent->cast<NestedLoopJoinProbeOperatorX>();
     for (size_t i = 0; i < p._num_probe_side_columns; ++i) {
         const vectorized::ColumnWithTypeAndName& src_column = _child_block->get_by_position(i);
         if (!src_column.column->is_nullable() && dst_columns[i]->is_nullable()) {
@@ -358,31 +409,211 @@ void NestedLoopJoinProbeLocalState::_process_left_child_block(
             dst_columns[i]->insert_many_from(*src_column.column, _left_block_pos, max_added_rows);
         }
     }
+}
+
+void NestedLoopJoinProbeLocalState::_process_left_child_band_rows(
+        vectorized::Block& block, const vectorized::Block& now_process_build_block,
+        const uint32_t* rows_begin, const uint32_t* rows_end) const {
+    if (rows_begin == rows_end) {
+        return;
+    }
+    SCOPED_TIMER(_output_temp_blocks_timer);
+    auto& p = _parent->cast<NestedLoopJoinProbeOperatorX>();
+    auto dst_columns = block.mutate_columns();
+    const auto max_added_rows = static_cast<size_t>(rows_end - rows_begin);
+    _append_probe_row(dst_columns, max_added_rows);
     for (size_t i = 0; i < p._num_build_side_columns; ++i) {
         const vectorized::ColumnWithTypeAndName& src_column =
                 now_process_build_block.get_by_position(i);
-        if (!src_column.column->is_nullable() &&
-            dst_columns[p._num_probe_side_columns + i]->is_nullable()) {
-            auto origin_sz = dst_columns[p._num_probe_side_columns + i]->size();
-            DCHECK(p._join_op == TJoinOp::LEFT_OUTER_JOIN ||
-                   p._join_op == TJoinOp::FULL_OUTER_JOIN);
-            assert_cast<vectorized::ColumnNullable*>(
-                    dst_columns[p._num_probe_side_columns + i].get())
-                    ->get_nested_column_ptr()
-                    ->insert_range_from(*src_column.column.get(), 0, max_added_rows);
-            assert_cast<vectorized::ColumnNullable*>(
-                    dst_columns[p._num_probe_side_columns + i].get())
-                    ->get_null_map_column()
-                    .get_data()
-                    .resize_fill(origin_sz + max_added_rows, 0);
+        auto& dst_column = dst_columns[p._num_probe_side_columns + i];
+        if (!src_column.column->is_nullable() && dst_column->is_nullable()) {
+            auto origin_sz = dst_column->size();
+            auto* nullable_column = assert_cast<vectorized::ColumnNullable*>(dst_column.get());
+            nullable_column->get_nested_column_ptr()->insert_indices_from(*src_column.column,
+                                                                           rows_begin, rows_end);
+            nullable_column->get_null_map_column().get_data().resize_fill(
+                    origin_sz + max_added_rows, 0);
         } else {
-            dst_columns[p._num_probe_side_columns + i]->insert_range_from(*src_column.column.get(),
-                                                                          0, max_added_rows);
+            dst_column->insert_indices_from(*src_column.column, rows_begin, rows_end);
         }
     }
     block.set_columns(std::move(dst_columns));
 }
 
+namespace {
+// Returns the column without const and nullable wrappers, and the null map if it is nullable.
+// `full_column` holds the converted column so that the null map stays valid.
+vectorized::ColumnPtr band_nested_column(const vectorized::ColumnPtr& column,
+                                         vectorized::ColumnPtr& full_column,
+                                         const vectorized::NullMap** null_map) {
+    full_column = column->convert_to_full_column_if_const();
+    if (const auto* nullable = check_and_get_column<vectorized::ColumnNullable>(*full_column)) {
+        *null_map = &nullable->get_null_map_data();
+        return nullable->get_nested_column_ptr();
+    }
+    *null_map = nullptr;
+    return full_column;
+}
+
+// Returns the first position in [0, n) where `pred` is false, `pred` must hold for a prefix
+template <typename Pred>
+size_t band_partition_point(size_t n, Pred&& pred) {
+    size_t low = 0;
+    size_t high = n;
+    while (low < high) {
+        size_t mid = low + (high - low) / 2;
+        if (pred(mid)) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    return low;
+}
+} // namespace
+
+void NestedLoopJoinProbeLocalState::_build_band_indexes() {
+    SCOPED_TIMER(_build_band_index_timer);
+    auto& p = _parent->cast<NestedLoopJoinProbeOperatorX>();
+    // prefix max of the other column if the key is bounded from above, suffix min otherwise
+    const bool other_prefix_max = p._band_key_upper.probe_column >= 0;
+    _band_indexes.resize(_shared_state->build_blocks.size());
+    for (size_t i = 0; i < _band_indexes.size(); ++i) {
+        const auto& build_block = _shared_state->build_blocks[i];
+        auto& index = _band_indexes[i];
+        vectorized::ColumnPtr full_key_column;
+        vectorized::ColumnPtr full_other_column;
+        const vectorized::NullMap* key_null_map = nullptr;
+        const vectorized::NullMap* other_null_map = nullptr;
+        const auto& key_src = build_block.get_by_position(static_cast<size_t>(p._band_key_column));
+        index.key_column = band_nested_column(key_src.column, full_key_column, &key_null_map);
+        if (p._band_other_column >= 0) {
+            const auto& other_src =
+                    build_block.get_by_position(static_cast<size_t>(p._band_other_column));
+            index.other_column =
+                    band_nested_column(other_src.column, full_other_column, &other_null_map);
+        }
+
+        // a comparison with null never matches, so rows with null band columns are skipped
+        auto& sorted_rows = index.sorted_rows;
+        const auto rows = cast_set<uint32_t>(build_block.rows());
+        sorted_rows.reserve(rows);
+        for (uint32_t row = 0; row < rows; ++row) {
+            if ((key_null_map && (*key_null_map)[row]) ||
+                (other_null_map && (*other_null_map)[row])) {
+                continue;
+            }
+            sorted_rows.push_back(row);
+        }
+        const auto& key_column = *index.key_column;
+        std::sort(sorted_rows.begin(), sorted_rows.end(), [&](uint32_t lhs, uint32_t rhs) {
+            return key_column.compare_at(lhs, rhs, key_column, 1) < 0;
+        });
+
+        if (index.other_column == nullptr || sorted_rows.empty()) {
+            continue;
+        }
+        const auto& other_column = *index.other_column;
+        auto& extreme_rows = index.other_extreme_rows;
+        const size_t n = sorted_rows.size();
+        extreme_rows.resize(n);
+        if (other_prefix_max) {
+            extreme_rows[0] = sorted_rows[0];
+            for (size_t j = 1; j < n; ++j) {
+                extreme_rows[j] =
+                        other_column.compare_at(sorted_rows[j], extreme_rows[j - 1], other_column,
+                                                1) > 0
+                                ? sorted_rows[j]
+                                : extreme_rows[j - 1];
+            }
+        } else {
+            extreme_rows[n - 1] = sorted_rows[n - 1];
+            for (size_t j = n - 1; j > 0; --j) {
+                extreme_rows[j - 1] =
+                        other_column.compare_at(sorted_rows[j - 1], extreme_rows[j], other_column,
+                                                1) < 0
+                                ? sorted_rows[j - 1]
+                                : extreme_rows[j];
+            }
+        }
+    }
+    _band_indexes_built = true;
+}
+
+std::pair<size_t, size_t> NestedLoopJoinProbeLocalState::_band_matched_range(
+        const BandIndex& index) const {
+    auto& p = _parent->cast<NestedLoopJoinProbeOperatorX>();
+    const auto& rows = index.sorted_rows;
+    const size_t n = rows.size();
+    size_t begin = 0;
+    size_t end = n;
+
+    const vectorized::IColumn* probe_column = nullptr;
+    size_t probe_row = 0;
+    // returns false if the probe value is null, which matches nothing
+    auto set_probe_value = [&](int column_id) {
+        const auto& [column, is_const] =
+                vectorized::unpack_if_const(
+                _child_block->get_by_position(static_cast<size_t>(column_id)).column);
+        probe_row = is_const ? 0 : static_cast<size_t>(_left_block_pos);
+        probe_column = column.get();
+        if (const auto* nullable = check_and_get_column<vectorized::ColumnNullable>(probe_column)) {
+            if (nullable->is_null_at(probe_row)) {
+                return false;
+            }
+            probe_column = &nullable->get_nested_column();
+        }
+        return true;
+    };
+    auto compare = [&](const vectorized::IColumn& build_column, uint32_t build_row) {
+        return build_column.compare_at(build_row, probe_row, *probe_column, 1);
+    };
+
+    if (p._band_key_lower.probe_column >= 0) {
+        if (!set_probe_value(p._band_key_lower.probe_column)) {
+            return {0, 0};
+        }
+        const bool strict = p._band_key_lower.strict;
+        begin = band_partition_point(n, [&](size_t i) {
+            int res = compare(*index.key_column, rows[i]);
+            return strict ? res <= 0 : res < 0;
+        });
+    }
+    if (p._band_key_upper.probe_column >= 0) {
+        if (!set_probe_value(p._band_key_upper.probe_column)) {
+            return {0, 0};
+        }
+        const bool strict = p._band_key_upper.strict;
+        end = band_partition_point(n, [&](size_t i) {
+            int res = compare(*index.key_column, rows[i]);
+            return strict ? res < 0 : res <= 0;
+        });
+    }
+    if (p._band_other_column >= 0 && begin < end) {
+        if (!set_probe_value(p._band_other_bound.probe_column)) {
+            return {0, 0};
+        }
+        const bool strict = p._band_other_bound.strict;
+        const auto& extreme_rows = index.other_extreme_rows;
+        if (p._band_key_upper.probe_column >= 0) {
+            // the other column is bounded from below, no row before the point where its prefix
+            // max reaches the probe value can match
+            begin = std::max(begin, band_partition_point(n, [&](size_t i) {
+                                 int res = compare(*index.other_column, extreme_rows[i]);
+                                 return strict ? res <= 0 : res < 0;
+                             }));
+        } else {
+            // the other column is bounded from above, no row after the point where its suffix
+            // min exceeds the probe value can match
+            end = std::min(end, band_partition_point(n, [&](size_t i) {
+                               int res = compare(*index.other_column, extreme_rows[i]);
+                               return strict ? res < 0 : res <= 0;
+                           }));
+        }
+    }
+    return {begin, std::max(begin, end)};
+}
+
 NestedLoopJoinProbeOperatorX::NestedLoopJoinProbeOperatorX(ObjectPool* pool, const TPlanNode& tnode,
                                                            int operator_id,
                                                            const DescriptorTbl& descs)
@@ -417,9 +648,108 @@ Status NestedLoopJoinProbeOperatorX::prepare(RuntimeState* state) {
     }
     _num_probe_side_columns = _child->row_desc().num_materialized_slots();
     _num_build_side_columns = _build_side_child->row_desc().num_materialized_slots();
+    _init_band_predicates();
     return vectorized::VExpr::open(_join_conjuncts, state);
 }
 
+void NestedLoopJoinProbeOperatorX::_init_band_predicates() {
+    // The band index only joins a probe row with part of each build block, which does not fit
+    // the visited flags of build side. Null aware and mark join need the comparisons with null.
+    if (!config::enable_nested_loop_join_band_index || _match_all_build || _is_right_semi_anti ||
+        _is_mark_join || _join_op == TJoinOp::NULL_AWARE_LEFT_ANTI_JOIN) {
+        return;
+    }
+
+    struct Comparison {
+        int build_column;
+        int probe_column;
+        // `build >= probe` or `build > probe`
+        bool build_is_lower;
+        bool strict;
+    };
+    std::vector<Comparison> comparisons;
+    const auto num_probe_side_columns = cast_set<int>(_num_probe_side_columns);
+    std::function<void(const vectorized::VExprSPtr&)> collect =
+            [&](const vectorized::VExprSPtr& expr) {
+                if (expr->is_and_expr()) {
+                    for (const auto& child : expr->children()) {
+                        collect(child);
+                    }
+                    return;
+                }
+                if (expr->node_type() != TExprNodeType::BINARY_PRED ||
+                    expr->get_num_children() != 2) {
+                    return;
+                }
+                const auto& fn_name = expr->fn().name.function_name;
+                const bool is_less = fn_name == "lt" || fn_name == "le";
+                if (!is_less && fn_name != "gt" && fn_name != "ge") {
+                    return;
+                }
+                const auto& left = expr->children()[0];
+                const auto& right = expr->children()[1];
+                if (!left->is_slot_ref() || !right->is_slot_ref()) {
+                    return;
+                }
+                auto type = vectorized::remove_nullable(left->data_type());
+                if (!type->equals(*vectorized::remove_nullable(right->data_type()))) {
+                    return;
+                }
+                // float columns are excluded for NaN, complex columns are not ordered
+                const auto primitive_type = type->get_primitive_type();
+                if (!is_int_or_bool(primitive_type) && !is_decimal(primitive_type) &&
+                    !is_date_or_datetime(primitive_type) &&
+                    !is_date_v2_or_datetime_v2(primitive_type) && !is_ip(primitive_type) &&
+                    !is_string_type(primitive_type)) {
+                    return;
+                }
+                int left_column = assert_cast<const vectorized::VSlotRef*>(left.get())->column_id();
+                int right_column =
+                        assert_cast<const vectorized::VSlotRef*>(right.get())->column_id();
+                const bool left_is_probe = left_column < num_probe_side_columns;
+                if (left_is_probe == (right_column < num_probe_side_columns)) {
+                    return;
+                }
+                int build_column = left_is_probe ? right_column : left_column;
+                comparisons.push_back({.build_column = build_column - num_probe_side_columns,
+                                       .probe_column = left_is_probe ? left_column : right_column,
+                                       .build_is_lower = left_is_probe == is_less,
+                                       .strict = fn_name == "lt" || fn_name == "gt"});
+            };
+    for (const auto& conjunct : _join_conjuncts) {
+        collect(conjunct->root());
+    }
+    if (comparisons.empty()) {
+        return;
+    }
+
+    _band_key_column = comparisons[0].build_column;
+    for (const auto& comparison : comparisons) {
+        if (comparison.build_column != _band_key_column) {
+            continue;
+        }
+        auto& bound = comparison.build_is_lower ? _band_key_lower : _band_key_upper;
+        if (bound.probe_column < 0) {
+            bound = {.probe_column = comparison.probe_column, .strict = comparison.strict};
+        }
+    }
+    // Only a key bounded on one side can use the other column, e.g. `start <= a.ts` with
+    // `end >= a.ts`.
+    if ((_band_key_lower.probe_column < 0) == (_band_key_upper.probe_column < 0)) {
+        return;
+    }
+    const bool other_is_lower = _band_key_upper.probe_column >= 0;
+    for (const auto& comparison : comparisons) {
+        if (comparison.build_column != _band_key_column &&
+            comparison.build_is_lower == other_is_lower) {
+            _band_other_column = comparison.build_column;
+            _band_other_bound = {.probe_column = comparison.probe_column,
+                                 .strict = comparison.strict};
+            break;
+        }
+    }
+}
+
 bool NestedLoopJoinProbeOperatorX::need_more_input_data(RuntimeState* state) const {
     auto& local_state =
             state->get_local_state(operator_id())->cast<NestedLoopJoinProbeLocalState>();
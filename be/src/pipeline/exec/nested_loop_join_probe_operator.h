@@ -20,6 +20,8 @@
 #include <stdint.h>
 
 #include <cstdint>
+#include <utility>
+#include <vector>
 
 #include "common/cast_set.h"
 #include "common/status.h"
@@ -58,8 +60,27 @@ private:
     void _finalize_current_phase(vectorized::Block& block, size_t batch_size);
     void _reset_with_next_probe_row();
     void _append_left_data_with_null(vectorized::Block& block) const;
+    void _append_probe_row(vectorized::MutableColumns& dst_columns, size_t max_added_rows) const;
     void _process_left_child_block(vectorized::Block& block,
                                    const vectorized::Block& now_process_build_block) const;
+    // Same as above, but only joins the build rows in [rows_begin, rows_end)
+    void _process_left_child_band_rows(vectorized::Block& block,
+                                       const vectorized::Block& now_process_build_block,
+                                       const uint32_t* rows_begin, const uint32_t* rows_end) const;
+
+    // Build rows of one build block sorted by the band key column
+    struct BandIndex {
+        vectorized::ColumnPtr key_column;
+        vectorized::ColumnPtr other_column;
+        // rows whose band columns are not null, sorted by the key column
+        std::vector<uint32_t> sorted_rows;
+        // the row holding the max (or min) of the other column over sorted_rows[0, i] (or
+        // sorted_rows[i, n)), which is monotonic and can be binary searched as well
+        std::vector<uint32_t> other_extreme_rows;
+    };
+    void _build_band_indexes();
+    // Returns the range of `index.sorted_rows` that may match the current probe row
+    std::pair<size_t, size_t> _band_matched_range(const BandIndex& index) const;
     template <typename Filter, bool SetBuildSideFlag, bool SetProbeSideFlag>
     void _do_filtering_and_update_visited_flags_impl(vectorized::Block* block,
                                                      uint32_t column_to_keep,
@@ -172,6 +193,10 @@ private:
             if (!materialize) {
                 CLEAR_BLOCK
             }
+        } else if constexpr (SetProbeSideFlag) {
+            // the band index may skip all build rows of the processed probe rows
+            std::stack<uint16_t> empty;
+            _probe_offset_stack.swap(empty);
         }
         vectorized::Block::erase_useless_column(block, column_to_keep);
         return Status::OK();
@@ -190,12 +215,16 @@ private:
     std::stack<uint16_t> _probe_offset_stack;
     uint64_t _output_null_idx_build_side = 0;
     vectorized::VExprContextSPtrs _join_conjuncts;
+    bool _band_indexes_built = false;
+    std::vector<BandIndex> _band_indexes;
 
     RuntimeProfile::Counter* _loop_join_timer = nullptr;
     RuntimeProfile::Counter* _output_temp_blocks_timer = nullptr;
     RuntimeProfile::Counter* _update_visited_flags_timer = nullptr;
     RuntimeProfile::Counter* _join_conjuncts_evaluation_timer = nullptr;
     RuntimeProfile::Counter* _filtered_by_join_conjuncts_timer = nullptr;
+    RuntimeProfile::Counter* _build_band_index_timer = nullptr;
+    RuntimeProfile::Counter* _band_skipped_rows_counter = nullptr;
 };
 
 class NestedLoopJoinProbeOperatorX final
@@ -232,7 +261,26 @@ public:
 
 private:
     friend class NestedLoopJoinProbeLocalState;
+
+    // Finds range predicates between a build column and a probe column in join conjuncts
+    void _init_band_predicates();
+
+    struct BandBound {
+        // position of the probe column in probe block, -1 if there is no such bound
+        int probe_column = -1;
+        bool strict = false;
+    };
+
     bool _is_output_left_side_only;
+    // The build column the band index is sorted by, -1 if the join has no band predicates.
+    // Its lower bound means `key >= probe`, and upper bound means `key <= probe`.
+    int _band_key_column = -1;
+    BandBound _band_key_lower;
+    BandBound _band_key_upper;
+    // A second build column bounded on the opposite side, like `end` in
+    // `start <= a.ts AND end >= a.ts`. It narrows the range by the running max (or min) of it.
+    int _band_other_column = -1;
+    BandBound _band_other_bound;
     vectorized::VExprContextSPtrs _join_conjuncts;
     size_t _num_probe_side_columns = 0;
     size_t _num_build_side_columns = 0;
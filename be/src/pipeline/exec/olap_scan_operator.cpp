@@ -156,6 +156,7 @@ Status OlapScanLocalState::_init_profile() {
     _lazy_read_timer = ADD_TIMER(_segment_profile, "LazyReadTime");
     _lazy_read_seek_timer = ADD_TIMER(_segment_profile, "LazyReadSeekTime");
     _lazy_read_seek_counter = ADD_COUNTER(_segment_profile, "LazyReadSeekCount", TUnit::UNIT);
+    _lazy_read_range_counter = ADD_COUNTER(_segment_profile, "LazyReadRangeCount", TUnit::UNIT);
 
     _output_col_timer = ADD_TIMER(_segment_profile, "OutputColumnTime");
 
@@ -613,9 +614,9 @@ Status OlapScanLocalState::prepare(RuntimeState* state) {
     }
 
     for (size_t i = 0; i < _scan_ranges.size(); i++) {
-        RETURN_IF_ERROR(_tablets[i].tablet->capture_rs_readers({0, _tablets[i].version},
-                                                               &_read_sources[i].rs_splits,
-                                                               _state->skip_missing_version()));
+        Version read_version {_start_versions[i], _tablets[i].version};
+        RETURN_IF_ERROR(_tablets[i].tablet->capture_rs_readers(
+                read_version, &_read_sources[i].rs_splits, _state->skip_missing_version()));
         if (!PipelineXLocalState<>::_state->skip_delete_predicate()) {
             _read_sources[i].fill_delete_predicates();
         }
@@ -680,23 +681,23 @@ TOlapScanNode& OlapScanLocalState::olap_scan_node() const {
 
 void OlapScanLocalState::set_scan_ranges(RuntimeState* state,
                                          const std::vector<TScanRangeParams>& scan_ranges) {
-    const auto& cache_param = _parent->cast<OlapScanOperatorX>()._cache_param;
-    bool hit_cache = false;
+    const auto& p = _parent->cast<OlapScanOperatorX>();
+    const auto& cache_param = p._cache_param;
+    std::shared_ptr<QueryCacheLookup> cache_lookup;
     if (!cache_param.digest.empty() && !cache_param.force_refresh_query_cache) {
-        std::string cache_key;
-        int64_t version = 0;
-        auto status = QueryCache::build_cache_key(scan_ranges, cache_param, &cache_key, &version);
+        auto status = QueryCache::instance()->lookup_for_query(
+                state, scan_ranges, cache_param, p._cache_merge_info, &cache_lookup);
         if (!status.ok()) {
             throw doris::Exception(doris::ErrorCode::INTERNAL_ERROR, status.msg());
         }
-        doris::QueryCacheHandle handle;
-        hit_cache = QueryCache::instance()->lookup(cache_key, version, &handle);
     }
 
-    if (!hit_cache) {
+    if (cache_lookup == nullptr || !cache_lookup->hit) {
         for (auto& scan_range : scan_ranges) {
             DCHECK(scan_range.scan_range.__isset.palo_scan_range);
             _scan_ranges.emplace_back(new TPaloScanRange(scan_range.scan_range.palo_scan_range));
+            // on an incremental hit only the rowsets after the cached version are read
+            _start_versions.push_back(cache_lookup ? cache_lookup->delta_start_version : 0);
             COUNTER_UPDATE(_tablet_counter, 1);
         }
     }
@@ -843,10 +844,12 @@ Status OlapScanLocalState::_build_key_ranges_and_filters() {
 
 OlapScanOperatorX::OlapScanOperatorX(ObjectPool* pool, const TPlanNode& tnode, int operator_id,
                                      const DescriptorTbl& descs, int parallel_tasks,
-                                     const TQueryCacheParam& param)
+                                     const TQueryCacheParam& param,
+                                     QueryCacheMergeInfo cache_merge_info)
         : ScanOperatorX<OlapScanLocalState>(pool, tnode, operator_id, descs, parallel_tasks),
           _olap_scan_node(tnode.olap_scan_node),
-          _cache_param(param) {
+          _cache_param(param),
+          _cache_merge_info(std::move(cache_merge_info)) {
     _output_tuple_id = tnode.olap_scan_node.tuple_id;
     if (_olap_scan_node.__isset.sort_info && _olap_scan_node.__isset.sort_limit) {
         _limit_per_scanner = _olap_scan_node.sort_limit;
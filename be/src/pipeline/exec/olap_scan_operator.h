@@ -26,6 +26,7 @@
 #include "olap/tablet_reader.h"
 #include "operator.h"
 #include "pipeline/exec/scan_operator.h"
+#include "pipeline/query_cache/query_cache.h"
 
 namespace doris::vectorized {
 class OlapScanner;
@@ -179,6 +180,7 @@ private:
     RuntimeProfile::Counter* _lazy_read_timer = nullptr;
     RuntimeProfile::Counter* _lazy_read_seek_timer = nullptr;
     RuntimeProfile::Counter* _lazy_read_seek_counter = nullptr;
+    RuntimeProfile::Counter* _lazy_read_range_counter = nullptr;
 
     // total pages read
     // used by segment v2
@@ -242,6 +244,8 @@ private:
     RuntimeProfile::Counter* _segment_load_index_timer = nullptr;
 
     std::vector<TabletWithVersion> _tablets;
+    // first version to read of every scan range, > 0 when the query cache holds the rest
+    std::vector<int64_t> _start_versions;
     std::vector<TabletReader::ReadSource> _read_sources;
 
     std::map<SlotId, vectorized::VExprContextSPtr> _slot_id_to_virtual_column_expr;
@@ -254,12 +258,13 @@ class OlapScanOperatorX final : public ScanOperatorX<OlapScanLocalState> {
 public:
     OlapScanOperatorX(ObjectPool* pool, const TPlanNode& tnode, int operator_id,
                       const DescriptorTbl& descs, int parallel_tasks,
-                      const TQueryCacheParam& cache_param);
+                      const TQueryCacheParam& cache_param, QueryCacheMergeInfo cache_merge_info);
 
 private:
     friend class OlapScanLocalState;
     TOlapScanNode _olap_scan_node;
     TQueryCacheParam _cache_param;
+    QueryCacheMergeInfo _cache_merge_info;
 };
 
 #include "common/compile_check_end.h"
@@ -17,6 +17,7 @@
 
 #include "operator.h"
 
+#include "common/config.h"
 #include "common/status.h"
 #include "pipeline/dependency.h"
 #include "pipeline/exec/aggregation_sink_operator.h"
@@ -86,6 +87,7 @@
 #include "util/string_util.h"
 #include "vec/exprs/vexpr.h"
 #include "vec/exprs/vexpr_context.h"
+#include "vec/exprs/vshared_expr.h"
 #include "vec/utils/util.hpp"
 
 namespace doris {
@@ -239,6 +241,17 @@ Status OperatorXBase::prepare(RuntimeState* state) {
                 vectorized::VExpr::check_expr_output_type(_projections, *_output_row_descriptor));
     }
 
+    if (config::enable_common_expr_reuse) {
+        // scan operators keep their conjunct trees intact for storage push down
+        if (!is_source()) {
+            vectorized::VSharedExpr::share_common_exprs(_conjuncts);
+        }
+        for (auto& projections : _intermediate_projections) {
+            vectorized::VSharedExpr::share_common_exprs(projections);
+        }
+        vectorized::VSharedExpr::share_common_exprs(_projections);
+    }
+
     for (auto& conjunct : _conjuncts) {
         RETURN_IF_ERROR(conjunct->open(state));
     }
@@ -301,8 +314,12 @@ Status OperatorXBase::do_projections(RuntimeState* state, vectorized::Block* ori
     size_t bytes_usage = 0;
     for (const auto& projections : local_state->_intermediate_projections) {
         result_column_ids.resize(projections.size());
-        for (int i = 0; i < projections.size(); i++) {
-            RETURN_IF_ERROR(projections[i]->execute(&input_block, &result_column_ids[i]));
+        {
+            // column ids are only stable until the shuffle below
+            vectorized::VExprResultCache::Scope cache_scope(projections, &input_block);
+            for (int i = 0; i < projections.size(); i++) {
+                RETURN_IF_ERROR(projections[i]->execute(&input_block, &result_column_ids[i]));
+            }
         }
 
         bytes_usage += input_block.allocated_bytes();
@@ -338,6 +355,7 @@ Status OperatorXBase::do_projections(RuntimeState* state, vectorized::Block* ori
         auto& mutable_columns = mutable_block.mutable_columns();
         const size_t origin_columns_count = input_block.columns();
         DCHECK_EQ(mutable_columns.size(), local_state->_projections.size()) << debug_string();
+        vectorized::VExprResultCache::Scope cache_scope(local_state->_projections, &input_block);
         for (int i = 0; i < mutable_columns.size(); ++i) {
             auto result_column_id = -1;
             RETURN_IF_ERROR(local_state->_projections[i]->execute(&input_block, &result_column_id));
@@ -570,7 +588,10 @@ Status PipelineXLocalState<SharedStateArg>::open(RuntimeState* state) {
             RETURN_IF_ERROR(_parent->_intermediate_projections[i][j]->clone(
                     state, _intermediate_projections[i][j]));
         }
+        vectorized::VExprContext::attach_expr_result_cache(_intermediate_projections[i]);
     }
+    vectorized::VExprContext::attach_expr_result_cache(_conjuncts);
+    vectorized::VExprContext::attach_expr_result_cache(_projections);
     return Status::OK();
 }
 
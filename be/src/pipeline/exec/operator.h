@@ -128,6 +128,10 @@ public:
 
     virtual size_t revocable_mem_size(RuntimeState* state) const { return 0; }
 
+    // Relative cpu and io cost of spilling one byte of revocable memory. Memory is revoked
+    // from the cheapest operators first.
+    virtual double revoke_cost_per_byte(RuntimeState* state) const { return 1.0; }
+
     virtual Status revoke_memory(RuntimeState* state,
                                  const std::shared_ptr<SpillContext>& spill_context) {
         return Status::OK();
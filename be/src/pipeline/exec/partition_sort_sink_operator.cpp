@@ -23,13 +23,16 @@
 
 #include "common/status.h"
 #include "partition_sort_source_operator.h"
+#include "pipeline/exec/spill_utils.h"
+#include "util/defer_op.h"
 #include "vec/common/hash_table/hash.h"
+#include "vec/spill/spill_stream_manager.h"
 
 namespace doris::pipeline {
 #include "common/compile_check_begin.h"
 
 Status PartitionSortSinkLocalState::init(RuntimeState* state, LocalSinkStateInfo& info) {
-    RETURN_IF_ERROR(PipelineXSinkLocalState<PartitionSortNodeSharedState>::init(state, info));
+    RETURN_IF_ERROR(Base::init(state, info));
     SCOPED_TIMER(exec_time_counter());
     SCOPED_TIMER(_init_timer);
     auto& p = _parent->cast<PartitionSortSinkOperatorX>();
@@ -54,6 +57,10 @@ Status PartitionSortSinkLocalState::init(RuntimeState* state, LocalSinkStateInfo
             ADD_COUNTER(custom_profile(), "PassThroughRowsCounter", TUnit::UNIT);
     _sorted_partition_input_rows_counter =
             ADD_COUNTER(custom_profile(), "SortedPartitionInputRows", TUnit::UNIT);
+    _spilled_partitions_counter =
+            ADD_COUNTER_WITH_LEVEL(custom_profile(), "SpilledPartitions", TUnit::UNIT, 1);
+    _spill_dependency = Dependency::create_shared(_parent->operator_id(), _parent->node_id(),
+                                                  "PartitionSortSinkSpillDependency", true);
     _partition_sort_info = std::make_shared<PartitionSortInfo>(
             &_vsort_exec_exprs, p._limit, 0, p._pool, p._is_asc_order, p._nulls_first,
             p._child->row_desc(), state, custom_profile(), p._has_global_limit,
@@ -65,6 +72,13 @@ Status PartitionSortSinkLocalState::init(RuntimeState* state, LocalSinkStateInfo
     return Status::OK();
 }
 
+Status PartitionSortSinkLocalState::open(RuntimeState* state) {
+    SCOPED_TIMER(exec_time_counter());
+    SCOPED_TIMER(_open_timer);
+    _shared_state->setup_shared_profile(custom_profile());
+    return Base::open(state);
+}
+
 PartitionSortSinkOperatorX::PartitionSortSinkOperatorX(ObjectPool* pool, int operator_id,
                                                        int dest_id, const TPlanNode& tnode,
                                                        const DescriptorTbl& descs)
@@ -76,7 +90,9 @@ PartitionSortSinkOperatorX::PartitionSortSinkOperatorX(ObjectPool* pool, int ope
           _topn_phase(tnode.partition_sort_node.ptopn_phase),
           _has_global_limit(tnode.partition_sort_node.has_global_limit),
           _top_n_algorithm(tnode.partition_sort_node.top_n_algorithm),
-          _partition_inner_limit(tnode.partition_sort_node.partition_inner_limit) {}
+          _partition_inner_limit(tnode.partition_sort_node.partition_inner_limit) {
+    _spillable = true;
+}
 
 Status PartitionSortSinkOperatorX::init(const TPlanNode& tnode, RuntimeState* state) {
     RETURN_IF_ERROR(DataSinkOperatorX::init(tnode, state));
@@ -105,6 +121,24 @@ Status PartitionSortSinkOperatorX::prepare(RuntimeState* state) {
     return Status::OK();
 }
 
+Status PartitionSortSinkLocalState::close(RuntimeState* state, Status exec_status) {
+    if (_closed) {
+        return Status::OK();
+    }
+    if (_shared_state && (!exec_status.ok() || state->is_cancelled())) {
+        // the source won't read the revoked rows back, close() also waits for the spill task
+        _shared_state->close();
+        for (auto* partition : _value_places) {
+            if (partition->_spill_stream) {
+                ExecEnv::GetInstance()->spill_stream_mgr()->delete_spill_stream(
+                        partition->_spill_stream);
+                partition->_spill_stream.reset();
+            }
+        }
+    }
+    return Base::close(state, exec_status);
+}
+
 Status PartitionSortSinkOperatorX::sink(RuntimeState* state, vectorized::Block* input_block,
                                         bool eos) {
     auto& local_state = get_local_state(state);
@@ -133,17 +167,23 @@ Status PartitionSortSinkOperatorX::sink(RuntimeState* state, vectorized::Block*
                 input_block->clear_column_data();
             }
         }
+        if (!eos) {
+            local_state._update_revocable_mem_size(state);
+        }
     }
 
     if (eos) {
         //seems could free for hashtable
         local_state._agg_arena_pool.reset(nullptr);
         local_state._partitioned_data.reset(nullptr);
+        local_state._revocable_mem_size = 0;
         SCOPED_TIMER(local_state._sorted_data_timer);
         for (auto& _value_place : local_state._value_places) {
             _value_place->create_or_reset_sorter_state();
             local_state._shared_state->partition_sorts.emplace_back(
                     std::move(_value_place->_partition_topn_sorter));
+            local_state._shared_state->spill_streams.emplace_back(
+                    std::move(_value_place->_spill_stream));
         }
         // notice: need split two for loop, as maybe need check sorter early
         for (int i = 0; i < local_state._value_places.size(); ++i) {
@@ -152,6 +192,10 @@ Status PartitionSortSinkOperatorX::sink(RuntimeState* state, vectorized::Block*
                 RETURN_IF_ERROR(sorter->append_block(block.get()));
             }
             local_state._value_places[i]->_blocks.clear();
+            if (local_state._shared_state->spill_streams[i]) {
+                // prepared by the source after the revoked rows are read back
+                continue;
+            }
             RETURN_IF_ERROR(sorter->prepare_for_read(false));
             INJECT_MOCK_SLEEP(std::unique_lock<std::mutex> lc(
                     local_state._shared_state->prepared_finish_lock));
@@ -163,6 +207,11 @@ Status PartitionSortSinkOperatorX::sink(RuntimeState* state, vectorized::Block*
         COUNTER_SET(local_state._hash_table_size_counter, int64_t(local_state._num_partition));
         COUNTER_SET(local_state._sorted_partition_input_rows_counter,
                     local_state._sorted_partition_input_rows);
+        local_state.custom_profile()->add_info_string(
+                "HasPassThrough", local_state._is_need_passthrough ? "Yes" : "No");
+        if (local_state._shared_state->is_spilled) {
+            return local_state._finish_spill(state);
+        }
         //so all data from child have sink completed
         {
             std::unique_lock<std::mutex> lc(local_state._shared_state->sink_eos_lock);
@@ -170,8 +219,6 @@ Status PartitionSortSinkOperatorX::sink(RuntimeState* state, vectorized::Block*
             // this ready is also need, as source maybe block by self in some case
             local_state._dependency->set_ready_to_read();
         }
-        local_state.custom_profile()->add_info_string(
-                "HasPassThrough", local_state._is_need_passthrough ? "Yes" : "No");
     }
 
     return Status::OK();
@@ -204,6 +251,15 @@ size_t PartitionSortSinkOperatorX::get_reserve_mem_size(RuntimeState* state, boo
     return reserve_mem_size;
 }
 
+size_t PartitionSortSinkOperatorX::revocable_mem_size(RuntimeState* state) const {
+    return get_local_state(state)._revocable_mem_size;
+}
+
+Status PartitionSortSinkOperatorX::revoke_memory(
+        RuntimeState* state, const std::shared_ptr<SpillContext>& spill_context) {
+    return get_local_state(state).revoke_memory(state, spill_context);
+}
+
 Status PartitionSortSinkOperatorX::_emplace_into_hash_table(
         const vectorized::ColumnRawPtrs& key_columns, vectorized::Block* input_block,
         PartitionSortSinkLocalState& local_state, bool eos) {
@@ -302,5 +358,127 @@ bool PartitionSortSinkLocalState::check_whether_need_passthrough() {
 }
 // NOLINTEND(readability-simplify-boolean-expr)
 
+void PartitionSortSinkLocalState::_update_revocable_mem_size(RuntimeState* state) {
+    _revocable_mem_size = 0;
+    if (!state->enable_spill()) {
+        return;
+    }
+    for (auto* partition : _value_places) {
+        auto bytes = partition->buffered_bytes();
+        if (bytes >= vectorized::SpillStream::MIN_SPILL_WRITE_BATCH_MEM) {
+            _revocable_mem_size += bytes;
+        }
+    }
+}
+
+// Moves the buffered blocks of the large partitions to one spill stream per partition. The
+// source reads a partition back only when it comes to sort it, so at most one revoked
+// partition is in memory at a time.
+Status PartitionSortSinkLocalState::revoke_memory(
+        RuntimeState* state, const std::shared_ptr<SpillContext>& spill_context) {
+    if (!_shared_state->is_spilled) {
+        _shared_state->is_spilled = true;
+        custom_profile()->add_info_string("Spilled", "true");
+    }
+    VLOG_DEBUG << fmt::format("Query:{}, partition sort sink:{}, task:{}, revoke_memory, size:{}",
+                              print_id(state->query_id()), _parent->node_id(), state->task_id(),
+                              _revocable_mem_size);
+
+    std::vector<std::pair<vectorized::SpillStreamSPtr, std::vector<vectorized::Block>>>
+            spilling_blocks;
+    for (auto* partition : _value_places) {
+        if (partition->buffered_bytes() < vectorized::SpillStream::MIN_SPILL_WRITE_BATCH_MEM) {
+            continue;
+        }
+        if (!partition->_spill_stream) {
+            RETURN_IF_ERROR(ExecEnv::GetInstance()->spill_stream_mgr()->register_spill_stream(
+                    state, partition->_spill_stream, print_id(state->query_id()),
+                    "partition_sort", _parent->node_id(), state->batch_size(),
+                    state->spill_sort_batch_bytes(), operator_profile()));
+            COUNTER_UPDATE(_spilled_partitions_counter, 1);
+        }
+        std::vector<vectorized::Block> blocks;
+        for (auto& block : partition->_blocks) {
+            blocks.emplace_back(std::move(*block));
+        }
+        partition->_blocks.clear();
+        spilling_blocks.emplace_back(partition->_spill_stream, std::move(blocks));
+    }
+    _revocable_mem_size = 0;
+
+    auto query_id = state->query_id();
+    auto spill_func = [this, state, query_id, spilling_blocks = std::move(spilling_blocks)] {
+        Status status;
+        Defer defer {[&]() {
+            if (!status.ok()) {
+                LOG(WARNING) << fmt::format(
+                        "Query:{}, partition sort sink:{}, task:{}, revoke memory error:{}",
+                        print_id(query_id), _parent->node_id(), state->task_id(), status);
+            }
+            state->get_query_ctx()
+                    ->resource_ctx()
+                    ->task_controller()
+                    ->decrease_revoking_tasks_count();
+        }};
+        std::unique_lock<std::mutex> spill_lc(_shared_state->spill_lock);
+        for (const auto& [stream, blocks] : spilling_blocks) {
+            for (const auto& block : blocks) {
+                if (state->is_cancelled() || _shared_state->is_closed) {
+                    return Status::OK();
+                }
+                status = stream->spill_block(state, block, false);
+                RETURN_IF_ERROR(status);
+            }
+        }
+        return Status::OK();
+    };
+
+    auto exception_catch_func = [spill_func = std::move(spill_func)]() {
+        auto status = [&]() { RETURN_IF_CATCH_EXCEPTION({ return spill_func(); }); }();
+        return status;
+    };
+
+    state->get_query_ctx()->resource_ctx()->task_controller()->increase_revoking_tasks_count();
+    _spill_dependency->block();
+    return ExecEnv::GetInstance()->spill_stream_mgr()->get_spill_io_thread_pool()->submit(
+            std::make_shared<SpillSinkRunnable>(state, spill_context, _spill_dependency,
+                                                operator_profile(),
+                                                _shared_state->shared_from_this(),
+                                                exception_catch_func));
+}
+
+// Closes the spill streams, the source may read them back only after that.
+Status PartitionSortSinkLocalState::_finish_spill(RuntimeState* state) {
+    auto spill_func = [this] {
+        Defer defer {[&]() {
+            std::unique_lock<std::mutex> lc(_shared_state->sink_eos_lock);
+            _shared_state->sink_eos = true;
+            _dependency->set_ready_to_read();
+        }};
+        std::unique_lock<std::mutex> spill_lc(_shared_state->spill_lock);
+        if (_shared_state->is_closed) {
+            return Status::OK();
+        }
+        for (auto& stream : _shared_state->spill_streams) {
+            if (stream) {
+                RETURN_IF_ERROR(stream->spill_eof());
+            }
+        }
+        return Status::OK();
+    };
+
+    auto exception_catch_func = [spill_func = std::move(spill_func)]() {
+        auto status = [&]() { RETURN_IF_CATCH_EXCEPTION({ return spill_func(); }); }();
+        return status;
+    };
+
+    _spill_dependency->block();
+    return ExecEnv::GetInstance()->spill_stream_mgr()->get_spill_io_thread_pool()->submit(
+            std::make_shared<SpillSinkRunnable>(state, nullptr, _spill_dependency,
+                                                operator_profile(),
+                                                _shared_state->shared_from_this(),
+                                                exception_catch_func));
+}
+
 #include "common/compile_check_end.h"
 } // namespace doris::pipeline
@@ -27,16 +27,22 @@ namespace doris::pipeline {
 #include "common/compile_check_begin.h"
 
 class PartitionSortSinkOperatorX;
-class PartitionSortSinkLocalState : public PipelineXSinkLocalState<PartitionSortNodeSharedState> {
+class PartitionSortSinkLocalState
+        : public PipelineXSpillSinkLocalState<PartitionSortNodeSharedState> {
     ENABLE_FACTORY_CREATOR(PartitionSortSinkLocalState);
 
 public:
+    using Base = PipelineXSpillSinkLocalState<PartitionSortNodeSharedState>;
     PartitionSortSinkLocalState(DataSinkOperatorXBase* parent, RuntimeState* state)
-            : PipelineXSinkLocalState<PartitionSortNodeSharedState>(parent, state),
+            : Base(parent, state),
               _partitioned_data(std::make_unique<PartitionedHashMapVariants>()),
               _agg_arena_pool(std::make_unique<vectorized::Arena>()) {}
 
     Status init(RuntimeState* state, LocalSinkStateInfo& info) override;
+    Status open(RuntimeState* state) override;
+    Status close(RuntimeState* state, Status exec_status) override;
+
+    Status revoke_memory(RuntimeState* state, const std::shared_ptr<SpillContext>& spill_context);
 
 private:
     friend class PartitionSortSinkOperatorX;
@@ -64,8 +70,14 @@ private:
     RuntimeProfile::Counter* _sorted_partition_input_rows_counter = nullptr;
     RuntimeProfile::Counter* _hash_table_memory_usage = nullptr;
     RuntimeProfile::HighWaterMarkCounter* _serialize_key_arena_memory_usage = nullptr;
+    // only the partitions holding at least MIN_SPILL_WRITE_BATCH_MEM are revoked
+    size_t _revocable_mem_size = 0;
+    RuntimeProfile::Counter* _spilled_partitions_counter = nullptr;
+
     Status _init_hash_method();
     bool check_whether_need_passthrough();
+    void _update_revocable_mem_size(RuntimeState* state);
+    Status _finish_spill(RuntimeState* state);
 };
 
 class PartitionSortSinkOperatorX final : public DataSinkOperatorX<PartitionSortSinkLocalState> {
@@ -102,6 +114,14 @@ public:
 
     size_t get_reserve_mem_size(RuntimeState* state, bool eos) override;
 
+    size_t revocable_mem_size(RuntimeState* state) const override;
+
+    // buffered partition blocks are written out as they are
+    double revoke_cost_per_byte(RuntimeState* state) const override { return 0.5; }
+
+    Status revoke_memory(RuntimeState* state,
+                         const std::shared_ptr<SpillContext>& spill_context) override;
+
 private:
     friend class PartitionSortSinkLocalState;
     ObjectPool* _pool = nullptr;
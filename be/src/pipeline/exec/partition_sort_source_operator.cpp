@@ -18,6 +18,8 @@
 #include "partition_sort_source_operator.h"
 
 #include "pipeline/exec/operator.h"
+#include "pipeline/exec/spill_utils.h"
+#include "vec/spill/spill_stream_manager.h"
 
 namespace doris {
 #include "common/compile_check_begin.h"
@@ -26,15 +28,78 @@ class RuntimeState;
 namespace pipeline {
 
 Status PartitionSortSourceLocalState::init(RuntimeState* state, LocalStateInfo& info) {
-    RETURN_IF_ERROR(PipelineXLocalState<PartitionSortNodeSharedState>::init(state, info));
+    RETURN_IF_ERROR(Base::init(state, info));
     SCOPED_TIMER(exec_time_counter());
     SCOPED_TIMER(_init_timer);
     _get_sorted_timer = ADD_TIMER(custom_profile(), "GetSortedTime");
     _sorted_partition_output_rows_counter =
             ADD_COUNTER(custom_profile(), "SortedPartitionOutputRows", TUnit::UNIT);
+    _spill_dependency = Dependency::create_shared(_parent->operator_id(), _parent->node_id(),
+                                                  "PartitionSortSourceSpillDependency", true);
     return Status::OK();
 }
 
+Status PartitionSortSourceLocalState::close(RuntimeState* state) {
+    if (_closed) {
+        return Status::OK();
+    }
+    if (_shared_state) {
+        _shared_state->close();
+    }
+    return Base::close(state);
+}
+
+// Reads the revoked rows of the current partition back into its sorter. The sink closes the
+// spill streams before setting sink_eos, so wait for that first.
+Status PartitionSortSourceLocalState::_recover_spilled_partition(RuntimeState* state) {
+    {
+        std::unique_lock<std::mutex> lc(_shared_state->sink_eos_lock);
+        if (!_shared_state->sink_eos) {
+            _dependency->block();
+            return Status::OK();
+        }
+    }
+    copy_shared_spill_profile();
+
+    size_t sort_idx = _sort_idx;
+    auto stream = _shared_state->spill_streams[sort_idx];
+    DCHECK(stream != nullptr);
+    stream->set_read_counters(operator_profile());
+    auto spill_func = [this, state, sort_idx, stream] {
+        std::unique_lock<std::mutex> spill_lc(_shared_state->spill_lock);
+        auto& sorter = _shared_state->partition_sorts[sort_idx];
+        bool eos = false;
+        while (!eos && !state->is_cancelled() && !_shared_state->is_closed) {
+            vectorized::Block block;
+            RETURN_IF_ERROR(stream->read_next_block_sync(&block, &eos));
+            if (!block.empty()) {
+                RETURN_IF_ERROR(sorter->append_block(&block));
+            }
+        }
+        if (!eos) {
+            // cancelled or closed, close() deletes the stream
+            return Status::OK();
+        }
+        ExecEnv::GetInstance()->spill_stream_mgr()->delete_spill_stream(stream);
+        _shared_state->spill_streams[sort_idx].reset();
+        RETURN_IF_ERROR(sorter->prepare_for_read(false));
+        std::unique_lock<std::mutex> lc(_shared_state->prepared_finish_lock);
+        sorter->set_prepared_finish();
+        return Status::OK();
+    };
+
+    auto exception_catch_func = [spill_func = std::move(spill_func)]() {
+        auto status = [&]() { RETURN_IF_CATCH_EXCEPTION({ return spill_func(); }); }();
+        return status;
+    };
+
+    _spill_dependency->block();
+    return ExecEnv::GetInstance()->spill_stream_mgr()->get_spill_io_thread_pool()->submit(
+            std::make_shared<SpillRecoverRunnable>(state, _spill_dependency, operator_profile(),
+                                                   _shared_state->shared_from_this(),
+                                                   exception_catch_func));
+}
+
 Status PartitionSortSourceOperatorX::get_block(RuntimeState* state, vectorized::Block* output_block,
                                                bool* eos) {
     RETURN_IF_CANCELLED(state);
@@ -90,6 +155,10 @@ Status PartitionSortSourceOperatorX::get_sorted_block(RuntimeState* state,
     auto& sorters = local_state._shared_state->partition_sorts;
     auto sorter_size = sorters.size();
     if (local_state._sort_idx < sorter_size) {
+        if (!sorters[local_state._sort_idx]->prepared_finish() &&
+            local_state._shared_state->spill_streams[local_state._sort_idx]) {
+            return local_state._recover_spilled_partition(state);
+        }
         RETURN_IF_ERROR(
                 sorters[local_state._sort_idx]->get_next(state, output_block, &current_eos));
         COUNTER_UPDATE(local_state._sorted_partition_output_rows_counter, output_block->rows());
@@ -99,7 +168,8 @@ Status PartitionSortSourceOperatorX::get_sorted_block(RuntimeState* state,
         local_state._sort_idx++;
         std::unique_lock<std::mutex> lc(local_state._shared_state->prepared_finish_lock);
         if (local_state._sort_idx < sorter_size &&
-            !sorters[local_state._sort_idx]->prepared_finish()) {
+            !sorters[local_state._sort_idx]->prepared_finish() &&
+            !local_state._shared_state->spill_streams[local_state._sort_idx]) {
             local_state._dependency->block();
         }
     }
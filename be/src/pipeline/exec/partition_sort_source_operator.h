@@ -30,17 +30,20 @@ namespace pipeline {
 
 class PartitionSortSourceOperatorX;
 class PartitionSortSourceLocalState final
-        : public PipelineXLocalState<PartitionSortNodeSharedState> {
+        : public PipelineXSpillLocalState<PartitionSortNodeSharedState> {
 public:
     ENABLE_FACTORY_CREATOR(PartitionSortSourceLocalState);
-    using Base = PipelineXLocalState<PartitionSortNodeSharedState>;
+    using Base = PipelineXSpillLocalState<PartitionSortNodeSharedState>;
     PartitionSortSourceLocalState(RuntimeState* state, OperatorXBase* parent)
-            : PipelineXLocalState<PartitionSortNodeSharedState>(state, parent) {}
+            : Base(state, parent) {}
 
     Status init(RuntimeState* state, LocalStateInfo& info) override;
+    Status close(RuntimeState* state) override;
 
 private:
     friend class PartitionSortSourceOperatorX;
+    Status _recover_spilled_partition(RuntimeState* state);
+
     RuntimeProfile::Counter* _get_sorted_timer = nullptr;
     RuntimeProfile::Counter* _sorted_partition_output_rows_counter = nullptr;
     std::atomic<int> _sort_idx = 0;
@@ -319,6 +319,9 @@ public:
     }
     size_t revocable_mem_size(RuntimeState* state) const override;
 
+    // the hash table is repartitioned and serialized, and merged again when read back
+    double revoke_cost_per_byte(RuntimeState* state) const override { return 2.0; }
+
     Status revoke_memory(RuntimeState* state,
                          const std::shared_ptr<SpillContext>& spill_context) override;
 
@@ -113,6 +113,9 @@ public:
 
     size_t revocable_mem_size(RuntimeState* state) const override;
 
+    // build blocks are repartitioned, and the hash table is built again when read back
+    double revoke_cost_per_byte(RuntimeState* state) const override { return 1.5; }
+
     Status revoke_memory(RuntimeState* state,
                          const std::shared_ptr<SpillContext>& spill_context) override;
 
@@ -1107,6 +1107,8 @@ Status ScanLocalState<Derived>::_init_profile() {
 
     _max_scan_concurrency = ADD_COUNTER(custom_profile(), "MaxScanConcurrency", TUnit::UNIT);
     _min_scan_concurrency = ADD_COUNTER(custom_profile(), "MinScanConcurrency", TUnit::UNIT);
+    _adaptive_scan_concurrency =
+            ADD_COUNTER(custom_profile(), "AdaptiveScanConcurrency", TUnit::UNIT);
 
     _peak_running_scanner =
             _scanner_profile->AddHighWaterMarkCounter("RunningScanner", TUnit::UNIT);
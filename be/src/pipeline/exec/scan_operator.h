@@ -103,6 +103,8 @@ protected:
     // Max num of scanner thread
     RuntimeProfile::Counter* _max_scan_concurrency = nullptr;
     RuntimeProfile::Counter* _min_scan_concurrency = nullptr;
+    // Latest target of the adaptive scan concurrency
+    RuntimeProfile::Counter* _adaptive_scan_concurrency = nullptr;
     RuntimeProfile::HighWaterMarkCounter* _peak_running_scanner = nullptr;
     // time of get block from scanner
     RuntimeProfile::Counter* _scan_timer = nullptr;
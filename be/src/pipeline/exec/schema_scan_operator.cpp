@@ -19,11 +19,16 @@
 
 #include <gen_cpp/FrontendService_types.h>
 
+#include <algorithm>
+#include <boost/algorithm/string/case_conv.hpp>
+#include <iterator>
 #include <memory>
 
 #include "pipeline/exec/operator.h"
 #include "util/runtime_profile.h"
 #include "vec/data_types/data_type_factory.hpp"
+#include "vec/exprs/vliteral.h"
+#include "vec/exprs/vslot_ref.h"
 
 namespace doris {
 #include "common/compile_check_begin.h"
@@ -61,9 +66,57 @@ Status SchemaScanLocalState::open(RuntimeState* state) {
     SCOPED_TIMER(exec_time_counter());
     SCOPED_TIMER(_open_timer);
     RETURN_IF_ERROR(PipelineXLocalState<>::open(state));
+    _push_down_int_predicates();
     return _schema_scanner->get_next_block_async(state);
 }
 
+void SchemaScanLocalState::_push_down_int_predicates() {
+    auto is_pushdown_type = [](const vectorized::DataTypePtr& type) {
+        auto primitive_type = type->get_primitive_type();
+        return is_int(primitive_type) && primitive_type != TYPE_LARGEINT;
+    };
+    for (const auto& conjunct : _conjuncts) {
+        const auto& root = conjunct->root();
+        bool is_eq = root->node_type() == TExprNodeType::BINARY_PRED &&
+                     root->op() == TExprOpcode::EQ;
+        bool is_in = root->node_type() == TExprNodeType::IN_PRED &&
+                     root->op() == TExprOpcode::FILTER_IN;
+        if ((!is_eq && !is_in) || root->children().size() < 2 ||
+            !root->children()[0]->is_slot_ref() ||
+            !is_pushdown_type(root->children()[0]->data_type())) {
+            continue;
+        }
+
+        std::set<int64_t> values;
+        bool all_literals = true;
+        for (size_t i = 1; i < root->children().size(); ++i) {
+            const auto& child = root->children()[i];
+            // a null literal matches no row, it is left to the conjunct
+            if (!child->is_literal() || child->data_type()->is_nullable() ||
+                !is_pushdown_type(child->data_type())) {
+                all_literals = false;
+                break;
+            }
+            const auto* literal = static_cast<const vectorized::VLiteral*>(child.get());
+            values.insert(literal->get_column_ptr()->get_int(0));
+        }
+        if (!all_literals) {
+            continue;
+        }
+
+        const auto* slot_ref = static_cast<const vectorized::VSlotRef*>(root->children()[0].get());
+        auto [it, inserted] = _scanner_param.int_column_values.try_emplace(
+                boost::to_upper_copy(slot_ref->expr_name()), values);
+        if (!inserted) {
+            // several conjuncts on the same column must all hold
+            std::set<int64_t> intersection;
+            std::ranges::set_intersection(it->second, values,
+                                          std::inserter(intersection, intersection.begin()));
+            it->second = std::move(intersection);
+        }
+    }
+}
+
 SchemaScanOperatorX::SchemaScanOperatorX(ObjectPool* pool, const TPlanNode& tnode, int operator_id,
                                          const DescriptorTbl& descs)
         : Base(pool, tnode, operator_id, descs),
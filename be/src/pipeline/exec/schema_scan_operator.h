@@ -51,6 +51,10 @@ public:
 private:
     friend class SchemaScanOperatorX;
 
+    // Collects `int_col = literal` and `int_col IN (literals)` conjuncts into
+    // SchemaScannerParam::int_column_values, so that scanners enumerate only matching objects.
+    void _push_down_int_predicates();
+
     SchemaScannerParam _scanner_param;
     std::unique_ptr<SchemaScanner> _schema_scanner;
 
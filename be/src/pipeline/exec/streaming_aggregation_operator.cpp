@@ -19,11 +19,13 @@
 
 #include <gen_cpp/Metrics_types.h>
 
+#include <algorithm>
 #include <memory>
 #include <utility>
 
 #include "common/cast_set.h"
 #include "common/compiler_util.h" // IWYU pragma: keep
+#include "common/config.h"
 #include "pipeline/exec/operator.h"
 #include "vec/exprs/vectorized_agg_fn.h"
 #include "vec/exprs/vslot_ref.h"
@@ -77,6 +79,13 @@ static constexpr StreamingHtMinReductionEntry STREAMING_HT_MIN_REDUCTION[] = {
 static constexpr int STREAMING_HT_MIN_REDUCTION_SIZE =
         sizeof(STREAMING_HT_MIN_REDUCTION) / sizeof(STREAMING_HT_MIN_REDUCTION[0]);
 
+// Smaller blocks give a too noisy reduction to drive the adaptive passthrough.
+static constexpr size_t ADAPTIVE_PASSTHROUGH_MIN_SAMPLE_ROWS = 1024;
+// Consecutive low reduction blocks needed before switching to passthrough.
+static constexpr int ADAPTIVE_PASSTHROUGH_LOW_BLOCKS = 3;
+// Upper bound of the passthrough length, as a multiple of the configured interval.
+static constexpr int64_t ADAPTIVE_PASSTHROUGH_MAX_BACKOFF = 16;
+
 StreamingAggLocalState::StreamingAggLocalState(RuntimeState* state, OperatorXBase* parent)
         : Base(state, parent),
           _agg_data(std::make_unique<AggregatedDataVariants>()),
@@ -109,6 +118,11 @@ Status StreamingAggLocalState::init(RuntimeState* state, LocalStateInfo& info) {
     _get_results_timer = ADD_TIMER(custom_profile(), "GetResultsTime");
     _hash_table_iterate_timer = ADD_TIMER(custom_profile(), "HashTableIterateTime");
     _insert_keys_to_column_timer = ADD_TIMER(custom_profile(), "InsertKeysToColumnTime");
+    _adaptive_passthrough_counter =
+            ADD_COUNTER(custom_profile(), "AdaptivePassthroughCount", TUnit::UNIT);
+    _adaptive_resume_counter = ADD_COUNTER(custom_profile(), "AdaptiveResumeCount", TUnit::UNIT);
+    _adaptive_passthrough_rows_counter =
+            ADD_COUNTER(custom_profile(), "AdaptivePassthroughRows", TUnit::UNIT);
 
     return Status::OK();
 }
@@ -312,6 +326,11 @@ bool StreamingAggLocalState::_should_not_do_pre_agg(size_t rows) {
     // to avoid wasting memory.
     // But for fixed hash map, it never need to expand
     auto& p = Base::_parent->template cast<StreamingAggOperatorX>();
+    if (_passthrough_blocks_left > 0) {
+        --_passthrough_blocks_left;
+        COUNTER_UPDATE(_adaptive_passthrough_rows_counter, rows);
+        return true;
+    }
     bool ret_flag = false;
     const auto spill_streaming_agg_mem_limit = p._spill_streaming_agg_mem_limit;
     const bool used_too_much_memory =
@@ -337,6 +356,42 @@ bool StreamingAggLocalState::_should_not_do_pre_agg(size_t rows) {
     return ret_flag;
 }
 
+void StreamingAggLocalState::_update_adaptive_passthrough(size_t rows, size_t new_groups) {
+    if (!config::enable_streaming_agg_adaptive_passthrough ||
+        rows < ADAPTIVE_PASSTHROUGH_MIN_SAMPLE_ROWS) {
+        return;
+    }
+    const double reduction =
+            static_cast<double>(rows) / static_cast<double>(std::max<size_t>(new_groups, 1));
+    const bool low_reduction = reduction < config::streaming_agg_passthrough_min_reduction;
+    if (_in_adaptive_passthrough) {
+        // This block probed the hash table after a passthrough period.
+        if (low_reduction) {
+            _passthrough_interval =
+                    std::min(_passthrough_interval * 2,
+                             ADAPTIVE_PASSTHROUGH_MAX_BACKOFF *
+                                     std::max<int64_t>(
+                                             config::streaming_agg_passthrough_blocks, 1));
+            _passthrough_blocks_left = _passthrough_interval;
+        } else {
+            _in_adaptive_passthrough = false;
+            _low_reduction_blocks = 0;
+            COUNTER_UPDATE(_adaptive_resume_counter, 1);
+        }
+        return;
+    }
+    if (!low_reduction) {
+        _low_reduction_blocks = 0;
+        return;
+    }
+    if (++_low_reduction_blocks >= ADAPTIVE_PASSTHROUGH_LOW_BLOCKS) {
+        _in_adaptive_passthrough = true;
+        _passthrough_interval = std::max<int64_t>(config::streaming_agg_passthrough_blocks, 1);
+        _passthrough_blocks_left = _passthrough_interval;
+        COUNTER_UPDATE(_adaptive_passthrough_counter, 1);
+    }
+}
+
 Status StreamingAggLocalState::_pre_agg_with_serialized_key(doris::vectorized::Block* in_block,
                                                             doris::vectorized::Block* out_block) {
     SCOPED_TIMER(_build_timer);
@@ -403,7 +458,9 @@ Status StreamingAggLocalState::_pre_agg_with_serialized_key(doris::vectorized::B
             }
         }
     } else {
+        const size_t groups_before = _get_hash_table_size();
         _emplace_into_hash_table(_places.data(), key_columns, rows);
+        _update_adaptive_passthrough(rows, _get_hash_table_size() - groups_before);
 
         for (int i = 0; i < _aggregate_evaluators.size(); ++i) {
             RETURN_IF_ERROR(_aggregate_evaluators[i]->execute_batch_add(
@@ -60,6 +60,9 @@ private:
     bool _should_expand_preagg_hash_tables();
 
     MOCK_FUNCTION bool _should_not_do_pre_agg(size_t rows);
+    // Feed the reduction of a block aggregated into the hash table to the adaptive
+    // passthrough state, see config::enable_streaming_agg_adaptive_passthrough.
+    void _update_adaptive_passthrough(size_t rows, size_t new_groups);
 
     Status _execute_with_serialized_key(vectorized::Block* block);
     void _update_memusage_with_serialized_key();
@@ -86,8 +89,18 @@ private:
     RuntimeProfile::Counter* _get_results_timer = nullptr;
     RuntimeProfile::Counter* _hash_table_iterate_timer = nullptr;
     RuntimeProfile::Counter* _insert_keys_to_column_timer = nullptr;
+    RuntimeProfile::Counter* _adaptive_passthrough_counter = nullptr;
+    RuntimeProfile::Counter* _adaptive_resume_counter = nullptr;
+    RuntimeProfile::Counter* _adaptive_passthrough_rows_counter = nullptr;
 
     bool _should_expand_hash_table = true;
+    // Consecutive sampled blocks whose reduction is under the threshold.
+    int _low_reduction_blocks = 0;
+    // Blocks still to pass through before the hash table is probed again.
+    int64_t _passthrough_blocks_left = 0;
+    // Passthrough length in blocks, doubled each time a probe still sees no reduction.
+    int64_t _passthrough_interval = 0;
+    bool _in_adaptive_passthrough = false;
     int64_t _cur_num_rows_returned = 0;
     vectorized::Arena _agg_arena_pool;
     AggregatedDataVariantsUPtr _agg_data = nullptr;
@@ -56,7 +56,8 @@ private:
 
     MOCK_FUNCTION Status _clone_table_function(RuntimeState* state);
 
-    void _copy_output_slots(std::vector<vectorized::MutableColumnPtr>& columns);
+    void _copy_output_slots();
+    void _flush_output_slots(std::vector<vectorized::MutableColumnPtr>& columns);
     bool _roll_table_functions(int last_eos_idx);
     // return:
     //  0: all fns are eos
@@ -70,6 +71,9 @@ private:
     int64_t _cur_child_offset = -1;
     std::unique_ptr<vectorized::Block> _child_block;
     int _current_row_insert_times = 0;
+    // Child row of every output row not yet copied into the output slots. The output slots are
+    // copied once per output block or child block instead of once per child row.
+    std::vector<uint32_t> _child_row_indices;
     bool _child_eos = false;
 
     RuntimeProfile::Counter* _init_function_timer = nullptr;
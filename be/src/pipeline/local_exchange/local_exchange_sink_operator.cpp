@@ -82,6 +82,8 @@ Status LocalExchangeSinkLocalState::init(RuntimeState* state, LocalSinkStateInfo
     SCOPED_TIMER(_init_timer);
     _compute_hash_value_timer = ADD_TIMER(custom_profile(), "ComputeHashValueTime");
     _distribute_timer = ADD_TIMER(custom_profile(), "DistributeDataTime");
+    _single_partition_blocks_counter =
+            ADD_COUNTER(custom_profile(), "SinglePartitionBlocks", TUnit::UNIT);
     if (_parent->cast<LocalExchangeSinkOperatorX>()._type == ExchangeType::HASH_SHUFFLE) {
         custom_profile()->add_info_string(
                 "UseGlobalShuffle",
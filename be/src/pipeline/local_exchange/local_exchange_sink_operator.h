@@ -62,6 +62,8 @@ private:
     // Used by shuffle exchanger
     RuntimeProfile::Counter* _compute_hash_value_timer = nullptr;
     RuntimeProfile::Counter* _distribute_timer = nullptr;
+    // Blocks whose rows all went to one partition and were sent without a row index
+    RuntimeProfile::Counter* _single_partition_blocks_counter = nullptr;
     std::unique_ptr<vectorized::PartitionerBase> _partitioner = nullptr;
 
     // Used by random passthrough exchanger
@@ -151,11 +151,26 @@ Status ShuffleExchanger::get_block(RuntimeState* state, vectorized::Block* block
 
     auto get_data = [&]() -> Status {
         do {
+            auto block_wrapper = partitioned_block.first;
+            if (partitioned_block.second.row_idxs == nullptr) {
+                RETURN_IF_ERROR(mutable_block.add_rows(&block_wrapper->_data_block,
+                                                       partitioned_block.second.offset_start,
+                                                       partitioned_block.second.length));
+                continue;
+            }
             const auto* offset_start = partitioned_block.second.row_idxs->data() +
                                        partitioned_block.second.offset_start;
-            auto block_wrapper = partitioned_block.first;
+            const auto length = partitioned_block.second.length;
+            // Row indices of a partition are ascending and unique, so if the span between the
+            // first and the last one equals the length the rows are contiguous in the source
+            // block (e.g. clustered input) and can be copied as a range instead of gathered.
+            if (offset_start[length - 1] - offset_start[0] == length - 1) {
+                RETURN_IF_ERROR(mutable_block.add_rows(&block_wrapper->_data_block,
+                                                       offset_start[0], length));
+                continue;
+            }
             RETURN_IF_ERROR(mutable_block.add_rows(&block_wrapper->_data_block, offset_start,
-                                                   offset_start + partitioned_block.second.length));
+                                                   offset_start + length));
         } while (mutable_block.rows() < state->batch_size() && !*eos &&
                  _dequeue_data(source_info.local_state, partitioned_block, eos, block,
                                source_info.channel_id));
@@ -164,6 +179,15 @@ Status ShuffleExchanger::get_block(RuntimeState* state, vectorized::Block* block
 
     if (_dequeue_data(source_info.local_state, partitioned_block, eos, block,
                       source_info.channel_id)) {
+        // A block whose rows all belong to this partition and that nobody else references is
+        // passed through like PassthroughExchanger does, unless it is too small to be worth
+        // sending without merging it with the following blocks.
+        if (partitioned_block.second.row_idxs == nullptr &&
+            partitioned_block.first.use_count() == 1 &&
+            partitioned_block.second.length * 2 >= static_cast<uint32_t>(state->batch_size())) {
+            block->swap(partitioned_block.first->_data_block);
+            return Status::OK();
+        }
         SCOPED_TIMER(profile.copy_data_timer);
         mutable_block = vectorized::VectorizedUtils::build_mutable_mem_reuse_block(
                 block, partitioned_block.first->_data_block);
@@ -180,19 +204,31 @@ Status ShuffleExchanger::_split_rows(RuntimeState* state, const uint32_t* __rest
         return _split_rows(state, channel_ids, block, channel_id);
     }
     const auto rows = cast_set<int32_t>(block->rows());
-    auto row_idx = std::make_shared<vectorized::PODArray<uint32_t>>(rows);
+    std::shared_ptr<vectorized::PODArray<uint32_t>> row_idx;
     auto& partition_rows_histogram = _partition_rows_histogram[channel_id];
     {
         partition_rows_histogram.assign(_num_partitions + 1, 0);
         for (int32_t i = 0; i < rows; ++i) {
             partition_rows_histogram[channel_ids[i]]++;
         }
+        // All rows belong to one partition, typically because the upstream exchange already
+        // partitioned the data by the same keys. The block is then sent without a row index.
+        const bool single_partition =
+                rows > 0 && partition_rows_histogram[channel_ids[0]] == static_cast<uint32_t>(rows);
         for (int32_t i = 1; i <= _num_partitions; ++i) {
             partition_rows_histogram[i] += partition_rows_histogram[i - 1];
         }
-        for (int32_t i = rows - 1; i >= 0; --i) {
-            (*row_idx)[partition_rows_histogram[channel_ids[i]] - 1] = i;
-            partition_rows_histogram[channel_ids[i]]--;
+        if (single_partition) {
+            partition_rows_histogram[channel_ids[0]] = 0;
+            if (local_state->_single_partition_blocks_counter != nullptr) {
+                COUNTER_UPDATE(local_state->_single_partition_blocks_counter, 1);
+            }
+        } else {
+            row_idx = std::make_shared<vectorized::PODArray<uint32_t>>(rows);
+            for (int32_t i = rows - 1; i >= 0; --i) {
+                (*row_idx)[partition_rows_histogram[channel_ids[i]] - 1] = i;
+                partition_rows_histogram[channel_ids[i]]--;
+            }
         }
     }
 
@@ -175,6 +175,7 @@ protected:
 };
 
 struct PartitionedRowIdxs {
+    // nullptr means the rows [offset_start, offset_start + length) of the block in order
     std::shared_ptr<vectorized::PODArray<uint32_t>> row_idxs;
     uint32_t offset_start;
     uint32_t length;
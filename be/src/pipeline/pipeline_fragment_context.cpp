@@ -1193,9 +1193,13 @@ Status PipelineFragmentContext::_create_operator(ObjectPool* pool, const TPlanNo
     bool fe_with_old_version = false;
     switch (tnode.node_type) {
     case TPlanNodeType::OLAP_SCAN_NODE: {
+        if (enable_query_cache) {
+            _query_cache_merge_info.add_scan_node(tnode, descs);
+        }
         op.reset(new OlapScanOperatorX(
                 pool, tnode, next_operator_id(), descs, _num_instances,
-                enable_query_cache ? request.fragment.query_cache_param : TQueryCacheParam {}));
+                enable_query_cache ? request.fragment.query_cache_param : TQueryCacheParam {},
+                _query_cache_merge_info));
         RETURN_IF_ERROR(cur_pipe->add_operator(
                 op, request.__isset.parallel_instances ? request.parallel_instances : 0));
         fe_with_old_version = !tnode.__isset.is_serial_operator;
@@ -1262,8 +1266,12 @@ Status PipelineFragmentContext::_create_operator(ObjectPool* pool, const TPlanNo
         auto create_query_cache_operator = [&](PipelinePtr& new_pipe) {
             auto cache_node_id = request.local_params[0].per_node_scan_ranges.begin()->first;
             auto cache_source_id = next_operator_id();
+            // the cached agg node comes first in the preorder, the olap scan below it takes the
+            // same merge info
+            _query_cache_merge_info = QueryCacheMergeInfo::create(tnode, descs);
             op.reset(new CacheSourceOperatorX(pool, cache_node_id, cache_source_id,
-                                              request.fragment.query_cache_param));
+                                              request.fragment.query_cache_param,
+                                              _query_cache_merge_info));
             RETURN_IF_ERROR(cur_pipe->add_operator(
                     op, request.__isset.parallel_instances ? request.parallel_instances : 0));
 
@@ -1943,6 +1951,18 @@ std::vector<PipelineTask*> PipelineFragmentContext::get_revocable_tasks() const
     return revocable_tasks;
 }
 
+void PipelineFragmentContext::collect_operator_memory_usage(
+        std::map<std::string, int64_t>* usage) const {
+    if (!_prepared) {
+        return;
+    }
+    for (const auto& task_instances : _tasks) {
+        for (const auto& task : task_instances) {
+            task->collect_operator_memory_usage(usage);
+        }
+    }
+}
+
 std::string PipelineFragmentContext::debug_string() {
     fmt::memory_buffer debug_string_buffer;
     fmt::format_to(debug_string_buffer, "PipelineFragmentContext Info:\n");
@@ -34,6 +34,7 @@
 #include "pipeline/pipeline.h"
 #include "pipeline/pipeline_fragment_context.h"
 #include "pipeline/pipeline_task.h"
+#include "pipeline/query_cache/query_cache.h"
 #include "runtime/query_context.h"
 #include "runtime/runtime_state.h"
 #include "runtime/task_execution_context.h"
@@ -116,6 +117,9 @@ public:
 
     [[nodiscard]] std::vector<PipelineTask*> get_revocable_tasks() const;
 
+    // Sum the memory used by operators of all tasks, only valid after prepared.
+    void collect_operator_memory_usage(std::map<std::string, int64_t>* usage) const;
+
     void clear_finished_tasks() {
         for (size_t j = 0; j < _tasks.size(); j++) {
             for (size_t i = 0; i < _tasks[j].size(); i++) {
@@ -323,6 +327,8 @@ private:
     // Total instance num running on all BEs
     int _total_instances = -1;
     bool _require_bucket_distribution = false;
+    // How the result of the query cache node of this fragment combines with more rows
+    QueryCacheMergeInfo _query_cache_merge_info;
 };
 } // namespace pipeline
 } // namespace doris
\ No newline at end of file
@@ -22,6 +22,7 @@
 #include <gen_cpp/Metrics_types.h>
 #include <glog/logging.h>
 
+#include <algorithm>
 #include <ostream>
 #include <vector>
 
@@ -231,6 +232,17 @@ void PipelineTask::_init_profile() {
     _memory_reserve_times = ADD_COUNTER(_task_profile, "MemoryReserveTimes", TUnit::UNIT);
     _memory_reserve_failed_times =
             ADD_COUNTER(_task_profile, "MemoryReserveFailedTimes", TUnit::UNIT);
+
+    if (config::enable_pipeline_task_hardware_counters) {
+        _hw_counters[ThreadHardwareCounters::CPU_CYCLES] =
+                ADD_COUNTER(_task_profile, "HwCpuCycles", TUnit::UNIT);
+        _hw_counters[ThreadHardwareCounters::INSTRUCTIONS] =
+                ADD_COUNTER(_task_profile, "HwInstructions", TUnit::UNIT);
+        _hw_counters[ThreadHardwareCounters::CACHE_MISSES] =
+                ADD_COUNTER(_task_profile, "HwCacheMisses", TUnit::UNIT);
+        _hw_counters[ThreadHardwareCounters::BRANCH_MISSES] =
+                ADD_COUNTER(_task_profile, "HwBranchMisses", TUnit::UNIT);
+    }
 }
 
 void PipelineTask::_fresh_profile_counter() {
@@ -369,14 +381,25 @@ Status PipelineTask::execute(bool* done) {
     }
     auto fragment_context = _fragment_context.lock();
     DCHECK(fragment_context);
+    _last_blocked_dep = nullptr;
     int64_t time_spent = 0;
     ThreadCpuStopWatch cpu_time_stop_watch;
     cpu_time_stop_watch.start();
+    // Hardware counters are per thread, a task never leaves its worker thread during execute.
+    ThreadHardwareCounters::Values hw_counters_begin;
+    bool hw_counters_enabled =
+            _hw_counters[0] != nullptr && ThreadHardwareCounters::read(&hw_counters_begin);
     SCOPED_ATTACH_TASK(_state);
     Defer running_defer {[&]() {
         if (_task_queue) {
             _task_queue->update_statistics(this, time_spent);
         }
+        ThreadHardwareCounters::Values hw_counters_end;
+        if (hw_counters_enabled && ThreadHardwareCounters::read(&hw_counters_end)) {
+            for (int i = 0; i < ThreadHardwareCounters::NUM_COUNTERS; ++i) {
+                COUNTER_UPDATE(_hw_counters[i], hw_counters_end[i] - hw_counters_begin[i]);
+            }
+        }
         int64_t delta_cpu_time = cpu_time_stop_watch.elapsed_time();
         _task_cpu_timer->update(delta_cpu_time);
         fragment_context->get_query_ctx()->resource_ctx()->cpu_context()->update_cpu_cost_ms(
@@ -635,6 +658,43 @@ bool PipelineTask::_try_to_reserve_memory(const size_t reserve_size, OperatorBas
     return true;
 }
 
+std::string PipelineTask::exec_end_state(bool done) const {
+    if (done) {
+        return "finished";
+    }
+    if (_last_blocked_dep != nullptr) {
+        return fmt::format("blocked({})", _last_blocked_dep->name());
+    }
+    if (_spilling) {
+        return "spilling";
+    }
+    if (_wake_up_early) {
+        return "wake_up_early";
+    }
+    return "yield";
+}
+
+void PipelineTask::collect_operator_memory_usage(std::map<std::string, int64_t>* usage) {
+    // `finalize` releases operators under this lock.
+    std::unique_lock<std::mutex> lc(_dependency_lock);
+    if (is_finalized()) {
+        return;
+    }
+    for (const auto& op : _operators) {
+        auto local_state = _state->get_local_state_result(op->operator_id());
+        if (local_state.has_value() && local_state.value()->memory_used_counter() != nullptr) {
+            (*usage)[fmt::format("{}(id={})", op->get_name(), op->node_id())] +=
+                    local_state.value()->memory_used_counter()->value();
+        }
+    }
+    auto sink_local_state = _state->get_sink_local_state_result();
+    if (sink_local_state.has_value() &&
+        sink_local_state.value()->memory_used_counter() != nullptr) {
+        (*usage)[fmt::format("{}(id={})", _sink->get_name(), _sink->node_id())] +=
+                sink_local_state.value()->memory_used_counter()->value();
+    }
+}
+
 void PipelineTask::stop_if_finished() {
     auto fragment = _fragment_context.lock();
     if (!fragment) {
@@ -696,6 +756,12 @@ Status PipelineTask::close(Status exec_status, bool close_sink) {
         _task_queue->update_statistics(this, close_ns);
     }
     if (close_sink) {
+        auto* dependency_wait_stats = _state->get_query_ctx()->dependency_wait_stats();
+        for (const auto& wait : _dependency_waits) {
+            dependency_wait_stats->update(wait.dependency->name(), wait.dependency->node_id(),
+                                          wait.wait_ns, wait.wait_times);
+        }
+        _dependency_waits.clear();
         RETURN_IF_ERROR(_state_transition(State::FINISHED));
     }
     return s;
@@ -809,6 +875,14 @@ Status PipelineTask::wake_up(Dependency* dep) {
     // call by dependency
     DCHECK_EQ(_blocked_dep, dep) << "dep : " << dep->debug_string(0) << "task: " << debug_string();
     _blocked_dep = nullptr;
+    // `_state_change_watcher` was restarted when this task turned blocked.
+    auto wait = std::find_if(_dependency_waits.begin(), _dependency_waits.end(),
+                             [dep](const DependencyWait& w) { return w.dependency == dep; });
+    if (wait == _dependency_waits.end()) {
+        wait = _dependency_waits.insert(wait, {.dependency = dep});
+    }
+    wait->wait_ns += _state_change_watcher.elapsed_time();
+    wait->wait_times++;
     auto holder = std::dynamic_pointer_cast<PipelineTask>(shared_from_this());
     RETURN_IF_ERROR(_state_transition(PipelineTask::State::RUNNABLE));
     RETURN_IF_ERROR(get_task_queue()->push_back(holder));
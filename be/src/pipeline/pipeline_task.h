@@ -17,7 +17,9 @@
 
 #pragma once
 
+#include <array>
 #include <cstdint>
+#include <map>
 #include <memory>
 #include <string>
 #include <vector>
@@ -26,6 +28,7 @@
 #include "pipeline/dependency.h"
 #include "pipeline/exec/operator.h"
 #include "pipeline/pipeline.h"
+#include "util/perf_counters.h"
 #include "util/runtime_profile.h"
 #include "util/stopwatch.hpp"
 #include "vec/core/block.h"
@@ -65,6 +68,8 @@ public:
 
     std::weak_ptr<PipelineFragmentContext>& fragment_context() { return _fragment_context; }
 
+    const TUniqueId& query_id() const { return _query_id; }
+
     int get_core_id() const { return _core_id; }
 
     PipelineTask& set_core_id(int id) {
@@ -162,14 +167,25 @@ public:
 
     PipelineId pipeline_id() const { return _pipeline->id(); }
     [[nodiscard]] size_t get_revocable_size() const;
+    [[nodiscard]] double get_revoke_cost_per_byte() const {
+        return _sink->revoke_cost_per_byte(_state);
+    }
     [[nodiscard]] Status revoke_memory(const std::shared_ptr<SpillContext>& spill_context);
 
     Status blocked(Dependency* dependency) {
         DCHECK_EQ(_blocked_dep, nullptr) << "task: " << debug_string();
         _blocked_dep = dependency;
+        _last_blocked_dep = dependency;
         return _state_transition(PipelineTask::State::BLOCKED);
     }
 
+    // How the latest `execute` returned, recorded by pipeline tracing.
+    std::string exec_end_state(bool done) const;
+
+    // Add the memory used by each operator and the sink of this task into `usage`, keyed by
+    // operator name and plan node id.
+    void collect_operator_memory_usage(std::map<std::string, int64_t>* usage);
+
 private:
     // Whether this task is blocked before execution (FE 2-phase commit trigger, runtime filters)
     bool _wait_to_start();
@@ -228,6 +244,9 @@ private:
     RuntimeProfile::Counter* _core_change_times = nullptr;
     RuntimeProfile::Counter* _memory_reserve_times = nullptr;
     RuntimeProfile::Counter* _memory_reserve_failed_times = nullptr;
+    // Only registered when `enable_pipeline_task_hardware_counters` is set.
+    // Indexed by ThreadHardwareCounters::Index.
+    std::array<RuntimeProfile::Counter*, ThreadHardwareCounters::NUM_COUNTERS> _hw_counters {};
 
     Operators _operators; // left is _source, right is _root
     OperatorXBase* _source;
@@ -253,6 +272,16 @@ private:
     MOCK_REMOVE(const)
     unsigned long long _exec_time_slice = config::pipeline_task_exec_time_slice * NANOS_PER_MILLIS;
     Dependency* _blocked_dep = nullptr;
+    // The dependency blocking the latest `execute`, kept after wake up for pipeline tracing.
+    Dependency* _last_blocked_dep = nullptr;
+    struct DependencyWait {
+        Dependency* dependency = nullptr;
+        int64_t wait_ns = 0;
+        int64_t wait_times = 0;
+    };
+    // Time blocked on each dependency, filled by `wake_up` and merged into the query when the
+    // sink closes, so a wake up doesn't touch the query wide stats.
+    std::vector<DependencyWait> _dependency_waits;
 
     Dependency* _memory_sufficient_dependency;
     std::mutex _dependency_lock;
@@ -19,8 +19,11 @@
 
 #include <absl/time/clock.h>
 #include <fcntl.h>
+#include <rapidjson/stringbuffer.h>
+#include <rapidjson/writer.h>
 #include <sys/stat.h>
 
+#include <algorithm>
 #include <boost/algorithm/string/predicate.hpp>
 #include <chrono>
 #include <cstdint>
@@ -31,6 +34,7 @@
 #include "common/exception.h"
 #include "common/status.h"
 #include "io/fs/local_file_writer.h"
+#include "util/hash_util.hpp"
 #include "util/time.h"
 
 namespace doris::pipeline {
@@ -39,11 +43,18 @@ void PipelineTracerContext::record(ScheduleRecord record) {
     if (_dump_type == RecordType::None) [[unlikely]] {
         return;
     }
+    if (!_sampled(record.query_id)) {
+        return;
+    }
 
     auto map_ptr = std::atomic_load_explicit(&_data, std::memory_order_relaxed);
     auto it = map_ptr->find({record.query_id});
     if (it != map_ptr->end()) {
-        it->second->enqueue(record);
+        if (_max_records_per_query > 0 &&
+            it->second->size_approx() >= _max_records_per_query) [[unlikely]] {
+            return;
+        }
+        it->second->enqueue(std::move(record));
     } else {
         _update([&](QueryTracesMap& new_map) {
             if (!new_map.contains({record.query_id})) {
@@ -54,6 +65,16 @@ void PipelineTracerContext::record(ScheduleRecord record) {
     }
 }
 
+bool PipelineTracerContext::_sampled(const TUniqueId& query_id) const {
+    if (_sample_rate >= 1.0) {
+        return true;
+    }
+    // all tasks of one query get the same decision, so a sampled query has a complete timeline.
+    uint64_t hash = HashUtil::hash64(&query_id.lo, sizeof(query_id.lo),
+                                     static_cast<uint64_t>(query_id.hi));
+    return static_cast<double>(hash % 10000) < _sample_rate * 10000;
+}
+
 void PipelineTracerContext::_update(std::function<void(QueryTracesMap&)>&& handler) {
     auto map_ptr = std::atomic_load_explicit(&_data, std::memory_order_relaxed);
     while (true) {
@@ -106,6 +127,32 @@ Status PipelineTracerContext::change_record_params(
         effective = true;
     }
 
+    if (auto it = params.find("format"); it != params.end()) {
+        if (boost::iequals(it->second, "text")) {
+            _dump_format = DumpFormat::Text;
+            effective = true;
+        } else if (boost::iequals(it->second, "chrome") ||
+                   boost::iequals(it->second, "perfetto")) {
+            _dump_format = DumpFormat::Chrome;
+            effective = true;
+        }
+    }
+
+    if (auto it = params.find("sample_rate"); it != params.end()) {
+        double sample_rate = std::stod(it->second);
+        if (sample_rate <= 0 || sample_rate > 1) {
+            return Status::InvalidArgument("sample_rate should be in (0, 1], but got {}",
+                                           it->second);
+        }
+        _sample_rate = sample_rate;
+        effective = true;
+    }
+
+    if (auto it = params.find("max_records_per_query"); it != params.end()) {
+        _max_records_per_query = std::stoull(it->second);
+        effective = true;
+    }
+
     return effective ? Status::OK()
                      : Status::InvalidArgument(
                                "No qualified param in changing tracing record method");
@@ -113,33 +160,24 @@ Status PipelineTracerContext::change_record_params(
 
 void PipelineTracerContext::_dump_query(TUniqueId query_id) {
     auto map_ptr = std::atomic_load_explicit(&_data, std::memory_order_relaxed);
-    auto path = _log_dir / fmt::format("query{}", to_string(query_id));
-    int fd = ::open(path.c_str(), O_CREAT | O_WRONLY | O_TRUNC,
-                    S_ISGID | S_ISUID | S_IWUSR | S_IRUSR | S_IWGRP | S_IRGRP | S_IWOTH | S_IROTH);
-    if (fd < 0) [[unlikely]] {
-        throw Exception(Status::Error<ErrorCode::CREATE_FILE_ERROR>(
-                "create tracing log file {} failed", path.c_str()));
-    }
-    auto writer = io::LocalFileWriter {path, fd};
-
-    ScheduleRecord record;
-    while ((*map_ptr)[QueryID {query_id}]->try_dequeue(record)) {
-        uint64_t v = 0;
+    auto it = map_ptr->find(QueryID {query_id});
+    if (it != map_ptr->end()) {
+        std::vector<QueryTraces> traces(1);
+        traces[0].query_id = query_id;
         {
             std::unique_lock<std::mutex> l(_tg_lock);
-            v = _id_to_workload_group.at(query_id);
+            traces[0].workload_group = _id_to_workload_group.at(query_id);
         }
-        auto tmp_str = record.to_string(v);
-        auto text = Slice {tmp_str};
-        THROW_IF_ERROR(writer.appendv(&text, 1));
+        ScheduleRecord record;
+        while (it->second->try_dequeue(record)) {
+            traces[0].records.push_back(std::move(record));
+        }
+        _write_file(fmt::format("query{}", to_string(query_id)), traces);
+        _update([&](QueryTracesMap& new_map) { new_map.erase(QueryID {query_id}); });
     }
 
-    THROW_IF_ERROR(writer.close());
-
     _last_dump_time = MonotonicSeconds();
 
-    _update([&](QueryTracesMap& new_map) { _data->erase(QueryID {query_id}); });
-
     {
         std::unique_lock<std::mutex> l(_tg_lock);
         _id_to_workload_group.erase(query_id);
@@ -148,10 +186,102 @@ void PipelineTracerContext::_dump_query(TUniqueId query_id) {
 
 void PipelineTracerContext::_dump_timeslice() {
     auto new_map = std::make_shared<QueryTracesMap>();
-    new_map.swap(_data);
+    new_map = std::atomic_exchange_explicit(&_data, new_map, std::memory_order_relaxed);
+
+    // dump all query traces in this time window to one file.
+    std::vector<QueryTraces> traces;
+    traces.reserve(new_map->size());
+    for (auto& [query_id, trace] : (*new_map)) {
+        auto& query_traces = traces.emplace_back();
+        query_traces.query_id = query_id.query_id;
+        {
+            // queries still running have not reported their workload group yet.
+            std::unique_lock<std::mutex> l(_tg_lock);
+            auto wg_it = _id_to_workload_group.find(query_id.query_id);
+            query_traces.workload_group = wg_it == _id_to_workload_group.end() ? 0 : wg_it->second;
+        }
+        ScheduleRecord record;
+        while (trace->try_dequeue(record)) {
+            query_traces.records.push_back(std::move(record));
+        }
+    }
     //TODO: if long time, per timeslice per file
-    auto path = _log_dir /
-                fmt::format("until{}", std::chrono::steady_clock::now().time_since_epoch().count());
+    _write_file(fmt::format("until{}", std::chrono::steady_clock::now().time_since_epoch().count()),
+                traces);
+
+    _last_dump_time = MonotonicSeconds();
+
+    std::unique_lock<std::mutex> l(_tg_lock);
+    _id_to_workload_group.clear();
+}
+
+// In Chrome trace format every query is shown as a process and every worker thread as a thread
+// of it, each run of a task is a complete event ("ph":"X") with timestamps in microseconds.
+std::string PipelineTracerContext::_to_chrome_trace(const std::vector<QueryTraces>& traces) {
+    rapidjson::StringBuffer buffer;
+    rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+    writer.StartObject();
+    writer.Key("displayTimeUnit");
+    writer.String("ms");
+    writer.Key("traceEvents");
+    writer.StartArray();
+    for (size_t i = 0; i < traces.size(); ++i) {
+        auto pid = static_cast<uint64_t>(i + 1);
+        auto process_name = fmt::format("query {} (workload group {})",
+                                        to_string(traces[i].query_id), traces[i].workload_group);
+        writer.StartObject();
+        writer.Key("name");
+        writer.String("process_name");
+        writer.Key("ph");
+        writer.String("M");
+        writer.Key("pid");
+        writer.Uint64(pid);
+        writer.Key("args");
+        writer.StartObject();
+        writer.Key("name");
+        writer.String(process_name.data(), static_cast<rapidjson::SizeType>(process_name.size()));
+        writer.EndObject();
+        writer.EndObject();
+
+        for (const auto& record : traces[i].records) {
+            writer.StartObject();
+            writer.Key("name");
+            writer.String(record.task_id.data(),
+                          static_cast<rapidjson::SizeType>(record.task_id.size()));
+            writer.Key("cat");
+            writer.String("pipeline_task");
+            writer.Key("ph");
+            writer.String("X");
+            writer.Key("ts");
+            writer.Uint64(record.start_time);
+            writer.Key("dur");
+            writer.Uint64(record.end_time - record.start_time);
+            writer.Key("pid");
+            writer.Uint64(pid);
+            writer.Key("tid");
+            writer.Uint64(record.thread_id);
+            writer.Key("args");
+            writer.StartObject();
+            writer.Key("core_id");
+            writer.Uint(record.core_id);
+            writer.Key("state");
+            writer.String(record.state.data(),
+                          static_cast<rapidjson::SizeType>(record.state.size()));
+            writer.EndObject();
+            writer.EndObject();
+        }
+    }
+    writer.EndArray();
+    writer.EndObject();
+    return {buffer.GetString(), buffer.GetSize()};
+}
+
+void PipelineTracerContext::_write_file(const std::string& file_name,
+                                        const std::vector<QueryTraces>& traces) {
+    auto path = _log_dir / file_name;
+    if (_dump_format == DumpFormat::Chrome) {
+        path += ".json";
+    }
     int fd = ::open(path.c_str(), O_CREAT | O_WRONLY | O_TRUNC,
                     S_ISGID | S_ISUID | S_IWUSR | S_IRUSR | S_IWGRP | S_IRGRP | S_IWOTH | S_IROTH);
     if (fd < 0) [[unlikely]] {
@@ -160,24 +290,20 @@ void PipelineTracerContext::_dump_timeslice() {
     }
     auto writer = io::LocalFileWriter {path, fd};
 
-    // dump all query traces in this time window to one file.
-    for (auto& [query_id, trace] : (*new_map)) {
-        ScheduleRecord record;
-        while (trace->try_dequeue(record)) {
-            uint64_t v = 0;
-            {
-                std::unique_lock<std::mutex> l(_tg_lock);
-                v = _id_to_workload_group.at(query_id.query_id);
+    if (_dump_format == DumpFormat::Chrome) {
+        auto content = _to_chrome_trace(traces);
+        auto text = Slice {content};
+        THROW_IF_ERROR(writer.appendv(&text, 1));
+    } else {
+        for (const auto& query_traces : traces) {
+            for (const auto& record : query_traces.records) {
+                auto tmp_str = record.to_string(query_traces.workload_group);
+                auto text = Slice {tmp_str};
+                THROW_IF_ERROR(writer.appendv(&text, 1));
             }
-            auto tmp_str = record.to_string(v);
-            auto text = Slice {tmp_str};
-            THROW_IF_ERROR(writer.appendv(&text, 1));
         }
     }
-    THROW_IF_ERROR(writer.close());
 
-    _last_dump_time = MonotonicSeconds();
-
-    _id_to_workload_group.clear();
+    THROW_IF_ERROR(writer.close());
 }
 } // namespace doris::pipeline
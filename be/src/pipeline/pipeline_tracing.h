@@ -24,6 +24,8 @@
 
 #include <cstdint>
 #include <filesystem>
+#include <string>
+#include <vector>
 
 #include "common/config.h"
 #include "util/hash_util.hpp" // IWYU pragma: keep
@@ -39,6 +41,8 @@ struct ScheduleRecord {
     uint64_t thread_id;
     uint64_t start_time;
     uint64_t end_time;
+    // How this run ended, e.g. finished, yield or blocked(<dependency name>).
+    std::string state;
 
     bool operator<(const ScheduleRecord& rhs) const { return start_time < rhs.start_time; }
     std::string to_string(uint64_t append_value) const {
@@ -70,6 +74,10 @@ public:
         PerQuery, // record per query. one query one file.
         Periodic  // record per times. one timeslice one file.
     };
+    enum class DumpFormat {
+        Text,  // one `|` separated line per record.
+        Chrome // Chrome trace event json, can be opened by Perfetto UI or chrome://tracing.
+    };
     void record(ScheduleRecord record); // record one schedule record
     void end_query(TUniqueId query_id,
                    uint64_t workload_group); // tell context this query is end. may leads to dump.
@@ -78,9 +86,19 @@ public:
     bool enabled() const { return !(_dump_type == RecordType::None); }
 
 private:
+    struct QueryTraces {
+        TUniqueId query_id;
+        uint64_t workload_group;
+        std::vector<ScheduleRecord> records;
+    };
+
+    // whether records of this query are kept, decided by `_sample_rate` per query.
+    bool _sampled(const TUniqueId& query_id) const;
     // dump data to disk. one query or all.
     void _dump_query(TUniqueId query_id);
     void _dump_timeslice();
+    void _write_file(const std::string& file_name, const std::vector<QueryTraces>& traces);
+    static std::string _to_chrome_trace(const std::vector<QueryTraces>& traces);
     void _update(std::function<void(QueryTracesMap&)>&& handler);
 
     std::filesystem::path _log_dir = fmt::format("{}/pipe_tracing", getenv("LOG_DIR"));
@@ -91,6 +109,11 @@ private:
             _id_to_workload_group; // save query's workload group number
 
     RecordType _dump_type = RecordType::None;
+    DumpFormat _dump_format = DumpFormat::Text;
+    // fraction of queries to record, in (0, 1].
+    double _sample_rate = 1.0;
+    // records beyond this are dropped for one query, 0 means unlimited.
+    size_t _max_records_per_query = 1000000;
     decltype(MonotonicSeconds()) _last_dump_time;
     decltype(MonotonicSeconds()) _dump_interval_s =
             60; // effective iff Periodic mode. 1 minute default.
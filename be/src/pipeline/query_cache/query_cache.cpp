@@ -17,8 +17,75 @@
 
 #include "query_cache.h"
 
+#include <algorithm>
+
+#include "olap/base_tablet.h"
+#include "olap/rowset/rowset.h"
+#include "olap/tablet_schema.h"
+#include "runtime/descriptors.h"
+#include "runtime/query_context.h"
+#include "runtime/runtime_state.h"
+
 namespace doris {
 
+namespace {
+// The column a single slot ref expression reads, empty for any other expression.
+std::string slot_column_name(const std::vector<TExprNode>& nodes, size_t begin, size_t end,
+                             const DescriptorTbl& descs) {
+    if (end != begin + 1 || nodes[begin].node_type != TExprNodeType::SLOT_REF) {
+        return "";
+    }
+    auto* slot = descs.get_slot_descriptor(nodes[begin].slot_ref.slot_id);
+    return slot == nullptr ? "" : slot->col_name();
+}
+} // namespace
+
+QueryCacheMergeInfo QueryCacheMergeInfo::create(const TPlanNode& agg_node,
+                                                const DescriptorTbl& descs) {
+    QueryCacheMergeInfo merge_info;
+    merge_info.partial_states = agg_node.node_type == TPlanNodeType::AGGREGATION_NODE &&
+                                !agg_node.agg_node.need_finalize;
+    if (!merge_info.partial_states) {
+        return merge_info;
+    }
+    for (const auto& expr : agg_node.agg_node.grouping_exprs) {
+        merge_info.group_by_columns.push_back(
+                slot_column_name(expr.nodes, 0, expr.nodes.size(), descs));
+    }
+    for (const auto& expr : agg_node.agg_node.aggregate_functions) {
+        if (expr.nodes.empty()) {
+            merge_info.partial_states = false;
+            return merge_info;
+        }
+        AggFunction function {expr.nodes[0].fn.name.function_name, ""};
+        // one argument or none, e.g. count(*), keeps the column empty
+        if (expr.nodes[0].num_children == 1) {
+            function.column = slot_column_name(expr.nodes, 1, expr.nodes.size(), descs);
+        }
+        merge_info.agg_functions.push_back(std::move(function));
+    }
+    return merge_info;
+}
+
+void QueryCacheMergeInfo::add_scan_node(const TPlanNode& scan_node, const DescriptorTbl& descs) {
+    for (const auto& conjunct : scan_node.conjuncts) {
+        for (const auto& node : conjunct.nodes) {
+            if (node.node_type == TExprNodeType::SLOT_REF) {
+                auto* slot = descs.get_slot_descriptor(node.slot_ref.slot_id);
+                filter_columns.push_back(slot == nullptr ? "" : slot->col_name());
+            }
+        }
+    }
+    if (scan_node.__isset.projections) {
+        plain_projections = std::all_of(
+                scan_node.projections.begin(), scan_node.projections.end(),
+                [](const TExpr& expr) {
+                    return expr.nodes.size() == 1 &&
+                           expr.nodes[0].node_type == TExprNodeType::SLOT_REF;
+                });
+    }
+}
+
 std::vector<int>* QueryCacheHandle::get_cache_slot_orders() {
     DCHECK(_handle);
     auto result_ptr = reinterpret_cast<LRUHandle*>(_handle)->value;
@@ -66,4 +133,138 @@ bool QueryCache::lookup(const CacheKey& key, int64_t version, doris::QueryCacheH
     return false;
 }
 
+void QueryCache::lookup_incremental(const CacheKey& key, int64_t tablet_id, int64_t version,
+                                    const QueryCacheMergeInfo& merge_info,
+                                    QueryCacheLookup* result) {
+    SCOPED_SWITCH_THREAD_MEM_TRACKER_LIMITER(ExecEnv::GetInstance()->query_cache_mem_tracker());
+    auto* lru_handle = LRUCachePolicy::lookup(key);
+    if (lru_handle == nullptr) {
+        return;
+    }
+    QueryCacheHandle handle(this, lru_handle);
+    auto cached_version = handle.get_cache_version();
+    if (cached_version == version) {
+        result->hit = true;
+    } else if (cached_version < version &&
+               can_scan_incrementally(tablet_id, cached_version, version, merge_info)) {
+        result->delta_start_version = cached_version + 1;
+    } else {
+        return;
+    }
+    result->handle = std::move(handle);
+}
+
+Status QueryCache::lookup_for_query(RuntimeState* state,
+                                    const std::vector<TScanRangeParams>& scan_ranges,
+                                    const TQueryCacheParam& cache_param,
+                                    const QueryCacheMergeInfo& merge_info,
+                                    std::shared_ptr<QueryCacheLookup>* result) {
+    std::string cache_key;
+    int64_t version = 0;
+    RETURN_IF_ERROR(build_cache_key(scan_ranges, cache_param, &cache_key, &version));
+    auto tablet_id = scan_ranges[0].scan_range.palo_scan_range.tablet_id;
+    auto do_lookup = [&]() {
+        auto lookup = std::make_shared<QueryCacheLookup>();
+        if (!cache_param.force_refresh_query_cache) {
+            lookup_incremental(cache_key, tablet_id, version, merge_info, lookup.get());
+        }
+        return lookup;
+    };
+    auto* query_ctx = state->get_query_ctx();
+    if (query_ctx == nullptr) {
+        *result = do_lookup();
+    } else {
+        *result = query_ctx->get_or_create_query_cache_lookup(cache_key, do_lookup);
+    }
+    return Status::OK();
+}
+
+bool QueryCache::can_scan_incrementally(int64_t tablet_id, int64_t cached_version,
+                                        int64_t version, const QueryCacheMergeInfo& merge_info) {
+    if (!merge_info.partial_states) {
+        return false;
+    }
+    auto tablet = ExecEnv::get_tablet(tablet_id);
+    if (!tablet.has_value()) {
+        return false;
+    }
+    std::vector<RowsetSharedPtr> rowsets;
+    {
+        std::shared_lock rlock(tablet.value()->get_header_lock());
+        if (!tablet.value()
+                     ->capture_consistent_rowsets_unlocked({cached_version + 1, version}, &rowsets)
+                     .ok()) {
+            return false;
+        }
+    }
+    if (rowsets.empty()) {
+        return false;
+    }
+    return std::all_of(rowsets.begin(), rowsets.end(), [&](const RowsetSharedPtr& rowset) {
+        if (rowset->rowset_meta()->has_delete_predicate()) {
+            return false;
+        }
+        const auto& schema = *rowset->tablet_schema();
+        switch (schema.keys_type()) {
+        case KeysType::DUP_KEYS:
+            return true;
+        case KeysType::AGG_KEYS:
+            return has_mergeable_aggregation(schema, merge_info);
+        default:
+            return false;
+        }
+    });
+}
+
+bool QueryCache::has_mergeable_aggregation(const TabletSchema& schema,
+                                           const QueryCacheMergeInfo& merge_info) {
+    auto is_key = [&](const std::string& name) {
+        if (name.empty()) {
+            return false;
+        }
+        auto index = schema.field_index(name);
+        return index >= 0 && schema.column(index).is_key();
+    };
+    if (!merge_info.partial_states || !merge_info.plain_projections ||
+        !std::all_of(merge_info.group_by_columns.begin(), merge_info.group_by_columns.end(),
+                     is_key) ||
+        !std::all_of(merge_info.filter_columns.begin(), merge_info.filter_columns.end(),
+                     is_key)) {
+        return false;
+    }
+    return std::all_of(
+            merge_info.agg_functions.begin(), merge_info.agg_functions.end(),
+            [&](const QueryCacheMergeInfo::AggFunction& function) {
+                if (function.column.empty()) {
+                    return false;
+                }
+                auto index = schema.field_index(function.column);
+                if (index < 0) {
+                    return false;
+                }
+                const auto& column = schema.column(index);
+                const auto& name = function.name;
+                if (name == "min" || name == "max") {
+                    return column.is_key() ||
+                           column.aggregation() ==
+                                   (name == "min"
+                                            ? FieldAggregationMethod::OLAP_FIELD_AGGREGATION_MIN
+                                            : FieldAggregationMethod::OLAP_FIELD_AGGREGATION_MAX);
+                }
+                switch (column.aggregation()) {
+                case FieldAggregationMethod::OLAP_FIELD_AGGREGATION_SUM:
+                    return name == "sum";
+                case FieldAggregationMethod::OLAP_FIELD_AGGREGATION_HLL_UNION:
+                    return name == "hll_union_agg" || name == "hll_union" ||
+                           name == "hll_raw_agg";
+                case FieldAggregationMethod::OLAP_FIELD_AGGREGATION_BITMAP_UNION:
+                    return name == "bitmap_union" || name == "bitmap_union_count";
+                case FieldAggregationMethod::OLAP_FIELD_AGGREGATION_QUANTILE_UNION:
+                    return name == "quantile_union";
+                default:
+                    return false;
+                }
+            });
+}
+
 } // namespace doris
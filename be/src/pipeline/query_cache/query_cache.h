@@ -18,6 +18,7 @@
 #pragma once
 
 #include <butil/macros.h>
+#include <gen_cpp/PlanNodes_types.h>
 #include <glog/logging.h>
 #include <stddef.h>
 #include <stdint.h>
@@ -26,6 +27,7 @@
 #include <memory>
 #include <roaring/roaring.hh>
 #include <string>
+#include <vector>
 
 #include "common/config.h"
 #include "common/status.h"
@@ -41,6 +43,9 @@
 
 namespace doris {
 
+class DescriptorTbl;
+class TabletSchema;
+
 using CacheResult = std::vector<vectorized::BlockUPtr>;
 // A handle for mid-result from query lru cache.
 // The handle will automatically release the cache entry when it is destroyed.
@@ -87,6 +92,38 @@ private:
     DISALLOW_COPY_AND_ASSIGN(QueryCacheHandle);
 };
 
+// The entry a query takes from the cache for the tablet of one scan range.
+struct QueryCacheLookup {
+    QueryCacheHandle handle;
+    // The entry holds the result of exactly the scanned version.
+    bool hit = false;
+    // The entry holds the result of an older version: only the rowsets from this version on are
+    // scanned, and their result is emitted after the cached one. 0 if the entry is not usable.
+    int64_t delta_start_version = 0;
+};
+
+// How the result of the cached plan node can be combined with the result of more rows, derived
+// from the aggregation node the cache sits on and the olap scan below it when the fragment is
+// built. Columns are identified by name, empty if the expression is not a plain column.
+struct QueryCacheMergeInfo {
+    struct AggFunction {
+        std::string name;
+        std::string column;
+    };
+
+    // The node outputs partial aggregation states that are merged again downstream, so the
+    // states of the cached versions and of the newer rowsets can be emitted side by side.
+    bool partial_states = false;
+    std::vector<AggFunction> agg_functions;
+    std::vector<std::string> group_by_columns;
+    // Columns the scan filters on, and whether its output only renames columns.
+    std::vector<std::string> filter_columns;
+    bool plain_projections = true;
+
+    static QueryCacheMergeInfo create(const TPlanNode& agg_node, const DescriptorTbl& descs);
+    void add_scan_node(const TPlanNode& scan_node, const DescriptorTbl& descs);
+};
+
 class QueryCache : public LRUCachePolicy {
 public:
     using LRUCachePolicy::insert;
@@ -146,6 +183,33 @@ public:
 
     bool lookup(const CacheKey& key, int64_t version, QueryCacheHandle* handle);
 
+    // Like lookup, but an entry of an older version is taken as incremental hit when the
+    // rowsets written after it can be scanned on their own.
+    void lookup_incremental(const CacheKey& key, int64_t tablet_id, int64_t version,
+                            const QueryCacheMergeInfo& merge_info, QueryCacheLookup* result);
+
+    // Looks the tablet of the scan range up once per query, so the scan and the cache source
+    // of a tablet act on the same entry even if the cache changes in between.
+    Status lookup_for_query(RuntimeState* state, const std::vector<TScanRangeParams>& scan_ranges,
+                            const TQueryCacheParam& cache_param,
+                            const QueryCacheMergeInfo& merge_info,
+                            std::shared_ptr<QueryCacheLookup>* result);
+
+    // Partial aggregation results of versions [0, cached_version] can only be combined with the
+    // ones of (cached_version, version] when the cached node outputs partial states and the new
+    // rowsets have no delete predicate. Rows of a duplicate key tablet are never merged with the
+    // old ones; for aggregate key tablets has_mergeable_aggregation must hold for the schema of
+    // every new rowset. Unique key tablets replace old rows and are never taken.
+    static bool can_scan_incrementally(int64_t tablet_id, int64_t cached_version, int64_t version,
+                                       const QueryCacheMergeInfo& merge_info);
+
+    // Whether merging the rows of old and new rowsets in storage gives the same result as
+    // merging the partial aggregation states of each: the query groups and filters by key
+    // columns only, and every aggregate function repeats the aggregation of its value column,
+    // e.g. sum of a SUM column or min of a key. count(*) counts merged rows once and is refused.
+    static bool has_mergeable_aggregation(const TabletSchema& schema,
+                                          const QueryCacheMergeInfo& merge_info);
+
     void insert(const CacheKey& key, int64_t version, CacheResult& result,
                 const std::vector<int>& solt_orders, int64_t cache_size);
 };
@@ -18,10 +18,12 @@
 #include "task_queue.h"
 
 // IWYU pragma: no_include <bits/chrono.h>
+#include <algorithm>
 #include <chrono> // IWYU pragma: keep
 #include <memory>
 #include <string>
 
+#include "common/config.h"
 #include "common/logging.h"
 #include "pipeline/pipeline_task.h"
 #include "runtime/workload_group/workload_group.h"
@@ -38,9 +40,24 @@ PipelineTaskSPtr SubTaskQueue::try_take(bool is_steal) {
     return task;
 }
 
+PipelineTaskSPtr SubTaskQueue::try_take_lock_free() {
+    if (empty_lock_free()) {
+        return nullptr;
+    }
+    PipelineTaskSPtr task;
+    if (!_lock_free_queue.try_dequeue(task)) {
+        return nullptr;
+    }
+    _lock_free_size.fetch_sub(1);
+    return task;
+}
+
 ////////////////////  PriorityTaskQueue ////////////////////
 
-PriorityTaskQueue::PriorityTaskQueue() : _closed(false) {
+PriorityTaskQueue::PriorityTaskQueue()
+        : PriorityTaskQueue(config::enable_lock_free_pipeline_task_queue) {}
+
+PriorityTaskQueue::PriorityTaskQueue(bool lock_free) : _closed(false), _lock_free(lock_free) {
     double factor = 1;
     for (int i = SUB_QUEUE_LEVEL - 1; i >= 0; i--) {
         _sub_queues[i].set_level_factor(factor);
@@ -77,12 +94,19 @@ PipelineTaskSPtr PriorityTaskQueue::_try_take_unprotected(bool is_steal) {
     auto task = _sub_queues[level].try_take(is_steal);
     if (task) {
         task->update_queue_level(level);
-        _total_task_size--;
+        _dec_total_task_size();
         DorisMetrics::instance()->pipeline_task_queue_size->increment(-1);
     }
     return task;
 }
 
+void PriorityTaskQueue::_dec_total_task_size() {
+    auto size = _total_task_size.load();
+    while (size > 0 && !_total_task_size.compare_exchange_weak(size, size - 1)) {
+    }
+    DCHECK_GT(size, 0) << "pipeline task queue size underflow";
+}
+
 int PriorityTaskQueue::_compute_level(uint64_t runtime) {
     for (int i = 0; i < SUB_QUEUE_LEVEL - 1; ++i) {
         if (runtime <= _queue_level_limit[i]) {
@@ -92,13 +116,88 @@ int PriorityTaskQueue::_compute_level(uint64_t runtime) {
     return SUB_QUEUE_LEVEL - 1;
 }
 
+PipelineTaskSPtr PriorityTaskQueue::_try_take_lock_free() {
+    if (_total_task_size == 0 || _closed) {
+        return nullptr;
+    }
+
+    // Visit the non-empty levels from the smallest vruntime, a level may be drained by other
+    // threads concurrently, so fall back to the next one if the dequeue fails.
+    std::pair<double, int> levels[SUB_QUEUE_LEVEL];
+    int num_levels = 0;
+    for (int i = 0; i < SUB_QUEUE_LEVEL; ++i) {
+        if (!_sub_queues[i].empty_lock_free()) {
+            levels[num_levels++] = {_sub_queues[i].get_vruntime(), i};
+        }
+    }
+    std::sort(levels, levels + num_levels);
+
+    for (int i = 0; i < num_levels; ++i) {
+        auto [vruntime, level] = levels[i];
+        auto task = _sub_queues[level].try_take_lock_free();
+        if (task) {
+            _queue_level_min_vruntime = uint64_t(vruntime);
+            task->update_queue_level(level);
+            _dec_total_task_size();
+            DorisMetrics::instance()->pipeline_task_queue_size->increment(-1);
+            return task;
+        }
+    }
+    return nullptr;
+}
+
+PipelineTaskSPtr PriorityTaskQueue::_take_lock_free(uint32_t timeout_ms) {
+    auto task = _try_take_lock_free();
+    if (task) {
+        return task;
+    }
+    {
+        std::unique_lock<std::mutex> lock(_work_size_mutex);
+        // `_num_waiters` is increased before checking the task size, a concurrent push either
+        // sees the waiter and notifies it, or its task is visible to the predicate.
+        _num_waiters++;
+        auto has_task = [this]() { return _total_task_size > 0 || _closed; };
+        if (timeout_ms > 0) {
+            _wait_task.wait_for(lock, std::chrono::milliseconds(timeout_ms), has_task);
+        } else {
+            _wait_task.wait(lock, has_task);
+        }
+        _num_waiters--;
+    }
+    return _try_take_lock_free();
+}
+
+Status PriorityTaskQueue::_push_lock_free(PipelineTaskSPtr task, int level) {
+    // update empty queue's  runtime, to avoid too high priority
+    if (_sub_queues[level].empty_lock_free() &&
+        double(_queue_level_min_vruntime) > _sub_queues[level].get_vruntime()) {
+        _sub_queues[level].adjust_runtime(_queue_level_min_vruntime);
+    }
+
+    // count the task before it is visible, a concurrent take must not decrease the size first
+    _total_task_size++;
+    DorisMetrics::instance()->pipeline_task_queue_size->increment(1);
+    _sub_queues[level].push_back_lock_free(std::move(task));
+    if (_num_waiters > 0) {
+        std::unique_lock<std::mutex> lock(_work_size_mutex);
+        _wait_task.notify_one();
+    }
+    return Status::OK();
+}
+
 PipelineTaskSPtr PriorityTaskQueue::try_take(bool is_steal) {
+    if (_lock_free) {
+        return _try_take_lock_free();
+    }
     // TODO other efficient lock? e.g. if get lock fail, return null_ptr
     std::unique_lock<std::mutex> lock(_work_size_mutex);
     return _try_take_unprotected(is_steal);
 }
 
 PipelineTaskSPtr PriorityTaskQueue::take(uint32_t timeout_ms) {
+    if (_lock_free) {
+        return _take_lock_free(timeout_ms);
+    }
     std::unique_lock<std::mutex> lock(_work_size_mutex);
     auto task = _try_take_unprotected(false);
     if (task) {
@@ -118,6 +217,9 @@ Status PriorityTaskQueue::push(PipelineTaskSPtr task) {
         return Status::InternalError("WorkTaskQueue closed");
     }
     auto level = _compute_level(task->get_runtime_ns());
+    if (_lock_free) {
+        return _push_lock_free(std::move(task), level);
+    }
     std::unique_lock<std::mutex> lock(_work_size_mutex);
 
     // update empty queue's  runtime, to avoid too high priority
@@ -135,8 +237,24 @@ Status PriorityTaskQueue::push(PipelineTaskSPtr task) {
 
 MultiCoreTaskQueue::~MultiCoreTaskQueue() = default;
 
-MultiCoreTaskQueue::MultiCoreTaskQueue(int core_size)
-        : _prio_task_queues(core_size), _closed(false), _core_size(core_size) {}
+MultiCoreTaskQueue::MultiCoreTaskQueue(int core_size, int numa_node_num)
+        : _prio_task_queues(core_size),
+          _closed(false),
+          _core_size(core_size),
+          _numa_node_num(std::max(1, std::min(numa_node_num, core_size))),
+          _core_to_numa_node(core_size),
+          _numa_node_to_cores(_numa_node_num),
+          _next_core_of_node(new std::atomic<uint32_t>[_numa_node_num]) {
+    for (int core_id = 0; core_id < _core_size; ++core_id) {
+        // contiguous cores belong to the same node, e.g. 8 cores on 2 nodes: 0-3 -> 0, 4-7 -> 1
+        int node = int(int64_t(core_id) * _numa_node_num / _core_size);
+        _core_to_numa_node[core_id] = node;
+        _numa_node_to_cores[node].push_back(core_id);
+    }
+    for (int node = 0; node < _numa_node_num; ++node) {
+        _next_core_of_node[node] = 0;
+    }
+}
 
 void MultiCoreTaskQueue::close() {
     if (_closed) {
@@ -175,25 +293,46 @@ PipelineTaskSPtr MultiCoreTaskQueue::take(int core_id) {
 
 PipelineTaskSPtr MultiCoreTaskQueue::_steal_take(int core_id) {
     DCHECK(core_id < _core_size);
-    int next_id = core_id;
-    for (int i = 1; i < _core_size; ++i) {
-        ++next_id;
-        if (next_id == _core_size) {
-            next_id = 0;
-        }
+    int local_node = _core_to_numa_node[core_id];
+    // 1. steal from the cores of the same NUMA node, starting from the next core
+    const auto& local_cores = _numa_node_to_cores[local_node];
+    auto local_size = local_cores.size();
+    auto local_idx = size_t(std::find(local_cores.begin(), local_cores.end(), core_id) -
+                            local_cores.begin());
+    for (size_t i = 1; i < local_size; ++i) {
+        int next_id = local_cores[(local_idx + i) % local_size];
         DCHECK(next_id < _core_size);
         auto task = _prio_task_queues[next_id].try_take(true);
         if (task) {
             return task;
         }
     }
+    // 2. steal from the remote NUMA nodes, nearest node id first
+    for (int i = 1; i < _numa_node_num; ++i) {
+        for (int next_id : _numa_node_to_cores[(local_node + i) % _numa_node_num]) {
+            auto task = _prio_task_queues[next_id].try_take(true);
+            if (task) {
+                return task;
+            }
+        }
+    }
     return nullptr;
 }
 
+int MultiCoreTaskQueue::_next_core_for(const PipelineTask& task) {
+    if (_numa_node_num == 1) {
+        return int(_next_core.fetch_add(1) % _core_size);
+    }
+    const auto& query_id = task.query_id();
+    auto node = int(uint64_t(query_id.hi ^ query_id.lo) % uint64_t(_numa_node_num));
+    const auto& cores = _numa_node_to_cores[node];
+    return cores[_next_core_of_node[node].fetch_add(1) % cores.size()];
+}
+
 Status MultiCoreTaskQueue::push_back(PipelineTaskSPtr task) {
     int core_id = task->get_core_id();
     if (core_id < 0) {
-        core_id = _next_core.fetch_add(1) % _core_size;
+        core_id = _next_core_for(*task);
     }
     return push_back(task, core_id);
 }
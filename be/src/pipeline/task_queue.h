@@ -16,6 +16,7 @@
 // under the License.
 #pragma once
 
+#include <concurrentqueue.h>
 #include <glog/logging.h>
 #include <stddef.h>
 #include <stdint.h>
@@ -57,8 +58,22 @@ public:
 
     bool empty() { return _queue.empty(); }
 
+    // Used by PriorityTaskQueue in lock free mode, may be called by any thread concurrently.
+    // The size is increased before enqueue and decreased after dequeue, so it never underflows
+    // and non-zero only means there may be a task.
+    void push_back_lock_free(PipelineTaskSPtr task) {
+        _lock_free_size.fetch_add(1);
+        _lock_free_queue.enqueue(std::move(task));
+    }
+
+    PipelineTaskSPtr try_take_lock_free();
+
+    bool empty_lock_free() const { return _lock_free_size.load(std::memory_order_relaxed) == 0; }
+
 private:
     std::queue<PipelineTaskSPtr> _queue;
+    moodycamel::ConcurrentQueue<PipelineTaskSPtr> _lock_free_queue;
+    std::atomic<size_t> _lock_free_size = 0;
     // depends on LEVEL_QUEUE_TIME_FACTOR
     double _level_factor = 1;
 
@@ -66,10 +81,15 @@ private:
 };
 
 // A Multilevel Feedback Queue
+// In lock free mode (config::enable_lock_free_pipeline_task_queue) the sub queues are lock free
+// MPMC queues, push/try_take never take `_work_size_mutex`, and the mutex is only used to park
+// an idle worker thread in `take`.
 class PriorityTaskQueue {
 public:
     PriorityTaskQueue();
 
+    explicit PriorityTaskQueue(bool lock_free);
+
     void close();
 
     PipelineTaskSPtr try_take(bool is_steal);
@@ -82,8 +102,15 @@ public:
         _sub_queues[level].inc_runtime(runtime);
     }
 
+    bool is_lock_free() const { return _lock_free; }
+
 private:
     PipelineTaskSPtr _try_take_unprotected(bool is_steal);
+    PipelineTaskSPtr _try_take_lock_free();
+    PipelineTaskSPtr _take_lock_free(uint32_t timeout_ms);
+    Status _push_lock_free(PipelineTaskSPtr task, int level);
+    // decrease `_total_task_size` after a task is taken, never below 0
+    void _dec_total_task_size();
     static constexpr auto LEVEL_QUEUE_TIME_FACTOR = 2;
     static constexpr size_t SUB_QUEUE_LEVEL = 6;
     SubTaskQueue _sub_queues[SUB_QUEUE_LEVEL];
@@ -93,19 +120,24 @@ private:
     std::mutex _work_size_mutex;
     std::condition_variable _wait_task;
     std::atomic<size_t> _total_task_size = 0;
-    bool _closed;
+    std::atomic<bool> _closed;
+    const bool _lock_free;
+    // number of threads waiting on `_wait_task` in lock free mode
+    std::atomic<int> _num_waiters = 0;
 
     // used to adjust vruntime of a queue when it's not empty
-    // protected by lock _work_size_mutex
-    uint64_t _queue_level_min_vruntime = 0;
+    // protected by lock _work_size_mutex in locked mode
+    std::atomic<uint64_t> _queue_level_min_vruntime = 0;
 
     int _compute_level(uint64_t real_runtime);
 };
 
-// Need consider NUMA architecture
+// Cores are split into `numa_node_num` contiguous groups, one per NUMA node. A core always
+// steals from the cores of its own node first, so that tasks (and the operator states they
+// touch) stay on the node where their memory was allocated.
 class MultiCoreTaskQueue {
 public:
-    explicit MultiCoreTaskQueue(int core_size);
+    explicit MultiCoreTaskQueue(int core_size, int numa_node_num = 1);
 
 #ifndef BE_TEST
     ~MultiCoreTaskQueue();
@@ -126,14 +158,26 @@ public:
 
     int cores() const { return _core_size; }
 
+    int numa_node_num() const { return _numa_node_num; }
+
+    int numa_node_of_core(int core_id) const { return _core_to_numa_node[core_id]; }
+
 private:
     PipelineTaskSPtr _steal_take(int core_id);
 
+    // Pick a core for a task which has never been scheduled. Tasks of the same query are
+    // placed on the same NUMA node when there is more than one node.
+    int _next_core_for(const PipelineTask& task);
+
     std::vector<PriorityTaskQueue> _prio_task_queues;
     std::atomic<uint32_t> _next_core = 0;
     std::atomic<bool> _closed;
 
     int _core_size;
+    int _numa_node_num;
+    std::vector<int> _core_to_numa_node;
+    std::vector<std::vector<int>> _numa_node_to_cores;
+    std::unique_ptr<std::atomic<uint32_t>[]> _next_core_of_node;
     static constexpr auto WAIT_CORE_TASK_TIMEOUT_MS = 100;
 };
 #include "common/compile_check_end.h"
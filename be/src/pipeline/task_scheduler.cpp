@@ -21,6 +21,7 @@
 #include <gen_cpp/Types_types.h>
 #include <gen_cpp/types.pb.h>
 #include <glog/logging.h>
+#include <pthread.h>
 #include <sched.h>
 
 // IWYU pragma: no_include <bits/chrono.h>
@@ -42,6 +43,8 @@
 #include "runtime/exec_env.h"
 #include "runtime/query_context.h"
 #include "runtime/thread_context.h"
+#include "util/cpu_info.h"
+#include "util/stopwatch.hpp"
 #include "util/thread.h"
 #include "util/threadpool.h"
 #include "util/time.h"
@@ -55,6 +58,40 @@ TaskScheduler::~TaskScheduler() {
     LOG(INFO) << "Task scheduler " << _name << " shutdown";
 }
 
+std::vector<int> TaskScheduler::_numa_nodes_for_scheduling() {
+    std::vector<int> nodes;
+    if (config::enable_pipeline_task_numa_aware) {
+        for (int node = 0; node < CpuInfo::get_max_num_numa_nodes(); ++node) {
+            if (!CpuInfo::get_cores_of_numa_node(node).empty()) {
+                nodes.push_back(node);
+            }
+        }
+    }
+    if (nodes.size() <= 1) {
+        return {0};
+    }
+    return nodes;
+}
+
+void TaskScheduler::_bind_to_numa_node(int index) {
+    if (_task_queue.numa_node_num() <= 1) {
+        return;
+    }
+#ifndef __APPLE__
+    int node = _numa_nodes[_task_queue.numa_node_of_core(index)];
+    cpu_set_t cpu_set;
+    CPU_ZERO(&cpu_set);
+    for (int core : CpuInfo::get_cores_of_numa_node(node)) {
+        CPU_SET(core, &cpu_set);
+    }
+    int ret = pthread_setaffinity_np(pthread_self(), sizeof(cpu_set), &cpu_set);
+    if (ret != 0) {
+        LOG(WARNING) << "Task scheduler " << _name << " failed to bind worker " << index
+                     << " to numa node " << node << ", errno: " << ret;
+    }
+#endif
+}
+
 Status TaskScheduler::start() {
     int cores = _task_queue.cores();
     RETURN_IF_ERROR(ThreadPoolBuilder(_name)
@@ -63,7 +100,9 @@ Status TaskScheduler::start() {
                             .set_max_queue_size(0)
                             .set_cgroup_cpu_ctl(_cgroup_cpu_ctl)
                             .build(&_fix_thread_pool));
-    LOG_INFO("TaskScheduler set cores").tag("size", cores);
+    LOG_INFO("TaskScheduler set cores")
+            .tag("size", cores)
+            .tag("numa_nodes", _task_queue.numa_node_num());
     for (int32_t i = 0; i < cores; ++i) {
         RETURN_IF_ERROR(_fix_thread_pool->submit_func([this, i] { _do_work(i); }));
     }
@@ -96,7 +135,11 @@ void close_task(PipelineTask* task, Status exec_status, PipelineFragmentContext*
 }
 
 void TaskScheduler::_do_work(int index) {
+    _bind_to_numa_node(index);
     while (!_need_to_stop) {
+        if (_cpu_quota) {
+            _cpu_quota->wait_for_quota();
+        }
         auto task = _task_queue.take(index);
         if (!task) {
             continue;
@@ -140,6 +183,10 @@ void TaskScheduler::_do_work(int index) {
             continue;
         }
 
+        ThreadCpuStopWatch cpu_watch;
+        if (_cpu_quota) {
+            cpu_watch.start();
+        }
         // Main logics of execution
         ASSIGN_STATUS_IF_CATCH_EXCEPTION(
                 //TODO: use a better enclose to abstracting these
@@ -156,9 +203,13 @@ void TaskScheduler::_do_work(int index) {
                     uint64_t end_time = MonotonicMicros();
                     ExecEnv::GetInstance()->pipeline_tracer_context()->record(
                             {query_id, task_name, static_cast<uint32_t>(index), thread_id,
-                             start_time, end_time});
+                             start_time, end_time,
+                             status.ok() ? task->exec_end_state(done) : "failed"});
                 } else { status = task->execute(&done); },
                 status);
+        if (_cpu_quota) {
+            _cpu_quota->consume(cpu_watch.elapsed_time());
+        }
         fragment_context->trigger_report_if_necessary();
     }
 }
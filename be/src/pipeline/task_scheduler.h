@@ -31,6 +31,7 @@
 #include "pipeline_task.h"
 #include "runtime/query_context.h"
 #include "runtime/workload_group/workload_group.h"
+#include "runtime/workload_group/workload_group_cpu_quota.h"
 #include "task_queue.h"
 #include "util/thread.h"
 #include "util/uid_util.h"
@@ -44,8 +45,13 @@ namespace doris::pipeline {
 
 class TaskScheduler {
 public:
-    TaskScheduler(int core_num, std::string name, std::shared_ptr<CgroupCpuCtl> cgroup_cpu_ctl)
-            : _task_queue(core_num), _name(std::move(name)), _cgroup_cpu_ctl(cgroup_cpu_ctl) {}
+    TaskScheduler(int core_num, std::string name, std::shared_ptr<CgroupCpuCtl> cgroup_cpu_ctl,
+                  std::shared_ptr<WorkloadGroupCpuQuota> cpu_quota = nullptr)
+            : _numa_nodes(_numa_nodes_for_scheduling()),
+              _task_queue(core_num, int(_numa_nodes.size())),
+              _name(std::move(name)),
+              _cgroup_cpu_ctl(cgroup_cpu_ctl),
+              _cpu_quota(std::move(cpu_quota)) {}
 
     ~TaskScheduler();
 
@@ -58,13 +64,23 @@ public:
     std::vector<int> thread_debug_info() { return _fix_thread_pool->debug_info(); }
 
 private:
+    // Returns the NUMA nodes (which own at least one cpu) used to group worker threads,
+    // or a single placeholder node if NUMA aware scheduling is disabled.
+    static std::vector<int> _numa_nodes_for_scheduling();
+
+    // Bind the worker thread to the cpus of the NUMA node of the given core.
+    void _bind_to_numa_node(int index);
+
     std::unique_ptr<ThreadPool> _fix_thread_pool;
 
+    std::vector<int> _numa_nodes;
     MultiCoreTaskQueue _task_queue;
     bool _need_to_stop = false;
     bool _shutdown = false;
     std::string _name;
     std::weak_ptr<CgroupCpuCtl> _cgroup_cpu_ctl;
+    // in process cpu limit of the workload group, used instead of a cgroup
+    std::shared_ptr<WorkloadGroupCpuQuota> _cpu_quota;
 
     void _do_work(int index);
 };
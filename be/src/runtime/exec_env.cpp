@@ -20,11 +20,13 @@
 #include <gen_cpp/HeartbeatService_types.h>
 #include <glog/logging.h>
 
+#include <limits>
 #include <mutex>
 #include <utility>
 
 #include "common/config.h"
 #include "common/logging.h"
+#include "olap/memtable_memory_limiter.h"
 #include "olap/olap_define.h"
 #include "olap/storage_engine.h"
 #include "olap/tablet_manager.h"
@@ -160,7 +162,30 @@ std::map<TNetworkAddress, FrontendInfo> ExecEnv::get_running_frontends() {
     return res;
 }
 
+void ExecEnv::start_drain() {
+    int64_t expected = 0;
+    if (!_s_drain_start_ms.compare_exchange_strong(expected, UnixMillis())) {
+        return;
+    }
+    LOG(INFO) << "start draining, running queries: "
+              << (_fragment_mgr != nullptr ? _fragment_mgr->running_query_num() : 0);
+    // Flush tokens flush memtables in parallel, so writers finish earlier than waiting for the
+    // memtables to be full.
+    if (_memtable_memory_limiter != nullptr) {
+        int64_t flushed = _memtable_memory_limiter->flush_workload_group_memtables(
+                0, std::numeric_limits<int64_t>::max());
+        LOG(INFO) << "flushed " << flushed << " bytes of active memtables for draining";
+    }
+}
+
+void ExecEnv::cancel_drain() {
+    if (_s_drain_start_ms.exchange(0) > 0) {
+        LOG(INFO) << "cancel draining";
+    }
+}
+
 void ExecEnv::wait_for_all_tasks_done() {
+    start_drain();
     // For graceful shutdown, need to wait for all running queries to stop
     int32_t wait_seconds_passed = 0;
     while (true) {
@@ -115,6 +115,7 @@ class TabletSchemaCache;
 class TabletColumnObjectPool;
 class UserFunctionCache;
 class SchemaCache;
+class RegexpCache;
 class StoragePageCache;
 class SegmentLoader;
 class LookupConnectionCache;
@@ -169,6 +170,14 @@ public:
     static bool tracking_memory() { return _s_tracking_memory.load(std::memory_order_acquire); }
     static bool get_is_upgrading() { return _s_upgrading.load(std::memory_order_acquire); }
     static void set_is_upgrading() { _s_upgrading = true; }
+    // While draining, new queries are rejected, compactions stop at the next block and active
+    // memtables are flushed, so that the in-flight work finishes before the BE stops. The running
+    // merges exit with an error, their compactions are retried after the BE restarts or the drain
+    // is canceled.
+    static bool is_draining() { return _s_drain_start_ms.load(std::memory_order_acquire) > 0; }
+    static int64_t drain_start_ms() { return _s_drain_start_ms.load(std::memory_order_acquire); }
+    void start_drain();
+    static void cancel_drain();
     const std::string& token() const;
     ExternalScanContextMgr* external_scan_context_mgr() { return _external_scan_context_mgr; }
     vectorized::VDataStreamMgr* vstream_mgr() { return _vstream_mgr; }
@@ -196,6 +205,9 @@ public:
     std::vector<TrackerLimiterGroup> mem_tracker_limiter_pool;
     void init_mem_tracker();
     std::shared_ptr<MemTrackerLimiter> orphan_mem_tracker() { return _orphan_mem_tracker; }
+    std::shared_ptr<MemTrackerLimiter> column_buffer_pool_mem_tracker() {
+        return _column_buffer_pool_mem_tracker;
+    }
     std::shared_ptr<MemTrackerLimiter> brpc_iobuf_block_memory_tracker() {
         return _brpc_iobuf_block_memory_tracker;
     }
@@ -237,7 +249,12 @@ public:
         return _buffered_reader_prefetch_thread_pool.get();
     }
     ThreadPool* send_table_stats_thread_pool() { return _send_table_stats_thread_pool.get(); }
+    ThreadPool* result_serialize_thread_pool() { return _result_serialize_thread_pool.get(); }
+    ThreadPool* segment_column_writer_thread_pool() {
+        return _segment_column_writer_thread_pool.get();
+    }
     ThreadPool* s3_file_upload_thread_pool() { return _s3_file_upload_thread_pool.get(); }
+    ThreadPool* s3_parallel_read_thread_pool() { return _s3_parallel_read_thread_pool.get(); }
     ThreadPool* lazy_release_obj_pool() { return _lazy_release_obj_pool.get(); }
     ThreadPool* non_block_close_thread_pool();
     ThreadPool* s3_file_system_thread_pool() { return _s3_file_system_thread_pool.get(); }
@@ -257,6 +274,10 @@ public:
     BrpcClientCache<PBackendService_Stub>* brpc_streaming_client_cache() const {
         return _streaming_client_cache;
     }
+    // Stubs used by exchange to send data to remote BEs, over RDMA if enable_brpc_rdma is set.
+    BrpcClientCache<PBackendService_Stub>* brpc_exchange_client_cache() const {
+        return _exchange_client_cache != nullptr ? _exchange_client_cache : _internal_client_cache;
+    }
     BrpcClientCache<PFunctionService_Stub>* brpc_function_client_cache() const {
         return _function_client_cache;
     }
@@ -340,6 +361,7 @@ public:
     TabletSchemaCache* get_tablet_schema_cache() { return _tablet_schema_cache; }
     TabletColumnObjectPool* get_tablet_column_object_pool() { return _tablet_column_object_pool; }
     SchemaCache* schema_cache() { return _schema_cache; }
+    RegexpCache* regexp_cache() { return _regexp_cache; }
     StoragePageCache* get_storage_page_cache() { return _storage_page_cache; }
     SegmentLoader* segment_loader() { return _segment_loader; }
     LookupConnectionCache* get_lookup_connection_cache() { return _lookup_connection_cache; }
@@ -397,6 +419,7 @@ private:
     std::vector<StorePath> _store_paths;
     std::vector<StorePath> _spill_store_paths;
     inline static std::atomic_bool _s_upgrading {false};
+    inline static std::atomic<int64_t> _s_drain_start_ms {0};
 
     io::FileCacheFactory* _file_cache_factory = nullptr;
     UserFunctionCache* _user_function_cache = nullptr;
@@ -416,6 +439,8 @@ private:
     // and the consumption of the orphan mem tracker is close to 0, but greater than 0.
     std::shared_ptr<MemTrackerLimiter> _orphan_mem_tracker;
     std::shared_ptr<MemTrackerLimiter> _brpc_iobuf_block_memory_tracker;
+    // Buffers cached by ColumnBufferPool, refreshed by the daemon.
+    std::shared_ptr<MemTrackerLimiter> _column_buffer_pool_mem_tracker;
     // Count the memory consumption of segment compaction tasks.
     std::shared_ptr<MemTrackerLimiter> _segcompaction_mem_tracker;
     std::shared_ptr<MemTrackerLimiter> _stream_load_pipe_tracker;
@@ -442,8 +467,14 @@ private:
     std::unique_ptr<ThreadPool> _buffered_reader_prefetch_thread_pool;
     // Threadpool used to send TableStats to FE
     std::unique_ptr<ThreadPool> _send_table_stats_thread_pool;
+    // Threadpool used to convert result blocks to MySQL rows in parallel
+    std::unique_ptr<ThreadPool> _result_serialize_thread_pool;
+    // Threadpool used to encode independent columns of one segment in parallel
+    std::unique_ptr<ThreadPool> _segment_column_writer_thread_pool;
     // Threadpool used to upload local file to s3
     std::unique_ptr<ThreadPool> _s3_file_upload_thread_pool;
+    // Threadpool used to issue the ranged GETs of one large s3 read concurrently
+    std::unique_ptr<ThreadPool> _s3_parallel_read_thread_pool;
     // Pool used by join node to build hash table
     // Pool to use a new thread to release object
     std::unique_ptr<ThreadPool> _lazy_release_obj_pool;
@@ -464,6 +495,7 @@ private:
     std::unique_ptr<NewLoadStreamMgr> _new_load_stream_mgr;
     BrpcClientCache<PBackendService_Stub>* _internal_client_cache = nullptr;
     BrpcClientCache<PBackendService_Stub>* _streaming_client_cache = nullptr;
+    BrpcClientCache<PBackendService_Stub>* _exchange_client_cache = nullptr;
     BrpcClientCache<PFunctionService_Stub>* _function_client_cache = nullptr;
 
     std::unique_ptr<StreamLoadExecutor> _stream_load_executor;
@@ -494,6 +526,7 @@ private:
     TabletColumnObjectPool* _tablet_column_object_pool = nullptr;
     std::unique_ptr<BaseStorageEngine> _storage_engine;
     SchemaCache* _schema_cache = nullptr;
+    RegexpCache* _regexp_cache = nullptr;
     StoragePageCache* _storage_page_cache = nullptr;
     SegmentLoader* _segment_loader = nullptr;
     LookupConnectionCache* _lookup_connection_cache = nullptr;
@@ -42,6 +42,7 @@
 #include "common/kerberos/kerberos_ticket_mgr.h"
 #include "common/logging.h"
 #include "common/status.h"
+#include "exprs/regexp_cache.h"
 #include "io/cache/block_file_cache.h"
 #include "io/cache/block_file_cache_downloader.h"
 #include "io/cache/block_file_cache_factory.h"
@@ -253,6 +254,16 @@ Status ExecEnv::_init(const std::vector<StorePath>& store_paths,
                               .set_max_threads(32)
                               .build(&_send_table_stats_thread_pool));
 
+    static_cast<void>(ThreadPoolBuilder("ResultSerializeThreadPool")
+                              .set_min_threads(0)
+                              .set_max_threads(CpuInfo::num_cores())
+                              .build(&_result_serialize_thread_pool));
+
+    static_cast<void>(ThreadPoolBuilder("SegmentColumnWriterThreadPool")
+                              .set_min_threads(0)
+                              .set_max_threads(CpuInfo::num_cores())
+                              .build(&_segment_column_writer_thread_pool));
+
     auto [s3_file_upload_min_threads, s3_file_upload_max_threads] =
             get_num_threads(config::num_s3_file_upload_thread_pool_min_thread,
                             config::num_s3_file_upload_thread_pool_max_thread);
@@ -261,6 +272,14 @@ Status ExecEnv::_init(const std::vector<StorePath>& store_paths,
                               .set_max_threads(cast_set<int>(s3_file_upload_max_threads))
                               .build(&_s3_file_upload_thread_pool));
 
+    auto [s3_parallel_read_min_threads, s3_parallel_read_max_threads] =
+            get_num_threads(config::num_s3_parallel_read_thread_pool_min_thread,
+                            config::num_s3_parallel_read_thread_pool_max_thread);
+    static_cast<void>(ThreadPoolBuilder("S3ParallelReadThreadPool")
+                              .set_min_threads(cast_set<int>(s3_parallel_read_min_threads))
+                              .set_max_threads(cast_set<int>(s3_parallel_read_max_threads))
+                              .build(&_s3_parallel_read_thread_pool));
+
     // min num equal to fragment pool's min num
     // max num is useless because it will start as many as requested in the past
     // queue size is useless because the max thread num is very large
@@ -311,6 +330,10 @@ Status ExecEnv::_init(const std::vector<StorePath>& store_paths,
     _internal_client_cache = new BrpcClientCache<PBackendService_Stub>();
     _streaming_client_cache =
             new BrpcClientCache<PBackendService_Stub>("baidu_std", "single", "streaming");
+    if (config::enable_brpc_rdma) {
+        _exchange_client_cache =
+                new BrpcClientCache<PBackendService_Stub>("baidu_std", "", "exchange", true);
+    }
     _function_client_cache =
             new BrpcClientCache<PFunctionService_Stub>(config::function_service_protocol);
     if (config::is_cloud_mode()) {
@@ -556,6 +579,9 @@ Status ExecEnv::_init_mem_env() {
               << " min_segment_cache_mem_limit " << segment_cache_mem_limit;
 
     _schema_cache = new SchemaCache(config::schema_cache_capacity);
+    if (config::regexp_cache_capacity > 0) {
+        _regexp_cache = new RegexpCache(config::regexp_cache_capacity);
+    }
 
     size_t block_file_cache_fd_cache_size =
             std::min((uint64_t)config::file_cache_max_file_reader_cache_size, fd_number / 3);
@@ -626,6 +652,8 @@ void ExecEnv::init_mem_tracker() {
             MemTrackerLimiter::create_shared(MemTrackerLimiter::Type::GLOBAL, "Orphan");
     _brpc_iobuf_block_memory_tracker =
             MemTrackerLimiter::create_shared(MemTrackerLimiter::Type::GLOBAL, "IOBufBlockMemory");
+    _column_buffer_pool_mem_tracker =
+            MemTrackerLimiter::create_shared(MemTrackerLimiter::Type::GLOBAL, "ColumnBufferPool");
     _segcompaction_mem_tracker =
             MemTrackerLimiter::create_shared(MemTrackerLimiter::Type::COMPACTION, "SegCompaction");
     _tablets_no_cache_mem_tracker = MemTrackerLimiter::create_shared(
@@ -769,11 +797,14 @@ void ExecEnv::destroy() {
     }
     SAFE_SHUTDOWN(_buffered_reader_prefetch_thread_pool);
     SAFE_SHUTDOWN(_s3_file_upload_thread_pool);
+    SAFE_SHUTDOWN(_s3_parallel_read_thread_pool);
     SAFE_SHUTDOWN(_lazy_release_obj_pool);
     SAFE_SHUTDOWN(_non_block_close_thread_pool);
     SAFE_SHUTDOWN(_s3_file_system_thread_pool);
     SAFE_SHUTDOWN(_send_batch_thread_pool);
     SAFE_SHUTDOWN(_send_table_stats_thread_pool);
+    SAFE_SHUTDOWN(_result_serialize_thread_pool);
+    SAFE_SHUTDOWN(_segment_column_writer_thread_pool);
 
     SAFE_DELETE(_load_channel_mgr);
 
@@ -781,6 +812,7 @@ void ExecEnv::destroy() {
     SAFE_DELETE(_inverted_index_searcher_cache);
     SAFE_DELETE(_lookup_connection_cache);
     SAFE_DELETE(_schema_cache);
+    SAFE_DELETE(_regexp_cache);
     SAFE_DELETE(_segment_loader);
     SAFE_DELETE(_row_cache);
     SAFE_DELETE(_query_cache);
@@ -806,6 +838,7 @@ void ExecEnv::destroy() {
     // _stream_load_executor
     SAFE_DELETE(_function_client_cache);
     SAFE_DELETE(_streaming_client_cache);
+    SAFE_DELETE(_exchange_client_cache);
     SAFE_DELETE(_internal_client_cache);
 
     SAFE_DELETE(_bfd_parser);
@@ -825,8 +858,11 @@ void ExecEnv::destroy() {
     _non_block_close_thread_pool.reset(nullptr);
     _s3_file_system_thread_pool.reset(nullptr);
     _send_table_stats_thread_pool.reset(nullptr);
+    _result_serialize_thread_pool.reset(nullptr);
+    _segment_column_writer_thread_pool.reset(nullptr);
     _buffered_reader_prefetch_thread_pool.reset(nullptr);
     _s3_file_upload_thread_pool.reset(nullptr);
+    _s3_parallel_read_thread_pool.reset(nullptr);
     _send_batch_thread_pool.reset(nullptr);
     _write_cooldown_meta_executors.reset(nullptr);
 
@@ -0,0 +1,117 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "runtime/fragment_capture.h"
+
+#include <fmt/format.h>
+#include <gen_cpp/PaloInternalService_types.h>
+
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+
+#include "common/cast_set.h"
+#include "common/config.h"
+#include "common/logging.h"
+#include "io/fs/local_file_system.h"
+#include "util/hash_util.hpp"
+#include "util/thrift_util.h"
+#include "util/uid_util.h"
+
+namespace doris {
+#include "common/compile_check_begin.h"
+
+void FragmentCapture::capture(const TPipelineFragmentParams& params) {
+    if (_num_captured.fetch_add(1) >= config::fragment_capture_max_num) {
+        return;
+    }
+    auto name = fragment_name(params.query_id, params.fragment_id);
+    uint64_t fragment_fingerprint = 0;
+    std::string content;
+    ThriftSerializer serializer(true, 4096);
+    auto st = fingerprint(params, &fragment_fingerprint);
+    if (st.ok()) {
+        st = serializer.serialize(&params, &content);
+    }
+    {
+        std::lock_guard<std::mutex> l(_lock);
+        if (st.ok() && !_dir_created) {
+            st = io::global_local_filesystem()->create_directory(config::fragment_capture_dir);
+            _dir_created = st.ok();
+        }
+        if (st.ok()) {
+            _running_fragments[name] = fragment_fingerprint;
+        }
+    }
+    if (st.ok()) {
+        auto path = std::filesystem::path(config::fragment_capture_dir) /
+                    (name + FRAGMENT_FILE_SUFFIX);
+        std::ofstream file(path, std::ios::out | std::ios::binary | std::ios::trunc);
+        file.write(content.data(), static_cast<std::streamsize>(content.size()));
+        if (!file) {
+            st = Status::IOError("failed to write {}", path.native());
+        }
+    }
+    if (!st.ok()) {
+        LOG(WARNING) << "failed to capture fragment " << name << ": " << st;
+    }
+}
+
+void FragmentCapture::finish(const TUniqueId& query_id, int fragment_id, int64_t exec_time_ns) {
+    auto name = fragment_name(query_id, fragment_id);
+    std::lock_guard<std::mutex> l(_lock);
+    auto it = _running_fragments.find(name);
+    if (it == _running_fragments.end()) {
+        return;
+    }
+    std::ofstream file(std::filesystem::path(config::fragment_capture_dir) / TIMING_FILE_NAME,
+                       std::ios::out | std::ios::app);
+    file << name << " " << it->second << " " << exec_time_ns / 1000 << "\n";
+    _running_fragments.erase(it);
+}
+
+std::string FragmentCapture::fragment_name(const TUniqueId& query_id, int fragment_id) {
+    return fmt::format("{}_{}", print_id(query_id), fragment_id);
+}
+
+Status FragmentCapture::fingerprint(const TPipelineFragmentParams& params,
+                                    uint64_t* fingerprint) {
+    if (!params.__isset.fragment) {
+        return Status::InvalidArgument("fragment {} has no plan", params.fragment_id);
+    }
+    ThriftSerializer serializer(true, 4096);
+    std::string plan;
+    RETURN_IF_ERROR(serializer.serialize(&params.fragment, &plan));
+    *fingerprint = HashUtil::xxHash64WithSeed(plan.data(), plan.size(), 0);
+    return Status::OK();
+}
+
+Status FragmentCapture::read_fragment(const std::string& path, TPipelineFragmentParams* params) {
+    std::ifstream file(path, std::ios::in | std::ios::binary);
+    if (!file) {
+        return Status::IOError("failed to open {}", path);
+    }
+    std::stringstream content;
+    content << file.rdbuf();
+    auto buf = content.str();
+    auto len = cast_set<uint32_t>(buf.size());
+    return deserialize_thrift_msg(reinterpret_cast<const uint8_t*>(buf.data()), &len, true,
+                                  params);
+}
+
+#include "common/compile_check_end.h"
+} // namespace doris
@@ -0,0 +1,66 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <gen_cpp/Types_types.h>
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "common/status.h"
+
+namespace doris {
+class TPipelineFragmentParams;
+
+// Saves the params of pipeline fragments executed on this BE and how long they ran, so that a
+// production workload can be inspected offline and compared across BE versions.
+//
+// Each captured fragment is saved to `<query_id>_<fragment_id>.fragment` in
+// `config::fragment_capture_dir` as compact thrift. Once it finishes, a line of
+// `<query_id>_<fragment_id> <fingerprint> <exec_time_us>` is appended to `fragment_timing.log`.
+class FragmentCapture {
+public:
+    static constexpr const char* FRAGMENT_FILE_SUFFIX = ".fragment";
+    static constexpr const char* TIMING_FILE_NAME = "fragment_timing.log";
+
+    void capture(const TPipelineFragmentParams& params);
+
+    // Does nothing if the fragment was not captured.
+    void finish(const TUniqueId& query_id, int fragment_id, int64_t exec_time_ns);
+
+    static std::string fragment_name(const TUniqueId& query_id, int fragment_id);
+
+    // Identifies the same plan fragment in the captures of different runs of a query, the query
+    // and instance ids are not part of it.
+    static Status fingerprint(const TPipelineFragmentParams& params, uint64_t* fingerprint);
+
+    static Status read_fragment(const std::string& path, TPipelineFragmentParams* params);
+
+private:
+    std::atomic<int64_t> _num_captured = 0;
+
+    std::mutex _lock;
+    bool _dir_created = false;
+    // fragment name -> fingerprint of the captured fragments still running
+    std::unordered_map<std::string, uint64_t> _running_fragments;
+};
+
+} // namespace doris
@@ -661,6 +661,12 @@ void FragmentMgr::remove_pipeline_context(std::pair<TUniqueId, int> key) {
     g_fragment_executing_count << -1;
     g_fragment_last_active_time.set_value(now);
 
+    if (config::enable_fragment_capture) {
+        if (auto context = _pipeline_map.find(key); context != nullptr) {
+            _fragment_capture.finish(key.first, key.second,
+                                     static_cast<int64_t>(context->elapsed_time()));
+        }
+    }
     _pipeline_map.erase(key);
 }
 
@@ -695,6 +701,12 @@ Status FragmentMgr::_get_or_create_query_ctx(const TPipelineFragmentParams& para
         }
     } else {
         if (!query_ctx) {
+            // Fragments of in-flight queries are still accepted.
+            if (ExecEnv::is_draining()) {
+                return Status::Error<ErrorCode::SERVICE_UNAVAILABLE>(
+                        "BE {} is draining, reject new query {}", BackendOptions::get_localhost(),
+                        print_id(query_id));
+            }
             RETURN_IF_ERROR(_query_ctx_map.apply_if_not_exists(
                     query_id, query_ctx,
                     [&](phmap::flat_hash_map<TUniqueId, std::weak_ptr<QueryContext>>& map)
@@ -877,6 +889,10 @@ Status FragmentMgr::exec_plan_fragment(const TPipelineFragmentParams& params,
         _pipeline_map.insert({params.query_id, params.fragment_id}, context);
     }
 
+    if (config::enable_fragment_capture) {
+        _fragment_capture.capture(params);
+    }
+
     if (!params.__isset.need_wait_execution_trigger || !params.need_wait_execution_trigger) {
         query_ctx->set_ready_to_execute_only();
     }
@@ -1151,6 +1167,8 @@ void FragmentMgr::_check_brpc_available(const std::shared_ptr<PBackendService_St
                          << ":" << brpc_item.network_address.port << ", error: " << error_message;
             ExecEnv::GetInstance()->brpc_internal_client_cache()->erase(
                     brpc_item.network_address.hostname, brpc_item.network_address.port);
+            ExecEnv::GetInstance()->brpc_exchange_client_cache()->erase(
+                    brpc_item.network_address.hostname, brpc_item.network_address.port);
             break;
         }
     }
@@ -1274,7 +1292,10 @@ Status FragmentMgr::apply_filterv2(const PPublishFilterRequestV2* request,
         // 2. create the filter wrapper to replace or ignore/disable the target filters
         if (!filters.empty()) {
             RETURN_IF_ERROR(filters[0]->assign(*request, attach_data));
-            std::ranges::for_each(filters, [&](auto& filter) { filter->signal(filters[0].get()); });
+            std::ranges::for_each(filters, [&](auto& filter) {
+                filter->set_merge_time(request->merge_time());
+                filter->signal(filters[0].get());
+            });
         }
     }
     return Status::OK();
@@ -1357,6 +1378,20 @@ void FragmentMgr::get_runtime_query_info(
             });
 }
 
+std::vector<std::shared_ptr<QueryContext>> FragmentMgr::get_running_query_ctxs() {
+    std::vector<std::shared_ptr<QueryContext>> query_ctxs;
+    _query_ctx_map.apply(
+            [&](phmap::flat_hash_map<TUniqueId, std::weak_ptr<QueryContext>>& map) -> Status {
+                for (const auto& [_, weak_ctx] : map) {
+                    if (auto q_ctx = weak_ctx.lock()) {
+                        query_ctxs.push_back(std::move(q_ctx));
+                    }
+                }
+                return Status::OK();
+            });
+    return query_ctxs;
+}
+
 Status FragmentMgr::get_realtime_exec_status(const TUniqueId& query_id,
                                              TReportExecStatusParams* exec_status) {
     if (exec_status == nullptr) {
@@ -35,6 +35,7 @@
 #include "common/status.h"
 #include "gutil/ref_counted.h"
 #include "http/rest_monitor_iface.h"
+#include "runtime/fragment_capture.h"
 #include "runtime/query_context.h"
 #include "runtime_filter/runtime_filter_mgr.h"
 #include "util/countdown_latch.h"
@@ -183,6 +184,9 @@ public:
 
     void get_runtime_query_info(std::vector<std::weak_ptr<ResourceContext>>* _resource_ctx_list);
 
+    // Contexts of all queries still running on this backend.
+    std::vector<std::shared_ptr<QueryContext>> get_running_query_ctxs();
+
     Status get_realtime_exec_status(const TUniqueId& query_id,
                                     TReportExecStatusParams* exec_status);
     // get the query statistics of with a given query id
@@ -217,6 +221,9 @@ private:
     ConcurrentContextMap<TUniqueId, std::weak_ptr<QueryContext>, QueryContext> _query_ctx_map;
     std::unordered_map<TUniqueId, std::unordered_map<int, int64_t>> _bf_size_map;
 
+    // Used when config::enable_fragment_capture is on.
+    FragmentCapture _fragment_capture;
+
     CountDownLatch _stop_background_threads_latch;
     scoped_refptr<Thread> _cancel_thread;
     // This pool is used as global async task pool
@@ -17,6 +17,7 @@
 
 #include "runtime/group_commit_mgr.h"
 
+#include <bvar/latency_recorder.h>
 #include <gen_cpp/Types_types.h>
 #include <glog/logging.h>
 
@@ -37,6 +38,9 @@ namespace doris {
 #include "common/compile_check_begin.h"
 
 bvar::Adder<uint64_t> group_commit_block_by_memory_counter("group_commit_block_by_memory_counter");
+bvar::LatencyRecorder g_group_commit_wal_write_latency("group_commit", "wal_write");
+bvar::LatencyRecorder g_group_commit_block_queue_wait_latency("group_commit", "block_queue_wait");
+bvar::LatencyRecorder g_group_commit_commit_txn_latency("group_commit", "commit_txn");
 
 std::string LoadBlockQueue::_get_load_ids() {
     std::stringstream ss;
@@ -76,7 +80,12 @@ Status LoadBlockQueue::add_block(RuntimeState* runtime_state,
                        << ", instance_id=" << load_instance_id << ", load_ids=" << _get_load_ids();
         }
         if (write_wal || config::group_commit_wait_replay_wal_finish) {
+            auto write_wal_start = std::chrono::steady_clock::now();
             auto st = _v_wal_writer->write_wal(block.get());
+            g_group_commit_wal_write_latency
+                    << std::chrono::duration_cast<std::chrono::microseconds>(
+                               std::chrono::steady_clock::now() - write_wal_start)
+                               .count();
             if (!st.ok()) {
                 _cancel_without_lock(st);
                 return st;
@@ -151,6 +160,10 @@ Status LoadBlockQueue::get_block(RuntimeState* runtime_state, vectorized::Block*
         }
     } else {
         const BlockData block_data = _block_queue.front();
+        g_group_commit_block_queue_wait_latency
+                << std::chrono::duration_cast<std::chrono::microseconds>(
+                           std::chrono::steady_clock::now() - block_data.enqueue_time)
+                           .count();
         block->swap(*block_data.block);
         *find_block = true;
         _block_queue.pop_front();
@@ -464,6 +477,7 @@ Status GroupCommitTable::_finish_group_commit_load(int64_t db_id, int64_t table_
         TLoadTxnCommitResult result;
         TNetworkAddress master_addr = _exec_env->cluster_info()->master_fe_addr;
         int retry_times = 0;
+        auto commit_txn_start = std::chrono::steady_clock::now();
         while (retry_times < config::mow_stream_load_commit_retry_times) {
             st = ThriftRpcHelper::rpc<FrontendServiceClient>(
                     master_addr.hostname, master_addr.port,
@@ -483,6 +497,10 @@ Status GroupCommitTable::_finish_group_commit_load(int64_t db_id, int64_t table_
                     .error(result_status);
             retry_times++;
         }
+        g_group_commit_commit_txn_latency << std::chrono::duration_cast<std::chrono::microseconds>(
+                                                     std::chrono::steady_clock::now() -
+                                                     commit_txn_start)
+                                                     .count();
         DBUG_EXECUTE_IF("LoadBlockQueue._finish_group_commit_load.commit_success_and_rpc_error",
                         { result_status = Status::InternalError("commit_success_and_rpc_error"); });
     } else {
@@ -20,6 +20,7 @@
 #include <gen_cpp/PaloInternalService_types.h>
 
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
 #include <cstdint>
 #include <future>
@@ -47,9 +48,12 @@ class Dependency;
 
 struct BlockData {
     BlockData(const std::shared_ptr<vectorized::Block>& block)
-            : block(block), block_bytes(block->bytes()) {};
+            : block(block),
+              block_bytes(block->bytes()),
+              enqueue_time(std::chrono::steady_clock::now()) {};
     std::shared_ptr<vectorized::Block> block;
     size_t block_bytes;
+    std::chrono::steady_clock::time_point enqueue_time;
 };
 
 class LoadBlockQueue {
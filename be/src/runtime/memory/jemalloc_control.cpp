@@ -131,6 +131,37 @@ void JemallocControl::je_decay_all_arena_dirty_pages() {
     action_jemallctl(fmt::format("arena.{}.decay", MALLCTL_ARENAS_ALL));
 }
 
+int64_t JemallocControl::je_create_arena(ssize_t dirty_decay_ms) {
+    unsigned arena_ind = 0;
+    size_t arena_ind_size = sizeof(arena_ind);
+    if (jemallctl("arenas.create", &arena_ind, &arena_ind_size, nullptr, 0) != 0) {
+        LOG(WARNING) << "Failed, jemallctl arenas.create";
+        return -1;
+    }
+    set_jemallctl_value<ssize_t>(fmt::format("arena.{}.dirty_decay_ms", arena_ind),
+                                 dirty_decay_ms);
+    return arena_ind;
+}
+
+int64_t JemallocControl::je_bind_thread_arena(unsigned arena_ind) {
+    unsigned old_arena_ind = 0;
+    size_t old_arena_ind_size = sizeof(old_arena_ind);
+    if (jemallctl("thread.arena", &old_arena_ind, &old_arena_ind_size, &arena_ind,
+                  sizeof(arena_ind)) != 0) {
+        LOG(WARNING) << fmt::format("Failed, jemallctl thread.arena set to {}", arena_ind);
+        return -1;
+    }
+    return old_arena_ind;
+}
+
+int64_t JemallocControl::get_je_arena_metrics(unsigned arena_ind, const std::string& name) {
+    return get_jemallctl_value<int64_t>(fmt::format("stats.arenas.{}.{}", arena_ind, name));
+}
+
+void JemallocControl::je_purge_arena_dirty_pages(unsigned arena_ind) {
+    action_jemallctl(fmt::format("arena.{}.purge", arena_ind));
+}
+
 void JemallocControl::je_thread_tcache_flush() {
     constexpr size_t TCACHE_LIMIT = (1ULL << 30); // 1G
     if (je_tcache_mem() > TCACHE_LIMIT) {
@@ -150,6 +181,16 @@ int64_t JemallocControl::get_je_all_arena_extents_metrics(int64_t page_size_inde
 void JemallocControl::je_purge_all_arena_dirty_pages() {}
 void JemallocControl::je_reset_all_arena_dirty_decay_ms(ssize_t dirty_decay_ms) {}
 void JemallocControl::je_decay_all_arena_dirty_pages() {}
+int64_t JemallocControl::je_create_arena(ssize_t dirty_decay_ms) {
+    return -1;
+}
+int64_t JemallocControl::je_bind_thread_arena(unsigned arena_ind) {
+    return -1;
+}
+int64_t JemallocControl::get_je_arena_metrics(unsigned arena_ind, const std::string& name) {
+    return 0;
+}
+void JemallocControl::je_purge_arena_dirty_pages(unsigned arena_ind) {}
 void JemallocControl::je_thread_tcache_flush() {}
 #endif
 
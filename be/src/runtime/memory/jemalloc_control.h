@@ -84,6 +84,13 @@ public:
     static void je_purge_all_arena_dirty_pages();
     static void je_reset_all_arena_dirty_decay_ms(ssize_t dirty_decay_ms);
     static void je_decay_all_arena_dirty_pages();
+    // Create a manual arena that is only used by threads bound to it, -1 if it failed.
+    static int64_t je_create_arena(ssize_t dirty_decay_ms);
+    // Bind the current thread to the arena and return the arena it was bound to before,
+    // -1 if it failed.
+    static int64_t je_bind_thread_arena(unsigned arena_ind);
+    static int64_t get_je_arena_metrics(unsigned arena_ind, const std::string& name);
+    static void je_purge_arena_dirty_pages(unsigned arena_ind);
     // the limit of `tcache` is the number of pages, not the total number of page bytes.
     // `tcache` has two cleaning opportunities: 1. the number of memory alloc and releases reaches a certain number,
     // recycle pages that has not been used for a long time; 2. recycle all `tcache` when the thread exits.
@@ -20,12 +20,15 @@
 #include <fmt/format.h>
 
 #include <memory>
+#include <string>
 
+#include "common/config.h"
 #include "olap/lru_cache.h"
 #include "runtime/memory/cache_policy.h"
 #include "runtime/memory/lru_cache_value_base.h"
 #include "runtime/memory/mem_tracker_limiter.h"
 #include "runtime/thread_context.h"
+#include "util/string_util.h"
 #include "util/time.h"
 
 namespace doris {
@@ -43,7 +46,8 @@ public:
         if (check_capacity(capacity, num_shards)) {
             _cache = std::shared_ptr<ShardedLRUCache>(
                     new ShardedLRUCache(type_string(type), capacity, lru_cache_type, num_shards,
-                                        element_count_capacity, is_lru_k));
+                                        element_count_capacity, is_lru_k,
+                                        eviction_policy_of(type)));
         } else {
             _cache = std::make_shared<doris::DummyLRUCache>();
         }
@@ -63,7 +67,8 @@ public:
             _cache = std::shared_ptr<ShardedLRUCache>(
                     new ShardedLRUCache(type_string(type), capacity, lru_cache_type, num_shards,
                                         cache_value_time_extractor, cache_value_check_timestamp,
-                                        element_count_capacity, is_lru_k));
+                                        element_count_capacity, is_lru_k,
+                                        eviction_policy_of(type)));
         } else {
             _cache = std::make_shared<doris::DummyLRUCache>();
         }
@@ -85,6 +90,24 @@ public:
         return true;
     }
 
+    // The eviction policy of the cache set in config::cache_eviction_policies, LRU by default.
+    static CacheEvictionPolicyType eviction_policy_of(CacheType type) {
+        CacheEvictionPolicyType eviction_policy = DEFAULT_CACHE_EVICTION_POLICY;
+        std::string name = type_string(type);
+        for (auto& item : split(config::cache_eviction_policies, ",")) {
+            auto pos = item.find(':');
+            if (pos == std::string::npos || item.substr(0, pos) != name) {
+                continue;
+            }
+            if (!parse_cache_eviction_policy(item.substr(pos + 1), &eviction_policy)) {
+                LOG(WARNING) << fmt::format("unknown eviction policy {} of {}, use LRU", item,
+                                            name);
+                eviction_policy = DEFAULT_CACHE_EVICTION_POLICY;
+            }
+        }
+        return eviction_policy;
+    }
+
     static std::string lru_cache_type_string(LRUCacheType type) {
         switch (type) {
         case LRUCacheType::SIZE:
@@ -121,14 +144,15 @@ public:
     //    only tracking handle_size(106).
     Cache::Handle* insert(const CacheKey& key, void* value, size_t charge,
                           size_t value_tracking_bytes,
-                          CachePriority priority = CachePriority::NORMAL) {
+                          CachePriority priority = CachePriority::NORMAL,
+                          bool probationary = false) {
         size_t tracking_bytes = sizeof(LRUHandle) - 1 + key.size() + value_tracking_bytes;
         if (value != nullptr) {
             ((LRUCacheValueBase*)value)
                     ->set_tracking_bytes(tracking_bytes, _mem_tracker, value_tracking_bytes,
                                          _value_mem_tracker);
         }
-        return _cache->insert(key, value, charge, priority);
+        return _cache->insert(key, value, charge, priority, probationary);
     }
 
     Cache::Handle* lookup(const CacheKey& key) { return _cache->lookup(key); }
@@ -137,6 +161,10 @@ public:
 
     void* value(Cache::Handle* handle) { return _cache->value(handle); }
 
+    void for_each_entry(const CacheEntryVisitor& visitor, size_t max_entries_per_shard) {
+        _cache->for_each_entry(visitor, max_entries_per_shard);
+    }
+
     void erase(const CacheKey& key) { _cache->erase(key); }
 
     int64_t get_usage() { return _cache->get_usage(); }
@@ -20,6 +20,7 @@
 #include <gen_cpp/types.pb.h>
 
 #include "runtime/exec_env.h"
+#include "runtime/memory/jemalloc_control.h"
 
 namespace doris {
 #include "common/compile_check_begin.h"
@@ -49,6 +50,14 @@ void ThreadMemTrackerMgr::attach_limiter_tracker(
         const std::weak_ptr<WorkloadGroup>& wg_wptr) {
     attach_limiter_tracker(mem_tracker);
     _wg_wptr = wg_wptr;
+    if (config::enable_workload_group_jemalloc_arena) {
+        auto wg = wg_wptr.lock();
+        if (wg != nullptr && wg->jemalloc_arena() >= 0) {
+            _last_attach_snapshots_stack.back().jemalloc_arena =
+                    JemallocControl::je_bind_thread_arena(
+                            static_cast<unsigned>(wg->jemalloc_arena()));
+        }
+    }
 }
 
 void ThreadMemTrackerMgr::detach_limiter_tracker() {
@@ -61,6 +70,9 @@ void ThreadMemTrackerMgr::detach_limiter_tracker() {
     _wg_wptr = _last_attach_snapshots_stack.back().wg_wptr;
     _reserved_mem = _last_attach_snapshots_stack.back().reserved_mem;
     _consumer_tracker_stack = _last_attach_snapshots_stack.back().consumer_tracker_stack;
+    if (auto arena = _last_attach_snapshots_stack.back().jemalloc_arena; arena >= 0) {
+        static_cast<void>(JemallocControl::je_bind_thread_arena(static_cast<unsigned>(arena)));
+    }
     _last_attach_snapshots_stack.pop_back();
 }
 
@@ -149,6 +149,8 @@ private:
         std::weak_ptr<WorkloadGroup> wg_wptr;
         int64_t reserved_mem = 0;
         std::vector<MemTracker*> consumer_tracker_stack;
+        // arena to bind the thread back to on detach, -1 if the attach did not rebind it
+        int64_t jemalloc_arena = -1;
     };
 
     // is false: ExecEnv::ready() = false when thread local is initialized
@@ -226,6 +226,7 @@ QueryContext::~QueryContext() {
         }
     }
 #endif
+    _dependency_wait_stats.merge_to(pipeline::DependencyWaitStats::backend());
     _runtime_filter_mgr.reset();
     _execution_dependency.reset();
     _runtime_predicates.clear();
@@ -238,7 +239,21 @@ QueryContext::~QueryContext() {
 #endif
     DorisMetrics::instance()->query_ctx_cnt->increment(-1);
     // the only one msg shows query's end. any other msg should append to it if need.
-    LOG_INFO("Query {} deconstructed, mem_tracker: {}", print_id(this->_query_id), mem_tracker_msg);
+    const auto* io_ctx = _resource_ctx->io_context();
+    std::string scan_io_msg;
+    if (io_ctx->scan_bytes() > 0) {
+        scan_io_msg = fmt::format(
+                ", scan_io: PageCache={}, FileCache={}, LocalDisk={}, Remote={}, LocalIOTime={}, "
+                "RemoteIOTime={}",
+                PrettyPrinter::print_bytes(io_ctx->scan_bytes_from_page_cache()),
+                PrettyPrinter::print_bytes(io_ctx->scan_bytes_from_file_cache()),
+                PrettyPrinter::print_bytes(io_ctx->scan_bytes_from_local_disk()),
+                PrettyPrinter::print_bytes(io_ctx->scan_bytes_from_remote_storage()),
+                PrettyPrinter::print(io_ctx->scan_local_io_time(), TUnit::TIME_NS),
+                PrettyPrinter::print(io_ctx->scan_remote_io_time(), TUnit::TIME_NS));
+    }
+    LOG_INFO("Query {} deconstructed, mem_tracker: {}{}", print_id(this->_query_id),
+             mem_tracker_msg, scan_io_msg);
 }
 
 void QueryContext::set_ready_to_execute(Status reason) {
@@ -362,6 +377,23 @@ std::string QueryContext::print_all_pipeline_context() {
     return fmt::to_string(debug_string_buffer);
 }
 
+std::map<std::string, int64_t> QueryContext::collect_operator_memory_usage() {
+    std::vector<std::weak_ptr<pipeline::PipelineFragmentContext>> fragment_ctxs;
+    {
+        std::lock_guard<std::mutex> lock(_pipeline_map_write_lock);
+        for (auto& [f_id, f_context] : _fragment_id_to_pipeline_ctx) {
+            fragment_ctxs.push_back(f_context);
+        }
+    }
+    std::map<std::string, int64_t> usage;
+    for (auto& f_context : fragment_ctxs) {
+        if (auto pipeline_ctx = f_context.lock()) {
+            pipeline_ctx->collect_operator_memory_usage(&usage);
+        }
+    }
+    return usage;
+}
+
 void QueryContext::set_pipeline_context(
         const int fragment_id, std::shared_ptr<pipeline::PipelineFragmentContext> pip_ctx) {
     std::lock_guard<std::mutex> lock(_pipeline_map_write_lock);
@@ -24,6 +24,7 @@
 
 #include <atomic>
 #include <cstdint>
+#include <functional>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -32,6 +33,7 @@
 #include "common/config.h"
 #include "common/factory_creator.h"
 #include "common/object_pool.h"
+#include "pipeline/dependency_wait_stats.h"
 #include "runtime/exec_env.h"
 #include "runtime/memory/mem_tracker_limiter.h"
 #include "runtime/runtime_predicate.h"
@@ -78,6 +80,7 @@ const std::string toString(QuerySource query_source);
 // Some components like DescriptorTbl may be very large
 // that will slow down each execution of fragments when DeSer them every time.
 class DescriptorTbl;
+struct QueryCacheLookup;
 class QueryContext : public std::enable_shared_from_this<QueryContext> {
     ENABLE_FACTORY_CREATOR(QueryContext);
 
@@ -122,6 +125,8 @@ public:
 
     void cancel_all_pipeline_context(const Status& reason, int fragment_id = -1);
     std::string print_all_pipeline_context();
+    // Memory used by operators of all running fragments, keyed by operator name and node id.
+    std::map<std::string, int64_t> collect_operator_memory_usage();
     void set_pipeline_context(const int fragment_id,
                               std::shared_ptr<pipeline::PipelineFragmentContext> pip_ctx);
     void cancel(Status new_status, int fragment_id = -1);
@@ -204,6 +209,7 @@ public:
     pipeline::Dependency* get_memory_sufficient_dependency() {
         return _memory_sufficient_dependency.get();
     }
+    pipeline::DependencyWaitStats* dependency_wait_stats() { return &_dependency_wait_stats; }
 
     doris::pipeline::TaskScheduler* get_pipe_exec_scheduler();
 
@@ -257,6 +263,19 @@ public:
         DCHECK_EQ(_using_brpc_stubs[network_address].get(), brpc_stub.get());
     }
 
+    // The query cache entry of every cache key is looked up once per query, so that all the
+    // operators serving one tablet see the same entry.
+    std::shared_ptr<QueryCacheLookup> get_or_create_query_cache_lookup(
+            const std::string& cache_key,
+            const std::function<std::shared_ptr<QueryCacheLookup>()>& create) {
+        std::lock_guard<std::mutex> lock(_query_cache_lookups_mutex);
+        auto& lookup = _query_cache_lookups[cache_key];
+        if (lookup == nullptr) {
+            lookup = create();
+        }
+        return lookup;
+    }
+
     void set_llm_resources(std::map<std::string, TLLMResource> llm_resources) {
         _llm_resources =
                 std::make_unique<std::map<std::string, TLLMResource>>(std::move(llm_resources));
@@ -320,6 +339,8 @@ private:
     std::unique_ptr<pipeline::Dependency> _execution_dependency;
     // This dependency indicates if memory is sufficient to execute.
     std::unique_ptr<pipeline::Dependency> _memory_sufficient_dependency;
+    // How long tasks of this query are blocked by each dependency.
+    pipeline::DependencyWaitStats _dependency_wait_stats;
 
     // This shared ptr is never used. It is just a reference to hold the object.
     // There is a weak ptr in runtime filter manager to reference this object.
@@ -337,6 +358,9 @@ private:
     std::mutex _brpc_stubs_mutex;
     std::unordered_map<TNetworkAddress, std::shared_ptr<PBackendService_Stub>> _using_brpc_stubs;
 
+    std::mutex _query_cache_lookups_mutex;
+    std::unordered_map<std::string, std::shared_ptr<QueryCacheLookup>> _query_cache_lookups;
+
     // when fragment of pipeline is closed, it will register its profile to this map by using add_fragment_profile
     // flatten profile of one fragment:
     // Pipeline 0
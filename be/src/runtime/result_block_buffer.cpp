@@ -200,7 +200,7 @@ Status ResultBlockBuffer<ResultCtxType>::add_batch(RuntimeState* state,
                 batch_size += row.size();
             }
         }
-        if (!_result_batch_queue.empty()) {
+        if (_merge_batches && !_result_batch_queue.empty()) {
             if constexpr (std::is_same_v<InBlockType, vectorized::Block>) {
                 sz = _result_batch_queue.back()->rows();
             } else if constexpr (std::is_same_v<InBlockType, TFetchDataResult>) {
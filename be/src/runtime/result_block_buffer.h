@@ -105,6 +105,8 @@ protected:
     // The last batch size in bytes.
     // Determine whether to merge multiple batches based on the size of each batch to avoid getting an excessively large batch after merging.
     size_t _last_batch_bytes = 0;
+    // Whether a new batch may be appended to the last queued one, see `add_batch`.
+    bool _merge_batches = true;
 
     // get arrow flight result is a sync method, need wait for data ready and return result.
     // TODO, waiting for data will block pipeline, so use a request pool to save requests waiting for data.
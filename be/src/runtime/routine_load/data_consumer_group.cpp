@@ -115,11 +115,18 @@ Status KafkaDataConsumerGroup::start_all(std::shared_ptr<StreamLoadContext> ctx,
 
     //improve performance
     Status (io::KafkaConsumerPipe::*append_data)(const char* data, size_t size);
+    Status (io::KafkaConsumerPipe::*append_data_by_reference)(char* data, size_t size,
+                                                              std::shared_ptr<void> owner);
     if (ctx->format == TFileFormatType::FORMAT_JSON) {
         append_data = &io::KafkaConsumerPipe::append_json;
+        append_data_by_reference = &io::KafkaConsumerPipe::append_json;
     } else {
         append_data = &io::KafkaConsumerPipe::append_with_line_delimiter;
+        append_data_by_reference = &io::KafkaConsumerPipe::append_with_line_delimiter;
     }
+    // MultiTablePipe routes every message by its table prefix, so it always gets a copy
+    const int64_t zero_copy_min_bytes =
+            ctx->is_multi_table ? 0 : config::routine_load_zero_copy_min_message_bytes;
 
     MonotonicStopWatch watch;
     watch.start();
@@ -159,8 +166,9 @@ Status KafkaDataConsumerGroup::start_all(std::shared_ptr<StreamLoadContext> ctx,
         RdKafka::Message* msg;
         bool res = _queue.controlled_blocking_get(&msg, config::blocking_queue_cv_wait_timeout_ms);
         if (res) {
-            // conf has to be deleted finally
-            Defer delete_msg {[msg]() { delete msg; }};
+            // conf has to be deleted finally, a message queued by reference is deleted once the
+            // pipe has been read past it
+            std::shared_ptr<RdKafka::Message> msg_holder(msg);
             VLOG_NOTICE << "get kafka message"
                         << ", partition: " << msg->partition() << ", offset: " << msg->offset()
                         << ", len: " << msg->len();
@@ -170,8 +178,16 @@ Status KafkaDataConsumerGroup::start_all(std::shared_ptr<StreamLoadContext> ctx,
                     cmt_offset[msg->partition()] = msg->offset() - 1;
                 }
             } else {
-                Status st = (kafka_pipe.get()->*append_data)(
-                        static_cast<const char*>(msg->payload()), static_cast<size_t>(msg->len()));
+                Status st;
+                if (zero_copy_min_bytes > 0 &&
+                    static_cast<int64_t>(msg->len()) >= zero_copy_min_bytes) {
+                    st = (kafka_pipe.get()->*append_data_by_reference)(
+                            static_cast<char*>(msg->payload()), static_cast<size_t>(msg->len()),
+                            msg_holder);
+                } else {
+                    st = (kafka_pipe.get()->*append_data)(static_cast<const char*>(msg->payload()),
+                                                          static_cast<size_t>(msg->len()));
+                }
                 if (st.ok()) {
                     left_rows--;
                     left_bytes -= msg->len();
@@ -19,12 +19,14 @@
 
 #include <memory>
 
+#include "common/cast_set.h"
 #include "common/compiler_util.h" // IWYU pragma: keep
 #include "common/exception.h"
 #include "common/status.h"
 #include "olap/accept_null_predicate.h"
 #include "olap/column_predicate.h"
 #include "olap/predicate_creator.h"
+#include "runtime/descriptors.h"
 
 namespace doris::vectorized {
 
@@ -203,6 +205,81 @@ bool RuntimePredicate::_init(PrimitiveType type) {
     return true;
 }
 
+template <PrimitiveType type>
+bool build_value_range(const SlotDescriptor& slot, SQLFilterOp op,
+                       const typename ColumnValueRange<type>::CppType& value,
+                       ColumnValueRangeType* range) {
+    ColumnValueRange<type> value_range(slot.col_name(), slot.is_nullable(),
+                                       cast_set<int>(slot.type()->get_precision()),
+                                       cast_set<int>(slot.type()->get_scale()));
+    if (!value_range.add_range(op, value).ok()) {
+        return false;
+    }
+    *range = std::move(value_range);
+    return true;
+}
+
+bool RuntimePredicate::to_value_range(const Field& value, const SlotDescriptor& slot,
+                                      ColumnValueRangeType* range) const {
+    if (value.is_null()) {
+        return false;
+    }
+    SQLFilterOp op = _is_asc ? FILTER_LESS_OR_EQUAL : FILTER_LARGER_OR_EQUAL;
+    switch (slot.type()->get_primitive_type()) {
+#define M(NAME)                                                                                    \
+    case TYPE_##NAME:                                                                              \
+        return build_value_range<TYPE_##NAME>(                                                     \
+                slot, op, value.get<typename PrimitiveTypeTraits<TYPE_##NAME>::CppType>(), range);
+        M(BOOLEAN)
+        M(TINYINT)
+        M(SMALLINT)
+        M(INT)
+        M(BIGINT)
+        M(LARGEINT)
+        M(DATEV2)
+        M(DATETIMEV2)
+        M(IPV4)
+        M(IPV6)
+#undef M
+#define M(NAME)                                                                                    \
+    case TYPE_##NAME: {                                                                            \
+        using ValueType = typename PrimitiveTypeTraits<TYPE_##NAME>::CppType;                      \
+        return build_value_range<TYPE_##NAME>(                                                     \
+                slot, op, value.get<DecimalField<ValueType>>().get_value(), range);                \
+    }
+        M(DECIMAL32)
+        M(DECIMAL64)
+        M(DECIMAL128I)
+        M(DECIMAL256)
+#undef M
+    case TYPE_DECIMALV2:
+        return build_value_range<TYPE_DECIMALV2>(
+                slot, op, DecimalV2Value(value.get<DecimalField<Decimal128V2>>().get_value().value),
+                range);
+    case TYPE_DATE: {
+        auto v = binary_cast<Int64, VecDateTimeValue>(value.get<Int64>());
+        v.cast_to_date();
+        return build_value_range<TYPE_DATE>(slot, op, v, range);
+    }
+    case TYPE_DATETIME: {
+        auto v = binary_cast<Int64, VecDateTimeValue>(value.get<Int64>());
+        v.to_datetime();
+        return build_value_range<TYPE_DATETIME>(slot, op, v, range);
+    }
+#define M(NAME)                                                                                    \
+    case TYPE_##NAME: {                                                                            \
+        const auto& s = value.get<String>();                                                       \
+        return build_value_range<TYPE_##NAME>(slot, op, StringRef(s.data(), s.size()), range);     \
+    }
+        M(CHAR)
+        M(VARCHAR)
+        M(STRING)
+#undef M
+    default:
+        return false;
+    }
+}
+
 Status RuntimePredicate::update(const Field& value) {
     std::unique_lock<std::shared_mutex> wlock(_rwlock);
     // skip null value
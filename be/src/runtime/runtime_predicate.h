@@ -37,6 +37,7 @@
 
 namespace doris {
 class ColumnPredicate;
+class SlotDescriptor;
 
 namespace vectorized {
 
@@ -109,6 +110,12 @@ public:
         return _contexts.find(target_node_id)->second.expr;
     }
 
+    // Converts a threshold into `col <= value` (ASC) or `col >= value` (DESC) so that file
+    // readers can prune row groups and pages by statistics. String ranges reference `value`,
+    // so it must outlive `range`. Returns false if the slot type has no value range.
+    bool to_value_range(const Field& value, const SlotDescriptor& slot,
+                        ColumnValueRangeType* range) const;
+
 private:
     void check_target_node_id(int32_t target_node_id) const {
         if (!_contexts.contains(target_node_id)) {
@@ -64,6 +64,7 @@ Status k_stream_load_plan_status;
 bvar::LatencyRecorder g_stream_load_begin_txn_latency("stream_load", "begin_txn");
 bvar::LatencyRecorder g_stream_load_precommit_txn_latency("stream_load", "precommit_txn");
 bvar::LatencyRecorder g_stream_load_commit_txn_latency("stream_load", "commit_txn");
+bvar::LatencyRecorder g_stream_load_write_data_latency_ms("stream_load", "write_data_ms");
 
 Status StreamLoadExecutor::execute_plan_fragment(std::shared_ptr<StreamLoadContext> ctx,
                                                  const TPipelineFragmentParamsList& parent) {
@@ -121,6 +122,7 @@ Status StreamLoadExecutor::execute_plan_fragment(std::shared_ptr<StreamLoadConte
             }
         }
         ctx->write_data_cost_nanos = MonotonicNanos() - ctx->start_write_data_nanos;
+        g_stream_load_write_data_latency_ms << ctx->write_data_cost_nanos / 1000000;
         ctx->promise.set_value(*status);
 
         if (!status->ok() && ctx->body_sink != nullptr) {
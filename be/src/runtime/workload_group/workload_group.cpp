@@ -34,8 +34,10 @@
 #include "pipeline/task_scheduler.h"
 #include "runtime/exec_env.h"
 #include "runtime/memory/global_memory_arbitrator.h"
+#include "runtime/memory/jemalloc_control.h"
 #include "runtime/memory/mem_tracker_limiter.h"
 #include "runtime/memory/memory_reclamation.h"
+#include "runtime/workload_group/workload_group_cpu_quota.h"
 #include "runtime/workload_group/workload_group_metrics.h"
 #include "runtime/workload_management/io_throttle.h"
 #include "util/mem_info.h"
@@ -207,6 +209,10 @@ int64_t WorkloadGroup::refresh_memory_usage() {
 
     _total_mem_used = fragment_used_memory + write_buffer_size;
     _wg_metrics->update_memory_used_bytes(_total_mem_used);
+    if (auto arena = _jemalloc_arena.load(); arena >= 0) {
+        _wg_metrics->update_jemalloc_arena_resident_bytes(
+                JemallocControl::get_je_arena_metrics(static_cast<unsigned>(arena), "resident"));
+    }
     _write_buffer_size = write_buffer_size;
     // reserve memory is recorded in the query mem tracker
     // and _total_mem_used already contains all the current reserve memory.
@@ -219,6 +225,19 @@ int64_t WorkloadGroup::memory_used() {
     return refresh_memory_usage();
 }
 
+int64_t WorkloadGroup::jemalloc_arena() {
+    if (!config::enable_workload_group_jemalloc_arena) {
+        return -1;
+    }
+    std::call_once(_jemalloc_arena_once, [this]() {
+        _jemalloc_arena =
+                JemallocControl::je_create_arena(config::workload_group_je_dirty_decay_ms);
+        LOG(INFO) << fmt::format("workload group {} uses jemalloc arena {}", _name,
+                                 _jemalloc_arena.load());
+    });
+    return _jemalloc_arena;
+}
+
 void WorkloadGroup::do_sweep() {
     // Clear resource context that is registered during add_resource_ctx
     std::unique_lock<std::shared_mutex> wlock(_mutex);
@@ -254,6 +273,11 @@ int64_t WorkloadGroup::revoke_memory(int64_t need_free_mem, const std::string& r
         }
     }
 
+    if (auto arena = _jemalloc_arena.load(); arena >= 0) {
+        // cheap and does not hurt other groups, the freed pages do not count as tracked memory
+        JemallocControl::je_purge_arena_dirty_pages(static_cast<unsigned>(arena));
+    }
+
     auto group_revoke_reason = fmt::format(
             "{}, revoke group id:{}, name:{}, used:{}, limit:{}", revoke_reason, _id, _name,
             PrettyPrinter::print_bytes(used_memory), PrettyPrinter::print_bytes(_memory_limit));
@@ -524,7 +548,7 @@ Status WorkloadGroup::upsert_thread_pool_no_lock(WorkloadGroupInfo* wg_info,
     if (_task_sched == nullptr) {
         std::unique_ptr<pipeline::TaskScheduler> pipeline_task_scheduler =
                 std::make_unique<pipeline::TaskScheduler>(pipeline_exec_thread_num, "p_" + wg_name,
-                                                          cg_cpu_ctl_ptr);
+                                                          cg_cpu_ctl_ptr, _cpu_quota);
         Status ret = pipeline_task_scheduler->start();
         if (ret.ok()) {
             _task_sched = std::move(pipeline_task_scheduler);
@@ -620,6 +644,11 @@ void WorkloadGroup::upsert_cgroup_cpu_ctl_no_lock(WorkloadGroupInfo* wg_info) {
         _cgroup_cpu_ctl->update_cpu_soft_limit(cpu_share);
         _cgroup_cpu_ctl->get_cgroup_cpu_info(&(wg_info->cgroup_cpu_shares),
                                              &(wg_info->cgroup_cpu_hard_limit));
+    } else if (config::enable_workload_group_in_process_cpu_limit) {
+        if (_cpu_quota == nullptr) {
+            _cpu_quota = std::make_shared<WorkloadGroupCpuQuota>();
+        }
+        _cpu_quota->update(cpu_share, cpu_hard_limit);
     }
 }
 
@@ -23,6 +23,7 @@
 
 #include <atomic>
 #include <memory>
+#include <mutex>
 #include <queue>
 #include <shared_mutex>
 #include <string>
@@ -40,6 +41,7 @@ class RuntimeProfile;
 class ThreadPool;
 class ExecEnv;
 class CgroupCpuCtl;
+class WorkloadGroupCpuQuota;
 class QueryContext;
 class IOThrottle;
 class ResourceContext;
@@ -99,6 +101,10 @@ public:
     int64_t refresh_memory_usage();
     int64_t memory_used();
 
+    // The dedicated jemalloc arena of this group, created on first use.
+    // -1 if enable_workload_group_jemalloc_arena is off or the arena could not be created.
+    int64_t jemalloc_arena();
+
     void do_sweep();
 
     int memory_low_watermark() const {
@@ -277,6 +283,8 @@ private:
     // but also some global background threadpool which not owned by WorkloadGroup,
     // so it should be shared ptr;
     std::shared_ptr<CgroupCpuCtl> _cgroup_cpu_ctl {nullptr};
+    // limits cpu inside the process when there is no cgroup, shared with _task_sched
+    std::shared_ptr<WorkloadGroupCpuQuota> _cpu_quota {nullptr};
     std::unique_ptr<doris::pipeline::TaskScheduler> _task_sched {nullptr};
     std::unique_ptr<vectorized::SimplifiedScanScheduler> _scan_task_sched {nullptr};
     std::unique_ptr<vectorized::SimplifiedScanScheduler> _remote_scan_task_sched {nullptr};
@@ -286,6 +294,11 @@ private:
     std::shared_ptr<IOThrottle> _remote_scan_io_throttle {nullptr};
 
     std::shared_ptr<WorkloadGroupMetrics> _wg_metrics {nullptr};
+
+    // jemalloc can not destroy an arena that still owns allocations, so the arena lives as
+    // long as the process even if the group is dropped.
+    std::once_flag _jemalloc_arena_once;
+    std::atomic<int64_t> _jemalloc_arena {-1};
 };
 
 using WorkloadGroupPtr = std::shared_ptr<WorkloadGroup>;
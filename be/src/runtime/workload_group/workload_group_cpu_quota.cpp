@@ -0,0 +1,131 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "runtime/workload_group/workload_group_cpu_quota.h"
+
+#include <algorithm>
+#include <chrono>
+#include <thread>
+
+#include "util/cpu_info.h"
+#include "util/time.h"
+
+namespace doris {
+#include "common/compile_check_begin.h"
+
+WorkloadGroupCpuQuota::WorkloadGroupCpuQuota() : _cpu_share(DEFAULT_CPU_SHARE) {
+    std::lock_guard l(_s_mutex);
+    _s_quotas.push_back(this);
+}
+
+WorkloadGroupCpuQuota::~WorkloadGroupCpuQuota() {
+    std::lock_guard l(_s_mutex);
+    _s_quotas.erase(std::find(_s_quotas.begin(), _s_quotas.end(), this));
+    if (_is_active) {
+        _s_active_share_sum -= _cpu_share;
+    }
+}
+
+void WorkloadGroupCpuQuota::update(uint64_t cpu_share, int cpu_hard_limit) {
+    std::lock_guard l(_s_mutex);
+    cpu_share = cpu_share > 0 ? cpu_share : DEFAULT_CPU_SHARE;
+    auto old_cpu_share = _cpu_share.exchange(cpu_share);
+    if (_is_active) {
+        _s_active_share_sum -= old_cpu_share;
+        _s_active_share_sum += cpu_share;
+    }
+    _cpu_hard_limit = cpu_hard_limit;
+}
+
+void WorkloadGroupCpuQuota::consume(int64_t cpu_time_ns, int64_t now_ns) {
+    _maybe_start_new_period(now_ns);
+    _period_used_ns += cpu_time_ns;
+    _s_total_period_used_ns += cpu_time_ns;
+    if (!_is_active.exchange(true)) {
+        _s_active_share_sum += _cpu_share;
+    }
+}
+
+void WorkloadGroupCpuQuota::wait_for_quota() {
+    for (auto wait_ns = throttle_time_ns(_now_ns()); wait_ns > 0;
+         wait_ns = throttle_time_ns(_now_ns())) {
+        std::this_thread::sleep_for(std::chrono::nanoseconds(wait_ns));
+    }
+}
+
+int64_t WorkloadGroupCpuQuota::throttle_time_ns(int64_t now_ns) {
+    _maybe_start_new_period(now_ns);
+    const int64_t period_start_ns = _s_period_start_ns;
+    const int64_t remaining_ns = std::max<int64_t>(period_start_ns + PERIOD_NS - now_ns, 0);
+    const int64_t used_ns = _period_used_ns;
+    const int64_t cores = CpuInfo::num_cores();
+
+    if (const int hard_limit = _cpu_hard_limit; hard_limit > 0) {
+        if (used_ns >= PERIOD_NS * cores * hard_limit / 100) {
+            return remaining_ns;
+        }
+    }
+
+    // Shares only matter while the cores are saturated, otherwise idle cpu is free to use.
+    const int64_t total_used_ns = _s_total_period_used_ns;
+    if (static_cast<double>(total_used_ns) <
+        static_cast<double>((now_ns - period_start_ns) * cores) * 0.9) {
+        return 0;
+    }
+    const uint64_t share_sum = _s_active_share_sum;
+    if (share_sum == 0) {
+        return 0;
+    }
+    // vruntime of this group against the average vruntime of the active groups
+    const double fair_used_ns = static_cast<double>(total_used_ns) *
+                                static_cast<double>(_cpu_share.load()) /
+                                static_cast<double>(share_sum);
+    if (static_cast<double>(used_ns) > fair_used_ns + static_cast<double>(SLICE_NS)) {
+        return std::min(remaining_ns, WAIT_STEP_NS);
+    }
+    return 0;
+}
+
+int64_t WorkloadGroupCpuQuota::_now_ns() {
+    return MonotonicNanos();
+}
+
+void WorkloadGroupCpuQuota::_maybe_start_new_period(int64_t now_ns) {
+    if (now_ns - _s_period_start_ns < PERIOD_NS) {
+        return;
+    }
+    std::lock_guard l(_s_mutex);
+    if (now_ns - _s_period_start_ns < PERIOD_NS) {
+        return;
+    }
+    // groups that ran in the last period stay active, so a busy group is not treated as idle
+    // right after the period starts
+    uint64_t active_share_sum = 0;
+    for (auto* quota : _s_quotas) {
+        bool active = quota->_period_used_ns.exchange(0) > 0;
+        quota->_is_active = active;
+        if (active) {
+            active_share_sum += quota->_cpu_share;
+        }
+    }
+    _s_active_share_sum = active_share_sum;
+    _s_total_period_used_ns = 0;
+    _s_period_start_ns = now_ns;
+}
+
+#include "common/compile_check_end.h"
+} // namespace doris
@@ -0,0 +1,78 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace doris {
+#include "common/compile_check_begin.h"
+
+// Enforces the cpu share and cpu hard limit of a workload group inside the process, for
+// deployments that can not use cgroups. The pipeline worker threads of the group report the
+// cpu time of every task they run, and before taking the next task a worker waits while
+//   1. the group used up its hard limit quota of the current period, or
+//   2. all cores are busy and the group's weighted cpu time (its vruntime, cpu time / share)
+//      is ahead of the average of the active groups by more than one slice.
+// Workers only wait between tasks, so a running task is never stalled halfway.
+class WorkloadGroupCpuQuota {
+public:
+    static constexpr int64_t PERIOD_NS = 100L * 1000 * 1000;
+    static constexpr int64_t SLICE_NS = 5L * 1000 * 1000;
+    static constexpr int64_t WAIT_STEP_NS = 1L * 1000 * 1000;
+    static constexpr uint64_t DEFAULT_CPU_SHARE = 1024;
+
+    WorkloadGroupCpuQuota();
+    ~WorkloadGroupCpuQuota();
+
+    // cpu_hard_limit is a percentage of all cores, <= 0 means no hard limit.
+    void update(uint64_t cpu_share, int cpu_hard_limit);
+
+    void consume(int64_t cpu_time_ns) { consume(cpu_time_ns, _now_ns()); }
+    void consume(int64_t cpu_time_ns, int64_t now_ns);
+
+    // Blocks the calling worker until the group may run again.
+    void wait_for_quota();
+
+    // How long the group has to wait at now_ns, 0 if it may run.
+    int64_t throttle_time_ns(int64_t now_ns);
+
+private:
+    static int64_t _now_ns();
+
+    // Starts a new period for all groups once the current one is over.
+    static void _maybe_start_new_period(int64_t now_ns);
+
+    std::atomic<uint64_t> _cpu_share;
+    std::atomic<int> _cpu_hard_limit {0};
+    std::atomic<int64_t> _period_used_ns {0};
+    // whether _cpu_share is counted in _s_active_share_sum for the current period
+    std::atomic<bool> _is_active {false};
+
+    // protect _s_quotas and the start of a new period
+    inline static std::mutex _s_mutex;
+    inline static std::vector<WorkloadGroupCpuQuota*> _s_quotas;
+    inline static std::atomic<int64_t> _s_period_start_ns {0};
+    inline static std::atomic<int64_t> _s_total_period_used_ns {0};
+    inline static std::atomic<uint64_t> _s_active_share_sum {0};
+};
+
+#include "common/compile_check_end.h"
+} // namespace doris
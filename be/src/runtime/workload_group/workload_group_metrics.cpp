@@ -28,6 +28,8 @@ namespace doris {
 
 DEFINE_COUNTER_METRIC_PROTOTYPE_2ARG(workload_group_cpu_time_sec, doris::MetricUnit::SECONDS);
 DEFINE_GAUGE_METRIC_PROTOTYPE_2ARG(workload_group_mem_used_bytes, doris::MetricUnit::BYTES);
+DEFINE_GAUGE_METRIC_PROTOTYPE_2ARG(workload_group_jemalloc_arena_resident_bytes,
+                                   doris::MetricUnit::BYTES);
 DEFINE_COUNTER_METRIC_PROTOTYPE_2ARG(workload_group_remote_scan_bytes, doris::MetricUnit::BYTES);
 DEFINE_COUNTER_METRIC_PROTOTYPE_2ARG(workload_group_total_local_scan_bytes,
                                      doris::MetricUnit::BYTES);
@@ -46,6 +48,7 @@ WorkloadGroupMetrics::WorkloadGroupMetrics(WorkloadGroup* wg) {
 
     INT_COUNTER_METRIC_REGISTER(_entity, workload_group_cpu_time_sec);
     INT_GAUGE_METRIC_REGISTER(_entity, workload_group_mem_used_bytes);
+    INT_GAUGE_METRIC_REGISTER(_entity, workload_group_jemalloc_arena_resident_bytes);
     INT_COUNTER_METRIC_REGISTER(_entity, workload_group_remote_scan_bytes);
     INT_COUNTER_METRIC_REGISTER(_entity, workload_group_total_local_scan_bytes);
 
@@ -72,6 +75,10 @@ void WorkloadGroupMetrics::update_memory_used_bytes(int64_t memory_used) {
     _memory_used = memory_used;
 }
 
+void WorkloadGroupMetrics::update_jemalloc_arena_resident_bytes(int64_t resident_bytes) {
+    workload_group_jemalloc_arena_resident_bytes->set_value(resident_bytes);
+}
+
 void WorkloadGroupMetrics::update_local_scan_io_bytes(std::string path, uint64_t delta_io_bytes) {
     workload_group_total_local_scan_bytes->increment(delta_io_bytes);
     auto range = _local_scan_bytes_counter_map.equal_range(path);
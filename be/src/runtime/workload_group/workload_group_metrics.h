@@ -49,6 +49,8 @@ public:
 
     void update_memory_used_bytes(int64_t memory_used);
 
+    void update_jemalloc_arena_resident_bytes(int64_t resident_bytes);
+
     void update_local_scan_io_bytes(std::string path, uint64_t delta_io_bytes);
 
     void update_remote_scan_io_bytes(uint64_t delta_io_bytes);
@@ -70,6 +72,8 @@ private:
     IntCounter* workload_group_total_local_scan_bytes {nullptr}; // used for metric
     std::unordered_multimap<std::string, IntCounter*>
             _local_scan_bytes_counter_map; // used for metric
+    // only set when the group has a dedicated jemalloc arena
+    IntGuage* workload_group_jemalloc_arena_resident_bytes {nullptr};
 
     std::atomic<uint64_t> _cpu_time_nanos {0};
     std::atomic<uint64_t> _last_cpu_time_nanos {0};
@@ -40,6 +40,14 @@ public:
         RuntimeProfile::Counter* scan_bytes_counter_;
         RuntimeProfile::Counter* scan_bytes_from_local_storage_counter_;
         RuntimeProfile::Counter* scan_bytes_from_remote_storage_counter_;
+        // Breakdown of where scanned bytes come from. Bytes from the storage page cache are
+        // uncompressed, the others are the compressed bytes read from files. The local storage
+        // bytes above are the file cache bytes plus the local disk bytes.
+        RuntimeProfile::Counter* scan_bytes_from_page_cache_counter_;
+        RuntimeProfile::Counter* scan_bytes_from_file_cache_counter_;
+        RuntimeProfile::Counter* scan_bytes_from_local_disk_counter_;
+        RuntimeProfile::Counter* scan_local_io_timer_;
+        RuntimeProfile::Counter* scan_remote_io_timer_;
         // number rows returned by query.
         // only set once by result sink when closing.
         RuntimeProfile::Counter* returned_rows_counter_;
@@ -48,6 +56,8 @@ public:
 
         RuntimeProfile::Counter* spill_write_bytes_to_local_storage_counter_;
         RuntimeProfile::Counter* spill_read_bytes_from_local_storage_counter_;
+        RuntimeProfile::Counter* spill_write_bytes_to_remote_storage_counter_;
+        RuntimeProfile::Counter* spill_read_bytes_from_remote_storage_counter_;
 
         RuntimeProfile* profile() { return profile_.get(); }
         void init_profile() {
@@ -58,6 +68,14 @@ public:
                     ADD_COUNTER(profile_, "ScanBytesFromLocalStorage", TUnit::BYTES);
             scan_bytes_from_remote_storage_counter_ =
                     ADD_COUNTER(profile_, "ScanBytesFromRemoteStorage", TUnit::BYTES);
+            scan_bytes_from_page_cache_counter_ =
+                    ADD_COUNTER(profile_, "ScanBytesFromPageCache", TUnit::BYTES);
+            scan_bytes_from_file_cache_counter_ =
+                    ADD_COUNTER(profile_, "ScanBytesFromFileCache", TUnit::BYTES);
+            scan_bytes_from_local_disk_counter_ =
+                    ADD_COUNTER(profile_, "ScanBytesFromLocalDisk", TUnit::BYTES);
+            scan_local_io_timer_ = ADD_TIMER(profile_, "ScanLocalIOTime");
+            scan_remote_io_timer_ = ADD_TIMER(profile_, "ScanRemoteIOTime");
             returned_rows_counter_ = ADD_COUNTER(profile_, "ReturnedRows", TUnit::UNIT);
             shuffle_send_bytes_counter_ = ADD_COUNTER(profile_, "ShuffleSendBytes", TUnit::BYTES);
             shuffle_send_rows_counter_ =
@@ -66,6 +84,10 @@ public:
                     ADD_COUNTER(profile_, "SpillWriteBytesToLocalStorage", TUnit::BYTES);
             spill_read_bytes_from_local_storage_counter_ =
                     ADD_COUNTER(profile_, "SpillReadBytesFromLocalStorage", TUnit::BYTES);
+            spill_write_bytes_to_remote_storage_counter_ =
+                    ADD_COUNTER(profile_, "SpillWriteBytesToRemoteStorage", TUnit::BYTES);
+            spill_read_bytes_from_remote_storage_counter_ =
+                    ADD_COUNTER(profile_, "SpillReadBytesFromRemoteStorage", TUnit::BYTES);
         }
         std::string debug_string() { return profile_->pretty_print(); }
 
@@ -86,6 +108,17 @@ public:
     int64_t scan_bytes_from_remote_storage() const {
         return stats_.scan_bytes_from_remote_storage_counter_->value();
     }
+    int64_t scan_bytes_from_page_cache() const {
+        return stats_.scan_bytes_from_page_cache_counter_->value();
+    }
+    int64_t scan_bytes_from_file_cache() const {
+        return stats_.scan_bytes_from_file_cache_counter_->value();
+    }
+    int64_t scan_bytes_from_local_disk() const {
+        return stats_.scan_bytes_from_local_disk_counter_->value();
+    }
+    int64_t scan_local_io_time() const { return stats_.scan_local_io_timer_->value(); }
+    int64_t scan_remote_io_time() const { return stats_.scan_remote_io_timer_->value(); }
     int64_t returned_rows() const { return stats_.returned_rows_counter_->value(); }
     int64_t shuffle_send_bytes() const { return stats_.shuffle_send_bytes_counter_->value(); }
     int64_t shuffle_send_rows() const { return stats_.shuffle_send_rows_counter_->value(); }
@@ -98,6 +131,14 @@ public:
         return stats_.spill_read_bytes_from_local_storage_counter_->value();
     }
 
+    int64_t spill_write_bytes_to_remote_storage() const {
+        return stats_.spill_write_bytes_to_remote_storage_counter_->value();
+    }
+
+    int64_t spill_read_bytes_from_remote_storage() const {
+        return stats_.spill_read_bytes_from_remote_storage_counter_->value();
+    }
+
     void update_scan_rows(int64_t delta) const { stats_.scan_rows_counter_->update(delta); }
     void update_scan_bytes(int64_t delta) const { stats_.scan_bytes_counter_->update(delta); }
     void update_scan_bytes_from_local_storage(int64_t delta) const {
@@ -106,6 +147,21 @@ public:
     void update_scan_bytes_from_remote_storage(int64_t delta) const {
         stats_.scan_bytes_from_remote_storage_counter_->update(delta);
     }
+    void update_scan_bytes_from_page_cache(int64_t delta) const {
+        stats_.scan_bytes_from_page_cache_counter_->update(delta);
+    }
+    void update_scan_bytes_from_file_cache(int64_t delta) const {
+        stats_.scan_bytes_from_file_cache_counter_->update(delta);
+    }
+    void update_scan_bytes_from_local_disk(int64_t delta) const {
+        stats_.scan_bytes_from_local_disk_counter_->update(delta);
+    }
+    void update_scan_local_io_time(int64_t delta) const {
+        stats_.scan_local_io_timer_->update(delta);
+    }
+    void update_scan_remote_io_time(int64_t delta) const {
+        stats_.scan_remote_io_timer_->update(delta);
+    }
     void update_returned_rows(int64_t delta) const { stats_.returned_rows_counter_->update(delta); }
     void update_shuffle_send_bytes(int64_t delta) const {
         stats_.shuffle_send_bytes_counter_->update(delta);
@@ -122,6 +178,14 @@ public:
         stats_.spill_read_bytes_from_local_storage_counter_->update(delta);
     }
 
+    void update_spill_write_bytes_to_remote_storage(int64_t delta) const {
+        stats_.spill_write_bytes_to_remote_storage_counter_->update(delta);
+    }
+
+    void update_spill_read_bytes_from_remote_storage(int64_t delta) const {
+        stats_.spill_read_bytes_from_remote_storage_counter_->update(delta);
+    }
+
     IOThrottle* io_throttle() {
         // TODO: get io throttle from workload group
         return nullptr;
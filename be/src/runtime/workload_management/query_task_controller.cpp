@@ -124,7 +124,12 @@ Status QueryTaskController::revoke_memory() {
     if (query_ctx == nullptr) {
         return Status::OK();
     }
-    std::vector<std::pair<size_t, pipeline::PipelineTask*>> tasks;
+    struct RevocableTask {
+        size_t revocable_size;
+        double cost_per_byte;
+        pipeline::PipelineTask* task;
+    };
+    std::vector<RevocableTask> tasks;
     std::vector<std::shared_ptr<pipeline::PipelineFragmentContext>> fragments;
     std::lock_guard<std::mutex> lock(query_ctx->_pipeline_map_write_lock);
     for (auto&& [fragment_id, fragment_wptr] : query_ctx->_fragment_id_to_pipeline_ctx) {
@@ -135,12 +140,19 @@ Status QueryTaskController::revoke_memory() {
 
         auto tasks_of_fragment = fragment_ctx->get_revocable_tasks();
         for (auto* task : tasks_of_fragment) {
-            tasks.emplace_back(task->get_revocable_size(), task);
+            tasks.push_back({task->get_revocable_size(), task->get_revoke_cost_per_byte(), task});
         }
         fragments.emplace_back(std::move(fragment_ctx));
     }
 
-    std::sort(tasks.begin(), tasks.end(), [](auto&& l, auto&& r) { return l.first > r.first; });
+    // Revoke from the operators that are cheapest to spill first, and among equally cheap
+    // ones from the largest, so that few spills free the target size.
+    std::sort(tasks.begin(), tasks.end(), [](const auto& l, const auto& r) {
+        if (l.cost_per_byte != r.cost_per_byte) {
+            return l.cost_per_byte < r.cost_per_byte;
+        }
+        return l.revocable_size > r.revocable_size;
+    });
 
     // Do not use memlimit, use current memory usage.
     // For example, if current limit is 1.6G, but current used is 1G, if reserve failed
@@ -151,9 +163,7 @@ Status QueryTaskController::revoke_memory() {
     size_t total_revokable_size = 0;
 
     std::vector<pipeline::PipelineTask*> chosen_tasks;
-    for (auto&& [revocable_size, task] : tasks) {
-        // Only revoke the largest task to ensure memory is used as much as possible
-        // break;
+    for (auto&& [revocable_size, cost_per_byte, task] : tasks) {
         if (revoked_size < target_revoking_size) {
             chosen_tasks.emplace_back(task);
             revoked_size += revocable_size;
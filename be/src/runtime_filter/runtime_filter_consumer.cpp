@@ -17,6 +17,7 @@
 
 #include "runtime_filter/runtime_filter_consumer.h"
 
+#include "exprs/create_predicate_function.h"
 #include "exprs/minmax_predicate.h"
 #include "util/runtime_profile.h"
 #include "vec/exprs/vbitmap_predicate.h"
@@ -39,7 +40,8 @@ Status RuntimeFilterConsumer::_apply_ready_expr(
     RETURN_IF_ERROR(_get_push_exprs(push_exprs, _probe_expr));
 
     for (auto i = origin_size; i < push_exprs.size(); i++) {
-        push_exprs[i]->attach_profile_counter(_rf_input, _rf_filter, _always_true_counter);
+        push_exprs[i]->attach_profile_counter(_rf_input, _rf_filter, _always_true_counter,
+                                              _disabled_counter);
     }
     return Status::OK();
 }
@@ -85,6 +87,13 @@ Status RuntimeFilterConsumer::_get_push_exprs(std::vector<vectorized::VRuntimeFi
     bool null_aware = _wrapper->contain_null();
     switch (real_filter_type) {
     case RuntimeFilterType::IN_FILTER: {
+        if (_should_convert_in_to_bloom(null_aware)) {
+            std::shared_ptr<BloomFilterFuncBase> bloom_filter;
+            RETURN_IF_ERROR(_convert_in_to_bloom(&bloom_filter));
+            container.push_back(_create_bloom_expr(probe_ctx->root(), bloom_filter, null_aware));
+            COUNTER_UPDATE(_in_to_bloom_counter, 1);
+            break;
+        }
         TTypeDesc type_desc = create_type_desc(PrimitiveType::TYPE_BOOLEAN);
         type_desc.__set_is_nullable(false);
         TExprNode node;
@@ -171,21 +180,8 @@ Status RuntimeFilterConsumer::_get_push_exprs(std::vector<vectorized::VRuntimeFi
         break;
     }
     case RuntimeFilterType::BLOOM_FILTER: {
-        // create a bloom filter
-        TTypeDesc type_desc = create_type_desc(PrimitiveType::TYPE_BOOLEAN);
-        type_desc.__set_is_nullable(false);
-        TExprNode node;
-        node.__set_type(type_desc);
-        node.__set_node_type(TExprNodeType::BLOOM_PRED);
-        node.__set_opcode(TExprOpcode::RT_FILTER);
-        node.__set_is_nullable(false);
-        auto bloom_pred = vectorized::VBloomPredicate::create_shared(node);
-        bloom_pred->set_filter(_wrapper->bloom_filter_func());
-        bloom_pred->add_child(probe_ctx->root());
-        auto wrapper = vectorized::VRuntimeFilterWrapper::create_shared(
-                node, bloom_pred, get_bloom_filter_ignore_thredhold(), null_aware,
-                _wrapper->filter_id());
-        container.push_back(wrapper);
+        container.push_back(
+                _create_bloom_expr(probe_ctx->root(), _wrapper->bloom_filter_func(), null_aware));
         break;
     }
     case RuntimeFilterType::BITMAP_FILTER: {
@@ -213,6 +209,47 @@ Status RuntimeFilterConsumer::_get_push_exprs(std::vector<vectorized::VRuntimeFi
     return Status::OK();
 }
 
+bool RuntimeFilterConsumer::_should_convert_in_to_bloom(bool null_aware) const {
+    // NULL_AWARE_IN_PRED has no bloom counterpart, and only in_or_bloom filters are allowed to be
+    // applied as bloom filters.
+    int threshold = config::runtime_filter_in_to_bloom_threshold;
+    return threshold > 0 && !null_aware &&
+           _runtime_filter_type == RuntimeFilterType::IN_OR_BLOOM_FILTER &&
+           _wrapper->hybrid_set()->size() >= threshold;
+}
+
+Status RuntimeFilterConsumer::_convert_in_to_bloom(
+        std::shared_ptr<BloomFilterFuncBase>* bloom_filter) const {
+    // The wrapper is shared by all consumers of this filter, so build a private bloom filter
+    // instead of changing the wrapper itself.
+    auto hybrid_set = _wrapper->hybrid_set();
+    RuntimeFilterParams params;
+    params.build_bf_by_runtime_size = true;
+    bloom_filter->reset(create_bloom_filter(_wrapper->column_type(), false));
+    (*bloom_filter)->init_params(&params);
+    RETURN_IF_ERROR((*bloom_filter)->init_with_fixed_length(hybrid_set->size()));
+    (*bloom_filter)->insert_set(hybrid_set);
+    return Status::OK();
+}
+
+vectorized::VRuntimeFilterPtr RuntimeFilterConsumer::_create_bloom_expr(
+        const vectorized::VExprSPtr& probe_expr, std::shared_ptr<BloomFilterFuncBase> bloom_filter,
+        bool null_aware) const {
+    TTypeDesc type_desc = create_type_desc(PrimitiveType::TYPE_BOOLEAN);
+    type_desc.__set_is_nullable(false);
+    TExprNode node;
+    node.__set_type(type_desc);
+    node.__set_node_type(TExprNodeType::BLOOM_PRED);
+    node.__set_opcode(TExprOpcode::RT_FILTER);
+    node.__set_is_nullable(false);
+    auto bloom_pred = vectorized::VBloomPredicate::create_shared(node);
+    bloom_pred->set_filter(std::move(bloom_filter));
+    bloom_pred->add_child(probe_expr);
+    return vectorized::VRuntimeFilterWrapper::create_shared(
+            node, bloom_pred, get_bloom_filter_ignore_thredhold(), null_aware,
+            _wrapper->filter_id());
+}
+
 void RuntimeFilterConsumer::collect_realtime_profile(RuntimeProfile* parent_operator_profile) {
     std::unique_lock<std::recursive_mutex> l(_rmtx);
     DCHECK(parent_operator_profile != nullptr);
@@ -238,9 +275,21 @@ void RuntimeFilterConsumer::collect_realtime_profile(RuntimeProfile* parent_oper
                                              TUnit::TIME_NS, "RuntimeFilterInfo", 2);
     c->update(_wait_timer->value());
 
+    c = parent_operator_profile->add_counter(fmt::format("RF{} MergeTime", filter_id),
+                                             TUnit::TIME_NS, "RuntimeFilterInfo", 2);
+    c->update(_merge_timer->value());
+
     c = parent_operator_profile->add_counter(fmt::format("RF{} AlwaysTrueFilterRows", filter_id),
                                              TUnit::UNIT, "RuntimeFilterInfo", 2);
     c->update(_always_true_counter->value());
+
+    c = parent_operator_profile->add_counter(fmt::format("RF{} DisabledNum", filter_id),
+                                             TUnit::UNIT, "RuntimeFilterInfo", 2);
+    c->update(_disabled_counter->value());
+
+    c = parent_operator_profile->add_counter(fmt::format("RF{} InToBloomNum", filter_id),
+                                             TUnit::UNIT, "RuntimeFilterInfo", 2);
+    c->update(_in_to_bloom_counter->value());
 }
 
 } // namespace doris
@@ -52,6 +52,11 @@ public:
     // Published by producer.
     void signal(RuntimeFilter* other);
 
+    // Time spent on the merge node to merge this filter from all producers.
+    void set_merge_time(int64_t merge_time_ms) {
+        COUNTER_SET(_merge_timer, merge_time_ms * NANOS_PER_MILLIS);
+    }
+
     std::shared_ptr<pipeline::RuntimeFilterTimer> create_filter_timer(
             std::shared_ptr<pipeline::Dependency> dependencies);
 
@@ -104,6 +109,13 @@ private:
 
     Status _get_push_exprs(std::vector<vectorized::VRuntimeFilterPtr>& container,
                            const TExpr& probe_expr);
+    // Whether the in filter is large enough to be applied as a bloom filter,
+    // see config::runtime_filter_in_to_bloom_threshold.
+    bool _should_convert_in_to_bloom(bool null_aware) const;
+    Status _convert_in_to_bloom(std::shared_ptr<BloomFilterFuncBase>* bloom_filter) const;
+    vectorized::VRuntimeFilterPtr _create_bloom_expr(
+            const vectorized::VExprSPtr& probe_expr,
+            std::shared_ptr<BloomFilterFuncBase> bloom_filter, bool null_aware) const;
     void _check_state(std::vector<State> assumed_states) {
         if (!check_state_impl<RuntimeFilterConsumer>(_rf_state, assumed_states)) {
             throw Exception(ErrorCode::INTERNAL_ERROR,
@@ -138,6 +150,8 @@ private:
 
     std::shared_ptr<RuntimeProfile::Counter> _wait_timer =
             std::make_shared<RuntimeProfile::Counter>(TUnit::TIME_NS, 0);
+    std::shared_ptr<RuntimeProfile::Counter> _merge_timer =
+            std::make_shared<RuntimeProfile::Counter>(TUnit::TIME_NS, 0);
     //_rf_filter is used to record the number of rows filtered by the runtime filter.
     //It aggregates the filtering statistics from both the Storage and Execution.
     // Counter will be shared by RuntimeFilterConsumer & VRuntimeFilterWrapper
@@ -149,6 +163,12 @@ private:
             std::make_shared<RuntimeProfile::Counter>(TUnit::UNIT, 0, 1);
     std::shared_ptr<RuntimeProfile::Counter> _always_true_counter =
             std::make_shared<RuntimeProfile::Counter>(TUnit::UNIT, 0, 1);
+    // number of exprs disabled after too many useless sampling periods
+    std::shared_ptr<RuntimeProfile::Counter> _disabled_counter =
+            std::make_shared<RuntimeProfile::Counter>(TUnit::UNIT, 0, 1);
+    // number of in filters applied as bloom filters
+    std::shared_ptr<RuntimeProfile::Counter> _in_to_bloom_counter =
+            std::make_shared<RuntimeProfile::Counter>(TUnit::UNIT, 0, 1);
 
     int32_t _rf_wait_time_ms;
     const int64_t _registration_time;
@@ -185,6 +185,52 @@ Status RuntimeFilterMergeControllerEntity::_init_with_desc(
             RuntimeFilterMerger::create(query_ctx.get(), runtime_filter_desc, &cnt_val->merger));
     cnt_val->merger->set_expected_producer_num(producer_size);
 
+    // Only the first filter of broadcast join is merged, so there is nothing to split.
+    int partial_num = std::min(config::runtime_filter_merge_partial_num, producer_size);
+    if (partial_num > 1 && !runtime_filter_desc->is_broadcast_join) {
+        for (int i = 0; i < partial_num; ++i) {
+            auto partial = std::make_unique<PartialMergeContext>();
+            RETURN_IF_ERROR(RuntimeFilterMerger::create(query_ctx.get(), runtime_filter_desc,
+                                                        &partial->merger));
+            // producers i, i + partial_num, i + 2 * partial_num ... go to the i-th partial merger
+            partial->merger->set_expected_producer_num((producer_size - i + partial_num - 1) /
+                                                       partial_num);
+            cnt_val->partial_mergers.push_back(std::move(partial));
+        }
+    }
+
+    return Status::OK();
+}
+
+Status RuntimeFilterMergeControllerEntity::_merge_partial(GlobalMergeContext& cnt_val,
+                                                          const RuntimeFilterProducer* filter,
+                                                          bool* is_ready) {
+    auto idx = cnt_val.arrived_producer_num.fetch_add(1);
+    auto& partial = *cnt_val.partial_mergers[idx % cnt_val.partial_mergers.size()];
+    bool partial_ready = false;
+    int64_t partial_merge_time = 0;
+    {
+        SCOPED_RAW_TIMER(&partial_merge_time);
+        std::lock_guard<std::mutex> l(partial.mtx);
+        RETURN_IF_ERROR(partial.merger->merge_from(filter));
+        partial_ready = partial.merger->ready();
+    }
+    cnt_val.partial_merge_time_ns += partial_merge_time;
+
+    *is_ready = false;
+    if (partial_ready) {
+        // no producer will touch this partial merger any more, so it is safe without its lock
+        int64_t final_merge_time = 0;
+        {
+            SCOPED_RAW_TIMER(&final_merge_time);
+            std::lock_guard<std::mutex> l(cnt_val.mtx);
+            RETURN_IF_ERROR(cnt_val.merger->merge_from(partial.merger.get(),
+                                                       partial.merger->expected_producer_num()));
+            // only the last partial merger makes the final merger ready
+            *is_ready = cnt_val.merger->ready();
+        }
+        cnt_val.final_merge_time_ns += final_merge_time;
+    }
     return Status::OK();
 }
 
@@ -303,19 +349,36 @@ Status RuntimeFilterMergeControllerEntity::merge(std::shared_ptr<QueryContext> q
     }
     auto& cnt_val = iter->second;
     bool is_ready = false;
-    {
+    if (!cnt_val.partial_mergers.empty()) {
+        // deserialize out of any lock, this is the most expensive part for a big bloom filter
+        std::shared_ptr<RuntimeFilterProducer> tmp_filter;
+        int64_t deserialize_time = 0;
+        {
+            SCOPED_RAW_TIMER(&deserialize_time);
+            RETURN_IF_ERROR(RuntimeFilterProducer::create(
+                    query_ctx.get(), &cnt_val.runtime_filter_desc, &tmp_filter));
+            RETURN_IF_ERROR(tmp_filter->assign(*request, attach_data));
+        }
+        cnt_val.deserialize_time_ns += deserialize_time;
+        RETURN_IF_ERROR(_merge_partial(cnt_val, tmp_filter.get(), &is_ready));
+    } else {
         std::lock_guard<std::mutex> l(iter->second.mtx);
         // Skip the other broadcast join runtime filter
         if (cnt_val.arrive_id.size() == 1 && cnt_val.runtime_filter_desc.is_broadcast_join) {
             return Status::OK();
         }
-        std::shared_ptr<RuntimeFilterProducer> tmp_filter;
-        RETURN_IF_ERROR(RuntimeFilterProducer::create(query_ctx.get(), &cnt_val.runtime_filter_desc,
-                                                      &tmp_filter));
+        int64_t final_merge_time = 0;
+        {
+            SCOPED_RAW_TIMER(&final_merge_time);
+            std::shared_ptr<RuntimeFilterProducer> tmp_filter;
+            RETURN_IF_ERROR(RuntimeFilterProducer::create(
+                    query_ctx.get(), &cnt_val.runtime_filter_desc, &tmp_filter));
 
-        RETURN_IF_ERROR(tmp_filter->assign(*request, attach_data));
+            RETURN_IF_ERROR(tmp_filter->assign(*request, attach_data));
 
-        RETURN_IF_ERROR(cnt_val.merger->merge_from(tmp_filter.get()));
+            RETURN_IF_ERROR(cnt_val.merger->merge_from(tmp_filter.get()));
+        }
+        cnt_val.final_merge_time_ns += final_merge_time;
 
         cnt_val.arrive_id.insert(UniqueId(request->fragment_instance_id()));
         is_ready = cnt_val.merger->ready(); // update is_ready in locked scope
@@ -323,6 +386,15 @@ Status RuntimeFilterMergeControllerEntity::merge(std::shared_ptr<QueryContext> q
 
     if (is_ready) {
         DCHECK_GT(cnt_val.targetv2_info.size(), 0);
+        merge_time = (cnt_val.deserialize_time_ns + cnt_val.partial_merge_time_ns +
+                      cnt_val.final_merge_time_ns) /
+                     NANOS_PER_MILLIS;
+        VLOG_DEBUG << fmt::format(
+                "runtime filter {} of query {} merged, producer_num: {}, partial_num: {}, "
+                "deserialize_time: {}ns, partial_merge_time: {}ns, final_merge_time: {}ns",
+                filter_id, print_id(query_ctx->query_id()), cnt_val.merger->expected_producer_num(),
+                cnt_val.partial_mergers.size(), cnt_val.deserialize_time_ns.load(),
+                cnt_val.partial_merge_time_ns.load(), cnt_val.final_merge_time_ns.load());
 
         butil::IOBuf request_attachment;
 
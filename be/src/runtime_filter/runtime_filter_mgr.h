@@ -64,6 +64,13 @@ struct LocalMergeContext {
                              std::shared_ptr<RuntimeFilterProducer> producer);
 };
 
+// A merger which collects the filters of a part of the producers, see
+// `config::runtime_filter_merge_partial_num`.
+struct PartialMergeContext {
+    std::mutex mtx;
+    std::shared_ptr<RuntimeFilterMerger> merger;
+};
+
 struct GlobalMergeContext {
     std::mutex mtx;
     std::shared_ptr<RuntimeFilterMerger> merger;
@@ -71,6 +78,17 @@ struct GlobalMergeContext {
     std::vector<TRuntimeFilterTargetParamsV2> targetv2_info;
     std::unordered_set<UniqueId> arrive_id;
     std::vector<PNetworkAddress> source_addrs;
+
+    // The i-th arrived producer is merged into `partial_mergers[i % partial_mergers.size()]`,
+    // empty means all producers are merged into `merger` directly.
+    std::vector<std::unique_ptr<PartialMergeContext>> partial_mergers;
+    std::atomic<int> arrived_producer_num = 0;
+
+    // time of each merge level, summed over all producers. The non partial path only records
+    // `final_merge_time_ns`, which includes the deserialize.
+    std::atomic<int64_t> deserialize_time_ns = 0;
+    std::atomic<int64_t> partial_merge_time_ns = 0;
+    std::atomic<int64_t> final_merge_time_ns = 0;
 };
 
 // owned by RuntimeState
@@ -150,6 +168,11 @@ private:
                            const std::vector<TRuntimeFilterTargetParamsV2>&& target_info,
                            const int producer_size);
 
+    // Merge the filter into its partial merger, and merge the partial merger into the final
+    // merger once it collected all of its producers.
+    Status _merge_partial(GlobalMergeContext& cnt_val, const RuntimeFilterProducer* filter,
+                          bool* is_ready);
+
     // protect _filter_map
     std::shared_mutex _filter_map_mutex;
     std::shared_ptr<MemTracker> _mem_tracker;
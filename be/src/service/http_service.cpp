@@ -46,12 +46,14 @@
 #include "http/action/dictionary_status_action.h"
 #include "http/action/download_action.h"
 #include "http/action/download_binlog_action.h"
+#include "http/action/drain_action.h"
 #include "http/action/file_cache_action.h"
 #include "http/action/health_action.h"
 #include "http/action/http_stream.h"
 #include "http/action/jeprofile_actions.h"
 #include "http/action/load_channel_action.h"
 #include "http/action/load_stream_action.h"
+#include "http/action/memory_attribution_action.h"
 #include "http/action/meta_action.h"
 #include "http/action/metrics_action.h"
 #include "http/action/pad_rowset_action.h"
@@ -184,6 +186,17 @@ Status HttpService::start() {
     _ev_http_server->register_handler(HttpMethod::GET, "/api/query_pipeline_tasks/{query_id}",
                                       query_pipeline_task_action);
 
+    // Show time pipeline tasks are blocked by dependencies, optionally top_n=N
+    DependencyWaitAction* dependency_wait_action = _pool.add(new DependencyWaitAction(_env));
+    _ev_http_server->register_handler(HttpMethod::GET, "/api/dependency_waits",
+                                      dependency_wait_action);
+
+    // Show memory used by tracker types, caches, queries and operators, optionally top_n=N
+    MemoryAttributionAction* memory_attribution_action =
+            _pool.add(new MemoryAttributionAction(_env));
+    _ev_http_server->register_handler(HttpMethod::GET, "/api/memory_attribution",
+                                      memory_attribution_action);
+
     // Dump all be process thread num
     BeProcThreadAction* be_proc_thread_action = _pool.add(new BeProcThreadAction(_env));
     _ev_http_server->register_handler(HttpMethod::GET, "/api/be_process_thread_num",
@@ -273,6 +286,13 @@ Status HttpService::start() {
     ShrinkMemAction* shrink_mem_action = _pool.add(new ShrinkMemAction(_env));
     _ev_http_server->register_handler(HttpMethod::GET, "/api/shrink_mem", shrink_mem_action);
 
+    // POST to start draining before stopping BE, DELETE to cancel it, GET to poll the in-flight
+    // work left
+    DrainAction* drain_action = _pool.add(new DrainAction(_env));
+    _ev_http_server->register_handler(HttpMethod::GET, "/api/drain", drain_action);
+    _ev_http_server->register_handler(HttpMethod::POST, "/api/drain", drain_action);
+    _ev_http_server->register_handler(HttpMethod::DELETE, "/api/drain", drain_action);
+
 #ifndef BE_TEST
     auto& engine = _env->storage_engine();
     if (config::is_cloud_mode()) {
@@ -17,6 +17,10 @@
 
 #include "service/point_query_executor.h"
 
+#include <bthread/bthread.h>
+#include <bthread/condition_variable.h>
+#include <bthread/mutex.h>
+#include <bvar/bvar.h>
 #include <fmt/format.h>
 #include <gen_cpp/Descriptors_types.h>
 #include <gen_cpp/Exprs_types.h>
@@ -26,8 +30,12 @@
 #include <google/protobuf/extension_set.h>
 #include <stdlib.h>
 
+#include <algorithm>
+#include <cerrno>
 #include <climits>
+#include <map>
 #include <memory>
+#include <numeric>
 #include <unordered_map>
 #include <vector>
 
@@ -35,6 +43,7 @@
 #include "cloud/config.h"
 #include "common/cast_set.h"
 #include "common/consts.h"
+#include "common/exception.h"
 #include "common/status.h"
 #include "olap/lru_cache.h"
 #include "olap/olap_tuple.h"
@@ -50,10 +59,13 @@
 #include "runtime/result_block_buffer.h"
 #include "runtime/runtime_state.h"
 #include "runtime/thread_context.h"
+#include "util/debug_points.h"
+#include "util/defer_op.h"
 #include "util/key_util.h"
 #include "util/runtime_profile.h"
 #include "util/simd/bits.h"
 #include "util/thrift_util.h"
+#include "vec/columns/column_string.h"
 #include "vec/data_types/serde/data_type_serde.h"
 #include "vec/exprs/vexpr.h"
 #include "vec/exprs/vexpr_context.h"
@@ -79,6 +91,30 @@ public:
     }
 };
 
+namespace {
+// Requests of one tablet arriving within point_query_batch_window_us. They wait in brpc handlers,
+// so the batch uses bthread primitives, which do not block the worker pthread.
+struct KeyLookupBatch {
+    std::vector<PointQueryExecutor*> executors;
+    // set when the first request takes the executors to look them up, none leaves after that
+    bool closed = false;
+    bool done = false;
+    Status status;
+    bthread::ConditionVariable cv;
+};
+
+struct KeyLookupBatchShard {
+    bthread::Mutex mtx;
+    // tablet id -> the batch still accepting requests
+    std::unordered_map<int64_t, std::shared_ptr<KeyLookupBatch>> open_batches;
+};
+
+constexpr size_t KEY_LOOKUP_BATCH_SHARDS = 16;
+KeyLookupBatchShard g_key_lookup_batch_shards[KEY_LOOKUP_BATCH_SHARDS];
+bvar::Adder<int64_t> g_point_query_batched_requests("point_query", "batched_requests");
+bvar::Adder<int64_t> g_point_query_batch_wait_timeouts("point_query", "batch_wait_timeouts");
+} // namespace
+
 Reusable::~Reusable() = default;
 
 // get missing and include column ids
@@ -408,48 +444,179 @@ Status PointQueryExecutor::_init_keys(const PTabletKeyLookupRequest* request) {
 Status PointQueryExecutor::_lookup_row_key() {
     SCOPED_TIMER(&_profile_metrics.lookup_key_ns);
     // 2. lookup row location
-    Status st;
     if (_version >= 0) {
         CHECK(config::is_cloud_mode()) << "Only cloud mode support snapshot read at present";
         SyncOptions options;
         options.query_version = _version;
         RETURN_IF_ERROR(std::dynamic_pointer_cast<CloudTablet>(_tablet)->sync_rowsets(options));
+    } else if (config::point_query_batch_window_us > 0) {
+        return _batched_lookup_row_key();
+    }
+    return _lookup_row_keys({this});
+}
+
+Status PointQueryExecutor::_batched_lookup_row_key() {
+    const int64_t tablet_id = _tablet->tablet_id();
+    auto& shard = g_key_lookup_batch_shards[static_cast<uint64_t>(tablet_id) %
+                                            KEY_LOOKUP_BATCH_SHARDS];
+    auto batch = std::make_shared<KeyLookupBatch>();
+    {
+        std::unique_lock<bthread::Mutex> lock(shard.mtx);
+        auto [it, inserted] = shard.open_batches.try_emplace(tablet_id, batch);
+        if (!inserted) {
+            // the first request of the batch looks up the keys for us
+            auto open_batch = it->second;
+            open_batch->executors.push_back(this);
+            g_point_query_batched_requests << 1;
+            const int64_t timeout_us = config::point_query_batch_wait_timeout_ms * 1000L;
+            while (!open_batch->done) {
+                if (open_batch->cv.wait_for(lock, timeout_us) == ETIMEDOUT &&
+                    !open_batch->closed) {
+                    // the first request is late, look up the keys alone. Once the batch is closed
+                    // the first request is looking them up, so keep waiting for it.
+                    std::erase(open_batch->executors, this);
+                    lock.unlock();
+                    g_point_query_batch_wait_timeouts << 1;
+                    return _lookup_row_keys({this});
+                }
+            }
+            return open_batch->status;
+        }
+        batch->executors.push_back(this);
     }
+
+    // wakes up the joined requests however the lookup ends, they must not be left waiting
+    Status st = Status::InternalError("key lookup of the batch of tablet {} is aborted", tablet_id);
+    Defer finish_batch {[&]() {
+        std::lock_guard<bthread::Mutex> lock(shard.mtx);
+        if (!batch->closed) {
+            shard.open_batches.erase(tablet_id);
+            batch->closed = true;
+        }
+        batch->status = st;
+        batch->done = true;
+        batch->cv.notify_all();
+    }};
+
+    bthread_usleep(config::point_query_batch_window_us);
+    {
+        // no request joins or leaves the batch after it is closed
+        std::lock_guard<bthread::Mutex> lock(shard.mtx);
+        shard.open_batches.erase(tablet_id);
+        batch->closed = true;
+    }
+    DBUG_EXECUTE_IF("PointQueryExecutor._batched_lookup_row_key.throw", {
+        throw Exception(Status::InternalError("injected key lookup failure"));
+    });
+    st = _lookup_row_keys(batch->executors);
+    return st;
+}
+
+Status PointQueryExecutor::_lookup_row_keys(const std::vector<PointQueryExecutor*>& executors) {
+    // all executors read the same tablet, the IO stats go to the first one
+    const auto& tablet = executors[0]->_tablet;
+    auto& read_stats = executors[0]->_profile_metrics.read_stats;
     std::vector<RowsetSharedPtr> specified_rowsets;
     {
-        std::shared_lock rlock(_tablet->get_header_lock());
-        specified_rowsets = _tablet->get_rowset_by_ids(nullptr);
+        std::shared_lock rlock(tablet->get_header_lock());
+        specified_rowsets = tablet->get_rowset_by_ids(nullptr);
     }
     std::vector<std::unique_ptr<SegmentCacheHandle>> segment_caches(specified_rowsets.size());
-    for (size_t i = 0; i < _row_read_ctxs.size(); ++i) {
+    // Probe keys in key order, so consecutive lookups of an IN list (or of a batch of
+    // requests) hit the same primary key index pages instead of jumping around.
+    std::vector<std::pair<PointQueryExecutor*, size_t>> lookup_order;
+    for (auto* executor : executors) {
+        for (size_t i = 0; i < executor->_row_read_ctxs.size(); ++i) {
+            lookup_order.emplace_back(executor, i);
+        }
+    }
+    std::sort(lookup_order.begin(), lookup_order.end(), [](const auto& lhs, const auto& rhs) {
+        return lhs.first->_row_read_ctxs[lhs.second]._primary_key <
+               rhs.first->_row_read_ctxs[rhs.second]._primary_key;
+    });
+    Status st;
+    for (auto [executor, i] : lookup_order) {
+        auto& ctx = executor->_row_read_ctxs[i];
         RowLocation location;
         if (!config::disable_storage_row_cache) {
             RowCache::CacheHandle cache_handle;
-            auto hit_cache = RowCache::instance()->lookup(
-                    {_tablet->tablet_id(), _row_read_ctxs[i]._primary_key}, &cache_handle);
+            auto hit_cache = RowCache::instance()->lookup({tablet->tablet_id(), ctx._primary_key},
+                                                          &cache_handle);
             if (hit_cache) {
-                _row_read_ctxs[i]._cached_row_data = std::move(cache_handle);
-                ++_profile_metrics.row_cache_hits;
+                ctx._cached_row_data = std::move(cache_handle);
+                ++executor->_profile_metrics.row_cache_hits;
                 continue;
             }
         }
         // Get rowlocation and rowset, ctx._rowset_ptr will acquire wrap this ptr
         auto rowset_ptr = std::make_unique<RowsetSharedPtr>();
-        st = (_tablet->lookup_row_key(_row_read_ctxs[i]._primary_key, nullptr, false,
-                                      specified_rowsets, &location, INT32_MAX /*rethink?*/,
-                                      segment_caches, rowset_ptr.get(), false, nullptr,
-                                      &_profile_metrics.read_stats));
+        st = (tablet->lookup_row_key(ctx._primary_key, nullptr, false, specified_rowsets,
+                                     &location, INT32_MAX /*rethink?*/, segment_caches,
+                                     rowset_ptr.get(), false, nullptr, &read_stats));
         if (st.is<ErrorCode::KEY_NOT_FOUND>()) {
             continue;
         }
         RETURN_IF_ERROR(st);
-        _row_read_ctxs[i]._row_location = location;
+        ctx._row_location = location;
         // acquire and wrap this rowset
         (*rowset_ptr)->acquire();
         VLOG_DEBUG << "aquire rowset " << (*rowset_ptr)->rowset_id();
-        _row_read_ctxs[i]._rowset_ptr = std::unique_ptr<RowsetSharedPtr, decltype(&release_rowset)>(
+        ctx._rowset_ptr = std::unique_ptr<RowsetSharedPtr, decltype(&release_rowset)>(
                 rowset_ptr.release(), &release_rowset);
-        _row_hits++;
+        executor->_row_hits++;
+    }
+    return Status::OK();
+}
+
+// Read the row store values of rows located in the same segment with one column iterator
+// in row id order, instead of creating an iterator and reading a page per key.
+Status PointQueryExecutor::_batch_lookup_row_store() {
+    std::map<std::pair<RowsetId, uint32_t>, std::vector<size_t>> segment_rows;
+    for (size_t i = 0; i < _row_read_ctxs.size(); ++i) {
+        const auto& ctx = _row_read_ctxs[i];
+        if (!ctx._cached_row_data.valid() && ctx._row_location.has_value()) {
+            segment_rows[{ctx._row_location->rowset_id, ctx._row_location->segment_id}]
+                    .push_back(i);
+        }
+    }
+    bool use_row_cache = !config::disable_storage_row_cache;
+    for (auto& [segment, rows] : segment_rows) {
+        if (rows.size() < 2) {
+            // a single row is read by lookup_row_data
+            continue;
+        }
+        std::sort(rows.begin(), rows.end(), [&](size_t lhs, size_t rhs) {
+            return _row_read_ctxs[lhs]._row_location->row_id <
+                   _row_read_ctxs[rhs]._row_location->row_id;
+        });
+        // the same key may appear more than once in the request
+        std::vector<segment_v2::rowid_t> row_ids;
+        row_ids.reserve(rows.size());
+        for (size_t i : rows) {
+            auto row_id = static_cast<segment_v2::rowid_t>(_row_read_ctxs[i]._row_location->row_id);
+            if (row_ids.empty() || row_ids.back() != row_id) {
+                row_ids.push_back(row_id);
+            }
+        }
+        vectorized::MutableColumnPtr values;
+        RETURN_IF_ERROR(_tablet->lookup_row_data_batch(*(_row_read_ctxs[rows[0]]._rowset_ptr),
+                                                       segment.second, row_ids,
+                                                       _profile_metrics.read_stats, values));
+        const auto& string_column = assert_cast<const vectorized::ColumnString&>(*values);
+        size_t value_idx = 0;
+        for (size_t i : rows) {
+            auto& ctx = _row_read_ctxs[i];
+            auto row_id = static_cast<segment_v2::rowid_t>(ctx._row_location->row_id);
+            while (row_ids[value_idx] != row_id) {
+                ++value_idx;
+            }
+            StringRef value = string_column.get_data_at(value_idx);
+            ctx._row_store_value = value.to_string();
+            if (use_row_cache) {
+                RowCache::instance()->insert({_tablet->tablet_id(), ctx._primary_key},
+                                             Slice {value.data, value.size});
+            }
+        }
     }
     return Status::OK();
 }
@@ -457,6 +624,9 @@ Status PointQueryExecutor::_lookup_row_key() {
 Status PointQueryExecutor::_lookup_row_data() {
     // 3. get values
     SCOPED_TIMER(&_profile_metrics.lookup_data_ns);
+    if (_reusable->rs_column_uid() != -1) {
+        RETURN_IF_ERROR(_batch_lookup_row_store());
+    }
     for (size_t i = 0; i < _row_read_ctxs.size(); ++i) {
         if (_row_read_ctxs[i]._cached_row_data.valid()) {
             RETURN_IF_ERROR(vectorized::JsonbSerializeUtil::jsonb_to_block(
@@ -472,7 +642,13 @@ Status PointQueryExecutor::_lookup_row_data() {
         }
         std::string value;
         // fill block by row store
-        if (_reusable->rs_column_uid() != -1) {
+        if (_reusable->rs_column_uid() != -1 && _row_read_ctxs[i]._row_store_value.has_value()) {
+            value = std::move(*_row_read_ctxs[i]._row_store_value);
+            RETURN_IF_ERROR(vectorized::JsonbSerializeUtil::jsonb_to_block(
+                    _reusable->get_data_type_serdes(), value.data(), value.size(),
+                    _reusable->get_col_uid_to_idx(), *_result_block,
+                    _reusable->get_col_default_values(), _reusable->include_col_uids()));
+        } else if (_reusable->rs_column_uid() != -1) {
             bool use_row_cache = !config::disable_storage_row_cache;
             RETURN_IF_ERROR(_tablet->lookup_row_data(
                     _row_read_ctxs[i]._primary_key, _row_read_ctxs[i]._row_location.value(),
@@ -309,8 +309,13 @@ private:
     Status _init_keys(const PTabletKeyLookupRequest* request);
 
     Status _lookup_row_key();
+    // Looks up the keys together with the concurrent requests of the same tablet
+    Status _batched_lookup_row_key();
+    // Looks up the keys of all executors, which read the same tablet, in key order
+    static Status _lookup_row_keys(const std::vector<PointQueryExecutor*>& executors);
 
     Status _lookup_row_data();
+    Status _batch_lookup_row_store();
 
     Status _output_data();
 
@@ -328,6 +333,8 @@ private:
         std::string _primary_key;
         RowCache::CacheHandle _cached_row_data;
         std::optional<RowLocation> _row_location;
+        // row store value read by _batch_lookup_row_store
+        std::optional<std::string> _row_store_value;
         // rowset will be aquired during read
         // and released after used
         std::unique_ptr<RowsetSharedPtr, decltype(&release_rowset)> _rowset_ptr;
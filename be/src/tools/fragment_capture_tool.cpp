@@ -0,0 +1,183 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <gen_cpp/PaloInternalService_types.h>
+#include <gen_cpp/PlanNodes_types.h>
+#include <gflags/gflags.h>
+#include <thrift/protocol/TDebugProtocol.h>
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "common/status.h"
+#include "runtime/fragment_capture.h"
+#include "util/debug_util.h"
+
+using doris::FragmentCapture;
+using doris::Status;
+using doris::TPipelineFragmentParams;
+
+DEFINE_string(operation, "list", "valid operation: list, show, compare");
+DEFINE_string(capture_dir, "", "directory of the captured fragments");
+DEFINE_string(baseline_dir, "", "directory of the fragments captured on the baseline version");
+DEFINE_string(file, "", "captured fragment file");
+DEFINE_double(regression_ratio, 1.2,
+              "report a fragment as regressed if it is this many times slower than baseline");
+
+std::string get_usage(const std::string& progname) {
+    std::stringstream ss;
+    ss << progname << " inspects the pipeline fragments captured by a BE with "
+       << "enable_fragment_capture=true.\n";
+    ss << "Usage:\n";
+    ss << "./fragment_capture_tool --operation=list --capture_dir=/path/to/capture\n";
+    ss << "./fragment_capture_tool --operation=show --file=/path/to/capture/xxx.fragment\n";
+    ss << "./fragment_capture_tool --operation=compare --baseline_dir=/path/to/old_capture "
+          "--capture_dir=/path/to/new_capture [--regression_ratio=1.2]\n";
+    return ss.str();
+}
+
+struct FragmentTiming {
+    std::string name;
+    uint64_t fingerprint = 0;
+    int64_t exec_time_us = 0;
+};
+
+std::vector<FragmentTiming> read_timings(const std::string& dir) {
+    std::vector<FragmentTiming> timings;
+    std::ifstream file(std::filesystem::path(dir) / FragmentCapture::TIMING_FILE_NAME);
+    FragmentTiming timing;
+    while (file >> timing.name >> timing.fingerprint >> timing.exec_time_us) {
+        timings.push_back(timing);
+    }
+    return timings;
+}
+
+// fingerprint -> median execution time of all runs of the fragment
+std::map<uint64_t, int64_t> median_exec_time(const std::vector<FragmentTiming>& timings) {
+    std::map<uint64_t, std::vector<int64_t>> runs;
+    for (const auto& timing : timings) {
+        runs[timing.fingerprint].push_back(timing.exec_time_us);
+    }
+    std::map<uint64_t, int64_t> medians;
+    for (auto& [fingerprint, exec_times] : runs) {
+        std::sort(exec_times.begin(), exec_times.end());
+        medians[fingerprint] = exec_times[exec_times.size() / 2];
+    }
+    return medians;
+}
+
+std::string plan_summary(const TPipelineFragmentParams& params) {
+    std::stringstream ss;
+    for (const auto& node : params.fragment.plan.nodes) {
+        ss << doris::print_plan_node_type(node.node_type) << "(id=" << node.node_id << ") ";
+    }
+    return ss.str();
+}
+
+int list_fragments() {
+    std::map<std::string, int64_t> exec_times;
+    for (const auto& timing : read_timings(FLAGS_capture_dir)) {
+        exec_times[timing.name] = timing.exec_time_us;
+    }
+    std::error_code ec;
+    for (const auto& entry : std::filesystem::directory_iterator(FLAGS_capture_dir, ec)) {
+        if (entry.path().extension() != FragmentCapture::FRAGMENT_FILE_SUFFIX) {
+            continue;
+        }
+        TPipelineFragmentParams params;
+        uint64_t fingerprint = 0;
+        Status st = FragmentCapture::read_fragment(entry.path(), &params);
+        if (st.ok()) {
+            st = FragmentCapture::fingerprint(params, &fingerprint);
+        }
+        if (!st.ok()) {
+            std::cout << "skip " << entry.path() << ": " << st << std::endl;
+            continue;
+        }
+        auto name = entry.path().stem().native();
+        auto it = exec_times.find(name);
+        std::cout << name << " fingerprint=" << fingerprint << " exec_time_us="
+                  << (it == exec_times.end() ? "unfinished" : std::to_string(it->second))
+                  << " instances=" << params.local_params.size()
+                  << " plan=" << plan_summary(params) << std::endl;
+    }
+    if (ec) {
+        std::cout << "failed to list " << FLAGS_capture_dir << ": " << ec.message() << std::endl;
+        return -1;
+    }
+    return 0;
+}
+
+int show_fragment() {
+    TPipelineFragmentParams params;
+    Status st = FragmentCapture::read_fragment(FLAGS_file, &params);
+    if (!st.ok()) {
+        std::cout << "failed to read " << FLAGS_file << ": " << st << std::endl;
+        return -1;
+    }
+    std::cout << apache::thrift::ThriftDebugString(params) << std::endl;
+    return 0;
+}
+
+// Fragments are matched by plan fingerprint, so the same workload captured on two versions can
+// be compared even though FE assigns new query ids to every run.
+int compare_captures() {
+    auto baseline = median_exec_time(read_timings(FLAGS_baseline_dir));
+    auto current = median_exec_time(read_timings(FLAGS_capture_dir));
+    int num_matched = 0;
+    int num_regressed = 0;
+    for (const auto& [fingerprint, exec_time_us] : current) {
+        auto it = baseline.find(fingerprint);
+        if (it == baseline.end()) {
+            continue;
+        }
+        ++num_matched;
+        double ratio = static_cast<double>(exec_time_us) /
+                       static_cast<double>(std::max<int64_t>(it->second, 1));
+        bool regressed = ratio > FLAGS_regression_ratio;
+        num_regressed += regressed;
+        std::cout << "fingerprint=" << fingerprint << " baseline_us=" << it->second
+                  << " current_us=" << exec_time_us << " ratio=" << ratio
+                  << (regressed ? " REGRESSED" : "") << std::endl;
+    }
+    std::cout << num_matched << " fragments matched, " << num_regressed << " regressed"
+              << std::endl;
+    return num_regressed == 0 ? 0 : 1;
+}
+
+int main(int argc, char** argv) {
+    std::string usage = get_usage(argv[0]);
+    gflags::SetUsageMessage(usage);
+    google::ParseCommandLineFlags(&argc, &argv, true);
+
+    if (FLAGS_operation == "list") {
+        return list_fragments();
+    } else if (FLAGS_operation == "show") {
+        return show_fragment();
+    } else if (FLAGS_operation == "compare") {
+        return compare_captures();
+    }
+    std::cout << "invalid operation:" << FLAGS_operation << std::endl;
+    std::cout << usage << std::endl;
+    return -1;
+}
@@ -101,6 +101,11 @@ public:
     template <typename T>
     bool GetValue(int num_bits, T* v);
 
+    // Gets the next 'num_values' values of 'num_bits' each. Once the stream is byte
+    // aligned the values are unpacked in bulk. Returns the number of values read.
+    template <typename T>
+    int GetBatch(int num_bits, int num_values, T* v);
+
     // Reads a 'num_bytes'-sized value from the buffer and stores it in 'v'. T needs to be a
     // little-endian native type and big enough to store 'num_bytes'. The value is assumed
     // to be byte-aligned so the stream will be advanced to the start of the next byte
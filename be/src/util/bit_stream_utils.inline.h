@@ -21,6 +21,8 @@
 #pragma once
 
 #include <algorithm>
+#include <tuple>
+#include <type_traits>
 
 #include "glog/logging.h"
 #include "util/alignment.h"
@@ -154,6 +156,40 @@ inline void BitReader::Rewind(int num_bits) {
     memcpy(&buffered_values_, buffer_ + byte_offset_, 8);
 }
 
+template <typename T>
+int BitReader::GetBatch(int num_bits, int num_values, T* v) {
+    int num_read = 0;
+    if constexpr (std::is_integral_v<T> && sizeof(T) <= sizeof(uint64_t)) {
+        // bool values are unpacked as bytes of 0 or 1.
+        using UnpackType = typename std::conditional_t<std::is_same_v<T, bool>,
+                                                       std::type_identity<uint8_t>,
+                                                       std::make_unsigned<T>>::type;
+        // Values before the first byte boundary must be read one by one.
+        while (num_read < num_values && (position() & 7) != 0) {
+            if (!GetValue(num_bits, v + num_read)) [[unlikely]] {
+                return num_read;
+            }
+            ++num_read;
+        }
+        if (num_read < num_values) {
+            const int byte_pos = position() >> 3;
+            int64_t num_unpacked = 0;
+            std::tie(std::ignore, num_unpacked) = BitPacking::UnpackValues(
+                    num_bits, buffer_ + byte_pos, max_bytes_ - byte_pos, num_values - num_read,
+                    reinterpret_cast<UnpackType*>(v + num_read));
+            if (!Advance(num_unpacked * num_bits)) [[unlikely]] {
+                return num_read;
+            }
+            num_read += static_cast<int>(num_unpacked);
+        }
+    } else {
+        while (num_read < num_values && GetValue(num_bits, v + num_read)) {
+            ++num_read;
+        }
+    }
+    return num_read;
+}
+
 inline bool BitReader::Advance(int64_t num_bits) {
     int64_t bits_required = bit_offset_ + num_bits;
     int64_t bytes_required = (bits_required >> 3) + ((bits_required & 7) != 0);
@@ -26,19 +26,25 @@
 namespace doris {
 DEFINE_GAUGE_METRIC_PROTOTYPE_2ARG(brpc_endpoint_stub_count, MetricUnit::NOUNIT);
 DEFINE_GAUGE_METRIC_PROTOTYPE_2ARG(brpc_stream_endpoint_stub_count, MetricUnit::NOUNIT);
+DEFINE_GAUGE_METRIC_PROTOTYPE_2ARG(brpc_exchange_endpoint_stub_count, MetricUnit::NOUNIT);
 
 DEFINE_GAUGE_METRIC_PROTOTYPE_2ARG(brpc_function_endpoint_stub_count, MetricUnit::NOUNIT);
 
 template <>
 BrpcClientCache<PBackendService_Stub>::BrpcClientCache(std::string protocol,
                                                        std::string connection_type,
-                                                       std::string connection_group)
+                                                       std::string connection_group,
+                                                       bool use_rdma)
         : _protocol(protocol),
           _connection_type(connection_type),
-          _connection_group(connection_group) {
+          _connection_group(connection_group),
+          _use_rdma(use_rdma) {
     if (connection_group == "streaming") {
         REGISTER_HOOK_METRIC(brpc_stream_endpoint_stub_count,
                              [this]() { return _stub_map.size(); });
+    } else if (connection_group == "exchange") {
+        REGISTER_HOOK_METRIC(brpc_exchange_endpoint_stub_count,
+                             [this]() { return _stub_map.size(); });
     } else {
         REGISTER_HOOK_METRIC(brpc_endpoint_stub_count, [this]() { return _stub_map.size(); });
     }
@@ -46,16 +52,24 @@ BrpcClientCache<PBackendService_Stub>::BrpcClientCache(std::string protocol,
 
 template <>
 BrpcClientCache<PBackendService_Stub>::~BrpcClientCache() {
-    DEREGISTER_HOOK_METRIC(brpc_endpoint_stub_count);
+    if (_connection_group == "streaming") {
+        DEREGISTER_HOOK_METRIC(brpc_stream_endpoint_stub_count);
+    } else if (_connection_group == "exchange") {
+        DEREGISTER_HOOK_METRIC(brpc_exchange_endpoint_stub_count);
+    } else {
+        DEREGISTER_HOOK_METRIC(brpc_endpoint_stub_count);
+    }
 }
 
 template <>
 BrpcClientCache<PFunctionService_Stub>::BrpcClientCache(std::string protocol,
                                                         std::string connection_type,
-                                                        std::string connection_group)
+                                                        std::string connection_group,
+                                                        bool use_rdma)
         : _protocol(protocol),
           _connection_type(connection_type),
-          _connection_group(connection_group) {
+          _connection_group(connection_group),
+          _use_rdma(use_rdma) {
     REGISTER_HOOK_METRIC(brpc_function_endpoint_stub_count, [this]() { return _stub_map.size(); });
 }
 
@@ -135,8 +135,9 @@ private:
 template <class T>
 class BrpcClientCache {
 public:
+    // use_rdma: connect over RDMA instead of TCP, the remote server must enable RDMA too.
     BrpcClientCache(std::string protocol = "baidu_std", std::string connection_type = "",
-                    std::string connection_group = "");
+                    std::string connection_group = "", bool use_rdma = false);
     virtual ~BrpcClientCache();
 
     std::shared_ptr<T> get_client(const butil::EndPoint& endpoint) {
@@ -232,6 +233,7 @@ public:
         options.connect_timeout_ms = 2000;
         options.timeout_ms = 2000;
         options.max_retry = 10;
+        options.use_rdma = _use_rdma;
 
         std::unique_ptr<FailureDetectChannel> channel(new FailureDetectChannel());
         int ret_code = 0;
@@ -312,6 +314,7 @@ private:
     const std::string _protocol;
     const std::string _connection_type;
     const std::string _connection_group;
+    const bool _use_rdma;
     // use to generate unique connection id for each connection
     // to prevent the connection problem of brpc: https://github.com/apache/brpc/issues/2146
     std::atomic<int64_t> _connection_id {0};
@@ -39,7 +39,21 @@ struct ByteBuffer : private Allocator<false> {
         return Status::OK();
     }
 
+    // Reference `size` bytes at `data` without copying, `owner` keeps them alive and is released
+    // with the buffer. Memory not allocated by Doris Allocator is consumed in `mem_tracker` while
+    // the buffer references it, pass nullptr if the memory is already tracked.
+    static ByteBufferPtr wrap(char* data, size_t size, std::shared_ptr<void> owner,
+                              std::shared_ptr<MemTrackerLimiter> mem_tracker = nullptr) {
+        return ByteBufferPtr(new ByteBuffer(data, size, std::move(owner), std::move(mem_tracker)));
+    }
+
     ~ByteBuffer() {
+        if (owner_ != nullptr) {
+            if (mem_tracker_ != nullptr) {
+                mem_tracker_->release(capacity);
+            }
+            return;
+        }
         SCOPED_SWITCH_THREAD_MEM_TRACKER_LIMITER(mem_tracker_);
         Allocator<false>::free(ptr, capacity);
     }
@@ -78,7 +92,21 @@ private:
         ptr = reinterpret_cast<char*>(Allocator<false>::alloc(capacity_));
     }
 
+    ByteBuffer(char* data, size_t size, std::shared_ptr<void> owner,
+               std::shared_ptr<MemTrackerLimiter> mem_tracker)
+            : ptr(data),
+              pos(0),
+              limit(size),
+              capacity(size),
+              mem_tracker_(std::move(mem_tracker)),
+              owner_(std::move(owner)) {
+        if (mem_tracker_ != nullptr) {
+            mem_tracker_->consume(capacity);
+        }
+    }
+
     std::shared_ptr<MemTrackerLimiter> mem_tracker_;
+    std::shared_ptr<void> owner_;
 };
 
 } // namespace doris
@@ -202,6 +202,7 @@ public:
     UIntGauge* new_stream_load_pipe_count = nullptr;
     UIntGauge* brpc_endpoint_stub_count = nullptr;
     UIntGauge* brpc_stream_endpoint_stub_count = nullptr;
+    UIntGauge* brpc_exchange_endpoint_stub_count = nullptr;
     UIntGauge* brpc_function_endpoint_stub_count = nullptr;
     UIntGauge* tablet_writer_count = nullptr;
 
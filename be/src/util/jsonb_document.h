@@ -1035,7 +1035,9 @@ private:
 
         while (pch < fence) {
             auto* pkey = (JsonbKeyValue*)(pch);
-            if (klen == pkey->klen() && strncmp(key, pkey->getKeyStr(), klen) == 0) {
+            // cheap length and first byte checks before the (vectorized) memcmp
+            if (klen == pkey->klen() && key[0] == pkey->getKeyStr()[0] &&
+                memcmp(key, pkey->getKeyStr(), klen) == 0) {
                 return iterator(pkey);
             }
             pch += pkey->numPackedBytes();
@@ -0,0 +1,144 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "util/jsonb_path_trie.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace doris {
+
+bool JsonbPathTrie::add_path(const JsonbPath& path, size_t slot) {
+    if (path.is_wildcard()) {
+        return false;
+    }
+    // validate all legs first so that a rejected path leaves the trie untouched
+    for (size_t i = 0; i < path.get_leg_vector_size(); ++i) {
+        const auto* leg = path.get_leg_from_leg_vector(i);
+        bool wildcard = leg->leg_len == 1 && leg->leg_ptr && *leg->leg_ptr == WILDCARD;
+        if (wildcard || (leg->type == ARRAY_CODE && leg->leg_ptr != nullptr) ||
+            (leg->type != ARRAY_CODE && leg->type != MEMBER_CODE)) {
+            return false;
+        }
+    }
+
+    Node* node = &_root;
+    for (size_t i = 0; i < path.get_leg_vector_size(); ++i) {
+        const auto* leg = path.get_leg_from_leg_vector(i);
+        Node* next = nullptr;
+        if (leg->type == MEMBER_CODE) {
+            std::string key(leg->leg_ptr, leg->leg_len);
+            for (auto& [k, child] : node->members) {
+                if (k == key) {
+                    next = child.get();
+                    break;
+                }
+            }
+            if (next == nullptr) {
+                next = node->members.emplace_back(std::move(key), std::make_unique<Node>())
+                               .second.get();
+            }
+        } else {
+            for (auto& [index, child] : node->indexes) {
+                if (index == leg->array_index) {
+                    next = child.get();
+                    break;
+                }
+            }
+            if (next == nullptr) {
+                next = node->indexes.emplace_back(leg->array_index, std::make_unique<Node>())
+                               .second.get();
+            }
+        }
+        node = next;
+    }
+    node->slots.push_back(slot);
+    _num_slots = std::max(_num_slots, slot + 1);
+    return true;
+}
+
+void JsonbPathTrie::find_values(const JsonbValue* root,
+                                std::vector<const JsonbValue*>& values) const {
+    values.assign(_num_slots, nullptr);
+    if (root != nullptr) {
+        _find(_root, root, values);
+    }
+}
+
+void JsonbPathTrie::_find(const Node& node, const JsonbValue* value,
+                          std::vector<const JsonbValue*>& values) {
+    for (auto slot : node.slots) {
+        values[slot] = value;
+    }
+
+    for (const auto& [index, child] : node.indexes) {
+        if (!value->isArray()) {
+            // same as findValue: $[0] of a scalar or object is the value itself
+            if (index == 0) {
+                _find(*child, value, values);
+            }
+            continue;
+        }
+        const auto* array = value->unpack<ArrayVal>();
+        const auto* elem = array->get(index >= 0 ? index : array->numElem() + index);
+        if (elem != nullptr) {
+            _find(*child, elem, values);
+        }
+    }
+
+    if (node.members.empty() || !value->isObject()) {
+        return;
+    }
+    const auto* object = value->unpack<ObjectVal>();
+    if (node.members.size() == 1 || node.members.size() > 64) {
+        for (const auto& [key, child] : node.members) {
+            const auto* member = object->find(key.data(), (unsigned int)key.size(), nullptr);
+            if (member != nullptr) {
+                _find(*child, member, values);
+            }
+        }
+        return;
+    }
+
+    // One scan over the object for all wanted members. Like ObjectVal::find, the first
+    // occurrence of a duplicated key wins.
+    uint64_t matched = 0;
+    size_t remaining = node.members.size();
+    for (const auto& kv : *object) {
+        const size_t klen = kv.klen();
+        if (klen == 0) {
+            continue;
+        }
+        const char* kstr = kv.getKeyStr();
+        for (size_t j = 0; j < node.members.size(); ++j) {
+            const auto& key = node.members[j].first;
+            if ((matched >> j) & 1 || key.size() != klen || key[0] != kstr[0] ||
+                memcmp(key.data(), kstr, klen) != 0) {
+                continue;
+            }
+            matched |= 1ULL << j;
+            _find(*node.members[j].second, kv.value(), values);
+            --remaining;
+            break;
+        }
+        if (remaining == 0) {
+            break;
+        }
+    }
+}
+
+} // namespace doris
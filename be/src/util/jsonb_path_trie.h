@@ -0,0 +1,58 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "util/jsonb_document.h"
+
+namespace doris {
+
+// Evaluates several json paths against one JSONB document in a single walk. Paths sharing a
+// prefix share trie nodes, so each object on the common prefix is looked up once, and objects
+// with several wanted members are scanned once for all of them.
+class JsonbPathTrie {
+public:
+    // Adds `path`, whose result is reported in values[slot] by find_values(). Returns false for
+    // paths the trie can not evaluate (wildcards), callers should use findValue() instead.
+    bool add_path(const JsonbPath& path, size_t slot);
+
+    size_t num_slots() const { return _num_slots; }
+
+    // Same results as calling root->findValue() with every added path.
+    // values[slot] is nullptr when the path is not found.
+    void find_values(const JsonbValue* root, std::vector<const JsonbValue*>& values) const;
+
+private:
+    struct Node {
+        std::vector<size_t> slots;
+        std::vector<std::pair<std::string, std::unique_ptr<Node>>> members;
+        std::vector<std::pair<int, std::unique_ptr<Node>>> indexes;
+    };
+
+    static void _find(const Node& node, const JsonbValue* value,
+                      std::vector<const JsonbValue*>& values);
+
+    Node _root;
+    size_t _num_slots = 0;
+};
+
+} // namespace doris
@@ -232,6 +232,86 @@ bool PerfCounters::init_sys_counter(Counter counter) {
     return true;
 }
 
+namespace {
+
+// The opened perf event group of a thread, closed when the thread exits.
+struct ThreadCounterGroup {
+    static constexpr PerfCounters::Counter COUNTERS[ThreadHardwareCounters::NUM_COUNTERS] = {
+            PerfCounters::PERF_COUNTER_HW_CPU_CYCLES, PerfCounters::PERF_COUNTER_HW_INSTRUCTIONS,
+            PerfCounters::PERF_COUNTER_HW_CACHE_MISSES,
+            PerfCounters::PERF_COUNTER_HW_BRANCH_MISSES};
+
+    enum State { UNINITIALIZED, AVAILABLE, UNAVAILABLE };
+
+    ~ThreadCounterGroup() { close_all(); }
+
+    void open() {
+        state = UNAVAILABLE;
+        for (int i = 0; i < ThreadHardwareCounters::NUM_COUNTERS; ++i) {
+            perf_event_attr attr;
+            init_event_attr(&attr, COUNTERS[i]);
+            attr.exclude_kernel = 1;
+            attr.exclude_hv = 1;
+            attr.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED |
+                               PERF_FORMAT_TOTAL_TIME_RUNNING;
+            // pid 0 and cpu -1 count the calling thread on whatever cpu it runs.
+            auto fd = sys_perf_event_open(&attr, 0, -1, i == 0 ? -1 : fds[0], 0);
+            if (fd < 0) {
+                close_all();
+                return;
+            }
+            fds[i] = (int)fd;
+        }
+        state = AVAILABLE;
+    }
+
+    void close_all() {
+        for (int& fd : fds) {
+            if (fd >= 0) {
+                close(fd);
+                fd = -1;
+            }
+        }
+    }
+
+    State state = UNINITIALIZED;
+    int fds[ThreadHardwareCounters::NUM_COUNTERS] = {-1, -1, -1, -1};
+};
+
+thread_local ThreadCounterGroup thread_counter_group;
+
+} // namespace
+
+bool ThreadHardwareCounters::read(Values* values) {
+    auto& group = thread_counter_group;
+    if (group.state == ThreadCounterGroup::UNINITIALIZED) [[unlikely]] {
+        group.open();
+    }
+    if (group.state != ThreadCounterGroup::AVAILABLE) {
+        return false;
+    }
+
+    // Layout of PERF_FORMAT_GROUP | TOTAL_TIME_ENABLED | TOTAL_TIME_RUNNING:
+    // nr, time_enabled, time_running, value[nr].
+    uint64_t buffer[3 + NUM_COUNTERS];
+    auto num_bytes = ::read(group.fds[0], buffer, sizeof(buffer));
+    if (num_bytes != sizeof(buffer) || buffer[0] != NUM_COUNTERS) [[unlikely]] {
+        return false;
+    }
+    uint64_t time_enabled = buffer[1];
+    uint64_t time_running = buffer[2];
+    for (int i = 0; i < NUM_COUNTERS; ++i) {
+        uint64_t value = buffer[3 + i];
+        if (time_running > 0 && time_running < time_enabled) {
+            value = static_cast<uint64_t>(static_cast<double>(value) *
+                                          static_cast<double>(time_enabled) /
+                                          static_cast<double>(time_running));
+        }
+        (*values)[i] = static_cast<int64_t>(value);
+    }
+    return true;
+}
+
 bool PerfCounters::init_proc_self_io_counter(Counter counter) {
     CounterData data;
     data.counter = counter;
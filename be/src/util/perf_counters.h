@@ -23,6 +23,7 @@
 #include <gen_cpp/Metrics_types.h>
 #include <stdint.h>
 
+#include <array>
 #include <iostream>
 #include <string>
 #include <vector>
@@ -173,4 +174,32 @@ private:
     static int64_t _vm_peak;
 };
 
+// Hardware counters of the calling thread. The counters are opened lazily as one perf event
+// group the first time a thread reads them, so that all values are sampled together with a
+// single read(2), and stay open until the thread exits. Only user space events are counted.
+//
+// Typical usage:
+//  ThreadHardwareCounters::Values begin, end;
+//  if (ThreadHardwareCounters::read(&begin)) {
+//      <do your work>
+//      ThreadHardwareCounters::read(&end);
+//  }
+class ThreadHardwareCounters {
+public:
+    enum Index {
+        CPU_CYCLES = 0,
+        INSTRUCTIONS,
+        CACHE_MISSES,
+        BRANCH_MISSES,
+        NUM_COUNTERS,
+    };
+    using Values = std::array<int64_t, NUM_COUNTERS>;
+
+    // Read the current counter values of the calling thread. Values are scaled when the kernel
+    // had to multiplex the group. Returns false if the counters are not available on this
+    // thread, e.g. perf events are forbidden or not supported by the hardware; opening is not
+    // retried on that thread afterwards.
+    static bool read(Values* values);
+};
+
 } // namespace doris
@@ -361,11 +361,9 @@ size_t RleDecoder<T>::get_values(T* values, size_t num_values) {
             read_num += read_this_time;
         } else if (literal_count_ > 0) {
             read_this_time = std::min((size_t)literal_count_, read_this_time);
-            for (int i = 0; i < read_this_time; ++i) {
-                bool result = bit_reader_.GetValue(bit_width_, values);
-                DCHECK(result);
-                values++;
-            }
+            int num_read = bit_reader_.GetBatch(bit_width_, cast_set<int>(read_this_time), values);
+            DCHECK_EQ(static_cast<size_t>(num_read), read_this_time);
+            values += read_this_time;
             literal_count_ -= read_this_time;
             read_num += read_this_time;
         } else {
@@ -17,6 +17,7 @@
 
 #pragma once
 
+#include <bit>
 #include <cstdint>
 #include <cstring>
 #include <type_traits>
@@ -125,6 +126,26 @@ void iterate_through_bits_mask(Func func, decltype(bytes_mask_to_bits_mask(nullp
 #endif
 }
 
+// Calls `func(start, length)` for every run of consecutive selected rows in `mask`, so callers can
+// copy a whole run at once instead of row by row.
+template <typename Func>
+void iterate_through_bits_mask_runs(Func func, decltype(bytes_mask_to_bits_mask(nullptr)) mask) {
+#if defined(__ARM_NEON) && defined(__aarch64__)
+    // every selected row is a full nibble, see bytes16_mask_to_bits64_mask
+    constexpr int BITS_PER_ROW = 4;
+#else
+    constexpr int BITS_PER_ROW = 1;
+#endif
+    constexpr int MASK_BITS = sizeof(mask) * 8;
+    while (mask) {
+        const int start = std::countr_zero(mask);
+        const int length = std::countr_one(mask >> start);
+        func(start / BITS_PER_ROW, length / BITS_PER_ROW);
+        const int end = start + length;
+        mask = end >= MASK_BITS ? 0 : mask >> end << end;
+    }
+}
+
 template <typename T>
     requires requires { std::is_unsigned_v<T>; }
 inline T count_zero_num(const int8_t* __restrict data, T size) {
@@ -26,6 +26,7 @@
 
 #include <algorithm>
 #include <cstdlib>
+#include <cstring>
 // IWYU pragma: no_include <bits/std_abs.h>
 #include <cmath> // IWYU pragma: keep
 #include <cstdint>
@@ -263,7 +264,6 @@ inline PURE std::string combine_tz_offset(char sign, uint32_t hour_offset, uint3
 //  - lookup table for converting character to digit
 // Improvements (TODO):
 //  - Validate input using _simd_compare_ranges
-//  - Since we know the length, we can parallelize this: i.e. result = 100*s[0] + 10*s[1] + s[2]
 class StringParser {
 public:
     enum ParseResult { PARSE_SUCCESS = 0, PARSE_FAILURE, PARSE_OVERFLOW, PARSE_UNDERFLOW };
@@ -436,6 +436,22 @@ public:
         }
         return true;
     }
+
+    // SWAR helpers working on eight chars loaded in little-endian order, see fast_float.
+    static inline bool is_made_of_eight_digits(uint64_t val) {
+        return ((val & 0xF0F0F0F0F0F0F0F0ULL) |
+                (((val + 0x0606060606060606ULL) & 0xF0F0F0F0F0F0F0F0ULL) >> 4)) ==
+               0x3333333333333333ULL;
+    }
+
+    static inline uint32_t parse_eight_digits(uint64_t val) {
+        val -= 0x3030303030303030ULL;
+        val = (val * 10) + (val >> 8);
+        val = (((val & 0x000000FF000000FFULL) * (100 + (1000000ULL << 32))) +
+               (((val >> 16) & 0x000000FF000000FFULL) * (1 + (10000ULL << 32)))) >>
+              32;
+        return static_cast<uint32_t>(val);
+    }
 }; // end of class StringParser
 
 template <typename T, bool enable_strict_mode>
@@ -630,7 +646,20 @@ T StringParser::string_to_int_no_overflow(const char* __restrict s, int len, Par
         *result = PARSE_FAILURE;
         return 0;
     }
-    for (int i = 1; i < len; ++i) {
+    int i = 1;
+    if constexpr (sizeof(T) >= sizeof(uint32_t)) {
+        // Consume eight digits per step, the loop below handles the tail and the validation.
+        while (i + 8 <= len) {
+            uint64_t chunk;
+            memcpy(&chunk, s + i, sizeof(chunk));
+            if (!is_made_of_eight_digits(chunk)) {
+                break;
+            }
+            val = static_cast<T>(val * 100000000 + parse_eight_digits(chunk));
+            i += 8;
+        }
+    }
+    for (; i < len; ++i) {
         if (LIKELY(s[i] >= '0' && s[i] <= '9')) {
             T digit = s[i] - '0';
             val = val * 10 + digit;
@@ -358,6 +358,42 @@ public:
             AggregateFunctionCountNotNullUnary::data(place).count += count;
         }
     }
+
+    bool supported_incremental_mode() const override { return true; }
+
+    void execute_function_with_incremental(int64_t partition_start, int64_t partition_end,
+                                           int64_t frame_start, int64_t frame_end,
+                                           AggregateDataPtr place, const IColumn** columns,
+                                           Arena& arena, bool previous_is_nul, bool end_is_nul,
+                                           bool has_null, UInt8* use_null_result,
+                                           UInt8* could_use_previous_result) const override {
+        int64_t current_frame_start = std::max<int64_t>(frame_start, partition_start);
+        int64_t current_frame_end = std::min<int64_t>(frame_end, partition_end);
+        if (current_frame_start >= current_frame_end) {
+            // the count of an empty frame is 0 rather than NULL
+            data(place).count = 0;
+            *could_use_previous_result = false;
+            return;
+        }
+        if (*could_use_previous_result) {
+            const auto& nullable_column =
+                    assert_cast<const ColumnNullable&, TypeCheckOnRelease::DISABLE>(*columns[0]);
+            auto outcoming_pos = frame_start - 1;
+            auto incoming_pos = frame_end - 1;
+            if (outcoming_pos >= partition_start && outcoming_pos < partition_end &&
+                !nullable_column.is_null_at(outcoming_pos)) {
+                --data(place).count;
+            }
+            if (incoming_pos >= partition_start && incoming_pos < partition_end &&
+                !nullable_column.is_null_at(incoming_pos)) {
+                ++data(place).count;
+            }
+        } else {
+            this->add_range_single_place(partition_start, partition_end, frame_start, frame_end,
+                                         place, columns, arena, use_null_result,
+                                         could_use_previous_result);
+        }
+    }
 };
 
 } // namespace doris::vectorized
@@ -22,12 +22,15 @@
 
 #include <stddef.h>
 
+#include <array>
 #include <boost/iterator/iterator_facade.hpp>
+#include <limits>
 #include <memory>
 #include <type_traits>
 #include <vector>
 
 #include "common/compiler_util.h" // IWYU pragma: keep
+#include "util/bitmap_value.h"
 #include "vec/aggregate_functions/aggregate_function.h"
 #include "vec/columns/column.h"
 #include "vec/columns/column_vector.h"
@@ -54,6 +57,9 @@ template <PrimitiveType T>
 class ColumnDecimal;
 /// uniqExact
 
+/// The distinct keys of a group start in an inline array, so that the many groups with a few
+/// keys allocate nothing. Larger groups use a hash set. Integer keys move into a roaring bitmap
+/// once the set is large and dense enough that the bitmap is the smaller one.
 template <PrimitiveType T>
 struct AggregateFunctionUniqExactData {
     static constexpr bool is_string_key = is_string_type(T);
@@ -66,6 +72,21 @@ struct AggregateFunctionUniqExactData {
 
     using Set = flat_hash_set<Key, Hash>;
 
+    static constexpr size_t INLINE_SIZE = sizeof(Key) >= 32 ? 1 : 32 / sizeof(Key);
+    static constexpr bool use_bitmap = std::is_integral_v<Key> && sizeof(Key) <= sizeof(UInt64);
+    // the set is checked for a switch to the bitmap every time it grows by this many keys
+    static constexpr size_t BITMAP_CHECK_INTERVAL = 4096;
+    // a container of the bitmap stores a key in 2 bytes below this average distance of keys,
+    // where the set needs about 16 bytes per key
+    static constexpr UInt64 BITMAP_MAX_KEY_DISTANCE = 64;
+
+    struct DenseKeys {
+        std::unique_ptr<BitmapValue> bitmap;
+        Key min_key = std::numeric_limits<Key>::max();
+        Key max_key = std::numeric_limits<Key>::min();
+    };
+    struct NoDenseKeys {};
+
     static UInt128 ALWAYS_INLINE get_key(const StringRef& value) {
         auto hash_value = XXH_INLINE_XXH128(value.data, value.size, 0);
         return UInt128 {hash_value.high64, hash_value.low64};
@@ -76,11 +97,155 @@ struct AggregateFunctionUniqExactData {
         return hash_value;
     }
 
+    std::array<Key, INLINE_SIZE> inline_keys;
+    UInt8 inline_size = 0;
     Set set;
+    [[no_unique_address]] std::conditional_t<use_bitmap, DenseKeys, NoDenseKeys> dense;
 
     static String get_name() { return "multi_distinct"; }
 
-    void reset() { set.clear(); }
+    bool is_bitmap() const {
+        if constexpr (use_bitmap) {
+            return dense.bitmap != nullptr;
+        } else {
+            return false;
+        }
+    }
+
+    size_t size() const {
+        if constexpr (use_bitmap) {
+            if (dense.bitmap) {
+                return dense.bitmap->cardinality();
+            }
+        }
+        return inline_size + set.size();
+    }
+
+    void ALWAYS_INLINE prefetch(const Key& key) const {
+        if (!set.empty()) {
+            set.prefetch(key);
+        }
+    }
+
+    void reserve(size_t num_keys) {
+        if (!is_bitmap() && num_keys > INLINE_SIZE) {
+            _move_inline_keys_to_set();
+            set.rehash(num_keys);
+        }
+    }
+
+    void ALWAYS_INLINE insert(const Key& key) {
+        if constexpr (use_bitmap) {
+            if (dense.bitmap) {
+                dense.bitmap->add(to_bitmap_value(key));
+                return;
+            }
+        }
+        if (set.empty()) {
+            for (size_t i = 0; i < inline_size; ++i) {
+                if (inline_keys[i] == key) {
+                    return;
+                }
+            }
+            if (inline_size < INLINE_SIZE) {
+                inline_keys[inline_size++] = key;
+                return;
+            }
+            _move_inline_keys_to_set();
+        }
+        if (set.insert(key).second) {
+            if constexpr (use_bitmap) {
+                dense.min_key = std::min(dense.min_key, key);
+                dense.max_key = std::max(dense.max_key, key);
+                if (set.size() % BITMAP_CHECK_INTERVAL == 0) {
+                    _try_convert_to_bitmap();
+                }
+            }
+        }
+    }
+
+    template <typename Func>
+    void for_each(Func&& func) const {
+        if constexpr (use_bitmap) {
+            if (dense.bitmap) {
+                for (auto value : *dense.bitmap) {
+                    func(from_bitmap_value(value));
+                }
+                return;
+            }
+        }
+        for (size_t i = 0; i < inline_size; ++i) {
+            func(inline_keys[i]);
+        }
+        for (const auto& key : set) {
+            func(key);
+        }
+    }
+
+    void merge(const AggregateFunctionUniqExactData& rhs) {
+        if constexpr (use_bitmap) {
+            if (rhs.dense.bitmap) {
+                if (!dense.bitmap) {
+                    _convert_to_bitmap();
+                }
+                *dense.bitmap |= *rhs.dense.bitmap;
+                return;
+            }
+        }
+        if (rhs.size() == 0) {
+            return;
+        }
+        reserve(size() + rhs.size());
+        rhs.for_each([this](const Key& key) { insert(key); });
+    }
+
+    void reset() {
+        inline_size = 0;
+        set.clear();
+        if constexpr (use_bitmap) {
+            dense = DenseKeys {};
+        }
+    }
+
+    // keep the order of signed keys inside one width, so dense keys stay dense
+    static UInt64 to_bitmap_value(Key key) {
+        return static_cast<UInt64>(static_cast<std::make_unsigned_t<Key>>(key));
+    }
+
+    static Key from_bitmap_value(UInt64 value) {
+        return static_cast<Key>(static_cast<std::make_unsigned_t<Key>>(value));
+    }
+
+private:
+    void _move_inline_keys_to_set() {
+        for (size_t i = 0; i < inline_size; ++i) {
+            set.insert(inline_keys[i]);
+            if constexpr (use_bitmap) {
+                dense.min_key = std::min(dense.min_key, inline_keys[i]);
+                dense.max_key = std::max(dense.max_key, inline_keys[i]);
+            }
+        }
+        inline_size = 0;
+    }
+
+    void _try_convert_to_bitmap() {
+        using UnsignedKey = std::make_unsigned_t<Key>;
+        // wraps to the right distance even when the signed keys cross zero
+        auto key_range = static_cast<UnsignedKey>(static_cast<UnsignedKey>(dense.max_key) -
+                                                  static_cast<UnsignedKey>(dense.min_key));
+        if (key_range / BITMAP_MAX_KEY_DISTANCE < set.size()) {
+            _convert_to_bitmap();
+        }
+    }
+
+    void _convert_to_bitmap() {
+        _move_inline_keys_to_set();
+        dense.bitmap = std::make_unique<BitmapValue>();
+        for (const auto& key : set) {
+            dense.bitmap->add(to_bitmap_value(key));
+        }
+        Set().swap(set);
+    }
 };
 
 namespace detail {
@@ -93,18 +258,18 @@ struct OneAdder {
     static void ALWAYS_INLINE add(Data& data, const IColumn& column, size_t row_num) {
         if constexpr (is_string_type(T)) {
             StringRef value = column.get_data_at(row_num);
-            data.set.insert(Data::get_key(value));
+            data.insert(Data::get_key(value));
         } else if constexpr (T == TYPE_ARRAY) {
-            data.set.insert(Data::get_key(column, row_num));
+            data.insert(Data::get_key(column, row_num));
         } else if constexpr (is_decimal(T)) {
-            data.set.insert(assert_cast<const typename PrimitiveTypeTraits<T>::ColumnType&,
-                                        TypeCheckOnRelease::DISABLE>(column)
-                                    .get_data()[row_num]
-                                    .value);
+            data.insert(assert_cast<const typename PrimitiveTypeTraits<T>::ColumnType&,
+                                    TypeCheckOnRelease::DISABLE>(column)
+                                .get_data()[row_num]
+                                .value);
         } else {
-            data.set.insert(assert_cast<const typename PrimitiveTypeTraits<T>::ColumnType&,
-                                        TypeCheckOnRelease::DISABLE>(column)
-                                    .get_data()[row_num]);
+            data.insert(assert_cast<const typename PrimitiveTypeTraits<T>::ColumnType&,
+                                    TypeCheckOnRelease::DISABLE>(column)
+                                .get_data()[row_num]);
         }
     }
 };
@@ -161,89 +326,71 @@ public:
         std::vector<KeyType> keys_container;
         const KeyType* keys = get_keys(keys_container, *columns[0], batch_size);
 
-        std::vector<typename Data::Set*> array_of_data_set(batch_size);
+        std::vector<Data*> array_of_data(batch_size);
 
         for (size_t i = 0; i != batch_size; ++i) {
-            array_of_data_set[i] = &(this->data(places[i] + place_offset).set);
+            array_of_data[i] = &(this->data(places[i] + place_offset));
         }
 
         for (size_t i = 0; i != batch_size; ++i) {
             if (i + HASH_MAP_PREFETCH_DIST < batch_size) {
-                array_of_data_set[i + HASH_MAP_PREFETCH_DIST]->prefetch(
+                array_of_data[i + HASH_MAP_PREFETCH_DIST]->prefetch(
                         keys[i + HASH_MAP_PREFETCH_DIST]);
             }
 
-            array_of_data_set[i]->insert(keys[i]);
+            array_of_data[i]->insert(keys[i]);
         }
     }
 
     void merge(AggregateDataPtr __restrict place, ConstAggregateDataPtr rhs,
                Arena&) const override {
-        auto& rhs_set = this->data(rhs).set;
-        if (rhs_set.size() == 0) return;
-
-        auto& set = this->data(place).set;
-        set.rehash(set.size() + rhs_set.size());
-
-        for (auto elem : rhs_set) {
-            set.insert(elem);
-        }
+        this->data(place).merge(this->data(rhs));
     }
 
     void add_batch_single_place(size_t batch_size, AggregateDataPtr place, const IColumn** columns,
                                 Arena&) const override {
         std::vector<KeyType> keys_container;
         const KeyType* keys = get_keys(keys_container, *columns[0], batch_size);
-        auto& set = this->data(place).set;
+        auto& data = this->data(place);
 
         for (size_t i = 0; i != batch_size; ++i) {
             if (i + HASH_MAP_PREFETCH_DIST < batch_size) {
-                set.prefetch(keys[i + HASH_MAP_PREFETCH_DIST]);
+                data.prefetch(keys[i + HASH_MAP_PREFETCH_DIST]);
             }
-            set.insert(keys[i]);
+            data.insert(keys[i]);
         }
     }
 
+    // The keys are sent as a plain list whatever the representation, so that instances of
+    // different versions can still merge the states.
     void serialize(ConstAggregateDataPtr __restrict place, BufferWritable& buf) const override {
-        auto& set = this->data(place).set;
-        buf.write_var_uint(set.size());
-        for (const auto& elem : set) {
-            buf.write_binary(elem);
-        }
+        const auto& data = this->data(place);
+        buf.write_var_uint(data.size());
+        data.for_each([&](const typename Data::Key& key) { buf.write_binary(key); });
     }
 
     void deserialize_and_merge(AggregateDataPtr __restrict place, AggregateDataPtr __restrict rhs,
-                               BufferReadable& buf, Arena&) const override {
-        auto& set = this->data(place).set;
-        UInt64 size;
-        buf.read_var_uint(size);
-
-        set.rehash(size + set.size());
-
-        for (size_t i = 0; i < size; ++i) {
-            KeyType ref;
-            buf.read_binary(ref);
-            set.insert(ref);
-        }
+                               BufferReadable& buf, Arena& arena) const override {
+        deserialize(place, buf, arena);
     }
 
     void deserialize(AggregateDataPtr __restrict place, BufferReadable& buf,
                      Arena&) const override {
-        auto& set = this->data(place).set;
+        auto& data = this->data(place);
         UInt64 size;
         buf.read_var_uint(size);
 
-        set.rehash(size + set.size());
+        data.reserve(size + data.size());
 
         for (size_t i = 0; i < size; ++i) {
             KeyType ref;
             buf.read_binary(ref);
-            set.insert(ref);
+            data.insert(ref);
         }
     }
 
     void insert_result_into(ConstAggregateDataPtr __restrict place, IColumn& to) const override {
-        assert_cast<ColumnInt64&>(to).get_data().push_back(this->data(place).set.size());
+        assert_cast<ColumnInt64&>(to).get_data().push_back(this->data(place).size());
     }
 };
 
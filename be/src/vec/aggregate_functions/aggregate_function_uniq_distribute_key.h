@@ -67,6 +67,8 @@ struct AggregateFunctionUniqDistributeKeyData {
     Set set;
     UInt64 count = 0;
 
+    void ALWAYS_INLINE insert(const Key& key) { set.insert(key); }
+
     void reset() {
         set.clear();
         count = 0;
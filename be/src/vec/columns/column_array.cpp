@@ -23,6 +23,7 @@
 #include <algorithm>
 #include <boost/iterator/iterator_facade.hpp>
 #include <cstring>
+#include <limits>
 #include <vector>
 
 #include "common/status.h"
@@ -646,42 +647,44 @@ ColumnArrayDataOffsets filter_string_return_new(const Filter& filt, ssize_t resu
         res_offsets.reserve(col_size);
     }
 
-    Offset64 prev_src_offset = 0;
-    IColumn::Offset prev_src_string_offset = 0;
-
-    Offset64 prev_res_offset = 0;
-    IColumn::Offset prev_res_string_offset = 0;
-
-    for (size_t i = 0; i < col_size; ++i) {
-        /// Number of rows in the array.
-        size_t array_size = offsets[i] - prev_src_offset;
-
-        if (filt[i]) {
-            /// If the array is not empty - copy content.
-            if (array_size) {
-                size_t chars_to_copy = src_string_offsets[array_size + prev_src_offset - 1] -
-                                       prev_src_string_offset;
-                size_t res_chars_prev_size = res_chars.size();
-                res_chars.resize(res_chars_prev_size + chars_to_copy);
-                memcpy(&res_chars[res_chars_prev_size], &src_chars[prev_src_string_offset],
-                       chars_to_copy);
-
-                for (size_t j = 0; j < array_size; ++j) {
-                    res_string_offsets.push_back(src_string_offsets[j + prev_src_offset] +
-                                                 prev_res_string_offset - prev_src_string_offset);
-                }
-
-                prev_res_string_offset = res_string_offsets.back();
-            }
+    // Kept rows usually come in runs, the strings of a whole run are contiguous in the source, so
+    // copy their chars at once and rebase their offsets in a single pass.
+    for (size_t i = 0; i < col_size;) {
+        if (!filt[i]) {
+            ++i;
+            continue;
+        }
+        size_t run_end = i + 1;
+        while (run_end < col_size && filt[run_end]) {
+            ++run_end;
+        }
 
-            prev_res_offset += array_size;
-            res_offsets.push_back(prev_res_offset);
+        const Offset64 src_elem_begin = offsets[i - 1];
+        const Offset64 src_elem_end = offsets[run_end - 1];
+        const Offset64 prev_res_offset = res_offsets.empty() ? 0 : res_offsets.back();
+        for (size_t j = i; j < run_end; ++j) {
+            res_offsets.push_back(prev_res_offset + offsets[j] - src_elem_begin);
         }
 
-        if (array_size) {
-            prev_src_offset += array_size;
-            prev_src_string_offset = src_string_offsets[prev_src_offset - 1];
+        if (src_elem_end > src_elem_begin) {
+            const IColumn::Offset src_chars_begin = src_string_offsets[src_elem_begin - 1];
+            const IColumn::Offset src_chars_end = src_string_offsets[src_elem_end - 1];
+            const IColumn::Offset prev_res_string_offset =
+                    res_string_offsets.empty() ? 0 : res_string_offsets.back();
+
+            size_t res_chars_prev_size = res_chars.size();
+            res_chars.resize(res_chars_prev_size + src_chars_end - src_chars_begin);
+            memcpy(&res_chars[res_chars_prev_size], &src_chars[src_chars_begin],
+                   src_chars_end - src_chars_begin);
+
+            size_t res_string_prev_size = res_string_offsets.size();
+            res_string_offsets.resize(res_string_prev_size + src_elem_end - src_elem_begin);
+            for (Offset64 j = src_elem_begin; j < src_elem_end; ++j) {
+                res_string_offsets[res_string_prev_size + j - src_elem_begin] =
+                        src_string_offsets[j] - src_chars_begin + prev_res_string_offset;
+            }
         }
+        i = run_end;
     }
 
     return ColumnArrayDataOffsets {.data = std::move(dst_data), .offsets = std::move(dst_offset)};
@@ -893,9 +896,37 @@ size_t ColumnArray::filter(const Filter& filter) {
 
 void ColumnArray::insert_indices_from(const IColumn& src, const uint32_t* indices_begin,
                                       const uint32_t* indices_end) {
-    for (const auto* x = indices_begin; x != indices_end; ++x) {
-        ColumnArray::insert_from(src, *x);
+    const auto& src_concrete = assert_cast<const ColumnArray&>(src);
+    if (get_data().is_nullable() != src_concrete.get_data().is_nullable() ||
+        src_concrete.get_data().size() > std::numeric_limits<uint32_t>::max()) {
+        for (const auto* x = indices_begin; x != indices_end; ++x) {
+            ColumnArray::insert_from(src, *x);
+        }
+        return;
+    }
+
+    // Gather the positions of all picked elements, so the nested column gets one batched insert
+    // instead of a range insert per row, like `permute` does.
+    auto& res_offsets = get_offsets();
+    const size_t prev_size = res_offsets.size();
+    const size_t num_rows = indices_end - indices_begin;
+    res_offsets.resize(prev_size + num_rows);
+    for (size_t i = 0; i < num_rows; ++i) {
+        res_offsets[prev_size + i] =
+                res_offsets[prev_size + i - 1] + src_concrete.size_at(indices_begin[i]);
+    }
+
+    PaddedPODArray<uint32_t> nested_indices;
+    nested_indices.reserve(res_offsets.back() - res_offsets[prev_size - 1]);
+    for (size_t i = 0; i < num_rows; ++i) {
+        const auto offset = static_cast<uint32_t>(src_concrete.offset_at(indices_begin[i]));
+        const auto size = static_cast<uint32_t>(src_concrete.size_at(indices_begin[i]));
+        for (uint32_t j = 0; j < size; ++j) {
+            nested_indices.push_back(offset + j);
+        }
     }
+    get_data().insert_indices_from(src_concrete.get_data(), nested_indices.data(),
+                                   nested_indices.data() + nested_indices.size());
 }
 
 void ColumnArray::insert_many_from(const IColumn& src, size_t position, size_t length) {
@@ -187,9 +187,40 @@ void ColumnMap::insert_from(const IColumn& src_, size_t n) {
 
 void ColumnMap::insert_indices_from(const IColumn& src, const uint32_t* indices_begin,
                                     const uint32_t* indices_end) {
-    for (const auto* x = indices_begin; x != indices_end; ++x) {
-        ColumnMap::insert_from(src, *x);
+    const auto& src_concrete = assert_cast<const ColumnMap&>(src);
+    if (get_keys().is_nullable() != src_concrete.get_keys().is_nullable() ||
+        get_values().is_nullable() != src_concrete.get_values().is_nullable() ||
+        src_concrete.get_keys().size() > std::numeric_limits<uint32_t>::max()) {
+        for (const auto* x = indices_begin; x != indices_end; ++x) {
+            ColumnMap::insert_from(src, *x);
+        }
+        return;
+    }
+
+    // Gather the positions of all picked entries, so keys and values each get one batched insert
+    // instead of a range insert per row.
+    auto& res_offsets = get_offsets();
+    const size_t prev_size = res_offsets.size();
+    const size_t num_rows = indices_end - indices_begin;
+    res_offsets.resize(prev_size + num_rows);
+    for (size_t i = 0; i < num_rows; ++i) {
+        res_offsets[prev_size + i] =
+                res_offsets[prev_size + i - 1] + src_concrete.size_at(indices_begin[i]);
+    }
+
+    PaddedPODArray<uint32_t> nested_indices;
+    nested_indices.reserve(res_offsets.back() - res_offsets[prev_size - 1]);
+    for (size_t i = 0; i < num_rows; ++i) {
+        const auto offset = static_cast<uint32_t>(src_concrete.offset_at(indices_begin[i]));
+        const auto size = static_cast<uint32_t>(src_concrete.size_at(indices_begin[i]));
+        for (uint32_t j = 0; j < size; ++j) {
+            nested_indices.push_back(offset + j);
+        }
     }
+    keys_column->insert_indices_from(src_concrete.get_keys(), nested_indices.data(),
+                                     nested_indices.data() + nested_indices.size());
+    values_column->insert_indices_from(src_concrete.get_values(), nested_indices.data(),
+                                       nested_indices.data() + nested_indices.size());
 }
 
 void ColumnMap::insert_many_from(const IColumn& src, size_t position, size_t length) {
@@ -1926,7 +1926,8 @@ Status ColumnVariant::convert_typed_path_to_storage_type(
 
 Status ColumnVariant::pick_subcolumns_to_sparse_column(
         const std::unordered_map<std::string, TabletSchema::SubColumnInfo>& typed_paths,
-        bool variant_enable_typed_paths_to_sparse) {
+        bool variant_enable_typed_paths_to_sparse,
+        const std::unordered_set<std::string>& preferred_paths) {
     DCHECK(_max_subcolumns_count >= 0) << "max subcolumns count is: " << _max_subcolumns_count;
 
     // no need to pick subcolumns to sparse column, all subcolumns will be picked
@@ -1978,11 +1979,20 @@ Status ColumnVariant::pick_subcolumns_to_sparse_column(
         }
         none_null_value_sizes[entry->path.get_path()] = size;
     }
-    // 2. sort by the size
+    // 2. sort by the size, paths materialized by earlier segments go first to keep the layout
     std::vector<std::pair<std::string_view, size_t>> sorted_by_size(none_null_value_sizes.begin(),
                                                                     none_null_value_sizes.end());
-    std::sort(sorted_by_size.begin(), sorted_by_size.end(),
-              [](const auto& a, const auto& b) { return a.second > b.second; });
+    auto is_preferred = [&](std::string_view path) {
+        return !preferred_paths.empty() && preferred_paths.contains(std::string(path));
+    };
+    std::sort(sorted_by_size.begin(), sorted_by_size.end(), [&](const auto& a, const auto& b) {
+        bool a_preferred = is_preferred(a.first);
+        bool b_preferred = is_preferred(b.first);
+        if (a_preferred != b_preferred) {
+            return a_preferred;
+        }
+        return a.second > b.second;
+    });
     // 3. pick config::variant_max_subcolumns_count selected subcolumns
     for (size_t i = 0; i < std::min(size_t(_max_subcolumns_count), sorted_by_size.size()); ++i) {
         selected_path.insert(sorted_by_size[i].first);
@@ -574,7 +574,8 @@ public:
 
     Status pick_subcolumns_to_sparse_column(
             const std::unordered_map<std::string, TabletSchema::SubColumnInfo>& typed_paths,
-            bool variant_enable_typed_paths_to_sparse);
+            bool variant_enable_typed_paths_to_sparse,
+            const std::unordered_set<std::string>& preferred_paths = {});
 
     Status convert_typed_path_to_storage_type(
             const std::unordered_map<std::string, TabletSchema::SubColumnInfo>& typed_paths);
@@ -104,6 +104,19 @@ struct ResultOffsetsBuilder {
         res_offsets.push_back_without_reserve(current_src_offset);
     }
 
+    /// `src_offsets_pos` may point into `res_offsets` itself when filtering in place, it is never
+    /// before the write position, so rebasing front to back is safe.
+    void insert_run(const OT* src_offsets_pos, size_t count, OT run_offset) {
+        const auto offsets_size_old = res_offsets.size();
+        res_offsets.resize_assume_reserved(offsets_size_old + count);
+        auto* res_offsets_pos = &res_offsets[offsets_size_old];
+        const OT base = current_src_offset - run_offset;
+        for (size_t i = 0; i < count; ++i) {
+            res_offsets_pos[i] = src_offsets_pos[i] + base;
+        }
+        current_src_offset = res_offsets_pos[count - 1];
+    }
+
     template <size_t SIMD_BYTES>
     void insert_chunk(const OT* src_offsets_pos, bool first, OT chunk_offset, size_t chunk_size) {
         const auto offsets_size_old = res_offsets.size();
@@ -136,6 +149,7 @@ struct NoResultOffsetsBuilder {
     explicit NoResultOffsetsBuilder(PaddedPODArray<OT>*) {}
     void reserve(ssize_t, size_t) {}
     void insert_one(size_t) {}
+    void insert_run(const OT*, size_t, OT) {}
 
     template <size_t SIMD_BYTES>
     void insert_chunk(const OT*, bool, OT, size_t) {}
@@ -178,6 +192,18 @@ void filter_arrays_impl_generic(const PaddedPODArray<T>& src_elems,
         memcpy(&res_elems[elems_size_old], &src_elems[arr_offset], arr_size * sizeof(T));
     };
 
+    /// copy `count` consecutive arrays, the first one ending at *offset_ptr
+    const auto copy_arrays = [&](const OT* offset_ptr, size_t count) {
+        const auto run_offset = offset_ptr == offsets_begin ? 0 : offset_ptr[-1];
+        const auto run_size = offset_ptr[count - 1] - run_offset;
+
+        result_offsets_builder.insert_run(offset_ptr, count, run_offset);
+
+        const auto elems_size_old = res_elems.size();
+        res_elems.resize(elems_size_old + run_size);
+        memcpy(&res_elems[elems_size_old], &src_elems[run_offset], run_size * sizeof(T));
+    };
+
     static constexpr size_t SIMD_BYTES = simd::bits_mask_length();
     const auto filt_end_aligned = filt_pos + size / SIMD_BYTES * SIMD_BYTES;
 
@@ -200,8 +226,11 @@ void filter_arrays_impl_generic(const PaddedPODArray<T>& src_elems,
             res_elems.resize(elems_size_old + chunk_size);
             memcpy(&res_elems[elems_size_old], &src_elems[chunk_offset], chunk_size * sizeof(T));
         } else {
-            simd::iterate_through_bits_mask(
-                    [&](const size_t bit_pos) { copy_array(offsets_pos + bit_pos); }, mask);
+            simd::iterate_through_bits_mask_runs(
+                    [&](const size_t start, const size_t count) {
+                        copy_arrays(offsets_pos + start, count);
+                    },
+                    mask);
         }
 
         filt_pos += SIMD_BYTES;
@@ -253,6 +282,16 @@ size_t filter_arrays_impl_generic_without_reserving(PaddedPODArray<T>& elems,
         result_data += arr_size;
     };
 
+    /// copy `count` consecutive arrays, the first one ending at *offset_ptr
+    const auto copy_arrays = [&](const OT* offset_ptr, size_t count) {
+        const auto run_offset = offset_ptr == offsets_begin ? 0 : offset_ptr[-1];
+        const auto run_size = offset_ptr[count - 1] - run_offset;
+
+        result_offsets_builder.insert_run(offset_ptr, count, run_offset);
+        memmove(result_data, &src_data[run_offset], run_size * sizeof(T));
+        result_data += run_size;
+    };
+
     static constexpr size_t SIMD_BYTES = simd::bits_mask_length();
     const auto filter_end_aligned = filter_pos + size / SIMD_BYTES * SIMD_BYTES;
 
@@ -276,10 +315,10 @@ size_t filter_arrays_impl_generic_without_reserving(PaddedPODArray<T>& elems,
             result_data += chunk_size;
             result_size += SIMD_BYTES;
         } else {
-            simd::iterate_through_bits_mask(
-                    [&](const size_t bit_pos) {
-                        copy_array(offsets_pos + bit_pos);
-                        ++result_size;
+            simd::iterate_through_bits_mask_runs(
+                    [&](const size_t start, const size_t count) {
+                        copy_arrays(offsets_pos + start, count);
+                        result_size += count;
                     },
                     mask);
         }
@@ -17,7 +17,9 @@
 
 #include "vec/common/allocator.h"
 
+#include <bvar/bvar.h>
 #include <glog/logging.h>
+#include <sys/mman.h>
 
 #include <atomic>
 // IWYU pragma: no_include <bits/chrono.h>
@@ -26,6 +28,7 @@
 #include <new>
 #include <random>
 #include <thread>
+#include <type_traits>
 
 // Allocator is used by too many files. For compilation speed, put dependencies in `.cpp` as much as possible.
 #include "common/compiler_util.h"
@@ -40,11 +43,99 @@
 #include "util/pretty_printer.h"
 #include "util/stack_util.h"
 #include "util/uid_util.h"
+#include "vec/common/column_buffer_pool.h"
 
 namespace doris {
 std::unordered_map<void*, size_t> RecordSizeMemoryAllocator::_allocated_sizes;
 std::mutex RecordSizeMemoryAllocator::_mutex;
 
+namespace {
+bvar::Adder<int64_t> g_huge_page_alloc_count("memory_huge_page_alloc_count");
+bvar::Adder<int64_t> g_huge_page_mapped_bytes("memory_huge_page_mapped_bytes");
+bvar::Adder<int64_t> g_huge_page_fallback_count("memory_huge_page_fallback_count");
+
+// Default huge page size on x86_64 and on aarch64 with 4KB base pages.
+constexpr size_t HUGE_PAGE_SIZE = 2 * 1024 * 1024;
+
+enum class HugePageAllocMode { NONE, MADVISE, HUGETLB };
+
+HugePageAllocMode huge_page_alloc_mode() {
+    if (doris::config::huge_page_alloc_mode == "madvise") {
+        return HugePageAllocMode::MADVISE;
+    }
+    if (doris::config::huge_page_alloc_mode == "hugetlb") {
+        return HugePageAllocMode::HUGETLB;
+    }
+    return HugePageAllocMode::NONE;
+}
+
+// Both configs are immutable, so alloc and free of the same size always agree.
+bool is_huge_page_alloc(size_t size) {
+    return doris::config::huge_page_alloc_threshold_bytes > 0 &&
+           size >= doris::config::huge_page_alloc_threshold_bytes &&
+           huge_page_alloc_mode() != HugePageAllocMode::NONE;
+}
+
+size_t huge_page_mapped_size(size_t size) {
+    return (size + HUGE_PAGE_SIZE - 1) & ~(HUGE_PAGE_SIZE - 1);
+}
+
+// Returns a zeroed, 2MB aligned mapping, or nullptr.
+void* mmap_huge_page(size_t size) {
+    const size_t mapped_size = huge_page_mapped_size(size);
+#ifdef MAP_HUGETLB
+    if (huge_page_alloc_mode() == HugePageAllocMode::HUGETLB) {
+        void* buf = mmap(nullptr, mapped_size, PROT_READ | PROT_WRITE,
+                         MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+        if (buf != MAP_FAILED) {
+            g_huge_page_alloc_count << 1;
+            g_huge_page_mapped_bytes << static_cast<int64_t>(mapped_size);
+            return buf;
+        }
+        // The huge page pool is exhausted or not reserved.
+        g_huge_page_fallback_count << 1;
+    }
+#endif
+
+    // Map one more huge page and trim it, so the mapping starts on a huge page boundary as
+    // transparent huge pages need. No MAP_POPULATE, prefaulting would use 4KB pages.
+    void* raw = mmap(nullptr, mapped_size + HUGE_PAGE_SIZE, PROT_READ | PROT_WRITE,
+                     MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (raw == MAP_FAILED) {
+        return nullptr;
+    }
+    auto raw_addr = reinterpret_cast<uintptr_t>(raw);
+    uintptr_t addr = (raw_addr + HUGE_PAGE_SIZE - 1) & ~(HUGE_PAGE_SIZE - 1);
+    const size_t head = addr - raw_addr;
+    if (head > 0) {
+        munmap(raw, head);
+    }
+    if (HUGE_PAGE_SIZE - head > 0) {
+        munmap(reinterpret_cast<void*>(addr + mapped_size), HUGE_PAGE_SIZE - head);
+    }
+    void* buf = reinterpret_cast<void*>(addr);
+#ifdef MADV_HUGEPAGE
+    if (madvise(buf, mapped_size, MADV_HUGEPAGE) != 0) {
+        g_huge_page_fallback_count << 1;
+    }
+#else
+    g_huge_page_fallback_count << 1;
+#endif
+    g_huge_page_alloc_count << 1;
+    g_huge_page_mapped_bytes << static_cast<int64_t>(mapped_size);
+    return buf;
+}
+
+bool munmap_huge_page(void* buf, size_t size) {
+    const size_t mapped_size = huge_page_mapped_size(size);
+    if (munmap(buf, mapped_size) != 0) {
+        return false;
+    }
+    g_huge_page_mapped_bytes << -static_cast<int64_t>(mapped_size);
+    return true;
+}
+} // namespace
+
 template <bool clear_memory_, bool mmap_populate, bool use_mmap, typename MemoryAllocator,
           bool check_and_tracking_memory>
 bool Allocator<clear_memory_, mmap_populate, use_mmap, MemoryAllocator,
@@ -311,6 +402,38 @@ void* Allocator<clear_memory_, mmap_populate, use_mmap, MemoryAllocator,
     void* buf;
     size_t record_size = size;
 
+    if constexpr (std::is_same_v<MemoryAllocator, DefaultMemoryAllocator>) {
+        if (is_huge_page_alloc(size)) {
+            if (alignment > HUGE_PAGE_SIZE) {
+                release_memory(size);
+                throw doris::Exception(
+                        doris::ErrorCode::INVALID_ARGUMENT,
+                        "Too large alignment {}: more than huge page size when allocating {}.",
+                        alignment, size);
+            }
+            buf = mmap_huge_page(size);
+            if (buf == nullptr) {
+                release_memory(size);
+                throw_bad_alloc(fmt::format("Allocator: Cannot mmap huge page {}.", size));
+            }
+            // No need for zero-fill, because mmap guarantees it.
+            return buf;
+        }
+    }
+
+    if constexpr (use_column_buffer_pool()) {
+        if (alignment <= MALLOC_MIN_ALIGNMENT && ColumnBufferPool::is_pooled_size(size) &&
+            !(use_mmap && size >= doris::config::mmap_threshold)) {
+            if (auto* pool = ColumnBufferPool::thread_local_pool(); pool != nullptr) {
+                buf = pool->take(size);
+                if (buf != nullptr) {
+                    add_address_sanitizers(buf, size);
+                    return buf;
+                }
+            }
+        }
+    }
+
     if (use_mmap && size >= doris::config::mmap_threshold) {
         if (alignment > MMAP_MIN_ALIGNMENT) {
             throw doris::Exception(
@@ -374,6 +497,26 @@ template <bool clear_memory_, bool mmap_populate, bool use_mmap, typename Memory
           bool check_and_tracking_memory>
 void Allocator<clear_memory_, mmap_populate, use_mmap, MemoryAllocator,
                check_and_tracking_memory>::free(void* buf, size_t size) {
+    if constexpr (std::is_same_v<MemoryAllocator, DefaultMemoryAllocator>) {
+        if (is_huge_page_alloc(size)) {
+            if (!munmap_huge_page(buf, size)) {
+                throw_bad_alloc(fmt::format("Allocator: Cannot munmap huge page {}.", size));
+            }
+            release_memory(size);
+            return;
+        }
+    }
+    if constexpr (use_column_buffer_pool()) {
+        if (ColumnBufferPool::is_pooled_size(size) &&
+            !(use_mmap && size >= doris::config::mmap_threshold)) {
+            if (auto* pool = ColumnBufferPool::thread_local_pool();
+                pool != nullptr && pool->put(buf, size)) {
+                remove_address_sanitizers(buf, size);
+                release_memory(size);
+                return;
+            }
+        }
+    }
     if (use_mmap && size >= doris::config::mmap_threshold) {
         if (0 != munmap(buf, size)) {
             throw_bad_alloc(fmt::format("Allocator: Cannot munmap {}.", size));
@@ -395,6 +538,15 @@ void* Allocator<clear_memory_, mmap_populate, use_mmap, MemoryAllocator,
         /// BTW, it's not possible to change alignment while doing realloc.
         return buf;
     }
+    if constexpr (std::is_same_v<MemoryAllocator, DefaultMemoryAllocator>) {
+        // Huge page mappings are not mremap'd since the result may lose the 2MB alignment.
+        if (is_huge_page_alloc(old_size) || is_huge_page_alloc(new_size)) {
+            void* new_buf = alloc(new_size, alignment);
+            memcpy(new_buf, buf, std::min(old_size, new_size));
+            free(buf, old_size);
+            return new_buf;
+        }
+    }
     memory_check(new_size);
     // Realloc can do 2 possible things:
     // - expand existing memory region
@@ -57,6 +57,7 @@
 #include <algorithm>
 #include <cstdlib>
 #include <string>
+#include <type_traits>
 
 #include "common/compiler_util.h" // IWYU pragma: keep
 #ifdef THREAD_SANITIZER
@@ -252,6 +253,12 @@ protected:
 
     static constexpr bool clear_memory = clear_memory_;
 
+    // Only uncleared malloc buffers go through ColumnBufferPool, cleared memory would need a
+    // memset that costs about as much as the allocation it saves.
+    static constexpr bool use_column_buffer_pool() {
+        return !clear_memory && std::is_same_v<MemoryAllocator, DefaultMemoryAllocator>;
+    }
+
 private:
     void sys_memory_check(size_t size) const;
     void memory_tracker_check(size_t size) const;
@@ -0,0 +1,129 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "vec/common/column_buffer_pool.h"
+
+#include <bit>
+#include <unordered_set>
+
+#include "common/config.h"
+#include "vec/common/allocator.h"
+
+namespace doris {
+#include "common/compile_check_begin.h"
+
+namespace {
+// Set once the thread local pool is destroyed, frees after that bypass the pool.
+thread_local bool tls_pool_destroyed = false;
+
+// Leaked so that threads exiting during static destruction can still unregister.
+std::mutex* pools_lock = new std::mutex();
+std::unordered_set<ColumnBufferPool*>* pools = new std::unordered_set<ColumnBufferPool*>();
+} // namespace
+
+ColumnBufferPool::ColumnBufferPool() {
+    std::lock_guard l(*pools_lock);
+    pools->insert(this);
+}
+
+ColumnBufferPool::~ColumnBufferPool() {
+    {
+        std::lock_guard l(*pools_lock);
+        pools->erase(this);
+    }
+    clear();
+    tls_pool_destroyed = true;
+}
+
+ColumnBufferPool* ColumnBufferPool::thread_local_pool() {
+    if (!config::enable_column_buffer_pool || tls_pool_destroyed) {
+        return nullptr;
+    }
+    thread_local ColumnBufferPool pool;
+    return &pool;
+}
+
+size_t ColumnBufferPool::_size_class(size_t size) {
+    return std::countr_zero(size) - std::countr_zero(MIN_BUFFER_BYTES);
+}
+
+void* ColumnBufferPool::take(size_t size) {
+    std::lock_guard l(_lock);
+    auto& buffers = _free_buffers[_size_class(size)];
+    if (buffers.empty()) {
+        return nullptr;
+    }
+    void* buf = buffers.back();
+    buffers.pop_back();
+    _cached_bytes -= size;
+    _s_total_cached_bytes.fetch_sub(static_cast<int64_t>(size), std::memory_order_relaxed);
+    return buf;
+}
+
+bool ColumnBufferPool::put(void* buf, size_t size) {
+    std::lock_guard l(_lock);
+    if (_s_memory_pressure.load(std::memory_order_relaxed) ||
+        _cached_bytes + size > static_cast<size_t>(config::column_buffer_pool_thread_cache_bytes) ||
+        _s_total_cached_bytes.load(std::memory_order_relaxed) + static_cast<int64_t>(size) >
+                config::column_buffer_pool_max_cache_bytes) {
+        return false;
+    }
+    _free_buffers[_size_class(size)].push_back(buf);
+    _cached_bytes += size;
+    _s_total_cached_bytes.fetch_add(static_cast<int64_t>(size), std::memory_order_relaxed);
+    return true;
+}
+
+void ColumnBufferPool::clear() {
+    std::lock_guard l(_lock);
+    _clear();
+}
+
+size_t ColumnBufferPool::cached_bytes() {
+    std::lock_guard l(_lock);
+    return _cached_bytes;
+}
+
+void ColumnBufferPool::_clear() {
+    for (size_t i = 0; i < NUM_SIZE_CLASSES; ++i) {
+        for (void* buf : _free_buffers[i]) {
+            DefaultMemoryAllocator::free(buf);
+        }
+        _free_buffers[i].clear();
+        _free_buffers[i].shrink_to_fit();
+    }
+    _s_total_cached_bytes.fetch_sub(static_cast<int64_t>(_cached_bytes),
+                                    std::memory_order_relaxed);
+    _cached_bytes = 0;
+}
+
+void ColumnBufferPool::purge_all() {
+    std::lock_guard l(*pools_lock);
+    for (ColumnBufferPool* pool : *pools) {
+        pool->clear();
+    }
+}
+
+void ColumnBufferPool::set_memory_pressure(bool under_pressure) {
+    if (_s_memory_pressure.exchange(under_pressure, std::memory_order_relaxed) != under_pressure &&
+        under_pressure) {
+        purge_all();
+    }
+}
+
+#include "common/compile_check_end.h"
+} // namespace doris
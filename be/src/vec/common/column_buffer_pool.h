@@ -0,0 +1,87 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace doris {
+
+// Thread local cache of the buffers freed by column storage, so that the next batch processed
+// by the same thread gets its buffers back without going through malloc, free and page faults.
+// Only power of two sizes are cached, which is what PODArray allocates.
+//
+// Task accounting is unchanged: tracking allocators release a buffer from the freeing thread's
+// mem tracker before caching it and consume it again for the thread that takes it, and PODArray
+// tracks its resident bytes itself. Cached bytes are reported by the global ColumnBufferPool
+// mem tracker.
+//
+// Every pool is registered so that purge_all() can free the buffers of idle threads right away.
+// The per pool lock is only contended while a purge runs.
+class ColumnBufferPool {
+public:
+    static constexpr size_t MIN_BUFFER_BYTES = 4096;
+    static constexpr size_t MAX_BUFFER_BYTES = 16 * 1024 * 1024;
+    // 4KB, 8KB, ..., 16MB
+    static constexpr size_t NUM_SIZE_CLASSES = 13;
+
+    ColumnBufferPool();
+    ~ColumnBufferPool();
+    ColumnBufferPool(const ColumnBufferPool&) = delete;
+    ColumnBufferPool& operator=(const ColumnBufferPool&) = delete;
+
+    // Returns nullptr if the pool is disabled or the thread is exiting.
+    static ColumnBufferPool* thread_local_pool();
+
+    static bool is_pooled_size(size_t size) {
+        return size >= MIN_BUFFER_BYTES && size <= MAX_BUFFER_BYTES && (size & (size - 1)) == 0;
+    }
+
+    // Returns a cached buffer of exactly `size` bytes, or nullptr.
+    void* take(size_t size);
+    // Caches `buf`, returns false if the pool is over its limit and the caller should free it.
+    bool put(void* buf, size_t size);
+    void clear();
+
+    size_t cached_bytes();
+
+    // Frees the cached buffers of all threads.
+    static void purge_all();
+    // Stops caching and purges all threads while the process is under memory pressure.
+    static void set_memory_pressure(bool under_pressure);
+    static int64_t total_cached_bytes() {
+        return _s_total_cached_bytes.load(std::memory_order_relaxed);
+    }
+
+private:
+    static size_t _size_class(size_t size);
+    void _clear();
+
+    std::mutex _lock;
+    std::array<std::vector<void*>, NUM_SIZE_CLASSES> _free_buffers;
+    size_t _cached_bytes = 0;
+
+    inline static std::atomic<int64_t> _s_total_cached_bytes {0};
+    inline static std::atomic<bool> _s_memory_pressure {false};
+};
+
+} // namespace doris
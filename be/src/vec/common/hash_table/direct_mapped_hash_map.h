@@ -0,0 +1,314 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <algorithm>
+#include <boost/noncopyable.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+
+#include "common/compiler_util.h"
+#include "vec/common/hash_table/hash.h"
+
+template <typename Key, typename Mapped>
+struct DirectMappedCell {
+    Key key;
+    Mapped mapped;
+};
+
+template <typename Key, typename Mapped>
+ALWAYS_INLINE inline auto lookup_result_get_mapped(DirectMappedCell<Key, Mapped>* cell) {
+    return &cell->mapped;
+}
+
+/// Hash map for unsigned keys of at most 16 bits, used as a perfect hash for group by keys
+/// whose whole domain is small. The key itself is the slot index, so emplace and find never
+/// compute a hash or probe. Slots are allocated in chunks of 256 on first touch, so a few
+/// sparse int16 keys do not pay for all 65536 slots.
+template <typename Key, typename Mapped>
+class DirectMappedHashMap : private boost::noncopyable {
+    static_assert(std::is_unsigned_v<Key> && sizeof(Key) <= sizeof(uint16_t));
+    static_assert(std::is_trivially_copyable_v<Mapped>);
+
+public:
+    using Self = DirectMappedHashMap;
+    using cell_type = DirectMappedCell<Key, Mapped>;
+
+    using key_type = Key;
+    using mapped_type = Mapped;
+    using Value = Mapped;
+    using value_type = cell_type;
+
+    using LookupResult = cell_type*;
+    using ConstLookupResult = const cell_type*;
+
+    /// Lets MethodBaseInner skip computing hash values, which emplace and find ignore.
+    static constexpr bool is_direct_mapped = true;
+
+    static constexpr size_t CHUNK_BITS = 8;
+    static constexpr size_t CHUNK_SIZE = 1ULL << CHUNK_BITS;
+    static constexpr size_t NUM_SLOTS = 1ULL << (sizeof(Key) * 8);
+    static constexpr size_t NUM_CHUNKS = (NUM_SLOTS + CHUNK_SIZE - 1) / CHUNK_SIZE;
+
+    DirectMappedHashMap() = default;
+
+    DirectMappedHashMap(size_t /*reserve_for_num_elements*/) {}
+
+    DirectMappedHashMap(DirectMappedHashMap&& other) { *this = std::move(other); }
+
+    DirectMappedHashMap& operator=(DirectMappedHashMap&& rhs) {
+        for (size_t i = 0; i < NUM_CHUNKS; ++i) {
+            _chunks[i] = std::move(rhs._chunks[i]);
+        }
+        _size = rhs._size;
+        _num_chunks = rhs._num_chunks;
+        rhs._size = 0;
+        rhs._num_chunks = 0;
+        return *this;
+    }
+
+    template <typename Derived, bool is_const>
+    class iterator_base {
+        using Container = std::conditional_t<is_const, const Self, Self>;
+
+        Container* container = nullptr;
+        size_t pos = NUM_SLOTS;
+        friend class DirectMappedHashMap;
+
+    public:
+        iterator_base() = default;
+        iterator_base(Container* container_, size_t pos_) : container(container_), pos(pos_) {}
+
+        bool operator==(const iterator_base& rhs) const { return pos == rhs.pos; }
+        bool operator!=(const iterator_base& rhs) const { return pos != rhs.pos; }
+
+        Derived& operator++() {
+            pos = container->_next_occupied(pos + 1);
+            return static_cast<Derived&>(*this);
+        }
+
+        auto& operator*() const { return *this; }
+        auto* operator->() const { return this; }
+
+        auto& operator*() { return *this; }
+        auto* operator->() { return this; }
+
+        const auto& get_first() const { return container->_cell(pos).key; }
+
+        const auto& get_second() const { return container->_cell(pos).mapped; }
+
+        auto& get_second() { return container->_cell(pos).mapped; }
+
+        auto get_ptr() const { return this; }
+        size_t get_hash() const { return container->hash(get_first()); }
+    };
+
+    class iterator : public iterator_base<iterator, false> {
+    public:
+        using iterator_base<iterator, false>::iterator_base;
+    };
+
+    class const_iterator : public iterator_base<const_iterator, true> {
+    public:
+        using iterator_base<const_iterator, true>::iterator_base;
+    };
+
+    const_iterator begin() const { return const_iterator(this, _next_occupied(0)); }
+
+    const_iterator cbegin() const { return begin(); }
+
+    iterator begin() { return iterator(this, _next_occupied(0)); }
+
+    const_iterator end() const { return const_iterator(this, NUM_SLOTS); }
+    const_iterator cend() const { return end(); }
+    iterator end() { return iterator(this, NUM_SLOTS); }
+
+    template <typename KeyHolder>
+    void ALWAYS_INLINE emplace(KeyHolder&& key, LookupResult& it, bool& inserted) {
+        inserted = _emplace(key, it);
+        if (inserted) {
+            it->mapped = Mapped();
+        }
+    }
+
+    template <typename KeyHolder>
+    void ALWAYS_INLINE emplace(KeyHolder&& key, LookupResult& it, bool& inserted,
+                               size_t /*hash_value*/) {
+        emplace(key, it, inserted);
+    }
+
+    template <typename KeyHolder, typename Func>
+    void ALWAYS_INLINE lazy_emplace(KeyHolder&& key, LookupResult& it, Func&& f) {
+        it = _find_or_slot(key);
+        if (!_occupied(key)) {
+            f([&](const auto& ctor_key, const auto& mapped) { _construct(ctor_key, mapped); },
+              key);
+        }
+    }
+
+    template <typename KeyHolder, typename Func>
+    void ALWAYS_INLINE lazy_emplace(KeyHolder&& key, LookupResult& it, size_t /*hash_value*/,
+                                    Func&& f) {
+        it = _find_or_slot(key);
+        if (!_occupied(key)) {
+            f([&](const auto& ctor_key, const auto& mapped) { _construct(ctor_key, mapped); },
+              key, key);
+        }
+    }
+
+    void ALWAYS_INLINE insert(const Key& key, const Mapped& value) {
+        LookupResult it;
+        if (_emplace(key, it)) {
+            it->mapped = value;
+        }
+    }
+
+    void insert(const iterator& other_iter) {
+        insert(other_iter->get_first(), other_iter->get_second());
+    }
+
+    template <typename KeyHolder>
+    LookupResult ALWAYS_INLINE find(KeyHolder&& key) {
+        return _occupied(key) ? &_cell(_index(key)) : nullptr;
+    }
+
+    template <typename KeyHolder>
+    LookupResult ALWAYS_INLINE find(KeyHolder&& key, size_t /*hash_value*/) {
+        return find(key);
+    }
+
+    /// Only used to spread keys over spill partitions, the lookups never hash.
+    size_t hash(const Key& x) const { return HashCRC32<Key>()(x); }
+
+    template <bool read>
+    void ALWAYS_INLINE prefetch(const Key& key, size_t hash_value) {}
+
+    /// Call func(Mapped &) for each hash map element.
+    template <typename Func>
+    void for_each_mapped(Func&& func) {
+        for (auto& v : *this) func(v.get_second());
+    }
+
+    size_t get_buffer_size_in_bytes() const { return _num_chunks * sizeof(Chunk); }
+
+    bool add_elem_size_overflow(size_t row) const { return false; }
+
+    size_t estimate_memory(size_t num_elem) const {
+        return std::min(num_elem, NUM_CHUNKS - _num_chunks) * sizeof(Chunk);
+    }
+
+    size_t size() const { return _size; }
+    template <typename MappedType>
+    char* get_null_key_data() {
+        return nullptr;
+    }
+    bool has_null_key_data() const { return false; }
+
+    bool empty() const { return _size == 0; }
+
+    void clear() { clear_and_shrink(); }
+
+    void clear_and_shrink() {
+        for (auto& chunk : _chunks) {
+            chunk.reset();
+        }
+        _size = 0;
+        _num_chunks = 0;
+    }
+
+    void reserve(size_t /*num_elem*/) {}
+
+private:
+    struct Chunk {
+        cell_type cells[CHUNK_SIZE];
+        bool occupied[CHUNK_SIZE];
+    };
+
+    static ALWAYS_INLINE size_t _index(const Key& key) { return static_cast<size_t>(key); }
+
+    ALWAYS_INLINE cell_type& _cell(size_t pos) {
+        return _chunks[pos >> CHUNK_BITS]->cells[pos & (CHUNK_SIZE - 1)];
+    }
+
+    ALWAYS_INLINE const cell_type& _cell(size_t pos) const {
+        return _chunks[pos >> CHUNK_BITS]->cells[pos & (CHUNK_SIZE - 1)];
+    }
+
+    ALWAYS_INLINE bool _occupied(const Key& key) const {
+        const size_t pos = _index(key);
+        const auto& chunk = _chunks[pos >> CHUNK_BITS];
+        return chunk != nullptr && chunk->occupied[pos & (CHUNK_SIZE - 1)];
+    }
+
+    /// Returns the slot of key, allocating its chunk if needed. The slot is not marked as
+    /// occupied, so a creator that throws leaves the map unchanged.
+    ALWAYS_INLINE cell_type* _find_or_slot(const Key& key) {
+        const size_t pos = _index(key);
+        auto& chunk = _chunks[pos >> CHUNK_BITS];
+        if (UNLIKELY(chunk == nullptr)) {
+            // value-initialized, so every slot starts unoccupied
+            chunk = std::make_unique<Chunk>();
+            ++_num_chunks;
+        }
+        return &chunk->cells[pos & (CHUNK_SIZE - 1)];
+    }
+
+    template <typename CtorKey>
+    ALWAYS_INLINE void _construct(const CtorKey& key, const Mapped& mapped) {
+        const size_t pos = _index(key);
+        auto& cell = _cell(pos);
+        cell.key = key;
+        cell.mapped = mapped;
+        _chunks[pos >> CHUNK_BITS]->occupied[pos & (CHUNK_SIZE - 1)] = true;
+        ++_size;
+    }
+
+    /// Returns whether key was inserted, it points to the slot of key.
+    ALWAYS_INLINE bool _emplace(const Key& key, LookupResult& it) {
+        it = _find_or_slot(key);
+        if (_occupied(key)) {
+            return false;
+        }
+        const size_t pos = _index(key);
+        it->key = key;
+        _chunks[pos >> CHUNK_BITS]->occupied[pos & (CHUNK_SIZE - 1)] = true;
+        ++_size;
+        return true;
+    }
+
+    size_t _next_occupied(size_t pos) const {
+        while (pos < NUM_SLOTS) {
+            const auto& chunk = _chunks[pos >> CHUNK_BITS];
+            if (chunk == nullptr) {
+                pos = ((pos >> CHUNK_BITS) + 1) << CHUNK_BITS;
+                continue;
+            }
+            if (chunk->occupied[pos & (CHUNK_SIZE - 1)]) {
+                return pos;
+            }
+            ++pos;
+        }
+        return NUM_SLOTS;
+    }
+
+    std::unique_ptr<Chunk> _chunks[NUM_CHUNKS];
+    size_t _size = 0;
+    size_t _num_chunks = 0;
+};
@@ -70,13 +70,14 @@ inline HashKeyType get_hash_key_type_with_fixed(size_t size) {
     }
 }
 
-inline HashKeyType get_hash_key_type_fixed(const std::vector<vectorized::DataTypePtr>& data_types) {
+// The size of the keys packed by MethodKeysFixed, or 0 if some key is not fixed size.
+inline size_t get_fixed_key_packed_size(const std::vector<vectorized::DataTypePtr>& data_types) {
     bool has_null = false;
     size_t key_byte_size = 0;
 
     for (const auto& data_type : data_types) {
         if (!data_type->have_maximum_size_of_value()) {
-            return HashKeyType::serialized;
+            return 0;
         }
         key_byte_size += data_type->get_size_of_value_in_memory();
         if (data_type->is_nullable()) {
@@ -86,7 +87,12 @@ inline HashKeyType get_hash_key_type_fixed(const std::vector<vectorized::DataTyp
     }
 
     size_t bitmap_size = has_null ? vectorized::get_bitmap_size(data_types.size()) : 0;
-    return get_hash_key_type_with_fixed(bitmap_size + key_byte_size);
+    return bitmap_size + key_byte_size;
+}
+
+inline HashKeyType get_hash_key_type_fixed(const std::vector<vectorized::DataTypePtr>& data_types) {
+    size_t size = get_fixed_key_packed_size(data_types);
+    return size == 0 ? HashKeyType::serialized : get_hash_key_type_with_fixed(size);
 }
 
 inline HashKeyType get_hash_key_type(const std::vector<vectorized::DataTypePtr>& data_types) {
@@ -38,6 +38,16 @@ constexpr auto BITSIZE = 8;
 template <typename Base>
 struct DataWithNullKey;
 
+/// Maps whose key is its own slot, such as DirectMappedHashMap, ignore the hash values.
+template <typename T>
+concept DirectMappedMap = T::is_direct_mapped;
+
+/// Join hash tables which may give dense integer keys their own buckets instead of hashing.
+template <typename T>
+concept DirectMappableJoinTable = requires(const T& table, const typename T::key_type& key) {
+    table.direct_bucket_num(key);
+};
+
 template <typename HashMap>
 struct MethodBaseInner {
     using Key = typename HashMap::key_type;
@@ -69,6 +79,16 @@ struct MethodBaseInner {
     void init_join_bucket_num(uint32_t num_rows, uint32_t bucket_size, const uint8_t* null_map) {
         bucket_nums.resize(num_rows);
 
+        if constexpr (DirectMappableJoinTable<HashMap>) {
+            if (hash_table->is_direct_mapping()) {
+                for (uint32_t k = 0; k < num_rows; ++k) {
+                    bucket_nums[k] = null_map && null_map[k]
+                                             ? bucket_size
+                                             : hash_table->direct_bucket_num(keys[k]);
+                }
+                return;
+            }
+        }
         if (null_map == nullptr) {
             init_join_bucket_num(num_rows, bucket_size);
             return;
@@ -86,7 +106,7 @@ struct MethodBaseInner {
     }
 
     void init_hash_values(uint32_t num_rows, const uint8_t* null_map) {
-        if (null_map == nullptr) {
+        if (null_map == nullptr || DirectMappedMap<HashMap>) {
             init_hash_values(num_rows);
             return;
         }
@@ -102,6 +122,9 @@ struct MethodBaseInner {
 
     void init_hash_values(uint32_t num_rows) {
         hash_values.resize(num_rows);
+        if constexpr (DirectMappedMap<HashMap>) {
+            return;
+        }
         for (size_t k = 0; k < num_rows; ++k) {
             hash_values[k] = hash_table->hash(keys[k]);
         }
@@ -396,6 +419,11 @@ struct MethodOneNumber : public MethodBase<TData> {
                                                     .data
                                           : key_columns[0]->get_raw_data().data);
         if (is_join) {
+            if constexpr (DirectMappableJoinTable<typename Base::HashMapType>) {
+                if (is_build) {
+                    hash_table->init_direct_mapping(Base::keys, num_rows, null_map);
+                }
+            }
             Base::init_join_bucket_num(num_rows, bucket_size, null_map);
         } else {
             Base::init_hash_values(num_rows, null_map);
@@ -20,7 +20,10 @@
 #include <gen_cpp/PlanNodes_types.h>
 
 #include <limits>
+#include <type_traits>
 
+#include "common/cast_set.h"
+#include "common/config.h"
 #include "common/exception.h"
 #include "common/status.h"
 #include "vec/columns/column_filter_helper.h"
@@ -58,6 +61,7 @@ public:
         bucket_size = calc_bucket_size(num_elem + 1);
         first.resize(bucket_size + 1);
         next.resize(num_elem);
+        _init_partition_bits();
 
         if constexpr (JoinOpType == TJoinOp::FULL_OUTER_JOIN ||
                       JoinOpType == TJoinOp::RIGHT_OUTER_JOIN ||
@@ -69,6 +73,61 @@ public:
 
     uint32_t get_bucket_size() const { return bucket_size; }
 
+    // Every partition holds the buckets of `first` that fit in `partition_bytes`, the partitions
+    // are computed in `prepare_build`. 0 means no radix partition.
+    void set_radix_partition_bytes(size_t partition_bytes) {
+        _radix_partition_bytes = partition_bytes;
+    }
+
+    uint32_t get_partition_num() const { return 1U << _partition_bits; }
+
+    // Prefetch `first` and the build rows HASH_MAP_PREFETCH_DIST probe rows ahead, which hides
+    // the memory latency when the hash table is much bigger than the cache.
+    void set_probe_prefetch(bool probe_prefetch) { _probe_prefetch = probe_prefetch; }
+
+    // Allow dense integer keys to use `key - min` as bucket number, see `init_direct_mapping`.
+    void set_direct_mapping(bool direct_mapping) { _allow_direct_mapping = direct_mapping; }
+
+    // If the non null build keys (row 0 is not from build side) span fewer buckets than the
+    // table has, every key gets its own bucket without hashing. Keys of a sorted or sequential
+    // build side, like a bucketed fact table joined on its key, usually fit.
+    void init_direct_mapping(const Key* __restrict keys, uint32_t num_rows,
+                             const uint8_t* null_map)
+        requires(std::is_integral_v<Key> && sizeof(Key) <= sizeof(uint64_t))
+    {
+        _direct_mapping = false;
+        if (!_allow_direct_mapping || num_rows <= 1) {
+            return;
+        }
+        Key min_key = std::numeric_limits<Key>::max();
+        Key max_key = std::numeric_limits<Key>::min();
+        for (uint32_t i = 1; i < num_rows; i++) {
+            if (null_map == nullptr || !null_map[i]) {
+                min_key = std::min(min_key, keys[i]);
+                max_key = std::max(max_key, keys[i]);
+            }
+        }
+        if (min_key > max_key) {
+            return;
+        }
+        // bucket `bucket_size - 1` stays empty for the probe keys out of range
+        _direct_mapping_max_offset =
+                static_cast<uint64_t>(max_key) - static_cast<uint64_t>(min_key);
+        _direct_mapping_min = min_key;
+        _direct_mapping = _direct_mapping_max_offset + 1 < bucket_size;
+    }
+
+    bool is_direct_mapping() const { return _direct_mapping; }
+
+    uint32_t direct_bucket_num(Key key) const
+        requires(std::is_integral_v<Key> && sizeof(Key) <= sizeof(uint64_t))
+    {
+        // unsigned wrap around makes the keys smaller than min out of range as well
+        auto offset = static_cast<uint64_t>(key) - static_cast<uint64_t>(_direct_mapping_min);
+        return offset <= _direct_mapping_max_offset ? static_cast<uint32_t>(offset)
+                                                     : bucket_size - 1;
+    }
+
     size_t size() const { return next.size(); }
 
     DorisVector<uint8_t>& get_visited() { return visited; }
@@ -78,10 +137,14 @@ public:
     void build(const Key* __restrict keys, const uint32_t* __restrict bucket_nums,
                uint32_t num_elem, bool keep_null_key) {
         build_keys = keys;
-        for (uint32_t i = 1; i < num_elem; i++) {
-            uint32_t bucket_num = bucket_nums[i];
-            next[i] = first[bucket_num];
-            first[bucket_num] = i;
+        if (_partition_bits > 0) {
+            _build_partitioned(bucket_nums, num_elem);
+        } else {
+            for (uint32_t i = 1; i < num_elem; i++) {
+                uint32_t bucket_num = bucket_nums[i];
+                next[i] = first[bucket_num];
+                first[bucket_num] = i;
+            }
         }
         if (!keep_null_key) {
             first[bucket_size] = 0; // index = bucket_size means null
@@ -211,12 +274,85 @@ public:
     bool keep_null_key() { return _keep_null_key; }
 
     void pre_build_idxs(DorisVector<uint32_t>& buckets) const {
+        if (_partition_bits > 0) {
+            // the hash table may be shared by the probe tasks, so keep the scratch local
+            DorisVector<uint32_t> rows;
+            _sort_by_partition(buckets.data(), 0, cast_set<uint32_t>(buckets.size()), rows);
+            for (auto row : rows) {
+                buckets[row] = first[buckets[row]];
+            }
+            return;
+        }
+        if (_probe_prefetch) {
+            const auto size = buckets.size();
+            for (size_t i = 0; i < size; i++) {
+                if (LIKELY(i + HASH_MAP_PREFETCH_DIST < size)) {
+                    __builtin_prefetch(&first[buckets[i + HASH_MAP_PREFETCH_DIST]], 0, 1);
+                }
+                buckets[i] = first[buckets[i]];
+            }
+            return;
+        }
         for (unsigned int& bucket : buckets) {
             bucket = first[bucket];
         }
     }
 
 private:
+    void _prefetch_build_row(const uint32_t* __restrict build_idx_map, int probe_idx,
+                             int probe_rows) const {
+        if (_probe_prefetch && probe_idx + int(HASH_MAP_PREFETCH_DIST) < probe_rows) {
+            auto idx = build_idx_map[probe_idx + HASH_MAP_PREFETCH_DIST];
+            __builtin_prefetch(&build_keys[idx], 0, 1);
+            __builtin_prefetch(&next[idx], 0, 1);
+        }
+    }
+
+    void _init_partition_bits() {
+        _partition_bits = 0;
+        if (_radix_partition_bytes == 0) {
+            return;
+        }
+        size_t partition_buckets = std::max<size_t>(_radix_partition_bytes / sizeof(uint32_t), 1);
+        // bucket_size is a power of 2
+        while ((size_t(bucket_size) >> _partition_bits) > partition_buckets &&
+               _partition_bits < MAX_PARTITION_BITS) {
+            _partition_bits++;
+        }
+        _partition_shift = __builtin_ctz(bucket_size) - _partition_bits;
+    }
+
+    // the null bucket (`bucket_size`) goes to the extra partition `get_partition_num()`
+    uint32_t _partition_of(uint32_t bucket_num) const { return bucket_num >> _partition_shift; }
+
+    // Stable counting sort of the rows in [begin, end) by partition.
+    void _sort_by_partition(const uint32_t* __restrict bucket_nums, uint32_t begin, uint32_t end,
+                            DorisVector<uint32_t>& rows) const {
+        DorisVector<uint32_t> offsets(get_partition_num() + 2, 0);
+        for (uint32_t i = begin; i < end; i++) {
+            offsets[_partition_of(bucket_nums[i]) + 1]++;
+        }
+        for (size_t i = 1; i < offsets.size(); i++) {
+            offsets[i] += offsets[i - 1];
+        }
+        rows.resize(end - begin);
+        for (uint32_t i = begin; i < end; i++) {
+            rows[offsets[_partition_of(bucket_nums[i])]++] = i;
+        }
+    }
+
+    // Rows of one bucket are inserted in the same order as the non partitioned build, so the
+    // chains (and the join result order) are the same, only the access to `first` is clustered.
+    void _build_partitioned(const uint32_t* __restrict bucket_nums, uint32_t num_elem) {
+        DorisVector<uint32_t> rows;
+        _sort_by_partition(bucket_nums, 1, num_elem, rows);
+        for (auto row : rows) {
+            uint32_t bucket_num = bucket_nums[row];
+            next[row] = first[bucket_num];
+            first[bucket_num] = row;
+        }
+    }
+
     template <int JoinOpType>
     auto _process_null_aware_left_half_join_for_empty_build_side(int probe_idx, int probe_rows,
                                                                  uint32_t* __restrict probe_idxs,
@@ -243,6 +379,7 @@ private:
                                      const uint32_t* __restrict build_idx_map, int probe_idx,
                                      int probe_rows) {
         while (probe_idx < probe_rows) {
+            _prefetch_build_row(build_idx_map, probe_idx, probe_rows);
             auto build_idx = build_idx_map[probe_idx];
 
             while (build_idx) {
@@ -272,6 +409,7 @@ private:
                 }
             }
 
+            _prefetch_build_row(build_idx_map, probe_idx, probe_rows);
             auto build_idx = build_idx_map[probe_idx];
 
             while (build_idx && keys[probe_idx] != build_keys[build_idx]) {
@@ -328,6 +466,7 @@ private:
         }
 
         while (probe_idx < probe_rows && matched_cnt < batch_size) {
+            _prefetch_build_row(build_idx_map, probe_idx, probe_rows);
             build_idx = build_idx_map[probe_idx];
             do_the_probe();
         }
@@ -382,6 +521,7 @@ private:
         }
 
         while (probe_idx < probe_rows && matched_cnt < batch_size) {
+            _prefetch_build_row(build_idx_map, probe_idx, probe_rows);
             build_idx = build_idx_map[probe_idx];
             do_the_probe();
         }
@@ -469,6 +609,16 @@ private:
     DorisVector<uint32_t> first = {0};
     DorisVector<uint32_t> next = {0};
 
+    static constexpr int MAX_PARTITION_BITS = 10;
+    bool _probe_prefetch = false;
+    bool _allow_direct_mapping = false;
+    bool _direct_mapping = false;
+    Key _direct_mapping_min {};
+    uint64_t _direct_mapping_max_offset = 0;
+    size_t _radix_partition_bytes = 0;
+    int _partition_bits = 0;
+    int _partition_shift = 0;
+
     // use in iter hash map
     mutable uint32_t iter_idx = 1;
     bool _has_null_key = false;
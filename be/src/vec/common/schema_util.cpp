@@ -644,7 +644,10 @@ TabletColumn create_sparse_column(const TabletColumn& variant) {
     res.set_default_value("NULL");
     TabletColumn child_tcolumn;
     child_tcolumn.set_type(FieldType::OLAP_FIELD_TYPE_STRING);
-    res.add_sub_column(child_tcolumn);
+    TabletColumn path_tcolumn = child_tcolumn;
+    // per page bloom filter of the paths lets single path reads skip pages without the path
+    path_tcolumn.set_is_bf_column(config::enable_variant_sparse_path_bloom_filter);
+    res.add_sub_column(path_tcolumn);
     res.add_sub_column(child_tcolumn);
     return res;
 }
@@ -78,8 +78,10 @@ void MergeSorterState::add_sorted_block(std::shared_ptr<Block> block) {
 Status MergeSorterState::build_merge_tree(const SortDescription& sort_description) {
     std::vector<MergeSortCursor> cursors;
     for (auto& block : _sorted_blocks) {
-        cursors.emplace_back(
-                MergeSortCursorImpl::create_shared(std::move(block), sort_description));
+        auto cursor = MergeSortCursorImpl::create_shared(std::move(block), sort_description);
+        // rows of the first sort column are compared many times during the merge
+        cursor->enable_key_prefix();
+        cursors.emplace_back(std::move(cursor));
     }
     _queue = MergeSorterQueue(cursors);
 
@@ -23,6 +23,7 @@
 #include <fmt/format.h>
 #include <gen_cpp/data.pb.h>
 #include <glog/logging.h>
+#include <parallel_hashmap/phmap.h>
 #include <snappy.h>
 #include <streamvbyte.h>
 #include <sys/types.h>
@@ -42,6 +43,7 @@
 #include "runtime/descriptors.h"
 #include "runtime/thread_context.h"
 #include "util/block_compression.h"
+#include "util/coding.h"
 #include "util/faststring.h"
 #include "util/runtime_profile.h"
 #include "util/simd/bits.h"
@@ -50,8 +52,10 @@
 #include "vec/columns/column_const.h"
 #include "vec/columns/column_nothing.h"
 #include "vec/columns/column_nullable.h"
+#include "vec/columns/column_string.h"
 #include "vec/columns/column_vector.h"
 #include "vec/common/assert_cast.h"
+#include "vec/common/string_ref.h"
 #include "vec/data_types/data_type_factory.hpp"
 #include "vec/data_types/data_type_nullable.h"
 
@@ -112,10 +116,139 @@ Block::Block(const std::vector<SlotDescriptor>& slots, size_t block_size,
     *this = Block(slot_ptrs, block_size, ignore_trivial_slot);
 }
 
+namespace {
+// Column wise PBlock layout, flagged by compressed=true with compression_type=NO_COMPRESSION,
+// a combination the row wise layout never produces. Every column is written as
+//   varint32 codec | varint32 encoding | varint64 raw size | varint64 payload size | payload
+// so each column is compressed with the codec that suits it and decompressed on its own.
+enum class ColumnWiseEncoding : uint32_t { PLAIN = 0, DICT = 1 };
+
+// Dictionary encode a string column only if it has enough rows and at most rows / 4
+// distinct values, otherwise the dictionary costs more than it saves.
+constexpr size_t DICT_ENCODING_MIN_ROWS = 64;
+constexpr size_t DICT_ENCODING_MAX_CARDINALITY_RATIO = 4;
+
+bool is_column_wise_block(const PBlock& pblock) {
+    return pblock.compressed() && pblock.has_compression_type() &&
+           pblock.compression_type() == segment_v2::NO_COMPRESSION;
+}
+
+segment_v2::CompressionTypePB column_compression_type(
+        const DataTypePtr& type, segment_v2::CompressionTypePB block_compression_type) {
+    const PrimitiveType primitive_type = remove_nullable(type)->get_primitive_type();
+    // bitmap/hll/quantile_state are already compact and barely compress
+    if (block_compression_type == segment_v2::NO_COMPRESSION ||
+        is_var_len_object(primitive_type)) {
+        return segment_v2::NO_COMPRESSION;
+    }
+    // fixed width numbers decompress fastest with lz4 at a similar ratio
+    if (is_number(primitive_type)) {
+        return segment_v2::LZ4;
+    }
+    return block_compression_type;
+}
+
+// Layout: varint64 rows | uint8 nullable | [null map] | varint32 dict size |
+//         length prefixed dict values | int32 codes.
+// Returns false if the column is not a (nullable) string column worth a dictionary.
+bool dict_encode_string_column(const IColumn& column, std::string* raw) {
+    const NullMap* null_map = nullptr;
+    const IColumn* nested = &column;
+    if (const auto* nullable = check_and_get_column<ColumnNullable>(column)) {
+        null_map = &nullable->get_null_map_data();
+        nested = &nullable->get_nested_column();
+    }
+    const auto* strings = check_and_get_column<ColumnString>(*nested);
+    const size_t rows = column.size();
+    if (strings == nullptr || rows < DICT_ENCODING_MIN_ROWS) {
+        return false;
+    }
+
+    const size_t max_dict_size = rows / DICT_ENCODING_MAX_CARDINALITY_RATIO;
+    phmap::flat_hash_map<StringRef, int32_t, StringRefHash> dict_index;
+    std::vector<StringRef> dict;
+    std::vector<int32_t> codes(rows);
+    for (size_t i = 0; i < rows; ++i) {
+        const StringRef value = strings->get_data_at(i);
+        auto [it, inserted] = dict_index.try_emplace(value, static_cast<int32_t>(dict.size()));
+        if (inserted) {
+            if (dict.size() == max_dict_size) {
+                return false;
+            }
+            dict.push_back(value);
+        }
+        codes[i] = it->second;
+    }
+
+    raw->clear();
+    put_varint64(raw, rows);
+    raw->push_back(null_map != nullptr ? 1 : 0);
+    if (null_map != nullptr) {
+        raw->append(reinterpret_cast<const char*>(null_map->data()), rows);
+    }
+    put_varint32(raw, static_cast<uint32_t>(dict.size()));
+    for (const auto& value : dict) {
+        put_length_prefixed_slice(raw, Slice(value.data, value.size));
+    }
+    raw->append(reinterpret_cast<const char*>(codes.data()), rows * sizeof(int32_t));
+    return true;
+}
+
+Status dict_decode_string_column(Slice input, IColumn* column) {
+    uint64_t rows = 0;
+    if (!get_varint64(&input, &rows) || input.size < 1) {
+        return Status::Corruption("Invalid dictionary encoded column header");
+    }
+    const bool nullable = input.data[0] != 0;
+    input.remove_prefix(1);
+    IColumn* nested = column;
+    if (nullable) {
+        if (input.size < rows) {
+            return Status::Corruption("Invalid dictionary encoded column null map");
+        }
+        auto& nullable_column = assert_cast<ColumnNullable&>(*column);
+        auto& null_map = nullable_column.get_null_map_data();
+        null_map.resize(rows);
+        memcpy(null_map.data(), input.data, rows);
+        input.remove_prefix(rows);
+        nested = &nullable_column.get_nested_column();
+    }
+
+    uint32_t dict_size = 0;
+    if (!get_varint32(&input, &dict_size)) {
+        return Status::Corruption("Invalid dictionary encoded column dict size");
+    }
+    std::vector<StringRef> dict(dict_size);
+    for (auto& value : dict) {
+        Slice slice;
+        if (!get_length_prefixed_slice(&input, &slice)) {
+            return Status::Corruption("Invalid dictionary encoded column dict value");
+        }
+        value = StringRef(slice.data, slice.size);
+    }
+    if (input.size < rows * sizeof(int32_t)) {
+        return Status::Corruption("Invalid dictionary encoded column codes");
+    }
+    std::vector<int32_t> codes(rows);
+    memcpy(codes.data(), input.data, rows * sizeof(int32_t));
+    for (const auto code : codes) {
+        if (code < 0 || static_cast<uint32_t>(code) >= dict_size) {
+            return Status::Corruption("Dictionary code {} out of range {}", code, dict_size);
+        }
+    }
+    assert_cast<ColumnString&>(*nested).insert_many_dict_data(codes.data(), 0, dict.data(), rows,
+                                                              dict_size);
+    return Status::OK();
+}
+} // namespace
+
 Status Block::deserialize(const PBlock& pblock) {
     swap(Block());
     int be_exec_version = pblock.has_be_exec_version() ? pblock.be_exec_version() : 0;
     RETURN_IF_ERROR(BeExecVersionManager::check_be_exec_version(be_exec_version));
+    if (is_column_wise_block(pblock)) {
+        return _deserialize_column_wise(pblock);
+    }
 
     const char* buf = nullptr;
     std::string compression_scratch;
@@ -163,6 +296,105 @@ Status Block::deserialize(const PBlock& pblock) {
     return Status::OK();
 }
 
+Status Block::deserialize(const PBlock& pblock, const std::vector<uint32_t>& column_ids) {
+    DCHECK(std::is_sorted(column_ids.begin(), column_ids.end()));
+    if (is_column_wise_block(pblock)) {
+        swap(Block());
+        int be_exec_version = pblock.has_be_exec_version() ? pblock.be_exec_version() : 0;
+        RETURN_IF_ERROR(BeExecVersionManager::check_be_exec_version(be_exec_version));
+        return _deserialize_column_wise(pblock, &column_ids);
+    }
+    // the row wise layout can only be decoded as a whole
+    Block full_block;
+    RETURN_IF_ERROR(full_block.deserialize(pblock));
+    swap(Block());
+    for (auto column_id : column_ids) {
+        if (column_id >= full_block.columns()) {
+            return Status::InvalidArgument("column id {} out of range {}", column_id,
+                                           full_block.columns());
+        }
+        insert(full_block.get_by_position(column_id));
+    }
+    _decompressed_bytes = full_block.get_decompressed_bytes();
+    return Status::OK();
+}
+
+Status Block::_deserialize_column_wise(const PBlock& pblock,
+                                       const std::vector<uint32_t>* column_ids) {
+    Slice input(pblock.column_values());
+    std::string raw;
+    int64_t decompressed_bytes = 0;
+    // column_ids are ascending, so one cursor is enough to pick the wanted columns
+    std::vector<uint32_t>::const_iterator next_column_id;
+    if (column_ids) {
+        next_column_id = column_ids->begin();
+    }
+    uint32_t column_id = 0;
+    for (const auto& pcol_meta : pblock.column_metas()) {
+        if (column_ids && next_column_id == column_ids->end()) {
+            break;
+        }
+        uint32_t compression_type = 0;
+        uint32_t encoding = 0;
+        uint64_t raw_size = 0;
+        uint64_t payload_size = 0;
+        if (!get_varint32(&input, &compression_type) || !get_varint32(&input, &encoding) ||
+            !get_varint64(&input, &raw_size) || !get_varint64(&input, &payload_size) ||
+            input.size < payload_size) {
+            return Status::Corruption("Invalid column wise block, column {}", pcol_meta.name());
+        }
+        Slice payload(input.data, payload_size);
+        input.remove_prefix(payload_size);
+        if (column_ids) {
+            if (*next_column_id != column_id++) {
+                continue;
+            }
+            ++next_column_id;
+        }
+
+        // type->deserialize may read up to STREAMVBYTE_PADDING bytes past the data
+        raw.resize(raw_size + STREAMVBYTE_PADDING);
+        if (compression_type == segment_v2::NO_COMPRESSION) {
+            if (payload_size != raw_size) {
+                return Status::Corruption("Invalid column wise block, column {}",
+                                          pcol_meta.name());
+            }
+            memcpy(raw.data(), payload.data, payload_size);
+        } else {
+            SCOPED_RAW_TIMER(&_decompress_time_ns);
+            BlockCompressionCodec* codec;
+            RETURN_IF_ERROR(get_block_compression_codec(
+                    static_cast<segment_v2::CompressionTypePB>(compression_type), &codec));
+            Slice decompressed_slice(raw.data(), raw_size);
+            RETURN_IF_ERROR(codec->decompress(payload, &decompressed_slice));
+            if (decompressed_slice.size != raw_size) {
+                return Status::Corruption("Invalid column wise block, column {}",
+                                          pcol_meta.name());
+            }
+        }
+        decompressed_bytes += static_cast<int64_t>(raw_size);
+
+        DataTypePtr type = DataTypeFactory::instance().create_data_type(pcol_meta);
+        MutableColumnPtr data_column = type->create_column();
+        if (encoding == static_cast<uint32_t>(ColumnWiseEncoding::DICT)) {
+            RETURN_IF_ERROR_OR_CATCH_EXCEPTION(
+                    dict_decode_string_column(Slice(raw.data(), raw_size), data_column.get()));
+        } else {
+            RETURN_IF_CATCH_EXCEPTION(
+                    type->deserialize(raw.data(), &data_column, pblock.be_exec_version()));
+        }
+        data.emplace_back(data_column->get_ptr(), type, pcol_meta.name());
+    }
+    if (column_ids && next_column_id != column_ids->end()) {
+        return Status::InvalidArgument("column id {} out of range {}", *next_column_id,
+                                       pblock.column_metas_size());
+    }
+    _decompressed_bytes = decompressed_bytes;
+    initialize_index_by_name();
+
+    return Status::OK();
+}
+
 void Block::reserve(size_t count) {
     index_by_name.reserve(count);
     data.reserve(count);
@@ -916,7 +1148,7 @@ Status Block::filter_block(Block* block, size_t filter_column_id, size_t column_
 Status Block::serialize(int be_exec_version, PBlock* pblock,
                         /*std::string* compressed_buffer,*/ size_t* uncompressed_bytes,
                         size_t* compressed_bytes, segment_v2::CompressionTypePB compression_type,
-                        bool allow_transfer_large_data) const {
+                        bool allow_transfer_large_data, bool column_wise) const {
     RETURN_IF_ERROR(BeExecVersionManager::check_be_exec_version(be_exec_version));
     pblock->set_be_exec_version(be_exec_version);
 
@@ -926,11 +1158,26 @@ Status Block::serialize(int be_exec_version, PBlock* pblock,
         PColumnMeta* pcm = pblock->add_column_metas();
         c.to_pb_column_meta(pcm);
         DCHECK(pcm->type() != PGenericType::UNKNOWN) << " forget to set pb type";
+        if (column_wise) {
+            continue;
+        }
         // get serialized size
         content_uncompressed_size +=
                 c.type->get_uncompressed_serialized_bytes(*(c.column), pblock->be_exec_version());
     }
 
+    if (column_wise) {
+        RETURN_IF_ERROR(_serialize_column_wise(pblock, uncompressed_bytes, compressed_bytes,
+                                               compression_type));
+        if (!allow_transfer_large_data &&
+            *compressed_bytes >= std::numeric_limits<int32_t>::max()) {
+            return Status::InternalError(
+                    "The block is large than 2GB({}), can not send by Protobuf.",
+                    *compressed_bytes);
+        }
+        return Status::OK();
+    }
+
     // serialize data values
     // when data type is HLL, content_uncompressed_size maybe larger than real size.
     std::string column_values;
@@ -987,6 +1234,53 @@ Status Block::serialize(int be_exec_version, PBlock* pblock,
     return Status::OK();
 }
 
+Status Block::_serialize_column_wise(PBlock* pblock, size_t* uncompressed_bytes,
+                                     size_t* compressed_bytes,
+                                     segment_v2::CompressionTypePB compression_type) const {
+    const int be_exec_version = pblock->be_exec_version();
+    std::string column_values;
+    std::string raw;
+    faststring buf_compressed;
+    size_t content_uncompressed_size = 0;
+    for (const auto& c : *this) {
+        auto encoding = ColumnWiseEncoding::DICT;
+        if (!dict_encode_string_column(*c.column, &raw)) {
+            encoding = ColumnWiseEncoding::PLAIN;
+            raw.resize(c.type->get_uncompressed_serialized_bytes(*c.column, be_exec_version));
+            char* end = c.type->serialize(*c.column, raw.data(), be_exec_version);
+            raw.resize(static_cast<size_t>(end - raw.data()));
+        }
+        content_uncompressed_size += raw.size();
+
+        auto column_compression = column_compression_type(c.type, compression_type);
+        Slice payload(raw);
+        if (column_compression != segment_v2::NO_COMPRESSION && !raw.empty()) {
+            SCOPED_RAW_TIMER(&_compress_time_ns);
+            BlockCompressionCodec* codec;
+            RETURN_IF_ERROR(get_block_compression_codec(column_compression, &codec));
+            RETURN_IF_ERROR_OR_CATCH_EXCEPTION(codec->compress(Slice(raw), &buf_compressed));
+            if (buf_compressed.size() < raw.size()) {
+                payload = Slice(buf_compressed.data(), buf_compressed.size());
+            } else {
+                column_compression = segment_v2::NO_COMPRESSION;
+            }
+        }
+        put_varint32(&column_values, static_cast<uint32_t>(column_compression));
+        put_varint32(&column_values, static_cast<uint32_t>(encoding));
+        put_varint64(&column_values, raw.size());
+        put_varint64(&column_values, payload.size);
+        column_values.append(payload.data, payload.size);
+    }
+
+    *uncompressed_bytes = content_uncompressed_size;
+    *compressed_bytes = column_values.size();
+    pblock->set_compressed(true);
+    pblock->set_compression_type(segment_v2::NO_COMPRESSION);
+    pblock->set_uncompressed_size(content_uncompressed_size);
+    pblock->set_column_values(std::move(column_values));
+    return Status::OK();
+}
+
 MutableBlock::MutableBlock(const std::vector<TupleDescriptor*>& tuple_descs, int reserve_size,
                            bool ignore_trivial_slot) {
     for (auto* const tuple_desc : tuple_descs) {
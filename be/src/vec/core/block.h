@@ -288,12 +288,18 @@ public:
     }
 
     // serialize block to PBlock
+    // column_wise: compress every column on its own and dictionary encode low cardinality
+    // string columns, only receivers that understand this layout may be sent such blocks.
     Status serialize(int be_exec_version, PBlock* pblock, size_t* uncompressed_bytes,
                      size_t* compressed_bytes, segment_v2::CompressionTypePB compression_type,
-                     bool allow_transfer_large_data = false) const;
+                     bool allow_transfer_large_data = false, bool column_wise = false) const;
 
     Status deserialize(const PBlock& pblock);
 
+    // Only materialize the columns at the given ascending positions. The payloads of the
+    // other columns of a column wise block are skipped without being decompressed.
+    Status deserialize(const PBlock& pblock, const std::vector<uint32_t>& column_ids);
+
     std::unique_ptr<Block> create_same_struct_block(size_t size, bool is_reserve = false) const;
 
     /** Compares (*this) n-th row and rhs m-th row.
@@ -390,6 +396,12 @@ public:
 
 private:
     void erase_impl(size_t position);
+
+    Status _serialize_column_wise(PBlock* pblock, size_t* uncompressed_bytes,
+                                  size_t* compressed_bytes,
+                                  segment_v2::CompressionTypePB compression_type) const;
+    Status _deserialize_column_wise(const PBlock& pblock,
+                                    const std::vector<uint32_t>* column_ids = nullptr);
 };
 
 using Blocks = std::vector<Block>;
@@ -0,0 +1,154 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "vec/core/sort_cursor.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include "vec/columns/column_decimal.h"
+#include "vec/columns/column_nullable.h"
+#include "vec/columns/column_string.h"
+#include "vec/columns/column_vector.h"
+#include "vec/common/assert_cast.h"
+
+namespace doris::vectorized {
+#include "common/compile_check_begin.h"
+
+namespace {
+
+constexpr UInt64 SIGN_BIT = 1ULL << 63;
+
+template <typename T>
+UInt64 encode_integer(T value) {
+    if constexpr (std::is_same_v<T, Int128>) {
+        // only the high half, so equal prefixes are ties
+        return static_cast<UInt64>(static_cast<Int64>(value >> 64)) ^ SIGN_BIT;
+    } else if constexpr (std::is_signed_v<T>) {
+        return static_cast<UInt64>(static_cast<Int64>(value)) ^ SIGN_BIT;
+    } else {
+        return static_cast<UInt64>(value);
+    }
+}
+
+// The first 8 bytes of the string in big endian, so that integer order is memcmp order.
+UInt64 encode_string(const StringRef& value) {
+    UInt64 prefix = 0;
+    memcpy(&prefix, value.data, std::min<size_t>(value.size, sizeof(prefix)));
+    return __builtin_bswap64(prefix);
+}
+
+template <typename ColumnType>
+bool encode_vector(const IColumn& column, std::vector<UInt64>& prefixes) {
+    const auto* typed = check_and_get_column<ColumnType>(column);
+    if (typed == nullptr) {
+        return false;
+    }
+    const auto& data = typed->get_data();
+    for (size_t i = 0; i < prefixes.size(); ++i) {
+        prefixes[i] = encode_integer(data[i]);
+    }
+    return true;
+}
+
+template <typename ColumnType>
+bool encode_decimal(const IColumn& column, std::vector<UInt64>& prefixes) {
+    const auto* typed = check_and_get_column<ColumnType>(column);
+    if (typed == nullptr) {
+        return false;
+    }
+    const auto& data = typed->get_data();
+    for (size_t i = 0; i < prefixes.size(); ++i) {
+        prefixes[i] = encode_integer(data[i].value);
+    }
+    return true;
+}
+
+template <typename ColumnType>
+bool encode_strings(const IColumn& column, std::vector<UInt64>& prefixes) {
+    const auto* typed = check_and_get_column<ColumnType>(column);
+    if (typed == nullptr) {
+        return false;
+    }
+    for (size_t i = 0; i < prefixes.size(); ++i) {
+        prefixes[i] = encode_string(typed->get_data_at(i));
+    }
+    return true;
+}
+
+} // namespace
+
+void MergeSortCursorImpl::_build_key_prefixes() {
+    key_prefixes.clear();
+    key_prefix_exact = false;
+    if (sort_columns.empty() || rows == 0) {
+        return;
+    }
+
+    const IColumn* column = sort_columns[0];
+    const NullMap* null_map = nullptr;
+    if (const auto* nullable = check_and_get_column<ColumnNullable>(*column)) {
+        if (nullable->has_null()) {
+            null_map = &nullable->get_null_map_data();
+        }
+        column = &nullable->get_nested_column();
+    }
+
+    key_prefixes.resize(rows);
+    // Values of at most 8 bytes are encoded whole, wider ones only by their leading bytes.
+    bool exact = encode_vector<ColumnUInt8>(*column, key_prefixes) ||
+                 encode_vector<ColumnInt8>(*column, key_prefixes) ||
+                 encode_vector<ColumnInt16>(*column, key_prefixes) ||
+                 encode_vector<ColumnInt32>(*column, key_prefixes) ||
+                 encode_vector<ColumnInt64>(*column, key_prefixes) ||
+                 encode_vector<ColumnDateV2>(*column, key_prefixes) ||
+                 encode_vector<ColumnDateTimeV2>(*column, key_prefixes) ||
+                 encode_vector<ColumnIPv4>(*column, key_prefixes) ||
+                 encode_decimal<ColumnDecimal32>(*column, key_prefixes) ||
+                 encode_decimal<ColumnDecimal64>(*column, key_prefixes);
+    if (!exact && !encode_vector<ColumnInt128>(*column, key_prefixes) &&
+        !encode_decimal<ColumnDecimal128V2>(*column, key_prefixes) &&
+        !encode_decimal<ColumnDecimal128V3>(*column, key_prefixes) &&
+        !encode_strings<ColumnString>(*column, key_prefixes) &&
+        !encode_strings<ColumnString64>(*column, key_prefixes)) {
+        key_prefixes.clear();
+        return;
+    }
+
+    const auto& column_desc = desc[0];
+    if (column_desc.direction < 0) {
+        for (auto& prefix : key_prefixes) {
+            prefix = ~prefix;
+        }
+    }
+    if (null_map != nullptr) {
+        // null compares as nulls_direction against any value, before direction is applied
+        const UInt64 null_prefix =
+                column_desc.direction * column_desc.nulls_direction > 0 ? ~0ULL : 0;
+        for (size_t i = 0; i < key_prefixes.size(); ++i) {
+            if ((*null_map)[i]) {
+                key_prefixes[i] = null_prefix;
+            }
+        }
+        // a null and a value may share a prefix
+        exact = false;
+    }
+    key_prefix_exact = exact;
+}
+
+#include "common/compile_check_end.h"
+} // namespace doris::vectorized
@@ -43,6 +43,12 @@ struct MergeSortCursorImpl {
     size_t sort_columns_size = 0;
     int pos = 0;
     int rows = 0;
+    // Normalized keys of the first sort column: comparing two prefixes as integers gives the
+    // order of their rows, equal prefixes need the column compare unless key_prefix_exact.
+    // Only built after enable_key_prefix() and for the types _build_key_prefixes() knows.
+    bool use_key_prefix = false;
+    bool key_prefix_exact = false;
+    std::vector<UInt64> key_prefixes;
 
     MergeSortCursorImpl() = default;
     virtual ~MergeSortCursorImpl() = default;
@@ -94,6 +100,14 @@ struct MergeSortCursorImpl {
 
         pos = 0;
         rows = (int)block->rows();
+        if (use_key_prefix) {
+            _build_key_prefixes();
+        }
+    }
+
+    void enable_key_prefix() {
+        use_key_prefix = true;
+        _build_key_prefixes();
     }
 
     bool is_first() const { return pos == 0; }
@@ -110,6 +124,9 @@ struct MergeSortCursorImpl {
         sort_columns[0]->get(pos, field);
         return field;
     }
+
+private:
+    void _build_key_prefixes();
 };
 
 using BlockSupplier = std::function<Status(Block*, bool* eos)>;
@@ -176,7 +193,18 @@ struct MergeSortCursor {
 
     /// The specified row of this cursor is greater than the specified row of another cursor.
     int8_t greater_at(const MergeSortCursor& rhs, size_t lhs_pos, size_t rhs_pos) const {
-        for (size_t i = 0; i < impl->sort_columns_size; ++i) {
+        size_t i = 0;
+        if (!impl->key_prefixes.empty() && !rhs.impl->key_prefixes.empty()) {
+            const UInt64 lhs_prefix = impl->key_prefixes[lhs_pos];
+            const UInt64 rhs_prefix = rhs.impl->key_prefixes[rhs_pos];
+            if (lhs_prefix != rhs_prefix) {
+                return lhs_prefix > rhs_prefix ? 1 : -1;
+            }
+            if (impl->key_prefix_exact && rhs.impl->key_prefix_exact) {
+                i = 1;
+            }
+        }
+        for (; i < impl->sort_columns_size; ++i) {
             int direction = impl->desc[i].direction;
             int nulls_direction = impl->desc[i].nulls_direction;
             int res = direction * impl->sort_columns[i]->compare_at(lhs_pos, rhs_pos,
@@ -469,6 +497,97 @@ private:
         }
     }
 };
+
+/// Tournament tree of losers over a fixed set of cursors. Compared to a binary heap it needs only
+/// one comparison per level to restore the order after the top cursor moves, which matters when
+/// merging many inputs row by row. Leaf i is cursor i, internal node n stores the loser of the
+/// match played at n and node 0 stores the overall winner. Only the winner may change, so the
+/// top cursor either advances (update_top) or is finished (remove_top).
+template <typename Cursor>
+class LoserTree {
+public:
+    LoserTree() = default;
+
+    template <typename Cursors>
+    explicit LoserTree(const Cursors& cursors) {
+        _cursors.reserve(cursors.size());
+        _active.reserve(cursors.size());
+        for (const auto& cursor : cursors) {
+            _cursors.emplace_back(cursor);
+            _active.push_back(!cursor->eof());
+            _size += _active.back();
+        }
+        if (!_cursors.empty()) {
+            _tree.resize(_cursors.size());
+            _tree[0] = _build(1);
+        }
+    }
+
+    bool empty() const { return _size == 0; }
+    size_t size() const { return _size; }
+
+    Cursor& top() {
+        DCHECK(!empty());
+        return _cursors[_tree[0]];
+    }
+
+    /// The top cursor moved to its next row.
+    void update_top() { _replay(_tree[0]); }
+
+    /// The top cursor has no more rows.
+    void remove_top() {
+        DCHECK(_active[_tree[0]]);
+        _active[_tree[0]] = false;
+        --_size;
+        _replay(_tree[0]);
+    }
+
+private:
+    /// Whether leaf `lhs` must be returned before leaf `rhs`. Finished leaves lose every match,
+    /// ties are broken by the leaf index to keep the result deterministic.
+    bool _beats(size_t lhs, size_t rhs) const {
+        if (!_active[lhs]) {
+            return false;
+        }
+        if (!_active[rhs]) {
+            return true;
+        }
+        const auto& l = _cursors[lhs];
+        const auto& r = _cursors[rhs];
+        const auto res = l.greater_at(r, l->pos, r->pos);
+        return res < 0 || (res == 0 && lhs < rhs);
+    }
+
+    size_t _build(size_t node) {
+        if (node >= _cursors.size()) {
+            return node - _cursors.size();
+        }
+        size_t left = _build(2 * node);
+        size_t right = _build(2 * node + 1);
+        if (_beats(left, right)) {
+            _tree[node] = right;
+            return left;
+        }
+        _tree[node] = left;
+        return right;
+    }
+
+    void _replay(size_t leaf) {
+        size_t winner = leaf;
+        for (size_t node = (leaf + _cursors.size()) / 2; node > 0; node /= 2) {
+            if (_beats(_tree[node], winner)) {
+                std::swap(_tree[node], winner);
+            }
+        }
+        _tree[0] = winner;
+    }
+
+    std::vector<Cursor> _cursors;
+    std::vector<uint8_t> _active;
+    std::vector<size_t> _tree;
+    size_t _size = 0;
+};
+
 template <typename Cursor>
 using SortingQueue = SortingQueueImpl<Cursor, SortingQueueStrategy::Default>;
 template <typename Cursor>
@@ -652,7 +652,6 @@ Status DataTypeNumberSerDe<T>::from_string_strict_mode_batch(
     const auto size = str.size();
     column.resize(size);
 
-    size_t current_offset = 0;
     const ColumnString::Chars* chars = &str.get_chars();
     const IColumn::Offsets* offsets = &str.get_offsets();
 
@@ -664,6 +663,8 @@ Status DataTypeNumberSerDe<T>::from_string_strict_mode_batch(
         if (null_map && null_map[i]) {
             continue;
         }
+        // offsets[-1] is 0, and skipped null rows must not shift the start of the next row.
+        size_t current_offset = (*offsets)[i - 1];
         size_t next_offset = (*offsets)[i];
         size_t string_size = next_offset - current_offset;
 
@@ -673,7 +674,6 @@ Status DataTypeNumberSerDe<T>::from_string_strict_mode_batch(
                     "parse number fail, string: '{}'",
                     std::string((char*)&(*chars)[current_offset], string_size));
         }
-        current_offset = next_offset;
     }
     return Status::OK();
 }
@@ -19,6 +19,7 @@
 
 #include <fmt/format.h>
 
+#include <algorithm>
 #include <chrono>
 #include <functional>
 #include <thread>
@@ -121,6 +122,10 @@ void PrioritizedSplitRunner::set_ready() {
     _last_ready.store(_ticker->read());
 }
 
+int64_t PrioritizedSplitRunner::ready_wait_nanos() const {
+    return std::max<int64_t>(0, _ticker->read() - _last_ready.load());
+}
+
 /**
  * Updates the (potentially stale) priority value cached in this object.
  * This should be called when this object is outside the queue.
@@ -64,6 +64,8 @@ public:
     int64_t scheduled_nanos() const;
     Result<SharedListenableFuture<Void>> process();
     void set_ready();
+    // Nanos since the split was last offered to the split queue.
+    int64_t ready_wait_nanos() const;
     bool update_level_priority();
     void reset_level_priority();
     int64_t worker_id() const;
@@ -17,6 +17,7 @@
 
 #include "vec/exec/executor/time_sharing/time_sharing_task_executor.h"
 
+#include <algorithm>
 #include <functional>
 #include <iostream>
 #include <sstream>
@@ -51,6 +52,24 @@ DEFINE_COUNTER_METRIC_PROTOTYPE_2ARG(split_thread_pool_task_wait_worker_time_ns_
 DEFINE_COUNTER_METRIC_PROTOTYPE_2ARG(split_thread_pool_task_wait_worker_count_total,
                                      MetricUnit::NOUNIT);
 
+// Queue wait time per multilevel split queue level, measured from the last time a split became
+// ready, so re-queued splits are counted as well.
+#define DEFINE_SPLIT_LEVEL_WAIT_METRIC(level)                                                   \
+    DEFINE_COUNTER_METRIC_PROTOTYPE_5ARG(split_thread_pool_level##level##_wait_time_ns_total,   \
+                                         MetricUnit::NANOSECONDS, "",                           \
+                                         split_thread_pool_level_wait_time_ns_total,            \
+                                         Labels({{"level", #level}}));                          \
+    DEFINE_COUNTER_METRIC_PROTOTYPE_5ARG(split_thread_pool_level##level##_wait_count_total,     \
+                                         MetricUnit::NOUNIT, "",                                \
+                                         split_thread_pool_level_wait_count_total,              \
+                                         Labels({{"level", #level}}))
+DEFINE_SPLIT_LEVEL_WAIT_METRIC(0);
+DEFINE_SPLIT_LEVEL_WAIT_METRIC(1);
+DEFINE_SPLIT_LEVEL_WAIT_METRIC(2);
+DEFINE_SPLIT_LEVEL_WAIT_METRIC(3);
+DEFINE_SPLIT_LEVEL_WAIT_METRIC(4);
+static_assert(MultilevelSplitQueue::LEVEL_THRESHOLD_SECONDS.size() == 5);
+
 SplitThreadPoolToken::SplitThreadPoolToken(TimeSharingTaskExecutor* pool,
                                            TimeSharingTaskExecutor::ExecutionMode mode,
                                            std::shared_ptr<SplitQueue> split_queue,
@@ -242,6 +261,25 @@ Status TimeSharingTaskExecutor::init() {
     INT_COUNTER_METRIC_REGISTER(_metric_entity, split_thread_pool_task_wait_worker_count_total);
     INT_COUNTER_METRIC_REGISTER(_metric_entity, split_thread_pool_submit_failed);
 
+    const std::array<std::pair<MetricPrototype*, MetricPrototype*>, 5> level_wait_metrics = {{
+            {&METRIC_split_thread_pool_level0_wait_time_ns_total,
+             &METRIC_split_thread_pool_level0_wait_count_total},
+            {&METRIC_split_thread_pool_level1_wait_time_ns_total,
+             &METRIC_split_thread_pool_level1_wait_count_total},
+            {&METRIC_split_thread_pool_level2_wait_time_ns_total,
+             &METRIC_split_thread_pool_level2_wait_count_total},
+            {&METRIC_split_thread_pool_level3_wait_time_ns_total,
+             &METRIC_split_thread_pool_level3_wait_count_total},
+            {&METRIC_split_thread_pool_level4_wait_time_ns_total,
+             &METRIC_split_thread_pool_level4_wait_count_total},
+    }};
+    for (size_t level = 0; level < level_wait_metrics.size(); ++level) {
+        split_thread_pool_level_wait_time_ns_total[level] = (IntCounter*)(
+                _metric_entity->register_metric<IntCounter>(level_wait_metrics[level].first));
+        split_thread_pool_level_wait_count_total[level] = (IntCounter*)(
+                _metric_entity->register_metric<IntCounter>(level_wait_metrics[level].second));
+    }
+
     _metric_entity->register_hook("update", [this]() {
         {
             std::lock_guard<std::mutex> l(_lock);
@@ -545,6 +583,10 @@ void TimeSharingTaskExecutor::_dispatch_thread() {
         split_thread_pool_task_wait_worker_time_ns_total->increment(
                 split->submit_time_watch().elapsed_time());
         split_thread_pool_task_wait_worker_count_total->increment(1);
+        size_t level = std::min<size_t>(split->priority().level(),
+                                        split_thread_pool_level_wait_time_ns_total.size() - 1);
+        split_thread_pool_level_wait_time_ns_total[level]->increment(split->ready_wait_nanos());
+        split_thread_pool_level_wait_count_total[level]->increment(1);
         _tokenless->_active_threads++;
         --_total_queued_tasks;
         ++_active_threads;
@@ -17,6 +17,7 @@
 
 #pragma once
 
+#include <array>
 #include <atomic>
 #include <boost/intrusive/detail/algo_type.hpp>
 #include <boost/intrusive/list.hpp>
@@ -377,6 +378,10 @@ private:
     IntCounter* split_thread_pool_task_execution_count_total = nullptr;
     IntCounter* split_thread_pool_task_wait_worker_time_ns_total = nullptr;
     IntCounter* split_thread_pool_task_wait_worker_count_total = nullptr;
+    std::array<IntCounter*, MultilevelSplitQueue::LEVEL_THRESHOLD_SECONDS.size()>
+            split_thread_pool_level_wait_time_ns_total {};
+    std::array<IntCounter*, MultilevelSplitQueue::LEVEL_THRESHOLD_SECONDS.size()>
+            split_thread_pool_level_wait_count_total {};
 
     IntCounter* split_thread_pool_submit_failed = nullptr;
 
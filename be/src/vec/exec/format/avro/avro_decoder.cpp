@@ -0,0 +1,497 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "vec/exec/format/avro/avro_decoder.h"
+
+#include <fmt/format.h>
+
+#include "runtime/primitive_type.h"
+#include "util/string_util.h"
+#include "vec/columns/column_nullable.h"
+#include "vec/columns/column_string.h"
+#include "vec/columns/column_vector.h"
+#include "vec/common/assert_cast.h"
+
+namespace doris::vectorized {
+#include "common/compile_check_begin.h"
+
+namespace {
+
+using Type = AvroSchemaNode::Type;
+
+const char* avro_type_name(Type type) {
+    switch (type) {
+    case Type::NULL_TYPE:
+        return "null";
+    case Type::BOOLEAN:
+        return "boolean";
+    case Type::INT:
+        return "int";
+    case Type::LONG:
+        return "long";
+    case Type::FLOAT:
+        return "float";
+    case Type::DOUBLE:
+        return "double";
+    case Type::BYTES:
+        return "bytes";
+    case Type::STRING:
+        return "string";
+    case Type::RECORD:
+        return "record";
+    case Type::ENUM:
+        return "enum";
+    case Type::ARRAY:
+        return "array";
+    case Type::MAP:
+        return "map";
+    case Type::UNION:
+        return "union";
+    case Type::FIXED:
+        return "fixed";
+    }
+    return "unknown";
+}
+
+bool primitive_type_of(const std::string& name, Type* type) {
+    static const std::unordered_map<std::string, Type> primitive_types = {
+            {"null", Type::NULL_TYPE}, {"boolean", Type::BOOLEAN}, {"int", Type::INT},
+            {"long", Type::LONG},      {"float", Type::FLOAT},     {"double", Type::DOUBLE},
+            {"bytes", Type::BYTES},    {"string", Type::STRING}};
+    auto iter = primitive_types.find(name);
+    if (iter == primitive_types.end()) {
+        return false;
+    }
+    *type = iter->second;
+    return true;
+}
+
+std::string json_string(const rapidjson::Value& value) {
+    return {value.GetString(), value.GetStringLength()};
+}
+
+Status decode_bool(AvroDecoder& decoder, const AvroSchemaNode* /*node*/, IColumn& column) {
+    bool value = false;
+    RETURN_IF_ERROR(decoder.read_bool(&value));
+    assert_cast<ColumnUInt8&>(column).get_data().push_back(static_cast<UInt8>(value));
+    return Status::OK();
+}
+
+template <PrimitiveType PT>
+Status decode_int(AvroDecoder& decoder, const AvroSchemaNode* /*node*/, IColumn& column) {
+    int32_t value = 0;
+    RETURN_IF_ERROR(decoder.read_int(&value));
+    assert_cast<typename PrimitiveTypeTraits<PT>::ColumnType&>(column).get_data().push_back(value);
+    return Status::OK();
+}
+
+Status decode_long(AvroDecoder& decoder, const AvroSchemaNode* /*node*/, IColumn& column) {
+    int64_t value = 0;
+    RETURN_IF_ERROR(decoder.read_long(&value));
+    assert_cast<ColumnInt64&>(column).get_data().push_back(value);
+    return Status::OK();
+}
+
+template <typename AvroType, PrimitiveType PT>
+Status decode_floating(AvroDecoder& decoder, const AvroSchemaNode* /*node*/, IColumn& column) {
+    AvroType value = 0;
+    RETURN_IF_ERROR(decoder.read_fixed_width(&value));
+    using CppType = typename PrimitiveTypeTraits<PT>::CppType;
+    assert_cast<typename PrimitiveTypeTraits<PT>::ColumnType&>(column).get_data().push_back(
+            static_cast<CppType>(value));
+    return Status::OK();
+}
+
+Status decode_string(AvroDecoder& decoder, const AvroSchemaNode* /*node*/, IColumn& column) {
+    StringRef value;
+    RETURN_IF_ERROR(decoder.read_bytes(&value));
+    assert_cast<ColumnString&>(column).insert_data(value.data, value.size);
+    return Status::OK();
+}
+
+Status decode_enum(AvroDecoder& decoder, const AvroSchemaNode* node, IColumn& column) {
+    int32_t index = 0;
+    RETURN_IF_ERROR(decoder.read_int(&index));
+    if (UNLIKELY(index < 0 || static_cast<size_t>(index) >= node->symbols.size())) {
+        return Status::Corruption("avro enum index {} is out of range", index);
+    }
+    const auto& symbol = node->symbols[index];
+    assert_cast<ColumnString&>(column).insert_data(symbol.data(), symbol.size());
+    return Status::OK();
+}
+
+Status decode_fixed(AvroDecoder& decoder, const AvroSchemaNode* node, IColumn& column) {
+    StringRef value;
+    RETURN_IF_ERROR(decoder.read_fixed(node->fixed_size, &value));
+    assert_cast<ColumnString&>(column).insert_data(value.data, value.size);
+    return Status::OK();
+}
+
+} // namespace
+
+Status AvroSchema::parse(const std::string& json) {
+    rapidjson::Document document;
+    document.Parse(json.data(), json.size());
+    if (document.HasParseError()) {
+        return Status::Corruption("invalid avro schema: {}", json);
+    }
+    return _parse_node(document, "", &_root);
+}
+
+AvroSchemaNode* AvroSchema::_new_node(AvroSchemaNode::Type type) {
+    _nodes.emplace_back(std::make_unique<AvroSchemaNode>());
+    _nodes.back()->type = type;
+    return _nodes.back().get();
+}
+
+void AvroSchema::_register_name(const rapidjson::Value& value, const std::string& parent_namespace,
+                                const AvroSchemaNode* node, std::string* name_space) {
+    std::string name = json_string(value["name"]);
+    std::string full_name;
+    auto dot = name.rfind('.');
+    if (dot != std::string::npos) {
+        full_name = name;
+        *name_space = name.substr(0, dot);
+        name = name.substr(dot + 1);
+    } else {
+        *name_space = value.HasMember("namespace") && value["namespace"].IsString()
+                              ? json_string(value["namespace"])
+                              : parent_namespace;
+        full_name = name_space->empty() ? name : fmt::format("{}.{}", *name_space, name);
+    }
+    _named_nodes[full_name] = node;
+    _named_nodes.emplace(name, node);
+}
+
+Status AvroSchema::_parse_node(const rapidjson::Value& value, const std::string& parent_namespace,
+                               const AvroSchemaNode** node) {
+    if (value.IsArray()) {
+        auto* union_node = _new_node(Type::UNION);
+        for (const auto& branch : value.GetArray()) {
+            const AvroSchemaNode* child = nullptr;
+            RETURN_IF_ERROR(_parse_node(branch, parent_namespace, &child));
+            union_node->children.push_back(child);
+        }
+        *node = union_node;
+        return Status::OK();
+    }
+    if (value.IsString()) {
+        std::string name = json_string(value);
+        Type type = Type::NULL_TYPE;
+        if (primitive_type_of(name, &type)) {
+            *node = _new_node(type);
+            return Status::OK();
+        }
+        auto iter = _named_nodes.find(name);
+        if (iter == _named_nodes.end() && !parent_namespace.empty()) {
+            iter = _named_nodes.find(fmt::format("{}.{}", parent_namespace, name));
+        }
+        if (iter == _named_nodes.end()) {
+            return Status::Corruption("unknown avro type {}", name);
+        }
+        *node = iter->second;
+        return Status::OK();
+    }
+    if (!value.IsObject() || !value.HasMember("type")) {
+        return Status::Corruption("invalid avro schema node");
+    }
+    const auto& type_value = value["type"];
+    if (!type_value.IsString()) {
+        return _parse_node(type_value, parent_namespace, node);
+    }
+    std::string type_name = json_string(type_value);
+    AvroSchemaNode* result = nullptr;
+    std::string name_space;
+    if (type_name == "record" || type_name == "error") {
+        result = _new_node(Type::RECORD);
+        _register_name(value, parent_namespace, result, &name_space);
+        if (!value.HasMember("fields") || !value["fields"].IsArray()) {
+            return Status::Corruption("avro record without fields");
+        }
+        for (const auto& field : value["fields"].GetArray()) {
+            if (!field.IsObject() || !field.HasMember("name") || !field.HasMember("type")) {
+                return Status::Corruption("invalid avro record field");
+            }
+            const AvroSchemaNode* child = nullptr;
+            RETURN_IF_ERROR(_parse_node(field["type"], name_space, &child));
+            result->field_names.emplace_back(json_string(field["name"]));
+            result->children.push_back(child);
+        }
+    } else if (type_name == "enum") {
+        result = _new_node(Type::ENUM);
+        _register_name(value, parent_namespace, result, &name_space);
+        if (!value.HasMember("symbols") || !value["symbols"].IsArray()) {
+            return Status::Corruption("avro enum without symbols");
+        }
+        for (const auto& symbol : value["symbols"].GetArray()) {
+            result->symbols.emplace_back(json_string(symbol));
+        }
+    } else if (type_name == "fixed") {
+        result = _new_node(Type::FIXED);
+        _register_name(value, parent_namespace, result, &name_space);
+        if (!value.HasMember("size") || !value["size"].IsUint()) {
+            return Status::Corruption("avro fixed without size");
+        }
+        result->fixed_size = value["size"].GetUint();
+    } else if (type_name == "array" || type_name == "map") {
+        const char* child_key = type_name == "array" ? "items" : "values";
+        result = _new_node(type_name == "array" ? Type::ARRAY : Type::MAP);
+        if (!value.HasMember(child_key)) {
+            return Status::Corruption("avro {} without {}", type_name, child_key);
+        }
+        const AvroSchemaNode* child = nullptr;
+        RETURN_IF_ERROR(_parse_node(value[child_key], parent_namespace, &child));
+        result->children.push_back(child);
+    } else {
+        Type type = Type::NULL_TYPE;
+        if (!primitive_type_of(type_name, &type)) {
+            return Status::Corruption("unknown avro type {}", type_name);
+        }
+        result = _new_node(type);
+    }
+    result->has_logical_type = value.HasMember("logicalType");
+    *node = result;
+    return Status::OK();
+}
+
+Status AvroRecordDecoder::init(const AvroSchemaNode* record,
+                               const std::vector<std::string>& column_names,
+                               const DataTypes& column_types,
+                               std::vector<std::string>* missing_columns) {
+    if (record == nullptr || record->type != Type::RECORD) {
+        return Status::NotSupported("avro schema of the file is not a record");
+    }
+    std::unordered_map<std::string, size_t> field_indices;
+    _fields.resize(record->children.size());
+    for (size_t i = 0; i < record->children.size(); ++i) {
+        _fields[i].node = record->children[i];
+        field_indices.emplace(to_lower(record->field_names[i]), i);
+    }
+    for (size_t i = 0; i < column_names.size(); ++i) {
+        auto iter = field_indices.find(to_lower(column_names[i]));
+        if (iter == field_indices.end()) {
+            missing_columns->push_back(column_names[i]);
+            continue;
+        }
+        auto& field = _fields[iter->second];
+        RETURN_IF_ERROR(_create_field_decoder(field.node, column_types[i], &field));
+        field.column = static_cast<int>(i);
+    }
+    return Status::OK();
+}
+
+Status AvroRecordDecoder::_create_field_decoder(const AvroSchemaNode* node,
+                                                const DataTypePtr& type, FieldDecoder* field) {
+    field->value_node = node;
+    if (node->type == Type::UNION) {
+        // only a single value type, optionally combined with null
+        for (size_t i = 0; i < node->children.size(); ++i) {
+            if (node->children[i]->type == Type::NULL_TYPE) {
+                field->null_branch = static_cast<int>(i);
+            } else if (field->value_branch == -1) {
+                field->value_branch = static_cast<int>(i);
+                field->value_node = node->children[i];
+            } else {
+                return Status::NotSupported("avro union with multiple value types");
+            }
+        }
+        if (field->value_branch == -1) {
+            return Status::NotSupported("avro union without a value type");
+        }
+    }
+    field->nullable_column = type->is_nullable();
+    if (field->null_branch != -1 && !field->nullable_column) {
+        return Status::NotSupported("nullable avro field for not null column");
+    }
+    const AvroSchemaNode* value_node = field->value_node;
+    auto primitive_type = remove_nullable(type)->get_primitive_type();
+    if (!value_node->has_logical_type) {
+        switch (value_node->type) {
+        case Type::BOOLEAN:
+            if (primitive_type == TYPE_BOOLEAN) {
+                field->decode_func = &decode_bool;
+            }
+            break;
+        case Type::INT:
+            if (primitive_type == TYPE_INT) {
+                field->decode_func = &decode_int<TYPE_INT>;
+            } else if (primitive_type == TYPE_BIGINT) {
+                field->decode_func = &decode_int<TYPE_BIGINT>;
+            }
+            break;
+        case Type::LONG:
+            if (primitive_type == TYPE_BIGINT) {
+                field->decode_func = &decode_long;
+            }
+            break;
+        case Type::FLOAT:
+            if (primitive_type == TYPE_FLOAT) {
+                field->decode_func = &decode_floating<float, TYPE_FLOAT>;
+            } else if (primitive_type == TYPE_DOUBLE) {
+                field->decode_func = &decode_floating<float, TYPE_DOUBLE>;
+            }
+            break;
+        case Type::DOUBLE:
+            if (primitive_type == TYPE_DOUBLE) {
+                field->decode_func = &decode_floating<double, TYPE_DOUBLE>;
+            }
+            break;
+        case Type::BYTES:
+        case Type::STRING:
+            if (is_string_type(primitive_type)) {
+                field->decode_func = &decode_string;
+            }
+            break;
+        case Type::ENUM:
+            if (is_string_type(primitive_type)) {
+                field->decode_func = &decode_enum;
+            }
+            break;
+        case Type::FIXED:
+            if (is_string_type(primitive_type)) {
+                field->decode_func = &decode_fixed;
+            }
+            break;
+        default:
+            break;
+        }
+    }
+    if (field->decode_func == nullptr) {
+        return Status::NotSupported("avro {}{} can not be read into {} natively",
+                                    avro_type_name(value_node->type),
+                                    value_node->has_logical_type ? " with logical type" : "",
+                                    type->get_name());
+    }
+    return Status::OK();
+}
+
+Status AvroRecordDecoder::decode(AvroDecoder& decoder, size_t num_records,
+                                 const std::vector<IColumn*>& columns) const {
+    // resolve the nullable wrappers once per batch
+    std::vector<IColumn*> data_columns(_fields.size(), nullptr);
+    std::vector<NullMap*> null_maps(_fields.size(), nullptr);
+    for (size_t i = 0; i < _fields.size(); ++i) {
+        if (_fields[i].column < 0) {
+            continue;
+        }
+        IColumn* column = columns[_fields[i].column];
+        if (_fields[i].nullable_column) {
+            auto& nullable_column = assert_cast<ColumnNullable&>(*column);
+            data_columns[i] = &nullable_column.get_nested_column();
+            null_maps[i] = &nullable_column.get_null_map_data();
+        } else {
+            data_columns[i] = column;
+        }
+    }
+
+    for (size_t row = 0; row < num_records; ++row) {
+        for (size_t i = 0; i < _fields.size(); ++i) {
+            const auto& field = _fields[i];
+            if (field.column < 0) {
+                RETURN_IF_ERROR(skip_value(decoder, field.node));
+                continue;
+            }
+            if (field.value_branch >= 0) {
+                int64_t branch = 0;
+                RETURN_IF_ERROR(decoder.read_long(&branch));
+                if (branch == field.null_branch) {
+                    data_columns[i]->insert_default();
+                    null_maps[i]->push_back(1);
+                    continue;
+                }
+                if (UNLIKELY(branch != field.value_branch)) {
+                    return Status::Corruption("invalid avro union branch {}", branch);
+                }
+            }
+            RETURN_IF_ERROR(field.decode_func(decoder, field.value_node, *data_columns[i]));
+            if (null_maps[i] != nullptr) {
+                null_maps[i]->push_back(0);
+            }
+        }
+    }
+    return Status::OK();
+}
+
+Status AvroRecordDecoder::skip_value(AvroDecoder& decoder, const AvroSchemaNode* node) {
+    switch (node->type) {
+    case Type::NULL_TYPE:
+        return Status::OK();
+    case Type::BOOLEAN:
+        return decoder.skip(1);
+    case Type::INT:
+    case Type::LONG:
+    case Type::ENUM: {
+        int64_t value = 0;
+        return decoder.read_long(&value);
+    }
+    case Type::FLOAT:
+        return decoder.skip(sizeof(float));
+    case Type::DOUBLE:
+        return decoder.skip(sizeof(double));
+    case Type::BYTES:
+    case Type::STRING: {
+        StringRef value;
+        return decoder.read_bytes(&value);
+    }
+    case Type::FIXED:
+        return decoder.skip(node->fixed_size);
+    case Type::RECORD:
+        for (const auto* child : node->children) {
+            RETURN_IF_ERROR(skip_value(decoder, child));
+        }
+        return Status::OK();
+    case Type::UNION: {
+        int64_t branch = 0;
+        RETURN_IF_ERROR(decoder.read_long(&branch));
+        if (UNLIKELY(branch < 0 || static_cast<size_t>(branch) >= node->children.size())) {
+            return Status::Corruption("invalid avro union branch {}", branch);
+        }
+        return skip_value(decoder, node->children[branch]);
+    }
+    case Type::ARRAY:
+    case Type::MAP:
+        // items are written in blocks, each starts with the item count and ends with a count of 0.
+        // A negative count is followed by the block size in bytes, which allows skipping it.
+        while (true) {
+            int64_t count = 0;
+            RETURN_IF_ERROR(decoder.read_long(&count));
+            if (count == 0) {
+                return Status::OK();
+            }
+            if (count < 0) {
+                int64_t block_size = 0;
+                RETURN_IF_ERROR(decoder.read_long(&block_size));
+                if (UNLIKELY(block_size < 0)) {
+                    return Status::Corruption("invalid avro block size {}", block_size);
+                }
+                RETURN_IF_ERROR(decoder.skip(static_cast<size_t>(block_size)));
+                continue;
+            }
+            for (int64_t i = 0; i < count; ++i) {
+                if (node->type == Type::MAP) {
+                    StringRef key;
+                    RETURN_IF_ERROR(decoder.read_bytes(&key));
+                }
+                RETURN_IF_ERROR(skip_value(decoder, node->children[0]));
+            }
+        }
+    }
+    return Status::Corruption("unknown avro type");
+}
+
+#include "common/compile_check_end.h"
+} // namespace doris::vectorized
@@ -0,0 +1,220 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <rapidjson/document.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "common/compiler_util.h" // IWYU pragma: keep
+#include "common/status.h"
+#include "vec/columns/column.h"
+#include "vec/common/string_ref.h"
+#include "vec/data_types/data_type.h"
+
+namespace doris::vectorized {
+#include "common/compile_check_begin.h"
+
+// Reads values of the avro binary encoding from a buffer.
+class AvroDecoder {
+public:
+    AvroDecoder() = default;
+    AvroDecoder(const char* data, size_t size) : _pos(data), _end(data + size) {}
+
+    // int and long are zigzag encoded varints.
+    Status read_long(int64_t* value) {
+        // most values fit in one byte
+        if (LIKELY(_pos < _end && (static_cast<uint8_t>(*_pos) & 0x80) == 0)) {
+            auto n = static_cast<uint64_t>(static_cast<uint8_t>(*_pos++));
+            *value = static_cast<int64_t>((n >> 1) ^ (~(n & 1) + 1));
+            return Status::OK();
+        }
+        uint64_t n = 0;
+        for (int shift = 0; shift < 64; shift += 7) {
+            if (UNLIKELY(_pos >= _end)) {
+                return Status::Corruption("avro varint is truncated");
+            }
+            auto b = static_cast<uint8_t>(*_pos++);
+            n |= static_cast<uint64_t>(b & 0x7f) << shift;
+            if ((b & 0x80) == 0) {
+                *value = static_cast<int64_t>((n >> 1) ^ (~(n & 1) + 1));
+                return Status::OK();
+            }
+        }
+        return Status::Corruption("avro varint is too long");
+    }
+
+    Status read_int(int32_t* value) {
+        int64_t v = 0;
+        RETURN_IF_ERROR(read_long(&v));
+        if (UNLIKELY(v < INT32_MIN || v > INT32_MAX)) {
+            return Status::Corruption("avro int {} is out of range", v);
+        }
+        *value = static_cast<int32_t>(v);
+        return Status::OK();
+    }
+
+    Status read_bool(bool* value) {
+        RETURN_IF_ERROR(_check_remaining(1));
+        *value = *_pos++ != 0;
+        return Status::OK();
+    }
+
+    template <typename T>
+    Status read_fixed_width(T* value) {
+        static_assert(std::is_same_v<T, float> || std::is_same_v<T, double>);
+        RETURN_IF_ERROR(_check_remaining(sizeof(T)));
+        memcpy(value, _pos, sizeof(T));
+        _pos += sizeof(T);
+        return Status::OK();
+    }
+
+    // bytes and string are a long length followed by the data, which is not copied.
+    Status read_bytes(StringRef* value) {
+        int64_t len = 0;
+        RETURN_IF_ERROR(read_long(&len));
+        if (UNLIKELY(len < 0)) {
+            return Status::Corruption("avro bytes length {} is negative", len);
+        }
+        return read_fixed(static_cast<size_t>(len), value);
+    }
+
+    Status read_fixed(size_t len, StringRef* value) {
+        RETURN_IF_ERROR(_check_remaining(len));
+        *value = StringRef(_pos, len);
+        _pos += len;
+        return Status::OK();
+    }
+
+    Status skip(size_t len) {
+        RETURN_IF_ERROR(_check_remaining(len));
+        _pos += len;
+        return Status::OK();
+    }
+
+    size_t remaining() const { return _end - _pos; }
+    const char* position() const { return _pos; }
+
+private:
+    Status _check_remaining(size_t len) const {
+        if (UNLIKELY(static_cast<size_t>(_end - _pos) < len)) {
+            return Status::Corruption("avro data is truncated, need {} bytes but {} left", len,
+                                      _end - _pos);
+        }
+        return Status::OK();
+    }
+
+    const char* _pos = nullptr;
+    const char* _end = nullptr;
+};
+
+struct AvroSchemaNode {
+    enum class Type {
+        NULL_TYPE,
+        BOOLEAN,
+        INT,
+        LONG,
+        FLOAT,
+        DOUBLE,
+        BYTES,
+        STRING,
+        RECORD,
+        ENUM,
+        ARRAY,
+        MAP,
+        UNION,
+        FIXED
+    };
+
+    Type type = Type::NULL_TYPE;
+    // record field types, union branches, or the array item / map value type
+    std::vector<const AvroSchemaNode*> children;
+    std::vector<std::string> field_names;
+    std::vector<std::string> symbols;
+    size_t fixed_size = 0;
+    bool has_logical_type = false;
+};
+
+// An avro schema parsed from its json representation. Named types may be referenced recursively,
+// so the nodes are owned here and linked by pointers.
+class AvroSchema {
+public:
+    Status parse(const std::string& json);
+
+    const AvroSchemaNode* root() const { return _root; }
+
+private:
+    Status _parse_node(const rapidjson::Value& value, const std::string& parent_namespace,
+                       const AvroSchemaNode** node);
+    AvroSchemaNode* _new_node(AvroSchemaNode::Type type);
+    void _register_name(const rapidjson::Value& value, const std::string& parent_namespace,
+                        const AvroSchemaNode* node, std::string* name_space);
+
+    std::vector<std::unique_ptr<AvroSchemaNode>> _nodes;
+    std::unordered_map<std::string, const AvroSchemaNode*> _named_nodes;
+    const AvroSchemaNode* _root = nullptr;
+};
+
+// Decodes avro records into doris columns. The decoding function of every record field is chosen
+// once from the avro type and the column type, fields without a column are skipped.
+class AvroRecordDecoder {
+public:
+    // Maps the fields of the top level record to the columns by case insensitive name. Columns
+    // without a field are reported in missing_columns. Returns NotSupported if the avro type of
+    // a needed field can not be decoded into its column type natively.
+    Status init(const AvroSchemaNode* record, const std::vector<std::string>& column_names,
+                const DataTypes& column_types, std::vector<std::string>* missing_columns);
+
+    // Decodes num_records records and appends them to columns, which are ordered like
+    // the column_names of init. Missing columns are left untouched and may be null.
+    Status decode(AvroDecoder& decoder, size_t num_records,
+                  const std::vector<IColumn*>& columns) const;
+
+    static Status skip_value(AvroDecoder& decoder, const AvroSchemaNode* node);
+
+private:
+    using DecodeFunc = Status (*)(AvroDecoder& decoder, const AvroSchemaNode* node,
+                                  IColumn& column);
+
+    struct FieldDecoder {
+        const AvroSchemaNode* node = nullptr;
+        // the non null type of the value, the node itself when the field is not a union
+        const AvroSchemaNode* value_node = nullptr;
+        // the output column index, -1 means the field is skipped
+        int column = -1;
+        // union branch of the value and of null, -1 when the field is not a union
+        int value_branch = -1;
+        int null_branch = -1;
+        bool nullable_column = false;
+        DecodeFunc decode_func = nullptr;
+    };
+
+    static Status _create_field_decoder(const AvroSchemaNode* node, const DataTypePtr& type,
+                                        FieldDecoder* field);
+
+    std::vector<FieldDecoder> _fields;
+};
+
+#include "common/compile_check_end.h"
+} // namespace doris::vectorized
@@ -0,0 +1,441 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "vec/exec/format/avro/avro_reader.h"
+
+#include <snappy.h>
+#include <zlib.h>
+
+#include <algorithm>
+#include <cstring>
+
+#include "common/compiler_util.h" // IWYU pragma: keep
+#include "io/fs/buffered_reader.h"
+#include "io/fs/file_reader.h"
+#include "io/fs/tracing_file_reader.h"
+#include "io/io_common.h"
+#include "runtime/descriptors.h"
+#include "runtime/runtime_state.h"
+#include "util/defer_op.h"
+#include "vec/core/block.h"
+
+namespace doris::vectorized {
+#include "common/compile_check_begin.h"
+
+namespace {
+constexpr char AVRO_MAGIC[] = {'O', 'b', 'j', 1};
+constexpr size_t HEADER_READ_SIZE = 64 * 1024;
+// a corrupted metadata length must not make the header read grow to the whole file
+constexpr size_t MAX_HEADER_SIZE = 16 * 1024 * 1024;
+constexpr size_t SYNC_SEARCH_SIZE = 64 * 1024;
+// a block starts with its record count and byte size, both varints of at most 10 bytes
+constexpr size_t MAX_BLOCK_HEADER_SIZE = 20;
+// initial output buffer size relative to the compressed block
+constexpr size_t DECOMPRESS_BUF_RATIO = 4;
+} // namespace
+
+AvroReader::AvroReader(RuntimeState* state, RuntimeProfile* profile,
+                       const TFileScanRangeParams& params, const TFileRangeDesc& range,
+                       const std::vector<SlotDescriptor*>& file_slot_descs, io::IOContext* io_ctx)
+        : _state(state),
+          _profile(profile),
+          _params(params),
+          _range(range),
+          _file_slot_descs(file_slot_descs),
+          _io_ctx(io_ctx) {
+    _system_properties.system_type = _range.__isset.file_type ? _range.file_type
+                                                              : _params.file_type;
+    _system_properties.properties = _params.properties;
+    _system_properties.hdfs_params = _params.hdfs_params;
+    if (_params.__isset.broker_addresses) {
+        _system_properties.broker_addresses.assign(_params.broker_addresses.begin(),
+                                                   _params.broker_addresses.end());
+    }
+    _file_description.path = _range.path;
+    _file_description.file_size = _range.__isset.file_size ? _range.file_size : -1;
+    if (_range.__isset.fs_name) {
+        _file_description.fs_name = _range.fs_name;
+    }
+    if (_profile != nullptr) {
+        static const char* avro_profile = "AvroReader";
+        ADD_TIMER_WITH_LEVEL(_profile, avro_profile, 1);
+        _read_blocks_counter =
+                ADD_CHILD_COUNTER_WITH_LEVEL(_profile, "ReadBlocks", TUnit::UNIT, avro_profile, 1);
+        _decompress_timer = ADD_CHILD_TIMER_WITH_LEVEL(_profile, "DecompressTime", avro_profile, 1);
+        _decode_timer = ADD_CHILD_TIMER_WITH_LEVEL(_profile, "DecodeTime", avro_profile, 1);
+    }
+}
+
+AvroReader::~AvroReader() {
+    if (_zstd_ctx != nullptr) {
+        ZSTD_freeDCtx(_zstd_ctx);
+    }
+}
+
+Status AvroReader::init_reader() {
+    if (_system_properties.system_type == TFileType::FILE_STREAM) {
+        return Status::NotSupported("native avro reader does not support stream load");
+    }
+    RETURN_IF_ERROR(_create_file_reader());
+    RETURN_IF_ERROR(_read_header());
+
+    std::vector<std::string> column_names;
+    DataTypes column_types;
+    for (const auto* slot : _file_slot_descs) {
+        column_names.emplace_back(slot->col_name());
+        column_types.emplace_back(slot->get_data_type_ptr());
+    }
+    std::vector<std::string> missing_cols;
+    RETURN_IF_ERROR(
+            _record_decoder.init(_schema.root(), column_names, column_types, &missing_cols));
+    _missing_cols.insert(missing_cols.begin(), missing_cols.end());
+    for (const auto* slot : _file_slot_descs) {
+        _slot_in_file.push_back(!_missing_cols.contains(slot->col_name()));
+    }
+    return _find_first_block();
+}
+
+Status AvroReader::_create_file_reader() {
+    _file_description.mtime = _range.__isset.modification_time ? _range.modification_time : 0;
+    io::FileReaderOptions reader_options =
+            FileFactory::get_reader_options(_state, _file_description);
+    size_t range_end = _range.size > 0 ? _range.start_offset + _range.size : 0;
+    auto file_reader = DORIS_TRY(io::DelegateReader::create_file_reader(
+            _profile, _system_properties, _file_description, reader_options,
+            io::DelegateReader::AccessMode::SEQUENTIAL, _io_ctx,
+            _range.size > 0 ? io::PrefetchRange(_range.start_offset, range_end)
+                            : io::PrefetchRange(0, 0)));
+    _file_reader = _io_ctx ? std::make_shared<io::TracingFileReader>(std::move(file_reader),
+                                                                     _io_ctx->file_reader_stats)
+                           : file_reader;
+    _file_size = _file_reader->size();
+    if (_file_size == 0) {
+        return Status::EndOfFile("init reader failed, empty avro file: " + _range.path);
+    }
+    _range_end = _range.size > 0 ? std::min(_file_size, range_end) : _file_size;
+    return Status::OK();
+}
+
+Status AvroReader::_read_fully(size_t offset, size_t size, std::string* buf) {
+    buf->resize(size);
+    size_t bytes_read = 0;
+    RETURN_IF_ERROR(_file_reader->read_at(offset, Slice(buf->data(), size), &bytes_read, _io_ctx));
+    if (bytes_read != size) {
+        return Status::Corruption("failed to read avro file {}, expect {} bytes got {} at {}",
+                                  _range.path, size, bytes_read, offset);
+    }
+    return Status::OK();
+}
+
+Status AvroReader::_read_header() {
+    // The metadata holds the schema, so the header size is unknown. Read a larger prefix until
+    // it can be parsed.
+    size_t read_size = std::min(_file_size, HEADER_READ_SIZE);
+    std::string buf;
+    std::string schema_json;
+    while (true) {
+        RETURN_IF_ERROR(_read_fully(0, read_size, &buf));
+        if (buf.size() < sizeof(AVRO_MAGIC) ||
+            memcmp(buf.data(), AVRO_MAGIC, sizeof(AVRO_MAGIC)) != 0) {
+            return Status::Corruption("{} is not an avro data file", _range.path);
+        }
+        Status st = _parse_header(buf, &_header_size, &schema_json);
+        if (st.ok()) {
+            break;
+        }
+        if (read_size == _file_size) {
+            return st;
+        }
+        if (read_size >= MAX_HEADER_SIZE) {
+            return Status::Corruption("avro header of {} exceeds {} bytes: {}", _range.path,
+                                      MAX_HEADER_SIZE, st.to_string());
+        }
+        read_size = std::min({_file_size, read_size * 2, MAX_HEADER_SIZE});
+    }
+    if (_codec != "null" && _codec != "deflate" && _codec != "snappy" && _codec != "zstandard") {
+        return Status::NotSupported("native avro reader does not support codec {}", _codec);
+    }
+    return _schema.parse(schema_json);
+}
+
+Status AvroReader::_parse_header(const std::string& buf, size_t* header_size,
+                                 std::string* schema_json) {
+    _codec = "null";
+    AvroDecoder decoder(buf.data() + sizeof(AVRO_MAGIC), buf.size() - sizeof(AVRO_MAGIC));
+    // the metadata is an avro map of bytes
+    while (true) {
+        int64_t count = 0;
+        RETURN_IF_ERROR(decoder.read_long(&count));
+        if (count == 0) {
+            break;
+        }
+        if (count < 0) {
+            int64_t block_size = 0;
+            RETURN_IF_ERROR(decoder.read_long(&block_size));
+            count = -count;
+        }
+        for (int64_t i = 0; i < count; ++i) {
+            StringRef key;
+            StringRef value;
+            RETURN_IF_ERROR(decoder.read_bytes(&key));
+            RETURN_IF_ERROR(decoder.read_bytes(&value));
+            if (key == StringRef("avro.schema")) {
+                *schema_json = value.to_string();
+            } else if (key == StringRef("avro.codec")) {
+                _codec = value.to_string();
+            }
+        }
+    }
+    StringRef sync_marker;
+    RETURN_IF_ERROR(decoder.read_fixed(SYNC_SIZE, &sync_marker));
+    memcpy(_sync_marker, sync_marker.data, SYNC_SIZE);
+    *header_size = decoder.position() - buf.data();
+    return Status::OK();
+}
+
+Status AvroReader::_find_first_block() {
+    // the header ends with the sync marker of the first block
+    size_t header_sync_offset = _header_size - SYNC_SIZE;
+    if (static_cast<size_t>(_range.start_offset) <= header_sync_offset) {
+        _block_sync_offset = header_sync_offset;
+        _next_block_offset = _header_size;
+        return Status::OK();
+    }
+    // The first sync marker from the range start, a marker starting after the range belongs to
+    // the next range.
+    _block_sync_offset = _range_end;
+    std::string buf;
+    size_t offset = _range.start_offset;
+    while (offset < _range_end) {
+        size_t read_size = std::min(SYNC_SEARCH_SIZE, _file_size - offset);
+        RETURN_IF_ERROR(_read_fully(offset, read_size, &buf));
+        const void* pos = memmem(buf.data(), read_size, _sync_marker, SYNC_SIZE);
+        if (pos != nullptr) {
+            _block_sync_offset = offset + (static_cast<const char*>(pos) - buf.data());
+            break;
+        }
+        if (offset + read_size >= _file_size) {
+            break;
+        }
+        // a marker may cross the end of this read
+        offset += read_size - (SYNC_SIZE - 1);
+    }
+    _next_block_offset = _block_sync_offset + SYNC_SIZE;
+    return Status::OK();
+}
+
+Status AvroReader::_next_data_block(bool* eof) {
+    if (_block_sync_offset >= _range_end || _next_block_offset >= _file_size) {
+        *eof = true;
+        return Status::OK();
+    }
+    size_t header_read_size = std::min(MAX_BLOCK_HEADER_SIZE, _file_size - _next_block_offset);
+    RETURN_IF_ERROR(_read_fully(_next_block_offset, header_read_size, &_block_buf));
+    AvroDecoder header_decoder(_block_buf.data(), header_read_size);
+    int64_t num_records = 0;
+    int64_t block_size = 0;
+    RETURN_IF_ERROR(header_decoder.read_long(&num_records));
+    RETURN_IF_ERROR(header_decoder.read_long(&block_size));
+    size_t data_offset = _next_block_offset + (header_decoder.position() - _block_buf.data());
+    if (num_records < 0 || block_size < 0 ||
+        data_offset + block_size + SYNC_SIZE > _file_size) {
+        return Status::Corruption("invalid avro block at {} of {}, records {}, size {}",
+                                  _next_block_offset, _range.path, num_records, block_size);
+    }
+    auto data_size = static_cast<size_t>(block_size);
+    RETURN_IF_ERROR(_read_fully(data_offset, data_size + SYNC_SIZE, &_block_buf));
+    if (memcmp(_block_buf.data() + data_size, _sync_marker, SYNC_SIZE) != 0) {
+        return Status::Corruption("invalid avro sync marker at {} of {}", data_offset + data_size,
+                                  _range.path);
+    }
+    COUNTER_UPDATE(_read_blocks_counter, 1);
+    _block_sync_offset = data_offset + data_size;
+    _next_block_offset = _block_sync_offset + SYNC_SIZE;
+    _block_remaining_records = static_cast<size_t>(num_records);
+    *eof = false;
+    if (_push_down_agg_type == TPushAggOp::type::COUNT) {
+        // only the record count is needed
+        return Status::OK();
+    }
+    return _decompress(_block_buf.data(), data_size);
+}
+
+Status AvroReader::_decompress(const char* data, size_t size) {
+    SCOPED_TIMER(_decompress_timer);
+    if (_codec == "null") {
+        _decoder = AvroDecoder(data, size);
+        return Status::OK();
+    }
+    if (_codec == "deflate") {
+        return _inflate(data, size);
+    }
+    if (_codec == "snappy") {
+        return _snappy_uncompress(data, size);
+    }
+    return _zstd_decompress(data, size);
+}
+
+Status AvroReader::_inflate(const char* data, size_t size) {
+    // avro deflate blocks are raw deflate streams without zlib header
+    z_stream stream {};
+    if (inflateInit2(&stream, -MAX_WBITS) != Z_OK) {
+        return Status::InternalError("failed to init inflate for avro file {}", _range.path);
+    }
+    Defer defer {[&]() { inflateEnd(&stream); }};
+    _decompress_buf.resize(std::max(size * DECOMPRESS_BUF_RATIO, SYNC_SEARCH_SIZE));
+    stream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(data));
+    stream.avail_in = static_cast<uInt>(size);
+    while (true) {
+        stream.next_out = reinterpret_cast<Bytef*>(_decompress_buf.data() + stream.total_out);
+        stream.avail_out = static_cast<uInt>(_decompress_buf.size() - stream.total_out);
+        int ret = inflate(&stream, Z_NO_FLUSH);
+        if (ret == Z_STREAM_END) {
+            break;
+        }
+        if ((ret != Z_OK && ret != Z_BUF_ERROR) || (stream.avail_in == 0 && stream.avail_out)) {
+            return Status::Corruption("failed to inflate avro block of {}, ret {}", _range.path,
+                                      ret);
+        }
+        if (stream.avail_out == 0) {
+            _decompress_buf.resize(_decompress_buf.size() * 2);
+        }
+    }
+    _decoder = AvroDecoder(_decompress_buf.data(), stream.total_out);
+    return Status::OK();
+}
+
+Status AvroReader::_snappy_uncompress(const char* data, size_t size) {
+    // the compressed data is followed by the big endian crc32 of the uncompressed data
+    constexpr size_t CRC_SIZE = 4;
+    size_t uncompressed_size = 0;
+    if (size < CRC_SIZE ||
+        !snappy::GetUncompressedLength(data, size - CRC_SIZE, &uncompressed_size)) {
+        return Status::Corruption("invalid snappy avro block of {}", _range.path);
+    }
+    _decompress_buf.resize(uncompressed_size);
+    if (!snappy::RawUncompress(data, size - CRC_SIZE, _decompress_buf.data())) {
+        return Status::Corruption("failed to uncompress snappy avro block of {}", _range.path);
+    }
+    const auto* crc_bytes = reinterpret_cast<const uint8_t*>(data + size - CRC_SIZE);
+    uint32_t expected_crc = static_cast<uint32_t>(crc_bytes[0]) << 24 |
+                            static_cast<uint32_t>(crc_bytes[1]) << 16 |
+                            static_cast<uint32_t>(crc_bytes[2]) << 8 | crc_bytes[3];
+    auto crc = crc32(0, reinterpret_cast<const Bytef*>(_decompress_buf.data()),
+                     static_cast<uInt>(uncompressed_size));
+    if (crc != expected_crc) {
+        return Status::Corruption("crc mismatch of snappy avro block of {}", _range.path);
+    }
+    _decoder = AvroDecoder(_decompress_buf.data(), uncompressed_size);
+    return Status::OK();
+}
+
+Status AvroReader::_zstd_decompress(const char* data, size_t size) {
+    if (_zstd_ctx == nullptr) {
+        _zstd_ctx = ZSTD_createDCtx();
+        if (_zstd_ctx == nullptr) {
+            return Status::InternalError("failed to create zstd context for avro file {}",
+                                         _range.path);
+        }
+    }
+    ZSTD_DCtx_reset(_zstd_ctx, ZSTD_reset_session_only);
+    // the java writer streams the block, so the frame content size is usually unknown
+    _decompress_buf.resize(std::max(size * DECOMPRESS_BUF_RATIO, SYNC_SEARCH_SIZE));
+    ZSTD_inBuffer input {data, size, 0};
+    size_t total_out = 0;
+    while (true) {
+        ZSTD_outBuffer output {_decompress_buf.data() + total_out,
+                               _decompress_buf.size() - total_out, 0};
+        size_t ret = ZSTD_decompressStream(_zstd_ctx, &output, &input);
+        if (ZSTD_isError(ret)) {
+            return Status::Corruption("failed to decompress zstd avro block of {}: {}", _range.path,
+                                      ZSTD_getErrorName(ret));
+        }
+        total_out += output.pos;
+        if (ret == 0 && input.pos == input.size) {
+            break;
+        }
+        if (total_out == _decompress_buf.size()) {
+            _decompress_buf.resize(_decompress_buf.size() * 2);
+        } else if (input.pos == input.size) {
+            return Status::Corruption("truncated zstd avro block of {}", _range.path);
+        }
+    }
+    _decoder = AvroDecoder(_decompress_buf.data(), total_out);
+    return Status::OK();
+}
+
+Status AvroReader::get_next_block(Block* block, size_t* read_rows, bool* eof) {
+    const size_t batch_size = std::max(_state->batch_size(), (int)_MIN_BATCH_SIZE);
+    const bool count_only = _push_down_agg_type == TPushAggOp::type::COUNT;
+    auto columns = block->mutate_columns();
+    std::vector<IColumn*> slot_columns(_file_slot_descs.size(), nullptr);
+    for (size_t i = 0; i < _file_slot_descs.size(); ++i) {
+        if (_slot_in_file[i]) {
+            slot_columns[i] =
+                    columns[block->get_position_by_name(_file_slot_descs[i]->col_name())].get();
+        }
+    }
+
+    size_t rows = 0;
+    Status st;
+    while (rows < batch_size) {
+        if (_block_remaining_records == 0) {
+            bool block_eof = false;
+            st = _next_data_block(&block_eof);
+            if (!st.ok() || block_eof) {
+                break;
+            }
+            continue;
+        }
+        size_t num_records = std::min(batch_size - rows, _block_remaining_records);
+        if (!count_only) {
+            SCOPED_TIMER(_decode_timer);
+            st = _record_decoder.decode(_decoder, num_records, slot_columns);
+            if (!st.ok()) {
+                break;
+            }
+        }
+        _block_remaining_records -= num_records;
+        rows += num_records;
+    }
+    if (count_only) {
+        for (auto& column : columns) {
+            column->resize(rows);
+        }
+    }
+    block->set_columns(std::move(columns));
+    RETURN_IF_ERROR(st);
+
+    *read_rows = rows;
+    *eof = (rows == 0);
+    return Status::OK();
+}
+
+Status AvroReader::get_columns(std::unordered_map<std::string, DataTypePtr>* name_to_type,
+                               std::unordered_set<std::string>* missing_cols) {
+    for (const auto* slot : _file_slot_descs) {
+        if (_missing_cols.contains(slot->col_name())) {
+            missing_cols->insert(slot->col_name());
+        } else {
+            name_to_type->emplace(slot->col_name(), slot->type());
+        }
+    }
+    return Status::OK();
+}
+
+#include "common/compile_check_end.h"
+} // namespace doris::vectorized
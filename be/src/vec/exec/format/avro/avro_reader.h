@@ -0,0 +1,125 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <gen_cpp/PlanNodes_types.h>
+#include <zstd.h>
+
+#include <cstddef>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "common/factory_creator.h"
+#include "common/status.h"
+#include "io/file_factory.h"
+#include "io/fs/file_reader_writer_fwd.h"
+#include "util/runtime_profile.h"
+#include "vec/exec/format/avro/avro_decoder.h"
+#include "vec/exec/format/generic_reader.h"
+
+namespace doris {
+class RuntimeProfile;
+class RuntimeState;
+class SlotDescriptor;
+namespace io {
+struct IOContext;
+} // namespace io
+} // namespace doris
+
+namespace doris::vectorized {
+#include "common/compile_check_begin.h"
+
+class Block;
+
+/**
+ * Read avro object container files natively, without going through the jni scanner.
+ * The data blocks whose sync marker starts inside the range are read, like the hadoop
+ * avro input format splits a file.
+ */
+class AvroReader : public GenericReader {
+    ENABLE_FACTORY_CREATOR(AvroReader);
+
+public:
+    AvroReader(RuntimeState* state, RuntimeProfile* profile, const TFileScanRangeParams& params,
+               const TFileRangeDesc& range, const std::vector<SlotDescriptor*>& file_slot_descs,
+               io::IOContext* io_ctx);
+
+    ~AvroReader() override;
+
+    // Returns NotSupported if the file can not be read natively, e.g. for an unsupported codec
+    // or column type. The caller falls back to the jni reader then.
+    Status init_reader();
+
+    Status get_next_block(Block* block, size_t* read_rows, bool* eof) override;
+
+    Status get_columns(std::unordered_map<std::string, DataTypePtr>* name_to_type,
+                       std::unordered_set<std::string>* missing_cols) override;
+
+private:
+    static constexpr size_t SYNC_SIZE = 16;
+
+    Status _create_file_reader();
+    Status _read_fully(size_t offset, size_t size, std::string* buf);
+    Status _read_header();
+    Status _parse_header(const std::string& buf, size_t* header_size, std::string* schema_json);
+    Status _find_first_block();
+    Status _next_data_block(bool* eof);
+    Status _decompress(const char* data, size_t size);
+    Status _inflate(const char* data, size_t size);
+    Status _snappy_uncompress(const char* data, size_t size);
+    Status _zstd_decompress(const char* data, size_t size);
+
+    RuntimeState* _state = nullptr;
+    RuntimeProfile* _profile = nullptr;
+    const TFileScanRangeParams& _params;
+    const TFileRangeDesc& _range;
+    const std::vector<SlotDescriptor*>& _file_slot_descs;
+    io::IOContext* _io_ctx = nullptr;
+    io::FileSystemProperties _system_properties;
+    io::FileDescription _file_description;
+    io::FileReaderSPtr _file_reader;
+
+    size_t _file_size = 0;
+    size_t _range_end = 0;
+    size_t _header_size = 0;
+    std::string _codec;
+    char _sync_marker[SYNC_SIZE];
+    AvroSchema _schema;
+    AvroRecordDecoder _record_decoder;
+    std::unordered_set<std::string> _missing_cols;
+    // whether the file slot exists in the file, ordered like _file_slot_descs
+    std::vector<bool> _slot_in_file;
+
+    // offset of the sync marker before the next data block, which decides the owning range
+    size_t _block_sync_offset = 0;
+    size_t _next_block_offset = 0;
+    size_t _block_remaining_records = 0;
+    std::string _block_buf;
+    std::string _decompress_buf;
+    AvroDecoder _decoder;
+    ZSTD_DCtx* _zstd_ctx = nullptr;
+
+    RuntimeProfile::Counter* _read_blocks_counter = nullptr;
+    RuntimeProfile::Counter* _decompress_timer = nullptr;
+    RuntimeProfile::Counter* _decode_timer = nullptr;
+};
+
+#include "common/compile_check_end.h"
+} // namespace doris::vectorized
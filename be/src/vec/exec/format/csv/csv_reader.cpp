@@ -42,6 +42,7 @@
 #include "io/fs/tracing_file_reader.h"
 #include "runtime/descriptors.h"
 #include "runtime/runtime_state.h"
+#include "util/sse_util.hpp"
 #include "util/string_util.h"
 #include "util/utf8_check.h"
 #include "vec/core/block.h"
@@ -72,6 +73,9 @@ void EncloseCsvTextFieldSplitter::do_split(const Slice& line, std::vector<Slice>
     for (auto idx : column_sep_positions) {
         process_value_func(data, value_start_offset, idx - value_start_offset, _trimming_char,
                            splitted_values);
+        if (splitted_values->size() == _max_fields) {
+            return;
+        }
         value_start_offset = idx + _value_sep_len;
     }
     if (line.size >= value_start_offset) {
@@ -85,10 +89,33 @@ void PlainCsvTextFieldSplitter::_split_field_single_char(const Slice& line,
                                                          std::vector<Slice>* splitted_values) {
     const char* data = line.data;
     const size_t size = line.size;
+    const char sep = _value_sep[0];
     size_t value_start = 0;
-    for (size_t i = 0; i < size; ++i) {
-        if (data[i] == _value_sep[0]) {
+    size_t i = 0;
+#if defined(__SSE2__) || defined(__aarch64__)
+    // find separators 16 bytes at a time by a compare mask
+    const __m128i sep16 = _mm_set1_epi8(sep);
+    for (; i + 16 <= size; i += 16) {
+        auto mask = static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(
+                _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i)), sep16)));
+        while (mask != 0) {
+            size_t pos = i + static_cast<size_t>(__builtin_ctz(mask));
+            process_value_func(data, value_start, pos - value_start, _trimming_char,
+                               splitted_values);
+            if (splitted_values->size() == _max_fields) {
+                return;
+            }
+            value_start = pos + _value_sep_len;
+            mask &= mask - 1;
+        }
+    }
+#endif
+    for (; i < size; ++i) {
+        if (data[i] == sep) {
             process_value_func(data, value_start, i - value_start, _trimming_char, splitted_values);
+            if (splitted_values->size() == _max_fields) {
+                return;
+            }
             value_start = i + _value_sep_len;
         }
     }
@@ -153,6 +180,9 @@ void PlainCsvTextFieldSplitter::_split_field_multi_char(const Slice& line,
             if (curpos >= start) {
                 process_value_func(line.data, start, curpos - start, _trimming_char,
                                    splitted_values);
+                if (splitted_values->size() == _max_fields) {
+                    return;
+                }
                 start = i + 1;
             }
 
@@ -295,6 +325,15 @@ Status CsvReader::init_reader(bool is_load) {
             _col_idxs.push_back(i++);
         }
     }
+    if (!_is_load && _fields_splitter != nullptr) {
+        // A query only needs the fields up to the last projected column, the rest of the line is
+        // neither split nor converted. Loads keep splitting all fields to check the column count.
+        size_t max_fields = 1;
+        for (int col_idx : _col_idxs) {
+            max_fields = std::max(max_fields, static_cast<size_t>(col_idx) + 1);
+        }
+        _fields_splitter->set_max_fields(max_fields);
+    }
 
     _line_reader_eof = false;
     return Status::OK();
@@ -58,6 +58,12 @@ public:
     virtual ~LineFieldSplitterIf() = default;
 
     virtual void split_line(const Slice& line, std::vector<Slice>* splitted_values) = 0;
+
+    // Stop splitting a line once this many fields are found, 0 means splitting the whole line.
+    void set_max_fields(size_t max_fields) { _max_fields = max_fields; }
+
+protected:
+    size_t _max_fields = 0;
 };
 
 template <typename Splitter>
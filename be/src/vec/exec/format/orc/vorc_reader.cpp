@@ -1391,6 +1391,39 @@ static inline size_t trim_right(const char* s, size_t size) {
     return size;
 }
 
+// Values of a direct encoded string batch are laid out back to back in the blob of the batch,
+// copy them with one memcpy instead of one per value. Return false if they are not contiguous.
+static bool insert_contiguous_strings(const MutableColumnPtr& data_column,
+                                      const orc::EncodedStringVectorBatch* cvb,
+                                      size_t num_values) {
+    std::vector<uint32_t> offsets(num_values + 1);
+    const char* base = nullptr;
+    size_t total_length = 0;
+    for (size_t i = 0; i < num_values; ++i) {
+        offsets[i] = static_cast<uint32_t>(total_length);
+        // the data of null values may point to a released batch
+        if ((cvb->hasNulls && !cvb->notNull[i]) || cvb->length[i] <= 0) {
+            continue;
+        }
+        if (base == nullptr) {
+            base = cvb->data[i];
+        } else if (cvb->data[i] != base + total_length) {
+            return false;
+        }
+        total_length += static_cast<size_t>(cvb->length[i]);
+        if (total_length > std::numeric_limits<uint32_t>::max()) {
+            return false;
+        }
+    }
+    offsets[num_values] = static_cast<uint32_t>(total_length);
+    if (base == nullptr) {
+        data_column->insert_many_defaults(num_values);
+    } else {
+        data_column->insert_many_continuous_binary_data(base, offsets.data(), num_values);
+    }
+    return true;
+}
+
 template <bool is_filter>
 Status OrcReader::_decode_string_column(const std::string& col_name,
                                         const MutableColumnPtr& data_column,
@@ -1417,6 +1450,10 @@ Status OrcReader::_decode_string_non_dict_encoded_column(const std::string& col_
                                                          const orc::TypeKind& type_kind,
                                                          const orc::EncodedStringVectorBatch* cvb,
                                                          size_t num_values) {
+    if (type_kind != orc::TypeKind::CHAR && num_values > 0 &&
+        insert_contiguous_strings(data_column, cvb, num_values)) {
+        return Status::OK();
+    }
     const static std::string empty_string;
     std::vector<StringRef> string_values;
     string_values.reserve(num_values);
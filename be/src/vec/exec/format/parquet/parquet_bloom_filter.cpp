@@ -0,0 +1,193 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "vec/exec/format/parquet/parquet_bloom_filter.h"
+
+#include <gen_cpp/parquet_types.h>
+#include <xxhash.h>
+
+#include <algorithm>
+#include <cstring>
+#include <type_traits>
+#include <variant>
+
+#include "io/fs/file_reader.h"
+#include "util/slice.h"
+#include "util/thrift_util.h"
+#include "vec/exec/format/parquet/schema_desc.h"
+
+namespace doris::vectorized {
+#include "common/compile_check_begin.h"
+
+static constexpr uint32_t SALT[ParquetBloomFilter::BITS_SET_PER_BLOCK] = {
+        0x47b6137bU, 0x44974d91U, 0x8824ad5bU, 0xa2b7289dU,
+        0x705495c7U, 0x2df1424bU, 0x9efc4947U, 0x5c6bfb31U};
+// The header is a small thrift struct, it is read together with the bitset when the
+// length of the whole filter is not recorded in the footer
+static constexpr uint32_t BLOOM_FILTER_HEADER_SIZE_GUESS = 256;
+
+Status ParquetBloomFilter::init(const io::FileReaderSPtr& file,
+                                const tparquet::ColumnMetaData& meta, io::IOContext* io_ctx,
+                                bool* has_filter) {
+    *has_filter = false;
+    if (!meta.__isset.bloom_filter_offset || meta.bloom_filter_offset < 0 ||
+        static_cast<size_t>(meta.bloom_filter_offset) >= file->size()) {
+        return Status::OK();
+    }
+    auto offset = static_cast<size_t>(meta.bloom_filter_offset);
+    size_t to_read = std::min<size_t>(file->size() - offset, BLOOM_FILTER_HEADER_SIZE_GUESS);
+    if (meta.__isset.bloom_filter_length && meta.bloom_filter_length > 0) {
+        to_read = std::min<size_t>(file->size() - offset, meta.bloom_filter_length);
+    }
+    if (to_read > MAX_BLOOM_FILTER_SIZE + BLOOM_FILTER_HEADER_SIZE_GUESS) {
+        return Status::OK();
+    }
+    std::vector<uint8_t> buf(to_read);
+    size_t bytes_read = 0;
+    RETURN_IF_ERROR(file->read_at(offset, Slice(buf.data(), to_read), &bytes_read, io_ctx));
+    auto header_size = static_cast<uint32_t>(bytes_read);
+    tparquet::BloomFilterHeader header;
+    RETURN_IF_ERROR(deserialize_thrift_msg(buf.data(), &header_size, true, &header));
+    if (!header.algorithm.__isset.BLOCK || !header.hash.__isset.XXHASH ||
+        !header.compression.__isset.UNCOMPRESSED || header.numBytes <= 0 ||
+        static_cast<uint32_t>(header.numBytes) > MAX_BLOOM_FILTER_SIZE ||
+        header.numBytes % BYTES_PER_BLOCK != 0) {
+        return Status::OK();
+    }
+    auto num_bytes = static_cast<size_t>(header.numBytes);
+    std::vector<uint32_t> bitset(num_bytes / sizeof(uint32_t));
+    if (header_size + num_bytes <= bytes_read) {
+        memcpy(bitset.data(), buf.data() + header_size, num_bytes);
+    } else {
+        RETURN_IF_ERROR(file->read_at(offset + header_size,
+                                      Slice(reinterpret_cast<char*>(bitset.data()), num_bytes),
+                                      &bytes_read, io_ctx));
+        if (bytes_read != num_bytes) {
+            return Status::Corruption("Failed to read parquet bloom filter, expect {} got {}",
+                                      num_bytes, bytes_read);
+        }
+    }
+    RETURN_IF_ERROR(init(std::move(bitset)));
+    *has_filter = true;
+    return Status::OK();
+}
+
+Status ParquetBloomFilter::init(std::vector<uint32_t> bitset) {
+    if (bitset.empty() || bitset.size() % BITS_SET_PER_BLOCK != 0) {
+        return Status::InvalidArgument("Invalid parquet bloom filter size {}",
+                                       bitset.size() * sizeof(uint32_t));
+    }
+    _bitset = std::move(bitset);
+    return Status::OK();
+}
+
+bool ParquetBloomFilter::find_hash(uint64_t hash) const {
+    DCHECK(!_bitset.empty());
+    uint64_t num_blocks = _bitset.size() / BITS_SET_PER_BLOCK;
+    uint64_t block_index = ((hash >> 32) * num_blocks) >> 32;
+    auto key = static_cast<uint32_t>(hash);
+    const uint32_t* block = _bitset.data() + block_index * BITS_SET_PER_BLOCK;
+    for (uint32_t i = 0; i < BITS_SET_PER_BLOCK; ++i) {
+        uint32_t mask = 1U << ((key * SALT[i]) >> 27);
+        if ((block[i] & mask) == 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+uint64_t ParquetBloomFilter::hash(const void* data, size_t len) {
+    return XXH64(data, len, 0);
+}
+
+// Only plain integer and string columns are checked, values of other types need to be
+// converted to the physical representation of the file which may not be exact.
+static bool is_plain_logical_type(const tparquet::SchemaElement& schema,
+                                  tparquet::ConvertedType::type converted_type) {
+    if (schema.__isset.logicalType) {
+        const auto& logical_type = schema.logicalType;
+        if (converted_type == tparquet::ConvertedType::UTF8) {
+            return logical_type.__isset.STRING;
+        }
+        return logical_type.__isset.INTEGER && logical_type.INTEGER.isSigned;
+    }
+    if (schema.__isset.converted_type) {
+        return schema.converted_type == converted_type ||
+               (converted_type == tparquet::ConvertedType::INT_32 &&
+                (schema.converted_type == tparquet::ConvertedType::INT_8 ||
+                 schema.converted_type == tparquet::ConvertedType::INT_16));
+    }
+    return true;
+}
+
+bool ParquetBloomFilter::get_predicate_hashes(const ColumnValueRangeType& range,
+                                              const FieldSchema* col_schema,
+                                              std::vector<uint64_t>* hashes) {
+    if (col_schema->is_type_compatibility) {
+        return false;
+    }
+    return std::visit(
+            [&](auto&& value_range) {
+                using RangeType = std::decay_t<decltype(value_range)>;
+                using CppType = typename RangeType::CppType;
+                if (!value_range.is_fixed_value_range() || value_range.contain_null() ||
+                    value_range.get_fixed_value_size() == 0 ||
+                    value_range.get_fixed_value_size() > MAX_PROBE_VALUES) {
+                    return false;
+                }
+                const auto& schema = col_schema->parquet_schema;
+                if constexpr (std::is_same_v<RangeType, ColumnValueRange<TYPE_TINYINT>> ||
+                              std::is_same_v<RangeType, ColumnValueRange<TYPE_SMALLINT>> ||
+                              std::is_same_v<RangeType, ColumnValueRange<TYPE_INT>>) {
+                    if (col_schema->physical_type != tparquet::Type::INT32 ||
+                        !is_plain_logical_type(schema, tparquet::ConvertedType::INT_32)) {
+                        return false;
+                    }
+                    for (const CppType& value : value_range.get_fixed_value_set()) {
+                        auto v = static_cast<int32_t>(value);
+                        hashes->push_back(hash(&v, sizeof(v)));
+                    }
+                    return true;
+                } else if constexpr (std::is_same_v<RangeType, ColumnValueRange<TYPE_BIGINT>>) {
+                    if (col_schema->physical_type != tparquet::Type::INT64 ||
+                        !is_plain_logical_type(schema, tparquet::ConvertedType::INT_64)) {
+                        return false;
+                    }
+                    for (const CppType& value : value_range.get_fixed_value_set()) {
+                        auto v = static_cast<int64_t>(value);
+                        hashes->push_back(hash(&v, sizeof(v)));
+                    }
+                    return true;
+                } else if constexpr (std::is_same_v<RangeType, ColumnValueRange<TYPE_VARCHAR>> ||
+                                     std::is_same_v<RangeType, ColumnValueRange<TYPE_STRING>>) {
+                    if (col_schema->physical_type != tparquet::Type::BYTE_ARRAY ||
+                        !is_plain_logical_type(schema, tparquet::ConvertedType::UTF8)) {
+                        return false;
+                    }
+                    for (const CppType& value : value_range.get_fixed_value_set()) {
+                        hashes->push_back(hash(value.data, value.size));
+                    }
+                    return true;
+                } else {
+                    return false;
+                }
+            },
+            range);
+}
+
+#include "common/compile_check_end.h"
+} // namespace doris::vectorized
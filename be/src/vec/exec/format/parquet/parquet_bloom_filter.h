@@ -0,0 +1,74 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "common/status.h"
+#include "exec/olap_common.h"
+#include "io/fs/file_reader_writer_fwd.h"
+
+namespace tparquet {
+class ColumnMetaData;
+} // namespace tparquet
+
+namespace doris {
+namespace io {
+struct IOContext;
+} // namespace io
+
+namespace vectorized {
+#include "common/compile_check_begin.h"
+struct FieldSchema;
+
+// Split block bloom filter of a parquet column chunk, see
+// https://github.com/apache/parquet-format/blob/master/BloomFilter.md
+class ParquetBloomFilter {
+public:
+    static constexpr uint32_t BYTES_PER_BLOCK = 32;
+    static constexpr uint32_t BITS_SET_PER_BLOCK = 8;
+    // Larger filters are not worth reading for row group pruning
+    static constexpr uint32_t MAX_BLOOM_FILTER_SIZE = 128 * 1024 * 1024;
+    // Do not probe the filter with huge IN lists
+    static constexpr size_t MAX_PROBE_VALUES = 1024;
+
+    // Read the bloom filter of the column chunk, *has_filter is set to false if the chunk
+    // has no bloom filter or the filter uses an algorithm that is not supported.
+    Status init(const io::FileReaderSPtr& file, const tparquet::ColumnMetaData& meta,
+                io::IOContext* io_ctx, bool* has_filter);
+    Status init(std::vector<uint32_t> bitset);
+
+    bool find_hash(uint64_t hash) const;
+
+    // Hash of the plain encoded value, without the length prefix for BYTE_ARRAY
+    static uint64_t hash(const void* data, size_t len);
+
+    // Compute the hashes of the equal or IN values of the predicate. Return false if the
+    // predicate can not be checked against the bloom filter of the column.
+    static bool get_predicate_hashes(const ColumnValueRangeType& range,
+                                     const FieldSchema* col_schema, std::vector<uint64_t>* hashes);
+
+private:
+    std::vector<uint32_t> _bitset;
+};
+#include "common/compile_check_end.h"
+
+} // namespace vectorized
+} // namespace doris
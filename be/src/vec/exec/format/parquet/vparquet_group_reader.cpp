@@ -26,6 +26,7 @@
 #include <algorithm>
 #include <boost/iterator/iterator_facade.hpp>
 #include <ostream>
+#include <set>
 
 #include "common/config.h"
 #include "common/logging.h"
@@ -76,6 +77,21 @@ namespace doris::vectorized {
 const std::vector<int64_t> RowGroupReader::NO_DELETE = {};
 static constexpr uint32_t MAX_DICT_CODE_PREDICATE_TO_REWRITE = std::numeric_limits<uint32_t>::max();
 
+// Collect the slot ids referenced by expr, return false if some slot reference can not be
+// resolved to a plain VSlotRef so that the caller has to be conservative.
+static bool collect_slot_ids(const VExprSPtr& expr, std::set<int>& slot_ids) {
+    if (expr->node_type() == TExprNodeType::SLOT_REF) {
+        auto* slot_ref = dynamic_cast<VSlotRef*>(expr.get());
+        if (slot_ref == nullptr) {
+            return false;
+        }
+        slot_ids.insert(slot_ref->slot_id());
+    }
+    return std::ranges::all_of(expr->children(), [&](const auto& child) {
+        return collect_slot_ids(child, slot_ids);
+    });
+}
+
 RowGroupReader::RowGroupReader(io::FileReaderSPtr file_reader,
                                const std::vector<std::string>& read_columns,
                                const int32_t row_group_id, const tparquet::RowGroup& row_group,
@@ -139,9 +155,16 @@ Status RowGroupReader::init(
         _column_readers[read_table_col] = std::move(reader);
     }
 
+    // Multi slot conjuncts are evaluated on the original string values, so only the slots they
+    // reference lose dict filtering, the other slots can still be filtered by dict codes.
     bool disable_dict_filter = false;
+    std::set<int> not_single_slot_ids;
     if (not_single_slot_filter_conjuncts != nullptr && !not_single_slot_filter_conjuncts->empty()) {
-        disable_dict_filter = true;
+        for (const auto& ctx : *not_single_slot_filter_conjuncts) {
+            if (!collect_slot_ids(ctx->root(), not_single_slot_ids)) {
+                disable_dict_filter = true;
+            }
+        }
         _filter_conjuncts.insert(_filter_conjuncts.end(), not_single_slot_filter_conjuncts->begin(),
                                  not_single_slot_filter_conjuncts->end());
     }
@@ -158,6 +181,7 @@ Status RowGroupReader::init(
                     _table_info_node_ptr->children_file_column_name(predicate_col_name);
             auto field = const_cast<FieldSchema*>(schema.get_column(predicate_file_col_name));
             if (!disable_dict_filter && !_lazy_read_ctx.has_complex_type &&
+                !not_single_slot_ids.contains(slot_id) &&
                 _can_filter_by_dict(
                         slot_id, _row_group_meta.columns[field->physical_column_index].meta_data)) {
                 _dict_filter_cols.emplace_back(std::make_pair(predicate_col_name, slot_id));
@@ -26,6 +26,7 @@
 #include <functional>
 #include <utility>
 
+#include "common/config.h"
 #include "common/status.h"
 #include "exec/schema_scanner.h"
 #include "io/file_factory.h"
@@ -37,6 +38,7 @@
 #include "parquet_thrift_util.h"
 #include "runtime/define_primitive_type.h"
 #include "runtime/descriptors.h"
+#include "runtime/runtime_predicate.h"
 #include "runtime/types.h"
 #include "util/slice.h"
 #include "util/string_util.h"
@@ -46,6 +48,7 @@
 #include "vec/core/block.h"
 #include "vec/core/column_with_type_and_name.h"
 #include "vec/core/types.h"
+#include "vec/exec/format/parquet/parquet_bloom_filter.h"
 #include "vec/exec/format/parquet/parquet_common.h"
 #include "vec/exec/format/parquet/schema_desc.h"
 #include "vec/exec/format/parquet/vparquet_file_metadata.h"
@@ -190,6 +193,12 @@ void ParquetReader::_init_profile() {
                 ADD_CHILD_TIMER_WITH_LEVEL(_profile, "PredicateFilterTime", parquet_profile, 1);
         _parquet_profile.dict_filter_rewrite_time =
                 ADD_CHILD_TIMER_WITH_LEVEL(_profile, "DictFilterRewriteTime", parquet_profile, 1);
+        _parquet_profile.bloom_filter_read_time =
+                ADD_CHILD_TIMER_WITH_LEVEL(_profile, "BloomFilterReadTime", parquet_profile, 1);
+        _parquet_profile.filtered_row_groups_by_bloom_filter = ADD_CHILD_COUNTER_WITH_LEVEL(
+                _profile, "FilteredGroupsByBloomFilter", TUnit::UNIT, parquet_profile, 1);
+        _parquet_profile.filtered_row_groups_by_topn = ADD_CHILD_COUNTER_WITH_LEVEL(
+                _profile, "FilteredGroupsByTopn", TUnit::UNIT, parquet_profile, 1);
     }
 }
 
@@ -590,10 +599,26 @@ Status ParquetReader::_next_row_group_reader() {
     if (_current_group_reader != nullptr) {
         _current_group_reader->collect_profile_before_close();
     }
-    if (_read_row_groups.empty()) {
-        _row_group_eof = true;
-        _current_group_reader.reset(nullptr);
-        return Status::EndOfFile("No next RowGroupReader");
+    while (true) {
+        if (_read_row_groups.empty()) {
+            _row_group_eof = true;
+            _current_group_reader.reset(nullptr);
+            return Status::EndOfFile("No next RowGroupReader");
+        }
+        const auto& next_group = _t_metadata->row_groups[_read_row_groups.front().row_group_id];
+        _init_topn_value_ranges(next_group);
+        bool filter_group = false;
+        if (!_topn_value_ranges.empty()) {
+            SCOPED_RAW_TIMER(&_statistics.row_group_filter_time);
+            RETURN_IF_ERROR(_process_column_stat_filter(next_group.columns, _topn_value_ranges,
+                                                        &filter_group));
+        }
+        if (!filter_group) {
+            break;
+        }
+        _statistics.filtered_row_groups_by_topn++;
+        _statistics.filtered_group_rows += next_group.num_rows;
+        _read_row_groups.pop_front();
     }
     RowGroupReader::RowGroupIndex row_group_index = _read_row_groups.front();
     _read_row_groups.pop_front();
@@ -783,9 +808,9 @@ Status ParquetReader::_process_page_index(const tparquet::RowGroup& row_group,
         }
     };
 
+    bool has_value_range = _colname_to_value_range != nullptr && !_colname_to_value_range->empty();
     if ((!_enable_filter_by_min_max) || _lazy_read_ctx.has_complex_type ||
-        _lazy_read_ctx.conjuncts.empty() || _colname_to_value_range == nullptr ||
-        _colname_to_value_range->empty()) {
+        _lazy_read_ctx.conjuncts.empty() || (!has_value_range && _topn_value_ranges.empty())) {
         read_whole_row_group();
         return Status::OK();
     }
@@ -820,8 +845,18 @@ Status ParquetReader::_process_page_index(const tparquet::RowGroup& row_group,
     for (size_t idx = 0; idx < _read_table_columns.size(); idx++) {
         const auto& read_table_col = _read_table_columns[idx];
         const auto& read_file_col = _read_file_columns[idx];
-        auto conjunct_iter = _colname_to_value_range->find(read_table_col);
-        if (_colname_to_value_range->end() == conjunct_iter) {
+        std::vector<const ColumnValueRangeType*> value_ranges;
+        if (has_value_range) {
+            auto conjunct_iter = _colname_to_value_range->find(read_table_col);
+            if (_colname_to_value_range->end() != conjunct_iter) {
+                value_ranges.push_back(&conjunct_iter->second);
+            }
+        }
+        if (auto topn_iter = _topn_value_ranges.find(read_table_col);
+            topn_iter != _topn_value_ranges.end()) {
+            value_ranges.push_back(&topn_iter->second);
+        }
+        if (value_ranges.empty()) {
             continue;
         }
         int parquet_col_id =
@@ -840,11 +875,12 @@ Status ParquetReader::_process_page_index(const tparquet::RowGroup& row_group,
         if (num_of_pages <= 0) {
             continue;
         }
-        auto& conjuncts = conjunct_iter->second;
         std::vector<int> skipped_page_range;
         const FieldSchema* col_schema = schema_desc.get_column(read_file_col);
-        RETURN_IF_ERROR(page_index.collect_skipped_page_range(&column_index, conjuncts, col_schema,
-                                                              skipped_page_range, *_ctz));
+        for (const auto* value_range : value_ranges) {
+            RETURN_IF_ERROR(page_index.collect_skipped_page_range(
+                    &column_index, *value_range, col_schema, skipped_page_range, *_ctz));
+        }
         if (skipped_page_range.empty()) {
             continue;
         }
@@ -918,29 +954,32 @@ Status ParquetReader::_process_row_group_filter(
             *filter_group = true;
         }
     } else {
-        RETURN_IF_ERROR(_process_column_stat_filter(row_group.columns, filter_group));
+        if (_colname_to_value_range != nullptr) {
+            RETURN_IF_ERROR(_process_column_stat_filter(row_group.columns,
+                                                        *_colname_to_value_range, filter_group));
+        }
         _init_chunk_dicts();
         RETURN_IF_ERROR(_process_dict_filter(filter_group));
-        _init_bloom_filter();
-        RETURN_IF_ERROR(_process_bloom_filter(filter_group));
+        RETURN_IF_ERROR(_process_bloom_filter(row_group.columns, filter_group));
     }
     return Status::OK();
 }
 
-Status ParquetReader::_process_column_stat_filter(const std::vector<tparquet::ColumnChunk>& columns,
-                                                  bool* filter_group) {
-    if ((!_enable_filter_by_min_max) || _colname_to_value_range == nullptr ||
-        _colname_to_value_range->empty()) {
+Status ParquetReader::_process_column_stat_filter(
+        const std::vector<tparquet::ColumnChunk>& columns,
+        const std::unordered_map<std::string, ColumnValueRangeType>& colname_to_value_range,
+        bool* filter_group) {
+    if ((!_enable_filter_by_min_max) || colname_to_value_range.empty()) {
         return Status::OK();
     }
     auto& schema_desc = _file_metadata->schema();
     for (auto& table_col_name : _read_table_columns) {
-        if (_table_info_node_ptr->children_column_exists(table_col_name)) {
+        if (!_table_info_node_ptr->children_column_exists(table_col_name)) {
             continue;
         }
 
-        auto slot_iter = _colname_to_value_range->find(table_col_name);
-        if (slot_iter == _colname_to_value_range->end()) {
+        auto slot_iter = colname_to_value_range.find(table_col_name);
+        if (slot_iter == colname_to_value_range.end()) {
             continue;
         }
 
@@ -1016,15 +1055,94 @@ Status ParquetReader::_process_column_stat_filter(const std::vector<tparquet::Co
     return Status::OK();
 }
 
+void ParquetReader::_init_topn_value_ranges(const tparquet::RowGroup& row_group) {
+    _topn_value_ranges.clear();
+    if (_topn_filters.empty() || (!_enable_filter_by_min_max) || _read_line_mode_mode) {
+        return;
+    }
+    _topn_values.resize(_topn_filters.size());
+    for (size_t i = 0; i < _topn_filters.size(); ++i) {
+        const auto& topn_filter = _topn_filters[i];
+        const auto& col_name = topn_filter.slot->col_name();
+        if (!topn_filter.predicate->has_value() || _topn_value_ranges.contains(col_name) ||
+            std::find(_read_table_columns.begin(), _read_table_columns.end(), col_name) ==
+                    _read_table_columns.end() ||
+            !_table_info_node_ptr->children_column_exists(col_name)) {
+            continue;
+        }
+        if (topn_filter.predicate->nulls_first()) {
+            // Nulls sort before any threshold, so only chunks known to have no null qualify.
+            auto file_col_name = _table_info_node_ptr->children_file_column_name(col_name);
+            const FieldSchema* field = _file_metadata->schema().get_column(file_col_name);
+            if (field->physical_column_index < 0) {
+                continue;
+            }
+            const auto& statistic = row_group.columns[field->physical_column_index]
+                                            .meta_data.statistics;
+            if (!statistic.__isset.null_count || statistic.null_count != 0) {
+                continue;
+            }
+        }
+        _topn_values[i] = topn_filter.predicate->get_value();
+        ColumnValueRangeType value_range;
+        if (topn_filter.predicate->to_value_range(_topn_values[i], *topn_filter.slot,
+                                                  &value_range)) {
+            _topn_value_ranges.emplace(col_name, std::move(value_range));
+        }
+    }
+}
+
 void ParquetReader::_init_chunk_dicts() {}
 
 Status ParquetReader::_process_dict_filter(bool* filter_group) {
     return Status::OK();
 }
 
-void ParquetReader::_init_bloom_filter() {}
-
-Status ParquetReader::_process_bloom_filter(bool* filter_group) {
+Status ParquetReader::_process_bloom_filter(const std::vector<tparquet::ColumnChunk>& columns,
+                                            bool* filter_group) {
+    if (*filter_group || !config::enable_parquet_bloom_filter ||
+        _colname_to_value_range == nullptr || _colname_to_value_range->empty()) {
+        return Status::OK();
+    }
+    SCOPED_RAW_TIMER(&_statistics.bloom_filter_read_time);
+    const auto& schema_desc = _file_metadata->schema();
+    std::vector<uint64_t> hashes;
+    for (const auto& table_col_name : _read_table_columns) {
+        if (!_table_info_node_ptr->children_column_exists(table_col_name)) {
+            continue;
+        }
+        auto slot_iter = _colname_to_value_range->find(table_col_name);
+        if (slot_iter == _colname_to_value_range->end()) {
+            continue;
+        }
+        auto file_col_name = _table_info_node_ptr->children_file_column_name(table_col_name);
+        const FieldSchema* col_schema = schema_desc.get_column(file_col_name);
+        if (col_schema == nullptr || col_schema->physical_column_index < 0) {
+            continue;
+        }
+        hashes.clear();
+        if (!ParquetBloomFilter::get_predicate_hashes(slot_iter->second, col_schema, &hashes)) {
+            continue;
+        }
+        ParquetBloomFilter bloom_filter;
+        bool has_filter = false;
+        auto st = bloom_filter.init(_tracing_file_reader,
+                                    columns[col_schema->physical_column_index].meta_data, _io_ctx,
+                                    &has_filter);
+        if (!st.ok()) {
+            // A broken bloom filter only loses the pruning, the data can still be read
+            LOG(WARNING) << "failed to read parquet bloom filter, file=" << _scan_range.path
+                         << ", column=" << file_col_name << ", status=" << st;
+            continue;
+        }
+        if (has_filter && std::ranges::none_of(hashes, [&](uint64_t hash) {
+                return bloom_filter.find_hash(hash);
+            })) {
+            *filter_group = true;
+            _statistics.filtered_row_groups_by_bloom_filter++;
+            break;
+        }
+    }
     return Status::OK();
 }
 
@@ -1063,6 +1181,11 @@ void ParquetReader::_collect_profile() {
                    _column_statistics.parse_page_header_num);
     COUNTER_UPDATE(_parquet_profile.predicate_filter_time, _statistics.predicate_filter_time);
     COUNTER_UPDATE(_parquet_profile.dict_filter_rewrite_time, _statistics.dict_filter_rewrite_time);
+    COUNTER_UPDATE(_parquet_profile.bloom_filter_read_time, _statistics.bloom_filter_read_time);
+    COUNTER_UPDATE(_parquet_profile.filtered_row_groups_by_bloom_filter,
+                   _statistics.filtered_row_groups_by_bloom_filter);
+    COUNTER_UPDATE(_parquet_profile.filtered_row_groups_by_topn,
+                   _statistics.filtered_row_groups_by_topn);
     COUNTER_UPDATE(_parquet_profile.file_meta_read_calls, _column_statistics.meta_read_calls);
     COUNTER_UPDATE(_parquet_profile.decompress_time, _column_statistics.decompress_time);
     COUNTER_UPDATE(_parquet_profile.decompress_cnt, _column_statistics.decompress_cnt);
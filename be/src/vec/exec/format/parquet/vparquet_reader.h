@@ -37,6 +37,7 @@
 #include "io/fs/file_reader_writer_fwd.h"
 #include "util/obj_lru_cache.h"
 #include "util/runtime_profile.h"
+#include "vec/core/field.h"
 #include "vec/exec/format/generic_reader.h"
 #include "vec/exec/format/parquet/parquet_common.h"
 #include "vec/exec/format/table/table_format_reader.h"
@@ -62,6 +63,7 @@ namespace vectorized {
 class Block;
 class FileMetaData;
 class PageIndex;
+class RuntimePredicate;
 class ShardedKVCache;
 class VExprContext;
 } // namespace vectorized
@@ -93,6 +95,15 @@ public:
         int64_t parse_page_index_time = 0;
         int64_t predicate_filter_time = 0;
         int64_t dict_filter_rewrite_time = 0;
+        int64_t bloom_filter_read_time = 0;
+        int64_t filtered_row_groups_by_bloom_filter = 0;
+        int64_t filtered_row_groups_by_topn = 0;
+    };
+
+    // A topn runtime predicate whose target is a plain slot of this scan.
+    struct TopnFilter {
+        const RuntimePredicate* predicate = nullptr;
+        const SlotDescriptor* slot = nullptr;
     };
 
     ParquetReader(RuntimeProfile* profile, const TFileScanRangeParams& params,
@@ -159,6 +170,11 @@ public:
 
     bool count_read_rows() override { return true; }
 
+    // The latest thresholds of these predicates prune row groups and pages before reading.
+    void set_topn_filters(std::vector<TopnFilter> topn_filters) {
+        _topn_filters = std::move(topn_filters);
+    }
+
 protected:
     void _collect_profile_before_close() override;
 
@@ -194,6 +210,9 @@ private:
         RuntimeProfile::Counter* parse_page_header_num = nullptr;
         RuntimeProfile::Counter* predicate_filter_time = nullptr;
         RuntimeProfile::Counter* dict_filter_rewrite_time = nullptr;
+        RuntimeProfile::Counter* bloom_filter_read_time = nullptr;
+        RuntimeProfile::Counter* filtered_row_groups_by_bloom_filter = nullptr;
+        RuntimeProfile::Counter* filtered_row_groups_by_topn = nullptr;
     };
 
     Status _open_file();
@@ -214,14 +233,18 @@ private:
 
     // Row Group Filter
     bool _is_misaligned_range_group(const tparquet::RowGroup& row_group);
-    Status _process_column_stat_filter(const std::vector<tparquet::ColumnChunk>& column_meta,
-                                       bool* filter_group);
+    Status _process_column_stat_filter(
+            const std::vector<tparquet::ColumnChunk>& column_meta,
+            const std::unordered_map<std::string, ColumnValueRangeType>& colname_to_value_range,
+            bool* filter_group);
+    // Topn thresholds only become known while scanning, so they are checked per row group.
+    void _init_topn_value_ranges(const tparquet::RowGroup& row_group);
     Status _process_row_group_filter(const RowGroupReader::RowGroupIndex& row_group_index,
                                      const tparquet::RowGroup& row_group, bool* filter_group);
     void _init_chunk_dicts();
     Status _process_dict_filter(bool* filter_group);
-    void _init_bloom_filter();
-    Status _process_bloom_filter(bool* filter_group);
+    Status _process_bloom_filter(const std::vector<tparquet::ColumnChunk>& columns,
+                                 bool* filter_group);
     int64_t _get_column_start_offset(const tparquet::ColumnMetaData& column_init_column_readers);
     std::string _meta_cache_key(const std::string& path) { return "meta_" + path; }
     std::vector<io::PrefetchRange> _generate_random_access_ranges(
@@ -313,6 +336,11 @@ private:
     std::vector<std::vector<RowRange>> _read_line_mode_row_ranges;
     std::pair<std::shared_ptr<RowIdColumnIteratorV2>, int> _row_id_column_iterator_pair = {nullptr,
                                                                                            -1};
+
+    std::vector<TopnFilter> _topn_filters;
+    // Thresholds backing the string ranges in _topn_value_ranges.
+    std::vector<Field> _topn_values;
+    std::unordered_map<std::string, ColumnValueRangeType> _topn_value_ranges;
 };
 #include "common/compile_check_end.h"
 
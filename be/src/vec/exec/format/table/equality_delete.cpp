@@ -17,6 +17,9 @@
 
 #include "vec/exec/format/table/equality_delete.h"
 
+#include <algorithm>
+#include <numeric>
+
 #include "exprs/create_predicate_function.h"
 
 namespace doris::vectorized {
@@ -98,8 +101,18 @@ Status MultiEqualityDelete::_build_set() {
     for (ColumnPtr column : _delete_block->get_columns()) {
         column->update_hashes_with_value(_delete_hashes.data(), nullptr);
     }
-    for (size_t i = 0; i < rows; ++i) {
-        _delete_hash_map.insert({_delete_hashes[i], i});
+    _delete_rows_by_hash.resize(rows);
+    std::iota(_delete_rows_by_hash.begin(), _delete_rows_by_hash.end(), 0);
+    std::stable_sort(_delete_rows_by_hash.begin(), _delete_rows_by_hash.end(),
+                     [&](size_t a, size_t b) { return _delete_hashes[a] < _delete_hashes[b]; });
+    _delete_hash_map.clear();
+    _delete_hash_map.reserve(rows);
+    for (size_t begin = 0, end = 0; begin < rows; begin = end) {
+        uint64_t hash = _delete_hashes[_delete_rows_by_hash[begin]];
+        for (end = begin + 1; end < rows && _delete_hashes[_delete_rows_by_hash[end]] == hash;
+             ++end) {
+        }
+        _delete_hash_map.emplace(hash, std::make_pair(begin, end));
     }
     _data_column_index.resize(_delete_block->columns());
     return Status::OK();
@@ -138,10 +151,12 @@ Status MultiEqualityDelete::filter_data_block(Block* data_block) {
     }
     auto* filter_data = _filter->data();
     for (size_t i = 0; i < rows; ++i) {
-        for (auto beg = _delete_hash_map.lower_bound(_data_hashes[i]),
-                  end = _delete_hash_map.upper_bound(_data_hashes[i]);
-             beg != end; ++beg) {
-            if (_equal(data_block, i, beg->second)) {
+        auto it = _delete_hash_map.find(_data_hashes[i]);
+        if (it == _delete_hash_map.end()) {
+            continue;
+        }
+        for (size_t pos = it->second.first; pos < it->second.second; ++pos) {
+            if (_equal(data_block, i, _delete_rows_by_hash[pos])) {
                 filter_data[i] = 0;
                 break;
             }
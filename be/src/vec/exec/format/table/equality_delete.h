@@ -15,6 +15,8 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <parallel_hashmap/phmap.h>
+
 #include "exprs/hybrid_set.h"
 #include "util/runtime_profile.h"
 #include "vec/core/block.h"
@@ -85,10 +87,11 @@ protected:
     std::vector<uint64_t> _delete_hashes;
     // hash column for data block
     std::vector<uint64_t> _data_hashes;
-    // hash code => row index
+    // row numbers of the delete rows in delete block, rows with the same hash are adjacent
+    std::vector<size_t> _delete_rows_by_hash;
+    // hash code => [begin, end) of the rows in _delete_rows_by_hash
     // if hash values are equal, then compare the real values
-    // the row index records the row number of the delete row in delete block
-    std::multimap<uint64_t, size_t> _delete_hash_map;
+    phmap::flat_hash_map<uint64_t, std::pair<size_t, size_t>> _delete_hash_map;
     // the delete column indexes in data block
     std::vector<size_t> _data_column_index;
     std::unique_ptr<IColumn::Filter> _filter;
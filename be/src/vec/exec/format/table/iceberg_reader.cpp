@@ -17,6 +17,7 @@
 
 #include "iceberg_reader.h"
 
+#include <fmt/format.h>
 #include <gen_cpp/Metrics_types.h>
 #include <gen_cpp/PlanNodes_types.h>
 #include <gen_cpp/parquet_types.h>
@@ -143,9 +144,48 @@ Status IcebergTableReader::init_row_filters() {
 
 Status IcebergTableReader::_equality_delete_base(
         const std::vector<TIcebergDeleteFileDesc>& delete_files) {
+    std::vector<std::string> delete_paths;
+    for (const auto& delete_file : delete_files) {
+        delete_paths.emplace_back(delete_file.path);
+    }
+    std::sort(delete_paths.begin(), delete_paths.end());
+    Status create_status = Status::OK();
+    {
+        SCOPED_TIMER(_iceberg_profile.delete_files_read_time);
+        _equality_delete_rows = _kv_cache->get<EqualityDeleteRows>(
+                fmt::format("equality_delete_{}", fmt::join(delete_paths, ",")),
+                [&]() -> EqualityDeleteRows* {
+                    auto delete_rows = std::make_unique<EqualityDeleteRows>();
+                    create_status = _read_equality_delete_files(delete_files, delete_rows.get());
+                    return create_status.ok() ? delete_rows.release() : nullptr;
+                });
+    }
+    RETURN_IF_ERROR(create_status);
+    DCHECK(_equality_delete_rows != nullptr);
+    const auto& equality_delete_col_names = _equality_delete_rows->col_names;
+    const auto& equality_delete_col_types = _equality_delete_rows->col_types;
+    for (int i = 0; i < equality_delete_col_names.size(); ++i) {
+        const std::string& delete_col = equality_delete_col_names[i];
+        if (std::find(_all_required_col_names.begin(), _all_required_col_names.end(), delete_col) ==
+            _all_required_col_names.end()) {
+            _expand_col_names.emplace_back(delete_col);
+            DataTypePtr data_type = make_nullable(equality_delete_col_types[i]);
+            MutableColumnPtr data_column = data_type->create_column();
+            _expand_columns.emplace_back(std::move(data_column), data_type, delete_col);
+        }
+    }
+    for (const std::string& delete_col : _expand_col_names) {
+        _all_required_col_names.emplace_back(delete_col);
+    }
+    _equality_delete_impl = EqualityDeleteBase::get_delete_impl(&_equality_delete_rows->block);
+    return _equality_delete_impl->init(_profile);
+}
+
+Status IcebergTableReader::_read_equality_delete_files(
+        const std::vector<TIcebergDeleteFileDesc>& delete_files, EqualityDeleteRows* delete_rows) {
     bool init_schema = false;
-    std::vector<std::string> equality_delete_col_names;
-    std::vector<DataTypePtr> equality_delete_col_types;
+    auto& equality_delete_col_names = delete_rows->col_names;
+    auto& equality_delete_col_types = delete_rows->col_types;
     std::unordered_map<std::string, std::tuple<std::string, const SlotDescriptor*>>
             partition_columns;
     std::unordered_map<std::string, VExprContextSPtr> missing_columns;
@@ -163,7 +203,7 @@ Status IcebergTableReader::_equality_delete_base(
             RETURN_IF_ERROR(delete_reader->init_schema_reader());
             RETURN_IF_ERROR(delete_reader->get_parsed_schema(&equality_delete_col_names,
                                                              &equality_delete_col_types));
-            _generate_equality_delete_block(&_equality_delete_block, equality_delete_col_names,
+            _generate_equality_delete_block(&delete_rows->block, equality_delete_col_names,
                                             equality_delete_col_types);
             init_schema = true;
         }
@@ -188,26 +228,12 @@ Status IcebergTableReader::_equality_delete_base(
             size_t read_rows = 0;
             RETURN_IF_ERROR(delete_reader->get_next_block(&block, &read_rows, &eof));
             if (read_rows > 0) {
-                MutableBlock mutable_block(&_equality_delete_block);
+                MutableBlock mutable_block(&delete_rows->block);
                 RETURN_IF_ERROR(mutable_block.merge(block));
             }
         }
     }
-    for (int i = 0; i < equality_delete_col_names.size(); ++i) {
-        const std::string& delete_col = equality_delete_col_names[i];
-        if (std::find(_all_required_col_names.begin(), _all_required_col_names.end(), delete_col) ==
-            _all_required_col_names.end()) {
-            _expand_col_names.emplace_back(delete_col);
-            DataTypePtr data_type = make_nullable(equality_delete_col_types[i]);
-            MutableColumnPtr data_column = data_type->create_column();
-            _expand_columns.emplace_back(std::move(data_column), data_type, delete_col);
-        }
-    }
-    for (const std::string& delete_col : _expand_col_names) {
-        _all_required_col_names.emplace_back(delete_col);
-    }
-    _equality_delete_impl = EqualityDeleteBase::get_delete_impl(&_equality_delete_block);
-    return _equality_delete_impl->init(_profile);
+    return Status::OK();
 }
 
 void IcebergTableReader::_generate_equality_delete_block(
@@ -114,7 +114,16 @@ protected:
 
     Status _position_delete_base(const std::string data_file_path,
                                  const std::vector<TIcebergDeleteFileDesc>& delete_files);
+    // Rows of a set of equality delete files. They are read once per scan node and shared
+    // through _kv_cache by all the data files that have the same delete files.
+    struct EqualityDeleteRows {
+        Block block;
+        std::vector<std::string> col_names;
+        std::vector<DataTypePtr> col_types;
+    };
     Status _equality_delete_base(const std::vector<TIcebergDeleteFileDesc>& delete_files);
+    Status _read_equality_delete_files(const std::vector<TIcebergDeleteFileDesc>& delete_files,
+                                       EqualityDeleteRows* delete_rows);
     virtual std::unique_ptr<GenericReader> _create_equality_reader(
             const TFileRangeDesc& delete_desc) = 0;
     void _generate_equality_delete_block(Block* block,
@@ -149,8 +158,8 @@ protected:
     void _gen_position_delete_file_range(Block& block, DeleteFile* const position_delete,
                                          size_t read_rows, bool file_path_column_dictionary_coded);
 
-    // equality delete
-    Block _equality_delete_block;
+    // equality delete, owned by _kv_cache
+    EqualityDeleteRows* _equality_delete_rows = nullptr;
     std::unique_ptr<EqualityDeleteBase> _equality_delete_impl;
 };
 
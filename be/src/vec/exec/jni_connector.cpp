@@ -398,12 +398,7 @@ Status JniConnector::_fill_string_column(TableMetaAddress& address, MutableColum
     string_chars.resize(origin_chars_size + offsets[num_rows - 1]);
     memcpy(string_chars.data() + origin_chars_size, chars, offsets[num_rows - 1]);
 
-    size_t origin_offsets_size = string_offsets.size();
-    size_t start_offset = string_offsets[origin_offsets_size - 1];
-    string_offsets.resize(origin_offsets_size + num_rows);
-    for (size_t i = 0; i < num_rows; ++i) {
-        string_offsets[origin_offsets_size + i] = offsets[i] + start_offset;
-    }
+    _fill_offsets(string_offsets, offsets, num_rows);
     return Status::OK();
 }
 
@@ -417,11 +412,8 @@ Status JniConnector::_fill_array_column(TableMetaAddress& address, MutableColumn
 
     int64_t* offsets = reinterpret_cast<int64_t*>(address.next_meta_as_ptr());
     size_t origin_size = offsets_data.size();
-    offsets_data.resize(origin_size + num_rows);
     size_t start_offset = offsets_data[origin_size - 1];
-    for (size_t i = 0; i < num_rows; ++i) {
-        offsets_data[origin_size + i] = offsets[i] + start_offset;
-    }
+    _fill_offsets(offsets_data, offsets, num_rows);
 
     // offsets[num_rows - 1] == offsets_data[origin_size + num_rows - 1] - start_offset
     // but num_row equals 0 when there are all empty arrays
@@ -443,11 +435,8 @@ Status JniConnector::_fill_map_column(TableMetaAddress& address, MutableColumnPt
 
     int64_t* offsets = reinterpret_cast<int64_t*>(address.next_meta_as_ptr());
     size_t origin_size = map_offsets.size();
-    map_offsets.resize(origin_size + num_rows);
     size_t start_offset = map_offsets[origin_size - 1];
-    for (size_t i = 0; i < num_rows; ++i) {
-        map_offsets[origin_size + i] = offsets[i] + start_offset;
-    }
+    _fill_offsets(map_offsets, offsets, num_rows);
 
     RETURN_IF_ERROR(_fill_column(address, key_column, key_type,
                                  map_offsets[origin_size + num_rows - 1] - start_offset));
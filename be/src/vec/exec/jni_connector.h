@@ -355,6 +355,24 @@ private:
         return Status::OK();
     }
 
+    // Java offsets are relative to the current batch, rebase them on the last doris offset.
+    // The first batch of a column needs no rebasing and is copied in one block.
+    template <typename DorisOffset, typename JavaOffset>
+    static void _fill_offsets(PaddedPODArray<DorisOffset>& offsets_data, const JavaOffset* offsets,
+                              size_t num_rows) {
+        static_assert(sizeof(DorisOffset) == sizeof(JavaOffset));
+        size_t origin_size = offsets_data.size();
+        DorisOffset start_offset = offsets_data[origin_size - 1];
+        offsets_data.resize(origin_size + num_rows);
+        if (start_offset == 0) {
+            memcpy(offsets_data.data() + origin_size, offsets, sizeof(JavaOffset) * num_rows);
+            return;
+        }
+        for (size_t i = 0; i < num_rows; ++i) {
+            offsets_data[origin_size + i] = static_cast<DorisOffset>(offsets[i]) + start_offset;
+        }
+    }
+
     template <typename COLUMN_TYPE>
     static long _get_fixed_length_column_address(const IColumn& doris_column) {
         return (long)assert_cast<const COLUMN_TYPE&>(doris_column).get_data().data();
@@ -58,6 +58,7 @@
 #include "vec/data_types/data_type_string.h"
 #include "vec/exec/format/arrow/arrow_stream_reader.h"
 #include "vec/exec/format/avro/avro_jni_reader.h"
+#include "vec/exec/format/avro/avro_reader.h"
 #include "vec/exec/format/csv/csv_reader.h"
 #include "vec/exec/format/json/new_json_reader.h"
 #include "vec/exec/format/orc/vorc_reader.h"
@@ -906,6 +907,25 @@ void FileScanner::_truncate_char_or_varchar_column(Block* block, int idx, int le
     Block::erase_useless_column(block, num_columns_without_result);
 }
 
+std::vector<ParquetReader::TopnFilter> FileScanner::_get_parquet_topn_filters() {
+    auto* local_state = static_cast<pipeline::FileScanLocalState*>(_local_state);
+    std::vector<ParquetReader::TopnFilter> topn_filters;
+    for (int id : local_state->get_topn_filter_source_node_ids(_state, false)) {
+        const auto& pred = _state->get_query_ctx()->get_runtime_predicate(id);
+        if (!pred.target_is_slot(local_state->parent_id())) {
+            continue;
+        }
+        auto slot_id = pred.get_texpr(local_state->parent_id()).nodes[0].slot_ref.slot_id;
+        for (const auto* slot : _file_slot_descs) {
+            if (slot->id() == slot_id) {
+                topn_filters.push_back({&pred, slot});
+                break;
+            }
+        }
+    }
+    return topn_filters;
+}
+
 Status FileScanner::_create_row_id_column_iterator() {
     auto& id_file_map = _state->get_id_file_map();
     auto file_id = id_file_map->get_file_mapping_id(std::make_shared<FileMapping>(
@@ -1045,6 +1065,7 @@ Status FileScanner::_get_next_reader() {
             parquet_reader->set_push_down_agg_type(_get_push_down_agg_type());
             if (push_down_predicates) {
                 RETURN_IF_ERROR(_process_late_arrival_conjuncts());
+                parquet_reader->set_topn_filters(_get_parquet_topn_filters());
             }
             RETURN_IF_ERROR(_init_parquet_reader(std::move(parquet_reader)));
 
@@ -1101,6 +1122,17 @@ Status FileScanner::_get_next_reader() {
             break;
         }
         case TFileFormatType::FORMAT_AVRO: {
+            if (config::enable_native_avro_reader) {
+                auto avro_reader = AvroReader::create_unique(_state, _profile, *_params, range,
+                                                             _file_slot_descs, _io_ctx.get());
+                init_status = avro_reader->init_reader();
+                if (!init_status.is<ErrorCode::NOT_IMPLEMENTED_ERROR>()) {
+                    _cur_reader = std::move(avro_reader);
+                    break;
+                }
+                VLOG_NOTICE << "fall back to jni avro reader for " << range.path << ": "
+                            << init_status;
+            }
             _cur_reader = AvroJNIReader::create_unique(_state, _profile, *_params, _file_slot_descs,
                                                        range);
             init_status =
@@ -1704,6 +1736,8 @@ void FileScanner::update_realtime_counters() {
     } else {
         _state->get_query_ctx()->resource_ctx()->io_context()->update_scan_bytes_from_local_storage(
                 _file_cache_statistics->bytes_read_from_local);
+        _state->get_query_ctx()->resource_ctx()->io_context()->update_scan_bytes_from_file_cache(
+                _file_cache_statistics->bytes_read_from_local);
         _state->get_query_ctx()
                 ->resource_ctx()
                 ->io_context()
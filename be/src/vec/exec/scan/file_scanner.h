@@ -258,6 +258,7 @@ private:
     Status _init_orc_reader(std::unique_ptr<OrcReader>&& orc_reader);
     Status _init_parquet_reader(std::unique_ptr<ParquetReader>&& parquet_reader);
     Status _create_row_id_column_iterator();
+    std::vector<ParquetReader::TopnFilter> _get_parquet_topn_filters();
 
     TFileFormatType::type _get_current_format_type() {
         // for compatibility, if format_type is not set in range, use the format type of params
@@ -398,6 +398,8 @@ Status OlapScanner::_init_tablet_reader_params(
     }
 
     _tablet_reader_params.use_page_cache = _state->enable_page_cache();
+    _tablet_reader_params.streaming_read =
+            _tablet_reader_params.use_page_cache && _is_streaming_scan();
 
     if (tablet->enable_unique_key_merge_on_write() && !_state->skip_delete_bitmap()) {
         _tablet_reader_params.delete_bitmap = &tablet->tablet_meta()->delete_bitmap();
@@ -457,6 +459,20 @@ Status OlapScanner::_init_tablet_reader_params(
     return Status::OK();
 }
 
+// A full-range scan without limit over a lot of data, e.g. an export, reads each page once,
+// so its pages should not flush the pages of other queries out of page cache.
+bool OlapScanner::_is_streaming_scan() const {
+    const int64_t threshold = config::storage_page_cache_streaming_scan_bytes;
+    if (threshold <= 0 || !_tablet_reader_params.start_key.empty() || _limit >= 0) {
+        return false;
+    }
+    int64_t scan_bytes = 0;
+    for (const auto& rs_split : _tablet_reader_params.rs_splits) {
+        scan_bytes += rs_split.rs_reader->rowset()->data_disk_size();
+    }
+    return scan_bytes >= threshold;
+}
+
 Status OlapScanner::_init_variant_columns() {
     auto& tablet_schema = _tablet_reader_params.tablet_schema;
     if (tablet_schema->num_variant_columns() == 0) {
@@ -595,17 +611,23 @@ void OlapScanner::update_realtime_counters() {
     _state->get_query_ctx()->resource_ctx()->io_context()->update_scan_rows(stats.raw_rows_read);
     _state->get_query_ctx()->resource_ctx()->io_context()->update_scan_bytes(
             stats.uncompressed_bytes_read);
+    _state->get_query_ctx()->resource_ctx()->io_context()->update_scan_bytes_from_page_cache(
+            stats.bytes_read_from_page_cache);
 
     // In case of no cache, we still need to update the IO stats. uncompressed bytes read == local + remote
     if (stats.file_cache_stats.bytes_read_from_local == 0 &&
         stats.file_cache_stats.bytes_read_from_remote == 0) {
         _state->get_query_ctx()->resource_ctx()->io_context()->update_scan_bytes_from_local_storage(
                 stats.compressed_bytes_read);
+        _state->get_query_ctx()->resource_ctx()->io_context()->update_scan_bytes_from_local_disk(
+                stats.compressed_bytes_read);
         DorisMetrics::instance()->query_scan_bytes_from_local->increment(
                 stats.compressed_bytes_read);
     } else {
         _state->get_query_ctx()->resource_ctx()->io_context()->update_scan_bytes_from_local_storage(
                 stats.file_cache_stats.bytes_read_from_local);
+        _state->get_query_ctx()->resource_ctx()->io_context()->update_scan_bytes_from_file_cache(
+                stats.file_cache_stats.bytes_read_from_local);
         _state->get_query_ctx()
                 ->resource_ctx()
                 ->io_context()
@@ -620,6 +642,7 @@ void OlapScanner::update_realtime_counters() {
     _tablet_reader->mutable_stats()->compressed_bytes_read = 0;
     _tablet_reader->mutable_stats()->uncompressed_bytes_read = 0;
     _tablet_reader->mutable_stats()->raw_rows_read = 0;
+    _tablet_reader->mutable_stats()->bytes_read_from_page_cache = 0;
     _tablet_reader->mutable_stats()->file_cache_stats.bytes_read_from_local = 0;
     _tablet_reader->mutable_stats()->file_cache_stats.bytes_read_from_remote = 0;
 }
@@ -639,6 +662,15 @@ void OlapScanner::_collect_profile_before_close() {
     auto& stats = _tablet_reader->stats();
     auto* local_state = (pipeline::OlapScanLocalState*)_local_state;
     COUNTER_UPDATE(local_state->_io_timer, stats.io_ns);
+    // Same rule as the scan bytes in `update_realtime_counters`: without file cache all io is
+    // on local disk.
+    auto* io_context = _state->get_query_ctx()->resource_ctx()->io_context();
+    if (stats.file_cache_stats.local_io_timer == 0 && stats.file_cache_stats.remote_io_timer == 0) {
+        io_context->update_scan_local_io_time(stats.io_ns);
+    } else {
+        io_context->update_scan_local_io_time(stats.file_cache_stats.local_io_timer);
+        io_context->update_scan_remote_io_time(stats.file_cache_stats.remote_io_timer);
+    }
     COUNTER_UPDATE(local_state->_read_compressed_counter, stats.compressed_bytes_read);
     COUNTER_UPDATE(local_state->_scan_bytes, stats.uncompressed_bytes_read);
     COUNTER_UPDATE(local_state->_decompressor_timer, stats.decompress_ns);
@@ -675,6 +707,7 @@ void OlapScanner::_collect_profile_before_close() {
     COUNTER_UPDATE(local_state->_lazy_read_timer, stats.lazy_read_ns);
     COUNTER_UPDATE(local_state->_lazy_read_seek_timer, stats.block_lazy_read_seek_ns);
     COUNTER_UPDATE(local_state->_lazy_read_seek_counter, stats.block_lazy_read_seek_num);
+    COUNTER_UPDATE(local_state->_lazy_read_range_counter, stats.block_lazy_read_range_num);
     COUNTER_UPDATE(local_state->_output_col_timer, stats.output_col_ns);
     COUNTER_UPDATE(local_state->_rows_vec_cond_filtered_counter, stats.rows_vec_cond_filtered);
     COUNTER_UPDATE(local_state->_rows_short_circuit_cond_filtered_counter,
@@ -95,6 +95,7 @@ private:
 
     [[nodiscard]] Status _init_return_columns();
     [[nodiscard]] Status _init_variant_columns();
+    bool _is_streaming_scan() const;
 
     std::vector<OlapScanRange*> _key_ranges;
 
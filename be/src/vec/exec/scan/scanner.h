@@ -130,11 +130,17 @@ public:
         _cpu_watch.start();
     }
 
-    void update_wait_worker_timer() { _scanner_wait_worker_timer += _watch.elapsed_time(); }
+    // Returns the wait time of this round.
+    int64_t update_wait_worker_timer() {
+        int64_t wait_time = _watch.elapsed_time();
+        _scanner_wait_worker_timer += wait_time;
+        return wait_time;
+    }
 
     int64_t get_scanner_wait_worker_timer() const { return _scanner_wait_worker_timer; }
 
-    void update_scan_cpu_timer();
+    // Returns the cpu time of this round.
+    int64_t update_scan_cpu_timer();
 
     // Some counters need to be updated realtime, for example, workload group policy need
     // scan bytes to cancel the query exceed limit.
@@ -22,6 +22,7 @@
 #include <glog/logging.h>
 #include <zconf.h>
 
+#include <algorithm>
 #include <cstdint>
 #include <ctime>
 #include <memory>
@@ -114,6 +115,7 @@ Status ScannerContext::init() {
         _scanner_scheduler = _state->get_query_ctx()->get_scan_scheduler();
     } else {
         _scanner_scheduler = _state->get_query_ctx()->get_remote_scan_scheduler();
+        _is_remote_scan = true;
     }
     if (auto* task_executor_scheduler =
                 dynamic_cast<TaskExecutorSimplifiedScanScheduler*>(_scanner_scheduler)) {
@@ -174,6 +176,7 @@ Status ScannerContext::init() {
     // becaue we found in a table with 5k columns, column reader may ocuppy too much memory.
     // you can refer https://github.com/apache/doris/issues/35340 for details.
     const int32_t max_column_reader_num = _state->max_column_reader_num();
+    bool column_reader_limited = false;
 
     if (_max_scan_concurrency != 1 && max_column_reader_num > 0) {
         int32_t scan_column_num = _output_tuple_desc->slots().size();
@@ -182,6 +185,7 @@ Status ScannerContext::init() {
             int32_t new_max_thread_num = max_column_reader_num / scan_column_num;
             new_max_thread_num = new_max_thread_num <= 0 ? 1 : new_max_thread_num;
             if (new_max_thread_num < _max_scan_concurrency) {
+                column_reader_limited = true;
                 int32_t origin_max_thread_num = _max_scan_concurrency;
                 _max_scan_concurrency = new_max_thread_num;
                 LOG(INFO) << "downgrade query:" << print_id(_state->query_id())
@@ -201,6 +205,16 @@ Status ScannerContext::init() {
     // Avoid corner case.
     _min_scan_concurrency = std::min(_min_scan_concurrency, _max_scan_concurrency);
 
+    // Io bound remote scans may use up to twice the scanners, unless the concurrency is fixed
+    // by the user, by the column reader limit or by a serial scan.
+    _max_adaptive_scan_concurrency = _max_scan_concurrency;
+    if (_is_remote_scan && _state->num_scanner_threads() == 0 && !column_reader_limited &&
+        !_local_state->should_run_serial()) {
+        _max_adaptive_scan_concurrency = std::min(_max_scan_concurrency * 2,
+                                                  (int32_t)_pending_scanners.size());
+    }
+    _last_adjust_concurrency_ns = MonotonicNanos();
+
     COUNTER_SET(_local_state->_max_scan_concurrency, (int64_t)_max_scan_concurrency);
     COUNTER_SET(_local_state->_min_scan_concurrency, (int64_t)_min_scan_concurrency);
 
@@ -292,6 +306,12 @@ void ScannerContext::push_back_scan_task(std::shared_ptr<ScanTask> scan_task) {
     }
     _tasks_queue.push_back(scan_task);
     _num_scheduled_scanners--;
+    if (scan_task->round_run_time_ns > 0) {
+        _scan_feedback.rounds++;
+        _scan_feedback.wait_worker_time_ns += scan_task->round_wait_worker_time_ns;
+        _scan_feedback.run_time_ns += scan_task->round_run_time_ns;
+        _scan_feedback.cpu_time_ns += scan_task->round_cpu_time_ns;
+    }
 
     _dependency->set_ready();
 }
@@ -317,6 +337,8 @@ Status ScannerContext::get_block_from_queue(RuntimeState* state, vectorized::Blo
         scan_task = _tasks_queue.front();
     }
 
+    _adjust_scan_concurrency();
+
     if (scan_task != nullptr) {
         // The abnormal status of scanner may come from the execution of the scanner itself,
         // or come from the scanner scheduler, such as TooManyTasks.
@@ -369,6 +391,9 @@ Status ScannerContext::get_block_from_queue(RuntimeState* state, vectorized::Blo
     *eos = done();
 
     if (_tasks_queue.empty()) {
+        if (!done()) {
+            _scan_feedback.consumer_starved++;
+        }
         _dependency->block();
     }
 
@@ -622,11 +647,11 @@ Status ScannerContext::schedule_scan_task(std::shared_ptr<ScanTask> current_scan
 
 std::shared_ptr<ScanTask> ScannerContext::_pull_next_scan_task(
         std::shared_ptr<ScanTask> current_scan_task, int32_t current_concurrency) {
-    if (current_concurrency >= _max_scan_concurrency) {
+    if (current_concurrency >= _current_max_scan_concurrency()) {
         VLOG_DEBUG << fmt::format(
                 "ScannerContext {} current concurrency {} >= _max_scan_concurrency {}, skip "
                 "pull",
-                ctx_id, current_concurrency, _max_scan_concurrency);
+                ctx_id, current_concurrency, _current_max_scan_concurrency());
         return nullptr;
     }
 
@@ -652,4 +677,53 @@ bool ScannerContext::low_memory_mode() const {
     return _local_state->low_memory_mode();
 }
 
+void ScannerContext::_adjust_scan_concurrency() {
+    if (!config::enable_adaptive_scan_concurrency ||
+        _max_adaptive_scan_concurrency <= _min_scan_concurrency || _scan_feedback.rounds == 0) {
+        return;
+    }
+    const int64_t now = MonotonicNanos();
+    if (now - _last_adjust_concurrency_ns <
+        config::adaptive_scan_concurrency_adjust_interval_ms * NANOS_PER_MILLIS) {
+        return;
+    }
+
+    const int32_t current = _current_max_scan_concurrency();
+    int32_t target = current;
+    const double memory_ratio =
+            static_cast<double>(_block_memory_usage) / static_cast<double>(_max_bytes_in_queue);
+    // Fraction of the scanner run time not spent on cpu, e.g. waiting for remote io.
+    const double io_wait_ratio =
+            _scan_feedback.run_time_ns > 0
+                    ? 1.0 - static_cast<double>(_scan_feedback.cpu_time_ns) /
+                                    static_cast<double>(_scan_feedback.run_time_ns)
+                    : 0;
+    // Scan tasks wait for a worker longer than they run, more scanners would only queue.
+    const bool scheduler_saturated =
+            _scan_feedback.wait_worker_time_ns > _scan_feedback.run_time_ns;
+
+    if (low_memory_mode() || memory_ratio > 0.8 ||
+        (_scan_feedback.consumer_starved == 0 && (int32_t)_tasks_queue.size() >= current)) {
+        // The consumer is slower than the scanners, ready blocks pile up.
+        target = current - std::max(1, current / 4);
+    } else if (_scan_feedback.consumer_starved > 0 && memory_ratio < 0.5 &&
+               !scheduler_saturated) {
+        // The consumer waits for blocks, io bound scanners scale up faster.
+        target = current + (io_wait_ratio > 0.5 ? std::max(1, current / 2) : 1);
+    }
+    target = std::clamp(target, _min_scan_concurrency, _max_adaptive_scan_concurrency);
+
+    if (target != current) {
+        VLOG_DEBUG << fmt::format(
+                "ScannerContext {} adjust scan concurrency {} -> {}, rounds {}, consumer "
+                "starved {}, ready tasks {}, memory ratio {:.2f}, io wait ratio {:.2f}",
+                ctx_id, current, target, _scan_feedback.rounds, _scan_feedback.consumer_starved,
+                _tasks_queue.size(), memory_ratio, io_wait_ratio);
+        _adaptive_scan_concurrency = target;
+        COUNTER_SET(_local_state->_adaptive_scan_concurrency, (int64_t)target);
+    }
+    _scan_feedback = {};
+    _last_adjust_concurrency_ns = now;
+}
+
 } // namespace doris::vectorized
@@ -91,6 +91,10 @@ public:
     // ScannerContext only needs to observe the lifetime of SplitRunner without owning it.
     // When SplitRunner is destroyed, split_runner.lock() will return nullptr, ensuring safe access.
     std::weak_ptr<SplitRunner> split_runner;
+    // Timing of the latest round, fed back to the adaptive scan concurrency.
+    int64_t round_wait_worker_time_ns = 0;
+    int64_t round_run_time_ns = 0;
+    int64_t round_cpu_time_ns = 0;
 
     void set_status(Status _status) {
         if (_status.is<ErrorCode::END_OF_FILE>()) {
@@ -264,7 +268,30 @@ protected:
     int32_t _get_margin(std::unique_lock<std::mutex>& transfer_lock,
                         std::unique_lock<std::shared_mutex>& scheduler_lock);
 
-    // TODO: Add implementation of runtime_info_feed_back
+    // Feedback controller of the running scanner count, bounded by
+    // [_min_scan_concurrency, _max_adaptive_scan_concurrency]. 0 means not adjusted yet, so
+    // _max_scan_concurrency is used.
+    int32_t _adaptive_scan_concurrency = 0;
+    // Remote scans are usually io bound, so they may go beyond _max_scan_concurrency.
+    int32_t _max_adaptive_scan_concurrency = 0;
+    bool _is_remote_scan = false;
+    struct ScanFeedback {
+        int64_t rounds = 0;
+        int64_t wait_worker_time_ns = 0;
+        int64_t run_time_ns = 0;
+        int64_t cpu_time_ns = 0;
+        // Times the consumer found no ready block.
+        int64_t consumer_starved = 0;
+    };
+    ScanFeedback _scan_feedback;
+    int64_t _last_adjust_concurrency_ns = 0;
+
+    int32_t _current_max_scan_concurrency() const {
+        return _adaptive_scan_concurrency > 0 ? _adaptive_scan_concurrency
+                                              : _max_scan_concurrency;
+    }
+    // Must be called with _transfer_lock held.
+    void _adjust_scan_concurrency();
     // adaptive scan concurrency related end
 };
 } // namespace vectorized
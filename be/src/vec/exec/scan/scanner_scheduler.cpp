@@ -175,7 +175,7 @@ void ScannerScheduler::_scanner_scan(std::shared_ptr<ScannerContext> ctx,
 #endif
     MonotonicStopWatch max_run_time_watch;
     max_run_time_watch.start();
-    scanner->update_wait_worker_timer();
+    scan_task->round_wait_worker_time_ns = scanner->update_wait_worker_timer();
     scanner->start_scan_cpu_timer();
     Status status = Status::OK();
     bool eos = false;
@@ -335,7 +335,8 @@ void ScannerScheduler::_scanner_scan(std::shared_ptr<ScannerContext> ctx,
     }
     // WorkloadGroup Policy will check cputime realtime, so that should update the counter
     // as soon as possible, could not update it on close.
-    scanner->update_scan_cpu_timer();
+    scan_task->round_cpu_time_ns = scanner->update_scan_cpu_timer();
+    scan_task->round_run_time_ns = max_run_time_watch.elapsed_time();
     scanner->update_realtime_counters();
 
     if (eos) {
@@ -24,6 +24,74 @@ namespace doris::vectorized {
 
 using apache::thrift::transport::TTransportException;
 
+static bool is_splittable_range(const TFileRangeDesc& range) {
+    if (!range.__isset.format_type || (range.format_type != TFileFormatType::FORMAT_PARQUET &&
+                                       range.format_type != TFileFormatType::FORMAT_ORC)) {
+        return false;
+    }
+    // Transactional and merge on read formats need to see the whole file
+    if (range.__isset.table_format_params) {
+        const auto& table_format = range.table_format_params.table_format_type;
+        if (table_format != "hive" && table_format != "iceberg" && table_format != "tvf") {
+            return false;
+        }
+    }
+    return range.start_offset >= 0 && range.size > 0;
+}
+
+std::vector<TScanRangeParams> LocalSplitSourceConnector::_split_large_ranges(
+        const std::vector<TScanRangeParams>& scan_ranges, int max_scanners) {
+    int64_t split_size = config::file_scan_split_size_mb * 1024 * 1024;
+    size_t num_ranges = 0;
+    for (const auto& scan_range : scan_ranges) {
+        num_ranges += scan_range.scan_range.ext_scan_range.file_scan_range.ranges.size();
+    }
+    if (split_size <= 0 || max_scanners <= 0 || num_ranges >= static_cast<size_t>(max_scanners)) {
+        return scan_ranges;
+    }
+
+    size_t num_extra_ranges = max_scanners - num_ranges;
+    size_t num_split_ranges = 0;
+    std::vector<TScanRangeParams> split_ranges;
+    for (const auto& scan_range : scan_ranges) {
+        split_ranges.push_back(scan_range);
+        auto& ranges = split_ranges.back().scan_range.ext_scan_range.file_scan_range.ranges;
+        std::vector<TFileRangeDesc> pieces;
+        for (auto it = ranges.begin(); it != ranges.end() && num_extra_ranges > 0;) {
+            if (!is_splittable_range(*it) || it->size < 2 * split_size) {
+                ++it;
+                continue;
+            }
+            auto num_pieces = std::min<int64_t>(it->size / split_size,
+                                                static_cast<int64_t>(num_extra_ranges) + 1);
+            int64_t piece_size = it->size / num_pieces;
+            for (int64_t i = 0; i < num_pieces; ++i) {
+                TFileRangeDesc piece = *it;
+                piece.__set_start_offset(it->start_offset + i * piece_size);
+                piece.__set_size(i + 1 == num_pieces ? it->size - i * piece_size : piece_size);
+                pieces.push_back(std::move(piece));
+            }
+            num_extra_ranges -= num_pieces - 1;
+            ++num_split_ranges;
+            it = ranges.erase(it);
+        }
+        if (ranges.empty()) {
+            split_ranges.pop_back();
+        }
+        // Each piece gets its own scan range so that it can be picked by any scanner
+        for (auto& piece : pieces) {
+            split_ranges.push_back(scan_range);
+            split_ranges.back().scan_range.ext_scan_range.file_scan_range.ranges = {
+                    std::move(piece)};
+        }
+    }
+    if (num_split_ranges > 0) {
+        LOG(INFO) << "Split " << num_split_ranges << " large file ranges, " << num_ranges
+                  << " ranges to " << num_ranges + (max_scanners - num_ranges - num_extra_ranges);
+    }
+    return split_ranges;
+}
+
 Status LocalSplitSourceConnector::get_next(bool* has_next, TFileRangeDesc* range) {
     std::lock_guard<std::mutex> l(_range_lock);
     *has_next = false;
@@ -101,10 +101,17 @@ private:
     int _scan_index = 0;
     int _range_index = 0;
 
+    // Split parquet/orc ranges larger than config::file_scan_split_size_mb into byte ranges, as
+    // long as there are fewer ranges than scanners. Parquet and orc readers assign each row
+    // group or stripe to exactly one byte range, so the pieces never overlap.
+    static std::vector<TScanRangeParams> _split_large_ranges(
+            const std::vector<TScanRangeParams>& scan_ranges, int max_scanners);
+
 public:
     LocalSplitSourceConnector(const std::vector<TScanRangeParams>& scan_ranges, int max_scanners) {
         _max_scanners = max_scanners;
-        _merge_ranges<TScanRangeParams>(_scan_ranges, scan_ranges);
+        _merge_ranges<TScanRangeParams>(_scan_ranges,
+                                        _split_large_ranges(scan_ranges, max_scanners));
     }
 
     Status get_next(bool* has_next, TFileRangeDesc* range) override;
@@ -78,6 +78,11 @@ Status JdbcConnector::close(Status /*unused*/) {
     RETURN_IF_ERROR(JniUtil::GetJNIEnv(&env));
     env->CallNonvirtualVoidMethod(_executor_obj, _executor_clazz, _executor_close_id);
     RETURN_ERROR_IF_EXC(env);
+    if (_reader_params != nullptr) {
+        env->DeleteGlobalRef(_reader_params);
+        _reader_params = nullptr;
+        RETURN_ERROR_IF_EXC(env);
+    }
     env->DeleteGlobalRef(_executor_factory_clazz);
     RETURN_ERROR_IF_EXC(env);
     env->DeleteGlobalRef(_executor_clazz);
@@ -259,10 +264,14 @@ Status JdbcConnector::get_next(bool* eos, Block* block, int batch_size) {
     auto column_size = _tuple_desc->slots().size();
     auto slots = _tuple_desc->slots();
 
-    jobject map = nullptr;
     {
         SCOPED_RAW_TIMER(&_jdbc_statistic._prepare_params_timer); // Timer for preparing params
-        RETURN_IF_ERROR(_get_reader_params(block, env, column_size, &map));
+        // the params only depend on the tuple descriptor, so they are built for the first batch
+        // and passed to every later one
+        if (_reader_params == nullptr) {
+            RETURN_IF_ERROR(_get_reader_params(env, column_size, &_reader_params));
+        }
+        _replace_special_columns_with_string(block, column_size);
     } // _prepare_params_timer stops here
 
     long address = 0;
@@ -270,13 +279,11 @@ Status JdbcConnector::get_next(bool* eos, Block* block, int batch_size) {
         SCOPED_RAW_TIMER(
                 &_jdbc_statistic
                          ._read_and_fill_vector_table_timer); // Timer for getBlockAddress call
-        address =
-                env->CallLongMethod(_executor_obj, _executor_get_block_address_id, batch_size, map);
+        address = env->CallLongMethod(_executor_obj, _executor_get_block_address_id, batch_size,
+                                      _reader_params);
     } // _get_block_address_timer stops here
 
     RETURN_IF_ERROR(JniUtil::GetJniExceptionMsg(env));
-    env->DeleteGlobalRef(map);
-    RETURN_ERROR_IF_EXC(env);
 
     std::vector<uint32_t> all_columns;
     for (uint32_t i = 0; i < column_size; ++i) {
@@ -410,8 +417,28 @@ Status JdbcConnector::_register_func_id(JNIEnv* env) {
     return Status::OK();
 }
 
-Status JdbcConnector::_get_reader_params(Block* block, JNIEnv* env, size_t column_size,
-                                         jobject* ans) {
+void JdbcConnector::_replace_special_columns_with_string(Block* block, size_t column_size) {
+    if (!_has_special_columns) {
+        return;
+    }
+    for (size_t i = 0; i < column_size; ++i) {
+        auto* slot = _tuple_desc->slots()[i];
+        if (!slot->is_materialized() || !_is_special_type(slot->type()->get_primitive_type())) {
+            continue;
+        }
+        // the java side returns these columns as strings, which are cast back after reading
+        block->get_by_position(i).column = std::make_shared<DataTypeString>()
+                                                   ->create_column()
+                                                   ->convert_to_full_column_if_const();
+        block->get_by_position(i).type = std::make_shared<DataTypeString>();
+        if (slot->is_nullable()) {
+            block->get_by_position(i).column = make_nullable(block->get_by_position(i).column);
+            block->get_by_position(i).type = make_nullable(block->get_by_position(i).type);
+        }
+    }
+}
+
+Status JdbcConnector::_get_reader_params(JNIEnv* env, size_t column_size, jobject* ans) {
     std::ostringstream columns_nullable;
     std::ostringstream columns_replace_string;
     std::ostringstream required_fields;
@@ -433,24 +460,12 @@ Status JdbcConnector::_get_reader_params(Block* block, JNIEnv* env, size_t colum
                 replace_type = "jsonb";
             }
             columns_replace_string << replace_type << ",";
-            if (replace_type != "not_replace") {
-                block->get_by_position(i).column = std::make_shared<DataTypeString>()
-                                                           ->create_column()
-                                                           ->convert_to_full_column_if_const();
-                block->get_by_position(i).type = std::make_shared<DataTypeString>();
-                if (slot->is_nullable()) {
-                    block->get_by_position(i).column =
-                            make_nullable(block->get_by_position(i).column);
-                    block->get_by_position(i).type = make_nullable(block->get_by_position(i).type);
-                }
-            }
+            _has_special_columns |= replace_type != "not_replace";
         }
         // Record required fields and column types
         std::string field = slot->col_name();
         std::string jni_type;
-        if (slot->type()->get_primitive_type() == PrimitiveType::TYPE_BITMAP ||
-            slot->type()->get_primitive_type() == PrimitiveType::TYPE_HLL ||
-            slot->type()->get_primitive_type() == PrimitiveType::TYPE_JSONB) {
+        if (_is_special_type(slot->type()->get_primitive_type())) {
             jni_type = "string";
         } else {
             jni_type = JniConnector::get_jni_type_with_different_string(slot->type());
@@ -467,16 +482,19 @@ Status JdbcConnector::_get_reader_params(Block* block, JNIEnv* env, size_t colum
 }
 
 Status JdbcConnector::_cast_string_to_special(Block* block, JNIEnv* env, size_t column_size) {
+    if (!_has_special_columns) {
+        return Status::OK();
+    }
+    jint num_rows =
+            env->CallNonvirtualIntMethod(_executor_obj, _executor_clazz, _executor_block_rows_id);
+    RETURN_IF_ERROR(JniUtil::GetJniExceptionMsg(env));
+
     for (size_t column_index = 0; column_index < column_size; ++column_index) {
         auto* slot_desc = _tuple_desc->slots()[column_index];
         // because the fe planner filter the non_materialize column
         if (!slot_desc->is_materialized()) {
             continue;
         }
-        jint num_rows = env->CallNonvirtualIntMethod(_executor_obj, _executor_clazz,
-                                                     _executor_block_rows_id);
-
-        RETURN_IF_ERROR(JniUtil::GetJniExceptionMsg(env));
 
         if (slot_desc->type()->get_primitive_type() == PrimitiveType::TYPE_HLL) {
             RETURN_IF_ERROR(_cast_string_to_hll(slot_desc, block, column_index, num_rows));
@@ -491,11 +509,14 @@ Status JdbcConnector::_cast_string_to_special(Block* block, JNIEnv* env, size_t
 
 Status JdbcConnector::_cast_string_to_hll(const SlotDescriptor* slot_desc, Block* block,
                                           int column_index, int rows) {
-    _map_column_idx_to_cast_idx_hll[column_index] = _input_hll_string_types.size();
-    if (slot_desc->is_nullable()) {
-        _input_hll_string_types.push_back(make_nullable(std::make_shared<DataTypeString>()));
-    } else {
-        _input_hll_string_types.push_back(std::make_shared<DataTypeString>());
+    // the input type of a column is the same for every batch
+    if (!_map_column_idx_to_cast_idx_hll.contains(column_index)) {
+        _map_column_idx_to_cast_idx_hll[column_index] = _input_hll_string_types.size();
+        if (slot_desc->is_nullable()) {
+            _input_hll_string_types.push_back(make_nullable(std::make_shared<DataTypeString>()));
+        } else {
+            _input_hll_string_types.push_back(std::make_shared<DataTypeString>());
+        }
     }
 
     DataTypePtr _target_data_type = slot_desc->get_data_type_ptr();
@@ -535,11 +556,14 @@ Status JdbcConnector::_cast_string_to_hll(const SlotDescriptor* slot_desc, Block
 
 Status JdbcConnector::_cast_string_to_bitmap(const SlotDescriptor* slot_desc, Block* block,
                                              int column_index, int rows) {
-    _map_column_idx_to_cast_idx_bitmap[column_index] = _input_bitmap_string_types.size();
-    if (slot_desc->is_nullable()) {
-        _input_bitmap_string_types.push_back(make_nullable(std::make_shared<DataTypeString>()));
-    } else {
-        _input_bitmap_string_types.push_back(std::make_shared<DataTypeString>());
+    // the input type of a column is the same for every batch
+    if (!_map_column_idx_to_cast_idx_bitmap.contains(column_index)) {
+        _map_column_idx_to_cast_idx_bitmap[column_index] = _input_bitmap_string_types.size();
+        if (slot_desc->is_nullable()) {
+            _input_bitmap_string_types.push_back(make_nullable(std::make_shared<DataTypeString>()));
+        } else {
+            _input_bitmap_string_types.push_back(std::make_shared<DataTypeString>());
+        }
     }
 
     DataTypePtr _target_data_type = slot_desc->get_data_type_ptr();
@@ -580,11 +604,14 @@ Status JdbcConnector::_cast_string_to_bitmap(const SlotDescriptor* slot_desc, Bl
 // Deprecated, this code is retained only for compatibility with query problems that may be encountered when upgrading the version that maps JSON to JSONB to this version, and will be deleted in subsequent versions.
 Status JdbcConnector::_cast_string_to_json(const SlotDescriptor* slot_desc, Block* block,
                                            int column_index, int rows) {
-    _map_column_idx_to_cast_idx_json[column_index] = _input_json_string_types.size();
-    if (slot_desc->is_nullable()) {
-        _input_json_string_types.push_back(make_nullable(std::make_shared<DataTypeString>()));
-    } else {
-        _input_json_string_types.push_back(std::make_shared<DataTypeString>());
+    // the input type of a column is the same for every batch
+    if (!_map_column_idx_to_cast_idx_json.contains(column_index)) {
+        _map_column_idx_to_cast_idx_json[column_index] = _input_json_string_types.size();
+        if (slot_desc->is_nullable()) {
+            _input_json_string_types.push_back(make_nullable(std::make_shared<DataTypeString>()));
+        } else {
+            _input_json_string_types.push_back(std::make_shared<DataTypeString>());
+        }
     }
     DataTypePtr _target_data_type = slot_desc->get_data_type_ptr();
     std::string _target_data_type_name = _target_data_type->get_name();
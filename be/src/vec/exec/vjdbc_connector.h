@@ -128,7 +128,13 @@ protected:
 private:
     Status _register_func_id(JNIEnv* env);
 
-    Status _get_reader_params(Block* block, JNIEnv* env, size_t column_size, jobject* ans);
+    Status _get_reader_params(JNIEnv* env, size_t column_size, jobject* ans);
+    // Bitmap, hll and jsonb columns are read as strings and cast back after reading.
+    static bool _is_special_type(PrimitiveType type) {
+        return type == PrimitiveType::TYPE_BITMAP || type == PrimitiveType::TYPE_HLL ||
+               type == PrimitiveType::TYPE_JSONB;
+    }
+    void _replace_special_columns_with_string(Block* block, size_t column_size);
 
     Status _cast_string_to_special(Block* block, JNIEnv* env, size_t column_size);
     Status _cast_string_to_hll(const SlotDescriptor* slot_desc, Block* block, int column_index,
@@ -161,6 +167,10 @@ private:
     jmethodID _executor_abort_trans_id;
     jmethodID _executor_test_connection_id;
     jmethodID _executor_clean_datasource_id;
+    // Global ref to the java map of reader params, shared by all batches of the scan.
+    jobject _reader_params = nullptr;
+    // Whether any materialized column is read as a string and cast back, see _is_special_type.
+    bool _has_special_columns = false;
 
     std::map<int, int> _map_column_idx_to_cast_idx_hll;
     std::vector<DataTypePtr> _input_hll_string_types;
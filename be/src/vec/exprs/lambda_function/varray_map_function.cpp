@@ -58,8 +58,8 @@ struct LambdaArgs {
     int64_t cur_size = 0;
     // offset of column array
     const ColumnArray::Offsets64* offsets_ptr = nullptr;
-    // expend data of repeat times
-    int current_repeat_times = 0;
+    // for every lambda row, the row of the original block it was expanded from
+    PaddedPODArray<uint32_t> replicate_indices;
     // whether the current row of the original block has been extended
     bool current_row_eos = false;
 };
@@ -222,6 +222,108 @@ public:
         DataTypePtr res_type;
         std::string res_name;
 
+        if (output_slot_ref_indexs.empty()) {
+            // the lambda only reads array elements, so evaluate it on slices of the nested
+            // columns without expanding the outer rows.
+            RETURN_IF_ERROR(_execute_on_nested_columns(context, children[0], lambda_datas, names,
+                                                       data_types, result_column_id, result_col,
+                                                       res_type, res_name));
+        } else {
+            RETURN_IF_ERROR(_execute_in_batches(context, block, children[0], args_info,
+                                                lambda_datas, names, data_types, gap,
+                                                result_column_id, result_col, res_type, res_name));
+        }
+
+        //4. get the result column after execution, reassemble it into a new array column, and return.
+        if (result_type->is_nullable()) {
+            if (res_type->is_nullable()) {
+                result_arr = {
+                        ColumnNullable::create(ColumnArray::create(std::move(result_col),
+                                                                   std::move(array_column_offset)),
+                                               std::move(outside_null_map)),
+                        result_type, res_name};
+            } else {
+                // deal with eg: select array_map(x -> x is null, [null, 1, 2]);
+                // need to create the nested column null map for column array
+                auto nested_null_map = ColumnUInt8::create(result_col->size(), 0);
+                result_arr = {ColumnNullable::create(
+                                      ColumnArray::create(
+                                              ColumnNullable::create(std::move(result_col),
+                                                                     std::move(nested_null_map)),
+                                              std::move(array_column_offset)),
+                                      std::move(outside_null_map)),
+                              result_type, res_name};
+            }
+        } else {
+            if (res_type->is_nullable()) {
+                result_arr = {
+                        ColumnArray::create(std::move(result_col), std::move(array_column_offset)),
+                        result_type, res_name};
+            } else {
+                auto nested_null_map = ColumnUInt8::create(result_col->size(), 0);
+                result_arr = {
+                        ColumnArray::create(ColumnNullable::create(std::move(result_col),
+                                                                   std::move(nested_null_map)),
+                                            std::move(array_column_offset)),
+                        result_type, res_name};
+            }
+        }
+        block->insert(std::move(result_arr));
+        *result_column_id = block->columns() - 1;
+
+        return Status::OK();
+    }
+
+private:
+    Status _execute_on_nested_columns(VExprContext* context, const VExprSPtr& lambda_expr,
+                                      const std::vector<ColumnPtr>& lambda_datas,
+                                      const std::vector<std::string>& names,
+                                      const DataTypes& data_types, int* result_column_id,
+                                      MutableColumnPtr& result_col, DataTypePtr& res_type,
+                                      std::string& res_name) {
+        const size_t rows = lambda_datas[0]->size();
+        const auto step = static_cast<size_t>(std::max(batch_size, 1));
+        // batch_size of array nested data every time inorder to avoid memory overflow
+        for (size_t pos = 0; pos < rows; pos += step) {
+            const size_t length = std::min(step, rows - pos);
+            Block lambda_block;
+            for (size_t i = 0; i < lambda_datas.size(); ++i) {
+                lambda_block.insert({length == rows ? lambda_datas[i]
+                                                    : lambda_datas[i]->cut(pos, length),
+                                     data_types[i], names[i]});
+            }
+            RETURN_IF_ERROR(lambda_expr->execute(context, &lambda_block, result_column_id));
+
+            const auto& res = lambda_block.get_by_position(*result_column_id);
+            res_type = res.type;
+            res_name = res.name;
+            ColumnPtr res_col = res.column->convert_to_full_column_if_const();
+            lambda_block.clear();
+            if (length == rows) {
+                // only copies when the result is still shared, e.g. x -> x
+                result_col = IColumn::mutate(std::move(res_col));
+            } else {
+                if (!result_col) {
+                    result_col = res_col->clone_empty();
+                }
+                result_col->insert_range_from(*res_col, 0, res_col->size());
+            }
+        }
+        return Status::OK();
+    }
+
+    Status _execute_in_batches(VExprContext* context, Block* block, const VExprSPtr& lambda_expr,
+                               LambdaArgs& args_info, const std::vector<ColumnPtr>& lambda_datas,
+                               const std::vector<std::string>& names, const DataTypes& data_types,
+                               int gap, int* result_column_id, MutableColumnPtr& result_col,
+                               DataTypePtr& res_type, std::string& res_name) {
+        const auto& output_slot_ref_indexs = args_info.output_slot_ref_indexs;
+        // captured columns keep their original form, const ones are never materialized
+        Columns captured_columns(gap);
+        for (int i : output_slot_ref_indexs) {
+            captured_columns[i] = block->get_by_position(i).column;
+        }
+
         //process first row
         args_info.array_start = (*args_info.offsets_ptr)[args_info.current_row_idx - 1];
         args_info.cur_size =
@@ -236,16 +338,16 @@ public:
             for (int i = 0; i < column_size; i++) {
                 if (mem_reuse) {
                     columns[i] = lambda_block.get_by_position(i).column->assume_mutable();
+                } else if (i >= gap) {
+                    columns[i] = data_types[i]->create_column();
+                } else if (captured_columns[i] && !is_column_const(*captured_columns[i])) {
+                    columns[i] = data_types[i]->create_column();
+                } else if (captured_columns[i]) {
+                    columns[i] = captured_columns[i]->clone_resized(0);
                 } else {
-                    if (_contains_column_id(output_slot_ref_indexs, i) || i >= gap) {
-                        // TODO: maybe could create const column, so not insert_many_from when extand data
-                        // but now here handle batch_size of array nested data every time, so maybe have different rows
-                        columns[i] = data_types[i]->create_column();
-                    } else {
-                        columns[i] = data_types[i]
-                                             ->create_column_const_with_default_value(0)
-                                             ->assume_mutable();
-                    }
+                    columns[i] = data_types[i]
+                                         ->create_column_const_with_default_value(0)
+                                         ->assume_mutable();
                 }
             }
             // batch_size of array nested data every time inorder to avoid memory overflow
@@ -254,17 +356,16 @@ public:
                 long current_step = std::min(
                         max_step, (long)(args_info.cur_size - args_info.current_offset_in_array));
                 size_t pos = args_info.array_start + args_info.current_offset_in_array;
-                for (int i = 0; i < arguments.size() && current_step > 0; ++i) {
+                for (int i = 0; i < lambda_datas.size() && current_step > 0; ++i) {
                     columns[gap + i]->insert_range_from(*lambda_datas[i], pos, current_step);
                 }
                 args_info.current_offset_in_array += current_step;
-                args_info.current_repeat_times += current_step;
+                args_info.replicate_indices.resize_fill(
+                        args_info.replicate_indices.size() + current_step,
+                        static_cast<uint32_t>(args_info.current_row_idx));
                 if (args_info.current_offset_in_array >= args_info.cur_size) {
                     args_info.current_row_eos = true;
                 }
-                _extend_data(columns, block, args_info.current_repeat_times, gap,
-                             args_info.current_row_idx, output_slot_ref_indexs);
-                args_info.current_repeat_times = 0;
                 if (args_info.current_row_eos) {
                     //current row is end of array, move to next row
                     args_info.current_row_idx++;
@@ -278,6 +379,8 @@ public:
                                          args_info.array_start;
                 }
             }
+            _extend_data(columns, captured_columns, args_info.replicate_indices, gap);
+            args_info.replicate_indices.clear();
 
             if (!mem_reuse) {
                 for (int i = 0; i < column_size; ++i) {
@@ -286,7 +389,7 @@ public:
                 }
             }
             //3. child[0]->execute(new_block)
-            RETURN_IF_ERROR(children[0]->execute(context, &lambda_block, result_column_id));
+            RETURN_IF_ERROR(lambda_expr->execute(context, &lambda_block, result_column_id));
 
             auto res_col = lambda_block.get_by_position(*result_column_id)
                                    .column->convert_to_full_column_if_const();
@@ -298,48 +401,9 @@ public:
             result_col->insert_range_from(*res_col, 0, res_col->size());
             lambda_block.clear_column_data(column_size);
         } while (args_info.current_row_idx < block->rows());
-
-        //4. get the result column after execution, reassemble it into a new array column, and return.
-        if (result_type->is_nullable()) {
-            if (res_type->is_nullable()) {
-                result_arr = {
-                        ColumnNullable::create(ColumnArray::create(std::move(result_col),
-                                                                   std::move(array_column_offset)),
-                                               std::move(outside_null_map)),
-                        result_type, res_name};
-            } else {
-                // deal with eg: select array_map(x -> x is null, [null, 1, 2]);
-                // need to create the nested column null map for column array
-                auto nested_null_map = ColumnUInt8::create(result_col->size(), 0);
-                result_arr = {ColumnNullable::create(
-                                      ColumnArray::create(
-                                              ColumnNullable::create(std::move(result_col),
-                                                                     std::move(nested_null_map)),
-                                              std::move(array_column_offset)),
-                                      std::move(outside_null_map)),
-                              result_type, res_name};
-            }
-        } else {
-            if (res_type->is_nullable()) {
-                result_arr = {
-                        ColumnArray::create(std::move(result_col), std::move(array_column_offset)),
-                        result_type, res_name};
-            } else {
-                auto nested_null_map = ColumnUInt8::create(result_col->size(), 0);
-                result_arr = {
-                        ColumnArray::create(ColumnNullable::create(std::move(result_col),
-                                                                   std::move(nested_null_map)),
-                                            std::move(array_column_offset)),
-                        result_type, res_name};
-            }
-        }
-        block->insert(std::move(result_arr));
-        *result_column_id = block->columns() - 1;
-
         return Status::OK();
     }
 
-private:
     bool _contains_column_id(const std::vector<int>& output_slot_ref_indexs, int id) {
         const auto it = std::find(output_slot_ref_indexs.begin(), output_slot_ref_indexs.end(), id);
         return it != output_slot_ref_indexs.end();
@@ -367,21 +431,20 @@ private:
         }
     }
 
-    void _extend_data(std::vector<MutableColumnPtr>& columns, Block* block,
-                      int current_repeat_times, int size, int64_t current_row_idx,
-                      const std::vector<int>& output_slot_ref_indexs) {
-        if (!current_repeat_times || !size) {
+    // broadcast the outer row of every lambda row with one call per captured column
+    void _extend_data(std::vector<MutableColumnPtr>& columns, const Columns& captured_columns,
+                      const PaddedPODArray<uint32_t>& replicate_indices, int size) {
+        if (replicate_indices.empty() || !size) {
             return;
         }
         for (int i = 0; i < size; i++) {
-            if (_contains_column_id(output_slot_ref_indexs, i)) {
-                auto src_column =
-                        block->get_by_position(i).column->convert_to_full_column_if_const();
-                columns[i]->insert_many_from(*src_column, current_row_idx, current_repeat_times);
+            if (captured_columns[i] && !is_column_const(*captured_columns[i])) {
+                columns[i]->insert_indices_from(*captured_columns[i], replicate_indices.begin(),
+                                                replicate_indices.end());
             } else {
                 // must be column const
                 DCHECK(is_column_const(*columns[i]));
-                columns[i]->resize(columns[i]->size() + current_repeat_times);
+                columns[i]->resize(columns[i]->size() + replicate_indices.size());
             }
         }
     }
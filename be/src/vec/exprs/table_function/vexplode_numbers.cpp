@@ -49,7 +49,19 @@ Status VExplodeNumbersTableFunction::process_init(Block* block, RuntimeState* st
     RETURN_IF_ERROR(_expr_context->root()->children()[0]->execute(_expr_context.get(), block,
                                                                   &value_column_idx));
     _value_column = block->get_by_position(value_column_idx).column;
-    if (is_column_const(*_value_column)) {
+    _value_is_const = is_column_const(*_value_column);
+    const IColumn* value_data_column =
+            _value_is_const
+                    ? assert_cast<const ColumnConst&>(*_value_column).get_data_column_ptr().get()
+                    : _value_column.get();
+    _value_null_map = nullptr;
+    if (value_data_column->is_nullable()) {
+        const auto& nullable_column = assert_cast<const ColumnNullable&>(*value_data_column);
+        _value_null_map = nullable_column.get_null_map_data().data();
+        value_data_column = &nullable_column.get_nested_column();
+    }
+    _value_data = assert_cast<const ColumnInt32&>(*value_data_column).get_data().data();
+    if (_value_is_const) {
         _cur_size = 0;
 
         // the argument columns -> Int32
@@ -87,14 +99,16 @@ void VExplodeNumbersTableFunction::process_row(size_t row_idx) {
         return;
     }
 
-    StringRef value = _value_column->get_data_at(row_idx);
-    if (value.data != nullptr) {
-        _cur_size = std::max(0, *reinterpret_cast<const int*>(value.data));
+    size_t value_idx = _value_is_const ? 0 : row_idx;
+    if (_value_null_map == nullptr || !_value_null_map[value_idx]) {
+        _cur_size = std::max(0, _value_data[value_idx]);
     }
 }
 
 void VExplodeNumbersTableFunction::process_close() {
     _value_column = nullptr;
+    _value_data = nullptr;
+    _value_null_map = nullptr;
 }
 
 void VExplodeNumbersTableFunction::get_same_many_values(MutableColumnPtr& column, int length) {
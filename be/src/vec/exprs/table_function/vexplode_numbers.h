@@ -86,6 +86,11 @@ public:
 
 private:
     ColumnPtr _value_column;
+    // Raw values and null map of _value_column, read by process_row without virtual calls.
+    // A const column which is too large for the const optimize reads its value at row 0.
+    const int32_t* _value_data = nullptr;
+    const uint8_t* _value_null_map = nullptr;
+    bool _value_is_const = false;
     ColumnPtr _elements_column = ColumnInt32::create();
 };
 
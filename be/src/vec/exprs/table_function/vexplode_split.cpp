@@ -20,7 +20,7 @@
 #include <glog/logging.h>
 
 #include <algorithm>
-#include <iterator>
+#include <cstring>
 #include <ostream>
 
 #include "common/status.h"
@@ -88,37 +88,35 @@ void VExplodeSplitTableFunction::process_row(size_t row_idx) {
     TableFunction::process_row(row_idx);
 
     if (!(_test_null_map && _test_null_map[row_idx]) && _delimiter.data != nullptr) {
-        // TODO: use the function to be better string_view/StringRef split
-        auto split = [](std::string_view strv, std::string_view delims = " ") {
-            std::vector<StringRef> output;
-            const auto* first = strv.begin();
-            const auto* last = strv.end();
-
-            do {
-                const auto* second =
-                        std::search(first, last, std::cbegin(delims), std::cend(delims));
-                if (first != second) {
-                    auto view = strv.substr(std::distance(strv.begin(), first),
-                                            std::distance(first, second));
-                    output.emplace_back(view.data(), view.length());
-                } else {
-                    output.emplace_back("", 0);
-                }
-                first = std::next(second, delims.size());
-
-                if (second == last) {
-                    break;
-                }
-            } while (first != last);
-
-            return output;
-        };
-        _backup = split(_real_text_column->get_data_at(row_idx), _delimiter);
-
+        _split(_real_text_column->get_data_at(row_idx));
         _cur_size = _backup.size();
     }
 }
 
+void VExplodeSplitTableFunction::_split(StringRef text) {
+    // reuse the buffer of the previous row, rows are split one after another
+    _backup.clear();
+    const char* first = text.data;
+    const char* last = text.data + text.size;
+    do {
+        const char* second = nullptr;
+        if (_delimiter.size == 1) {
+            second = static_cast<const char*>(
+                    memchr(first, _delimiter.data[0], static_cast<size_t>(last - first)));
+            if (second == nullptr) {
+                second = last;
+            }
+        } else {
+            second = std::search(first, last, _delimiter.data, _delimiter.data + _delimiter.size);
+        }
+        _backup.emplace_back(first, static_cast<size_t>(second - first));
+        if (second == last) {
+            break;
+        }
+        first = second + _delimiter.size;
+    } while (first != last);
+}
+
 void VExplodeSplitTableFunction::process_close() {
     _text_column = nullptr;
     _real_text_column = nullptr;
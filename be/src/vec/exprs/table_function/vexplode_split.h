@@ -49,6 +49,9 @@ public:
     int get_value(MutableColumnPtr& column, int max_step) override;
 
 private:
+    // Splits text by _delimiter into _backup. A trailing delimiter yields no empty element.
+    void _split(StringRef text);
+
     std::vector<StringRef> _backup;
 
     ColumnPtr _text_column;
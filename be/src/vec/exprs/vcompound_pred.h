@@ -56,6 +56,10 @@ public:
     const std::string& expr_name() const override { return _expr_name; }
 
     Status evaluate_inverted_index(VExprContext* context, uint32_t segment_num_rows) override {
+        segment_v2::InvertedIndexQueryCache::CacheKey cache_key;
+        if (_lookup_inverted_index_cache(context, &cache_key)) {
+            return Status::OK();
+        }
         segment_v2::InvertedIndexResultBitmap res;
         bool all_pass = true;
 
@@ -145,11 +149,18 @@ public:
         }
 
         if (all_pass && !res.is_empty()) {
+            _insert_inverted_index_cache(cache_key, res);
             context->get_inverted_index_context()->set_inverted_index_result_for_expr(this, res);
         }
         return Status::OK();
     }
 
+    bool append_inverted_index_cache_key(VExprContext* context, std::string* key) const override {
+        key->append(_fn.name.function_name);
+        // AND and OR are commutative, so "a and b" shares its result with "b and a"
+        return _append_children_cache_keys(context, key, _op != TExprOpcode::COMPOUND_NOT);
+    }
+
     Status execute(VExprContext* context, Block* block, int* result_column_id) override {
         if (fast_execute(context, block, result_column_id)) {
             return Status::OK();
@@ -387,6 +398,49 @@ private:
                                    [](const VExprSPtr& arg) -> bool { return arg->is_constant(); });
     }
 
+    // Results of a compound expr are cached per segment in the inverted index query cache, so
+    // repeated filters skip evaluating and combining their children. cache_key->value is left
+    // empty if the expr can not be cached.
+    bool _lookup_inverted_index_cache(VExprContext* context,
+                                      segment_v2::InvertedIndexQueryCache::CacheKey* cache_key) {
+        auto* index_context = context->get_inverted_index_context().get();
+        if (index_context->segment_cache_key().empty()) {
+            return false;
+        }
+        std::string expr_key;
+        if (!append_inverted_index_cache_key(context, &expr_key)) {
+            return false;
+        }
+        *cache_key = {index_context->segment_cache_key(), "",
+                      segment_v2::InvertedIndexQueryType::UNKNOWN_QUERY, std::move(expr_key)};
+
+        segment_v2::InvertedIndexQueryCacheHandle cache_handle;
+        if (!segment_v2::InvertedIndexQueryCache::instance()->lookup(*cache_key, &cache_handle) ||
+            cache_handle.get_null_bitmap() == nullptr) {
+            return false;
+        }
+        // parents may modify the result in place, so hand out a copy
+        index_context->set_inverted_index_result_for_expr(
+                this, segment_v2::InvertedIndexResultBitmap(
+                              std::make_shared<roaring::Roaring>(*cache_handle.get_bitmap()),
+                              std::make_shared<roaring::Roaring>(
+                                      *cache_handle.get_null_bitmap())));
+        return true;
+    }
+
+    static void _insert_inverted_index_cache(
+            const segment_v2::InvertedIndexQueryCache::CacheKey& cache_key,
+            const segment_v2::InvertedIndexResultBitmap& res) {
+        if (cache_key.value.empty() || res.get_data_bitmap() == nullptr ||
+            res.get_null_bitmap() == nullptr) {
+            return;
+        }
+        segment_v2::InvertedIndexQueryCacheHandle cache_handle;
+        segment_v2::InvertedIndexQueryCache::instance()->insert(
+                cache_key, std::make_shared<roaring::Roaring>(*res.get_data_bitmap()),
+                std::make_shared<roaring::Roaring>(*res.get_null_bitmap()), &cache_handle);
+    }
+
     std::pair<uint8_t*, uint8_t*> _get_raw_data_and_null_map(ColumnPtr column,
                                                              bool has_nullable_column) const {
         if (has_nullable_column) {
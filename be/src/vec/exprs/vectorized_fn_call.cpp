@@ -248,6 +248,16 @@ const std::string& VectorizedFnCall::expr_name() const {
     return _expr_name;
 }
 
+bool VectorizedFnCall::append_inverted_index_cache_key(VExprContext* context,
+                                                       std::string* key) const {
+    if (_fn.binary_type == TFunctionBinaryType::JAVA_UDF ||
+        _fn.binary_type == TFunctionBinaryType::RPC) {
+        return false;
+    }
+    key->append(_fn.name.function_name);
+    return _append_children_cache_keys(context, key, false);
+}
+
 std::string VectorizedFnCall::debug_string() const {
     std::stringstream out;
     out << "VectorizedFn[";
@@ -792,6 +792,26 @@ bool VExpr::fast_execute(doris::vectorized::VExprContext* context, doris::vector
     return false;
 }
 
+bool VExpr::_append_children_cache_keys(VExprContext* context, std::string* key,
+                                        bool sort_children) const {
+    std::vector<std::string> child_keys(_children.size());
+    for (size_t i = 0; i < _children.size(); ++i) {
+        if (!_children[i]->append_inverted_index_cache_key(context, &child_keys[i])) {
+            return false;
+        }
+    }
+    if (sort_children) {
+        std::sort(child_keys.begin(), child_keys.end());
+    }
+    key->append("(");
+    for (const auto& child_key : child_keys) {
+        key->append(child_key);
+        key->append(",");
+    }
+    key->append(")");
+    return true;
+}
+
 bool VExpr::equals(const VExpr& other) {
     return false;
 }
@@ -130,6 +130,12 @@ public:
     Status _evaluate_inverted_index(VExprContext* context, const FunctionBasePtr& function,
                                     uint32_t segment_num_rows);
 
+    // Append a query independent key of this expr's inverted index result, so equal predicates
+    // of different queries can share cached results. Returns false if the expr can't be keyed.
+    virtual bool append_inverted_index_cache_key(VExprContext* context, std::string* key) const {
+        return false;
+    }
+
     virtual size_t estimate_memory(const size_t rows);
 
     // Only the 4th parameter is used in the runtime filter. In and MinMax need overwrite the
@@ -263,7 +269,7 @@ public:
     uint32_t index_unique_id() const { return _index_unique_id; }
 
     virtual void collect_slot_column_ids(std::set<int>& column_ids) const {
-        for (auto child : _children) {
+        for (const auto& child : children()) {
             child->collect_slot_column_ids(column_ids);
         }
     }
@@ -289,6 +295,10 @@ protected:
 
     bool is_const_and_have_executed() { return (is_constant() && (_constant_col != nullptr)); }
 
+    // Append "(child_key,...)", children keys are sorted if the expr is commutative.
+    bool _append_children_cache_keys(VExprContext* context, std::string* key,
+                                     bool sort_children) const;
+
     Status get_result_from_const(vectorized::Block* block, const std::string& expr_name,
                                  int* result_column_id);
 
@@ -19,21 +19,27 @@
 
 #include <algorithm>
 #include <cstdint>
+#include <numeric>
 #include <ostream>
+#include <set>
 #include <string>
 
 #include "common/cast_set.h"
 #include "common/compiler_util.h" // IWYU pragma: keep
+#include "common/config.h"
 #include "common/exception.h"
 #include "runtime/runtime_state.h"
 #include "runtime/thread_context.h"
 #include "udf/udf.h"
 #include "util/simd/bits.h"
+#include "util/stopwatch.hpp"
 #include "vec/columns/column_const.h"
 #include "vec/core/column_numbers.h"
 #include "vec/core/column_with_type_and_name.h"
 #include "vec/core/columns_with_type_and_name.h"
 #include "vec/exprs/vexpr.h"
+#include "vec/exprs/vfused_arithmetic_expr.h"
+#include "vec/exprs/vshared_expr.h"
 
 namespace doris {
 class RowDescriptor;
@@ -42,6 +48,9 @@ class RowDescriptor;
 namespace doris::vectorized {
 #include "common/compile_check_begin.h"
 
+// rows of conjunct samples kept before older ones are halved
+static constexpr size_t CONJUNCT_STATS_DECAY_ROWS = 1UL << 22;
+
 VExprContext::~VExprContext() {
     // In runtime filter, only create expr context to get expr root, will not call
     // prepare or open, so that it is not need to call close. And call close may core
@@ -75,6 +84,9 @@ Status VExprContext::prepare(RuntimeState* state, const RowDescriptor& row_desc)
     _prepared = true;
     Status st;
     RETURN_IF_CATCH_EXCEPTION({ st = _root->prepare(state, row_desc, this); });
+    if (st.ok() && config::enable_fused_arithmetic_expr) {
+        _root = VFusedArithmeticExpr::fuse(_root);
+    }
     return st;
 }
 
@@ -116,10 +128,22 @@ Status VExprContext::clone(RuntimeState* state, VExprContextSPtr& new_ctx) {
     new_ctx->_is_clone = true;
     new_ctx->_prepared = true;
     new_ctx->_opened = true;
+    new_ctx->_num_shared_exprs = _num_shared_exprs;
 
     return _root->open(state, new_ctx.get(), FunctionContext::THREAD_LOCAL);
 }
 
+void VExprContext::attach_expr_result_cache(const VExprContextSPtrs& ctxs) {
+    if (ctxs.empty() || ctxs[0]->_num_shared_exprs == 0) {
+        return;
+    }
+    auto cache = std::make_shared<VExprResultCache>(ctxs[0]->_num_shared_exprs);
+    for (const auto& ctx : ctxs) {
+        DCHECK_EQ(ctx->_num_shared_exprs, ctxs[0]->_num_shared_exprs);
+        ctx->_expr_result_cache = cache;
+    }
+}
+
 void VExprContext::clone_fn_contexts(VExprContext* other) {
     for (auto& _fn_context : _fn_contexts) {
         other->_fn_contexts.push_back(_fn_context->clone());
@@ -174,96 +198,139 @@ Status VExprContext::execute_conjuncts(const VExprContextSPtrs& ctxs,
     return execute_conjuncts(ctxs, filters, false, block, result_filter, can_filter_all);
 }
 
-// TODO: Performance Optimization
+Status VExprContext::_execute_conjunct(VExprContext* ctx, bool accept_null, Block* block,
+                                       uint8_t* __restrict result_filter_data,
+                                       size_t input_rows, size_t* output_rows) {
+    const size_t rows = block->rows();
+    MonotonicStopWatch watch;
+    watch.start();
+    int result_column_id = -1;
+    RETURN_IF_ERROR(ctx->execute(block, &result_column_id));
+    ColumnPtr& filter_column = block->get_by_position(result_column_id).column;
+    if (const auto* nullable_column = check_and_get_column<ColumnNullable>(*filter_column)) {
+        if (nullable_column->size() != 0) {
+            const ColumnPtr& nested_column = nullable_column->get_nested_column_ptr();
+            const IColumn::Filter& filter =
+                    assert_cast<const ColumnUInt8&>(*nested_column).get_data();
+            const auto* __restrict filter_data = filter.data();
+            const auto* __restrict null_map_data = nullable_column->get_null_map_data().data();
+            if (accept_null) {
+                for (size_t i = 0; i < rows; ++i) {
+                    result_filter_data[i] &= (null_map_data[i]) || filter_data[i];
+                }
+            } else {
+                for (size_t i = 0; i < rows; ++i) {
+                    result_filter_data[i] &= (!null_map_data[i]) & filter_data[i];
+                }
+            }
+        }
+    } else if (const auto* const_column = check_and_get_column<ColumnConst>(*filter_column)) {
+        // filter all
+        if (!const_column->get_bool(0)) {
+            memset(result_filter_data, 0, rows);
+        }
+    } else {
+        const IColumn::Filter& filter = assert_cast<const ColumnUInt8&>(*filter_column).get_data();
+        const auto* __restrict filter_data = filter.data();
+        for (size_t i = 0; i < rows; ++i) {
+            result_filter_data[i] &= filter_data[i];
+        }
+    }
+    *output_rows = rows - simd::count_zero_num((int8_t*)result_filter_data, rows);
+
+    if (ctx->root()->is_rf_wrapper()) {
+        ctx->root()->do_judge_selectivity(input_rows - *output_rows, input_rows);
+    }
+    // halve old samples so the order follows changes in the data
+    if (ctx->_conjunct_input_rows > CONJUNCT_STATS_DECAY_ROWS) {
+        ctx->_conjunct_exec_ns /= 2;
+        ctx->_conjunct_input_rows /= 2;
+        ctx->_conjunct_output_rows /= 2;
+    }
+    ctx->_conjunct_exec_ns += watch.elapsed_time();
+    ctx->_conjunct_input_rows += input_rows;
+    ctx->_conjunct_output_rows += *output_rows;
+    return Status::OK();
+}
+
+void VExprContext::_order_conjuncts(const VExprContextSPtrs& ctxs, std::vector<size_t>& order) {
+    order.resize(ctxs.size());
+    std::iota(order.begin(), order.end(), 0);
+    if (!config::enable_adaptive_conjunct_order || ctxs.size() < 2) {
+        return;
+    }
+    // expected cost per dropped row, conjuncts without samples go first to get some
+    auto rank = [&](size_t i) {
+        const auto& ctx = *ctxs[i];
+        if (ctx._conjunct_input_rows == 0) {
+            return 0.0;
+        }
+        const auto input_rows = static_cast<double>(ctx._conjunct_input_rows);
+        const double cost = static_cast<double>(ctx._conjunct_exec_ns) / input_rows;
+        const double drop_rate =
+                1.0 - static_cast<double>(ctx._conjunct_output_rows) / input_rows;
+        return cost / std::max(drop_rate, 0.001);
+    };
+    std::vector<double> ranks(ctxs.size());
+    for (size_t i = 0; i < ctxs.size(); ++i) {
+        ranks[i] = rank(i);
+    }
+    std::stable_sort(order.begin(), order.end(),
+                     [&](size_t lhs, size_t rhs) { return ranks[lhs] < ranks[rhs]; });
+}
+
 Status VExprContext::execute_conjuncts(const VExprContextSPtrs& ctxs,
                                        const std::vector<IColumn::Filter*>* filters,
                                        bool accept_null, Block* block,
                                        IColumn::Filter* result_filter, bool* can_filter_all) {
     size_t rows = block->rows();
     DCHECK_EQ(result_filter->size(), rows);
+    VExprResultCache::Scope cache_scope(ctxs, block);
     *can_filter_all = false;
     auto* __restrict result_filter_data = result_filter->data();
-    for (const auto& ctx : ctxs) {
-        // Statistics are only required when an rf wrapper exists in the expr.
-        bool is_rf_wrapper = ctx->root()->is_rf_wrapper();
-        int result_column_id = -1;
-        RETURN_IF_ERROR(ctx->execute(block, &result_column_id));
-        ColumnPtr& filter_column = block->get_by_position(result_column_id).column;
-        if (const auto* nullable_column = check_and_get_column<ColumnNullable>(*filter_column)) {
-            size_t column_size = nullable_column->size();
-            if (column_size == 0) {
-                *can_filter_all = true;
-                return Status::OK();
-            } else {
-                const ColumnPtr& nested_column = nullable_column->get_nested_column_ptr();
-                const IColumn::Filter& filter =
-                        assert_cast<const ColumnUInt8&>(*nested_column).get_data();
-                const auto* __restrict filter_data = filter.data();
-                const auto* __restrict null_map_data = nullable_column->get_null_map_data().data();
-
-                size_t input_rows =
-                        rows - (is_rf_wrapper
-                                        ? simd::count_zero_num((int8_t*)result_filter_data, rows)
-                                        : 0);
-
-                if (accept_null) {
-                    for (size_t i = 0; i < rows; ++i) {
-                        result_filter_data[i] &= (null_map_data[i]) || filter_data[i];
-                    }
-                } else {
-                    for (size_t i = 0; i < rows; ++i) {
-                        result_filter_data[i] &= (!null_map_data[i]) & filter_data[i];
-                    }
-                }
 
-                size_t output_rows =
-                        rows - (is_rf_wrapper
-                                        ? simd::count_zero_num((int8_t*)result_filter_data, rows)
-                                        : 0);
-
-                if (is_rf_wrapper) {
-                    ctx->root()->do_judge_selectivity(input_rows - output_rows, input_rows);
-                }
-
-                if ((is_rf_wrapper && output_rows == 0) ||
-                    (!is_rf_wrapper && memchr(result_filter_data, 0x1, rows) == nullptr)) {
-                    *can_filter_all = true;
-                    return Status::OK();
-                }
-            }
-        } else if (const auto* const_column = check_and_get_column<ColumnConst>(*filter_column)) {
-            // filter all
-            if (!const_column->get_bool(0)) {
-                *can_filter_all = true;
-                memset(result_filter_data, 0, result_filter->size());
-                return Status::OK();
+    std::vector<size_t> order;
+    _order_conjuncts(ctxs, order);
+    bool can_compact = std::ranges::none_of(
+            ctxs, [](const auto& ctx) { return ctx->get_inverted_index_context() != nullptr; });
+    size_t selected_rows = rows - simd::count_zero_num((int8_t*)result_filter_data, rows);
+    // once few rows are left, the remaining conjuncts run on a block of only those rows
+    Block compact_block;
+    IColumn::Filter compact_filter;
+    std::vector<uint32_t> selection;
+    for (size_t i = 0; i < order.size(); ++i) {
+        auto* ctx = ctxs[order[i]].get();
+        if (selection.empty() && can_compact && i > 0 &&
+            static_cast<double>(selected_rows) <=
+                    config::conjunct_compaction_ratio * static_cast<double>(rows)) {
+            std::set<int> column_ids;
+            for (size_t j = i; j < order.size(); ++j) {
+                ctxs[order[j]]->root()->collect_slot_column_ids(column_ids);
             }
+            _compact_block(*block, *result_filter, selected_rows, column_ids, &compact_block,
+                           selection);
+            compact_filter.assign(selected_rows, (uint8_t)1);
+        }
+        size_t output_rows = 0;
+        if (selection.empty()) {
+            RETURN_IF_ERROR(_execute_conjunct(ctx, accept_null, block, result_filter_data,
+                                              selected_rows, &output_rows));
         } else {
-            const IColumn::Filter& filter =
-                    assert_cast<const ColumnUInt8&>(*filter_column).get_data();
-            const auto* __restrict filter_data = filter.data();
-
-            size_t input_rows =
-                    rows -
-                    (is_rf_wrapper ? simd::count_zero_num((int8_t*)result_filter_data, rows) : 0);
-
-            for (size_t i = 0; i < rows; ++i) {
-                result_filter_data[i] &= filter_data[i];
-            }
-
-            size_t output_rows =
-                    rows -
-                    (is_rf_wrapper ? simd::count_zero_num((int8_t*)result_filter_data, rows) : 0);
-
-            if (is_rf_wrapper) {
-                ctx->root()->do_judge_selectivity(input_rows - output_rows, input_rows);
-            }
-
-            if ((is_rf_wrapper && output_rows == 0) ||
-                (!is_rf_wrapper && memchr(result_filter_data, 0x1, rows) == nullptr)) {
-                *can_filter_all = true;
-                return Status::OK();
-            }
+            RETURN_IF_ERROR(_execute_conjunct(ctx, accept_null, &compact_block,
+                                              compact_filter.data(), selected_rows,
+                                              &output_rows));
+        }
+        selected_rows = output_rows;
+        if (selected_rows == 0) {
+            *can_filter_all = true;
+            memset(result_filter_data, 0, rows);
+            return Status::OK();
+        }
+    }
+    if (!selection.empty()) {
+        memset(result_filter_data, 0, rows);
+        for (size_t i = 0; i < selection.size(); ++i) {
+            result_filter_data[selection[i]] = compact_filter[i];
         }
     }
     if (filters != nullptr) {
@@ -282,6 +349,32 @@ Status VExprContext::execute_conjuncts(const VExprContextSPtrs& ctxs,
     return Status::OK();
 }
 
+void VExprContext::_compact_block(const Block& block, const IColumn::Filter& filter,
+                                  size_t selected_rows, const std::set<int>& column_ids,
+                                  Block* compact_block, std::vector<uint32_t>& selection) {
+    selection.reserve(selected_rows);
+    for (size_t i = 0; i < filter.size(); ++i) {
+        if (filter[i]) {
+            selection.push_back(static_cast<uint32_t>(i));
+        }
+    }
+    // keep column positions, columns no remaining conjunct reads become a cheap const
+    for (size_t i = 0; i < block.columns(); ++i) {
+        auto column = block.get_by_position(i);
+        // lazily materialized columns may still be empty
+        if (column.column != nullptr && !column.column->empty()) {
+            if (is_column_const(*column.column)) {
+                column.column = column.column->clone_resized(selected_rows);
+            } else if (column_ids.contains(static_cast<int>(i))) {
+                column.column = column.column->filter(filter, selected_rows);
+            } else {
+                column.column = ColumnConst::create(column.column->cut(0, 1), selected_rows);
+            }
+        }
+        compact_block->insert(std::move(column));
+    }
+}
+
 Status VExprContext::execute_conjuncts(const VExprContextSPtrs& conjuncts, Block* block,
                                        ColumnUInt8& null_map, IColumn::Filter& filter) {
     const auto& rows = block->rows();
@@ -292,6 +385,7 @@ Status VExprContext::execute_conjuncts(const VExprContextSPtrs& conjuncts, Block
         return Status::InternalError("null_map.size() != rows, null_map.size()={}, rows={}",
                                      null_map.size(), rows);
     }
+    VExprResultCache::Scope cache_scope(conjuncts, block);
 
     auto* final_null_map = null_map.get_data().data();
     auto* final_filter_ptr = filter.data();
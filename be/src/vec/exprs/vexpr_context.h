@@ -22,6 +22,7 @@
 #include <algorithm>
 #include <cstddef>
 #include <memory>
+#include <set>
 #include <utility>
 #include <vector>
 
@@ -111,6 +112,12 @@ public:
         _inverted_index_result_column[expr] = std::move(column);
     }
 
+    // Non-empty when results of compound exprs may be cached across queries, it identifies the
+    // segment the results belong to.
+    void set_segment_cache_key(std::string key) { _segment_cache_key = std::move(key); }
+
+    const std::string& segment_cache_key() const { return _segment_cache_key; }
+
     void set_true_for_inverted_index_status(const vectorized::VExpr* expr, int column_index) {
         if (column_index < 0 || column_index >= _col_ids.size()) {
             return;
@@ -143,8 +150,12 @@ private:
     // A reference to a map of common expressions to their inverted index evaluation status.
     std::unordered_map<ColumnId, std::unordered_map<const vectorized::VExpr*, bool>>&
             _expr_inverted_index_status;
+
+    std::string _segment_cache_key;
 };
 
+class VExprResultCache;
+
 class VExprContext {
     ENABLE_FACTORY_CREATOR(VExprContext);
 
@@ -238,6 +249,13 @@ public:
 
     void set_force_materialize_slot() { _force_materialize_slot = true; }
 
+    VExprResultCache* expr_result_cache() const { return _expr_result_cache.get(); }
+
+    void set_num_shared_exprs(size_t num_shared_exprs) { _num_shared_exprs = num_shared_exprs; }
+
+    // Gives the cloned contexts of one group a common cache for their shared sub-expressions.
+    static void attach_expr_result_cache(const VExprContextSPtrs& ctxs);
+
     VExprContext& operator=(const VExprContext& other) {
         if (this == &other) {
             return *this;
@@ -284,6 +302,18 @@ private:
 
     static void _reset_memory_usage(const VExprContextSPtrs& contexts);
 
+    // Evaluates one conjunct on `block` and ANDs it into `result_filter_data`, recording the
+    // cost and selectivity that `_order_conjuncts` ranks by.
+    static Status _execute_conjunct(VExprContext* ctx, bool accept_null, Block* block,
+                                    uint8_t* __restrict result_filter_data, size_t input_rows,
+                                    size_t* output_rows);
+
+    static void _order_conjuncts(const VExprContextSPtrs& ctxs, std::vector<size_t>& order);
+
+    static void _compact_block(const Block& block, const IColumn::Filter& filter,
+                               size_t selected_rows, const std::set<int>& column_ids,
+                               Block* compact_block, std::vector<uint32_t>& selection);
+
     friend class VExpr;
 
     /// The expr tree this context is for.
@@ -311,5 +341,14 @@ private:
 
     std::shared_ptr<InvertedIndexContext> _inverted_index_context;
     size_t _memory_usage = 0;
+
+    // number of VSharedExpr ids in this context's group, see VSharedExpr::share_common_exprs
+    size_t _num_shared_exprs = 0;
+    std::shared_ptr<VExprResultCache> _expr_result_cache;
+
+    // samples of this context evaluated as a conjunct
+    uint64_t _conjunct_exec_ns = 0;
+    uint64_t _conjunct_input_rows = 0;
+    uint64_t _conjunct_output_rows = 0;
 };
 } // namespace doris::vectorized
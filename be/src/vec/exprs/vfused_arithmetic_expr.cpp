@@ -0,0 +1,340 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "vec/exprs/vfused_arithmetic_expr.h"
+
+#include <bvar/bvar.h>
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <cstring>
+#include <optional>
+
+#include "common/status.h"
+#include "vec/columns/column_const.h"
+#include "vec/columns/column_nullable.h"
+#include "vec/common/assert_cast.h"
+#include "vec/core/block.h"
+#include "vec/exprs/vectorized_fn_call.h"
+
+namespace doris::vectorized {
+#include "common/compile_check_begin.h"
+
+namespace {
+bvar::Adder<int64_t> g_fused_arithmetic_expr_count("fused_arithmetic_expr_count");
+bvar::Adder<int64_t> g_fused_arithmetic_expr_fused_nodes("fused_arithmetic_expr_fused_nodes");
+
+// rows evaluated per step, small enough for the operand stack to stay in L1/L2
+constexpr size_t FUSED_BATCH_SIZE = 1024;
+
+bool is_fusable_type(PrimitiveType type) {
+    return type == TYPE_INT || type == TYPE_BIGINT || type == TYPE_DOUBLE;
+}
+
+std::optional<VFusedArithmeticExpr::OpCode> fusable_op(const VExpr& expr, PrimitiveType type) {
+    using OpCode = VFusedArithmeticExpr::OpCode;
+    if (dynamic_cast<const VectorizedFnCall*>(&expr) == nullptr || expr.get_num_children() != 2 ||
+        expr.result_type() != type || expr.is_constant()) {
+        return std::nullopt;
+    }
+    for (const auto& child : expr.children()) {
+        if (child->result_type() != type) {
+            return std::nullopt;
+        }
+    }
+    const auto& name = expr.fn().name.function_name;
+    if (name == "add") {
+        return OpCode::ADD;
+    }
+    if (name == "subtract") {
+        return OpCode::SUB;
+    }
+    if (name == "multiply") {
+        return OpCode::MUL;
+    }
+    return std::nullopt;
+}
+
+size_t count_fusable_ops(const VExprSPtr& expr, PrimitiveType type) {
+    if (!fusable_op(*expr, type)) {
+        return 0;
+    }
+    return 1 + count_fusable_ops(expr->get_child(0), type) +
+           count_fusable_ops(expr->get_child(1), type);
+}
+
+void build_program(const VExprSPtr& expr, PrimitiveType type,
+                   std::vector<VFusedArithmeticExpr::Instruction>& program, VExprSPtrs& inputs) {
+    auto op = fusable_op(*expr, type);
+    if (!op) {
+        program.push_back(
+                {VFusedArithmeticExpr::OpCode::LOAD, static_cast<uint16_t>(inputs.size())});
+        inputs.push_back(VFusedArithmeticExpr::fuse(expr));
+        return;
+    }
+    build_program(expr->get_child(0), type, program, inputs);
+    build_program(expr->get_child(1), type, program, inputs);
+    program.push_back({*op});
+}
+
+template <typename T, typename Op>
+void apply_op(const T* lhs, const T* rhs, T* out, size_t n, Op op) {
+    for (size_t i = 0; i < n; ++i) {
+        out[i] = op(lhs[i], rhs[i]);
+    }
+}
+} // namespace
+
+VFusedArithmeticExpr::VFusedArithmeticExpr(const VExprSPtr& root, std::vector<Instruction> program,
+                                           VExprSPtrs inputs)
+        : VExpr(root->data_type(), false),
+          _program(std::move(program)),
+          _expr_name(fmt::format("fused_arithmetic({})", root->expr_name())) {
+    _node_type = root->node_type();
+    _children = std::move(inputs);
+    size_t depth = 0;
+    for (const auto& inst : _program) {
+        depth = inst.op == OpCode::LOAD ? depth + 1 : depth - 1;
+        _max_stack_depth = std::max(_max_stack_depth, depth);
+    }
+    // built from an already prepared tree
+    _prepared = true;
+    _prepare_finished = true;
+}
+
+VExprSPtr VFusedArithmeticExpr::fuse(const VExprSPtr& expr) {
+    // runtime filter wrappers expose their impl's children and lambdas bind their own blocks
+    if (expr->get_impl() != nullptr ||
+        expr->node_type() == TExprNodeType::LAMBDA_FUNCTION_CALL_EXPR ||
+        expr->node_type() == TExprNodeType::LAMBDA_FUNCTION_EXPR) {
+        return expr;
+    }
+    const auto type = expr->result_type();
+    // a single arithmetic node gains nothing from fusion
+    size_t num_ops = is_fusable_type(type) ? count_fusable_ops(expr, type) : 0;
+    if (num_ops >= 2) {
+        std::vector<Instruction> program;
+        VExprSPtrs inputs;
+        build_program(expr, type, program, inputs);
+        g_fused_arithmetic_expr_count << 1;
+        g_fused_arithmetic_expr_fused_nodes << static_cast<int64_t>(num_ops);
+        return VFusedArithmeticExpr::create_shared(expr, std::move(program), std::move(inputs));
+    }
+
+    auto children = expr->children();
+    bool changed = false;
+    for (auto& child : children) {
+        auto fused = fuse(child);
+        if (fused != child) {
+            child = std::move(fused);
+            changed = true;
+        }
+    }
+    if (changed) {
+        expr->set_children(std::move(children));
+    }
+    return expr;
+}
+
+Status VFusedArithmeticExpr::prepare(RuntimeState* state, const RowDescriptor& desc,
+                                     VExprContext* context) {
+    return Status::OK();
+}
+
+Status VFusedArithmeticExpr::open(RuntimeState* state, VExprContext* context,
+                                  FunctionContext::FunctionStateScope scope) {
+    DCHECK(_prepare_finished);
+    RETURN_IF_ERROR(VExpr::open(state, context, scope));
+    _open_finished = true;
+    return Status::OK();
+}
+
+Status VFusedArithmeticExpr::execute(VExprContext* context, Block* block, int* result_column_id) {
+    if (is_const_and_have_executed()) {
+        return get_result_from_const(block, _expr_name, result_column_id);
+    }
+    DCHECK(_open_finished || _getting_const_col);
+    ColumnsWithTypeAndName inputs(_children.size());
+    for (size_t i = 0; i < _children.size(); ++i) {
+        int column_id = -1;
+        RETURN_IF_ERROR(_children[i]->execute(context, block, &column_id));
+        inputs[i] = block->get_by_position(column_id);
+    }
+
+    ColumnPtr result;
+    switch (result_type()) {
+    case TYPE_INT:
+        RETURN_IF_ERROR(_execute_impl<TYPE_INT>(inputs, block->rows(), result));
+        break;
+    case TYPE_BIGINT:
+        RETURN_IF_ERROR(_execute_impl<TYPE_BIGINT>(inputs, block->rows(), result));
+        break;
+    case TYPE_DOUBLE:
+        RETURN_IF_ERROR(_execute_impl<TYPE_DOUBLE>(inputs, block->rows(), result));
+        break;
+    default:
+        return Status::InternalError("{} does not support type {}", _expr_name,
+                                     _data_type->get_name());
+    }
+    block->insert({std::move(result), _data_type, _expr_name});
+    *result_column_id = static_cast<int>(block->columns() - 1);
+    return Status::OK();
+}
+
+template <PrimitiveType T>
+Status VFusedArithmeticExpr::_execute_impl(const ColumnsWithTypeAndName& inputs, size_t rows,
+                                           ColumnPtr& result) const {
+    using ColumnType = typename PrimitiveTypeTraits<T>::ColumnType;
+    using ValueType = typename PrimitiveTypeTraits<T>::CppNativeType;
+
+    struct Input {
+        const ValueType* data = nullptr;
+        const UInt8* null_map = nullptr;
+        bool is_const = false;
+    };
+    std::vector<Input> args(inputs.size());
+    bool has_nullable_input = false;
+    for (size_t i = 0; i < inputs.size(); ++i) {
+        const auto& [column, is_const] = unpack_if_const(inputs[i].column);
+        const IColumn* nested = column.get();
+        if (const auto* nullable = check_and_get_column<ColumnNullable>(*column)) {
+            nested = &nullable->get_nested_column();
+            args[i].null_map = nullable->get_null_map_data().data();
+            has_nullable_input = true;
+        }
+        args[i].data = assert_cast<const ColumnType&>(*nested).get_data().data();
+        args[i].is_const = is_const;
+    }
+    if (has_nullable_input && !is_nullable()) {
+        return Status::InternalError("{} got nullable input for not nullable result", _expr_name);
+    }
+
+    auto res = ColumnType::create(rows);
+    ValueType* res_data = res->get_data().data();
+    std::vector<ValueType> scratch(_max_stack_depth * FUSED_BATCH_SIZE);
+    std::vector<const ValueType*> stack(_max_stack_depth);
+    for (size_t begin = 0; begin < rows; begin += FUSED_BATCH_SIZE) {
+        const size_t n = std::min(FUSED_BATCH_SIZE, rows - begin);
+        size_t top = 0;
+        for (size_t pc = 0; pc < _program.size(); ++pc) {
+            const auto& inst = _program[pc];
+            if (inst.op == OpCode::LOAD) {
+                const auto& arg = args[inst.input];
+                if (arg.is_const) {
+                    ValueType* buf = scratch.data() + top * FUSED_BATCH_SIZE;
+                    std::fill(buf, buf + n, arg.data[0]);
+                    stack[top++] = buf;
+                } else {
+                    stack[top++] = arg.data + begin;
+                }
+                continue;
+            }
+            // the last instruction writes straight into the result column
+            ValueType* out = pc + 1 == _program.size()
+                                     ? res_data + begin
+                                     : scratch.data() + (top - 2) * FUSED_BATCH_SIZE;
+            const ValueType* lhs = stack[top - 2];
+            const ValueType* rhs = stack[top - 1];
+            switch (inst.op) {
+            case OpCode::ADD:
+                apply_op(lhs, rhs, out, n, [](ValueType a, ValueType b) { return a + b; });
+                break;
+            case OpCode::SUB:
+                apply_op(lhs, rhs, out, n, [](ValueType a, ValueType b) { return a - b; });
+                break;
+            case OpCode::MUL:
+                apply_op(lhs, rhs, out, n, [](ValueType a, ValueType b) { return a * b; });
+                break;
+            case OpCode::LOAD:
+                break;
+            }
+            --top;
+            stack[top - 1] = out;
+        }
+    }
+
+    if (!is_nullable()) {
+        result = std::move(res);
+        return Status::OK();
+    }
+    auto null_map = ColumnUInt8::create(rows, 0);
+    UInt8* nulls = null_map->get_data().data();
+    for (const auto& arg : args) {
+        if (arg.null_map == nullptr) {
+            continue;
+        }
+        if (arg.is_const) {
+            if (arg.null_map[0] && rows > 0) {
+                memset(nulls, 1, rows);
+            }
+            continue;
+        }
+        for (size_t i = 0; i < rows; ++i) {
+            nulls[i] |= arg.null_map[i];
+        }
+    }
+    result = ColumnNullable::create(std::move(res), std::move(null_map));
+    return Status::OK();
+}
+
+std::string VFusedArithmeticExpr::debug_string() const {
+    std::string program;
+    for (const auto& inst : _program) {
+        switch (inst.op) {
+        case OpCode::LOAD:
+            program += fmt::format("${} ", inst.input);
+            break;
+        case OpCode::ADD:
+            program += "+ ";
+            break;
+        case OpCode::SUB:
+            program += "- ";
+            break;
+        case OpCode::MUL:
+            program += "* ";
+            break;
+        }
+    }
+    if (!program.empty()) {
+        program.pop_back();
+    }
+    return fmt::format("FusedArithmeticExpr(program=[{}]{})", program, VExpr::debug_string());
+}
+
+bool VFusedArithmeticExpr::equals(const VExpr& other) {
+    const auto* other_ptr = dynamic_cast<const VFusedArithmeticExpr*>(&other);
+    if (!other_ptr || _program.size() != other_ptr->_program.size() ||
+        get_num_children() != other_ptr->get_num_children() ||
+        !_data_type->equals(*other_ptr->_data_type)) {
+        return false;
+    }
+    for (size_t i = 0; i < _program.size(); ++i) {
+        if (_program[i].op != other_ptr->_program[i].op ||
+            _program[i].input != other_ptr->_program[i].input) {
+            return false;
+        }
+    }
+    for (uint16_t i = 0; i < get_num_children(); i++) {
+        if (!get_child(i)->equals(*other_ptr->get_child(i))) {
+            return false;
+        }
+    }
+    return true;
+}
+
+#include "common/compile_check_end.h"
+} // namespace doris::vectorized
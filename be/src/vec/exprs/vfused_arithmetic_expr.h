@@ -0,0 +1,82 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "common/status.h"
+#include "udf/udf.h"
+#include "vec/exprs/vexpr.h"
+
+namespace doris {
+class RowDescriptor;
+class RuntimeState;
+} // namespace doris
+
+namespace doris::vectorized {
+#include "common/compile_check_begin.h"
+
+class Block;
+class VExprContext;
+
+// Evaluates a nested add/subtract/multiply sub-tree of one numeric type as a single postfix
+// program over its leaf columns, instead of materializing one column per arithmetic node.
+// Leaves (slot refs, literals, any other expr) are still executed by the interpreter.
+class VFusedArithmeticExpr final : public VExpr {
+    ENABLE_FACTORY_CREATOR(VFusedArithmeticExpr);
+
+public:
+    enum class OpCode : uint8_t { LOAD, ADD, SUB, MUL };
+
+    struct Instruction {
+        OpCode op;
+        // child index for LOAD
+        uint16_t input = 0;
+    };
+
+    VFusedArithmeticExpr(const VExprSPtr& root, std::vector<Instruction> program,
+                         VExprSPtrs inputs);
+    ~VFusedArithmeticExpr() override = default;
+
+    // Replaces every fusable sub-tree of a prepared expr tree and returns the new root.
+    static VExprSPtr fuse(const VExprSPtr& expr);
+
+    Status execute(VExprContext* context, Block* block, int* result_column_id) override;
+    Status prepare(RuntimeState* state, const RowDescriptor& desc, VExprContext* context) override;
+    Status open(RuntimeState* state, VExprContext* context,
+                FunctionContext::FunctionStateScope scope) override;
+    const std::string& expr_name() const override { return _expr_name; }
+    std::string debug_string() const override;
+    bool equals(const VExpr& other) override;
+
+    size_t program_size() const { return _program.size(); }
+
+private:
+    template <PrimitiveType T>
+    Status _execute_impl(const ColumnsWithTypeAndName& inputs, size_t rows,
+                         ColumnPtr& result) const;
+
+    std::vector<Instruction> _program;
+    size_t _max_stack_depth = 0;
+    const std::string _expr_name;
+};
+
+#include "common/compile_check_end.h"
+} // namespace doris::vectorized
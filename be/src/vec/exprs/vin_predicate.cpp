@@ -114,6 +114,12 @@ Status VInPredicate::evaluate_inverted_index(VExprContext* context, uint32_t seg
     return _evaluate_inverted_index(context, _function, segment_num_rows);
 }
 
+bool VInPredicate::append_inverted_index_cache_key(VExprContext* context,
+                                                   std::string* key) const {
+    key->append(_is_not_in ? "not_in" : "in");
+    return _append_children_cache_keys(context, key, false);
+}
+
 Status VInPredicate::execute(VExprContext* context, Block* block, int* result_column_id) {
     if (is_const_and_have_executed()) { // const have execute in open function
         return get_result_from_const(block, _expr_name, result_column_id);
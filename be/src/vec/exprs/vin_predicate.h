@@ -59,6 +59,7 @@ public:
 
     bool is_not_in() const { return _is_not_in; };
     Status evaluate_inverted_index(VExprContext* context, uint32_t segment_num_rows) override;
+    bool append_inverted_index_cache_key(VExprContext* context, std::string* key) const override;
 
 private:
     FunctionBasePtr _function;
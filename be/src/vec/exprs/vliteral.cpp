@@ -62,6 +62,13 @@ std::string VLiteral::value() const {
     return _data_type->to_string(*_column_ptr, 0);
 }
 
+bool VLiteral::append_inverted_index_cache_key(VExprContext* context, std::string* key) const {
+    auto literal_value = value();
+    key->append(fmt::format("lit:{}:{}:{}", _data_type->get_name(), literal_value.size(),
+                            literal_value));
+    return true;
+}
+
 std::string VLiteral::debug_string() const {
     std::stringstream out;
     out << "VLiteral (name = " << _expr_name;
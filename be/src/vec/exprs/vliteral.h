@@ -52,6 +52,7 @@ public:
 
     const std::string& expr_name() const override { return _expr_name; }
     std::string debug_string() const override;
+    bool append_inverted_index_cache_key(VExprContext* context, std::string* key) const override;
 
     MOCK_FUNCTION std::string value() const;
 
@@ -135,6 +135,22 @@ Status VMatchPredicate::evaluate_inverted_index(VExprContext* context, uint32_t
     return _evaluate_inverted_index(context, _function, segment_num_rows);
 }
 
+bool VMatchPredicate::append_inverted_index_cache_key(VExprContext* context,
+                                                      std::string* key) const {
+    // the analyzer settings of the query change the terms being searched
+    key->append(fmt::format("{}[{}:{}:{}:{}:{}:{}", _fn.name.function_name,
+                            _inverted_index_ctx->custom_analyzer,
+                            static_cast<int>(_inverted_index_ctx->parser_type),
+                            _inverted_index_ctx->parser_mode, _inverted_index_ctx->lower_case,
+                            _inverted_index_ctx->stop_words,
+                            _inverted_index_ctx->char_filter_map.size()));
+    for (const auto& [name, value] : _inverted_index_ctx->char_filter_map) {
+        key->append(fmt::format(":{}={}", name, value));
+    }
+    key->append("]");
+    return _append_children_cache_keys(context, key, false);
+}
+
 Status VMatchPredicate::execute(VExprContext* context, Block* block, int* result_column_id) {
     DCHECK(_open_finished || _getting_const_col);
     if (fast_execute(context, block, result_column_id)) {
@@ -89,8 +89,8 @@ void VRuntimeFilterWrapper::close(VExprContext* context,
 
 Status VRuntimeFilterWrapper::execute(VExprContext* context, Block* block, int* result_column_id) {
     DCHECK(_open_finished || _getting_const_col);
-    if (_judge_counter.fetch_sub(1) == 0) {
-        reset_judge_selectivity();
+    if (!_disabled && _judge_counter.fetch_sub(1) == 0) {
+        _finish_sampling_period();
     }
     if (_always_true) {
         size_t size = block->rows();
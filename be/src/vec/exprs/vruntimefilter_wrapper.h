@@ -64,12 +64,18 @@ public:
 
     VExprSPtr get_impl() const override { return _impl; }
 
+    void collect_slot_column_ids(std::set<int>& column_ids) const override {
+        _impl->collect_slot_column_ids(column_ids);
+    }
+
     void attach_profile_counter(std::shared_ptr<RuntimeProfile::Counter> rf_input_rows,
                                 std::shared_ptr<RuntimeProfile::Counter> rf_filter_rows,
-                                std::shared_ptr<RuntimeProfile::Counter> always_true_filter_rows) {
+                                std::shared_ptr<RuntimeProfile::Counter> always_true_filter_rows,
+                                std::shared_ptr<RuntimeProfile::Counter> disabled_filter_num) {
         DCHECK(rf_input_rows != nullptr);
         DCHECK(rf_filter_rows != nullptr);
         DCHECK(always_true_filter_rows != nullptr);
+        DCHECK(disabled_filter_num != nullptr);
 
         if (rf_input_rows != nullptr) {
             _rf_input_rows = rf_input_rows;
@@ -80,6 +86,9 @@ public:
         if (always_true_filter_rows != nullptr) {
             _always_true_filter_rows = always_true_filter_rows;
         }
+        if (disabled_filter_num != nullptr) {
+            _disabled_filter_num = disabled_filter_num;
+        }
     }
 
     void update_counters(int64_t filter_rows, int64_t input_rows) {
@@ -98,6 +107,9 @@ public:
 
     int filter_id() const { return _filter_id; }
 
+    // Whether the filter is disabled for good after too many useless sampling periods.
+    bool is_disabled() const { return _disabled; }
+
     void do_judge_selectivity(uint64_t filter_rows, uint64_t input_rows) override {
         update_counters(filter_rows, input_rows);
 
@@ -117,6 +129,21 @@ public:
     }
 
 private:
+    // Called at the end of each sampling period. Counts the consecutive periods judged as
+    // always_true and keeps the filter always_true for good once
+    // runtime_filter_max_useless_sampling_periods is reached.
+    void _finish_sampling_period() {
+        _useless_sampling_periods = _always_true ? _useless_sampling_periods + 1 : 0;
+        int max_useless_periods = config::runtime_filter_max_useless_sampling_periods;
+        if (max_useless_periods > 0 && _useless_sampling_periods >= max_useless_periods) {
+            if (!_disabled.exchange(true)) {
+                COUNTER_UPDATE(_disabled_filter_num, 1);
+            }
+            return;
+        }
+        reset_judge_selectivity();
+    }
+
     void reset_judge_selectivity() {
         _always_true = false;
         _judge_counter = config::runtime_filter_sampling_frequency;
@@ -137,6 +164,9 @@ private:
     std::atomic_uint64_t _judge_input_rows = 0;
     std::atomic_uint64_t _judge_filter_rows = 0;
     std::atomic_int _always_true = false;
+    // consecutive sampling periods judged as always_true, see _finish_sampling_period
+    std::atomic_int _useless_sampling_periods = 0;
+    std::atomic_bool _disabled = false;
 
     std::shared_ptr<RuntimeProfile::Counter> _rf_input_rows =
             std::make_shared<RuntimeProfile::Counter>(TUnit::UNIT, 0);
@@ -144,6 +174,8 @@ private:
             std::make_shared<RuntimeProfile::Counter>(TUnit::UNIT, 0);
     std::shared_ptr<RuntimeProfile::Counter> _always_true_filter_rows =
             std::make_shared<RuntimeProfile::Counter>(TUnit::UNIT, 0);
+    std::shared_ptr<RuntimeProfile::Counter> _disabled_filter_num =
+            std::make_shared<RuntimeProfile::Counter>(TUnit::UNIT, 0);
 
     std::string _expr_name;
     double _ignore_thredhold;
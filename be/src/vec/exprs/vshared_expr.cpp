@@ -0,0 +1,204 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "vec/exprs/vshared_expr.h"
+
+#include <bvar/bvar.h>
+#include <fmt/format.h>
+
+#include <optional>
+#include <unordered_map>
+#include <unordered_set>
+
+#include "vec/exprs/vcast_expr.h"
+#include "vec/exprs/vectorized_fn_call.h"
+#include "vec/exprs/vexpr_context.h"
+#include "vec/exprs/vliteral.h"
+#include "vec/exprs/vslot_ref.h"
+
+namespace doris::vectorized {
+#include "common/compile_check_begin.h"
+
+namespace {
+bvar::Adder<int64_t> g_shared_expr_count("shared_expr_count");
+
+// functions whose result differs between two evaluations of the same arguments
+const std::unordered_set<std::string> NON_DETERMINISTIC_FUNCTIONS = {
+        "rand", "random", "uuid", "uuid_numeric", "random_bytes"};
+
+struct ShareContext {
+    // fingerprint of every sub-tree that can be compared, by node
+    std::unordered_map<const VExpr*, std::string> fingerprints;
+    // occurrences of every candidate sub-tree, by fingerprint
+    std::unordered_map<std::string, size_t> counts;
+    std::unordered_map<std::string, size_t> ids;
+};
+
+bool is_opaque(const VExpr& expr) {
+    // runtime filter wrappers expose their impl's children and lambdas bind their own blocks
+    return expr.get_impl() != nullptr ||
+           expr.node_type() == TExprNodeType::LAMBDA_FUNCTION_CALL_EXPR ||
+           expr.node_type() == TExprNodeType::LAMBDA_FUNCTION_EXPR;
+}
+
+bool is_candidate(const VExpr& expr) {
+    return (dynamic_cast<const VectorizedFnCall*>(&expr) != nullptr ||
+            dynamic_cast<const VCastExpr*>(&expr) != nullptr) &&
+           !expr.is_constant();
+}
+
+std::optional<std::string> fingerprint(const VExprSPtr& expr, ShareContext& share) {
+    if (is_opaque(*expr)) {
+        return std::nullopt;
+    }
+    std::vector<std::optional<std::string>> children;
+    for (const auto& child : expr->children()) {
+        children.push_back(fingerprint(child, share));
+    }
+    std::string fp;
+    if (const auto* slot = dynamic_cast<const VSlotRef*>(expr.get())) {
+        fp = fmt::format("slot({},{})", slot->slot_id(), slot->column_id());
+    } else if (const auto* literal = dynamic_cast<const VLiteral*>(expr.get())) {
+        // length prefixed like the inverted index cache key, so that a value containing the
+        // separators can not look like several literals
+        auto value = literal->value();
+        fp = fmt::format("literal({},{}:{})", literal->data_type()->get_name(), value.size(),
+                         value);
+    } else if (dynamic_cast<const VectorizedFnCall*>(expr.get()) != nullptr ||
+               dynamic_cast<const VCastExpr*>(expr.get()) != nullptr) {
+        if (NON_DETERMINISTIC_FUNCTIONS.contains(expr->fn().name.function_name)) {
+            return std::nullopt;
+        }
+        fp = fmt::format("{}:{}(", expr->expr_name(), expr->data_type()->get_name());
+        for (const auto& child : children) {
+            if (!child) {
+                return std::nullopt;
+            }
+            fp += fmt::format("{}:{},", child->size(), *child);
+        }
+        fp += ')';
+        if (!expr->is_constant()) {
+            ++share.counts[fp];
+        }
+    } else {
+        return std::nullopt;
+    }
+    share.fingerprints[expr.get()] = fp;
+    return fp;
+}
+
+VExprSPtr rewrite(const VExprSPtr& expr, ShareContext& share) {
+    if (is_opaque(*expr)) {
+        return expr;
+    }
+    auto children = expr->children();
+    bool changed = false;
+    for (auto& child : children) {
+        auto new_child = rewrite(child, share);
+        if (new_child != child) {
+            child = std::move(new_child);
+            changed = true;
+        }
+    }
+    if (changed) {
+        expr->set_children(std::move(children));
+    }
+
+    auto it = share.fingerprints.find(expr.get());
+    if (it == share.fingerprints.end() || !is_candidate(*expr) || share.counts[it->second] < 2) {
+        return expr;
+    }
+    auto [id, inserted] = share.ids.emplace(it->second, share.ids.size());
+    if (inserted) {
+        g_shared_expr_count << 1;
+    }
+    return VSharedExpr::create_shared(expr, id->second);
+}
+} // namespace
+
+VExprResultCache::Scope::Scope(const VExprContextSPtrs& ctxs, const Block* block) {
+    if (!ctxs.empty() && ctxs[0]->expr_result_cache() != nullptr) {
+        _cache = ctxs[0]->expr_result_cache();
+        _cache->_block = block;
+        std::fill(_cache->_column_ids.begin(), _cache->_column_ids.end(), -1);
+    }
+}
+
+VExprResultCache::Scope::~Scope() {
+    if (_cache != nullptr) {
+        _cache->_block = nullptr;
+    }
+}
+
+VSharedExpr::VSharedExpr(const VExprSPtr& expr, size_t id)
+        : VExpr(expr->data_type(), false), _id(id) {
+    _node_type = expr->node_type();
+    _children.push_back(expr);
+    // built from an already prepared tree
+    _prepared = true;
+    _prepare_finished = true;
+}
+
+size_t VSharedExpr::share_common_exprs(const VExprContextSPtrs& ctxs) {
+    ShareContext share;
+    for (const auto& ctx : ctxs) {
+        fingerprint(ctx->root(), share);
+    }
+    for (const auto& ctx : ctxs) {
+        ctx->set_root(rewrite(ctx->root(), share));
+    }
+    for (const auto& ctx : ctxs) {
+        ctx->set_num_shared_exprs(share.ids.size());
+    }
+    return share.ids.size();
+}
+
+Status VSharedExpr::prepare(RuntimeState* state, const RowDescriptor& desc,
+                            VExprContext* context) {
+    return Status::OK();
+}
+
+Status VSharedExpr::open(RuntimeState* state, VExprContext* context,
+                         FunctionContext::FunctionStateScope scope) {
+    DCHECK(_prepare_finished);
+    RETURN_IF_ERROR(VExpr::open(state, context, scope));
+    _open_finished = true;
+    return Status::OK();
+}
+
+Status VSharedExpr::execute(VExprContext* context, Block* block, int* result_column_id) {
+    auto* cache = context->expr_result_cache();
+    if (cache != nullptr) {
+        int column_id = cache->get(block, _id);
+        if (column_id >= 0) {
+            *result_column_id = column_id;
+            return Status::OK();
+        }
+    }
+    RETURN_IF_ERROR(_children[0]->execute(context, block, result_column_id));
+    if (cache != nullptr) {
+        cache->set(block, _id, *result_column_id);
+    }
+    return Status::OK();
+}
+
+std::string VSharedExpr::debug_string() const {
+    return fmt::format("SharedExpr(id={}){}", _id, _children[0]->debug_string());
+}
+
+#include "common/compile_check_end.h"
+} // namespace doris::vectorized
@@ -0,0 +1,98 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "common/status.h"
+#include "udf/udf.h"
+#include "vec/exprs/vexpr.h"
+#include "vec/exprs/vexpr_fwd.h"
+
+namespace doris {
+class RowDescriptor;
+class RuntimeState;
+} // namespace doris
+
+namespace doris::vectorized {
+#include "common/compile_check_begin.h"
+
+class Block;
+class VExprContext;
+
+// Column ids of the shared sub-expressions of one context group (the conjuncts or one
+// projection list of an operator) evaluated on a block. Entries are only valid inside a
+// Scope over that block, so ids never leak into a later block or a reshuffled one.
+class VExprResultCache {
+public:
+    class Scope {
+    public:
+        Scope(const VExprContextSPtrs& ctxs, const Block* block);
+        ~Scope();
+
+    private:
+        VExprResultCache* _cache = nullptr;
+    };
+
+    explicit VExprResultCache(size_t size) : _column_ids(size, -1) {}
+
+    int get(const Block* block, size_t id) const {
+        return block == _block ? _column_ids[id] : -1;
+    }
+
+    void set(const Block* block, size_t id, int column_id) {
+        if (block == _block) {
+            _column_ids[id] = column_id;
+        }
+    }
+
+private:
+    const Block* _block = nullptr;
+    std::vector<int> _column_ids;
+};
+
+// Wraps a sub-tree that occurs several times in a context group. The first wrapper executed
+// in a cache scope evaluates it, the others reuse its result column.
+class VSharedExpr final : public VExpr {
+    ENABLE_FACTORY_CREATOR(VSharedExpr);
+
+public:
+    VSharedExpr(const VExprSPtr& expr, size_t id);
+    ~VSharedExpr() override = default;
+
+    // Wraps every function call or cast sub-tree that occurs more than once in `ctxs` and
+    // returns the number of distinct shared sub-trees. Call after prepare and before clone.
+    static size_t share_common_exprs(const VExprContextSPtrs& ctxs);
+
+    Status execute(VExprContext* context, Block* block, int* result_column_id) override;
+    Status prepare(RuntimeState* state, const RowDescriptor& desc, VExprContext* context) override;
+    Status open(RuntimeState* state, VExprContext* context,
+                FunctionContext::FunctionStateScope scope) override;
+    const std::string& expr_name() const override { return _children[0]->expr_name(); }
+    std::string debug_string() const override;
+
+    size_t id() const { return _id; }
+
+private:
+    const size_t _id;
+};
+
+#include "common/compile_check_end.h"
+} // namespace doris::vectorized
@@ -17,6 +17,7 @@
 
 #include "vec/exprs/vslot_ref.h"
 
+#include <fmt/format.h>
 #include <gen_cpp/Exprs_types.h>
 #include <glog/logging.h>
 
@@ -24,6 +25,8 @@
 #include <vector>
 
 #include "common/status.h"
+#include "olap/rowset/segment_v2/index_iterator.h"
+#include "olap/rowset/segment_v2/inverted_index_reader.h"
 #include "runtime/descriptors.h"
 #include "runtime/runtime_state.h"
 #include "vec/core/block.h"
@@ -110,6 +113,32 @@ std::string VSlotRef::debug_string() const {
     return out.str();
 }
 
+bool VSlotRef::append_inverted_index_cache_key(VExprContext* context, std::string* key) const {
+    const auto& index_context = context->get_inverted_index_context();
+    const auto* storage_name_type =
+            index_context->get_storage_name_and_type_by_column_id(_column_id);
+    auto* iterator = index_context->get_inverted_index_iterator_by_column_id(_column_id);
+    if (storage_name_type == nullptr || iterator == nullptr) {
+        return false;
+    }
+    // storage name is prefixed by its length, so keys stay unambiguous with any name
+    key->append("col:");
+    key->append(std::to_string(storage_name_type->first.size()));
+    key->append(":");
+    key->append(storage_name_type->first);
+    // A V2 index file keeps its path when an index is dropped and rebuilt with other
+    // properties, so the index itself must be part of the key.
+    auto reader = iterator->get_reader();
+    key->append(fmt::format(":idx:{}", reader->get_index_id()));
+    if (const auto* inverted_reader =
+                dynamic_cast<const segment_v2::InvertedIndexReader*>(reader.get())) {
+        for (const auto& [name, value] : inverted_reader->get_index_properties()) {
+            key->append(fmt::format(":{}:{}{}:{}", name.size(), name, value.size(), value));
+        }
+    }
+    return true;
+}
+
 bool VSlotRef::equals(const VExpr& other) {
     if (!VExpr::equals(other)) {
         return false;
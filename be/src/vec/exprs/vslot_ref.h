@@ -49,6 +49,7 @@ public:
     const std::string& expr_name() const override;
     std::string expr_label() override;
     std::string debug_string() const override;
+    bool append_inverted_index_cache_key(VExprContext* context, std::string* key) const override;
     bool is_constant() const override { return false; }
 
     int column_id() const { return _column_id; }
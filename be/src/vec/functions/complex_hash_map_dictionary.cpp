@@ -203,6 +203,7 @@ ColumnPtr ComplexHashMapDictionary::get_single_value_column(
         const std::string& attribute_name, const DataTypePtr& attribute_type) const {
     const auto rows = value_index.size();
     MutableColumnPtr res_column = attribute_type->create_column();
+    res_column->reserve(rows);
     ColumnUInt8::MutablePtr res_null = ColumnUInt8::create(rows, false);
     auto& res_null_map = res_null->get_data();
     const auto& value_data = _values_data[attribute_index(attribute_name)];
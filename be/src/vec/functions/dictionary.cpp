@@ -20,11 +20,13 @@
 #include <variant>
 
 #include "runtime/thread_context.h"
+#include "util/metrics.h"
 #include "vec/columns/column.h"
 #include "vec/data_types/data_type_decimal.h"
 #include "vec/data_types/data_type_ipv4.h"
 #include "vec/data_types/data_type_nullable.h"
 #include "vec/data_types/data_type_number.h" // IWYU pragma: keep
+#include "vec/functions/dictionary_factory.h"
 
 namespace doris::vectorized {
 
@@ -97,6 +99,15 @@ size_t IDictionary::allocated_bytes() const {
     return bytes;
 }
 
+void IDictionary::record_lookup(size_t rows, int64_t time_ns) const {
+    if (_metrics == nullptr) {
+        return;
+    }
+    _metrics->dictionary_lookup_count->increment(1);
+    _metrics->dictionary_lookup_rows->increment(static_cast<int64_t>(rows));
+    _metrics->dictionary_lookup_time_ns->increment(time_ns);
+}
+
 void IDictionary::load_values(const std::vector<ColumnPtr>& values_column) {
     // load value column
     _values_data.resize(values_column.size());
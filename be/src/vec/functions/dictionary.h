@@ -41,6 +41,7 @@ class MemTrackerLimiter;
 }
 class DictionaryFactory;
 namespace doris::vectorized {
+struct DictionaryMetrics;
 /*
  * Dictionary implementation in Doris that provides key-value mapping functionality
  * Currently only supports in-memory dictionary storage
@@ -121,6 +122,9 @@ public:
 
     virtual size_t allocated_bytes() const;
 
+    // Adds one batched lookup of `rows` keys to the metrics of this dictionary.
+    void record_lookup(size_t rows, int64_t time_ns) const;
+
 protected:
     friend class DictionaryFactory;
 
@@ -205,6 +209,9 @@ protected:
 
     // mem_tracker comes from DictionaryFactory. If _mem_tracker is nullptr, it means it is in UT.
     std::shared_ptr<MemTrackerLimiter> _mem_tracker;
+
+    // Set by DictionaryFactory when the dictionary is committed, nullptr in UT.
+    std::shared_ptr<DictionaryMetrics> _metrics;
 };
 
 using DictionaryPtr = std::shared_ptr<IDictionary>;
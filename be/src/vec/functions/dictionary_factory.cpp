@@ -17,13 +17,36 @@
 
 #include "vec/functions/dictionary_factory.h"
 
+#include <fmt/format.h>
 #include <gen_cpp/DataSinks_types.h>
 
 #include "runtime/memory/mem_tracker_limiter.h"
 #include "runtime/thread_context.h"
+#include "util/doris_metrics.h"
 
 namespace doris::vectorized {
 
+DEFINE_COUNTER_METRIC_PROTOTYPE_2ARG(dictionary_lookup_count, MetricUnit::NOUNIT);
+DEFINE_COUNTER_METRIC_PROTOTYPE_2ARG(dictionary_lookup_rows, MetricUnit::ROWS);
+DEFINE_COUNTER_METRIC_PROTOTYPE_2ARG(dictionary_lookup_time_ns, MetricUnit::NANOSECONDS);
+DEFINE_COUNTER_METRIC_PROTOTYPE_2ARG(dictionary_refresh_count, MetricUnit::NOUNIT);
+DEFINE_GAUGE_METRIC_PROTOTYPE_2ARG(dictionary_memory_bytes, MetricUnit::BYTES);
+
+DictionaryMetrics::DictionaryMetrics(int64_t dict_id, const std::string& dict_name) {
+    entity = DorisMetrics::instance()->metric_registry()->register_entity(
+            fmt::format("dictionary_{}", dict_id),
+            {{"dictionary_id", std::to_string(dict_id)}, {"dictionary_name", dict_name}});
+    INT_COUNTER_METRIC_REGISTER(entity, dictionary_lookup_count);
+    INT_COUNTER_METRIC_REGISTER(entity, dictionary_lookup_rows);
+    INT_COUNTER_METRIC_REGISTER(entity, dictionary_lookup_time_ns);
+    INT_COUNTER_METRIC_REGISTER(entity, dictionary_refresh_count);
+    INT_GAUGE_METRIC_REGISTER(entity, dictionary_memory_bytes);
+}
+
+DictionaryMetrics::~DictionaryMetrics() {
+    DorisMetrics::instance()->metric_registry()->deregister_entity(entity);
+}
+
 DictionaryFactory::DictionaryFactory()
         : _mem_tracker(MemTrackerLimiter::create_shared(MemTrackerLimiter::Type::GLOBAL,
                                                         "GLOBAL_DICT_FACTORY")) {
@@ -34,6 +57,7 @@ DictionaryFactory::~DictionaryFactory() {
     SCOPED_SWITCH_THREAD_MEM_TRACKER_LIMITER(_mem_tracker);
     _dict_id_to_dict_map.clear();
     _dict_id_to_version_id_map.clear();
+    _dict_id_to_metrics_map.clear();
 }
 
 void DictionaryFactory::get_dictionary_status(std::vector<TDictionaryStatus>& result,
@@ -43,7 +67,7 @@ void DictionaryFactory::get_dictionary_status(std::vector<TDictionaryStatus>& re
         for (const auto& [dict_id, dict] : _dict_id_to_dict_map) {
             TDictionaryStatus status;
             status.__set_dictionary_id(dict_id);
-            status.__set_version_id(_dict_id_to_version_id_map[dict_id]);
+            status.__set_version_id(_dict_id_to_version_id_map.at(dict_id));
             status.__set_dictionary_memory_size(dict->allocated_bytes());
             result.emplace_back(std::move(status));
         }
@@ -52,7 +76,7 @@ void DictionaryFactory::get_dictionary_status(std::vector<TDictionaryStatus>& re
             if (_dict_id_to_dict_map.contains(dict_id)) {
                 TDictionaryStatus status;
                 status.__set_dictionary_id(dict_id);
-                status.__set_version_id(_dict_id_to_version_id_map[dict_id]);
+                status.__set_version_id(_dict_id_to_version_id_map.at(dict_id));
                 status.__set_dictionary_memory_size(
                         _dict_id_to_dict_map[dict_id]->allocated_bytes());
                 result.emplace_back(std::move(status));
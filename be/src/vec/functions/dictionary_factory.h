@@ -21,6 +21,7 @@
 
 #include "common/config.h"
 #include "common/logging.h"
+#include "util/metrics.h"
 #include "vec/functions/dictionary.h"
 
 namespace doris {
@@ -28,6 +29,19 @@ class MemTrackerLimiter;
 }
 namespace doris::vectorized {
 
+// Metrics of one dictionary id, kept across the refreshes of that dictionary.
+struct DictionaryMetrics {
+    DictionaryMetrics(int64_t dict_id, const std::string& dict_name);
+    ~DictionaryMetrics();
+
+    std::shared_ptr<MetricEntity> entity;
+    IntCounter* dictionary_lookup_count = nullptr;
+    IntCounter* dictionary_lookup_rows = nullptr;
+    IntCounter* dictionary_lookup_time_ns = nullptr;
+    IntCounter* dictionary_refresh_count = nullptr;
+    IntGauge* dictionary_memory_bytes = nullptr;
+};
+
 class DictionaryFactory : private boost::noncopyable {
 public:
     DictionaryFactory();
@@ -35,13 +49,14 @@ public:
 
     // Returns nullptr if failed
     std::shared_ptr<const IDictionary> get(int64_t dict_id, int64_t version_id) {
-        std::unique_lock lc(_mutex);
+        std::shared_lock lc(_mutex);
         // dict_id and version_id must match
-        if (_dict_id_to_dict_map.contains(dict_id) &&
-            _dict_id_to_version_id_map[dict_id] == version_id) {
-            return _dict_id_to_dict_map[dict_id];
+        auto version_it = _dict_id_to_version_id_map.find(dict_id);
+        if (version_it == _dict_id_to_version_id_map.end() || version_it->second != version_id) {
+            return nullptr;
         }
-        return nullptr;
+        auto dict_it = _dict_id_to_dict_map.find(dict_id);
+        return dict_it == _dict_id_to_dict_map.end() ? nullptr : dict_it->second;
     }
 
     Status refresh_dict(int64_t dict_id, int64_t version_id, DictionaryPtr dict) {
@@ -108,6 +123,14 @@ public:
                     .tag("dict_id", dict_id)
                     .tag("version_id", version_id)
                     .tag("dict name", dict->dict_name());
+            auto& metrics = _dict_id_to_metrics_map[dict_id];
+            if (metrics == nullptr) {
+                metrics = std::make_shared<DictionaryMetrics>(dict_id, dict->dict_name());
+            }
+            metrics->dictionary_refresh_count->increment(1);
+            metrics->dictionary_memory_bytes->set_value(
+                    static_cast<int64_t>(dict->allocated_bytes()));
+            dict->_metrics = metrics;
             _dict_id_to_dict_map[dict_id] = dict;
             _dict_id_to_version_id_map[dict_id] = version_id;
             _refreshing_dict_map.erase(dict_id);
@@ -128,6 +151,7 @@ public:
                 .tag("dict name", dict->dict_name());
         _dict_id_to_dict_map.erase(dict_id);
         _dict_id_to_version_id_map.erase(dict_id);
+        _dict_id_to_metrics_map.erase(dict_id);
         return Status::OK();
     }
 
@@ -139,6 +163,7 @@ public:
 private:
     std::map<int64_t, DictionaryPtr> _dict_id_to_dict_map;
     std::map<int64_t, int64_t> _dict_id_to_version_id_map;
+    std::map<int64_t, std::shared_ptr<DictionaryMetrics>> _dict_id_to_metrics_map;
 
     std::map<int64_t, std::pair<int64_t, DictionaryPtr>>
             _refreshing_dict_map; // dict_id -> (version_id, dict)
@@ -20,17 +20,24 @@
 
 #include "vec/functions/function.h"
 
+#include <parallel_hashmap/phmap.h>
+
 #include <algorithm>
+#include <limits>
 #include <memory>
 #include <numeric>
+#include <optional>
 
+#include "common/config.h"
 #include "common/status.h"
 #include "vec/aggregate_functions/aggregate_function.h"
 #include "vec/columns/column.h"
 #include "vec/columns/column_const.h"
 #include "vec/columns/column_nullable.h"
+#include "vec/columns/column_string.h"
 #include "vec/columns/column_vector.h"
 #include "vec/common/assert_cast.h"
+#include "vec/common/string_ref.h"
 #include "vec/core/field.h"
 #include "vec/data_types/data_type_array.h"
 #include "vec/data_types/data_type_nothing.h"
@@ -103,6 +110,9 @@ bool have_null_column(const ColumnsWithTypeAndName& args) {
     return std::ranges::any_of(args, [](const auto& elem) { return elem.type->is_nullable(); });
 }
 
+// Blocks smaller than this are not worth building a dictionary for.
+static constexpr size_t LOW_CARDINALITY_MIN_ROWS = 512;
+
 inline Status PreparedFunctionImpl::_execute_skipped_constant_deal(
         FunctionContext* context, Block& block, const ColumnNumbers& args, uint32_t result,
         size_t input_rows_count, bool dry_run) const {
@@ -244,9 +254,110 @@ Status PreparedFunctionImpl::execute_without_low_cardinality_columns(
     return _execute_skipped_constant_deal(context, block, args, result, input_rows_count, dry_run);
 }
 
+Status PreparedFunctionImpl::default_implementation_for_low_cardinality_columns(
+        FunctionContext* context, Block& block, const ColumnNumbers& args, uint32_t result,
+        size_t input_rows_count, bool dry_run, bool* executed) const {
+    *executed = false;
+    if (dry_run || !config::enable_low_cardinality_function_execution ||
+        !use_default_implementation_for_low_cardinality() ||
+        input_rows_count < LOW_CARDINALITY_MIN_ROWS) {
+        return Status::OK();
+    }
+
+    std::optional<size_t> dict_arg;
+    for (size_t i = 0; i < args.size(); ++i) {
+        if (is_column_const(*block.get_by_position(args[i]).column)) {
+            continue;
+        }
+        if (dict_arg.has_value()) {
+            return Status::OK();
+        }
+        dict_arg = i;
+    }
+    if (!dict_arg.has_value()) {
+        return Status::OK();
+    }
+
+    const auto& column = block.get_by_position(args[*dict_arg]).column;
+    const IColumn* nested = column.get();
+    const NullMap* null_map = nullptr;
+    if (const auto* nullable = check_and_get_column<ColumnNullable>(nested)) {
+        nested = &nullable->get_nested_column();
+        null_map = &nullable->get_null_map_data();
+    }
+    const auto* strings = check_and_get_column<ColumnString>(nested);
+    if (strings == nullptr) {
+        return Status::OK();
+    }
+
+    // Build the block dictionary, giving up as soon as it grows too large.
+    const auto max_dict_size = std::min<size_t>(config::low_cardinality_function_max_dict_size,
+                                                input_rows_count / 4);
+    phmap::flat_hash_map<StringRef, uint32_t> dict;
+    std::vector<uint32_t> indices(input_rows_count);
+    auto dict_column = column->clone_empty();
+    uint32_t null_index = std::numeric_limits<uint32_t>::max();
+    for (size_t i = 0; i < input_rows_count; ++i) {
+        if (null_map && (*null_map)[i]) {
+            if (null_index == std::numeric_limits<uint32_t>::max()) {
+                null_index = static_cast<uint32_t>(dict_column->size());
+                dict_column->insert_from(*column, i);
+            }
+            indices[i] = null_index;
+            continue;
+        }
+        auto [it, inserted] = dict.try_emplace(strings->get_data_at(i),
+                                               static_cast<uint32_t>(dict_column->size()));
+        if (inserted) {
+            if (dict.size() > max_dict_size) {
+                return Status::OK();
+            }
+            dict_column->insert_from(*column, i);
+        }
+        indices[i] = it->second;
+    }
+
+    // Run the function once per dictionary entry, constant arguments resized to match.
+    const size_t dict_size = dict_column->size();
+    Block dict_block;
+    ColumnNumbers dict_args(args.size());
+    for (size_t i = 0; i < args.size(); ++i) {
+        const auto& arg = block.get_by_position(args[i]);
+        ColumnPtr dict_arg_column;
+        if (i == *dict_arg) {
+            dict_arg_column = std::move(dict_column);
+        } else {
+            dict_arg_column = ColumnConst::create(
+                    assert_cast<const ColumnConst&>(*arg.column).get_data_column_ptr(),
+                    dict_size);
+        }
+        dict_block.insert({std::move(dict_arg_column), arg.type, arg.name});
+        dict_args[i] = static_cast<uint32_t>(i);
+    }
+    const auto& result_column = block.get_by_position(result);
+    dict_block.insert({nullptr, result_column.type, result_column.name});
+    const auto dict_result = static_cast<uint32_t>(args.size());
+    RETURN_IF_ERROR(execute_without_low_cardinality_columns(context, dict_block, dict_args,
+                                                            dict_result, dict_size, false));
+
+    auto dict_values =
+            dict_block.get_by_position(dict_result).column->convert_to_full_column_if_const();
+    auto res = dict_values->clone_empty();
+    res->insert_indices_from(*dict_values, indices.data(), indices.data() + input_rows_count);
+    block.get_by_position(result).column = std::move(res);
+    *executed = true;
+    return Status::OK();
+}
+
 Status PreparedFunctionImpl::execute(FunctionContext* context, Block& block,
                                      const ColumnNumbers& args, uint32_t result,
                                      size_t input_rows_count, bool dry_run) const {
+    bool executed = false;
+    RETURN_IF_ERROR(default_implementation_for_low_cardinality_columns(
+            context, block, args, result, input_rows_count, dry_run, &executed));
+    if (executed) {
+        return Status::OK();
+    }
     return execute_without_low_cardinality_columns(context, block, args, result, input_rows_count,
                                                    dry_run);
 }
@@ -110,6 +110,13 @@ public:
       */
     virtual bool use_default_implementation_for_constants() const { return true; }
 
+    /** If the function has exactly one non-constant argument, a string column with few distinct
+      *  values in this block, the function is executed once per distinct value and the result is
+      *  gathered back to the rows. Only for deterministic functions whose result of a row depends
+      *  on that row alone.
+      */
+    virtual bool use_default_implementation_for_low_cardinality() const { return false; }
+
     /** If use_default_implementation_for_nulls() is true, after execute the function,
       * whether need to replace the nested data of null data to the default value.
       * E.g. for binary arithmetic exprs, need return true to avoid false overflow.
@@ -151,6 +158,9 @@ private:
                                                          const ColumnNumbers& args, uint32_t result,
                                                          size_t input_rows_count, bool dry_run,
                                                          bool* executed) const;
+    Status default_implementation_for_low_cardinality_columns(
+            FunctionContext* context, Block& block, const ColumnNumbers& args, uint32_t result,
+            size_t input_rows_count, bool dry_run, bool* executed) const;
     Status execute_without_low_cardinality_columns(FunctionContext* context, Block& block,
                                                    const ColumnNumbers& arguments, uint32_t result,
                                                    size_t input_rows_count, bool dry_run) const;
@@ -463,6 +473,9 @@ protected:
     bool use_default_implementation_for_constants() const final {
         return function->use_default_implementation_for_constants();
     }
+    bool use_default_implementation_for_low_cardinality() const final {
+        return function->use_default_implementation_for_low_cardinality();
+    }
     ColumnNumbers get_arguments_that_are_always_constant() const final {
         return function->get_arguments_that_are_always_constant();
     }
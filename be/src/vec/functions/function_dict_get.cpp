@@ -19,6 +19,7 @@
 
 #include "common/logging.h"
 #include "common/status.h"
+#include "util/stopwatch.hpp"
 #include "vec/columns/column.h"
 #include "vec/core/types.h"
 #include "vec/data_types/data_type_decimal.h"
@@ -101,8 +102,11 @@ public:
 
         // key_type is not nullable, but key_column may be nullable
         // wiil check key_column in dict::getColumn
+        MonotonicStopWatch watch;
+        watch.start();
         auto res = dict->get_column(attribute_name, attribute_type, key_column,
                                     remove_nullable(key_type));
+        dict->record_lookup(key_column->size(), watch.elapsed_time());
 
         block.replace_by_position(result, std::move(res));
 
@@ -20,6 +20,7 @@
 
 #include "common/logging.h"
 #include "common/status.h"
+#include "util/stopwatch.hpp"
 #include "vec/columns/column.h"
 #include "vec/columns/column_array.h"
 #include "vec/columns/column_struct.h"
@@ -119,8 +120,11 @@ public:
                 assert_cast<const DataTypeStruct&>(*block.get_by_position(arguments[2]).type)
                         .get_elements());
 
+        MonotonicStopWatch watch;
+        watch.start();
         auto result_columns =
                 dict->get_tuple_columns(attribute_names, attribute_types, key_columns, key_types);
+        dict->record_lookup(key_struct_column->size(), watch.elapsed_time());
 
         block.replace_by_position(result, ColumnStruct::create(result_columns));
 
@@ -21,6 +21,7 @@
 #include <string>
 #include <vector>
 
+#include "common/config.h"
 #include "jni.h"
 #include "runtime/user_function_cache.h"
 #include "util/jni-util.h"
@@ -85,6 +86,10 @@ Status JavaFunctionCall::open(FunctionContext* context, FunctionContext::Functio
         }
         RETURN_ERROR_IF_EXC(env);
         RETURN_IF_ERROR(JniUtil::LocalToGlobalRef(env, jni_ctx->executor, &jni_ctx->executor));
+        if (config::enable_udf_result_memoization) {
+            jni_ctx->result_memo =
+                    std::make_unique<UdfResultMemo>(config::udf_result_memo_capacity);
+        }
         jni_ctx->open_successes = true;
     }
     return Status::OK();
@@ -93,11 +98,24 @@ Status JavaFunctionCall::open(FunctionContext* context, FunctionContext::Functio
 Status JavaFunctionCall::execute_impl(FunctionContext* context, Block& block,
                                       const ColumnNumbers& arguments, uint32_t result,
                                       size_t num_rows) const {
-    JNIEnv* env = nullptr;
-    RETURN_IF_ERROR(JniUtil::GetJNIEnv(&env));
     JniContext* jni_ctx = reinterpret_cast<JniContext*>(
             context->get_function_state(FunctionContext::THREAD_LOCAL));
     SCOPED_TIMER(context->get_udf_execute_timer());
+    if (jni_ctx->result_memo) {
+        return jni_ctx->result_memo->execute(
+                block, arguments, result, num_rows,
+                [&](Block& b, const ColumnNumbers& args, uint32_t res, size_t rows) {
+                    return _call_executor(jni_ctx, b, args, res, rows);
+                });
+    }
+    return _call_executor(jni_ctx, block, arguments, result, num_rows);
+}
+
+Status JavaFunctionCall::_call_executor(JniContext* jni_ctx, Block& block,
+                                        const ColumnNumbers& arguments, uint32_t result,
+                                        size_t num_rows) const {
+    JNIEnv* env = nullptr;
+    RETURN_IF_ERROR(JniUtil::GetJNIEnv(&env));
     std::unique_ptr<long[]> input_table;
     RETURN_IF_ERROR(JniConnector::to_java_table(&block, num_rows, arguments, input_table));
     auto input_table_schema = JniConnector::parse_table_schema(&block, arguments, true);
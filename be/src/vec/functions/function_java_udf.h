@@ -38,6 +38,7 @@
 #include "vec/core/types.h"
 #include "vec/data_types/data_type.h"
 #include "vec/functions/function.h"
+#include "vec/functions/udf_result_memo.h"
 
 namespace doris::vectorized {
 
@@ -109,6 +110,11 @@ public:
     bool is_udf_function() const override { return true; }
 
 private:
+    struct JniContext;
+
+    Status _call_executor(JniContext* jni_ctx, Block& block, const ColumnNumbers& arguments,
+                          uint32_t result, size_t num_rows) const;
+
     const TFunction& fn_;
     const DataTypes _argument_types;
     const DataTypePtr _return_type;
@@ -124,6 +130,8 @@ private:
         jobject executor = nullptr;
         bool is_closed = false;
         bool open_successes = false;
+        // set when enable_udf_result_memoization is on
+        std::unique_ptr<UdfResultMemo> result_memo;
 
         JniContext() = default;
 
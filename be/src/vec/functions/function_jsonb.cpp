@@ -34,6 +34,7 @@
 #include "udf/udf.h"
 #include "util/jsonb_document.h"
 #include "util/jsonb_parser_simd.h"
+#include "util/jsonb_path_trie.h"
 #include "util/jsonb_stream.h"
 #include "util/jsonb_utils.h"
 #include "util/jsonb_writer.h"
@@ -954,6 +955,15 @@ public:
             }
         }
 
+        // Several constant paths without wildcards are evaluated in one walk per document.
+        JsonbPathTrie path_trie;
+        std::vector<const JsonbValue*> path_values;
+        bool use_path_trie = rdata_columns.size() > 1;
+        for (size_t pi = 0; use_path_trie && pi < rdata_columns.size(); ++pi) {
+            use_path_trie = path_const[pi] && !(r_null_maps[pi] && (*r_null_maps[pi])[0]) &&
+                            path_trie.add_path(json_path_list[pi], pi);
+        }
+
         for (size_t i = 0; i < input_rows_count; ++i) {
             if (null_map[i]) {
                 continue;
@@ -988,7 +998,21 @@ public:
                 JsonbDocument* doc = nullptr;
                 auto st = JsonbDocument::checkAndCreateDocument(l_raw, l_size, &doc);
 
-                for (size_t pi = 0; pi < rdata_columns.size(); ++pi) {
+                if (use_path_trie) {
+                    path_trie.find_values(st.ok() && doc ? doc->getValue() : nullptr,
+                                          path_values);
+                    for (const auto* value : path_values) {
+                        if (value) {
+                            if (!has_value) {
+                                has_value = true;
+                                writer->writeStartArray();
+                            }
+                            writer->writeValue(value);
+                        }
+                    }
+                }
+
+                for (size_t pi = 0; !use_path_trie && pi < rdata_columns.size(); ++pi) {
                     if (!st.ok() || !doc || !doc->getValue()) [[unlikely]] {
                         continue;
                     }
@@ -26,6 +26,7 @@
 #include <memory>
 #include <utility>
 
+#include "common/config.h"
 #include "common/status.h"
 #include "runtime/exec_env.h"
 #include "util/brpc_client_cache.h"
@@ -40,10 +41,25 @@ RPCFnImpl::RPCFnImpl(const TFunction& fn) : _fn(fn) {
     _client = ExecEnv::GetInstance()->brpc_function_client_cache()->get_client(_server_addr);
     _signature = fmt::format("{}: [{}/{}]", _fn.name.function_name, _fn.hdfs_location,
                              _fn.scalar_fn.symbol);
+    if (config::enable_udf_result_memoization) {
+        _result_memo = std::make_unique<UdfResultMemo>(config::udf_result_memo_capacity);
+    }
 }
 
 Status RPCFnImpl::vec_call(FunctionContext* context, Block& block, const ColumnNumbers& arguments,
                            uint32_t result, size_t input_rows_count) {
+    if (_result_memo) {
+        return _result_memo->execute(
+                block, arguments, result, input_rows_count,
+                [this](Block& b, const ColumnNumbers& args, uint32_t res, size_t rows) {
+                    return _call(b, args, res, rows);
+                });
+    }
+    return _call(block, arguments, result, input_rows_count);
+}
+
+Status RPCFnImpl::_call(Block& block, const ColumnNumbers& arguments, uint32_t result,
+                        size_t input_rows_count) {
     PFunctionCallRequest request;
     PFunctionCallResponse response;
     if (_client == nullptr) {
@@ -34,6 +34,7 @@
 #include "vec/core/types.h"
 #include "vec/data_types/data_type.h"
 #include "vec/functions/function.h"
+#include "vec/functions/udf_result_memo.h"
 
 namespace doris {
 class PFunctionCallRequest;
@@ -52,6 +53,8 @@ public:
     bool available() { return _client != nullptr; }
 
 private:
+    Status _call(Block& block, const ColumnNumbers& arguments, uint32_t result,
+                 size_t input_rows_count);
     Status _convert_block_to_proto(vectorized::Block& block,
                                    const vectorized::ColumnNumbers& arguments,
                                    size_t input_rows_count, PFunctionCallRequest* request);
@@ -62,6 +65,8 @@ private:
     std::string _server_addr;
     std::string _signature;
     TFunction _fn;
+    // set when enable_udf_result_memoization is on, shared by all instances of the fragment
+    std::unique_ptr<UdfResultMemo> _result_memo;
 };
 
 class RPCPreparedFunction : public IPreparedFunction {
@@ -409,6 +409,7 @@ public:
     static constexpr auto name = SubstringUtil::name;
     String get_name() const override { return name; }
     static FunctionPtr create() { return std::make_shared<FunctionSubstring<Impl>>(); }
+    bool use_default_implementation_for_low_cardinality() const override { return true; }
 
     DataTypePtr get_return_type_impl(const DataTypes& arguments) const override {
         return std::make_shared<DataTypeString>();
@@ -818,6 +819,7 @@ public:
     static constexpr auto name = "concat";
     static FunctionPtr create() { return std::make_shared<FunctionStringConcat>(); }
     String get_name() const override { return name; }
+    bool use_default_implementation_for_low_cardinality() const override { return true; }
     size_t get_number_of_arguments() const override { return 0; }
     bool is_variadic() const override { return true; }
 
@@ -42,6 +42,8 @@ public:
 
     size_t get_number_of_arguments() const override { return 1; }
 
+    bool use_default_implementation_for_low_cardinality() const override { return true; }
+
     DataTypePtr get_return_type_impl(const DataTypes& arguments) const override {
         if (!is_string_type(arguments[0]->get_primitive_type())) {
             throw doris::Exception(ErrorCode::INVALID_ARGUMENT,
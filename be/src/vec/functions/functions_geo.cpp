@@ -654,24 +654,42 @@ struct StRelationFunction {
         }
     }
 
+    // Decoding a shape, e.g. building the S2 loops of a fence polygon, costs far more than the
+    // relation check itself, so the constant side is decoded only once for the whole column.
+    template <bool const_is_left>
+    static void const_shape_loop(const ColumnPtr& const_column, const ColumnPtr& vector_column,
+                                 ColumnUInt8::MutablePtr& res, NullMap& null_map,
+                                 const size_t size) {
+        auto const_value = const_column->get_data_at(0);
+        auto const_shape = GeoShape::from_encoded(const_value.data, const_value.size);
+        if (!const_shape) {
+            std::fill(null_map.begin(), null_map.begin() + size, 1);
+            return;
+        }
+        auto& res_data = res->get_data();
+        for (size_t row = 0; row < size; ++row) {
+            auto value = vector_column->get_data_at(row);
+            auto shape = GeoShape::from_encoded(value.data, value.size);
+            if (!shape) {
+                null_map[row] = 1;
+                continue;
+            }
+            if constexpr (const_is_left) {
+                res_data[row] = Func::evaluate(const_shape.get(), shape.get());
+            } else {
+                res_data[row] = Func::evaluate(shape.get(), const_shape.get());
+            }
+        }
+    }
+
     static void const_vector(const ColumnPtr& left_column, const ColumnPtr& right_column,
                              ColumnUInt8::MutablePtr& res, NullMap& null_map, const size_t size) {
-        auto lhs_value = left_column->get_data_at(0);
-        std::vector<std::unique_ptr<GeoShape>> shapes(2);
-        for (int row = 0; row < size; ++row) {
-            auto rhs_value = right_column->get_data_at(row);
-            loop_do(lhs_value, rhs_value, shapes, res, null_map, row);
-        }
+        const_shape_loop<true>(left_column, right_column, res, null_map, size);
     }
 
     static void vector_const(const ColumnPtr& left_column, const ColumnPtr& right_column,
                              ColumnUInt8::MutablePtr& res, NullMap& null_map, const size_t size) {
-        auto rhs_value = right_column->get_data_at(0);
-        std::vector<std::unique_ptr<GeoShape>> shapes(2);
-        for (int row = 0; row < size; ++row) {
-            auto lhs_value = left_column->get_data_at(row);
-            loop_do(lhs_value, rhs_value, shapes, res, null_map, row);
-        }
+        const_shape_loop<false>(right_column, left_column, res, null_map, size);
     }
 
     static void vector_vector(const ColumnPtr& left_column, const ColumnPtr& right_column,
@@ -27,6 +27,7 @@
 #include <vector>
 
 #include "common/logging.h"
+#include "exprs/string_functions.h"
 #include "vec/columns/column.h"
 #include "vec/columns/column_const.h"
 #include "vec/columns/column_vector.h"
@@ -398,12 +399,10 @@ Status FunctionLikeBase::constant_regex_fn_scalar(LikeSearchState* state, const
 
 Status FunctionLikeBase::regexp_fn_scalar(LikeSearchState* state, const StringRef& val,
                                           const StringRef& pattern, unsigned char* result) {
-    RE2::Options opts;
-    opts.set_never_nl(false);
-    opts.set_dot_nl(true);
-    re2::RE2 re(re2::StringPiece(pattern.data, pattern.size), opts);
-    if (re.ok()) {
-        *result = RE2::PartialMatch(re2::StringPiece(val.data, val.size), re);
+    std::string error_str;
+    std::shared_ptr<re2::RE2> re;
+    if (StringFunctions::compile_regex(pattern, &error_str, StringRef(), StringRef(), re)) {
+        *result = RE2::PartialMatch(re2::StringPiece(val.data, val.size), *re);
     } else {
         return Status::RuntimeError("Invalid pattern: {}", pattern.debug_string());
     }
@@ -178,6 +178,7 @@ class FunctionLikeBase : public IFunction {
 public:
     size_t get_number_of_arguments() const override { return 0; }
     bool is_variadic() const override { return true; }
+    bool use_default_implementation_for_low_cardinality() const override { return true; }
 
     DataTypePtr get_return_type_impl(const DataTypes& /*arguments*/) const override {
         return std::make_shared<DataTypeUInt8>();
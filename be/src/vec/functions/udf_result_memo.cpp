@@ -0,0 +1,139 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "vec/functions/udf_result_memo.h"
+
+#include <parallel_hashmap/phmap.h>
+
+#include <vector>
+
+#include "vec/columns/column.h"
+#include "vec/common/arena.h"
+#include "vec/common/pod_array.h"
+#include "vec/common/string_ref.h"
+#include "vec/core/column_with_type_and_name.h"
+
+namespace doris::vectorized {
+#include "common/compile_check_begin.h"
+
+Status UdfResultMemo::execute(Block& block, const ColumnNumbers& arguments, uint32_t result,
+                              size_t input_rows_count, const ExecuteFunc& func) {
+    if (_disabled || input_rows_count == 0) {
+        return func(block, arguments, result, input_rows_count);
+    }
+
+    // 1. serialize the argument tuple of every row and deduplicate them
+    Arena arena;
+    phmap::flat_hash_map<StringRef, uint32_t, StringRefHash> distinct_map;
+    std::vector<StringRef> distinct_keys;
+    std::vector<uint32_t> distinct_first_rows;
+    PaddedPODArray<uint32_t> row_to_distinct(input_rows_count);
+    for (size_t row = 0; row < input_rows_count; ++row) {
+        const char* begin = nullptr;
+        size_t size = 0;
+        for (auto arg : arguments) {
+            size += block.get_by_position(arg).column->serialize_value_into_arena(row, arena, begin)
+                            .size;
+        }
+        StringRef key(begin, size);
+        auto [it, inserted] =
+                distinct_map.emplace(key, static_cast<uint32_t>(distinct_keys.size()));
+        if (inserted) {
+            distinct_keys.push_back(key);
+            distinct_first_rows.push_back(static_cast<uint32_t>(row));
+        } else {
+            // the key is already stored, give back its copy
+            arena.rollback(size);
+        }
+        row_to_distinct[row] = it->second;
+    }
+
+    // 2. look up the distinct tuples, the first row of every miss is sent to the function
+    std::vector<std::string> hit_values(distinct_keys.size());
+    std::vector<bool> is_hit(distinct_keys.size(), false);
+    PaddedPODArray<uint32_t> miss_rows;
+    std::vector<uint32_t> miss_distinct;
+    {
+        std::lock_guard<std::mutex> l(_lock);
+        for (uint32_t d = 0; d < distinct_keys.size(); ++d) {
+            is_hit[d] = _cache.get(distinct_keys[d].to_string(), &hit_values[d]);
+            if (!is_hit[d]) {
+                miss_rows.push_back(distinct_first_rows[d]);
+                miss_distinct.push_back(d);
+            }
+        }
+    }
+
+    // 3. call the function on the missing tuples only
+    ColumnPtr miss_result;
+    const auto& result_type = block.get_by_position(result).type;
+    if (!miss_rows.empty()) {
+        // keep the positions of the original block, unused columns are cheap placeholders
+        Block miss_block;
+        for (size_t i = 0; i < block.columns(); ++i) {
+            const auto& col = block.get_by_position(i);
+            miss_block.insert({col.type->create_column_const_with_default_value(miss_rows.size()),
+                               col.type, col.name});
+        }
+        for (auto arg : arguments) {
+            const auto& src = block.get_by_position(arg).column;
+            MutableColumnPtr dst;
+            if (is_column_const(*src)) {
+                dst = src->clone_resized(miss_rows.size());
+            } else {
+                dst = src->clone_empty();
+                dst->insert_indices_from(*src, miss_rows.begin(), miss_rows.end());
+            }
+            miss_block.replace_by_position(arg, std::move(dst));
+        }
+        RETURN_IF_ERROR(func(miss_block, arguments, result, miss_rows.size()));
+        miss_result = miss_block.get_by_position(result).column->convert_to_full_column_if_const();
+
+        std::lock_guard<std::mutex> l(_lock);
+        for (size_t m = 0; m < miss_rows.size(); ++m) {
+            const char* begin = nullptr;
+            auto value = miss_result->serialize_value_into_arena(m, arena, begin);
+            _cache.put(distinct_keys[miss_distinct[m]].to_string(), value.to_string());
+        }
+    }
+
+    // 4. gather the distinct results back to the rows
+    auto distinct_result = result_type->create_column();
+    distinct_result->reserve(distinct_keys.size());
+    size_t miss_pos = 0;
+    for (uint32_t d = 0; d < distinct_keys.size(); ++d) {
+        if (is_hit[d]) {
+            distinct_result->deserialize_and_insert_from_arena(hit_values[d].data());
+        } else {
+            distinct_result->insert_from(*miss_result, miss_pos++);
+        }
+    }
+    auto result_column = result_type->create_column();
+    result_column->insert_indices_from(*distinct_result, row_to_distinct.begin(),
+                                       row_to_distinct.end());
+    block.replace_by_position(result, std::move(result_column));
+
+    _input_rows += input_rows_count;
+    _call_rows += miss_rows.size();
+    if (_input_rows >= MIN_ROWS_BEFORE_DISABLE && _call_rows * 10 > _input_rows * 9) {
+        _disabled = true;
+    }
+    return Status::OK();
+}
+
+#include "common/compile_check_end.h"
+} // namespace doris::vectorized
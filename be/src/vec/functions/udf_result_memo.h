@@ -0,0 +1,63 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <string>
+
+#include "common/status.h"
+#include "util/lru_cache.hpp"
+#include "vec/core/block.h"
+#include "vec/core/column_numbers.h"
+
+namespace doris::vectorized {
+
+// Memoizes an expensive scalar function, such as a java udf or a rpc function, by its argument
+// tuple. Each block is deduplicated first, so the function is only called once per distinct
+// tuple that is not cached yet, and the results are gathered back to the rows.
+// Thread safe, the function itself is called without holding the lock.
+class UdfResultMemo {
+public:
+    using ExecuteFunc = std::function<Status(Block& block, const ColumnNumbers& arguments,
+                                             uint32_t result, size_t input_rows_count)>;
+
+    explicit UdfResultMemo(size_t capacity) : _cache(capacity) {}
+
+    Status execute(Block& block, const ColumnNumbers& arguments, uint32_t result,
+                   size_t input_rows_count, const ExecuteFunc& func);
+
+    int64_t input_rows() const { return _input_rows; }
+    int64_t call_rows() const { return _call_rows; }
+    bool disabled() const { return _disabled; }
+
+private:
+    // stop memoizing when less than 1/10 of the calls are saved once this many rows were seen
+    static constexpr int64_t MIN_ROWS_BEFORE_DISABLE = 65536;
+
+    std::mutex _lock;
+    LruCache<std::string, std::string> _cache;
+    std::atomic<int64_t> _input_rows = 0;
+    std::atomic<int64_t> _call_rows = 0;
+    std::atomic<bool> _disabled = false;
+};
+
+} // namespace doris::vectorized
@@ -21,6 +21,7 @@
 #include <gen_cpp/olap_file.pb.h>
 #include <stdlib.h>
 
+#include <algorithm>
 #include <cstddef>
 #include <ostream>
 
@@ -32,6 +33,7 @@
 #include "olap/field.h"
 #include "olap/iterators.h"
 #include "olap/olap_common.h"
+#include "util/sse_util.hpp"
 #include "vec/columns/column.h"
 #include "vec/common/string_ref.h"
 #include "vec/core/column_with_type_and_name.h"
@@ -131,33 +133,41 @@ bool RowSourcesBuffer::get_agg_flag(uint64_t index) {
     return ori.agg_flag();
 }
 
-size_t RowSourcesBuffer::continuous_agg_count(uint64_t index) {
-    size_t result = 1;
-    int64_t start = index + 1;
-    int64_t end = _buffer.size();
-    while (start < end) {
-        RowSource next(_buffer[start++]);
-        if (next.agg_flag()) {
-            ++result;
-        } else {
+// return the first position in [begin, end) whose masked value differs from expected
+static size_t find_first_mismatch(const uint16_t* data, size_t begin, size_t end, uint16_t mask,
+                                  uint16_t expected) {
+    size_t pos = begin;
+#if defined(__SSE2__) || defined(__aarch64__)
+    const __m128i mask8 = _mm_set1_epi16(static_cast<int16_t>(mask));
+    const __m128i expected8 = _mm_set1_epi16(static_cast<int16_t>(expected));
+    for (; pos + 8 <= end; pos += 8) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + pos));
+        auto eq = static_cast<uint32_t>(
+                _mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(v, mask8), expected8)));
+        if (eq != 0xFFFF) {
+            return pos + static_cast<size_t>(__builtin_ctz(~eq)) / 2;
+        }
+    }
+#endif
+    for (; pos < end; ++pos) {
+        if ((data[pos] & mask) != expected) {
             break;
         }
     }
-    return result;
+    return pos;
+}
+
+size_t RowSourcesBuffer::continuous_agg_count(uint64_t index) {
+    size_t end = find_first_mismatch(_buffer.data(), index + 1, _buffer.size(),
+                                     RowSource::AGG_FLAG, RowSource::AGG_FLAG);
+    return end - index;
 }
 
 size_t RowSourcesBuffer::same_source_count(uint16_t source, size_t limit) {
-    int result = 1;
-    int64_t start = _buf_idx + 1;
-    int64_t end = _buffer.size();
-    while (result < limit && start < end) {
-        RowSource next(_buffer[start++]);
-        if (source != next.get_source_num()) {
-            break;
-        }
-        ++result;
-    }
-    return result;
+    size_t end = std::min<size_t>(_buffer.size(), _buf_idx + std::max<size_t>(limit, 1));
+    return find_first_mismatch(_buffer.data(), _buf_idx + 1, end, RowSource::SOURCE_FLAG,
+                               source) -
+           _buf_idx;
 }
 
 Status RowSourcesBuffer::_create_buffer_file() {
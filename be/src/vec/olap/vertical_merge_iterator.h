@@ -59,10 +59,11 @@ public:
     void set_agg_flag(bool agg_flag);
     uint16_t data() const;
 
-private:
-    uint16_t _data;
     static const uint16_t SOURCE_FLAG = 0x7FFF;
     static const uint16_t AGG_FLAG = 0x8000;
+
+private:
+    uint16_t _data;
 };
 
 /* rows source buffer
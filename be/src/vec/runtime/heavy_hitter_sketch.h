@@ -0,0 +1,92 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <parallel_hashmap/phmap.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace doris::vectorized {
+#include "common/compile_check_begin.h"
+
+// Space-Saving sketch over 32 bit hash values. It keeps `capacity` counters, every value whose
+// frequency exceeds total / capacity is guaranteed to be tracked, and the count of a tracked
+// value is overestimated by at most its `error`.
+class HeavyHitterSketch {
+public:
+    struct Entry {
+        uint32_t value;
+        uint64_t count;
+        uint64_t error;
+    };
+
+    explicit HeavyHitterSketch(size_t capacity) : _capacity(std::max<size_t>(capacity, 1)) {
+        _entries.reserve(_capacity);
+        _index.reserve(_capacity);
+    }
+
+    void update(uint32_t value, uint64_t count = 1) {
+        _total += count;
+        if (auto it = _index.find(value); it != _index.end()) {
+            _entries[it->second].count += count;
+            return;
+        }
+        if (_entries.size() < _capacity) {
+            _index.emplace(value, _entries.size());
+            _entries.push_back({value, count, 0});
+            return;
+        }
+        // replace the least frequent value, its count becomes the error bound of the new one
+        auto min_it = std::min_element(_entries.begin(), _entries.end(),
+                                       [](const Entry& a, const Entry& b) {
+                                           return a.count < b.count;
+                                       });
+        _index.erase(min_it->value);
+        _index.emplace(value, static_cast<size_t>(min_it - _entries.begin()));
+        *min_it = {value, min_it->count + count, min_it->count};
+    }
+
+    uint64_t total() const { return _total; }
+
+    // Values that are guaranteed to account for at least `min_share` of all updates,
+    // hottest first.
+    std::vector<Entry> heavy_hitters(double min_share) const {
+        std::vector<Entry> result;
+        const auto threshold = static_cast<double>(_total) * min_share;
+        for (const auto& entry : _entries) {
+            if (static_cast<double>(entry.count - entry.error) >= threshold) {
+                result.push_back(entry);
+            }
+        }
+        std::sort(result.begin(), result.end(),
+                  [](const Entry& a, const Entry& b) { return a.count > b.count; });
+        return result;
+    }
+
+private:
+    const size_t _capacity;
+    uint64_t _total = 0;
+    std::vector<Entry> _entries;
+    phmap::flat_hash_map<uint32_t, size_t> _index;
+};
+
+#include "common/compile_check_end.h"
+} // namespace doris::vectorized
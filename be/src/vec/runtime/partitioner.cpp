@@ -49,6 +49,12 @@ Status Crc32HashPartitioner<ChannelIds>::do_partitioning(RuntimeState* state, Bl
             _do_hash(col, hashes, j);
         }
 
+        if (_skew_sketch != nullptr) {
+            for (size_t i = 0; i < rows; i += SKEW_SAMPLE_STEP) {
+                _skew_sketch->update(hashes[i]);
+            }
+        }
+
         for (size_t i = 0; i < rows; i++) {
             hashes[i] = ChannelIds()(hashes[i], _partition_count);
         }
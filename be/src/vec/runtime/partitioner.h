@@ -20,6 +20,7 @@
 #include "util/runtime_profile.h"
 #include "vec/exprs/vexpr.h"
 #include "vec/exprs/vexpr_context.h"
+#include "vec/runtime/heavy_hitter_sketch.h"
 
 namespace doris::vectorized {
 #include "common/compile_check_begin.h"
@@ -85,6 +86,10 @@ public:
 
     Status clone(RuntimeState* state, std::unique_ptr<PartitionerBase>& partitioner) override;
 
+    // Sample the partition hash of every SKEW_SAMPLE_STEP-th row into `sketch` to find hot keys.
+    void set_skew_sketch(HeavyHitterSketch* sketch) { _skew_sketch = sketch; }
+    static constexpr size_t SKEW_SAMPLE_STEP = 8;
+
 protected:
     Status _get_partition_column_result(Block* block, std::vector<int>& result) const {
         int counter = 0;
@@ -98,6 +103,7 @@ protected:
 
     VExprContextSPtrs _partition_expr_ctxs;
     mutable std::vector<uint32_t> _hash_vals;
+    HeavyHitterSketch* _skew_sketch = nullptr;
 };
 
 struct ShuffleChannelIds {
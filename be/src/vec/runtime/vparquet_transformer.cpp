@@ -20,6 +20,7 @@
 #include <arrow/io/type_fwd.h>
 #include <arrow/table.h>
 #include <arrow/util/key_value_metadata.h>
+#include <arrow/util/thread_pool.h>
 #include <glog/logging.h>
 #include <parquet/column_writer.h>
 #include <parquet/platform.h>
@@ -27,6 +28,7 @@
 #include <parquet/type_fwd.h>
 #include <parquet/types.h>
 
+#include <algorithm>
 #include <ctime>
 #include <exception>
 #include <ostream>
@@ -177,6 +179,26 @@ void ParquetBuildHelper::build_version(parquet::WriterProperties::Builder& build
     }
 }
 
+// Shared by all parquet writers. The column chunk tasks never wait on each other and are only
+// awaited by sink threads, which are not part of this pool, so sharing it can not deadlock.
+static arrow::internal::Executor* parquet_encode_executor() {
+    static std::shared_ptr<arrow::internal::ThreadPool> pool = []() {
+        std::shared_ptr<arrow::internal::ThreadPool> res;
+        if (config::parquet_writer_encode_thread_num > 0) {
+            auto pool_result =
+                    arrow::internal::ThreadPool::Make(config::parquet_writer_encode_thread_num);
+            if (pool_result.ok()) {
+                res = std::move(pool_result).ValueUnsafe();
+            } else {
+                LOG(WARNING) << "failed to create parquet encode thread pool: "
+                             << pool_result.status().ToString();
+            }
+        }
+        return res;
+    }();
+    return pool.get();
+}
+
 VParquetTransformer::VParquetTransformer(RuntimeState* state, doris::io::FileWriter* file_writer,
                                          const VExprContextSPtrs& output_vexpr_ctxs,
                                          std::vector<std::string> column_names,
@@ -232,6 +254,12 @@ Status VParquetTransformer::_parse_properties() {
             arrow_builder.enable_deprecated_int96_timestamps();
         }
         arrow_builder.store_schema();
+        // Columns of a buffered row group are encoded and compressed in parallel when it is
+        // flushed.
+        if (auto* executor = parquet_encode_executor(); executor != nullptr) {
+            arrow_builder.set_use_threads(true);
+            arrow_builder.set_executor(executor);
+        }
         _arrow_properties = arrow_builder.build();
     } catch (const parquet::ParquetException& e) {
         return Status::InternalError("parquet writer parse properties error: {}", e.what());
@@ -287,7 +315,7 @@ Status VParquetTransformer::write(const Block& block) {
     }
     RETURN_DORIS_STATUS_IF_ERROR(_writer->WriteRecordBatch(*result));
     _write_size += block.bytes();
-    if (_write_size >= doris::config::min_row_group_size) {
+    if (_write_size >= _row_group_size) {
         _write_size = 0;
     }
     return Status::OK();
@@ -302,6 +330,14 @@ arrow::Status VParquetTransformer::_open_file_writer() {
 }
 
 Status VParquetTransformer::open() {
+    // The buffered row group holds the whole uncompressed row group in memory, so it is also
+    // the memory bound of one writer.
+    _row_group_size = doris::config::min_row_group_size;
+    if (_parquet_options.target_file_size > 0) {
+        _row_group_size = std::min(_row_group_size,
+                                   static_cast<uint64_t>(_parquet_options.target_file_size));
+    }
+    _row_group_size = std::max<uint64_t>(_row_group_size, 1);
     RETURN_IF_ERROR(_parse_properties());
     RETURN_IF_ERROR(_parse_schema());
     try {
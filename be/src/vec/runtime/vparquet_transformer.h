@@ -90,6 +90,9 @@ struct ParquetFileOptions {
     TParquetVersion::type parquet_version;
     bool parquet_disable_dictionary = false;
     bool enable_int96_timestamps = false;
+    // Target size of the written file, row groups are kept below it so that a file is not
+    // rolled only after one huge buffered row group. 0 means no target.
+    int64_t target_file_size = 0;
 };
 
 // a wrapper of parquet output stream
@@ -134,6 +137,7 @@ private:
     const ParquetFileOptions _parquet_options;
     const std::string* _iceberg_schema_json;
     uint64_t _write_size = 0;
+    uint64_t _row_group_size = 0;
     const iceberg::Schema* _iceberg_schema;
 };
 
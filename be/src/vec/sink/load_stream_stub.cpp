@@ -24,6 +24,7 @@
 #include "runtime/query_context.h"
 #include "util/brpc_client_cache.h"
 #include "util/debug_points.h"
+#include "util/defer_op.h"
 #include "util/network_util.h"
 #include "util/thrift_util.h"
 #include "util/uid_util.h"
@@ -150,6 +151,12 @@ Status LoadStreamStub::open(BrpcClientCache<PBackendService_Stub>* client_cache,
         return _status;
     }
     _is_init.store(true);
+    MonotonicStopWatch open_watch;
+    open_watch.start();
+    Defer record_open_time {[&]() {
+        _open_time_ns.store(static_cast<int64_t>(open_watch.elapsed_time()),
+                            std::memory_order_relaxed);
+    }};
     _dst_id = node_info.id;
     brpc::StreamOptions opt;
     opt.max_buf_size = cast_set<int>(config::load_stream_max_buf_size);
@@ -392,12 +399,24 @@ Status LoadStreamStub::_send_with_buffer(butil::IOBuf& buf, bool sync) {
     if (!sync && _buffer.size() < config::brpc_streaming_client_batch_bytes) {
         return Status::OK();
     }
-    output.swap(_buffer);
     // acquire send lock while holding buffer lock, to ensure the message order
-    std::lock_guard<decltype(_send_mutex)> send_lock(_send_mutex);
+    std::unique_lock<decltype(_send_mutex)> send_lock(_send_mutex, std::try_to_lock);
+    if (!send_lock.owns_lock()) {
+        // another batch is being written, keep growing this one rather than queueing behind it
+        if (!sync && _buffer.size() < config::load_stream_max_buf_size) {
+            return Status::OK();
+        }
+        send_lock.lock();
+    }
+    output.swap(_buffer);
     buffer_lock.unlock();
     VLOG_DEBUG << "send buf size : " << output.size() << ", sync: " << sync;
+    MonotonicStopWatch write_watch;
+    write_watch.start();
     auto st = _send_with_retry(output);
+    _stream_write_count.fetch_add(1, std::memory_order_relaxed);
+    _stream_write_time_ns.fetch_add(static_cast<int64_t>(write_watch.elapsed_time()),
+                                    std::memory_order_relaxed);
     if (!st.ok()) {
         _handle_failure(output, st);
     }
@@ -226,6 +226,14 @@ public:
         return _bytes_written;
     }
 
+    int64_t open_time_ns() const { return _open_time_ns.load(std::memory_order_relaxed); }
+    int64_t stream_write_count() const {
+        return _stream_write_count.load(std::memory_order_relaxed);
+    }
+    int64_t stream_write_time_ns() const {
+        return _stream_write_time_ns.load(std::memory_order_relaxed);
+    }
+
     Status check_cancel() {
         DBUG_EXECUTE_IF("LoadStreamStub._check_cancel.cancelled",
                         { return Status::InternalError("stream cancelled"); });
@@ -279,6 +287,11 @@ protected:
 
     bthread::Mutex _write_mutex;
     size_t _bytes_written = 0;
+
+    std::atomic<int64_t> _open_time_ns {0};
+    // number of StreamWrite batches and the time spent in them, including EAGAIN waits
+    std::atomic<int64_t> _stream_write_count {0};
+    std::atomic<int64_t> _stream_write_time_ns {0};
 };
 
 // a collection of LoadStreams connect to the same node
@@ -21,6 +21,8 @@
 #include <gen_cpp/PaloInternalService_types.h>
 #include <gen_cpp/internal_service.pb.h>
 
+#include <unordered_set>
+
 #include "runtime/result_block_buffer.h"
 #include "runtime/runtime_state.h"
 #include "runtime/thread_context.h"
@@ -147,6 +149,7 @@ Status VArrowFlightResultWriter::init(RuntimeState* state) {
     _init_profile();
     DCHECK(_sinker);
     _is_dry_run = state->query_options().dry_run_query;
+    _is_streaming = _sinker->is_streaming();
     return Status::OK();
 }
 
@@ -171,12 +174,18 @@ Status VArrowFlightResultWriter::write(RuntimeState* state, Block& input_block)
                                                                        input_block, &block));
 
     {
+        std::shared_ptr<vectorized::Block> output_block;
+        if (_is_streaming) {
+            output_block = _take_over_block(input_block, block);
+        }
         SCOPED_SWITCH_THREAD_MEM_TRACKER_LIMITER(_sinker->mem_tracker());
-        std::unique_ptr<vectorized::MutableBlock> mutable_block =
-                vectorized::MutableBlock::create_unique(block.clone_empty());
-        RETURN_IF_ERROR(mutable_block->merge_ignore_overflow(std::move(block)));
-        std::shared_ptr<vectorized::Block> output_block = vectorized::Block::create_shared();
-        output_block->swap(mutable_block->to_block());
+        if (!_is_streaming) {
+            std::unique_ptr<vectorized::MutableBlock> mutable_block =
+                    vectorized::MutableBlock::create_unique(block.clone_empty());
+            RETURN_IF_ERROR(mutable_block->merge_ignore_overflow(std::move(block)));
+            output_block = vectorized::Block::create_shared();
+            output_block->swap(mutable_block->to_block());
+        }
 
         auto num_rows = output_block->rows();
         // arrow::RecordBatch without `nbytes()` in C++
@@ -200,6 +209,32 @@ Status VArrowFlightResultWriter::write(RuntimeState* state, Block& input_block)
     return status;
 }
 
+std::shared_ptr<Block> VArrowFlightResultWriter::_take_over_block(Block& input_block,
+                                                                  Block& block) {
+    // The pipeline clears the input block in place when reusing it, which would also clear the
+    // output columns (or their nested columns) shared with it, so the input block gets empty
+    // columns and the output block becomes the only owner of the data.
+    for (size_t i = 0; i < input_block.columns(); ++i) {
+        auto& column = input_block.get_by_position(i).column;
+        column = column->clone_empty();
+    }
+    std::unordered_set<const IColumn*> columns;
+    int64_t bytes = 0;
+    for (size_t i = 0; i < block.columns(); ++i) {
+        auto& column = block.get_by_position(i).column;
+        column = column->convert_to_full_column_if_const();
+        if (columns.insert(column.get()).second) {
+            bytes += column->allocated_bytes();
+        }
+    }
+    // The data is released by the sinker's consumer, so charge it to the sinker from now on.
+    thread_context()->thread_mem_tracker_mgr->limiter_mem_tracker()->transfer_to(
+            bytes, _sinker->mem_tracker().get());
+    auto output_block = Block::create_shared();
+    output_block->swap(block);
+    return output_block;
+}
+
 Status VArrowFlightResultWriter::close(Status st) {
     COUNTER_SET(_sent_rows_counter, _written_rows);
     COUNTER_UPDATE(_bytes_sent_counter, _bytes_sent);
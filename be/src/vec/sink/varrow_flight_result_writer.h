@@ -17,6 +17,7 @@
 
 #pragma once
 
+#include "common/config.h"
 #include "common/status.h"
 #include "runtime/result_block_buffer.h"
 #include "runtime/result_writer.h"
@@ -64,14 +65,18 @@ public:
               _arrow_schema(schema),
               _profile("ResultBlockBuffer " + print_id(_fragment_id)),
               _timezone_obj(state->timezone_obj()) {
+        _merge_batches = !config::enable_arrow_flight_result_streaming;
         _serialize_batch_ns_timer = ADD_TIMER(&_profile, "SerializeBatchNsTime");
         _uncompressed_bytes_counter = ADD_COUNTER(&_profile, "UncompressedBytes", TUnit::BYTES);
         _compressed_bytes_counter = ADD_COUNTER(&_profile, "CompressedBytes", TUnit::BYTES);
     }
     ~ArrowFlightResultBlockBuffer() override = default;
+    // Pop the next queued block, the flight reader converts it to an arrow record batch when the
+    // client pulls it. In streaming mode every block is returned as the result sink produced it.
     Status get_arrow_batch(std::shared_ptr<vectorized::Block>* result);
     void get_timezone(cctz::time_zone& timezone_obj) { timezone_obj = _timezone_obj; }
     Status get_schema(std::shared_ptr<arrow::Schema>* arrow_schema);
+    bool is_streaming() const { return !_merge_batches; }
 
 private:
     friend class GetArrowResultBatchCtx;
@@ -98,6 +103,7 @@ public:
 
 private:
     void _init_profile();
+    std::shared_ptr<Block> _take_over_block(Block& input_block, Block& block);
 
     std::shared_ptr<ArrowFlightResultBlockBuffer> _sinker = nullptr;
 
@@ -114,6 +120,8 @@ private:
     RuntimeProfile::Counter* _bytes_sent_counter = nullptr;
     // If true, no block will be sent
     bool _is_dry_run = false;
+    // If true, blocks are handed to the sinker without being copied, see `_take_over_block`
+    bool _is_streaming = false;
 
     uint64_t _bytes_sent = 0;
 };
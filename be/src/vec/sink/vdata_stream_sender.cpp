@@ -34,6 +34,7 @@
 #include <memory>
 #include <random>
 
+#include "common/config.h"
 #include "common/object_pool.h"
 #include "common/status.h"
 #include "exec/tablet_info.h"
@@ -81,7 +82,7 @@ Status Channel::_init_brpc_stub(RuntimeState* state) {
                 "127.0.0.1", _brpc_dest_addr.port);
         network_address.hostname = "127.0.0.1";
     } else {
-        _brpc_stub = state->exec_env()->brpc_internal_client_cache()->get_client(_brpc_dest_addr);
+        _brpc_stub = state->exec_env()->brpc_exchange_client_cache()->get_client(_brpc_dest_addr);
     }
 
     if (!_brpc_stub) {
@@ -336,7 +337,8 @@ Status BlockSerializer::serialize_block(const Block* src, PBlock* dest, size_t n
     size_t uncompressed_bytes = 0, compressed_bytes = 0;
     RETURN_IF_ERROR(src->serialize(_parent->_state->be_exec_version(), dest, &uncompressed_bytes,
                                    &compressed_bytes, _parent->compression_type(),
-                                   _parent->transfer_large_data_by_brpc()));
+                                   _parent->transfer_large_data_by_brpc(),
+                                   config::exchange_column_wise_serialization));
     COUNTER_UPDATE(_parent->_bytes_sent_counter, compressed_bytes * num_receivers);
     COUNTER_UPDATE(_parent->_uncompressed_bytes_counter, uncompressed_bytes * num_receivers);
     COUNTER_UPDATE(_parent->_compress_timer, src->get_compress_time());
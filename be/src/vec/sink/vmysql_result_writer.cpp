@@ -33,9 +33,13 @@
 #include "common/cast_set.h"
 #include "common/compiler_util.h" // IWYU pragma: keep
 #include "common/config.h"
+#include "runtime/exec_env.h"
 #include "runtime/result_block_buffer.h"
 #include "runtime/runtime_state.h"
+#include "runtime/thread_context.h"
 #include "runtime/types.h"
+#include "util/countdown_latch.h"
+#include "util/defer_op.h"
 #include "vec/aggregate_functions/aggregate_function.h"
 #include "vec/columns/column.h"
 #include "vec/columns/column_const.h"
@@ -184,17 +188,6 @@ Status VMysqlResultWriter<is_binary_format>::_write_one_block(RuntimeState* stat
     uint64_t bytes_sent = 0;
     {
         SCOPED_TIMER(_convert_tuple_timer);
-        MysqlRowBuffer<is_binary_format> row_buffer;
-        if constexpr (is_binary_format) {
-            row_buffer.start_binary_row(_output_vexpr_ctxs.size());
-        }
-
-        struct Arguments {
-            const IColumn* column;
-            bool is_const;
-            DataTypeSerDeSPtr serde;
-        };
-
         const size_t num_cols = _output_vexpr_ctxs.size();
         std::vector<Arguments> arguments;
         arguments.reserve(num_cols);
@@ -233,20 +226,13 @@ Status VMysqlResultWriter<is_binary_format>::_write_one_block(RuntimeState* stat
             }
         }
 
-        for (int row_idx = 0; row_idx < num_rows; ++row_idx) {
-            for (size_t col_idx = 0; col_idx < num_cols; ++col_idx) {
-                RETURN_IF_ERROR(arguments[col_idx].serde->write_column_to_mysql(
-                        *(arguments[col_idx].column), row_buffer, row_idx,
-                        arguments[col_idx].is_const, _options));
-            }
-
-            // copy MysqlRowBuffer to Thrift
-            result->result_batch.rows[row_idx].append(row_buffer.buf(), row_buffer.length());
-            bytes_sent += row_buffer.length();
-            row_buffer.reset();
-            if constexpr (is_binary_format) {
-                row_buffer.start_binary_row(_output_vexpr_ctxs.size());
-            }
+        const int parallelism = std::min(config::mysql_result_serialize_parallelism,
+                                         num_rows / PARALLEL_SERIALIZE_MIN_ROWS);
+        if (parallelism > 1 && ExecEnv::GetInstance()->result_serialize_thread_pool()) {
+            RETURN_IF_ERROR(_parallel_serialize_rows(state, arguments, result.get(), num_rows,
+                                                     parallelism, &bytes_sent));
+        } else {
+            RETURN_IF_ERROR(_serialize_rows(arguments, result.get(), 0, num_rows, &bytes_sent));
         }
     }
     {
@@ -267,6 +253,78 @@ Status VMysqlResultWriter<is_binary_format>::_write_one_block(RuntimeState* stat
     return status;
 }
 
+template <bool is_binary_format>
+Status VMysqlResultWriter<is_binary_format>::_serialize_rows(
+        const std::vector<Arguments>& arguments, TFetchDataResult* result, int begin, int end,
+        uint64_t* bytes_sent) const {
+    MysqlRowBuffer<is_binary_format> row_buffer;
+    if constexpr (is_binary_format) {
+        row_buffer.start_binary_row(_output_vexpr_ctxs.size());
+    }
+    for (int row_idx = begin; row_idx < end; ++row_idx) {
+        for (const auto& argument : arguments) {
+            RETURN_IF_ERROR(argument.serde->write_column_to_mysql(
+                    *argument.column, row_buffer, row_idx, argument.is_const, _options));
+        }
+
+        // copy MysqlRowBuffer to Thrift
+        result->result_batch.rows[row_idx].append(row_buffer.buf(), row_buffer.length());
+        *bytes_sent += row_buffer.length();
+        row_buffer.reset();
+        if constexpr (is_binary_format) {
+            row_buffer.start_binary_row(_output_vexpr_ctxs.size());
+        }
+    }
+    return Status::OK();
+}
+
+template <bool is_binary_format>
+Status VMysqlResultWriter<is_binary_format>::_parallel_serialize_rows(
+        RuntimeState* state, const std::vector<Arguments>& arguments, TFetchDataResult* result,
+        int num_rows, int parallelism, uint64_t* bytes_sent) const {
+    // Every task fills its own range of the preallocated rows, so the row order is kept. The
+    // first range is converted by the calling thread.
+    const int rows_per_task = (num_rows + parallelism - 1) / parallelism;
+    std::vector<Status> statuses(parallelism);
+    std::vector<uint64_t> task_bytes(parallelism, 0);
+    auto* thread_pool = ExecEnv::GetInstance()->result_serialize_thread_pool();
+    // The tasks use the stack state of this function, so no exception may leave a range and
+    // every submitted task is waited for before returning.
+    auto serialize_range = [&](int task, int begin, int end) {
+        try {
+            statuses[task] = _serialize_rows(arguments, result, begin, end, &task_bytes[task]);
+        } catch (const Exception& e) {
+            statuses[task] = e.to_status();
+        } catch (const std::exception& e) {
+            statuses[task] = Status::InternalError("convert rows to mysql failed: {}", e.what());
+        }
+    };
+    CountDownLatch latch(parallelism - 1);
+    int submitted_tasks = 0;
+    for (int i = 1; i < parallelism; ++i) {
+        auto begin = i * rows_per_task;
+        auto end = std::min(begin + rows_per_task, num_rows);
+        auto st = thread_pool->submit_func([&, i, begin, end]() {
+            Defer count_down {[&]() { latch.count_down(); }};
+            SCOPED_ATTACH_TASK(state);
+            serialize_range(i, begin, end);
+        });
+        if (!st.ok()) {
+            // Convert the rest of rows in the calling thread.
+            serialize_range(i, begin, num_rows);
+            break;
+        }
+        submitted_tasks++;
+    }
+    serialize_range(0, 0, std::min(rows_per_task, num_rows));
+    latch.arrive_and_wait(parallelism - 1 - submitted_tasks);
+    for (int i = 0; i < parallelism; ++i) {
+        RETURN_IF_ERROR(statuses[i]);
+        *bytes_sent += task_bytes[i];
+    }
+    return Status::OK();
+}
+
 template <bool is_binary_format>
 Status VMysqlResultWriter<is_binary_format>::write(RuntimeState* state, Block& input_block) {
     SCOPED_TIMER(_append_row_batch_timer);
@@ -79,9 +79,24 @@ public:
     Status close(Status status) override;
 
 private:
+    struct Arguments {
+        const IColumn* column;
+        bool is_const;
+        DataTypeSerDeSPtr serde;
+    };
+
+    // Min rows converted by one task when converting a block in parallel
+    static constexpr int PARALLEL_SERIALIZE_MIN_ROWS = 1024;
+
     void _init_profile();
     Status _set_options(const TSerdeDialect::type& serde_dialect);
     Status _write_one_block(RuntimeState* state, Block& block);
+    // Convert rows [begin, end) to MySQL rows in `result`, which is already resized.
+    Status _serialize_rows(const std::vector<Arguments>& arguments, TFetchDataResult* result,
+                           int begin, int end, uint64_t* bytes_sent) const;
+    Status _parallel_serialize_rows(RuntimeState* state, const std::vector<Arguments>& arguments,
+                                    TFetchDataResult* result, int num_rows, int parallelism,
+                                    uint64_t* bytes_sent) const;
 
     std::shared_ptr<MySQLResultBlockBuffer> _sinker = nullptr;
 
@@ -17,6 +17,7 @@
 
 #include "viceberg_partition_writer.h"
 
+#include "common/config.h"
 #include "io/file_factory.h"
 #include "runtime/runtime_state.h"
 #include "vec/columns/column_map.h"
@@ -84,7 +85,8 @@ Status VIcebergPartitionWriter::open(RuntimeState* state, RuntimeProfile* profil
         }
         }
         ParquetFileOptions parquet_options = {parquet_compression_type,
-                                              TParquetVersion::PARQUET_1_0, false, false};
+                                              TParquetVersion::PARQUET_1_0, false, false,
+                                              config::iceberg_sink_max_file_size};
         _file_format_transformer.reset(new VParquetTransformer(
                 state, _file_writer.get(), _write_output_expr_ctxs, _write_column_names, false,
                 parquet_options, _iceberg_schema_json, &_schema));
@@ -19,6 +19,7 @@
 
 #include <aws/s3/model/CompletedPart.h>
 
+#include "common/config.h"
 #include "io/file_factory.h"
 #include "io/fs/s3_file_writer.h"
 #include "runtime/runtime_state.h"
@@ -90,7 +91,8 @@ Status VHivePartitionWriter::open(RuntimeState* state, RuntimeProfile* operator_
         }
         }
         ParquetFileOptions parquet_options = {parquet_compression_type,
-                                              TParquetVersion::PARQUET_1_0, false, true};
+                                              TParquetVersion::PARQUET_1_0, false, true,
+                                              config::hive_sink_max_file_size};
         _file_format_transformer = std::make_unique<VParquetTransformer>(
                 state, _file_writer.get(), _write_output_expr_ctxs, _write_column_names, false,
                 parquet_options);
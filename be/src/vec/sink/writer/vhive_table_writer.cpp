@@ -59,6 +59,8 @@ Status VHiveTableWriter::open(RuntimeState* state, RuntimeProfile* operator_prof
     _open_timer = ADD_TIMER(custom_counters, "OpenTime");
     _close_timer = ADD_TIMER(custom_counters, "CloseTime");
     _write_file_counter = ADD_COUNTER(custom_counters, "WriteFileCount", TUnit::UNIT);
+    _closed_idle_writer_counter =
+            ADD_COUNTER(custom_counters, "ClosedIdlePartitionWriterCount", TUnit::UNIT);
 
     SCOPED_TIMER(_open_timer);
     for (int i = 0; i < _t_sink.hive_table_sink.columns.size(); ++i) {
@@ -97,7 +99,6 @@ Status VHiveTableWriter::write(RuntimeState* state, vectorized::Block& block) {
             _vec_output_expr_ctxs, block, &output_block, false));
     materialize_block_inplace(output_block);
 
-    std::unordered_map<std::shared_ptr<VHivePartitionWriter>, IColumn::Filter> writer_positions;
     _row_count += output_block.rows();
     auto& hive_table_sink = _t_sink.hive_table_sink;
 
@@ -142,8 +143,14 @@ Status VHiveTableWriter::write(RuntimeState* state, vectorized::Block& block) {
         return Status::OK();
     }
 
+    // Cluster the rows by partition first, so that every partition writer receives one batch
+    // per block and a writer is never closed while it still has rows pending.
+    std::vector<std::string> partition_names;
+    std::vector<int> first_positions;
+    std::vector<IColumn::Filter> partition_filters;
     {
         SCOPED_RAW_TIMER(&_partition_writers_dispatch_ns);
+        std::unordered_map<std::string, size_t> partition_indices;
         for (int i = 0; i < output_block.rows(); ++i) {
             std::vector<std::string> partition_values;
             try {
@@ -153,73 +160,101 @@ Status VHiveTableWriter::write(RuntimeState* state, vectorized::Block& block) {
             }
             std::string partition_name = VHiveUtils::make_partition_name(
                     hive_table_sink.columns, _partition_columns_input_index, partition_values);
-
-            auto create_and_open_writer =
-                    [&](const std::string& partition_name, int position,
-                        const std::string* file_name, int file_name_index,
-                        std::shared_ptr<VHivePartitionWriter>& writer_ptr) -> Status {
-                try {
-                    auto writer = _create_partition_writer(output_block, position, file_name,
-                                                           file_name_index);
-                    RETURN_IF_ERROR(writer->open(_state, _operator_profile));
-                    IColumn::Filter filter(output_block.rows(), 0);
-                    filter[position] = 1;
-                    writer_positions.insert({writer, std::move(filter)});
-                    _partitions_to_writers.insert({partition_name, writer});
-                    writer_ptr = writer;
-                } catch (doris::Exception& e) {
-                    return e.to_status();
-                }
-                return Status::OK();
-            };
-
-            auto writer_iter = _partitions_to_writers.find(partition_name);
-            if (writer_iter == _partitions_to_writers.end()) {
-                std::shared_ptr<VHivePartitionWriter> writer;
-                if (_partitions_to_writers.size() + 1 >
-                    config::table_sink_partition_write_max_partition_nums_per_writer) {
-                    return Status::InternalError(
-                            "Too many open partitions {}",
-                            config::table_sink_partition_write_max_partition_nums_per_writer);
-                }
-                RETURN_IF_ERROR(create_and_open_writer(partition_name, i, nullptr, 0, writer));
-            } else {
-                std::shared_ptr<VHivePartitionWriter> writer;
-                if (writer_iter->second->written_len() > config::hive_sink_max_file_size) {
-                    std::string file_name(writer_iter->second->file_name());
-                    int file_name_index = writer_iter->second->file_name_index();
-                    {
-                        SCOPED_RAW_TIMER(&_close_ns);
-                        static_cast<void>(writer_iter->second->close(Status::OK()));
-                    }
-                    writer_positions.erase(writer_iter->second);
-                    _partitions_to_writers.erase(writer_iter);
-                    RETURN_IF_ERROR(create_and_open_writer(partition_name, i, &file_name,
-                                                           file_name_index + 1, writer));
-                } else {
-                    writer = writer_iter->second;
-                }
-                auto writer_pos_iter = writer_positions.find(writer);
-                if (writer_pos_iter == writer_positions.end()) {
-                    IColumn::Filter filter(output_block.rows(), 0);
-                    filter[i] = 1;
-                    writer_positions.insert({writer, std::move(filter)});
-                } else {
-                    writer_pos_iter->second[i] = 1;
-                }
+            auto [iter, inserted] = partition_indices.try_emplace(std::move(partition_name),
+                                                                  partition_names.size());
+            if (inserted) {
+                partition_names.emplace_back(iter->first);
+                first_positions.emplace_back(i);
+                partition_filters.emplace_back(output_block.rows(), 0);
             }
+            partition_filters[iter->second][i] = 1;
         }
     }
-    SCOPED_RAW_TIMER(&_partition_writers_write_ns);
-    output_block.erase(_non_write_columns_indices);
-    for (auto it = writer_positions.begin(); it != writer_positions.end(); ++it) {
+
+    // The partition columns are still needed by the writers created below.
+    Block write_block = output_block;
+    write_block.erase(_non_write_columns_indices);
+    for (size_t i = 0; i < partition_names.size(); ++i) {
+        std::shared_ptr<VHivePartitionWriter> writer;
+        {
+            SCOPED_RAW_TIMER(&_partition_writers_dispatch_ns);
+            RETURN_IF_ERROR(_get_partition_writer(partition_names[i], output_block,
+                                                  first_positions[i], &writer));
+        }
+        SCOPED_RAW_TIMER(&_partition_writers_write_ns);
+        if (partition_names.size() == 1) {
+            RETURN_IF_ERROR(writer->write(write_block));
+            continue;
+        }
         Block filtered_block;
-        RETURN_IF_ERROR(_filter_block(output_block, &it->second, &filtered_block));
-        RETURN_IF_ERROR(it->first->write(filtered_block));
+        RETURN_IF_ERROR(_filter_block(write_block, &partition_filters[i], &filtered_block));
+        RETURN_IF_ERROR(writer->write(filtered_block));
+    }
+    return Status::OK();
+}
+
+Status VHiveTableWriter::_get_partition_writer(const std::string& partition_name,
+                                               vectorized::Block& block, int position,
+                                               std::shared_ptr<VHivePartitionWriter>* writer) {
+    const std::string* file_name = nullptr;
+    std::string rolling_file_name;
+    int file_name_index = 0;
+    auto writer_iter = _partitions_to_writers.find(partition_name);
+    if (writer_iter != _partitions_to_writers.end()) {
+        if (writer_iter->second->written_len() <= config::hive_sink_max_file_size) {
+            *writer = writer_iter->second;
+            _lru_partitions.splice(_lru_partitions.end(), _lru_partitions,
+                                   _lru_partition_pos[partition_name]);
+            return Status::OK();
+        }
+        rolling_file_name = writer_iter->second->file_name();
+        file_name = &rolling_file_name;
+        file_name_index = writer_iter->second->file_name_index() + 1;
+        {
+            SCOPED_RAW_TIMER(&_close_ns);
+            static_cast<void>(writer_iter->second->close(Status::OK()));
+        }
+        _partitions_to_writers.erase(writer_iter);
+        _lru_partitions.erase(_lru_partition_pos[partition_name]);
+        _lru_partition_pos.erase(partition_name);
+    } else if (_partitions_to_writers.size() + 1 >
+               config::table_sink_partition_write_max_partition_nums_per_writer) {
+        if (!config::hive_sink_close_idle_partition_writers || _partitions_to_writers.empty()) {
+            return Status::InternalError(
+                    "Too many open partitions {}",
+                    config::table_sink_partition_write_max_partition_nums_per_writer);
+        }
+        RETURN_IF_ERROR(_close_idle_partition_writer());
+    }
+
+    try {
+        *writer = _create_partition_writer(block, position, file_name, file_name_index);
+    } catch (doris::Exception& e) {
+        return e.to_status();
     }
+    RETURN_IF_ERROR((*writer)->open(_state, _operator_profile));
+    _partitions_to_writers.insert({partition_name, *writer});
+    _lru_partition_pos[partition_name] =
+            _lru_partitions.insert(_lru_partitions.end(), partition_name);
     return Status::OK();
 }
 
+Status VHiveTableWriter::_close_idle_partition_writer() {
+    const std::string& partition_name = _lru_partitions.front();
+    auto writer_iter = _partitions_to_writers.find(partition_name);
+    DCHECK(writer_iter != _partitions_to_writers.end());
+    Status st;
+    {
+        SCOPED_RAW_TIMER(&_close_ns);
+        st = writer_iter->second->close(Status::OK());
+    }
+    _partitions_to_writers.erase(writer_iter);
+    _lru_partition_pos.erase(partition_name);
+    _lru_partitions.pop_front();
+    ++_closed_idle_writer_count;
+    return st;
+}
+
 Status VHiveTableWriter::_filter_block(doris::vectorized::Block& block,
                                        const vectorized::IColumn::Filter* filter,
                                        doris::vectorized::Block* output_block) {
@@ -261,6 +296,8 @@ Status VHiveTableWriter::close(Status status) {
             }
         }
         _partitions_to_writers.clear();
+        _lru_partitions.clear();
+        _lru_partition_pos.clear();
     }
     if (status.ok()) {
         SCOPED_TIMER(_operator_profile->total_time_counter());
@@ -272,6 +309,7 @@ Status VHiveTableWriter::close(Status status) {
         COUNTER_SET(_partition_writers_count, partitions_to_writers_size);
         COUNTER_SET(_close_timer, _close_ns);
         COUNTER_SET(_write_file_counter, _write_file_count);
+        COUNTER_SET(_closed_idle_writer_counter, _closed_idle_writer_count);
     }
     return result_status;
 }
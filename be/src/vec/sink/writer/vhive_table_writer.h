@@ -19,6 +19,8 @@
 
 #include <gen_cpp/DataSinks_types.h>
 
+#include <list>
+
 #include "util/runtime_profile.h"
 #include "vec/columns/column.h"
 #include "vec/exprs/vexpr_fwd.h"
@@ -67,12 +69,23 @@ private:
     Status _filter_block(doris::vectorized::Block& block, const vectorized::IColumn::Filter* filter,
                          doris::vectorized::Block* output_block);
 
+    // Returns the open writer of the partition, rolling it when the file is full and creating
+    // it when absent. The returned writer becomes the most recently used one.
+    Status _get_partition_writer(const std::string& partition_name, vectorized::Block& block,
+                                 int position, std::shared_ptr<VHivePartitionWriter>* writer);
+
+    // Closes the least recently used partition writer so that a new one can be opened.
+    Status _close_idle_partition_writer();
+
     // Currently it is a copy, maybe it is better to use move semantics to eliminate it.
     TDataSink _t_sink;
     RuntimeState* _state = nullptr;
     std::vector<int> _partition_columns_input_index;
     std::set<size_t> _non_write_columns_indices;
     std::unordered_map<std::string, std::shared_ptr<VHivePartitionWriter>> _partitions_to_writers;
+    // Partition names of the open writers, the least recently used one at the front.
+    std::list<std::string> _lru_partitions;
+    std::unordered_map<std::string, std::list<std::string>::iterator> _lru_partition_pos;
 
     VExprContextSPtrs _write_output_vexpr_ctxs;
 
@@ -84,6 +97,7 @@ private:
     int64_t _partition_writers_write_ns = 0;
     int64_t _close_ns = 0;
     int64_t _write_file_count = 0;
+    int64_t _closed_idle_writer_count = 0;
 
     RuntimeProfile::Counter* _written_rows_counter = nullptr;
     RuntimeProfile::Counter* _send_data_timer = nullptr;
@@ -93,6 +107,7 @@ private:
     RuntimeProfile::Counter* _open_timer = nullptr;
     RuntimeProfile::Counter* _close_timer = nullptr;
     RuntimeProfile::Counter* _write_file_counter = nullptr;
+    RuntimeProfile::Counter* _closed_idle_writer_counter = nullptr;
 };
 } // namespace vectorized
 } // namespace doris
@@ -18,6 +18,7 @@
 #include "vec/sink/writer/vtablet_writer_v2.h"
 
 #include <brpc/uri.h>
+#include <bvar/latency_recorder.h>
 #include <gen_cpp/DataSinks_types.h>
 #include <gen_cpp/Descriptors_types.h>
 #include <gen_cpp/Metrics_types.h>
@@ -45,6 +46,7 @@
 #include "util/defer_op.h"
 #include "util/doris_metrics.h"
 #include "util/runtime_profile.h"
+#include "util/time.h"
 #include "util/uid_util.h"
 #include "vec/core/block.h"
 #include "vec/sink/delta_writer_v2_pool.h"
@@ -57,6 +59,11 @@
 namespace doris::vectorized {
 #include "common/compile_check_begin.h"
 
+bvar::LatencyRecorder g_sink_v2_row_distribution_latency_ms("load_sink_v2", "row_distribution_ms");
+bvar::LatencyRecorder g_sink_v2_send_data_latency_ms("load_sink_v2", "send_data_ms");
+bvar::LatencyRecorder g_sink_v2_close_writer_latency_ms("load_sink_v2", "close_writer_ms");
+bvar::LatencyRecorder g_sink_v2_close_wait_latency_ms("load_sink_v2", "close_wait_ms");
+
 VTabletWriterV2::VTabletWriterV2(const TDataSink& t_sink, const VExprContextSPtrs& output_exprs,
                                  std::shared_ptr<pipeline::Dependency> dep,
                                  std::shared_ptr<pipeline::Dependency> fin_dep)
@@ -243,6 +250,13 @@ Status VTabletWriterV2::_init(RuntimeState* state, RuntimeProfile* profile) {
     _close_timer = ADD_TIMER(_operator_profile, "CloseWaitTime");
     _close_writer_timer = ADD_CHILD_TIMER(_operator_profile, "CloseWriterTime", "CloseWaitTime");
     _close_load_timer = ADD_CHILD_TIMER(_operator_profile, "CloseLoadTime", "CloseWaitTime");
+    _load_stream_num_counter = ADD_COUNTER(_operator_profile, "LoadStreamNum", TUnit::UNIT);
+    _load_stream_open_timer = ADD_TIMER(_operator_profile, "LoadStreamOpenTime");
+    _load_stream_write_count_counter =
+            ADD_COUNTER(_operator_profile, "LoadStreamWriteCount", TUnit::UNIT);
+    _load_stream_write_timer = ADD_TIMER(_operator_profile, "LoadStreamWriteTime");
+    _load_stream_bytes_written_counter =
+            ADD_COUNTER(_operator_profile, "LoadStreamBytesWritten", TUnit::BYTES);
 
     if (config::share_delta_writers) {
         _delta_writer_for_tablet = ExecEnv::GetInstance()->delta_writer_v2_pool()->get_or_create(
@@ -637,6 +651,9 @@ Status VTabletWriterV2::close(Status exec_status) {
         COUNTER_SET(_send_data_timer, _send_data_ns);
         COUNTER_SET(_row_distribution_timer, (int64_t)_row_distribution_watch.elapsed_time());
         COUNTER_SET(_validate_data_timer, _block_convertor->validate_data_ns());
+        g_sink_v2_row_distribution_latency_ms
+                << static_cast<int64_t>(_row_distribution_watch.elapsed_time() / 1000000);
+        g_sink_v2_send_data_latency_ms << _send_data_ns / 1000000;
 
         // close DeltaWriters
         {
@@ -654,6 +671,7 @@ Status VTabletWriterV2::close(Status exec_status) {
                 _load_stream_map->save_segments_for_tablet(segments_for_tablet);
             }
         }
+        g_sink_v2_close_writer_latency_ms << _close_writer_timer->value() / 1000000;
 
         _calc_tablets_to_commit();
         const bool is_last_sink = _load_stream_map->release();
@@ -671,6 +689,7 @@ Status VTabletWriterV2::close(Status exec_status) {
         // Do not need to wait after quorum success,
         // for first-stage close_wait only ensure incremental streams load has been completed,
         // unified waiting in the second-stage close_wait.
+        int64_t close_wait_start_ms = MonotonicMillis();
         RETURN_IF_ERROR(_close_wait(_non_incremental_streams(), false));
 
         // send CLOSE_LOAD on all incremental streams if this is the last sink.
@@ -682,6 +701,8 @@ Status VTabletWriterV2::close(Status exec_status) {
 
         // close_wait on all incremental streams, even if this is not the last sink.
         RETURN_IF_ERROR(_close_wait(_all_streams(), true));
+        g_sink_v2_close_wait_latency_ms << MonotonicMillis() - close_wait_start_ms;
+        _update_load_stream_profile();
 
         // calculate and submit commit info
         if (is_last_sink) {
@@ -726,6 +747,27 @@ Status VTabletWriterV2::close(Status exec_status) {
     return status;
 }
 
+void VTabletWriterV2::_update_load_stream_profile() {
+    // the streams are shared by all sinks of this load on this BE, so these are per-load totals
+    int64_t num_streams = 0;
+    int64_t open_time_ns = 0;
+    int64_t write_count = 0;
+    int64_t write_time_ns = 0;
+    int64_t bytes_written = 0;
+    for (const auto& stream : _all_streams()) {
+        num_streams++;
+        open_time_ns += stream->open_time_ns();
+        write_count += stream->stream_write_count();
+        write_time_ns += stream->stream_write_time_ns();
+        bytes_written += stream->bytes_written();
+    }
+    COUNTER_SET(_load_stream_num_counter, num_streams);
+    COUNTER_SET(_load_stream_open_timer, open_time_ns);
+    COUNTER_SET(_load_stream_write_count_counter, write_count);
+    COUNTER_SET(_load_stream_write_timer, write_time_ns);
+    COUNTER_SET(_load_stream_bytes_written_counter, bytes_written);
+}
+
 std::unordered_set<std::shared_ptr<LoadStreamStub>> VTabletWriterV2::_all_streams() {
     std::unordered_set<std::shared_ptr<LoadStreamStub>> all_streams;
     auto streams_for_node = _load_stream_map->get_streams_for_node();
@@ -150,6 +150,8 @@ private:
 
     std::unordered_set<std::shared_ptr<LoadStreamStub>> _non_incremental_streams();
 
+    void _update_load_stream_profile();
+
     std::unordered_set<std::shared_ptr<LoadStreamStub>> _all_streams();
 
     Status _close_wait(std::unordered_set<std::shared_ptr<LoadStreamStub>> unfinished_streams,
@@ -229,6 +231,11 @@ private:
     RuntimeProfile::Counter* _close_timer = nullptr;
     RuntimeProfile::Counter* _close_writer_timer = nullptr;
     RuntimeProfile::Counter* _close_load_timer = nullptr;
+    RuntimeProfile::Counter* _load_stream_num_counter = nullptr;
+    RuntimeProfile::Counter* _load_stream_open_timer = nullptr;
+    RuntimeProfile::Counter* _load_stream_write_count_counter = nullptr;
+    RuntimeProfile::Counter* _load_stream_write_timer = nullptr;
+    RuntimeProfile::Counter* _load_stream_bytes_written_counter = nullptr;
     RuntimeProfile::Counter* _add_partition_request_timer = nullptr;
 
     std::mutex _close_mutex;
@@ -22,6 +22,7 @@
 #include <algorithm>
 
 #include "common/cast_set.h"
+#include "common/config.h"
 #include "common/exception.h"
 #include "io/file_factory.h"
 #include "io/fs/file_reader.h"
@@ -46,7 +47,8 @@ Status SpillReader::open() {
 
     COUNTER_UPDATE(_read_file_count, 1);
 
-    RETURN_IF_ERROR(io::global_local_filesystem()->open_file(file_path_, &file_reader_));
+    io::FileSystemSPtr fs = data_dir_ ? data_dir_->fs() : io::global_local_filesystem();
+    RETURN_IF_ERROR(fs->open_file(file_path_, &file_reader_));
 
     size_t file_size = file_reader_->size();
     DCHECK(file_size >= 16); // max_sub_block_size, block count
@@ -59,9 +61,7 @@ Status SpillReader::open() {
     RETURN_IF_ERROR(file_reader_->read_at(file_size - sizeof(size_t), result, &bytes_read));
     DCHECK(bytes_read == 8); // max_sub_block_size, block count
     total_read_bytes += bytes_read;
-    if (_resource_ctx) {
-        _resource_ctx->io_context()->update_spill_write_bytes_to_local_storage(bytes_read);
-    }
+    _update_io_context_read_bytes(bytes_read);
 
     // read max sub block size
     bytes_read = 0;
@@ -69,9 +69,7 @@ Status SpillReader::open() {
     RETURN_IF_ERROR(file_reader_->read_at(file_size - sizeof(size_t) * 2, result, &bytes_read));
     DCHECK(bytes_read == 8); // max_sub_block_size, block count
     total_read_bytes += bytes_read;
-    if (_resource_ctx) {
-        _resource_ctx->io_context()->update_spill_write_bytes_to_local_storage(bytes_read);
-    }
+    _update_io_context_read_bytes(bytes_read);
 
     size_t buff_size = std::max(block_count_ * sizeof(size_t), max_sub_block_size_);
     read_buff_.reserve(buff_size);
@@ -86,9 +84,7 @@ Status SpillReader::open() {
     total_read_bytes += bytes_read;
     COUNTER_UPDATE(_read_file_size, total_read_bytes);
     ExecEnv::GetInstance()->spill_stream_mgr()->update_spill_read_bytes(total_read_bytes);
-    if (_resource_ctx) {
-        _resource_ctx->io_context()->update_spill_read_bytes_from_local_storage(bytes_read);
-    }
+    _update_io_context_read_bytes(bytes_read);
 
     block_start_offsets_.resize(block_count_ + 1);
     for (size_t i = 0; i < block_count_; ++i) {
@@ -113,48 +109,88 @@ Status SpillReader::read(Block* block, bool* eos) {
         return Status::OK();
     }
 
-    size_t bytes_to_read =
-            block_start_offsets_[read_block_index_ + 1] - block_start_offsets_[read_block_index_];
+    const size_t block_begin = block_start_offsets_[read_block_index_];
+    const size_t block_end = block_start_offsets_[read_block_index_ + 1];
 
-    if (bytes_to_read == 0) {
+    if (block_end == block_begin) {
         ++read_block_index_;
         return Status::OK();
     }
 
-    Slice result(read_buff_.data(), bytes_to_read);
-    size_t bytes_read = 0;
-    {
-        SCOPED_TIMER(_read_file_timer);
-        RETURN_IF_ERROR(file_reader_->read_at(block_start_offsets_[read_block_index_], result,
-                                              &bytes_read));
+    if (block_begin < read_ahead_begin_ || block_end > read_ahead_end_) {
+        RETURN_IF_ERROR(_read_ahead(read_block_index_));
     }
-    DCHECK(bytes_read == bytes_to_read);
+    Slice result(read_buff_.data() + (block_begin - read_ahead_begin_), block_end - block_begin);
 
-    if (bytes_read > 0) {
-        COUNTER_UPDATE(_read_file_size, bytes_read);
-        ExecEnv::GetInstance()->spill_stream_mgr()->update_spill_read_bytes(bytes_read);
-        if (_resource_ctx) {
-            _resource_ctx->io_context()->update_spill_read_bytes_from_local_storage(bytes_read);
+    COUNTER_UPDATE(_read_block_count, 1);
+    {
+        SCOPED_TIMER(_deserialize_timer);
+        if (!pb_block_.ParseFromArray(result.data, cast_set<int>(result.size))) {
+            return Status::InternalError("Failed to read spilled block");
         }
-        COUNTER_UPDATE(_read_block_count, 1);
-        {
-            SCOPED_TIMER(_deserialize_timer);
-            if (!pb_block_.ParseFromArray(result.data, cast_set<int>(result.size))) {
-                return Status::InternalError("Failed to read spilled block");
-            }
+        if (read_column_ids_.empty()) {
             RETURN_IF_ERROR(block->deserialize(pb_block_));
+        } else {
+            RETURN_IF_ERROR(block->deserialize(pb_block_, read_column_ids_));
         }
-        COUNTER_UPDATE(_read_block_data_size, block->bytes());
-        COUNTER_UPDATE(_read_rows_count, block->rows());
-    } else {
-        block->clear_column_data();
     }
+    COUNTER_UPDATE(_read_block_data_size, block->bytes());
+    COUNTER_UPDATE(_read_rows_count, block->rows());
 
     ++read_block_index_;
 
     return Status::OK();
 }
 
+Status SpillReader::_read_ahead(size_t block_index) {
+    // the wanted block is always read, the blocks after it only while they fit in the limit
+    const size_t begin = block_start_offsets_[block_index];
+    const auto limit = static_cast<size_t>(data_dir_ && data_dir_->is_remote()
+                                                   ? config::spill_remote_read_ahead_bytes
+                                                   : config::spill_read_ahead_bytes);
+    size_t end_index = block_index + 1;
+    while (end_index < block_count_ && block_start_offsets_[end_index + 1] - begin <= limit) {
+        ++end_index;
+    }
+    const size_t end = block_start_offsets_[end_index];
+
+    read_ahead_begin_ = read_ahead_end_ = 0;
+    read_buff_.resize(end - begin);
+    Slice result(read_buff_.data(), end - begin);
+    size_t bytes_read = 0;
+    int64_t read_time_ns = 0;
+    {
+        SCOPED_TIMER(_read_file_timer);
+        SCOPED_RAW_TIMER(&read_time_ns);
+        RETURN_IF_ERROR(file_reader_->read_at(begin, result, &bytes_read));
+    }
+    if (bytes_read != result.size) {
+        return Status::InternalError("Failed to read spilled blocks, expect {} bytes, read {}",
+                                     result.size, bytes_read);
+    }
+    read_ahead_begin_ = begin;
+    read_ahead_end_ = end;
+
+    COUNTER_UPDATE(_read_file_size, bytes_read);
+    ExecEnv::GetInstance()->spill_stream_mgr()->update_spill_read_bytes(bytes_read);
+    _update_io_context_read_bytes(bytes_read);
+    if (data_dir_) {
+        data_dir_->update_spill_read_stats(bytes_read, read_time_ns);
+    }
+    return Status::OK();
+}
+
+void SpillReader::_update_io_context_read_bytes(int64_t bytes) {
+    if (!_resource_ctx) {
+        return;
+    }
+    if (data_dir_ && data_dir_->is_remote()) {
+        _resource_ctx->io_context()->update_spill_read_bytes_from_remote_storage(bytes);
+    } else {
+        _resource_ctx->io_context()->update_spill_read_bytes_from_local_storage(bytes);
+    }
+}
+
 Status SpillReader::close() {
     if (!file_reader_) {
         return Status::OK();
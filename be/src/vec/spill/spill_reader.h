@@ -33,12 +33,14 @@
 namespace doris::vectorized {
 #include "common/compile_check_begin.h"
 class Block;
+class SpillDataDir;
 class SpillReader {
 public:
     SpillReader(std::shared_ptr<ResourceContext> resource_context, int64_t stream_id,
-                std::string file_path)
+                std::string file_path, SpillDataDir* data_dir = nullptr)
             : stream_id_(stream_id),
               file_path_(std::move(file_path)),
+              data_dir_(data_dir),
               _resource_ctx(std::move(resource_context)) {}
 
     ~SpillReader() { (void)close(); }
@@ -51,6 +53,11 @@ public:
 
     void seek(size_t block_index);
 
+    // Only read back the columns at these ascending positions, empty means all columns.
+    void set_read_columns(std::vector<uint32_t> column_ids) {
+        read_column_ids_ = std::move(column_ids);
+    }
+
     int64_t get_id() const { return stream_id_; }
 
     std::string get_path() const { return file_path_; }
@@ -70,8 +77,15 @@ public:
     }
 
 private:
+    // Read the block at block_index and the following ones up to spill_read_ahead_bytes into
+    // read_buff_, so that consecutive read() calls are served from memory.
+    Status _read_ahead(size_t block_index);
+
+    void _update_io_context_read_bytes(int64_t bytes);
+
     int64_t stream_id_;
     std::string file_path_;
+    SpillDataDir* data_dir_ = nullptr;
     io::FileReaderSPtr file_reader_;
 
     size_t block_count_ = 0;
@@ -79,6 +93,10 @@ private:
     size_t max_sub_block_size_ = 0;
     PaddedPODArray<char> read_buff_;
     std::vector<size_t> block_start_offsets_;
+    // file range [read_ahead_begin_, read_ahead_end_) currently held in read_buff_
+    size_t read_ahead_begin_ = 0;
+    size_t read_ahead_end_ = 0;
+    std::vector<uint32_t> read_column_ids_;
 
     PBlock pb_block_;
 
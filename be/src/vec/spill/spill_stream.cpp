@@ -68,6 +68,10 @@ void SpillStream::gc() {
     if (_current_file_size) {
         COUNTER_UPDATE(_current_file_size, -total_written_bytes_);
     }
+    if (data_dir_->is_remote()) {
+        _gc_remote();
+        return;
+    }
     bool exists = false;
     auto status = io::global_local_filesystem()->exists(spill_dir_, &exists);
     if (status.ok() && exists) {
@@ -98,13 +102,37 @@ void SpillStream::gc() {
     total_written_bytes_ = 0;
 }
 
+void SpillStream::_gc_remote() {
+    if (!_remote_data_deleted) {
+        _remote_data_deleted = true;
+        if (_current_file_count) {
+            COUNTER_UPDATE(_current_file_count, -1);
+        }
+        // remote storage can not rename the dir into the gc path, delete it in the background
+        auto* thread_pool = ExecEnv::GetInstance()->spill_stream_mgr()->get_spill_io_thread_pool();
+        auto status = thread_pool->submit_func([fs = data_dir_->fs(), dir = spill_dir_] {
+            auto st = fs->delete_directory(dir);
+            if (!st.ok()) {
+                LOG_EVERY_T(WARNING, 1) << fmt::format(
+                        "failed to delete remote spill data, dir {}, error: {}", dir,
+                        st.to_string());
+            }
+        });
+        if (!status.ok()) {
+            static_cast<void>(data_dir_->fs()->delete_directory(spill_dir_));
+        }
+    }
+    data_dir_->update_spill_data_usage(-total_written_bytes_);
+    total_written_bytes_ = 0;
+}
+
 Status SpillStream::prepare() {
     writer_ = std::make_unique<SpillWriter>(state_->get_query_ctx()->resource_ctx(), profile_,
                                             stream_id_, batch_rows_, data_dir_, spill_dir_);
     _set_write_counters(profile_);
 
     reader_ = std::make_unique<SpillReader>(state_->get_query_ctx()->resource_ctx(), stream_id_,
-                                            writer_->get_file_path());
+                                            writer_->get_file_path(), data_dir_);
 
     DBUG_EXECUTE_IF("fault_inject::spill_stream::prepare_spill", {
         return Status::Error<INTERNAL_ERROR>("fault_inject spill_stream prepare_spill failed");
@@ -118,7 +146,7 @@ Status SpillStream::prepare() {
 
 SpillReaderUPtr SpillStream::create_separate_reader() const {
     return std::make_unique<SpillReader>(state_->get_query_ctx()->resource_ctx(), stream_id_,
-                                         writer_->get_file_path());
+                                         writer_->get_file_path(), data_dir_);
 }
 
 const TUniqueId& SpillStream::query_id() const {
@@ -63,6 +63,10 @@ public:
 
     Status read_next_block_sync(Block* block, bool* eos);
 
+    void set_read_columns(std::vector<uint32_t> column_ids) {
+        reader_->set_read_columns(std::move(column_ids));
+    }
+
     void set_read_counters(RuntimeProfile* operator_profile) {
         reader_->set_counters(operator_profile);
     }
@@ -76,6 +80,8 @@ public:
     bool ready_for_reading() const { return _ready_for_reading; }
 
 private:
+    void _gc_remote();
+
     friend class SpillStreamManager;
 
     Status prepare();
@@ -88,6 +94,7 @@ private:
     // Directory path format specified in SpillStreamManager::register_spill_stream:
     // storage_root/spill/query_id/partitioned_hash_join-node_id-task_id-stream_id
     std::string spill_dir_;
+    bool _remote_data_deleted = false;
     size_t batch_rows_;
     size_t batch_bytes_;
     int64_t total_written_bytes_ = 0;
@@ -22,16 +22,21 @@
 
 #include <algorithm>
 #include <filesystem>
+#include <limits>
 #include <memory>
 #include <numeric>
 #include <random>
 #include <string>
 
+#include "cloud/cloud_storage_engine.h"
+#include "cloud/config.h"
 #include "common/logging.h"
 #include "io/fs/file_system.h"
 #include "io/fs/local_file_system.h"
 #include "olap/olap_define.h"
+#include "runtime/exec_env.h"
 #include "runtime/runtime_state.h"
+#include "service/backend_options.h"
 #include "util/doris_metrics.h"
 #include "util/parse_util.h"
 #include "util/pretty_printer.h"
@@ -150,6 +155,30 @@ std::vector<SpillDataDir*> SpillStreamManager::_get_stores_for_spill(
     return stores;
 }
 
+SpillDataDir* SpillStreamManager::_get_remote_store_for_spill() {
+    if (!config::enable_spill_to_remote_storage || !config::is_cloud_mode()) {
+        return nullptr;
+    }
+    std::lock_guard l(_remote_spill_store_mutex);
+    if (!_remote_spill_store) {
+        auto fs = ExecEnv::GetInstance()->storage_engine().to_cloud().latest_fs();
+        if (fs == nullptr) {
+            return nullptr;
+        }
+        // every backend spills under its own prefix of the storage vault
+        auto path = fmt::format("spill_overflow/{}", BackendOptions::get_be_endpoint());
+        auto dir = std::make_unique<SpillDataDir>(std::move(fs), std::move(path));
+        auto st = dir->init();
+        if (!st.ok()) {
+            LOG(WARNING) << "failed to init remote spill storage: " << st.to_string();
+            return nullptr;
+        }
+        LOG(INFO) << "local spill disks are full, spill to remote storage " << dir->path();
+        _remote_spill_store = std::move(dir);
+    }
+    return _remote_spill_store.get();
+}
+
 Status SpillStreamManager::register_spill_stream(RuntimeState* state, SpillStreamSPtr& spill_stream,
                                                  const std::string& query_id,
                                                  const std::string& operator_name, int32_t node_id,
@@ -159,6 +188,11 @@ Status SpillStreamManager::register_spill_stream(RuntimeState* state, SpillStrea
     if (data_dirs.empty()) {
         data_dirs = _get_stores_for_spill(TStorageMedium::type::HDD);
     }
+    if (data_dirs.empty()) {
+        if (auto* remote_dir = _get_remote_store_for_spill()) {
+            data_dirs.emplace_back(remote_dir);
+        }
+    }
     if (data_dirs.empty()) {
         return Status::Error<ErrorCode::NO_AVAILABLE_ROOT_PATH>(
                 "no available disk can be used for spill.");
@@ -172,7 +206,7 @@ Status SpillStreamManager::register_spill_stream(RuntimeState* state, SpillStrea
         // storage_root/spill/query_id/partitioned_hash_join-node_id-task_id-stream_id
         spill_dir = fmt::format("{}/{}/{}-{}-{}-{}", spill_root_dir, query_id, operator_name,
                                 node_id, state->task_id(), id);
-        auto st = io::global_local_filesystem()->create_directory(spill_dir);
+        auto st = dir->fs()->create_directory(spill_dir);
         if (!st.ok()) {
             std::cerr << "create spill dir failed: " << st.to_string();
             continue;
@@ -263,6 +297,16 @@ void SpillStreamManager::gc(int32_t max_work_time_ms) {
 
 void SpillStreamManager::async_cleanup_query(TUniqueId query_id) {
     (void)get_spill_io_thread_pool()->submit_func([this, query_id] {
+        SpillDataDir* remote_store = nullptr;
+        {
+            std::lock_guard l(_remote_spill_store_mutex);
+            remote_store = _remote_spill_store.get();
+        }
+        if (remote_store) {
+            // remote storage has no cheap rename, delete the files of the query directly
+            static_cast<void>(remote_store->fs()->delete_directory(
+                    remote_store->get_spill_data_path(print_id(query_id))));
+        }
         for (auto& [_, store] : _spill_store_map) {
             std::string query_spill_dir = store->get_spill_data_path(print_id(query_id));
             bool exists = false;
@@ -286,12 +330,31 @@ DEFINE_GAUGE_METRIC_PROTOTYPE_2ARG(spill_disk_avail_capacity, MetricUnit::BYTES)
 DEFINE_GAUGE_METRIC_PROTOTYPE_2ARG(spill_disk_data_size, MetricUnit::BYTES);
 DEFINE_GAUGE_METRIC_PROTOTYPE_2ARG(spill_disk_has_spill_data, MetricUnit::BYTES);
 DEFINE_GAUGE_METRIC_PROTOTYPE_2ARG(spill_disk_has_spill_gc_data, MetricUnit::BYTES);
+DEFINE_COUNTER_METRIC_PROTOTYPE_2ARG(spill_disk_write_bytes, MetricUnit::BYTES);
+DEFINE_COUNTER_METRIC_PROTOTYPE_2ARG(spill_disk_write_time_us, MetricUnit::MICROSECONDS);
+DEFINE_COUNTER_METRIC_PROTOTYPE_2ARG(spill_disk_read_bytes, MetricUnit::BYTES);
+DEFINE_COUNTER_METRIC_PROTOTYPE_2ARG(spill_disk_read_time_us, MetricUnit::MICROSECONDS);
 
 SpillDataDir::SpillDataDir(std::string path, int64_t capacity_bytes,
                            TStorageMedium::type storage_medium)
         : _path(std::move(path)),
+          _fs(io::global_local_filesystem()),
           _disk_capacity_bytes(capacity_bytes),
           _storage_medium(storage_medium) {
+    _register_metrics();
+}
+
+SpillDataDir::SpillDataDir(io::FileSystemSPtr remote_fs, std::string path)
+        : _path(std::move(path)),
+          _fs(std::move(remote_fs)),
+          _disk_capacity_bytes(0),
+          _spill_data_limit_bytes(std::numeric_limits<int64_t>::max()),
+          _storage_medium(TStorageMedium::HDD) {
+    DCHECK(is_remote());
+    _register_metrics();
+}
+
+void SpillDataDir::_register_metrics() {
     spill_data_dir_metric_entity = DorisMetrics::instance()->metric_registry()->register_entity(
             std::string("spill_data_dir.") + _path, {{"path", _path + "/" + SPILL_DIR_PREFIX}});
     INT_GAUGE_METRIC_REGISTER(spill_data_dir_metric_entity, spill_disk_capacity);
@@ -300,6 +363,10 @@ SpillDataDir::SpillDataDir(std::string path, int64_t capacity_bytes,
     INT_GAUGE_METRIC_REGISTER(spill_data_dir_metric_entity, spill_disk_data_size);
     INT_GAUGE_METRIC_REGISTER(spill_data_dir_metric_entity, spill_disk_has_spill_data);
     INT_GAUGE_METRIC_REGISTER(spill_data_dir_metric_entity, spill_disk_has_spill_gc_data);
+    INT_COUNTER_METRIC_REGISTER(spill_data_dir_metric_entity, spill_disk_write_bytes);
+    INT_COUNTER_METRIC_REGISTER(spill_data_dir_metric_entity, spill_disk_write_time_us);
+    INT_COUNTER_METRIC_REGISTER(spill_data_dir_metric_entity, spill_disk_read_bytes);
+    INT_COUNTER_METRIC_REGISTER(spill_data_dir_metric_entity, spill_disk_read_time_us);
 }
 
 bool is_directory_empty(const std::filesystem::path& dir) {
@@ -315,6 +382,10 @@ bool is_directory_empty(const std::filesystem::path& dir) {
 }
 
 Status SpillDataDir::init() {
+    if (is_remote()) {
+        spill_disk_limit->set_value(_spill_data_limit_bytes);
+        return Status::OK();
+    }
     bool exists = false;
     RETURN_IF_ERROR(io::global_local_filesystem()->exists(_path, &exists));
     if (!exists) {
@@ -348,6 +419,9 @@ std::string SpillDataDir::get_spill_data_gc_path(const std::string& sub_dir_name
 }
 
 Status SpillDataDir::update_capacity() {
+    if (is_remote()) {
+        return Status::OK();
+    }
     std::lock_guard<std::mutex> l(_mutex);
     RETURN_IF_ERROR(io::global_local_filesystem()->get_space_info(_path, &_disk_capacity_bytes,
                                                                   &_available_bytes));
@@ -414,12 +488,20 @@ bool SpillDataDir::reach_capacity_limit(int64_t incoming_data_size) {
     return false;
 }
 std::string SpillDataDir::debug_string() {
+    auto bandwidth = [](IntCounter* bytes, IntCounter* time_us) {
+        auto us = time_us->value();
+        auto bytes_per_second =
+                us == 0 ? 0 : static_cast<int64_t>((double)bytes->value() * 1000000 / (double)us);
+        return PrettyPrinter::print_bytes(bytes_per_second) + "/s";
+    };
     return fmt::format(
             "path: {}, capacity: {}, limit: {}, used: {}, available: "
-            "{}",
+            "{}, write bandwidth: {}, read bandwidth: {}",
             _path, PrettyPrinter::print_bytes(_disk_capacity_bytes),
             PrettyPrinter::print_bytes(_spill_data_limit_bytes),
             PrettyPrinter::print_bytes(_spill_data_bytes),
-            PrettyPrinter::print_bytes(_available_bytes));
+            PrettyPrinter::print_bytes(_available_bytes),
+            bandwidth(spill_disk_write_bytes, spill_disk_write_time_us),
+            bandwidth(spill_disk_read_bytes, spill_disk_read_time_us));
 }
 } // namespace doris::vectorized
@@ -23,6 +23,7 @@
 #include <unordered_map>
 #include <vector>
 
+#include "io/fs/file_system.h"
 #include "olap/options.h"
 #include "util/metrics.h"
 #include "util/threadpool.h"
@@ -47,10 +48,18 @@ public:
     SpillDataDir(std::string path, int64_t capacity_bytes,
                  TStorageMedium::type storage_medium = TStorageMedium::HDD);
 
+    // Overflow tier on remote storage, used when all local spill disks are full.
+    // It has no capacity limit and its files are deleted directly instead of being gc'ed.
+    SpillDataDir(io::FileSystemSPtr remote_fs, std::string path);
+
     Status init();
 
     const std::string& path() const { return _path; }
 
+    const io::FileSystemSPtr& fs() const { return _fs; }
+
+    bool is_remote() const { return _fs->type() != io::FileSystemType::LOCAL; }
+
     std::string get_spill_data_path(const std::string& query_id = "") const;
 
     std::string get_spill_data_gc_path(const std::string& sub_dir_name = "") const;
@@ -74,6 +83,18 @@ public:
         return _spill_data_bytes;
     }
 
+    // Disk time is kept next to the bytes, so the achieved bandwidth of every spill dir is
+    // bytes / time in the metrics and in debug_string().
+    void update_spill_write_stats(int64_t bytes, int64_t time_ns) {
+        spill_disk_write_bytes->increment(bytes);
+        spill_disk_write_time_us->increment(time_ns / 1000);
+    }
+
+    void update_spill_read_stats(int64_t bytes, int64_t time_ns) {
+        spill_disk_read_bytes->increment(bytes);
+        spill_disk_read_time_us->increment(time_ns / 1000);
+    }
+
     int64_t get_spill_data_limit() {
         std::lock_guard<std::mutex> l(_mutex);
         return _spill_data_limit_bytes;
@@ -82,6 +103,8 @@ public:
     std::string debug_string();
 
 private:
+    void _register_metrics();
+
     bool _reach_disk_capacity_limit(int64_t incoming_data_size);
     double _get_disk_usage(int64_t incoming_data_size) const {
         return _disk_capacity_bytes == 0
@@ -92,6 +115,7 @@ private:
 
     friend class SpillStreamManager;
     std::string _path;
+    io::FileSystemSPtr _fs;
 
     // protect _disk_capacity_bytes, _available_bytes, _spill_data_limit_bytes, _spill_data_bytes
     std::mutex _mutex;
@@ -108,6 +132,10 @@ private:
     IntGauge* spill_disk_limit = nullptr;
     IntGauge* spill_disk_avail_capacity = nullptr;
     IntGauge* spill_disk_data_size = nullptr;
+    IntCounter* spill_disk_write_bytes = nullptr;
+    IntCounter* spill_disk_write_time_us = nullptr;
+    IntCounter* spill_disk_read_bytes = nullptr;
+    IntCounter* spill_disk_read_time_us = nullptr;
     // for test
     IntGauge* spill_disk_has_spill_data = nullptr;
     IntGauge* spill_disk_has_spill_gc_data = nullptr;
@@ -152,8 +180,12 @@ private:
     Status _init_spill_store_map();
     void _spill_gc_thread_callback();
     std::vector<SpillDataDir*> _get_stores_for_spill(TStorageMedium::type storage_medium);
+    // created on first use, the storage vault may not be known at startup
+    SpillDataDir* _get_remote_store_for_spill();
 
     std::unordered_map<std::string, std::unique_ptr<SpillDataDir>> _spill_store_map;
+    std::mutex _remote_spill_store_mutex;
+    std::unique_ptr<SpillDataDir> _remote_spill_store;
 
     CountDownLatch _stop_background_threads_latch;
     std::unique_ptr<ThreadPool> _spill_io_thread_pool;
@@ -18,6 +18,7 @@
 #include "vec/spill/spill_writer.h"
 
 #include "agent/be_exec_version_manager.h"
+#include "common/config.h"
 #include "common/status.h"
 #include "io/fs/local_file_system.h"
 #include "io/fs/local_file_writer.h"
@@ -32,7 +33,7 @@ Status SpillWriter::open() {
     if (file_writer_) {
         return Status::OK();
     }
-    return io::global_local_filesystem()->create_file(file_path_, &file_writer_);
+    return data_dir_->fs()->create_file(file_path_, &file_writer_);
 }
 
 Status SpillWriter::close() {
@@ -45,16 +46,12 @@ Status SpillWriter::close() {
     meta_.append((const char*)&written_blocks_, sizeof(written_blocks_));
 
     // meta: block1 offset, block2 offset, ..., blockn offset, max_sub_block_size, n
-    {
-        SCOPED_TIMER(_write_file_timer);
-        RETURN_IF_ERROR(file_writer_->append(meta_));
-    }
+    RETURN_IF_ERROR(_append(meta_));
+    RETURN_IF_ERROR(_flush_write_buffer());
 
     total_written_bytes_ += meta_.size();
     COUNTER_UPDATE(_write_file_total_size, meta_.size());
-    if (_resource_ctx) {
-        _resource_ctx->io_context()->update_spill_write_bytes_to_local_storage(meta_.size());
-    }
+    _update_io_context_written_bytes(meta_.size());
     if (_write_file_current_size) {
         COUNTER_UPDATE(_write_file_current_size, meta_.size());
     }
@@ -115,10 +112,11 @@ Status SpillWriter::_write_internal(const Block& block, size_t& written_bytes) {
         {
             PBlock pblock;
             SCOPED_TIMER(_serialize_timer);
-            status = block.serialize(
-                    BeExecVersionManager::get_newest_version(), &pblock, &uncompressed_bytes,
-                    &compressed_bytes,
-                    segment_v2::CompressionTypePB::ZSTD); // ZSTD for better compression ratio
+            // Spill files are column wise so that readers can decode a subset of the columns.
+            // LZ4 keeps spill cheap on cpu, columns that do not shrink are stored as is.
+            status = block.serialize(BeExecVersionManager::get_newest_version(), &pblock,
+                                     &uncompressed_bytes, &compressed_bytes,
+                                     segment_v2::CompressionTypePB::LZ4, false, true);
             RETURN_IF_ERROR(status);
             int64_t pblock_mem = pblock.ByteSizeLong();
             COUNTER_UPDATE(_memory_used_counter, pblock_mem);
@@ -151,10 +149,7 @@ Status SpillWriter::_write_internal(const Block& block, size_t& written_bytes) {
 
                     meta_.append((const char*)&total_written_bytes_, sizeof(size_t));
                     COUNTER_UPDATE(_write_file_total_size, buff_size);
-                    if (_resource_ctx) {
-                        _resource_ctx->io_context()->update_spill_write_bytes_to_local_storage(
-                                buff_size);
-                    }
+                    _update_io_context_written_bytes(buff_size);
                     if (_write_file_current_size) {
                         COUNTER_UPDATE(_write_file_current_size, buff_size);
                     }
@@ -163,15 +158,57 @@ Status SpillWriter::_write_internal(const Block& block, size_t& written_bytes) {
                     ++written_blocks_;
                 }
             }};
-            {
-                SCOPED_TIMER(_write_file_timer);
-                status = file_writer_->append(buff);
-                RETURN_IF_ERROR(status);
-            }
+            status = _append(buff);
+            RETURN_IF_ERROR(status);
         }
     }
 
     return status;
 }
 
+void SpillWriter::_update_io_context_written_bytes(int64_t bytes) {
+    if (!_resource_ctx) {
+        return;
+    }
+    if (data_dir_->is_remote()) {
+        _resource_ctx->io_context()->update_spill_write_bytes_to_remote_storage(bytes);
+    } else {
+        _resource_ctx->io_context()->update_spill_write_bytes_to_local_storage(bytes);
+    }
+}
+
+Status SpillWriter::_append(const Slice& data) {
+    const auto buffer_limit = static_cast<size_t>(config::spill_write_buffer_bytes);
+    if (write_buffer_.empty() && data.size >= buffer_limit) {
+        return _write_to_file(data);
+    }
+    write_buffer_.append(data.data, data.size);
+    COUNTER_UPDATE(_memory_used_counter, data.size);
+    if (write_buffer_.size() >= buffer_limit) {
+        return _flush_write_buffer();
+    }
+    return Status::OK();
+}
+
+Status SpillWriter::_flush_write_buffer() {
+    if (write_buffer_.empty()) {
+        return Status::OK();
+    }
+    auto status = _write_to_file(write_buffer_);
+    COUNTER_UPDATE(_memory_used_counter, -static_cast<int64_t>(write_buffer_.size()));
+    write_buffer_.clear();
+    return status;
+}
+
+Status SpillWriter::_write_to_file(const Slice& data) {
+    int64_t write_time_ns = 0;
+    {
+        SCOPED_TIMER(_write_file_timer);
+        SCOPED_RAW_TIMER(&write_time_ns);
+        RETURN_IF_ERROR(file_writer_->append(data));
+    }
+    data_dir_->update_spill_write_stats(data.size, write_time_ns);
+    return Status::OK();
+}
+
 } // namespace doris::vectorized
\ No newline at end of file
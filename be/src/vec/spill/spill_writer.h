@@ -73,6 +73,16 @@ public:
 private:
     Status _write_internal(const Block& block, size_t& written_bytes);
 
+    // Buffer data smaller than spill_write_buffer_bytes, so that partitions spilling many
+    // small blocks hit the disk with large sequential appends.
+    Status _append(const Slice& data);
+
+    Status _flush_write_buffer();
+
+    Status _write_to_file(const Slice& data);
+
+    void _update_io_context_written_bytes(int64_t bytes);
+
     // not owned, point to the data dir of this rowset
     // for checking disk capacity when write data to disk.
     SpillDataDir* data_dir_ = nullptr;
@@ -86,6 +96,7 @@ private:
     size_t written_blocks_ = 0;
     int64_t total_written_bytes_ = 0;
     std::string meta_;
+    std::string write_buffer_;
 
     RuntimeProfile::Counter* _write_file_timer = nullptr;
     RuntimeProfile::Counter* _serialize_timer = nullptr;
@@ -22,12 +22,20 @@
 #include <gen_cpp/Types_types.h>
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <chrono>
+#include <condition_variable>
+#include <map>
+#include <mutex>
 #include <thread>
+#include <vector>
 
+#include "common/config.h"
+#include "cpp/sync_point.h"
 #include "olap/options.h"
 #include "olap/storage_engine.h"
 #include "runtime/cluster_info.h"
+#include "util/defer_op.h"
 
 namespace doris {
 
@@ -132,4 +140,91 @@ TEST(TaskWorkerPoolTest, ReportWorkerPool) {
     EXPECT_EQ(count.load(), 3);
 }
 
+TEST(TaskWorkerPoolTest, PublishVersionWorkerPoolDefersOutOfOrderTasks) {
+    auto origin_worker_count = config::publish_version_worker_count;
+    config::publish_version_worker_count = 2;
+    auto* sp = SyncPoint::get_instance();
+    Defer defer {[&] {
+        config::publish_version_worker_count = origin_worker_count;
+        sp->disable_processing();
+        sp->clear_all_call_backs();
+    }};
+
+    // txn N can only be published after txn N - 1, txn 1 blocks until it is released
+    std::mutex mtx;
+    std::condition_variable cv;
+    bool release_first = false;
+    std::map<int64_t, int> attempts;
+    std::vector<int64_t> published;
+    sp->set_call_back("PublishVersionWorkerPool::_publish_version", [&](auto&& args) {
+        auto* pool = try_any_cast<PublishVersionWorkerPool*>(args[0]);
+        const auto* req = try_any_cast<const TAgentTaskRequest*>(args[1]);
+        auto* ret = try_any_cast<std::pair<bool, bool>*>(args.back());
+        ret->second = true;
+        auto txn_id = req->publish_version_req.transaction_id;
+        std::unique_lock lock(mtx);
+        ++attempts[txn_id];
+        cv.notify_all();
+        if (txn_id == 1) {
+            cv.wait(lock, [&] { return release_first; });
+        } else if (std::find(published.begin(), published.end(), txn_id - 1) ==
+                   published.end()) {
+            std::lock_guard deferred_lock(pool->_deferred_mtx);
+            pool->_deferred_tasks.push_back(std::make_unique<TAgentTaskRequest>(*req));
+            ret->first = true;
+            return;
+        }
+        published.push_back(txn_id);
+        cv.notify_all();
+        ret->first = false;
+    });
+    sp->enable_processing();
+
+    StorageEngine engine(EngineOptions {});
+    PublishVersionWorkerPool pool(engine);
+    auto make_task = [](int64_t txn_id) {
+        TAgentTaskRequest task;
+        task.__set_signature(txn_id);
+        task.__set_task_type(TTaskType::PUBLISH_VERSION);
+        task.publish_version_req.__set_transaction_id(txn_id);
+        return task;
+    };
+
+    std::thread first([&] { pool.publish_version_callback(make_task(1)); });
+    {
+        std::unique_lock lock(mtx);
+        ASSERT_TRUE(cv.wait_for(lock, 10s, [&] { return attempts[1] == 1; }));
+    }
+    // txn 1 is still running, so the later txns are parked instead of being requeued
+    pool.publish_version_callback(make_task(3));
+    pool.publish_version_callback(make_task(2));
+    std::this_thread::sleep_for(100ms);
+    {
+        std::lock_guard lock(mtx);
+        EXPECT_EQ(attempts[2], 1);
+        EXPECT_EQ(attempts[3], 1);
+        EXPECT_TRUE(published.empty());
+    }
+    {
+        std::lock_guard lock(pool._deferred_mtx);
+        EXPECT_EQ(pool._deferred_tasks.size(), 2);
+    }
+
+    // finishing txn 1 resubmits the parked txns
+    {
+        std::lock_guard lock(mtx);
+        release_first = true;
+    }
+    cv.notify_all();
+    first.join();
+    {
+        std::unique_lock lock(mtx);
+        ASSERT_TRUE(cv.wait_for(lock, 10s, [&] { return published.size() == 3; }));
+        EXPECT_EQ(published, std::vector<int64_t>({1, 2, 3}));
+        EXPECT_EQ(attempts[2], 2);
+    }
+    std::lock_guard lock(pool._deferred_mtx);
+    EXPECT_TRUE(pool._deferred_tasks.empty());
+}
+
 } // namespace doris
@@ -23,15 +23,19 @@
 
 #include <memory>
 
+#include "cloud/cloud_compaction_stop_token.h"
+#include "cloud/cloud_cumulative_compaction.h"
 #include "cloud/cloud_storage_engine.h"
 #include "cloud/cloud_tablet.h"
 #include "cloud/cloud_tablet_mgr.h"
+#include "cpp/sync_point.h"
 #include "gtest/gtest_pred_impl.h"
 #include "json2pb/json_to_pb.h"
 #include "olap/olap_common.h"
 #include "olap/rowset/rowset_factory.h"
 #include "olap/rowset/rowset_meta.h"
 #include "olap/tablet_meta.h"
+#include "util/defer_op.h"
 #include "util/uid_util.h"
 
 namespace doris {
@@ -192,4 +196,72 @@ TEST_F(CloudCompactionTest, failure_cumu_compaction_tablet_sleep_test) {
     ASSERT_EQ(st, Status::OK());
     ASSERT_EQ(tablets.size(), 0);
 }
+
+TEST_F(CloudCompactionTest, renew_lease_only_when_about_to_expire) {
+    int32_t interval = config::lease_compaction_interval_seconds;
+    int32_t renew_ahead = config::lease_compaction_renew_ahead_intervals;
+    config::lease_compaction_interval_seconds = 20;
+    config::lease_compaction_renew_ahead_intervals = 2;
+    Defer defer {[&] {
+        config::lease_compaction_interval_seconds = interval;
+        config::lease_compaction_renew_ahead_intervals = renew_ahead;
+    }};
+
+    CloudTabletSPtr tablet = std::make_shared<CloudTablet>(_engine, _tablet_meta);
+    CloudCumulativeCompaction compaction(_engine, tablet);
+    int64_t now = 1000000;
+    // Never leased
+    ASSERT_TRUE(compaction.need_renew_lease(now));
+
+    compaction._lease_expiration = now + 80;
+    ASSERT_FALSE(compaction.need_renew_lease(now));
+    ASSERT_FALSE(compaction.need_renew_lease(now + 20));
+    ASSERT_TRUE(compaction.need_renew_lease(now + 40));
+    ASSERT_TRUE(compaction.need_renew_lease(now + 100));
+
+    // Renew on every round like before
+    config::lease_compaction_renew_ahead_intervals = 4;
+    ASSERT_TRUE(compaction.need_renew_lease(now));
+}
+
+TEST_F(CloudCompactionTest, stop_token_lease_only_when_about_to_expire) {
+    int32_t renew_ahead = config::lease_compaction_renew_ahead_intervals;
+    config::lease_compaction_renew_ahead_intervals = 2;
+    int num_leases = 0;
+    Status lease_status = Status::OK();
+    auto* sp = SyncPoint::get_instance();
+    sp->enable_processing();
+    sp->set_call_back("CloudMetaMgr::lease_tablet_job", [&](auto&& args) {
+        ++num_leases;
+        auto* ret = try_any_cast_ret<Status>(args);
+        ret->first = lease_status;
+        ret->second = true;
+    });
+    Defer defer {[&] {
+        config::lease_compaction_renew_ahead_intervals = renew_ahead;
+        sp->clear_all_call_backs();
+        sp->disable_processing();
+    }};
+
+    CloudTabletSPtr tablet = std::make_shared<CloudTablet>(_engine, _tablet_meta);
+    CloudCompactionStopToken stop_token(_engine, tablet, 1);
+    // A failed renewal keeps the old lease, so the next round retries it
+    lease_status = Status::InternalError("injected");
+    stop_token.do_lease();
+    ASSERT_EQ(num_leases, 1);
+    stop_token.do_lease();
+    ASSERT_EQ(num_leases, 2);
+
+    // The lease just granted expires in 4 intervals, later rounds skip the rpc
+    lease_status = Status::OK();
+    stop_token.do_lease();
+    ASSERT_EQ(num_leases, 3);
+    stop_token.do_lease();
+    ASSERT_EQ(num_leases, 3);
+
+    // Renew on every round like before
+    config::lease_compaction_renew_ahead_intervals = 4;
+    stop_token.do_lease();
+    ASSERT_EQ(num_leases, 4);
+}
 } // namespace doris
@@ -0,0 +1,114 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "cloud/cloud_tablet.h"
+
+#include <gen_cpp/AgentService_types.h>
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "cloud/cloud_storage_engine.h"
+#include "cloud/config.h"
+#include "cpp/sync_point.h"
+#include "olap/tablet_meta.h"
+#include "util/defer_op.h"
+
+namespace doris {
+
+class CloudTabletTest : public testing::Test {
+public:
+    CloudTabletTest() : _engine(EngineOptions {}) {}
+
+    void SetUp() override {
+        _tablet_meta.reset(new TabletMeta(1, 2, 15673, 15674, 4, 5, TTabletSchema(), 6, {{7, 8}},
+                                          UniqueId(9, 10), TTabletType::TABLET_TYPE_DISK,
+                                          TCompressionType::LZ4F));
+    }
+
+protected:
+    CloudStorageEngine _engine;
+    TabletMetaSharedPtr _tablet_meta;
+};
+
+TEST_F(CloudTabletTest, coalesce_concurrent_sync_rowsets) {
+    auto origin_coalesce = config::enable_coalesce_tablet_sync_rowsets;
+    config::enable_coalesce_tablet_sync_rowsets = true;
+    std::atomic<int> num_requests = 0;
+    std::atomic<int> num_rpcs = 0;
+    std::promise<void> first_rpc_started;
+    std::promise<void> finish_first_rpc;
+    auto finish_first_rpc_future = finish_first_rpc.get_future().share();
+    auto* sp = SyncPoint::get_instance();
+    sp->enable_processing();
+    sp->set_call_back("CloudTablet::sync_rowsets.requested", [&](auto&&) { ++num_requests; });
+    sp->set_call_back("CloudMetaMgr::sync_tablet_rowsets", [&](auto&& args) {
+        if (++num_rpcs == 1) {
+            first_rpc_started.set_value();
+            finish_first_rpc_future.wait();
+        }
+        auto* ret = try_any_cast_ret<Status>(args);
+        ret->first = Status::OK();
+        ret->second = true;
+    });
+    Defer defer {[&] {
+        config::enable_coalesce_tablet_sync_rowsets = origin_coalesce;
+        sp->clear_all_call_backs();
+        sp->disable_processing();
+    }};
+
+    auto tablet = std::make_shared<CloudTablet>(_engine, _tablet_meta);
+    auto sync = [&tablet]() { EXPECT_TRUE(tablet->sync_rowsets(SyncOptions {}).ok()); };
+    std::vector<std::thread> threads;
+    threads.emplace_back(sync);
+    first_rpc_started.get_future().wait();
+    // both requests are made while the first sync is running
+    threads.emplace_back(sync);
+    threads.emplace_back(sync);
+    while (num_requests < 3) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    finish_first_rpc.set_value();
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    // the second sync started after both were requested, so it serves the third one too
+    EXPECT_EQ(num_rpcs, 2);
+
+    // a request made after the latest sync finished is not coalesced
+    sync();
+    EXPECT_EQ(num_rpcs, 3);
+}
+
+TEST_F(CloudTabletTest, sync_options_covers) {
+    SyncOptions plain;
+    SyncOptions with_delete_bitmap;
+    with_delete_bitmap.sync_delete_bitmap = true;
+    SyncOptions full;
+    full.full_sync = true;
+    EXPECT_TRUE(plain.covers(plain));
+    EXPECT_TRUE(with_delete_bitmap.covers(plain));
+    EXPECT_FALSE(plain.covers(with_delete_bitmap));
+    EXPECT_FALSE(with_delete_bitmap.covers(full));
+}
+
+} // namespace doris
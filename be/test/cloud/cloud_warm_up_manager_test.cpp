@@ -0,0 +1,133 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "cloud/cloud_warm_up_manager.h"
+
+#include <bthread/countdown_event.h>
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <thread>
+
+#include "cloud/cloud_storage_engine.h"
+#include "cloud/config.h"
+#include "common/config.h"
+#include "io/cache/block_file_cache_downloader.h"
+#include "olap/options.h"
+
+namespace doris {
+
+class CloudWarmUpManagerTest : public testing::Test {
+public:
+    CloudWarmUpManagerTest() : _engine(EngineOptions {}) {}
+
+    void SetUp() override {
+        _enable_file_cache = config::enable_file_cache;
+        _max_inflight_chunks = config::warm_up_max_inflight_chunks;
+        _engine._file_cache_block_downloader =
+                std::make_unique<io::FileCacheBlockDownloader>(_engine);
+    }
+
+    void TearDown() override {
+        _engine._file_cache_block_downloader.reset();
+        config::enable_file_cache = _enable_file_cache;
+        config::warm_up_max_inflight_chunks = _max_inflight_chunks;
+    }
+
+protected:
+    CloudStorageEngine _engine;
+    bool _enable_file_cache;
+    int64_t _max_inflight_chunks;
+};
+
+TEST_F(CloudWarmUpManagerTest, DownloaderFailsTaskWhenFileCacheDisabled) {
+    config::enable_file_cache = false;
+    bool done = false;
+    Status status;
+    _engine.file_cache_block_downloader().submit_download_task(io::DownloadFileMeta {
+            .path = "segment.dat",
+            .file_size = 100,
+            .download_size = 100,
+            .download_done =
+                    [&](Status st) {
+                        done = true;
+                        status = std::move(st);
+                    },
+    });
+    EXPECT_TRUE(done);
+    EXPECT_FALSE(status.ok());
+}
+
+TEST_F(CloudWarmUpManagerTest, ChunksNotDownloadedAreNotInflight) {
+    // every chunk fails at once, the job must not wait for chunks that will never finish
+    config::enable_file_cache = false;
+    config::warm_up_max_inflight_chunks = 1;
+    CloudWarmUpManager manager(_engine);
+    ASSERT_TRUE(manager.check_and_set_job_id(1).ok());
+    auto wait = std::make_shared<bthread::CountdownEvent>(0);
+    manager.submit_download_tasks("segment.dat", 25 * 1024 * 1024, nullptr, 0, wait);
+    EXPECT_EQ(manager._inflight_chunks->num, 0);
+    EXPECT_EQ(wait->timed_wait(butil::seconds_from_now(1)), 0);
+}
+
+TEST_F(CloudWarmUpManagerTest, WaitForInflightChunks) {
+    config::warm_up_max_inflight_chunks = 2;
+    CloudWarmUpManager manager(_engine);
+    ASSERT_TRUE(manager.check_and_set_job_id(1).ok());
+    manager._inflight_chunks->num = 2;
+
+    std::atomic_bool returned = false;
+    std::thread waiter([&] {
+        manager.wait_for_inflight_chunks();
+        returned = true;
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    EXPECT_FALSE(returned);
+
+    // a finished chunk wakes the waiter up
+    {
+        std::lock_guard lock(manager._inflight_chunks->mtx);
+        --manager._inflight_chunks->num;
+    }
+    manager._inflight_chunks->cond.notify_all();
+    waiter.join();
+    EXPECT_TRUE(returned);
+}
+
+TEST_F(CloudWarmUpManagerTest, WaitForInflightChunksStopsOnCancel) {
+    config::warm_up_max_inflight_chunks = 2;
+    CloudWarmUpManager manager(_engine);
+    ASSERT_TRUE(manager.check_and_set_job_id(1).ok());
+    manager._inflight_chunks->num = 2;
+
+    std::atomic_bool returned = false;
+    std::thread waiter([&] {
+        manager.wait_for_inflight_chunks();
+        returned = true;
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    EXPECT_FALSE(returned);
+
+    EXPECT_TRUE(manager.clear_job(1).ok());
+    waiter.join();
+    EXPECT_TRUE(returned);
+    manager._inflight_chunks->num = 0;
+}
+
+} // namespace doris
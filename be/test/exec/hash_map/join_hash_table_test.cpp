@@ -0,0 +1,118 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "vec/common/hash_table/join_hash_table.h"
+
+#include <gtest/gtest.h>
+
+#include "vec/common/hash_table/hash.h"
+
+namespace doris::vectorized {
+
+using TestJoinHashTable = JoinHashTable<uint32_t, HashCRC32<uint32_t>>;
+
+static void build_table(TestJoinHashTable& table, const std::vector<uint32_t>& keys,
+                        size_t partition_bytes, DorisVector<uint32_t>& bucket_nums) {
+    table.set_radix_partition_bytes(partition_bytes);
+    table.prepare_build<TJoinOp::INNER_JOIN>(keys.size(), 4064, false);
+    auto bucket_size = table.get_bucket_size();
+    bucket_nums.resize(keys.size());
+    for (size_t i = 0; i < keys.size(); ++i) {
+        bucket_nums[i] = table.hash(keys[i]) & (bucket_size - 1);
+    }
+    table.build(keys.data(), bucket_nums.data(), uint32_t(keys.size()), false);
+}
+
+TEST(JoinHashTableTest, TestRadixPartitionedBuildKeepsChains) {
+    // the first row of build side is mocked
+    std::vector<uint32_t> keys {0};
+    for (uint32_t i = 0; i < 100000; ++i) {
+        keys.push_back(i % 50000);
+    }
+
+    TestJoinHashTable plain_table;
+    DorisVector<uint32_t> plain_bucket_nums;
+    build_table(plain_table, keys, 0, plain_bucket_nums);
+    EXPECT_EQ(plain_table.get_partition_num(), 1);
+
+    TestJoinHashTable partitioned_table;
+    DorisVector<uint32_t> partitioned_bucket_nums;
+    build_table(partitioned_table, keys, 4096, partitioned_bucket_nums);
+    EXPECT_GT(partitioned_table.get_partition_num(), 1);
+    EXPECT_LE(size_t(partitioned_table.get_bucket_size()) / partitioned_table.get_partition_num(),
+              4096 / sizeof(uint32_t));
+
+    EXPECT_EQ(plain_table.first, partitioned_table.first);
+    EXPECT_EQ(plain_table.next, partitioned_table.next);
+
+    // probe with null bucket and missing keys
+    DorisVector<uint32_t> probe_buckets;
+    for (uint32_t i = 0; i < 4096; ++i) {
+        probe_buckets.push_back(i % 7 == 0 ? plain_table.get_bucket_size()
+                                           : plain_table.hash(i * 31) &
+                                                     (plain_table.get_bucket_size() - 1));
+    }
+    auto partitioned_probe_buckets = probe_buckets;
+    plain_table.pre_build_idxs(probe_buckets);
+    partitioned_table.pre_build_idxs(partitioned_probe_buckets);
+    EXPECT_EQ(probe_buckets, partitioned_probe_buckets);
+}
+
+TEST(JoinHashTableTest, TestDirectMappingBuckets) {
+    // the first row of build side is mocked, its key is out of the build key range
+    std::vector<uint32_t> keys {0};
+    for (uint32_t i = 0; i < 1000; ++i) {
+        keys.push_back(100000 + i / 2);
+    }
+    TestJoinHashTable table;
+    table.set_direct_mapping(true);
+    table.prepare_build<TJoinOp::INNER_JOIN>(keys.size(), 4064, false);
+    table.init_direct_mapping(keys.data(), uint32_t(keys.size()), nullptr);
+    ASSERT_TRUE(table.is_direct_mapping());
+
+    DorisVector<uint32_t> bucket_nums(keys.size());
+    for (size_t i = 0; i < keys.size(); ++i) {
+        bucket_nums[i] = table.direct_bucket_num(keys[i]);
+    }
+    table.build(keys.data(), bucket_nums.data(), uint32_t(keys.size()), false);
+    // every bucket only holds the rows of one key
+    for (size_t i = 1; i < keys.size(); ++i) {
+        EXPECT_EQ(bucket_nums[i], keys[i] - 100000);
+    }
+
+    DorisVector<uint32_t> probe_buckets {table.direct_bucket_num(99999),
+                                         table.direct_bucket_num(100000),
+                                         table.direct_bucket_num(100499),
+                                         table.direct_bucket_num(100500)};
+    EXPECT_EQ(probe_buckets[0], table.get_bucket_size() - 1);
+    EXPECT_EQ(probe_buckets[3], table.get_bucket_size() - 1);
+    table.pre_build_idxs(probe_buckets);
+    EXPECT_EQ(probe_buckets[0], 0);
+    EXPECT_EQ(keys[probe_buckets[1]], 100000);
+    EXPECT_EQ(keys[probe_buckets[2]], 100499);
+    EXPECT_EQ(probe_buckets[3], 0);
+
+    // sparse keys keep hashing
+    TestJoinHashTable sparse_table;
+    sparse_table.set_direct_mapping(true);
+    std::vector<uint32_t> sparse_keys {0, 1, 1000000};
+    sparse_table.prepare_build<TJoinOp::INNER_JOIN>(sparse_keys.size(), 4064, false);
+    sparse_table.init_direct_mapping(sparse_keys.data(), uint32_t(sparse_keys.size()), nullptr);
+    EXPECT_FALSE(sparse_table.is_direct_mapping());
+}
+
+} // namespace doris::vectorized
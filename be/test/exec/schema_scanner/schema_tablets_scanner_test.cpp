@@ -0,0 +1,164 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "exec/schema_scanner/schema_tablets_scanner.h"
+
+#include <gen_cpp/AgentService_types.h>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "common/config.h"
+#include "io/fs/local_file_system.h"
+#include "olap/data_dir.h"
+#include "olap/options.h"
+#include "olap/storage_engine.h"
+#include "olap/tablet_manager.h"
+#include "pipeline/exec/schema_scan_operator.h"
+#include "runtime/exec_env.h"
+#include "testutil/column_helper.h"
+#include "testutil/mock/mock_literal_expr.h"
+#include "testutil/mock/mock_operators.h"
+#include "testutil/mock/mock_runtime_state.h"
+#include "util/uid_util.h"
+#include "vec/data_types/data_type_number.h"
+#include "vec/exprs/vectorized_fn_call.h"
+#include "vec/exprs/vexpr_context.h"
+#include "vec/exprs/vslot_ref.h"
+
+namespace doris {
+
+class SchemaTabletsScannerTest : public testing::Test {
+public:
+    void SetUp() override {
+        _engine_data_path = "./be/test/exec/test_data/schema_tablets_scanner_test";
+        auto st = io::global_local_filesystem()->delete_directory(_engine_data_path);
+        ASSERT_TRUE(st.ok()) << st;
+        st = io::global_local_filesystem()->create_directory(_engine_data_path + "/meta");
+        ASSERT_TRUE(st.ok()) << st;
+
+        EngineOptions options;
+        options.backend_uid = UniqueId::gen_uid();
+        ExecEnv::GetInstance()->set_storage_engine(std::make_unique<StorageEngine>(options));
+        auto& engine = ExecEnv::GetInstance()->storage_engine().to_local();
+        _data_dir = std::make_unique<DataDir>(engine, _engine_data_path, 1000000000);
+        ASSERT_TRUE(_data_dir->init().ok());
+
+        create_tablet(10001, 1);
+        create_tablet(10002, 2);
+        create_tablet(10003, 1);
+    }
+
+    void TearDown() override {
+        ExecEnv::GetInstance()->set_storage_engine(nullptr);
+        _data_dir.reset();
+        EXPECT_TRUE(io::global_local_filesystem()->delete_directory(_engine_data_path).ok());
+    }
+
+    void create_tablet(int64_t tablet_id, int64_t partition_id) {
+        TColumnType col_type;
+        col_type.__set_type(TPrimitiveType::BIGINT);
+        TColumn col;
+        col.__set_column_name("k1");
+        col.__set_column_type(col_type);
+        col.__set_is_key(true);
+        TTabletSchema tablet_schema;
+        tablet_schema.__set_short_key_column_count(1);
+        tablet_schema.__set_schema_hash(3333);
+        tablet_schema.__set_keys_type(TKeysType::DUP_KEYS);
+        tablet_schema.__set_storage_type(TStorageType::COLUMN);
+        tablet_schema.__set_columns({col});
+        TCreateTabletReq req;
+        req.__set_tablet_schema(tablet_schema);
+        req.__set_tablet_id(tablet_id);
+        req.__set_partition_id(partition_id);
+        req.__set_version(1);
+        RuntimeProfile profile("CreateTablet");
+        auto* tablet_manager = ExecEnv::GetInstance()->storage_engine().to_local().tablet_manager();
+        auto st = tablet_manager->create_tablet(req, {_data_dir.get()}, &profile);
+        ASSERT_TRUE(st.ok()) << st;
+    }
+
+    // <column> IN (values), or <column> = value when there is a single value
+    vectorized::VExprContextSPtr create_predicate(const std::string* column,
+                                                  const std::vector<int64_t>& values) {
+        auto slot_ref = std::make_shared<vectorized::VSlotRef>();
+        slot_ref->_node_type = TExprNodeType::SLOT_REF;
+        slot_ref->_column_name = column;
+        slot_ref->_data_type = std::make_shared<vectorized::DataTypeInt64>();
+        auto predicate = std::make_shared<vectorized::VectorizedFnCall>();
+        if (values.size() == 1) {
+            predicate->_node_type = TExprNodeType::BINARY_PRED;
+            predicate->_opcode = TExprOpcode::EQ;
+        } else {
+            predicate->_node_type = TExprNodeType::IN_PRED;
+            predicate->_opcode = TExprOpcode::FILTER_IN;
+        }
+        predicate->add_child(slot_ref);
+        for (int64_t value : values) {
+            predicate->add_child(std::make_shared<vectorized::MockLiteral>(
+                    vectorized::ColumnHelper::create_column_with_name<vectorized::DataTypeInt64>(
+                            {value})));
+        }
+        return vectorized::VExprContext::create_shared(predicate);
+    }
+
+protected:
+    const std::string _tablet_id_column = "TABLET_ID";
+    const std::string _partition_id_column = "PARTITION_ID";
+
+private:
+    std::string _engine_data_path;
+    std::unique_ptr<DataDir> _data_dir;
+};
+
+TEST_F(SchemaTabletsScannerTest, push_down_tablet_and_partition_ids) {
+    MockRuntimeState state;
+    pipeline::MockSourceOperator parent;
+    pipeline::SchemaScanLocalState local_state(&state, &parent);
+    local_state._conjuncts = {
+            create_predicate(&_tablet_id_column, {10001, 10002, 10003, 10004}),
+            create_predicate(&_tablet_id_column, {10001, 10002, 10004}),
+            create_predicate(&_partition_id_column, {1}),
+    };
+    local_state._push_down_int_predicates();
+
+    const auto& values = local_state._scanner_param.int_column_values;
+    ASSERT_EQ(values.size(), 2);
+    // repeated conjuncts on a column are intersected
+    EXPECT_EQ(values.at("TABLET_ID"), (std::set<int64_t> {10001, 10002, 10004}));
+    EXPECT_EQ(values.at("PARTITION_ID"), (std::set<int64_t> {1}));
+
+    // tablets are looked up by id, the unknown 10004 and 10002 of partition 2 are skipped
+    SchemaTabletsScanner scanner;
+    scanner._param = &local_state._scanner_param;
+    ASSERT_TRUE(scanner._get_all_tablets().ok());
+    ASSERT_EQ(scanner._tablets.size(), 1);
+    EXPECT_EQ(scanner._tablets[0]->tablet_id(), 10001);
+
+    // without pushed down values every tablet is visited
+    SchemaScannerParam empty_param;
+    SchemaTabletsScanner full_scanner;
+    full_scanner._param = &empty_param;
+    ASSERT_TRUE(full_scanner._get_all_tablets().ok());
+    EXPECT_EQ(full_scanner._tablets.size(), 3);
+}
+
+} // namespace doris
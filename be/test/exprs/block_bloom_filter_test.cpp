@@ -0,0 +1,87 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "exprs/block_bloom_filter.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <random>
+#include <vector>
+
+namespace doris {
+
+class BlockBloomFilterTest : public testing::Test {
+protected:
+    static void insert_and_find(BlockBloomFilter& filter, const std::vector<uint32_t>& values) {
+        ASSERT_TRUE(filter.init(16, 0).ok());
+        for (auto value : values) {
+            filter.insert(value);
+        }
+        for (auto value : values) {
+            ASSERT_TRUE(filter.find(value));
+        }
+    }
+};
+
+TEST_F(BlockBloomFilterTest, insert_and_find) {
+    std::mt19937 rng(42);
+    std::vector<uint32_t> values;
+    for (int i = 0; i < 4096; ++i) {
+        values.push_back(uint32_t(rng()));
+    }
+    BlockBloomFilter filter;
+    insert_and_find(filter, values);
+
+    int false_positives = 0;
+    for (int i = 0; i < 4096; ++i) {
+        false_positives += filter.find(uint32_t(rng()));
+    }
+    ASSERT_LT(false_positives, 4096 / 10);
+}
+
+#ifdef __aarch64__
+// SVE and NEON build the same directory, so filters are interchangeable between BEs.
+TEST_F(BlockBloomFilterTest, sve_same_as_neon) {
+    if (!BlockBloomFilter::sve_supported()) {
+        GTEST_SKIP() << "cpu has no 256-bit SVE";
+    }
+    std::mt19937 rng(42);
+    std::vector<uint32_t> values;
+    for (int i = 0; i < 4096; ++i) {
+        values.push_back(uint32_t(rng()));
+    }
+    auto origin_sve_enabled = BlockBloomFilter::sve_enabled();
+
+    BlockBloomFilter neon_filter;
+    BlockBloomFilter::set_sve_enabled(false);
+    insert_and_find(neon_filter, values);
+
+    BlockBloomFilter sve_filter;
+    BlockBloomFilter::set_sve_enabled(true);
+    insert_and_find(sve_filter, values);
+
+    BlockBloomFilter::set_sve_enabled(origin_sve_enabled);
+
+    auto neon_directory = neon_filter.directory();
+    auto sve_directory = sve_filter.directory();
+    ASSERT_EQ(neon_directory.size, sve_directory.size);
+    ASSERT_EQ(memcmp(neon_directory.data, sve_directory.data, neon_directory.size), 0);
+}
+#endif
+
+} // namespace doris
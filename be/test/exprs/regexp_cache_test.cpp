@@ -0,0 +1,90 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "exprs/regexp_cache.h"
+
+#include <gtest/gtest.h>
+#include <re2/re2.h>
+
+#include <memory>
+#include <string>
+
+#include "exprs/string_functions.h"
+#include "runtime/exec_env.h"
+
+namespace doris {
+
+class RegexpCacheTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        _cache = std::make_unique<RegexpCache>(16);
+        ExecEnv::GetInstance()->_regexp_cache = _cache.get();
+    }
+    void TearDown() override { ExecEnv::GetInstance()->_regexp_cache = nullptr; }
+
+    std::unique_ptr<RegexpCache> _cache;
+};
+
+TEST_F(RegexpCacheTest, ShareCompiledRegex) {
+    std::string pattern = "a+b";
+    std::string error_str;
+    std::shared_ptr<re2::RE2> re1;
+    std::shared_ptr<re2::RE2> re_again;
+    ASSERT_TRUE(StringFunctions::compile_regex(StringRef(pattern), &error_str, StringRef(),
+                                               StringRef(), re1));
+    ASSERT_TRUE(StringFunctions::compile_regex(StringRef(pattern), &error_str, StringRef(),
+                                               StringRef(), re_again));
+    EXPECT_EQ(re1.get(), re_again.get());
+    EXPECT_TRUE(re2::RE2::PartialMatch("xaab", *re1));
+
+    // match parameters are part of the key
+    std::string match_parameter = "i";
+    std::shared_ptr<re2::RE2> re3;
+    ASSERT_TRUE(StringFunctions::compile_regex(StringRef(pattern), &error_str,
+                                               StringRef(match_parameter), StringRef(), re3));
+    EXPECT_NE(re1.get(), re3.get());
+    EXPECT_TRUE(re2::RE2::PartialMatch("AB", *re3));
+    EXPECT_FALSE(re2::RE2::PartialMatch("AB", *re1));
+}
+
+TEST_F(RegexpCacheTest, InvalidPatternNotCached) {
+    std::string pattern = "(a";
+    std::string error_str;
+    std::shared_ptr<re2::RE2> re;
+    EXPECT_FALSE(StringFunctions::compile_regex(StringRef(pattern), &error_str, StringRef(),
+                                                StringRef(), re));
+    EXPECT_EQ(re, nullptr);
+    EXPECT_FALSE(error_str.empty());
+    EXPECT_EQ(_cache->lookup_regex(RegexpCache::get_key(StringRef(pattern), StringRef(),
+                                                        StringRef())),
+              nullptr);
+}
+
+TEST_F(RegexpCacheTest, FallbackWithoutCache) {
+    ExecEnv::GetInstance()->_regexp_cache = nullptr;
+    std::string pattern = "x.y";
+    std::string error_str;
+    std::shared_ptr<re2::RE2> re1;
+    std::shared_ptr<re2::RE2> re_again;
+    ASSERT_TRUE(StringFunctions::compile_regex(StringRef(pattern), &error_str, StringRef(),
+                                               StringRef(), re1));
+    ASSERT_TRUE(StringFunctions::compile_regex(StringRef(pattern), &error_str, StringRef(),
+                                               StringRef(), re_again));
+    EXPECT_NE(re1.get(), re_again.get());
+}
+
+} // namespace doris
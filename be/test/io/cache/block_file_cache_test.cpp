@@ -3178,6 +3178,7 @@ TEST_F(BlockFileCacheTest, test_factory_1) {
     }
     FileCacheFactory::instance()->_caches.clear();
     FileCacheFactory::instance()->_path_to_cache.clear();
+    FileCacheFactory::instance()->_path_to_shards.clear();
     FileCacheFactory::instance()->_capacity = 0;
 }
 
@@ -3216,6 +3217,7 @@ TEST_F(BlockFileCacheTest, test_factory_2) {
     config::clear_file_cache = false;
     FileCacheFactory::instance()->_caches.clear();
     FileCacheFactory::instance()->_path_to_cache.clear();
+    FileCacheFactory::instance()->_path_to_shards.clear();
     FileCacheFactory::instance()->_capacity = 0;
 }
 
@@ -3250,6 +3252,7 @@ TEST_F(BlockFileCacheTest, test_factory_3) {
     }
     FileCacheFactory::instance()->_caches.clear();
     FileCacheFactory::instance()->_path_to_cache.clear();
+    FileCacheFactory::instance()->_path_to_shards.clear();
     FileCacheFactory::instance()->_capacity = 0;
 }
 
@@ -3392,6 +3395,7 @@ TEST_F(BlockFileCacheTest, test_query_limit) {
     }
     FileCacheFactory::instance()->_caches.clear();
     FileCacheFactory::instance()->_path_to_cache.clear();
+    FileCacheFactory::instance()->_path_to_shards.clear();
     FileCacheFactory::instance()->_capacity = 0;
 }
 
@@ -3778,6 +3782,81 @@ TEST_F(BlockFileCacheTest, cached_remote_file_reader) {
     }
     FileCacheFactory::instance()->_caches.clear();
     FileCacheFactory::instance()->_path_to_cache.clear();
+    FileCacheFactory::instance()->_path_to_shards.clear();
+    FileCacheFactory::instance()->_capacity = 0;
+}
+
+extern bvar::Adder<uint64_t> g_miss_remote_reads;
+extern bvar::Adder<uint64_t> g_miss_blocks;
+extern bvar::Adder<uint64_t> g_over_read_bytes;
+
+TEST_F(BlockFileCacheTest, cached_remote_file_reader_miss_gap) {
+    if (fs::exists(cache_base_path)) {
+        fs::remove_all(cache_base_path);
+    }
+    fs::create_directories(cache_base_path);
+    auto origin_max_gap = config::file_cache_miss_coalesce_max_gap_bytes;
+    Defer defer {[origin_max_gap] {
+        config::file_cache_miss_coalesce_max_gap_bytes = origin_max_gap;
+    }};
+    io::FileCacheSettings settings;
+    settings.query_queue_size = 6291456;
+    settings.query_queue_elements = 6;
+    settings.index_queue_size = 1048576;
+    settings.index_queue_elements = 1;
+    settings.disposable_queue_size = 1048576;
+    settings.disposable_queue_elements = 1;
+    settings.capacity = 8388608;
+    settings.max_file_block_size = 1048576;
+    settings.max_query_cache_size = 0;
+    ASSERT_TRUE(FileCacheFactory::instance()->create_file_cache(cache_base_path, settings).ok());
+    FileReaderSPtr local_reader;
+    ASSERT_TRUE(global_local_filesystem()->open_file(tmp_file, &local_reader));
+    io::FileReaderOptions opts;
+    opts.cache_type = io::cache_type_from_string("file_block_cache");
+    opts.is_doris_table = true;
+    CachedRemoteFileReader reader(local_reader, opts);
+    for (int i = 0; i < 1000 && !reader._cache->get_async_open_success(); ++i) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    IOContext io_ctx;
+    FileCacheStatistics stats;
+    io_ctx.file_cache_stats = &stats;
+    {
+        // cache the block [2MB, 3MB)
+        std::string buffer(64_kb, '\0');
+        size_t bytes_read {0};
+        ASSERT_TRUE(
+                reader.read_at(2_mb, Slice(buffer.data(), buffer.size()), &bytes_read, &io_ctx)
+                        .ok());
+        EXPECT_EQ(std::string(64_kb, '2'), buffer);
+    }
+    {
+        // blocks 0, 1, 3, 4 miss: two remote reads when the cached block may not be re-read
+        config::file_cache_miss_coalesce_max_gap_bytes = 0;
+        auto remote_reads = g_miss_remote_reads.get_value();
+        auto miss_blocks = g_miss_blocks.get_value();
+        auto over_read_bytes = g_over_read_bytes.get_value();
+        std::string buffer(5_mb, '\0');
+        size_t bytes_read {0};
+        ASSERT_TRUE(
+                reader.read_at(0, Slice(buffer.data(), buffer.size()), &bytes_read, &io_ctx).ok());
+        EXPECT_EQ(bytes_read, 5_mb);
+        for (int i = 0; i < 5; i++) {
+            EXPECT_EQ(std::string(1_mb, '0' + i), buffer.substr(i * 1_mb, 1_mb));
+        }
+        EXPECT_EQ(g_miss_remote_reads.get_value() - remote_reads, 2);
+        EXPECT_EQ(g_miss_blocks.get_value() - miss_blocks, 4);
+        EXPECT_EQ(g_over_read_bytes.get_value() - over_read_bytes, 0);
+    }
+    EXPECT_TRUE(reader.close().ok());
+    std::this_thread::sleep_for(std::chrono::seconds(1));
+    if (fs::exists(cache_base_path)) {
+        fs::remove_all(cache_base_path);
+    }
+    FileCacheFactory::instance()->_caches.clear();
+    FileCacheFactory::instance()->_path_to_cache.clear();
+    FileCacheFactory::instance()->_path_to_shards.clear();
     FileCacheFactory::instance()->_capacity = 0;
 }
 
@@ -3840,6 +3919,7 @@ TEST_F(BlockFileCacheTest, cached_remote_file_reader_tail) {
     }
     FileCacheFactory::instance()->_caches.clear();
     FileCacheFactory::instance()->_path_to_cache.clear();
+    FileCacheFactory::instance()->_path_to_shards.clear();
     FileCacheFactory::instance()->_capacity = 0;
 }
 
@@ -3921,6 +4001,7 @@ TEST_F(BlockFileCacheTest, cached_remote_file_reader_error_handle) {
     }
     FileCacheFactory::instance()->_caches.clear();
     FileCacheFactory::instance()->_path_to_cache.clear();
+    FileCacheFactory::instance()->_path_to_shards.clear();
     FileCacheFactory::instance()->_capacity = 0;
 }
 
@@ -3982,6 +4063,7 @@ TEST_F(BlockFileCacheTest, cached_remote_file_reader_init) {
     }
     FileCacheFactory::instance()->_caches.clear();
     FileCacheFactory::instance()->_path_to_cache.clear();
+    FileCacheFactory::instance()->_path_to_shards.clear();
     FileCacheFactory::instance()->_capacity = 0;
 }
 
@@ -4058,6 +4140,7 @@ TEST_F(BlockFileCacheTest, cached_remote_file_reader_concurrent) {
     }
     FileCacheFactory::instance()->_caches.clear();
     FileCacheFactory::instance()->_path_to_cache.clear();
+    FileCacheFactory::instance()->_path_to_shards.clear();
     FileCacheFactory::instance()->_capacity = 0;
 }
 
@@ -4133,6 +4216,7 @@ TEST_F(BlockFileCacheTest, cached_remote_file_reader_concurrent_2) {
     }
     FileCacheFactory::instance()->_caches.clear();
     FileCacheFactory::instance()->_path_to_cache.clear();
+    FileCacheFactory::instance()->_path_to_shards.clear();
     FileCacheFactory::instance()->_capacity = 0;
 }
 
@@ -4680,6 +4764,7 @@ TEST_F(BlockFileCacheTest, cached_remote_file_reader_opt_lock) {
     }
     FileCacheFactory::instance()->_caches.clear();
     FileCacheFactory::instance()->_path_to_cache.clear();
+    FileCacheFactory::instance()->_path_to_shards.clear();
     FileCacheFactory::instance()->_capacity = 0;
     config::enable_read_cache_file_directly = false;
 }
@@ -7269,6 +7354,7 @@ TEST_F(BlockFileCacheTest, reader_dryrun_when_download_file_cache) {
     }
     FileCacheFactory::instance()->_caches.clear();
     FileCacheFactory::instance()->_path_to_cache.clear();
+    FileCacheFactory::instance()->_path_to_shards.clear();
     FileCacheFactory::instance()->_capacity = 0;
     config::enable_reader_dryrun_when_download_file_cache = org;
 }
@@ -7741,6 +7827,7 @@ TEST_F(BlockFileCacheTest, cached_remote_file_reader_ttl_index) {
     }
     FileCacheFactory::instance()->_caches.clear();
     FileCacheFactory::instance()->_path_to_cache.clear();
+    FileCacheFactory::instance()->_path_to_shards.clear();
     FileCacheFactory::instance()->_capacity = 0;
 }
 
@@ -7818,6 +7905,7 @@ TEST_F(BlockFileCacheTest, cached_remote_file_reader_normal_index) {
     }
     FileCacheFactory::instance()->_caches.clear();
     FileCacheFactory::instance()->_path_to_cache.clear();
+    FileCacheFactory::instance()->_path_to_shards.clear();
     FileCacheFactory::instance()->_capacity = 0;
 }
 
@@ -7895,7 +7983,184 @@ TEST_F(BlockFileCacheTest, test_reset_capacity) {
     }
     FileCacheFactory::instance()->_caches.clear();
     FileCacheFactory::instance()->_path_to_cache.clear();
+    FileCacheFactory::instance()->_path_to_shards.clear();
+    FileCacheFactory::instance()->_capacity = 0;
+}
+
+TEST_F(BlockFileCacheTest, test_factory_shards) {
+    if (fs::exists(cache_base_path)) {
+        fs::remove_all(cache_base_path);
+    }
+    auto origin_shards = config::file_cache_shards_per_path;
+    config::file_cache_shards_per_path = 2;
+    Defer defer {[origin_shards] { config::file_cache_shards_per_path = origin_shards; }};
+
+    io::FileCacheSettings settings;
+    settings.query_queue_size = 30;
+    settings.query_queue_elements = 5;
+    settings.index_queue_size = 30;
+    settings.index_queue_elements = 5;
+    settings.disposable_queue_size = 30;
+    settings.disposable_queue_elements = 5;
+    settings.capacity = 90;
+    settings.max_file_block_size = 30;
+    settings.max_query_cache_size = 30;
+    ASSERT_TRUE(FileCacheFactory::instance()->create_file_cache(cache_base_path, settings).ok());
+    EXPECT_EQ(FileCacheFactory::instance()->get_cache_instance_size(), 2);
+    EXPECT_EQ(FileCacheFactory::instance()->get_capacity(), 90);
+    EXPECT_EQ(FileCacheFactory::instance()->get_base_paths(),
+              std::vector<std::string> {cache_base_path});
+    EXPECT_EQ(FileCacheFactory::instance()->get_by_path(cache_base_path), nullptr);
+
+    // every key is owned by the same shard whichever way it is looked up
+    for (int i = 0; i < 16; ++i) {
+        auto key = io::BlockFileCache::hash("key" + std::to_string(i));
+        auto* cache = FileCacheFactory::instance()->get_by_path(cache_base_path, key);
+        ASSERT_NE(cache, nullptr);
+        EXPECT_EQ(cache, FileCacheFactory::instance()->get_by_path(key));
+        EXPECT_EQ(cache->capacity(), 45);
+        EXPECT_TRUE(cache->get_base_path().starts_with(cache_base_path + "shard_"));
+    }
+
+    auto s = FileCacheFactory::instance()->reset_capacity(cache_base_path, 80);
+    EXPECT_EQ(s.find("Unknown"), std::string::npos) << s;
+    EXPECT_EQ(FileCacheFactory::instance()->get_capacity(), 80);
+    // the new capacity of the path is split over its shards
+    for (const auto& cache : FileCacheFactory::instance()->_caches) {
+        EXPECT_EQ(cache->capacity(), 40);
+    }
+
+    FileCacheFactory::instance()->clear_file_caches(true);
+    std::this_thread::sleep_for(std::chrono::seconds(1));
+    if (fs::exists(cache_base_path)) {
+        fs::remove_all(cache_base_path);
+    }
+    FileCacheFactory::instance()->_caches.clear();
+    FileCacheFactory::instance()->_path_to_cache.clear();
+    FileCacheFactory::instance()->_path_to_shards.clear();
     FileCacheFactory::instance()->_capacity = 0;
 }
 
+TEST_F(BlockFileCacheTest, test_factory_shards_layout_change) {
+    if (fs::exists(cache_base_path)) {
+        fs::remove_all(cache_base_path);
+    }
+    auto origin_shards = config::file_cache_shards_per_path;
+    Defer defer {[origin_shards] { config::file_cache_shards_per_path = origin_shards; }};
+    auto read_layout = [&]() {
+        std::ifstream layout(cache_base_path + "shards");
+        std::string shards;
+        layout >> shards;
+        return shards;
+    };
+    auto reset_factory = [&]() {
+        for (auto& cache : FileCacheFactory::instance()->_caches) {
+            int i = 0;
+            while (i++ < 1000 && !cache->get_async_open_success()) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+            ASSERT_LT(i, 1000);
+        }
+        FileCacheFactory::instance()->_caches.clear();
+        FileCacheFactory::instance()->_path_to_cache.clear();
+        FileCacheFactory::instance()->_path_to_shards.clear();
+        FileCacheFactory::instance()->_capacity = 0;
+    };
+
+    io::FileCacheSettings settings;
+    settings.query_queue_size = 30;
+    settings.query_queue_elements = 5;
+    settings.capacity = 30;
+    settings.max_file_block_size = 30;
+    settings.max_query_cache_size = 30;
+
+    // blocks of the unsharded layout are removed when the path is split
+    fs::create_directories(cache_base_path + "f36/f36131fb4ba563c17e727cd0cdd63689_0");
+    std::ofstream(cache_base_path + "f36/f36131fb4ba563c17e727cd0cdd63689_0/0") << "block";
+    config::file_cache_shards_per_path = 2;
+    ASSERT_TRUE(FileCacheFactory::instance()->create_file_cache(cache_base_path, settings).ok());
+    EXPECT_FALSE(fs::exists(cache_base_path + "f36"));
+    EXPECT_TRUE(fs::exists(cache_base_path + "shard_0"));
+    EXPECT_TRUE(fs::exists(cache_base_path + "shard_1"));
+    EXPECT_EQ(read_layout(), "2");
+    reset_factory();
+
+    // the same shard count keeps the cached blocks
+    fs::create_directories(cache_base_path + "shard_0/f36");
+    config::file_cache_shards_per_path = 2;
+    ASSERT_TRUE(FileCacheFactory::instance()->create_file_cache(cache_base_path, settings).ok());
+    EXPECT_TRUE(fs::exists(cache_base_path + "shard_0/f36"));
+    reset_factory();
+
+    // and the shards are removed when the path is no longer split
+    config::file_cache_shards_per_path = 1;
+    ASSERT_TRUE(FileCacheFactory::instance()->create_file_cache(cache_base_path, settings).ok());
+    EXPECT_FALSE(fs::exists(cache_base_path + "shard_0"));
+    EXPECT_FALSE(fs::exists(cache_base_path + "shard_1"));
+    EXPECT_EQ(read_layout(), "1");
+    reset_factory();
+
+    if (fs::exists(cache_base_path)) {
+        fs::remove_all(cache_base_path);
+    }
+}
+
+TEST_F(BlockFileCacheTest, cost_aware_evict_candidates) {
+    if (fs::exists(cache_base_path)) {
+        fs::remove_all(cache_base_path);
+    }
+    fs::create_directories(cache_base_path);
+    auto origin_window = config::file_cache_cost_aware_evict_window;
+    config::file_cache_cost_aware_evict_window = 16;
+    Defer defer {[origin_window] { config::file_cache_cost_aware_evict_window = origin_window; }};
+
+    TUniqueId query_id;
+    query_id.hi = 1;
+    query_id.lo = 1;
+    io::FileCacheSettings settings;
+    settings.query_queue_size = 300;
+    settings.query_queue_elements = 10;
+    settings.index_queue_size = 300;
+    settings.index_queue_elements = 10;
+    settings.disposable_queue_size = 300;
+    settings.disposable_queue_elements = 10;
+    settings.capacity = 900;
+    settings.max_file_block_size = 100;
+    settings.max_query_cache_size = 30;
+    io::CacheContext context;
+    ReadStatistics rstats;
+    context.stats = &rstats;
+    context.cache_type = io::FileCacheType::NORMAL;
+    context.query_id = query_id;
+    auto key = io::BlockFileCache::hash("key1");
+    io::BlockFileCache cache(cache_base_path, settings);
+    ASSERT_TRUE(cache.initialize());
+    for (int i = 0; i < 100 && !cache.get_async_open_success(); i++) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    ASSERT_TRUE(cache.get_async_open_success());
+    for (size_t offset = 0; offset < 300; offset += 100) {
+        auto holder = cache.get_or_set(key, offset, 100, context);
+        auto blocks = fromHolder(holder);
+        ASSERT_EQ(blocks.size(), 1);
+        ASSERT_TRUE(blocks[0]->get_or_set_downloader() == io::FileBlock::get_caller_id());
+        download(blocks[0]);
+    }
+    // the least recently used block is the most expensive to fetch again
+    cache._files[key][0].file_block->set_fetch_cost_us(1000);
+    cache._files[key][100].file_block->set_fetch_cost_us(10);
+    cache._files[key][200].file_block->set_fetch_cost_us(100);
+
+    std::lock_guard cache_lock(cache._mutex);
+    std::vector<io::BlockFileCache::FileBlockCell*> to_evict;
+    size_t removed_size = 0;
+    size_t cur_removed_size = 0;
+    cache.find_evict_candidates(cache._normal_queue, 200, 300, removed_size, to_evict, cache_lock,
+                                cur_removed_size, true);
+    ASSERT_EQ(to_evict.size(), 2);
+    EXPECT_EQ(to_evict[0]->file_block->offset(), 100);
+    EXPECT_EQ(to_evict[1]->file_block->offset(), 200);
+    EXPECT_EQ(removed_size, 200);
+}
+
 } // namespace doris::io
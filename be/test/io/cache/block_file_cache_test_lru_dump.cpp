@@ -493,4 +493,89 @@ TEST_F(BlockFileCacheTest, test_lru_duplicate_queue_entry_restore) {
     }
 }
 
+TEST_F(BlockFileCacheTest, test_lru_restore_corrects_ttl_expiration) {
+    auto origin_evict_in_advance = config::enable_evict_file_cache_in_advance;
+    auto origin_limit_mode_percent = config::file_cache_enter_disk_resource_limit_mode_percent;
+    auto origin_dump_interval_ms = config::file_cache_background_lru_dump_interval_ms;
+    auto origin_dump_cnt_threshold = config::file_cache_background_lru_dump_update_cnt_threshold;
+    Defer defer {[=] {
+        config::enable_evict_file_cache_in_advance = origin_evict_in_advance;
+        config::file_cache_enter_disk_resource_limit_mode_percent = origin_limit_mode_percent;
+        config::file_cache_background_lru_dump_interval_ms = origin_dump_interval_ms;
+        config::file_cache_background_lru_dump_update_cnt_threshold = origin_dump_cnt_threshold;
+    }};
+    config::enable_evict_file_cache_in_advance = false;
+    config::file_cache_enter_disk_resource_limit_mode_percent = 99;
+    // the queue is dumped by the test, keep the background dump out of the way
+    config::file_cache_background_lru_dump_interval_ms = 3600 * 1000;
+    config::file_cache_background_lru_dump_update_cnt_threshold = 0;
+    if (fs::exists(cache_base_path)) {
+        fs::remove_all(cache_base_path);
+    }
+    fs::create_directories(cache_base_path);
+    TUniqueId query_id;
+    query_id.hi = 1;
+    query_id.lo = 1;
+    io::FileCacheSettings settings;
+
+    settings.ttl_queue_size = 5000000;
+    settings.ttl_queue_elements = 50000;
+    settings.query_queue_size = 5000000;
+    settings.query_queue_elements = 50000;
+    settings.index_queue_size = 5000000;
+    settings.index_queue_elements = 50000;
+    settings.disposable_queue_size = 5000000;
+    settings.disposable_queue_elements = 50000;
+    settings.capacity = 20000000;
+    settings.max_file_block_size = 100000;
+    settings.max_query_cache_size = 30;
+
+    uint64_t expiration_time = UnixSeconds() + 3600;
+    auto key1 = io::BlockFileCache::hash("key1");
+    {
+        io::BlockFileCache cache(cache_base_path, settings);
+        ASSERT_TRUE(cache.initialize());
+        for (int i = 0; i < 100 && !cache.get_async_open_success(); i++) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+        ASSERT_TRUE(cache.get_async_open_success());
+
+        io::CacheContext context1;
+        ReadStatistics rstats;
+        context1.stats = &rstats;
+        context1.cache_type = io::FileCacheType::TTL;
+        context1.query_id = query_id;
+        context1.expiration_time = expiration_time;
+        auto holder = cache.get_or_set(key1, 0, 100000, context1);
+        auto blocks = fromHolder(holder);
+        ASSERT_EQ(blocks.size(), 1);
+        ASSERT_TRUE(blocks[0]->get_or_set_downloader() == io::FileBlock::get_caller_id());
+        download(blocks[0]);
+        blocks.clear();
+
+        // what the background replay and dump threads do, without waiting for them
+        cache._lru_recorder->replay_queue_event(io::FileCacheType::TTL);
+        cache._lru_dumper->dump_queue("ttl");
+    }
+
+    io::BlockFileCache cache2(cache_base_path, settings);
+    ASSERT_TRUE(cache2.initialize());
+    for (int i = 0; i < 100 && !cache2.get_async_open_success(); i++) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    ASSERT_TRUE(cache2.get_async_open_success());
+
+    // the placeholder from the dump is replaced with the expiration time on disk
+    ASSERT_EQ(cache2._ttl_queue.get_elements_num_unsafe(), 1);
+    ASSERT_EQ(cache2._key_to_time[key1], expiration_time);
+    auto& block = cache2._files[key1][0].file_block;
+    ASSERT_EQ(block->expiration_time(), expiration_time);
+    std::string buffer(100000, '\0');
+    ASSERT_TRUE(block->read(Slice(buffer.data(), buffer.size()), 0).ok());
+
+    if (fs::exists(cache_base_path)) {
+        fs::remove_all(cache_base_path);
+    }
+}
+
 } // namespace doris::io
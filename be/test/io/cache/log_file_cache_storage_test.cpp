@@ -0,0 +1,126 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "io/cache/log_file_cache_storage.h"
+
+#include "block_file_cache_test_common.h"
+
+namespace doris::io {
+
+static FileCacheSettings log_storage_settings() {
+    FileCacheSettings settings;
+    settings.query_queue_size = 5000000;
+    settings.query_queue_elements = 50;
+    settings.index_queue_size = 1000000;
+    settings.index_queue_elements = 10;
+    settings.disposable_queue_size = 1000000;
+    settings.disposable_queue_elements = 10;
+    settings.capacity = 7000000;
+    settings.max_file_block_size = 100000;
+    settings.max_query_cache_size = 0;
+    settings.storage = "log";
+    return settings;
+}
+
+static void wait_async_open(BlockFileCache& cache) {
+    for (int i = 0; i < 1000 && !cache.get_async_open_success(); ++i) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    ASSERT_TRUE(cache.get_async_open_success());
+}
+
+TEST_F(BlockFileCacheTest, log_storage_restart_and_reclaim) {
+    if (fs::exists(cache_base_path)) {
+        fs::remove_all(cache_base_path);
+    }
+    fs::create_directories(cache_base_path);
+    auto origin_segment_size = config::file_cache_log_segment_size_mb;
+    config::file_cache_log_segment_size_mb = 1;
+    Defer defer {[origin_segment_size] {
+        config::file_cache_log_segment_size_mb = origin_segment_size;
+    }};
+    auto key = BlockFileCache::hash("log_storage_key");
+    CacheContext context;
+    ReadStatistics rstats;
+    context.stats = &rstats;
+    context.cache_type = FileCacheType::NORMAL;
+    context.query_id.hi = 1;
+    context.query_id.lo = 1;
+
+    {
+        BlockFileCache cache(cache_base_path, log_storage_settings());
+        ASSERT_TRUE(cache.initialize());
+        wait_async_open(cache);
+        auto* storage = static_cast<LogFileCacheStorage*>(cache._storage.get());
+        EXPECT_EQ(storage->get_type(), FileCacheStorageType::LOG_STRUCTURED_DISK);
+        const auto log_path = (fs::path(cache_base_path) / LogFileCacheStorage::LOG_DIR).native();
+        // 15 blocks of 100KB need two 1MB segments
+        for (size_t offset = 0; offset < 1500000; offset += 100000) {
+            auto holder = cache.get_or_set(key, offset, 100000, context);
+            auto blocks = fromHolder(holder);
+            ASSERT_EQ(blocks.size(), 1);
+            ASSERT_TRUE(blocks[0]->get_or_set_downloader() == FileBlock::get_caller_id());
+            std::string data(100000, static_cast<char>('a' + offset / 100000));
+            ASSERT_TRUE(blocks[0]->append(Slice(data.data(), data.size())).ok());
+            // the downloading block is buffered in tracked memory until it is finalized
+            EXPECT_EQ(storage->_pending_mem_tracker->consumption(), 100000);
+            EXPECT_EQ(blocks[0]->get_cache_file(), "");
+            ASSERT_TRUE(blocks[0]->finalize().ok());
+            EXPECT_EQ(storage->_pending_mem_tracker->consumption(), 0);
+            auto local_file = blocks[0]->get_cache_file();
+            EXPECT_TRUE(local_file.starts_with(log_path)) << local_file;
+            EXPECT_TRUE(local_file.ends_with(":100000")) << local_file;
+        }
+        EXPECT_EQ(storage->segment_num(), 2);
+        EXPECT_TRUE(fs::exists(fs::path(cache_base_path) / LogFileCacheStorage::LOG_DIR));
+    }
+
+    {
+        BlockFileCache cache(cache_base_path, log_storage_settings());
+        ASSERT_TRUE(cache.initialize());
+        wait_async_open(cache);
+        for (size_t offset = 0; offset < 1500000; offset += 100000) {
+            auto holder = cache.get_or_set(key, offset, 100000, context);
+            auto blocks = fromHolder(holder);
+            ASSERT_EQ(blocks.size(), 1);
+            assert_range(1, blocks[0], FileBlock::Range(offset, offset + 99999),
+                         FileBlock::State::DOWNLOADED);
+            std::string buffer(100, '\0');
+            ASSERT_TRUE(blocks[0]->read(Slice(buffer.data(), buffer.size()), 50).ok());
+            EXPECT_EQ(buffer, std::string(100, static_cast<char>('a' + offset / 100000)));
+        }
+        // removing every block reclaims the segments of the previous run
+        cache.remove_if_cached(key);
+        auto* storage = static_cast<LogFileCacheStorage*>(cache._storage.get());
+        EXPECT_EQ(storage->segment_num(), 0);
+    }
+
+    {
+        BlockFileCache cache(cache_base_path, log_storage_settings());
+        ASSERT_TRUE(cache.initialize());
+        wait_async_open(cache);
+        auto holder = cache.get_or_set(key, 0, 100000, context);
+        auto blocks = fromHolder(holder);
+        ASSERT_EQ(blocks.size(), 1);
+        assert_range(2, blocks[0], FileBlock::Range(0, 99999), FileBlock::State::EMPTY);
+    }
+    if (fs::exists(cache_base_path)) {
+        fs::remove_all(cache_base_path);
+    }
+}
+
+} // namespace doris::io
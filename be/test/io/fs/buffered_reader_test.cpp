@@ -508,4 +508,33 @@ TEST_F(BufferedReaderTest, test_range_cache_file_reader) {
     }
 }
 
+TEST_F(BufferedReaderTest, test_adaptive_prefetch) {
+    size_t mb = 1024 * 1024;
+    io::FileReaderSPtr offset_reader = std::make_shared<MockOffsetFileReader>(256 * mb);
+    io::PrefetchBufferedReader reader(nullptr, offset_reader, io::PrefetchRange(0, 256 * mb));
+    char data[1024];
+    size_t bytes_read = 0;
+
+    // random reads stop the prefetching
+    for (size_t i = 0; i < 8; ++i) {
+        size_t offset = ((i * 37) % 50) * 5 * mb;
+        ASSERT_TRUE(reader.read_at(offset, Slice(data, 1024), &bytes_read, nullptr).ok());
+        EXPECT_EQ(1024, bytes_read);
+        EXPECT_EQ(offset % UCHAR_MAX, (uint8_t)data[0]);
+    }
+    EXPECT_TRUE(reader._bypass_prefetch);
+    EXPECT_GT(reader._bypass_request_io, 0);
+
+    // sequential reads resume it
+    size_t offset = 10 * mb;
+    for (size_t i = 0; i < 4; ++i) {
+        ASSERT_TRUE(reader.read_at(offset, Slice(data, 1024), &bytes_read, nullptr).ok());
+        EXPECT_EQ(1024, bytes_read);
+        EXPECT_EQ(offset % UCHAR_MAX, (uint8_t)data[0]);
+        offset += bytes_read;
+    }
+    EXPECT_FALSE(reader._bypass_prefetch);
+    EXPECT_TRUE(reader.close().ok());
+}
+
 } // end namespace doris
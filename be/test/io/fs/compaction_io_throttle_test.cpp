@@ -0,0 +1,53 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "io/fs/compaction_io_throttle.h"
+
+#include <gtest/gtest.h>
+
+#include "common/config.h"
+
+namespace doris::io {
+
+TEST(CompactionIOThrottleTest, OnlyCompactionThreadsAreThrottled) {
+    auto old_base_read = config::base_compaction_read_mbytes_per_sec_per_disk;
+    auto old_cumu_write = config::cumu_compaction_write_mbytes_per_sec_per_disk;
+    config::base_compaction_read_mbytes_per_sec_per_disk = 100;
+    config::cumu_compaction_write_mbytes_per_sec_per_disk = -1;
+    auto* throttles = CompactionIOThrottle::instance();
+
+    EXPECT_EQ(throttles->get("/data1", false), nullptr);
+    {
+        ScopedCompactionIO scoped(ReaderType::READER_BASE_COMPACTION);
+        auto* read_throttle = throttles->get("/data1", false);
+        ASSERT_NE(read_throttle, nullptr);
+        EXPECT_EQ(throttles->get("/data1", false), read_throttle);
+        EXPECT_NE(throttles->get("/data2", false), read_throttle);
+        EXPECT_EQ(throttles->get("/data1", true), nullptr);
+        {
+            ScopedCompactionIO nested(ReaderType::READER_SEGMENT_COMPACTION);
+            EXPECT_EQ(throttles->get("/data1", true), nullptr);
+        }
+        EXPECT_EQ(throttles->get("/data1", false), read_throttle);
+    }
+    EXPECT_EQ(throttles->get("/data1", false), nullptr);
+
+    config::base_compaction_read_mbytes_per_sec_per_disk = old_base_read;
+    config::cumu_compaction_write_mbytes_per_sec_per_disk = old_cumu_write;
+}
+
+} // namespace doris::io
@@ -0,0 +1,87 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "io/fs/kafka_consumer_pipe.h"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+
+#include "runtime/exec_env.h"
+#include "runtime/memory/mem_tracker_limiter.h"
+
+namespace doris::io {
+
+TEST(KafkaConsumerPipeTest, AppendByReference) {
+    KafkaConsumerPipe pipe;
+    auto message = std::make_shared<std::string>(100, 'x');
+    std::weak_ptr<std::string> message_ref = message;
+
+    std::string small = "a,b";
+    ASSERT_TRUE(pipe.append_with_line_delimiter(small.data(), small.size()).ok());
+    ASSERT_TRUE(pipe.append_with_line_delimiter(message->data(), message->size(), message).ok());
+    ASSERT_TRUE(pipe.append_with_line_delimiter(small.data(), small.size()).ok());
+    ASSERT_TRUE(pipe.finish().ok());
+    message.reset();
+    EXPECT_FALSE(message_ref.expired());
+
+    std::string expected = "a,b\n" + std::string(100, 'x') + "\na,b\n";
+    std::string result(expected.size() + 10, '\0');
+    size_t bytes_read = 0;
+    ASSERT_TRUE(pipe.read_at(0, Slice(result.data(), result.size()), &bytes_read).ok());
+    result.resize(bytes_read);
+    EXPECT_EQ(expected, result);
+    // the referenced message is released once the reader has moved past it
+    EXPECT_TRUE(message_ref.expired());
+}
+
+TEST(KafkaConsumerPipeTest, AppendByReferenceReusesChunk) {
+    KafkaConsumerPipe pipe;
+    auto tracker = ExecEnv::GetInstance()->stream_load_pipe_tracker();
+    std::string small = "a,b";
+    ASSERT_TRUE(pipe.append_with_line_delimiter(small.data(), small.size()).ok());
+    auto chunk = pipe._write_buf;
+    ASSERT_NE(chunk, nullptr);
+
+    int64_t consumption = tracker->consumption();
+    auto first = std::make_shared<std::string>(100, 'x');
+    auto second = std::make_shared<std::string>(200, 'y');
+    ASSERT_TRUE(pipe.append_with_line_delimiter(first->data(), first->size(), first).ok());
+    ASSERT_TRUE(pipe.append_with_line_delimiter(second->data(), second->size(), second).ok());
+    // the referenced messages are tracked while they are queued
+    EXPECT_EQ(tracker->consumption() - consumption,
+              static_cast<int64_t>(first->size() + second->size()));
+    // the delimiters after the messages are written to the same chunk
+    EXPECT_EQ(pipe._write_buf, chunk);
+    ASSERT_EQ(pipe._buf_queue.size(), 4);
+    EXPECT_EQ(pipe._buf_queue[0]->owner_, chunk);
+    EXPECT_EQ(pipe._buf_queue[2]->owner_, chunk);
+    ASSERT_TRUE(pipe.finish().ok());
+    chunk.reset();
+
+    std::string expected = "a,b\n" + *first + "\n" + *second + "\n";
+    std::string result(expected.size() + 10, '\0');
+    size_t bytes_read = 0;
+    ASSERT_TRUE(pipe.read_at(0, Slice(result.data(), result.size()), &bytes_read).ok());
+    result.resize(bytes_read);
+    EXPECT_EQ(expected, result);
+    // the messages are released with the buffers the reader has consumed
+    EXPECT_LE(tracker->consumption(), consumption);
+}
+
+} // namespace doris::io
@@ -0,0 +1,162 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "io/fs/s3_file_reader.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "common/config.h"
+#include "io/fs/obj_storage_client.h"
+#include "util/threadpool.h"
+
+namespace doris::io {
+
+// serves ranged GETs from an in-memory object, failing the one at `fail_offset`
+class RangedGetObjStorageClient final : public ObjStorageClient {
+public:
+    explicit RangedGetObjStorageClient(std::string data) : _data(std::move(data)) {}
+
+    ObjectStorageResponse get_object(const ObjectStoragePathOptions& opts, void* buffer,
+                                     size_t offset, size_t bytes_read,
+                                     size_t* size_return) override {
+        ++get_count;
+        if (offset == fail_offset) {
+            return {.status = {.code = ErrorCode::INTERNAL_ERROR, .msg = "injected"},
+                    .http_code = 500};
+        }
+        memcpy(buffer, _data.data() + offset, bytes_read);
+        *size_return = bytes_read;
+        return ObjectStorageResponse::OK();
+    }
+
+    ObjectStorageUploadResponse create_multipart_upload(const ObjectStoragePathOptions&) override {
+        return {};
+    }
+    ObjectStorageResponse put_object(const ObjectStoragePathOptions&, std::string_view) override {
+        return {};
+    }
+    ObjectStorageUploadResponse upload_part(const ObjectStoragePathOptions&, std::string_view,
+                                            int) override {
+        return {};
+    }
+    ObjectStorageResponse complete_multipart_upload(
+            const ObjectStoragePathOptions&, const std::vector<ObjectCompleteMultiPart>&) override {
+        return {};
+    }
+    ObjectStorageHeadResponse head_object(const ObjectStoragePathOptions&) override {
+        return {.resp = ObjectStorageResponse::OK(), .file_size = (long long)_data.size()};
+    }
+    ObjectStorageResponse list_objects(const ObjectStoragePathOptions&,
+                                       std::vector<FileInfo>*) override {
+        return {};
+    }
+    ObjectStorageResponse delete_objects(const ObjectStoragePathOptions&,
+                                         std::vector<std::string>) override {
+        return {};
+    }
+    ObjectStorageResponse delete_object(const ObjectStoragePathOptions&) override { return {}; }
+    ObjectStorageResponse delete_objects_recursively(const ObjectStoragePathOptions&) override {
+        return {};
+    }
+    std::string generate_presigned_url(const ObjectStoragePathOptions&, int64_t,
+                                       const S3ClientConf&) override {
+        return "";
+    }
+
+    std::atomic<int> get_count = 0;
+    size_t fail_offset = std::string::npos;
+
+private:
+    std::string _data;
+};
+
+class S3FileReaderTest : public testing::Test {
+public:
+    void SetUp() override {
+        _saved_max_concurrency = config::s3_parallel_read_max_concurrency;
+        config::s3_parallel_read_max_concurrency = 4;
+        ASSERT_TRUE(ThreadPoolBuilder("S3FileReaderTest")
+                            .set_min_threads(1)
+                            .set_max_threads(4)
+                            .build(&_pool)
+                            .ok());
+        for (int i = 0; i < kFileSize; ++i) {
+            _data.push_back(static_cast<char>('a' + i % 26));
+        }
+        _client = std::make_unique<RangedGetObjStorageClient>(_data);
+        _reader = std::make_unique<S3FileReader>(nullptr, "bucket", "key", kFileSize, nullptr);
+    }
+
+    void TearDown() override {
+        _pool->shutdown();
+        config::s3_parallel_read_max_concurrency = _saved_max_concurrency;
+    }
+
+protected:
+    static constexpr int kFileSize = 10000;
+
+    int _saved_max_concurrency;
+    std::unique_ptr<ThreadPool> _pool;
+    std::string _data;
+    std::unique_ptr<RangedGetObjStorageClient> _client;
+    std::unique_ptr<S3FileReader> _reader;
+};
+
+TEST_F(S3FileReaderTest, ParallelGetObject) {
+    // 9000 bytes in chunks of 2000 would be 5 GETs, capped at 4 pieces of 2250 bytes
+    std::string buf(9000, '\0');
+    size_t bytes_read = 0;
+    auto st = _reader->_parallel_get_object(*_client, _pool.get(), 100, buf.data(), buf.size(),
+                                            2000, &bytes_read);
+    ASSERT_TRUE(st.ok()) << st;
+    EXPECT_EQ(bytes_read, buf.size());
+    EXPECT_EQ(buf, _data.substr(100, buf.size()));
+    EXPECT_EQ(_client->get_count, 4);
+    EXPECT_EQ(_reader->_s3_stats.total_get_request_counter, 4);
+    EXPECT_EQ(_reader->_s3_stats.total_bytes_read, buf.size());
+}
+
+TEST_F(S3FileReaderTest, ParallelGetObjectReadsInlineWhenPoolRejects) {
+    _pool->shutdown();
+    std::string buf(kFileSize, '\0');
+    size_t bytes_read = 0;
+    auto st = _reader->_parallel_get_object(*_client, _pool.get(), 0, buf.data(), buf.size(),
+                                            3000, &bytes_read);
+    ASSERT_TRUE(st.ok()) << st;
+    EXPECT_EQ(bytes_read, buf.size());
+    EXPECT_EQ(buf, _data);
+    EXPECT_EQ(_client->get_count, 4);
+}
+
+TEST_F(S3FileReaderTest, ParallelGetObjectFailsWithOnePiece) {
+    // the second of 4 pieces of 2500 bytes fails
+    _client->fail_offset = 2500;
+    std::string buf(kFileSize, '\0');
+    size_t bytes_read = 0;
+    auto st = _reader->_parallel_get_object(*_client, _pool.get(), 0, buf.data(), buf.size(),
+                                            2500, &bytes_read);
+    EXPECT_FALSE(st.ok());
+    EXPECT_EQ(_client->get_count, 4);
+}
+
+} // namespace doris::io
@@ -1495,4 +1495,30 @@ TEST_F(S3FileWriterTest, test_empty_file) {
     EXPECT_TRUE(index_file_writer->close().ok());
 }
 
+TEST_F(S3FileWriterTest, adaptive_part_size) {
+    auto interval = config::s3_write_part_size_double_interval;
+    Defer defer {[&]() { config::s3_write_part_size_double_interval = interval; }};
+    size_t base = config::s3_write_buffer_size;
+
+    config::s3_write_part_size_double_interval = 0;
+    io::FileWriterPtr fixed_writer;
+    ASSERT_TRUE(s3_fs->create_file("adaptive_part_size_0", &fixed_writer).ok());
+    auto* fixed = dynamic_cast<io::S3FileWriter*>(fixed_writer.get());
+    EXPECT_EQ(base, fixed->_part_size(1));
+    EXPECT_EQ(base, fixed->_part_size(10000));
+
+    config::s3_write_part_size_double_interval = 2;
+    io::FileWriterPtr file_writer;
+    ASSERT_TRUE(s3_fs->create_file("adaptive_part_size_1", &file_writer).ok());
+    auto* writer = dynamic_cast<io::S3FileWriter*>(file_writer.get());
+    EXPECT_EQ(base, writer->_part_size(1));
+    EXPECT_EQ(base, writer->_part_size(2));
+    EXPECT_EQ(2 * base, writer->_part_size(3));
+    EXPECT_EQ(4 * base, writer->_part_size(6));
+    EXPECT_EQ(256UL * 1024 * 1024, writer->_part_size(10000));
+    // the schedule is fixed once the writer is created
+    config::s3_write_part_size_double_interval = 0;
+    EXPECT_EQ(2 * base, writer->_part_size(3));
+}
+
 } // namespace doris
@@ -169,6 +169,24 @@ TEST_F(CollectionSimilarityTest, GetTopnBm25ScoresFallbackTest) {
     verify_row_ids(row_ids, {3, 1, 5, 2, 4, 6});
 }
 
+TEST_F(CollectionSimilarityTest, GetTopnBm25ScoresSkipsFilteredRowsTest) {
+    similarity->collect(1, 0.5f);
+    similarity->collect(2, 0.9f);
+    similarity->collect(3, 0.8f);
+    similarity->collect(4, 0.2f);
+
+    // row 2 was scored by the index but then removed, e.g. by the delete bitmap
+    roaring::Roaring bitmap = create_bitmap({1, 3, 4});
+    vectorized::IColumn::MutablePtr scores;
+    std::unique_ptr<std::vector<uint64_t>> row_ids = std::make_unique<std::vector<uint64_t>>();
+
+    similarity->get_topn_bm25_scores(&bitmap, scores, row_ids, OrderType::DESC, 2);
+
+    verify_scores(scores, {0.8f, 0.5f});
+    verify_row_ids(row_ids, {3, 1});
+    EXPECT_FALSE(bitmap.contains(2));
+}
+
 TEST_F(CollectionSimilarityTest, IdenticalScoresSortingTest) {
     similarity->collect(10, 0.5f);
     similarity->collect(20, 0.5f);
@@ -429,6 +429,37 @@ TEST_F(TestTimeSeriesCumulativeCompactionPolicy, calc_cumulative_compaction_scor
     EXPECT_EQ(true, ret);
 }
 
+TEST_F(TestTimeSeriesCumulativeCompactionPolicy, base_compaction_score_sealed_tablet) {
+    // compacted rowsets only, last loaded two days ago
+    for (auto [start, end] : {std::pair<int64_t, int64_t> {0, 1}, {2, 3}, {4, 5}}) {
+        RowsetMetaSharedPtr rs_meta(new RowsetMeta());
+        init_rs_meta(rs_meta, start, end);
+        rs_meta->set_creation_time(time(nullptr) - 2 * 86400);
+        static_cast<void>(_tablet_meta->add_rs_meta(rs_meta));
+    }
+
+    TabletSharedPtr _tablet(
+            new Tablet(_engine, _tablet_meta, nullptr, CUMULATIVE_TIME_SERIES_POLICY));
+    static_cast<void>(_tablet->init());
+    _tablet->calculate_cumulative_point();
+    EXPECT_EQ(6, _tablet->cumulative_layer_point());
+    std::shared_ptr<CumulativeCompactionPolicy> cumulative_compaction_policy =
+            CumulativeCompactionPolicyFactory::create_cumulative_compaction_policy(
+                    CUMULATIVE_TIME_SERIES_POLICY);
+
+    auto old_sealed_seconds = config::time_series_compaction_sealed_tablet_seconds;
+    config::time_series_compaction_sealed_tablet_seconds = 0;
+    EXPECT_FALSE(_tablet->suitable_for_compaction(CompactionType::BASE_COMPACTION,
+                                                  cumulative_compaction_policy));
+    config::time_series_compaction_sealed_tablet_seconds = 86400;
+    EXPECT_TRUE(_tablet->suitable_for_compaction(CompactionType::BASE_COMPACTION,
+                                                 cumulative_compaction_policy));
+    config::time_series_compaction_sealed_tablet_seconds = 3 * 86400;
+    EXPECT_FALSE(_tablet->suitable_for_compaction(CompactionType::BASE_COMPACTION,
+                                                  cumulative_compaction_policy));
+    config::time_series_compaction_sealed_tablet_seconds = old_sealed_seconds;
+}
+
 TEST_F(TestTimeSeriesCumulativeCompactionPolicy, pick_candidate_rowsets) {
     std::vector<RowsetMetaSharedPtr> rs_metas;
     init_rs_meta_normal(&rs_metas);
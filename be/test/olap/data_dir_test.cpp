@@ -0,0 +1,159 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "olap/data_dir.h"
+
+#include <gen_cpp/AgentService_types.h>
+#include <gen_cpp/olap_file.pb.h>
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+
+#include "common/config.h"
+#include "io/fs/local_file_system.h"
+#include "olap/options.h"
+#include "olap/rowset/rowset_meta_manager.h"
+#include "olap/storage_engine.h"
+#include "olap/tablet.h"
+#include "olap/tablet_manager.h"
+#include "runtime/exec_env.h"
+#include "util/defer_op.h"
+#include "util/uid_util.h"
+
+namespace doris {
+
+static constexpr int64_t kNumTablets = 600;
+static constexpr int64_t kNumRowsets = 300;
+
+class DataDirTest : public testing::Test {
+public:
+    void SetUp() override {
+        _data_path = "./ut_dir/data_dir_test";
+        auto st = io::global_local_filesystem()->delete_directory(_data_path);
+        ASSERT_TRUE(st.ok()) << st;
+        st = io::global_local_filesystem()->create_directory(_data_path + "/meta");
+        ASSERT_TRUE(st.ok()) << st;
+        open_data_dir();
+    }
+
+    void TearDown() override {
+        close_data_dir();
+        EXPECT_TRUE(io::global_local_filesystem()->delete_directory(_data_path).ok());
+    }
+
+protected:
+    void open_data_dir() {
+        EngineOptions options;
+        options.backend_uid = UniqueId::gen_uid();
+        ExecEnv::GetInstance()->set_storage_engine(std::make_unique<StorageEngine>(options));
+        _engine = &ExecEnv::GetInstance()->storage_engine().to_local();
+        _data_dir = std::make_unique<DataDir>(*_engine, _data_path, 1000000000);
+        auto st = _data_dir->init();
+        ASSERT_TRUE(st.ok()) << st;
+    }
+
+    // the tablets refer to the data dir, so the engine goes first
+    void close_data_dir() {
+        ExecEnv::GetInstance()->set_storage_engine(nullptr);
+        _engine = nullptr;
+        _data_dir.reset();
+    }
+
+    void create_tablet(int64_t tablet_id) {
+        TColumnType col_type;
+        col_type.__set_type(TPrimitiveType::BIGINT);
+        TColumn col;
+        col.__set_column_name("k1");
+        col.__set_column_type(col_type);
+        col.__set_is_key(true);
+        TTabletSchema tablet_schema;
+        tablet_schema.__set_short_key_column_count(1);
+        tablet_schema.__set_schema_hash(3333);
+        tablet_schema.__set_keys_type(TKeysType::DUP_KEYS);
+        tablet_schema.__set_storage_type(TStorageType::COLUMN);
+        tablet_schema.__set_columns({col});
+        TCreateTabletReq req;
+        req.__set_tablet_schema(tablet_schema);
+        req.__set_tablet_id(tablet_id);
+        req.__set_partition_id(1);
+        req.__set_version(1);
+        RuntimeProfile profile("CreateTablet");
+        auto st = _engine->tablet_manager()->create_tablet(req, {_data_dir.get()}, &profile);
+        ASSERT_TRUE(st.ok()) << st;
+    }
+
+    // visible empty rowsets of versions [2, num_rowsets + 1]
+    void save_rowset_metas(const TabletSharedPtr& tablet, int64_t num_rowsets) {
+        for (int64_t version = 2; version <= num_rowsets + 1; ++version) {
+            RowsetId rowset_id = _engine->next_rowset_id();
+            RowsetMetaPB rowset_meta_pb;
+            rowset_meta_pb.set_rowset_id(0);
+            rowset_meta_pb.set_rowset_id_v2(rowset_id.to_string());
+            rowset_meta_pb.set_tablet_id(tablet->tablet_id());
+            rowset_meta_pb.set_tablet_schema_hash(tablet->schema_hash());
+            *rowset_meta_pb.mutable_tablet_uid() = tablet->tablet_uid().to_proto();
+            rowset_meta_pb.set_partition_id(tablet->partition_id());
+            rowset_meta_pb.set_txn_id(version);
+            rowset_meta_pb.set_rowset_type(BETA_ROWSET);
+            rowset_meta_pb.set_rowset_state(VISIBLE);
+            rowset_meta_pb.set_start_version(version);
+            rowset_meta_pb.set_end_version(version);
+            rowset_meta_pb.set_num_segments(0);
+            rowset_meta_pb.set_empty(true);
+            auto st = RowsetMetaManager::save(_data_dir->get_meta(), tablet->tablet_uid(),
+                                              rowset_id, rowset_meta_pb, false);
+            ASSERT_TRUE(st.ok()) << st;
+        }
+    }
+
+    std::string _data_path;
+    StorageEngine* _engine = nullptr;
+    std::unique_ptr<DataDir> _data_dir;
+};
+
+// The metas of a data dir are parsed in batches on a thread pool, every tablet and rowset is
+// loaded whatever the number of threads.
+TEST_F(DataDirTest, LoadMetasInParallel) {
+    auto origin_load_threads = config::load_tablet_meta_threads_per_data_dir;
+    Defer defer {[&]() { config::load_tablet_meta_threads_per_data_dir = origin_load_threads; }};
+
+    for (int64_t tablet_id = 1; tablet_id <= kNumTablets; ++tablet_id) {
+        create_tablet(tablet_id);
+    }
+    save_rowset_metas(_engine->tablet_manager()->get_tablet(1), kNumRowsets);
+
+    for (int load_threads : {1, 4}) {
+        config::load_tablet_meta_threads_per_data_dir = load_threads;
+        close_data_dir();
+        open_data_dir();
+        auto st = _data_dir->load();
+        ASSERT_TRUE(st.ok()) << st;
+
+        for (int64_t tablet_id = 1; tablet_id <= kNumTablets; ++tablet_id) {
+            ASSERT_NE(_engine->tablet_manager()->get_tablet(tablet_id), nullptr)
+                    << "load threads: " << load_threads << ", tablet: " << tablet_id;
+        }
+        auto tablet = _engine->tablet_manager()->get_tablet(1);
+        EXPECT_EQ(tablet->max_version().second, kNumRowsets + 1)
+                << "load threads: " << load_threads;
+        EXPECT_EQ(tablet->version_count(), static_cast<size_t>(kNumRowsets + 1))
+                << "load threads: " << load_threads;
+    }
+}
+
+} // namespace doris
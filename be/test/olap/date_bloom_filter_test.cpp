@@ -18,6 +18,7 @@
 #include <gen_cpp/segment_v2.pb.h>
 #include <gtest/gtest.h>
 
+#include "common/config.h"
 #include "olap/comparison_predicate.h"
 #include "olap/in_list_predicate.h"
 #include "olap/rowset/beta_rowset.h"
@@ -156,10 +157,20 @@ TEST_F(DateBloomFilterTest, query_index_test) {
     EXPECT_TRUE(st.ok());
     st = segment->_create_column_readers(*footer_pb_shared);
     EXPECT_TRUE(st.ok());
+    // column readers are created on first access
+    EXPECT_TRUE(segment->_column_readers.empty());
 
     // date
     {
-        const auto& reader = segment->_column_readers[0];
+        // the memory of a column reader is charged once it is created
+        const int64_t mem_usage = segment->meta_mem_usage();
+        segment_v2::ColumnReader* reader = nullptr;
+        EXPECT_TRUE(segment->_get_or_create_column_reader(0, nullptr, &reader).ok());
+        EXPECT_EQ(segment->meta_mem_usage(), mem_usage + config::estimated_mem_per_column_reader);
+        segment_v2::ColumnReader* same_reader = nullptr;
+        EXPECT_TRUE(segment->_get_or_create_column_reader(0, nullptr, &same_reader).ok());
+        EXPECT_EQ(same_reader, reader);
+        EXPECT_EQ(segment->meta_mem_usage(), mem_usage + config::estimated_mem_per_column_reader);
         std::unique_ptr<BloomFilterIndexIterator> bf_iter;
         EXPECT_TRUE(reader->_bloom_filter_index->load(true, true, nullptr).ok());
         EXPECT_TRUE(reader->_bloom_filter_index->new_iterator(&bf_iter, nullptr).ok());
@@ -178,7 +189,8 @@ TEST_F(DateBloomFilterTest, query_index_test) {
 
     // datetime
     {
-        const auto& reader = segment->_column_readers[1];
+        segment_v2::ColumnReader* reader = nullptr;
+        EXPECT_TRUE(segment->_get_or_create_column_reader(1, nullptr, &reader).ok());
         std::unique_ptr<BloomFilterIndexIterator> bf_iter;
         EXPECT_TRUE(reader->_bloom_filter_index->load(true, true, nullptr).ok());
         EXPECT_TRUE(reader->_bloom_filter_index->new_iterator(&bf_iter, nullptr).ok());
@@ -239,7 +251,8 @@ TEST_F(DateBloomFilterTest, in_list_predicate_test) {
 
     // Test DATE column with IN predicate
     {
-        const auto& reader = segment->_column_readers[0];
+        segment_v2::ColumnReader* reader = nullptr;
+        EXPECT_TRUE(segment->_get_or_create_column_reader(0, nullptr, &reader).ok());
         std::unique_ptr<BloomFilterIndexIterator> bf_iter;
         EXPECT_TRUE(reader->_bloom_filter_index->load(true, true, nullptr).ok());
         EXPECT_TRUE(reader->_bloom_filter_index->new_iterator(&bf_iter, nullptr).ok());
@@ -289,7 +302,8 @@ TEST_F(DateBloomFilterTest, in_list_predicate_test) {
 
     // Test DATETIME column with IN predicate
     {
-        const auto& reader = segment->_column_readers[1];
+        segment_v2::ColumnReader* reader = nullptr;
+        EXPECT_TRUE(segment->_get_or_create_column_reader(1, nullptr, &reader).ok());
         std::unique_ptr<BloomFilterIndexIterator> bf_iter;
         EXPECT_TRUE(reader->_bloom_filter_index->load(true, true, nullptr).ok());
         EXPECT_TRUE(reader->_bloom_filter_index->new_iterator(&bf_iter, nullptr).ok());
@@ -0,0 +1,201 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "olap/task/engine_clone_task.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <thread>
+
+#include "common/config.h"
+#include "io/fs/local_file_system.h"
+#include "runtime/memory/mem_tracker_limiter.h"
+#include "util/threadpool.h"
+
+namespace doris {
+
+class EngineCloneTaskTest : public testing::Test {
+public:
+    void SetUp() override {
+        _saved_per_task = config::clone_download_parallelism_per_task;
+        _saved_per_disk = config::clone_download_parallelism_per_disk;
+        _saved_per_host = config::clone_download_parallelism_per_host;
+        config::clone_download_parallelism_per_task = 8;
+        config::clone_download_parallelism_per_disk = 8;
+        config::clone_download_parallelism_per_host = 8;
+        ASSERT_TRUE(ThreadPoolBuilder("EngineCloneTaskTest")
+                            .set_min_threads(1)
+                            .set_max_threads(8)
+                            .build(&_pool)
+                            .ok());
+        _mem_tracker = MemTrackerLimiter::create_shared(MemTrackerLimiter::Type::OTHER,
+                                                        "EngineCloneTaskTest");
+    }
+
+    void TearDown() override {
+        _pool->shutdown();
+        config::clone_download_parallelism_per_task = _saved_per_task;
+        config::clone_download_parallelism_per_disk = _saved_per_disk;
+        config::clone_download_parallelism_per_host = _saved_per_host;
+    }
+
+protected:
+    // a download that tracks how many run at the same time
+    Status download(size_t idx) {
+        auto running = ++_running;
+        int max_running = _max_running;
+        while (running > max_running && !_max_running.compare_exchange_weak(max_running, running)) {
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        ++_downloaded;
+        --_running;
+        return Status::OK();
+    }
+
+    Status parallel_download(size_t num, const std::string& data_dir, const std::string& host) {
+        return EngineCloneTask::_parallel_download(_pool.get(), _mem_tracker, num, data_dir, host,
+                                                   [this](size_t idx) { return download(idx); });
+    }
+
+    int _saved_per_task;
+    int _saved_per_disk;
+    int _saved_per_host;
+    std::unique_ptr<ThreadPool> _pool;
+    std::shared_ptr<MemTrackerLimiter> _mem_tracker;
+    std::atomic<int> _running = 0;
+    std::atomic<int> _max_running = 0;
+    std::atomic<int> _downloaded = 0;
+};
+
+TEST_F(EngineCloneTaskTest, DownloadWithPerTaskCap) {
+    config::clone_download_parallelism_per_task = 3;
+    ASSERT_TRUE(parallel_download(12, "disk_1", "host_1").ok());
+    EXPECT_EQ(_downloaded, 12);
+    EXPECT_LE(_max_running, 3);
+    EXPECT_GT(_max_running, 1);
+}
+
+TEST_F(EngineCloneTaskTest, DownloadWithPerDiskCap) {
+    config::clone_download_parallelism_per_disk = 2;
+    // two tasks from different hosts into the same data dir
+    Status st1;
+    Status st2;
+    std::thread t1([&]() { st1 = parallel_download(8, "disk_1", "host_1"); });
+    std::thread t2([&]() { st2 = parallel_download(8, "disk_1", "host_2"); });
+    t1.join();
+    t2.join();
+    ASSERT_TRUE(st1.ok()) << st1;
+    ASSERT_TRUE(st2.ok()) << st2;
+    EXPECT_EQ(_downloaded, 16);
+    EXPECT_LE(_max_running, 2);
+}
+
+TEST_F(EngineCloneTaskTest, DownloadWithPerHostCap) {
+    config::clone_download_parallelism_per_host = 3;
+    // two tasks from the same host into different data dirs
+    Status st1;
+    Status st2;
+    std::thread t1([&]() { st1 = parallel_download(8, "disk_1", "host_1"); });
+    std::thread t2([&]() { st2 = parallel_download(8, "disk_2", "host_1"); });
+    t1.join();
+    t2.join();
+    ASSERT_TRUE(st1.ok()) << st1;
+    ASSERT_TRUE(st2.ok()) << st2;
+    EXPECT_EQ(_downloaded, 16);
+    EXPECT_LE(_max_running, 3);
+}
+
+TEST_F(EngineCloneTaskTest, DownloadStopsAfterFailure) {
+    config::clone_download_parallelism_per_task = 1;
+    std::atomic<int> tried = 0;
+    auto st = EngineCloneTask::_parallel_download(
+            _pool.get(), _mem_tracker, 10, "disk_1", "host_1", [&](size_t idx) -> Status {
+                ++tried;
+                if (idx == 1) {
+                    return Status::InternalError("download failed");
+                }
+                return Status::OK();
+            });
+    EXPECT_FALSE(st.ok());
+    EXPECT_EQ(tried, 2);
+}
+
+TEST_F(EngineCloneTaskTest, DownloadWithoutPool) {
+    ASSERT_TRUE(EngineCloneTask::_parallel_download(
+                        nullptr, _mem_tracker, 5, "disk_1", "host_1",
+                        [this](size_t idx) { return download(idx); })
+                        .ok());
+    EXPECT_EQ(_downloaded, 5);
+    EXPECT_EQ(_max_running, 1);
+}
+
+TEST_F(EngineCloneTaskTest, LimiterTimeoutAndCancel) {
+    CloneDownloadLimiter limiter;
+    std::atomic<bool> cancelled = false;
+    ASSERT_TRUE(limiter.acquire("disk_1", 1, 1000, cancelled).ok());
+    // other keys have their own slots
+    ASSERT_TRUE(limiter.acquire("disk_2", 1, 1000, cancelled).ok());
+
+    auto st = limiter.acquire("disk_1", 1, 50, cancelled);
+    EXPECT_TRUE(st.is<ErrorCode::TIMEOUT>()) << st;
+
+    cancelled = true;
+    st = limiter.acquire("disk_1", 1, 60 * 1000, cancelled);
+    EXPECT_TRUE(st.is<ErrorCode::CANCELLED>()) << st;
+
+    // a released slot wakes up the waiter
+    cancelled = false;
+    std::thread releaser([&]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        limiter.release("disk_1");
+    });
+    EXPECT_TRUE(limiter.acquire("disk_1", 1, 60 * 1000, cancelled).ok());
+    releaser.join();
+    limiter.release("disk_1");
+    limiter.release("disk_2");
+}
+
+TEST_F(EngineCloneTaskTest, CheckDownloadedFile) {
+    std::string dir = std::filesystem::current_path().string() + "/engine_clone_task_test";
+    ASSERT_TRUE(io::global_local_filesystem()->delete_directory(dir).ok());
+    ASSERT_TRUE(io::global_local_filesystem()->create_directory(dir).ok());
+    std::string file = dir + "/0.dat";
+    {
+        std::ofstream out(file);
+        out << "hello";
+    }
+
+    EXPECT_TRUE(EngineCloneTask::_check_downloaded_file(file, 5, "").ok());
+    EXPECT_TRUE(
+            EngineCloneTask::_check_downloaded_file(file, 5, "5d41402abc4b2a76b9719d911017c592")
+                    .ok());
+    EXPECT_FALSE(EngineCloneTask::_check_downloaded_file(file, 6, "").ok());
+    EXPECT_FALSE(
+            EngineCloneTask::_check_downloaded_file(file, 5, "00000000000000000000000000000000")
+                    .ok());
+    EXPECT_FALSE(EngineCloneTask::_check_downloaded_file(dir + "/1.dat", 5, "").ok());
+
+    ASSERT_TRUE(io::global_local_filesystem()->delete_directory(dir).ok());
+}
+
+} // namespace doris
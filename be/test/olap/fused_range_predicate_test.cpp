@@ -0,0 +1,99 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "olap/fused_range_predicate.h"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <vector>
+
+#include "olap/comparison_predicate.h"
+#include "vec/columns/column_nullable.h"
+#include "vec/columns/predicate_column.h"
+
+namespace doris {
+
+static vectorized::MutableColumnPtr create_int_column(bool nullable, int rows) {
+    auto data = vectorized::PredicateColumnType<TYPE_INT>::create();
+    auto null_map = vectorized::ColumnUInt8::create();
+    for (int i = 0; i < rows; i++) {
+        data->insert_data(reinterpret_cast<const char*>(&i), 0);
+        null_map->insert_value(i % 3 == 0);
+    }
+    if (nullable) {
+        return vectorized::ColumnNullable::create(std::move(data), std::move(null_map));
+    }
+    return data;
+}
+
+template <PredicateType LowerPT, PredicateType UpperPT>
+static void check_fused_equals_separate(bool nullable) {
+    const int rows = 100;
+    auto column = create_int_column(nullable, rows);
+    ComparisonPredicateBase<TYPE_INT, LowerPT> lower(0, 10);
+    ComparisonPredicateBase<TYPE_INT, UpperPT> upper(0, 50);
+
+    // argument order does not matter
+    auto fused = FusedRangePredicate::create(&upper, &lower);
+    ASSERT_NE(fused, nullptr);
+    EXPECT_EQ(fused->lower(), &lower);
+    EXPECT_EQ(fused->upper(), &upper);
+
+    std::vector<uint8_t> expected(rows);
+    lower.evaluate_vec(*column, rows, (bool*)expected.data());
+    upper.evaluate_and_vec(*column, rows, (bool*)expected.data());
+
+    std::vector<uint8_t> flags(rows);
+    fused->evaluate_vec(*column, rows, (bool*)flags.data());
+    EXPECT_EQ(flags, expected);
+
+    std::vector<uint8_t> and_flags(rows);
+    for (int i = 0; i < rows; i++) {
+        and_flags[i] = i % 2;
+        expected[i] &= and_flags[i];
+    }
+    fused->evaluate_and_vec(*column, rows, (bool*)and_flags.data());
+    EXPECT_EQ(and_flags, expected);
+}
+
+TEST(FusedRangePredicateTest, EvaluateVec) {
+    for (bool nullable : {false, true}) {
+        check_fused_equals_separate<PredicateType::GE, PredicateType::LT>(nullable);
+        check_fused_equals_separate<PredicateType::GE, PredicateType::LE>(nullable);
+        check_fused_equals_separate<PredicateType::GT, PredicateType::LT>(nullable);
+        check_fused_equals_separate<PredicateType::GT, PredicateType::LE>(nullable);
+    }
+}
+
+TEST(FusedRangePredicateTest, NotFusable) {
+    ComparisonPredicateBase<TYPE_INT, PredicateType::GE> lower(0, 10);
+    ComparisonPredicateBase<TYPE_INT, PredicateType::LT> upper(0, 50);
+    ComparisonPredicateBase<TYPE_INT, PredicateType::LT> other_column(1, 50);
+    ComparisonPredicateBase<TYPE_INT, PredicateType::GT> another_lower(0, 20);
+    ComparisonPredicateBase<TYPE_INT, PredicateType::LT> opposite(0, 50, true);
+    ComparisonPredicateBase<TYPE_BIGINT, PredicateType::LT> other_type(0, 50);
+    ComparisonPredicateBase<TYPE_INT, PredicateType::EQ> eq(0, 50);
+
+    EXPECT_EQ(FusedRangePredicate::create(&lower, &other_column), nullptr);
+    EXPECT_EQ(FusedRangePredicate::create(&lower, &another_lower), nullptr);
+    EXPECT_EQ(FusedRangePredicate::create(&lower, &opposite), nullptr);
+    EXPECT_EQ(FusedRangePredicate::create(&lower, &other_type), nullptr);
+    EXPECT_EQ(FusedRangePredicate::create(&lower, &eq), nullptr);
+}
+
+} // namespace doris
@@ -48,6 +48,8 @@ TEST_F(InvertedIndexParserTest, TestParserTypeToString) {
               INVERTED_INDEX_PARSER_BASIC);
     EXPECT_EQ(inverted_index_parser_type_to_string(InvertedIndexParserType::PARSER_IK),
               INVERTED_INDEX_PARSER_IK);
+    EXPECT_EQ(inverted_index_parser_type_to_string(InvertedIndexParserType::PARSER_NGRAM),
+              INVERTED_INDEX_PARSER_NGRAM);
     EXPECT_EQ(inverted_index_parser_type_to_string(InvertedIndexParserType::PARSER_UNKNOWN),
               INVERTED_INDEX_PARSER_UNKNOWN);
 }
@@ -74,6 +76,8 @@ TEST_F(InvertedIndexParserTest, TestGetParserTypeFromString) {
     EXPECT_EQ(get_inverted_index_parser_type_from_string("basic"),
               InvertedIndexParserType::PARSER_BASIC);
     EXPECT_EQ(get_inverted_index_parser_type_from_string("ik"), InvertedIndexParserType::PARSER_IK);
+    EXPECT_EQ(get_inverted_index_parser_type_from_string("ngram"),
+              InvertedIndexParserType::PARSER_NGRAM);
 
     // Test unknown parser type
     EXPECT_EQ(get_inverted_index_parser_type_from_string("invalid"),
@@ -0,0 +1,245 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "olap/like_column_predicate.h"
+
+#include <gen_cpp/olap_file.pb.h>
+#include <gtest/gtest.h>
+
+#include <list>
+#include <memory>
+#include <roaring/roaring.hh>
+#include <string>
+#include <vector>
+
+#include "io/fs/local_file_system.h"
+#include "olap/field.h"
+#include "olap/olap_common.h"
+#include "olap/options.h"
+#include "olap/rowset/segment_v2/index_file_reader.h"
+#include "olap/rowset/segment_v2/index_file_writer.h"
+#include "olap/rowset/segment_v2/index_query_context.h"
+#include "olap/rowset/segment_v2/inverted_index_cache.h"
+#include "olap/rowset/segment_v2/inverted_index_desc.h"
+#include "olap/rowset/segment_v2/inverted_index_iterator.h"
+#include "olap/rowset/segment_v2/inverted_index_reader.h"
+#include "olap/rowset/segment_v2/inverted_index_writer.h"
+#include "olap/tablet_schema.h"
+#include "runtime/exec_env.h"
+#include "runtime/runtime_state.h"
+#include "udf/udf.h"
+#include "vec/columns/predicate_column.h"
+#include "vec/data_types/data_type_string.h"
+#include "vec/functions/like.h"
+
+namespace doris {
+
+TEST(LikeColumnPredicateTest, PatternLiteralFragments) {
+    auto fragments = [](const std::string& pattern, char escape_char = '\\') {
+        return like_pattern_literal_fragments(StringRef(pattern), escape_char);
+    };
+    using Fragments = std::vector<std::string>;
+
+    EXPECT_EQ(fragments("%error%"), Fragments {"error"});
+    EXPECT_EQ(fragments("%foo%bar_baz"), (Fragments {"foo", "bar", "baz"}));
+    EXPECT_EQ(fragments("abc"), Fragments {"abc"});
+    EXPECT_TRUE(fragments("%%_").empty());
+
+    // escaped wildcards are literal characters
+    EXPECT_EQ(fragments("%50\\%_off%"), (Fragments {"50%", "off"}));
+    EXPECT_EQ(fragments("%a\\\\b%"), Fragments {"a\\b"});
+    EXPECT_EQ(fragments("%50#%%", '#'), Fragments {"50%"});
+}
+
+
+class LikeColumnPredicateIndexTest : public testing::Test {
+public:
+    const std::string kTestDir = "./ut_dir/like_column_predicate_test";
+
+    void SetUp() override {
+        auto st = io::global_local_filesystem()->delete_directory(kTestDir);
+        ASSERT_TRUE(st.ok()) << st;
+        st = io::global_local_filesystem()->create_directory(kTestDir);
+        ASSERT_TRUE(st.ok()) << st;
+        std::vector<StorePath> paths;
+        paths.emplace_back(kTestDir, 1024);
+        auto tmp_file_dirs = std::make_unique<segment_v2::TmpFileDirs>(paths);
+        st = tmp_file_dirs->init();
+        ASSERT_TRUE(st.ok()) << st;
+        ExecEnv::GetInstance()->set_tmp_file_dir(std::move(tmp_file_dirs));
+
+        int64_t inverted_index_cache_limit = 1024 * 1024 * 1024;
+        _searcher_cache = std::unique_ptr<segment_v2::InvertedIndexSearcherCache>(
+                segment_v2::InvertedIndexSearcherCache::create_global_instance(
+                        inverted_index_cache_limit, 1));
+        _query_cache = std::unique_ptr<segment_v2::InvertedIndexQueryCache>(
+                segment_v2::InvertedIndexQueryCache::create_global_cache(
+                        inverted_index_cache_limit, 1));
+        ExecEnv::GetInstance()->set_inverted_index_searcher_cache(_searcher_cache.get());
+        ExecEnv::GetInstance()->_inverted_index_query_cache = _query_cache.get();
+
+        TabletIndexPB index_meta_pb;
+        index_meta_pb.set_index_type(IndexType::INVERTED);
+        index_meta_pb.set_index_id(1);
+        index_meta_pb.set_index_name("ngram_index");
+        index_meta_pb.add_col_unique_id(1);
+        index_meta_pb.mutable_properties()->insert(
+                {INVERTED_INDEX_PARSER_KEY, INVERTED_INDEX_PARSER_NGRAM});
+        _index_meta.init_from_pb(index_meta_pb);
+    }
+
+    void TearDown() override {
+        ExecEnv::GetInstance()->set_inverted_index_searcher_cache(nullptr);
+        ExecEnv::GetInstance()->_inverted_index_query_cache = nullptr;
+        EXPECT_TRUE(io::global_local_filesystem()->delete_directory(kTestDir).ok());
+    }
+
+protected:
+    // Writes an ngram index of `values` for column c2 and returns an iterator on it.
+    std::unique_ptr<segment_v2::IndexIterator> write_and_open_index(
+            const std::vector<std::string>& values) {
+        TabletColumn column;
+        column.set_name("c2");
+        column.set_unique_id(1);
+        column.set_type(FieldType::OLAP_FIELD_TYPE_VARCHAR);
+        column.set_length(65535);
+        column.set_is_nullable(false);
+
+        auto index_path_prefix = segment_v2::InvertedIndexDescriptor::get_index_file_path_prefix(
+                kTestDir + "/rowset_0.dat");
+        io::FileWriterPtr file_writer;
+        auto fs = io::global_local_filesystem();
+        auto st = fs->create_file(
+                segment_v2::InvertedIndexDescriptor::get_index_file_path_v2(index_path_prefix),
+                &file_writer);
+        EXPECT_TRUE(st.ok()) << st;
+        auto index_file_writer = std::make_unique<segment_v2::IndexFileWriter>(
+                fs, index_path_prefix, "rowset", 0, InvertedIndexStorageFormatPB::V2,
+                std::move(file_writer));
+        std::unique_ptr<Field> field(FieldFactory::create(column));
+        std::unique_ptr<segment_v2::IndexColumnWriter> column_writer;
+        st = segment_v2::IndexColumnWriter::create(field.get(), &column_writer,
+                                                   index_file_writer.get(), &_index_meta);
+        EXPECT_TRUE(st.ok()) << st;
+        std::vector<Slice> slices(values.begin(), values.end());
+        st = column_writer->add_values("c2", slices.data(), slices.size());
+        EXPECT_TRUE(st.ok()) << st;
+        st = column_writer->finish();
+        EXPECT_TRUE(st.ok()) << st;
+        st = index_file_writer->close();
+        EXPECT_TRUE(st.ok()) << st;
+
+        auto index_file_reader = std::make_shared<segment_v2::IndexFileReader>(
+                fs, index_path_prefix, InvertedIndexStorageFormatPB::V2);
+        st = index_file_reader->init();
+        EXPECT_TRUE(st.ok()) << st;
+        auto reader = segment_v2::FullTextIndexReader::create_shared(&_index_meta,
+                                                                     index_file_reader);
+        std::unique_ptr<segment_v2::IndexIterator> iterator;
+        st = reader->new_iterator(&iterator);
+        EXPECT_TRUE(st.ok()) << st;
+
+        TQueryOptions query_options;
+        query_options.enable_inverted_index_searcher_cache = false;
+        _runtime_state.set_query_options(query_options);
+        _io_ctx = std::make_unique<io::IOContext>();
+        auto context = std::make_shared<segment_v2::IndexQueryContext>();
+        context->io_ctx = _io_ctx.get();
+        context->stats = &_stats;
+        context->runtime_state = &_runtime_state;
+        static_cast<segment_v2::InvertedIndexIterator*>(iterator.get())->set_context(context);
+        return iterator;
+    }
+
+    std::unique_ptr<LikeColumnPredicate<TYPE_STRING>> create_predicate(const std::string& pattern,
+                                                                       bool opposite = false) {
+        auto& fn_ctx = _fn_ctxs.emplace_back(
+                FunctionContext::create_context(&_runtime_state, nullptr, {}));
+        auto state = std::make_shared<vectorized::LikeState>();
+        state->is_like_pattern = true;
+        state->function = vectorized::FunctionLike::like_fn;
+        state->scalar_function = vectorized::FunctionLike::like_fn_scalar;
+        const auto& pattern_ref = _patterns.emplace_back(pattern);
+        auto st = vectorized::FunctionLike::construct_like_const_state(
+                fn_ctx.get(), StringRef(pattern_ref), state);
+        EXPECT_TRUE(st.ok()) << st;
+        fn_ctx->set_function_state(FunctionContext::THREAD_LOCAL, state);
+        return std::make_unique<LikeColumnPredicate<TYPE_STRING>>(opposite, 0, fn_ctx.get(),
+                                                                   StringRef(pattern_ref));
+    }
+
+    TabletIndex _index_meta;
+    std::unique_ptr<segment_v2::InvertedIndexSearcherCache> _searcher_cache;
+    std::unique_ptr<segment_v2::InvertedIndexQueryCache> _query_cache;
+    RuntimeState _runtime_state;
+    OlapReaderStatistics _stats;
+    std::unique_ptr<io::IOContext> _io_ctx;
+    // the predicates refer to their function context and pattern
+    std::vector<std::unique_ptr<FunctionContext>> _fn_ctxs;
+    std::list<std::string> _patterns;
+};
+
+TEST_F(LikeColumnPredicateIndexTest, EvaluateByNgramIndex) {
+    // rows 3 and 4 hold every gram of "error" but do not match '%error%': row 3 has them apart,
+    // and the index lowercases row 4
+    const std::vector<std::string> values = {"connection error on host", "all good", "error",
+                                             "errox rror", "ERROR in caps", "no match"};
+    const auto num_rows = static_cast<uint32_t>(values.size());
+    auto iterator = write_and_open_index(values);
+    ASSERT_NE(iterator, nullptr);
+    const vectorized::IndexFieldNameAndTypePair name_with_type {
+            "c2", std::make_shared<vectorized::DataTypeString>()};
+
+    auto predicate = create_predicate("%error%");
+    roaring::Roaring bitmap;
+    bitmap.addRange(0, num_rows);
+    auto st = predicate->evaluate(name_with_type, iterator.get(), num_rows, &bitmap);
+    ASSERT_TRUE(st.ok()) << st;
+    EXPECT_TRUE(bitmap == roaring::Roaring::bitmapOf(4, 0, 2, 3, 4)) << bitmap.toString();
+
+    // the predicate is rechecked on the candidate rows
+    auto column = vectorized::PredicateColumnType<TYPE_STRING>::create();
+    for (const auto& value : values) {
+        column->insert_data(value.data(), value.size());
+    }
+    std::vector<uint16_t> sel;
+    for (auto row : bitmap) {
+        sel.push_back(static_cast<uint16_t>(row));
+    }
+    auto selected = predicate->evaluate(*column, sel.data(), static_cast<uint16_t>(sel.size()));
+    sel.resize(selected);
+    EXPECT_EQ(sel, (std::vector<uint16_t> {0, 2}));
+
+    // every fragment narrows the rows, short fragments are not looked up
+    predicate = create_predicate("%connection%on%host");
+    bitmap.addRange(0, num_rows);
+    st = predicate->evaluate(name_with_type, iterator.get(), num_rows, &bitmap);
+    ASSERT_TRUE(st.ok()) << st;
+    EXPECT_TRUE(bitmap == roaring::Roaring::bitmapOf(1, 0)) << bitmap.toString();
+
+    // the rows are kept when the index can not serve the predicate
+    for (auto [pattern, opposite] : std::vector<std::pair<std::string, bool>> {
+                 {"%er%", false}, {"%error%", true}}) {
+        predicate = create_predicate(pattern, opposite);
+        bitmap.addRange(0, num_rows);
+        st = predicate->evaluate(name_with_type, iterator.get(), num_rows, &bitmap);
+        EXPECT_TRUE(st.is<ErrorCode::INVERTED_INDEX_EVALUATE_SKIPPED>()) << st;
+        EXPECT_EQ(bitmap.cardinality(), num_rows);
+    }
+}
+
+} // namespace doris
@@ -399,6 +399,155 @@ TEST_F(CacheTest, UsageLRUK) {
     ASSERT_EQ(896, cache.get_usage());
 }
 
+static bool lookup_LRUCache(LRUCache& cache, const CacheKey& key) {
+    uint32_t hash = key.hash(key.data(), key.size(), 0);
+    auto* handle = cache.lookup(key, hash);
+    cache.release(handle);
+    return handle != nullptr;
+}
+
+// Hot keys are hit before a scan of keys accessed only once, the scan keys are looked up
+// before being inserted like the callers of the caches do.
+static int hot_keys_after_scan(CacheEvictionPolicyType eviction_policy) {
+    LRUCache cache(LRUCacheType::NUMBER, false, eviction_policy);
+    cache.set_capacity(10);
+    std::vector<std::string> hot_keys;
+    for (int i = 0; i < 5; i++) {
+        hot_keys.push_back(std::to_string(i));
+        lookup_LRUCache(cache, hot_keys.back());
+        insert_number_LRUCache(cache, hot_keys.back(), i, 1, CachePriority::NORMAL);
+    }
+    for (int n = 0; n < 2; n++) {
+        for (auto& key : hot_keys) {
+            EXPECT_TRUE(lookup_LRUCache(cache, key));
+        }
+    }
+    for (int i = 100; i < 200; i++) {
+        std::string key = std::to_string(i);
+        lookup_LRUCache(cache, key);
+        insert_number_LRUCache(cache, key, i, 1, CachePriority::NORMAL);
+    }
+    EXPECT_LE(cache.get_usage(), 10);
+    int hot_keys_in_cache = 0;
+    for (auto& key : hot_keys) {
+        hot_keys_in_cache += lookup_LRUCache(cache, key);
+    }
+    return hot_keys_in_cache;
+}
+
+TEST_F(CacheTest, EvictionPolicyScanResistance) {
+    EXPECT_EQ(0, hot_keys_after_scan(CacheEvictionPolicyType::LRU));
+    EXPECT_EQ(5, hot_keys_after_scan(CacheEvictionPolicyType::SLRU));
+    EXPECT_EQ(5, hot_keys_after_scan(CacheEvictionPolicyType::S3_FIFO));
+    EXPECT_EQ(5, hot_keys_after_scan(CacheEvictionPolicyType::W_TINY_LFU));
+}
+
+TEST_F(CacheTest, EvictionPolicyS3FIFOGhost) {
+    LRUCache cache(LRUCacheType::NUMBER, false, CacheEvictionPolicyType::S3_FIFO);
+    cache.set_capacity(10);
+    for (int i = 0; i < 11; i++) {
+        insert_number_LRUCache(cache, std::to_string(i), i, 1, CachePriority::NORMAL);
+    }
+    // "0" was evicted from probation without being hit
+    ASSERT_FALSE(lookup_LRUCache(cache, "0"));
+
+    insert_number_LRUCache(cache, "0", 0, 1, CachePriority::NORMAL);
+    CacheKey key("0");
+    auto* handle = cache.lookup(key, key.hash(key.data(), key.size(), 0));
+    ASSERT_NE(handle, nullptr);
+    ASSERT_TRUE(reinterpret_cast<LRUHandle*>(handle)->in_protected);
+    cache.release(handle);
+}
+
+TEST_F(CacheTest, EvictionPolicyWTinyLFUAdmission) {
+    LRUCache cache(LRUCacheType::NUMBER, false, CacheEvictionPolicyType::W_TINY_LFU);
+    cache.set_capacity(2);
+    insert_number_LRUCache(cache, "a", 1, 1, CachePriority::NORMAL);
+    insert_number_LRUCache(cache, "b", 2, 1, CachePriority::NORMAL);
+    for (int i = 0; i < 3; i++) {
+        ASSERT_TRUE(lookup_LRUCache(cache, "a"));
+        ASSERT_TRUE(lookup_LRUCache(cache, "b"));
+    }
+    // "c" is less frequent than the victim, so it is not admitted
+    insert_number_LRUCache(cache, "c", 3, 1, CachePriority::NORMAL);
+    ASSERT_FALSE(lookup_LRUCache(cache, "c"));
+    ASSERT_EQ(2, cache.get_element_count());
+
+    // "d" is admitted after it is looked up as often as the victim
+    for (int i = 0; i < 4; i++) {
+        ASSERT_FALSE(lookup_LRUCache(cache, "d"));
+    }
+    insert_number_LRUCache(cache, "d", 4, 1, CachePriority::NORMAL);
+    ASSERT_TRUE(lookup_LRUCache(cache, "d"));
+    ASSERT_EQ(2, cache.get_element_count());
+}
+
+TEST_F(CacheTest, FrequencySketch) {
+    FrequencySketch sketch;
+    for (int i = 0; i < 5; i++) {
+        sketch.increment(1);
+    }
+    sketch.increment(2);
+    ASSERT_GE(sketch.frequency(1), 5);
+    ASSERT_GE(sketch.frequency(2), 1);
+    ASSERT_LT(sketch.frequency(2), 5);
+
+    for (int i = 0; i < 20; i++) {
+        sketch.increment(3);
+    }
+    ASSERT_EQ(15, sketch.frequency(3));
+
+    // counters are halved after 10 * width increments
+    for (int i = 0; i < 640; i++) {
+        sketch.increment(1000 + i);
+    }
+    ASSERT_LT(sketch.frequency(3), 15);
+}
+
+TEST_F(CacheTest, EvictionPolicyOfCacheType) {
+    auto origin_policies = config::cache_eviction_policies;
+    config::cache_eviction_policies = "ForUTCacheNumber:S3_FIFO,ForUTCacheSize:UNKNOWN";
+    EXPECT_EQ(CacheEvictionPolicyType::S3_FIFO,
+              LRUCachePolicy::eviction_policy_of(CachePolicy::CacheType::FOR_UT_CACHE_NUMBER));
+    EXPECT_EQ(CacheEvictionPolicyType::LRU,
+              LRUCachePolicy::eviction_policy_of(CachePolicy::CacheType::FOR_UT_CACHE_SIZE));
+    EXPECT_EQ(CacheEvictionPolicyType::LRU,
+              LRUCachePolicy::eviction_policy_of(CachePolicy::CacheType::QUERY_CACHE));
+    config::cache_eviction_policies = origin_policies;
+}
+
+TEST_F(CacheTest, ProbationaryInsert) {
+    for (auto eviction_policy : {CacheEvictionPolicyType::LRU, CacheEvictionPolicyType::SLRU,
+                                 CacheEvictionPolicyType::S3_FIFO}) {
+        LRUCache cache(LRUCacheType::NUMBER, false, eviction_policy);
+        cache.set_capacity(10);
+        for (int i = 0; i < 5; i++) {
+            insert_number_LRUCache(cache, std::to_string(i), i, 1, CachePriority::NORMAL);
+        }
+        // pages of a scan, "100" is hit, others are read once
+        for (int i = 100; i < 105; i++) {
+            CacheKey key(std::to_string(i));
+            uint32_t hash = key.hash(key.data(), key.size(), 0);
+            auto* cache_value = new CacheTest::CacheValue(EncodeValue(i));
+            cache.release(cache.insert(key, hash, cache_value, 1, CachePriority::NORMAL, true));
+        }
+        ASSERT_TRUE(lookup_LRUCache(cache, "100"));
+
+        // probationary entries which are never hit are evicted first
+        for (int i = 200; i < 204; i++) {
+            insert_number_LRUCache(cache, std::to_string(i), i, 1, CachePriority::NORMAL);
+        }
+        ASSERT_EQ(10, cache.get_usage());
+        for (int i = 0; i < 5; i++) {
+            ASSERT_TRUE(lookup_LRUCache(cache, std::to_string(i))) << i;
+        }
+        ASSERT_TRUE(lookup_LRUCache(cache, "100"));
+        for (int i = 101; i < 105; i++) {
+            ASSERT_FALSE(lookup_LRUCache(cache, std::to_string(i))) << i;
+        }
+    }
+}
+
 TEST_F(CacheTest, Prune) {
     LRUCache cache(LRUCacheType::NUMBER);
     cache.set_capacity(5);
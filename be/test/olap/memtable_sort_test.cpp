@@ -17,7 +17,14 @@
 
 #include <gtest/gtest.h>
 
+#include <numeric>
+#include <tuple>
+
 #include "olap/memtable.h"
+#include "vec/columns/column_nullable.h"
+#include "vec/columns/column_vector.h"
+#include "vec/data_types/data_type_nullable.h"
+#include "vec/data_types/data_type_number.h"
 
 namespace doris {
 
@@ -80,4 +87,36 @@ TEST_F(MemTableSortTest, Tie) {
     EXPECT_FALSE(it3.next());
 }
 
+TEST_F(MemTableSortTest, NormalizedKeySorter) {
+    // key columns: nullable int, bigint
+    auto int_column = vectorized::ColumnInt32::create();
+    auto null_map = vectorized::ColumnUInt8::create();
+    auto bigint_column = vectorized::ColumnInt64::create();
+    std::vector<std::tuple<int32_t, bool, int64_t>> rows = {
+            {3, false, -1}, {-5, false, 7}, {0, true, 2},  {3, false, -8},
+            {-5, false, 7}, {0, true, 1},  {100, false, 0}, {-5, false, 7}};
+    for (const auto& [int_value, is_null, bigint_value] : rows) {
+        int_column->insert_value(int_value);
+        null_map->insert_value(is_null);
+        bigint_column->insert_value(bigint_value);
+    }
+    vectorized::Block block;
+    block.insert({vectorized::ColumnNullable::create(std::move(int_column), std::move(null_map)),
+                  vectorized::make_nullable(std::make_shared<vectorized::DataTypeInt32>()),
+                  "k1"});
+    block.insert({std::move(bigint_column), std::make_shared<vectorized::DataTypeInt64>(), "k2"});
+    auto mutable_block = vectorized::MutableBlock::build_mutable_block(&block);
+
+    NormalizedKeySorter sorter;
+    DorisVector<uint32_t> row_pos(rows.size());
+    std::iota(row_pos.begin(), row_pos.end(), 0);
+    ASSERT_TRUE(sorter.init(mutable_block, 2, row_pos));
+
+    // nulls first, then by value, ties by row_pos
+    EXPECT_EQ(sorter.sort(false), (DorisVector<uint32_t> {5, 2, 1, 4, 7, 3, 0, 6}));
+    EXPECT_EQ(sorter.sort(true), (DorisVector<uint32_t> {5, 2, 7, 4, 1, 3, 0, 6}));
+    EXPECT_TRUE(sorter.key_equals(1, 7));
+    EXPECT_FALSE(sorter.key_equals(0, 3));
+}
+
 } // namespace doris
@@ -621,5 +621,37 @@ TEST_F(OrderedDataCompactionTest, test_index_disk_size) {
               << std::endl;
     EXPECT_EQ(out_rowset->rowset_meta()->total_disk_size(), expected_total_size);
 }
+
+TEST_F(OrderedDataCompactionTest, test_overlapping_rowsets_with_disjoint_segments) {
+    auto num_input_rowset = 3;
+    auto num_segments = 2;
+    auto rows_per_segment = 50;
+    std::vector<std::vector<std::vector<std::tuple<int64_t, int64_t>>>> input_data;
+    generate_input_data(num_input_rowset, num_segments, rows_per_segment, input_data);
+
+    TabletSchemaSPtr tablet_schema = create_schema();
+    TabletSharedPtr tablet = create_tablet(*tablet_schema, false, 10000, false);
+    EXPECT_TRUE(io::global_local_filesystem()->create_directory(tablet->tablet_path()).ok());
+    // flagged overlapping, but the segments hold ascending, disjoint key ranges
+    std::vector<RowsetSharedPtr> input_rowsets;
+    for (auto i = 0; i < num_input_rowset; i++) {
+        RowsetSharedPtr rowset = create_rowset(tablet_schema, tablet, OVERLAPPING, input_data[i]);
+        EXPECT_TRUE(rowset->is_segments_overlapping());
+        input_rowsets.push_back(rowset);
+    }
+    CumulativeCompaction cu_compaction(*engine_ref, tablet);
+    cu_compaction._input_rowsets = input_rowsets;
+    EXPECT_TRUE(cu_compaction.handle_ordered_data_compaction());
+    EXPECT_EQ(cu_compaction._output_rowset->num_segments(), num_input_rowset * num_segments);
+    EXPECT_FALSE(cu_compaction._output_rowset->is_segments_overlapping());
+
+    // reversed segments overlap in key order, so they still need a merge
+    std::vector<std::vector<std::tuple<int64_t, int64_t>>> reversed_data = {input_data[2][1],
+                                                                            input_data[2][0]};
+    auto reversed_rowset = create_rowset(tablet_schema, tablet, OVERLAPPING, reversed_data);
+    CumulativeCompaction reversed_compaction(*engine_ref, tablet);
+    reversed_compaction._input_rowsets = {reversed_rowset};
+    EXPECT_FALSE(reversed_compaction.handle_ordered_data_compaction());
+}
 } // namespace vectorized
 } // namespace doris
@@ -0,0 +1,209 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "olap/page_cache_snapshot.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#include "io/fs/file_writer.h"
+#include "io/fs/local_file_system.h"
+#include "olap/olap_common.h"
+#include "olap/page_cache.h"
+#include "olap/rowset/segment_v2/page_handle.h"
+#include "olap/rowset/segment_v2/page_io.h"
+#include "util/block_compression.h"
+
+namespace doris {
+
+static const std::string kTestDir = "./ut_dir/page_cache_snapshot_test";
+
+class PageCacheSnapshotTest : public testing::Test {
+public:
+    void SetUp() override {
+        auto st = io::global_local_filesystem()->delete_directory(kTestDir);
+        ASSERT_TRUE(st.ok()) << st;
+        st = io::global_local_filesystem()->create_directory(kTestDir);
+        ASSERT_TRUE(st.ok()) << st;
+    }
+
+    void TearDown() override {
+        EXPECT_TRUE(io::global_local_filesystem()->delete_directory(kTestDir).ok());
+    }
+};
+
+static PageCacheSnapshotEntry make_entry(const std::string& fname, int64_t offset) {
+    PageCacheSnapshotEntry entry;
+    entry.fname = fname;
+    entry.fsize = 4096;
+    entry.offset = offset;
+    entry.size = 128;
+    entry.type = segment_v2::INDEX_PAGE;
+    entry.compression = segment_v2::LZ4F;
+    entry.field_type = static_cast<int32_t>(FieldType::OLAP_FIELD_TYPE_INT);
+    entry.encoding = segment_v2::BIT_SHUFFLE;
+    entry.pre_decode = false;
+    entry.in_memory = true;
+    return entry;
+}
+
+TEST_F(PageCacheSnapshotTest, save_and_load) {
+    std::string path = kTestDir + "/page_cache.snapshot";
+    std::vector<PageCacheSnapshotEntry> entries;
+    ASSERT_TRUE(PageCacheSnapshot::load(path, &entries).is<ErrorCode::NOT_FOUND>());
+
+    for (int i = 0; i < 100; ++i) {
+        entries.push_back(make_entry("/path/to/segment_" + std::to_string(i), i * 1000));
+    }
+    ASSERT_TRUE(PageCacheSnapshot::save(path, entries).ok());
+
+    std::vector<PageCacheSnapshotEntry> loaded;
+    auto st = PageCacheSnapshot::load(path, &loaded);
+    ASSERT_TRUE(st.ok()) << st;
+    ASSERT_EQ(entries.size(), loaded.size());
+    for (size_t i = 0; i < entries.size(); ++i) {
+        EXPECT_EQ(entries[i].fname, loaded[i].fname);
+        EXPECT_EQ(entries[i].fsize, loaded[i].fsize);
+        EXPECT_EQ(entries[i].offset, loaded[i].offset);
+        EXPECT_EQ(entries[i].size, loaded[i].size);
+        EXPECT_EQ(entries[i].type, loaded[i].type);
+        EXPECT_EQ(entries[i].compression, loaded[i].compression);
+        EXPECT_EQ(entries[i].field_type, loaded[i].field_type);
+        EXPECT_EQ(entries[i].encoding, loaded[i].encoding);
+        EXPECT_EQ(entries[i].pre_decode, loaded[i].pre_decode);
+        EXPECT_EQ(entries[i].in_memory, loaded[i].in_memory);
+    }
+
+    // a broken snapshot is rejected by checksum
+    io::FileWriterPtr writer;
+    ASSERT_TRUE(io::global_local_filesystem()->create_file(path, &writer).ok());
+    std::string buf = "DPCS broken snapshot";
+    ASSERT_TRUE(writer->append(Slice(buf)).ok());
+    ASSERT_TRUE(writer->close().ok());
+    ASSERT_TRUE(PageCacheSnapshot::load(path, &loaded).is<ErrorCode::CORRUPTION>());
+}
+
+TEST_F(PageCacheSnapshotTest, collect) {
+    StoragePageCache cache(16 * 2048 * 1024, 10, 0, 16);
+    BlockCompressionCodec* codec = nullptr;
+    ASSERT_TRUE(get_block_compression_codec(segment_v2::ZSTD, &codec).ok());
+    {
+        PageCacheHandle handle;
+        auto* page = new DataPage(1024, true, segment_v2::DATA_PAGE);
+        page->set_read_source({100, codec, nullptr, true});
+        cache.insert(StoragePageCache::CacheKey("data", 4096, 10), page, &handle,
+                     segment_v2::DATA_PAGE);
+    }
+    {
+        PageCacheHandle handle;
+        auto* page = new DataPage(1024, true, segment_v2::INDEX_PAGE);
+        page->set_read_source({200, nullptr, nullptr, false});
+        cache.insert(StoragePageCache::CacheKey("index", 8192, 20), page, &handle,
+                     segment_v2::INDEX_PAGE, true);
+    }
+    {
+        // a page which can not be read again is skipped
+        PageCacheHandle handle;
+        auto* page = new DataPage(1024, true, segment_v2::DATA_PAGE);
+        cache.insert(StoragePageCache::CacheKey("unknown", 4096, 30), page, &handle,
+                     segment_v2::DATA_PAGE);
+    }
+
+    std::vector<PageCacheSnapshotEntry> entries;
+    PageCacheSnapshot::collect(&cache, 100, &entries);
+    ASSERT_EQ(2, entries.size());
+    EXPECT_EQ("index", entries[0].fname);
+    EXPECT_EQ(8192, entries[0].fsize);
+    EXPECT_EQ(20, entries[0].offset);
+    EXPECT_EQ(200, entries[0].size);
+    EXPECT_EQ(segment_v2::INDEX_PAGE, entries[0].type);
+    EXPECT_EQ(segment_v2::NO_COMPRESSION, entries[0].compression);
+    EXPECT_FALSE(entries[0].pre_decode);
+    EXPECT_TRUE(entries[0].in_memory);
+
+    EXPECT_EQ("data", entries[1].fname);
+    EXPECT_EQ(10, entries[1].offset);
+    EXPECT_EQ(100, entries[1].size);
+    EXPECT_EQ(segment_v2::DATA_PAGE, entries[1].type);
+    EXPECT_EQ(segment_v2::ZSTD, entries[1].compression);
+    EXPECT_FALSE(entries[1].in_memory);
+}
+
+TEST_F(PageCacheSnapshotTest, warm_up_page) {
+    std::string path = std::filesystem::absolute(kTestDir + "/segment.dat").string();
+    BlockCompressionCodec* codec = nullptr;
+    ASSERT_TRUE(get_block_compression_codec(segment_v2::LZ4F, &codec).ok());
+
+    std::string body(64 * 1024, 'a');
+    segment_v2::PageFooterPB footer;
+    footer.set_type(segment_v2::DATA_PAGE);
+    footer.set_uncompressed_size(static_cast<uint32_t>(body.size()));
+    footer.mutable_data_page_footer()->set_num_values(1);
+    segment_v2::PagePointer pp;
+    {
+        io::FileWriterPtr writer;
+        ASSERT_TRUE(io::global_local_filesystem()->create_file(path, &writer).ok());
+        auto st = segment_v2::PageIO::compress_and_write_page(codec, 0.1, writer.get(),
+                                                              {Slice(body)}, footer, &pp);
+        ASSERT_TRUE(st.ok()) << st;
+        ASSERT_TRUE(writer->close().ok());
+    }
+    int64_t file_size = 0;
+    ASSERT_TRUE(io::global_local_filesystem()->file_size(path, &file_size).ok());
+
+    PageCacheSnapshotEntry entry;
+    entry.fname = path;
+    entry.fsize = file_size;
+    entry.offset = static_cast<int64_t>(pp.offset);
+    entry.size = pp.size;
+    entry.type = segment_v2::DATA_PAGE;
+    entry.compression = segment_v2::LZ4F;
+
+    auto* cache = StoragePageCache::instance();
+    StoragePageCache::CacheKey key(path, file_size, entry.offset);
+    {
+        PageCacheHandle handle;
+        ASSERT_FALSE(cache->lookup(key, &handle, segment_v2::DATA_PAGE));
+    }
+    auto st = PageCacheSnapshot::warm_up_page(entry);
+    ASSERT_TRUE(st.ok()) << st;
+    {
+        PageCacheHandle handle;
+        ASSERT_TRUE(cache->lookup(key, &handle, segment_v2::DATA_PAGE));
+        ASSERT_EQ(0, memcmp(handle.data().data, body.data(), body.size()));
+    }
+
+    // the page is collected with how it is read
+    std::vector<PageCacheSnapshotEntry> entries;
+    PageCacheSnapshot::collect(cache, 1 << 20, &entries);
+    auto it = std::find_if(entries.begin(), entries.end(),
+                           [&](const auto& e) { return e.fname == path; });
+    ASSERT_NE(it, entries.end());
+    EXPECT_EQ(entry.offset, it->offset);
+    EXPECT_EQ(entry.size, it->size);
+    EXPECT_EQ(segment_v2::LZ4F, it->compression);
+
+    // a changed file is skipped
+    entry.fsize = file_size + 1;
+    ASSERT_TRUE(PageCacheSnapshot::warm_up_page(entry).is<ErrorCode::NOT_FOUND>());
+}
+
+} // namespace doris
@@ -20,6 +20,10 @@
 #include <gtest/gtest-message.h>
 #include <gtest/gtest-test-part.h>
 
+#include <atomic>
+#include <thread>
+#include <vector>
+
 #include "gtest/gtest_pred_impl.h"
 
 namespace doris {
@@ -286,4 +290,45 @@ TEST_F(StoragePageCacheTest, mixed_pages) {
     }
 }
 
+TEST_F(StoragePageCacheTest, coalesce_page_loading) {
+    StoragePageCache cache(kNumShards * 2048, 0, 0, kNumShards);
+    StoragePageCache::CacheKey key("abc", 0, 0);
+    segment_v2::PageTypePB page_type = segment_v2::DATA_PAGE;
+
+    EXPECT_TRUE(cache.start_loading(key));
+    // other keys are not blocked by the ongoing load
+    StoragePageCache::CacheKey other_key("abc", 0, 1);
+    EXPECT_TRUE(cache.start_loading(other_key));
+    cache.finish_loading(other_key);
+
+    std::atomic<int> num_loaders = 0;
+    std::atomic<int> num_hits = 0;
+    std::vector<std::thread> waiters;
+    for (int i = 0; i < 4; ++i) {
+        waiters.emplace_back([&]() {
+            if (cache.start_loading(key)) {
+                num_loaders++;
+                cache.finish_loading(key);
+                return;
+            }
+            PageCacheHandle handle;
+            if (cache.lookup(key, &handle, page_type)) {
+                num_hits++;
+            }
+        });
+    }
+    {
+        PageCacheHandle handle;
+        cache.insert(key, new DataPage(1024, true, page_type), &handle, page_type, false);
+    }
+    cache.finish_loading(key);
+    for (auto& waiter : waiters) {
+        waiter.join();
+    }
+    // a waiter only loads the page itself if it started after the first load finished
+    EXPECT_EQ(4, num_loaders + num_hits);
+    EXPECT_TRUE(cache.start_loading(key));
+    cache.finish_loading(key);
+}
+
 } // namespace doris
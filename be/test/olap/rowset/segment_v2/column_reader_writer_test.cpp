@@ -15,9 +15,11 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <bvar/bvar.h>
 #include <gtest/gtest.h>
 
 #include <iostream>
+#include <random>
 
 #include "io/fs/file_system.h"
 #include "io/fs/file_writer.h"
@@ -43,6 +45,8 @@ using std::string;
 namespace doris {
 namespace segment_v2 {
 
+extern bvar::Adder<int64_t> g_column_writer_compress_skipped_pages;
+
 static const std::string TEST_DIR = "./ut_dir/column_reader_writer_test";
 
 class ColumnReaderWriterTest : public testing::Test {
@@ -659,6 +663,23 @@ TEST_F(ColumnReaderWriterTest, test_nullable) {
     delete[] double_vals;
 }
 
+TEST_F(ColumnReaderWriterTest, test_skip_incompressible_pages) {
+    // 64 pages of random values which do not compress, followed by 64 pages of zeros which do.
+    const int num_rows = 128 * 8 * 1024;
+    std::vector<int64_t> vals(num_rows, 0);
+    std::mt19937_64 rng(42);
+    for (int i = 0; i < num_rows / 2; ++i) {
+        vals[i] = static_cast<int64_t>(rng());
+    }
+    std::vector<uint8_t> is_null(BitmapSize(num_rows), 0);
+
+    auto skipped_before = g_column_writer_compress_skipped_pages.get_value();
+    test_nullable_data<FieldType::OLAP_FIELD_TYPE_BIGINT, BIT_SHUFFLE>(
+            reinterpret_cast<uint8_t*>(vals.data()), is_null.data(), num_rows,
+            "skip_incompressible_bigint_bs");
+    EXPECT_GT(g_column_writer_compress_skipped_pages.get_value(), skipped_before);
+}
+
 TEST_F(ColumnReaderWriterTest, test_types) {
     size_t num_uint8_rows = LOOP_LESS_OR_MORE(1024, 1024 * 1024);
     uint8_t* is_null = new uint8_t[num_uint8_rows];
@@ -816,5 +837,75 @@ TEST_F(ColumnReaderWriterTest, test_mixed_empty_arrays) {
             collection_values.get(), array_is_null.get(), num_array, "test_mixed_empty_arrays");
 }
 
+TEST_F(ColumnReaderWriterTest, test_may_contain_in_range) {
+    const int num_rows = 4000;
+    std::vector<std::string> values(num_rows, "v.common_path");
+    for (int i = 3000; i < 3010; ++i) {
+        values[i] = "v.rare";
+    }
+    std::vector<Slice> slices(values.begin(), values.end());
+
+    ColumnMetaPB meta;
+    std::string fname = TEST_DIR + "/test_may_contain_in_range";
+    auto fs = io::global_local_filesystem();
+    {
+        io::FileWriterPtr file_writer;
+        ASSERT_TRUE(fs->create_file(fname, &file_writer).ok());
+        ColumnWriterOptions writer_opts;
+        writer_opts.meta = &meta;
+        writer_opts.meta->set_column_id(0);
+        writer_opts.meta->set_unique_id(0);
+        writer_opts.meta->set_type(FieldType::OLAP_FIELD_TYPE_VARCHAR);
+        writer_opts.meta->set_length(10);
+        writer_opts.meta->set_encoding(PLAIN_ENCODING);
+        writer_opts.meta->set_compression(segment_v2::CompressionTypePB::LZ4F);
+        writer_opts.meta->set_is_nullable(false);
+        writer_opts.data_page_size = 4096;
+        writer_opts.need_bloom_filter = true;
+
+        TabletColumn column = create_varchar_key(1);
+        std::unique_ptr<ColumnWriter> writer;
+        ASSERT_TRUE(ColumnWriter::create(writer_opts, &column, file_writer.get(), &writer).ok());
+        ASSERT_TRUE(writer->init().ok());
+        for (int i = 0; i < num_rows; ++i) {
+            ASSERT_TRUE(writer->append(false, &slices[i]).ok());
+        }
+        ASSERT_TRUE(writer->finish().ok());
+        ASSERT_TRUE(writer->write_data().ok());
+        ASSERT_TRUE(writer->write_ordinal_index().ok());
+        ASSERT_TRUE(writer->write_bloom_filter_index().ok());
+        ASSERT_TRUE(file_writer->close().ok());
+    }
+
+    io::FileReaderSPtr file_reader;
+    ASSERT_EQ(fs->open_file(fname, &file_reader), Status::OK());
+    ColumnReaderOptions reader_opts;
+    std::unique_ptr<ColumnReader> reader;
+    ASSERT_TRUE(ColumnReader::create(reader_opts, meta, num_rows, file_reader, &reader).ok());
+    ASSERT_TRUE(reader->has_bloom_filter_index(false));
+
+    ColumnIteratorOptions iter_opts;
+    OlapReaderStatistics stats;
+    iter_opts.stats = &stats;
+    iter_opts.file_reader = file_reader.get();
+    std::map<uint32_t, bool> page_results;
+    bool may_contain = false;
+    ASSERT_TRUE(reader->may_contain_in_range(0, 2000, Slice("v.rare"), iter_opts, &page_results,
+                                             &may_contain)
+                        .ok());
+    EXPECT_FALSE(may_contain);
+    EXPECT_GT(page_results.size(), 1);
+    ASSERT_TRUE(reader->may_contain_in_range(2500, 3005, Slice("v.rare"), iter_opts,
+                                             &page_results, &may_contain)
+                        .ok());
+    EXPECT_TRUE(may_contain);
+
+    page_results.clear();
+    ASSERT_TRUE(reader->may_contain_in_range(0, 2000, Slice("v.common_path"), iter_opts,
+                                             &page_results, &may_contain)
+                        .ok());
+    EXPECT_TRUE(may_contain);
+}
+
 } // namespace segment_v2
 } // namespace doris
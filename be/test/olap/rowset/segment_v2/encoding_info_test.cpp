@@ -21,9 +21,19 @@
 #include <gtest/gtest-message.h>
 #include <gtest/gtest-test-part.h>
 
+#include <memory>
+#include <vector>
+
+#include "common/config.h"
 #include "gtest/gtest_pred_impl.h"
 #include "olap/olap_common.h"
+#include "olap/rowset/segment_v2/options.h"
+#include "olap/rowset/segment_v2/page_builder.h"
+#include "olap/rowset/segment_v2/page_decoder.h"
 #include "olap/types.h"
+#include "util/defer_op.h"
+#include "vec/columns/column_vector.h"
+#include "vec/common/assert_cast.h"
 
 namespace doris {
 namespace segment_v2 {
@@ -49,5 +59,68 @@ TEST_F(EncodingInfoTest, no_encoding) {
     EXPECT_FALSE(status.ok());
 }
 
+TEST_F(EncodingInfoTest, sorted_column_encoding) {
+    config::enable_segment_for_encoding_on_sort_key = false;
+    EXPECT_EQ(DEFAULT_ENCODING,
+              EncodingInfo::get_sorted_column_encoding(FieldType::OLAP_FIELD_TYPE_DATETIMEV2));
+
+    config::enable_segment_for_encoding_on_sort_key = true;
+    Defer defer([]() { config::enable_segment_for_encoding_on_sort_key = false; });
+    EXPECT_EQ(DEFAULT_ENCODING,
+              EncodingInfo::get_sorted_column_encoding(FieldType::OLAP_FIELD_TYPE_VARCHAR));
+    EXPECT_EQ(FOR_ENCODING,
+              EncodingInfo::get_sorted_column_encoding(FieldType::OLAP_FIELD_TYPE_DATETIMEV2));
+
+    const auto* type_info = get_scalar_type_info<FieldType::OLAP_FIELD_TYPE_DATETIMEV2>();
+    const EncodingInfo* encoding_info = nullptr;
+    ASSERT_TRUE(EncodingInfo::get(type_info, FOR_ENCODING, &encoding_info).ok());
+
+    const size_t num_values = 1000;
+    std::vector<uint64_t> values(num_values);
+    for (size_t i = 0; i < num_values; ++i) {
+        values[i] = 0x19000000000000ULL + i * 37;
+    }
+    PageBuilderOptions builder_options;
+    builder_options.data_page_size = 256 * 1024;
+    PageBuilder* builder_ptr = nullptr;
+    ASSERT_TRUE(encoding_info->create_page_builder(builder_options, &builder_ptr).ok());
+    std::unique_ptr<PageBuilder> builder(builder_ptr);
+    size_t count = num_values;
+    ASSERT_TRUE(builder->add(reinterpret_cast<const uint8_t*>(values.data()), &count).ok());
+    OwnedSlice page;
+    ASSERT_TRUE(builder->finish(&page).ok());
+
+    PageDecoder* decoder_ptr = nullptr;
+    ASSERT_TRUE(encoding_info->create_page_decoder(page.slice(), {}, &decoder_ptr).ok());
+    std::unique_ptr<PageDecoder> decoder(decoder_ptr);
+    ASSERT_TRUE(decoder->init().ok());
+
+    vectorized::MutableColumnPtr column = vectorized::ColumnDateTimeV2::create();
+    size_t n = 10;
+    ASSERT_TRUE(decoder->peek_next_batch(&n, column).ok());
+    EXPECT_EQ(10, n);
+    EXPECT_EQ(0, decoder->current_index());
+    n = num_values;
+    ASSERT_TRUE(decoder->next_batch(&n, column).ok());
+    EXPECT_EQ(num_values, n);
+    EXPECT_EQ(num_values, decoder->current_index());
+
+    const auto& data = assert_cast<const vectorized::ColumnDateTimeV2&>(*column).get_data();
+    ASSERT_EQ(num_values + 10, data.size());
+    for (size_t i = 0; i < num_values; ++i) {
+        EXPECT_EQ(values[i], data[i + 10]);
+    }
+
+    ASSERT_TRUE(decoder->seek_to_position_in_page(0).ok());
+    column->clear();
+    std::vector<rowid_t> rowids = {3, 4, 100, 513, 999};
+    n = rowids.size();
+    ASSERT_TRUE(decoder->read_by_rowids(rowids.data(), 0, &n, column).ok());
+    EXPECT_EQ(rowids.size(), n);
+    for (size_t i = 0; i < rowids.size(); ++i) {
+        EXPECT_EQ(values[rowids[i]], data[i]);
+    }
+}
+
 } // namespace segment_v2
 } // namespace doris
@@ -25,6 +25,7 @@
 #include "CLucene/store/Directory.h"
 #include "CLucene/store/FSDirectory.h"
 #include "olap/rowset/segment_v2/inverted_index/analysis_factory_mgr.h"
+#include "olap/rowset/segment_v2/inverted_index/analyzer/analyzer.h"
 #include "olap/rowset/segment_v2/inverted_index/query/phrase_prefix_query.h"
 #include "olap/rowset/segment_v2/inverted_index/query/phrase_query.h"
 #include "olap/rowset/segment_v2/inverted_index/setting.h"
@@ -196,6 +197,24 @@ TEST_F(CustomAnalyzerTest, CustomNgramAnalyzer) {
     }
 }
 
+TEST_F(CustomAnalyzerTest, NgramParserAnalyzer) {
+    std::map<std::string, std::string> properties {{INVERTED_INDEX_PARSER_KEY, "ngram"}};
+    auto terms = [&](const std::string& text) {
+        std::vector<std::string> results;
+        for (const auto& term_info :
+             InvertedIndexAnalyzer::get_analyse_result(text, properties)) {
+            results.emplace_back(term_info.get_single_term());
+        }
+        return results;
+    };
+
+    EXPECT_EQ(terms("Hello w"), (std::vector<std::string> {"hel", "ell", "llo", "lo ", "o w"}));
+    EXPECT_TRUE(terms("ab").empty());
+
+    properties[INVERTED_INDEX_PARSER_LOWERCASE_KEY] = INVERTED_INDEX_PARSER_FALSE;
+    EXPECT_EQ(terms("ABCD"), (std::vector<std::string> {"ABC", "BCD"}));
+}
+
 // TEST_F(CustomAnalyzerTest, test) {
 //     std::string name = "name";
 //     std::string path = "/mnt/disk2/yangsiyu/clucene/index";
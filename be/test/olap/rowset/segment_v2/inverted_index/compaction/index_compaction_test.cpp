@@ -18,6 +18,9 @@
 #include <gmock/gmock.h>
 
 #include "olap/utils.h"
+#include "runtime/exec_env.h"
+#include "util/defer_op.h"
+#include "util/threadpool.h"
 #include "util/index_compaction_utils.cpp"
 
 namespace doris {
@@ -826,6 +829,61 @@ TEST_F(IndexCompactionTest, tes_write_index_normally) {
     IndexCompactionUtils::check_meta_and_file(output_rowset_normal, _tablet_schema, query_map);
 }
 
+TEST_F(IndexCompactionTest, test_write_index_on_column_writer_pool) {
+    _build_tablet();
+    std::vector<std::string> data_files = {
+            _current_dir + "/be/test/olap/rowset/segment_v2/inverted_index/data/data1.csv"};
+    auto custom_check_build_rowsets = [](const int32_t& size) { EXPECT_EQ(size, 4); };
+
+    std::vector<RowsetSharedPtr> serial_rowsets(data_files.size());
+    IndexCompactionUtils::build_rowsets<IndexCompactionUtils::DataRow>(
+            _data_dir, _tablet_schema, _tablet, _engine_ref, serial_rowsets, data_files, _inc_id,
+            custom_check_build_rowsets);
+
+    // the value columns are encoded and indexed on the column writer pool
+    auto origin_parallelism = config::vertical_segment_writer_column_parallelism;
+    auto origin_vertical_writer = config::enable_vertical_segment_writer;
+    config::vertical_segment_writer_column_parallelism = 4;
+    config::enable_vertical_segment_writer = true;
+    auto* exec_env = ExecEnv::GetInstance();
+    EXPECT_TRUE(ThreadPoolBuilder("SegmentColumnWriterThreadPool")
+                        .set_min_threads(4)
+                        .set_max_threads(4)
+                        .build(&exec_env->_segment_column_writer_thread_pool)
+                        .ok());
+    Defer defer {[&]() {
+        exec_env->_segment_column_writer_thread_pool.reset();
+        config::vertical_segment_writer_column_parallelism = origin_parallelism;
+        config::enable_vertical_segment_writer = origin_vertical_writer;
+    }};
+    std::vector<RowsetSharedPtr> parallel_rowsets(data_files.size());
+    IndexCompactionUtils::build_rowsets<IndexCompactionUtils::DataRow>(
+            _data_dir, _tablet_schema, _tablet, _engine_ref, parallel_rowsets, data_files, _inc_id,
+            custom_check_build_rowsets);
+
+    // every segment gets the same string and fulltext indexes as when built serially
+    ASSERT_EQ(serial_rowsets[0]->num_segments(), parallel_rowsets[0]->num_segments());
+    for (int seg_id = 0; seg_id < serial_rowsets[0]->num_segments(); ++seg_id) {
+        auto open_reader = [&](const RowsetSharedPtr& rowset) {
+            const auto& seg_path = rowset->segment_path(seg_id);
+            EXPECT_TRUE(seg_path.has_value()) << seg_path.error();
+            return IndexCompactionUtils::init_index_file_reader(
+                    rowset, seg_path.value(), _tablet_schema->get_inverted_index_storage_format());
+        };
+        auto serial_reader = open_reader(serial_rowsets[0]);
+        auto parallel_reader = open_reader(parallel_rowsets[0]);
+        for (int64_t index_id : {10001, 10002}) {
+            auto serial_dir = serial_reader->_open(index_id, "");
+            ASSERT_TRUE(serial_dir.has_value()) << serial_dir.error();
+            auto parallel_dir = parallel_reader->_open(index_id, "");
+            ASSERT_TRUE(parallel_dir.has_value()) << parallel_dir.error();
+            auto st = IndexCompactionUtils::check_idx_file_correctness(parallel_dir->get(),
+                                                                       serial_dir->get());
+            EXPECT_TRUE(st.ok()) << st.to_string();
+        }
+    }
+}
+
 TEST_F(IndexCompactionTest, test_col_unique_ids_empty) {
     _build_tablet();
     // clear column unique id in tablet index 10001 and rebuild tablet_schema
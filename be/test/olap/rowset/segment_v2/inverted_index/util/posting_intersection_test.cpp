@@ -0,0 +1,86 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "olap/rowset/segment_v2/inverted_index/util/posting_intersection.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <iterator>
+#include <random>
+#include <set>
+#include <vector>
+
+namespace doris::segment_v2::inverted_index {
+
+static std::vector<uint32_t> random_docs(std::mt19937& rng, size_t n, uint32_t max_doc) {
+    std::set<uint32_t> docs;
+    std::uniform_int_distribution<uint32_t> dist(0, max_doc);
+    while (docs.size() < n) {
+        docs.insert(dist(rng));
+    }
+    return {docs.begin(), docs.end()};
+}
+
+static std::vector<uint32_t> expected_intersection(const std::vector<uint32_t>& a,
+                                                   const std::vector<uint32_t>& b) {
+    std::vector<uint32_t> res;
+    std::set_intersection(a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(res));
+    return res;
+}
+
+TEST(PostingIntersectionTest, Empty) {
+    std::vector<uint32_t> a = {1, 2, 3};
+    std::vector<uint32_t> out;
+    intersect_sorted_docs(a.data(), a.size(), nullptr, 0, out);
+    intersect_sorted_docs(nullptr, 0, a.data(), a.size(), out);
+    EXPECT_TRUE(out.empty());
+}
+
+TEST(PostingIntersectionTest, AppendsToOutput) {
+    std::vector<uint32_t> a = {1, 4, 7, 9};
+    std::vector<uint32_t> b = {0, 4, 5, 9, 10};
+    std::vector<uint32_t> out = {100};
+    intersect_sorted_docs(a.data(), a.size(), b.data(), b.size(), out);
+    EXPECT_EQ(out, (std::vector<uint32_t> {100, 4, 9}));
+}
+
+TEST(PostingIntersectionTest, MergeAndGallopMatchStd) {
+    std::mt19937 rng(7);
+    // similar sizes use the merge, skewed sizes gallop
+    for (auto [na, nb] : std::vector<std::pair<size_t, size_t>> {
+                 {1000, 1200}, {10, 5000}, {5000, 10}, {1, 100000}, {300, 300}}) {
+        auto a = random_docs(rng, na, 200000);
+        auto b = random_docs(rng, nb, 200000);
+        std::vector<uint32_t> out;
+        intersect_sorted_docs(a.data(), a.size(), b.data(), b.size(), out);
+        EXPECT_EQ(out, expected_intersection(a, b)) << na << " x " << nb;
+    }
+}
+
+TEST(PostingIntersectionTest, GallopFindsBoundaries) {
+    std::vector<uint32_t> big(10000);
+    for (uint32_t i = 0; i < big.size(); ++i) {
+        big[i] = i * 2;
+    }
+    std::vector<uint32_t> small = {0, 1, 4095 * 2, 9999 * 2, 9999 * 2 + 1};
+    std::vector<uint32_t> out;
+    intersect_sorted_docs(small.data(), small.size(), big.data(), big.size(), out);
+    EXPECT_EQ(out, (std::vector<uint32_t> {0, 4095 * 2, 9999 * 2}));
+}
+
+} // namespace doris::segment_v2::inverted_index
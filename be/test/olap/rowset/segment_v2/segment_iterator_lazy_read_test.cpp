@@ -0,0 +1,248 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "common/config.h"
+#include "io/fs/file_writer.h"
+#include "io/fs/local_file_system.h"
+#include "olap/comparison_predicate.h"
+#include "olap/iterators.h"
+#include "olap/olap_common.h"
+#include "olap/row_cursor.h"
+#include "olap/rowset/segment_v2/segment.h"
+#include "olap/rowset/segment_v2/segment_writer.h"
+#include "olap/schema.h"
+#include "olap/storage_engine.h"
+#include "olap/tablet_schema.h"
+#include "olap/tablet_schema_helper.h"
+#include "runtime/descriptor_helper.h"
+#include "runtime/descriptors.h"
+#include "runtime/exec_env.h"
+#include "vec/columns/column_nullable.h"
+#include "vec/columns/column_vector.h"
+#include "vec/core/block.h"
+
+namespace doris {
+using namespace segment_v2;
+
+static const std::string kSegmentDir = "./ut_dir/segment_iterator_lazy_read_test";
+static constexpr int kNumRows = 4000;
+
+// Reads the non-predicate column of the rows left by the predicates either by rowids or, when
+// the rows cover enough of their range, as a range filtered afterwards.
+class SegmentIteratorLazyReadTest : public testing::Test {
+public:
+    void SetUp() override {
+        _saved_min_selectivity = config::lazy_read_range_min_selectivity;
+        auto st = io::global_local_filesystem()->delete_directory(kSegmentDir);
+        ASSERT_TRUE(st.ok()) << st;
+        st = io::global_local_filesystem()->create_directory(kSegmentDir);
+        ASSERT_TRUE(st.ok()) << st;
+        ExecEnv::GetInstance()->set_storage_engine(
+                std::make_unique<StorageEngine>(EngineOptions {}));
+
+        // k = rowid, v = rowid % 10
+        _tablet_schema = std::make_shared<TabletSchema>();
+        _tablet_schema->append_column(*create_int_key(0));
+        _tablet_schema->append_column(*create_int_value(1));
+        _tablet_schema->_keys_type = DUP_KEYS;
+        build_segment();
+    }
+
+    void TearDown() override {
+        config::lazy_read_range_min_selectivity = _saved_min_selectivity;
+        _segment.reset();
+        EXPECT_TRUE(io::global_local_filesystem()->delete_directory(kSegmentDir).ok());
+    }
+
+protected:
+    void build_segment() {
+        std::string path = kSegmentDir + "/0.dat";
+        auto fs = io::global_local_filesystem();
+        io::FileWriterPtr file_writer;
+        ASSERT_TRUE(fs->create_file(path, &file_writer).ok());
+        SegmentWriter writer(file_writer.get(), 0, _tablet_schema, nullptr, nullptr,
+                             SegmentWriterOptions {}, nullptr);
+        ASSERT_TRUE(writer.init().ok());
+
+        RowCursor row;
+        ASSERT_TRUE(row.init(_tablet_schema).ok());
+        for (int rid = 0; rid < kNumRows; ++rid) {
+            RowCursorCell k = row.cell(0);
+            k.set_not_null();
+            *(int*)k.mutable_cell_ptr() = rid;
+            RowCursorCell v = row.cell(1);
+            v.set_not_null();
+            *(int*)v.mutable_cell_ptr() = rid % 10;
+            ASSERT_TRUE(writer.append_row(row).ok());
+        }
+        uint64_t file_size = 0;
+        uint64_t index_size = 0;
+        ASSERT_TRUE(writer.finalize(&file_size, &index_size).ok());
+        ASSERT_TRUE(file_writer->close().ok());
+        ASSERT_TRUE(Segment::open(fs, path, 100, 0, RowsetId {}, _tablet_schema,
+                                  io::FileReaderOptions {}, &_segment)
+                            .ok());
+    }
+
+    // Reads the segment with `predicate`, checks that every row returned has v == k % 10 and
+    // returns the rows.
+    std::vector<int> read(ColumnPredicate* predicate, OlapReaderStatistics* stats) {
+        StorageReadOptions read_opts;
+        read_opts.stats = stats;
+        read_opts.tablet_schema = _tablet_schema;
+        read_opts.column_predicates.push_back(predicate);
+        std::unique_ptr<RowwiseIterator> iter;
+        auto schema = std::make_shared<Schema>(_tablet_schema);
+        auto st = _segment->new_iterator(schema, read_opts, &iter);
+        EXPECT_TRUE(st.ok()) << st;
+        if (!st.ok()) {
+            return {};
+        }
+
+        std::vector<int> keys;
+        auto block = _tablet_schema->create_block();
+        while (true) {
+            block.clear_column_data();
+            st = iter->next_batch(&block);
+            if (st.is<ErrorCode::END_OF_FILE>()) {
+                break;
+            }
+            EXPECT_TRUE(st.ok()) << st;
+            if (!st.ok()) {
+                break;
+            }
+            const auto& k = get_data(block, 0);
+            const auto& v = get_data(block, 1);
+            EXPECT_EQ(k.size(), v.size());
+            for (size_t i = 0; i < k.size(); ++i) {
+                EXPECT_EQ(v[i], k[i] % 10) << "k=" << k[i];
+                keys.push_back(k[i]);
+            }
+        }
+        return keys;
+    }
+
+    static const vectorized::ColumnInt32::Container& get_data(const vectorized::Block& block,
+                                                               size_t position) {
+        const auto& nullable = assert_cast<const vectorized::ColumnNullable&>(
+                *block.get_by_position(position).column);
+        return assert_cast<const vectorized::ColumnInt32&>(nullable.get_nested_column())
+                .get_data();
+    }
+
+    double _saved_min_selectivity;
+    TabletSchemaSPtr _tablet_schema;
+    std::shared_ptr<Segment> _segment;
+};
+
+TEST_F(SegmentIteratorLazyReadTest, ContiguousRowsReadAsRange) {
+    config::lazy_read_range_min_selectivity = 0.8;
+    // k >= 100 keeps a contiguous range of rows, v is read lazily
+    ComparisonPredicateBase<TYPE_INT, PredicateType::GE> predicate(0, 100);
+    OlapReaderStatistics stats;
+    auto keys = read(&predicate, &stats);
+    ASSERT_EQ(keys.size(), kNumRows - 100);
+    EXPECT_EQ(keys.front(), 100);
+    EXPECT_EQ(keys.back(), kNumRows - 1);
+    EXPECT_GT(stats.block_lazy_read_range_num, 0);
+}
+
+TEST_F(SegmentIteratorLazyReadTest, DenseRowsReadAsFilteredRange) {
+    config::lazy_read_range_min_selectivity = 0.8;
+    // v != 0 keeps 9 rows out of 10, k is read lazily
+    ComparisonPredicateBase<TYPE_INT, PredicateType::NE> predicate(1, 0);
+    OlapReaderStatistics stats;
+    auto keys = read(&predicate, &stats);
+    ASSERT_EQ(keys.size(), kNumRows / 10 * 9);
+    for (size_t i = 0; i < keys.size(); ++i) {
+        EXPECT_EQ(keys[i], i / 9 * 10 + i % 9 + 1);
+    }
+    EXPECT_GT(stats.block_lazy_read_range_num, 0);
+}
+
+TEST_F(SegmentIteratorLazyReadTest, SparseRowsReadByRowids) {
+    config::lazy_read_range_min_selectivity = 0.8;
+    // v == 0 keeps 1 row out of 10, below the threshold
+    ComparisonPredicateBase<TYPE_INT, PredicateType::EQ> predicate(1, 0);
+    OlapReaderStatistics stats;
+    auto keys = read(&predicate, &stats);
+    ASSERT_EQ(keys.size(), kNumRows / 10);
+    for (size_t i = 0; i < keys.size(); ++i) {
+        EXPECT_EQ(keys[i], i * 10);
+    }
+    EXPECT_EQ(stats.block_lazy_read_range_num, 0);
+}
+
+TEST_F(SegmentIteratorLazyReadTest, ThresholdAboveOneReadsByRowids) {
+    config::lazy_read_range_min_selectivity = 1.1;
+    ComparisonPredicateBase<TYPE_INT, PredicateType::GE> predicate(0, 100);
+    OlapReaderStatistics stats;
+    auto keys = read(&predicate, &stats);
+    ASSERT_EQ(keys.size(), kNumRows - 100);
+    EXPECT_EQ(stats.block_lazy_read_range_num, 0);
+}
+
+// The second phase of a TopN lazy materialization reads all rows of a segment in one call.
+TEST_F(SegmentIteratorLazyReadTest, SeekAndReadByRowids) {
+    auto tslot = TSlotDescriptorBuilder().type(TYPE_INT).nullable(true).column_name("1").build();
+    tslot.__set_col_unique_id(1);
+    SlotDescriptor slot(tslot);
+
+    std::vector<rowid_t> row_ids;
+    for (rowid_t rid = 0; rid < kNumRows; rid += 37) {
+        row_ids.push_back(rid);
+    }
+    OlapReaderStatistics batch_stats;
+    vectorized::MutableColumnPtr batch_column = vectorized::ColumnNullable::create(
+            vectorized::ColumnInt32::create(), vectorized::ColumnUInt8::create());
+    std::unique_ptr<ColumnIterator> iterator;
+    auto st = _segment->seek_and_read_by_rowids(*_tablet_schema, &slot, row_ids.data(),
+                                                row_ids.size(), batch_column, batch_stats,
+                                                iterator);
+    ASSERT_TRUE(st.ok()) << st;
+    ASSERT_EQ(batch_column->size(), row_ids.size());
+    const auto& nullable = assert_cast<const vectorized::ColumnNullable&>(*batch_column);
+    const auto& values =
+            assert_cast<const vectorized::ColumnInt32&>(nullable.get_nested_column()).get_data();
+    for (size_t i = 0; i < row_ids.size(); ++i) {
+        EXPECT_EQ(values[i], static_cast<int>(row_ids[i] % 10)) << "rowid=" << row_ids[i];
+    }
+
+    // reading the same rows one by one gives the same values, but reads a page for every row
+    OlapReaderStatistics single_stats;
+    vectorized::MutableColumnPtr single_column = vectorized::ColumnNullable::create(
+            vectorized::ColumnInt32::create(), vectorized::ColumnUInt8::create());
+    for (auto row_id : row_ids) {
+        std::unique_ptr<ColumnIterator> single_iterator;
+        st = _segment->seek_and_read_by_rowid(*_tablet_schema, &slot, row_id, single_column,
+                                              single_stats, single_iterator);
+        ASSERT_TRUE(st.ok()) << st;
+    }
+    ASSERT_EQ(single_column->size(), row_ids.size());
+    for (size_t i = 0; i < row_ids.size(); ++i) {
+        EXPECT_EQ(single_column->compare_at(i, i, *batch_column, -1), 0);
+    }
+    EXPECT_LT(batch_stats.total_pages_num, single_stats.total_pages_num);
+}
+
+} // namespace doris
@@ -0,0 +1,112 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "olap/schema_change.h"
+#include "util/threadpool.h"
+
+namespace doris {
+
+class SchemaChangeConvertTest : public testing::Test {
+public:
+    void SetUp() override {
+        ASSERT_TRUE(ThreadPoolBuilder("SchemaChangeConvertTest")
+                            .set_min_threads(1)
+                            .set_max_threads(2)
+                            .build(&_pool)
+                            .ok());
+    }
+
+    void TearDown() override { _pool->shutdown(); }
+
+protected:
+    // a conversion that tracks how many run at the same time
+    Status convert(size_t idx) {
+        auto running = ++_running;
+        int max_running = _max_running;
+        while (running > max_running && !_max_running.compare_exchange_weak(max_running, running)) {
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        ++_converted;
+        --_running;
+        return Status::OK();
+    }
+
+    std::unique_ptr<ThreadPool> _pool;
+    std::atomic<int> _running = 0;
+    std::atomic<int> _max_running = 0;
+    std::atomic<int> _converted = 0;
+};
+
+TEST_F(SchemaChangeConvertTest, ConvertAllRowsets) {
+    std::vector<Status> convert_status(6, Status::InternalError("not converted"));
+    SchemaChangeJob::_convert_rowsets_concurrently(
+            _pool.get(), 2, convert_status.size(), [this](size_t idx) { return convert(idx); },
+            &convert_status);
+    EXPECT_EQ(_converted, 6);
+    EXPECT_LE(_max_running, 2);
+    EXPECT_TRUE(std::all_of(convert_status.begin(), convert_status.end(),
+                            [](const Status& st) { return st.ok(); }));
+}
+
+TEST_F(SchemaChangeConvertTest, JobsShareThePool) {
+    // two jobs asking for 4 threads each still run on the 2 threads of the pool
+    std::vector<Status> status1(4);
+    std::vector<Status> status2(4);
+    std::thread job1([&] {
+        SchemaChangeJob::_convert_rowsets_concurrently(
+                _pool.get(), 4, status1.size(), [this](size_t idx) { return convert(idx); },
+                &status1);
+    });
+    std::thread job2([&] {
+        SchemaChangeJob::_convert_rowsets_concurrently(
+                _pool.get(), 4, status2.size(), [this](size_t idx) { return convert(idx); },
+                &status2);
+    });
+    job1.join();
+    job2.join();
+    EXPECT_EQ(_converted, 8);
+    EXPECT_LE(_max_running, 2);
+}
+
+TEST_F(SchemaChangeConvertTest, CancelAfterFailure) {
+    std::vector<Status> convert_status(4);
+    std::atomic<int> calls = 0;
+    // one at a time, so the rowsets after the failed one are not started
+    SchemaChangeJob::_convert_rowsets_concurrently(
+            _pool.get(), 1, convert_status.size(),
+            [&](size_t idx) {
+                ++calls;
+                return idx == 1 ? Status::InternalError("convert failed") : Status::OK();
+            },
+            &convert_status);
+    EXPECT_EQ(calls, 2);
+    EXPECT_TRUE(convert_status[0].ok());
+    EXPECT_TRUE(convert_status[1].is<ErrorCode::INTERNAL_ERROR>());
+    EXPECT_TRUE(convert_status[2].is<ErrorCode::CANCELLED>());
+    EXPECT_TRUE(convert_status[3].is<ErrorCode::CANCELLED>());
+}
+
+} // namespace doris
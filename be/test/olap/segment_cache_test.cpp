@@ -316,8 +316,15 @@ TEST_F(SegmentCacheTest, vec_sequence_col) {
         std::lock_guard<std::mutex> l(lock);
         // load segments first
         int64_t start_size = SegmentLoader::instance()->cache_mem_usage();
+        SegmentCache::CacheKey cache_key(rowset->rowset_id(), 0);
+        SegmentCacheHandle lookup_handle;
+        EXPECT_FALSE(SegmentLoader::instance()->lookup_segment(cache_key, &lookup_handle));
         res = SegmentLoader::instance()->load_segments(rowset_ptr, &handle, true, true);
         ASSERT_TRUE(res.ok());
+        // a loaded segment is found in the cache without loading it again
+        SegmentCacheHandle cached_handle;
+        ASSERT_TRUE(SegmentLoader::instance()->lookup_segment(cache_key, &cached_handle));
+        EXPECT_EQ(handle.get_segments()[0], cached_handle.get_segments()[0]);
         EXPECT_EQ(1, rowset->num_segments());
         EXPECT_EQ(1, handle.get_segments().size());
         EXPECT_TRUE(handle.is_inited());
@@ -311,6 +311,15 @@ TEST(TabletMetaTest, TestDeleteBitmap) {
         other.add({RowsetId {2, 0, 1, 1}, 1002, 1}, 1100);
         dbmp->merge(other);
         ASSERT_EQ(dbmp->delete_bitmap.size(), old_size + 2);
+        // existing keys are unioned
+        DeleteBitmap other2(10086);
+        other2.add({RowsetId {2, 0, 1, 1}, 1001, 1}, 1200);
+        dbmp->merge(other2);
+        ASSERT_EQ(dbmp->delete_bitmap.size(), old_size + 2);
+        auto bm = dbmp->get({RowsetId {2, 0, 1, 1}, 1001, 1});
+        ASSERT_EQ(bm->cardinality(), 2);
+        ASSERT_TRUE(bm->contains(1100));
+        ASSERT_TRUE(bm->contains(1200));
     }
 
     ////////////////////////////////////////////////////////////////////////////
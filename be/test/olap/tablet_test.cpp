@@ -430,4 +430,34 @@ TEST_F(TestTablet, get_local_versions) {
     ASSERT_EQ(local_versions.size(), 20);
 }
 
+
+TEST_F(TestTablet, rowsets_may_overlap) {
+    auto make_rowset = [&](std::vector<std::pair<std::string, std::string>> key_bounds,
+                           bool truncated = false) {
+        auto rs_meta = std::make_shared<RowsetMeta>();
+        init_rs_meta(rs_meta, 2, 2, convert_key_bounds(std::move(key_bounds)));
+        rs_meta->set_segments_key_bounds_truncated(truncated);
+        return std::static_pointer_cast<Rowset>(std::make_shared<BetaRowset>(nullptr, rs_meta, ""));
+    };
+    auto before = make_rowset({{"a", "c"}});
+    auto after = make_rowset({{"q", "t"}});
+    auto second_segment = make_rowset({{"a", "b"}, {"n", "o"}});
+    auto touching = make_rowset({{"p", "z"}});
+    // "m" may be the prefix of a max key such as "mz" that is not below the segment
+    auto truncated = make_rowset({{"a", "m"}}, true);
+    auto not_truncated = make_rowset({{"a", "m"}});
+    // without the bounds of every segment the rowset is always looked up
+    auto missing_bounds = make_rowset({{"a", "c"}});
+    missing_bounds->rowset_meta()->set_num_segments(2);
+
+    std::vector<RowsetSharedPtr> rowsets {before,    after,         second_segment, touching,
+                                          truncated, not_truncated, missing_bounds};
+    auto candidates = BaseTablet::_rowsets_may_overlap(rowsets, Slice("mb"), Slice("p"));
+    std::vector<RowsetSharedPtr> expected {second_segment, touching, truncated, missing_bounds};
+    EXPECT_EQ(candidates, expected);
+
+    // no rowset overlaps, the primary key index of the segment is not scanned at all
+    EXPECT_TRUE(BaseTablet::_rowsets_may_overlap({before, after}, Slice("d"), Slice("e")).empty());
+}
+
 } // namespace doris
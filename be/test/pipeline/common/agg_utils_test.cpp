@@ -112,6 +112,30 @@ TEST_F(AggregateDataContainerTest, SubContainerExpansion) {
     }
 }
 
+TEST_F(AggregateDataContainerTest, ClearReusesMemory) {
+    AggregateDataContainer container(sizeof(uint32_t), sizeof(double));
+
+    const uint32_t TEST_SIZE = 8192 * 3;
+    for (uint32_t i = 0; i < TEST_SIZE; ++i) {
+        container.append_data(i);
+    }
+    auto memory_usage = container.memory_usage();
+
+    container.clear();
+    EXPECT_EQ(0, container.total_count());
+    EXPECT_EQ(container.begin(), container.end());
+    EXPECT_GT(container.memory_usage(), 0);
+    EXPECT_LE(container.memory_usage(), memory_usage);
+
+    for (uint32_t i = 0; i < 100; ++i) {
+        container.append_data(i + 1000);
+    }
+    auto usage_after_reuse = container.memory_usage();
+    EXPECT_LE(usage_after_reuse, memory_usage);
+    EXPECT_EQ(100, container.total_count());
+    EXPECT_EQ(1000, container.begin().get_key<uint32_t>());
+}
+
 TEST_F(AggregateDataContainerTest, EstimateMemory) {
     AggregateDataContainer container(sizeof(uint32_t), sizeof(double));
 
@@ -228,14 +252,14 @@ TEST_F(AggregatedDataVariantsTest, TestNumericKeys) {
     // Test int8 key
     _variants->init(types, HashKeyType::int8_key);
     auto value = std::holds_alternative<
-            vectorized::MethodOneNumber<vectorized::UInt8, AggData<vectorized::UInt8>>>(
+            vectorized::MethodOneNumber<vectorized::UInt8, AggregatedDataWithUInt8Key>>(
             _variants->method_variant);
     ASSERT_TRUE(value);
 
     // Test int16 key
     _variants->init(types, HashKeyType::int16_key);
     value = std::holds_alternative<
-            vectorized::MethodOneNumber<vectorized::UInt16, AggData<vectorized::UInt16>>>(
+            vectorized::MethodOneNumber<vectorized::UInt16, AggregatedDataWithUInt16Key>>(
             _variants->method_variant);
     ASSERT_TRUE(value);
 
@@ -325,6 +349,73 @@ TEST_F(AggregatedDataVariantsTest, TestFixedKeys) {
     _variants->init(types, HashKeyType::fixed256);
     ASSERT_TRUE(std::holds_alternative<vectorized::MethodKeysFixed<AggData<vectorized::UInt256>>>(
             _variants->method_variant));
+
+    // Keys packed into 16 bits are direct mapped
+    std::vector<vectorized::DataTypePtr> small_types {std::make_shared<vectorized::DataTypeInt8>(),
+                                                      std::make_shared<vectorized::DataTypeInt8>()};
+    _variants->init(small_types, HashKeyType::fixed64);
+    ASSERT_TRUE(std::holds_alternative<vectorized::MethodKeysFixed<AggregatedDataWithUInt16Key>>(
+            _variants->method_variant));
+
+    std::vector<vectorized::DataTypePtr> nullable_types {
+            std::make_shared<vectorized::DataTypeNullable>(
+                    std::make_shared<vectorized::DataTypeInt8>()),
+            std::make_shared<vectorized::DataTypeInt8>()};
+    _variants->init(nullable_types, HashKeyType::fixed64);
+    ASSERT_TRUE(std::holds_alternative<vectorized::MethodKeysFixed<AggData<vectorized::UInt64>>>(
+            _variants->method_variant));
+}
+
+TEST(DirectMappedHashMapTest, EmplaceFindIterate) {
+    AggregatedDataWithUInt16Key map;
+    EXPECT_TRUE(map.empty());
+    EXPECT_EQ(map.get_buffer_size_in_bytes(), 0);
+
+    char states[3];
+    std::vector<vectorized::UInt16> keys {7, 65535, 300, 7};
+    for (size_t i = 0; i < keys.size(); ++i) {
+        AggregatedDataWithUInt16Key::LookupResult it;
+        map.lazy_emplace(keys[i], it, 0, [&](const auto& ctor, auto& key, auto& origin) {
+            ctor(key, states + i);
+        });
+        EXPECT_EQ(*lookup_result_get_mapped(it), states + (i == 3 ? 0 : i));
+    }
+    EXPECT_EQ(map.size(), 3);
+    EXPECT_FALSE(map.add_elem_size_overflow(1 << 20));
+    // 7, 300 and 65535 each allocate their own chunk
+    EXPECT_EQ(map.get_buffer_size_in_bytes(), 3 * map.estimate_memory(1));
+
+    EXPECT_EQ(map.find(vectorized::UInt16(8)), nullptr);
+    ASSERT_NE(map.find(vectorized::UInt16(300)), nullptr);
+    EXPECT_EQ(*lookup_result_get_mapped(map.find(vectorized::UInt16(300))), states + 2);
+
+    std::vector<vectorized::UInt16> iterated;
+    for (auto it = map.begin(); it != map.end(); ++it) {
+        iterated.push_back(it->get_first());
+    }
+    EXPECT_EQ(iterated, (std::vector<vectorized::UInt16> {7, 300, 65535}));
+
+    map.clear_and_shrink();
+    EXPECT_TRUE(map.empty());
+    EXPECT_TRUE(map.begin() == map.end());
+}
+
+TEST(DirectMappedHashMapTest, NullKey) {
+    AggregatedDataWithNullableUInt8Key map;
+    bool inserted = false;
+    AggregatedDataWithNullableUInt8Key::LookupResult it;
+    map.emplace(vectorized::UInt8(255), it, inserted);
+    EXPECT_TRUE(inserted);
+    map.emplace(vectorized::UInt8(255), it, inserted);
+    EXPECT_FALSE(inserted);
+    map.has_null_key_data() = true;
+    EXPECT_EQ(map.size(), 2);
+
+    size_t count = 0;
+    for (auto iter = map.begin(); iter != map.end(); ++iter) {
+        ++count;
+    }
+    EXPECT_EQ(count, 2);
 }
 
 TEST_F(AggregatedDataVariantsTest, TestInvalidKeyType) {
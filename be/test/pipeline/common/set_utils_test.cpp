@@ -22,6 +22,7 @@
 #include "common/status.h"
 #include "vec/common/uint128.h"
 #include "vec/data_types/data_type_decimal.h"
+#include "vec/data_types/data_type_nullable.h"
 #include "vec/data_types/data_type_number.h"
 #include "vec/data_types/data_type_string.h"
 
@@ -136,6 +137,51 @@ TEST_F(SetUtilsTest, TestSetDataVariantsInitFixedKeys) {
                HashKeyType::fixed256);
 }
 
+TEST_F(SetUtilsTest, TestSmallKeysDirectMapped) {
+    static_assert(std::is_same_v<SetData<vectorized::UInt8>,
+                                 DirectMappedHashMap<vectorized::UInt8, RowRefWithFlag>>);
+    static_assert(std::is_same_v<SetData<vectorized::UInt16>,
+                                 DirectMappedHashMap<vectorized::UInt16, RowRefWithFlag>>);
+    static_assert(std::is_same_v<SetData<vectorized::UInt32>,
+                                 PHHashMap<vectorized::UInt32, RowRefWithFlag,
+                                           HashCRC32<vectorized::UInt32>>>);
+
+    SetDataVariants variants;
+    variants.init({std::make_shared<vectorized::DataTypeNullable>(
+                          std::make_shared<vectorized::DataTypeInt16>())},
+                  HashKeyType::int16_key);
+    ASSERT_TRUE(std::holds_alternative<SetPrimaryTypeHashTableContextNullable<vectorized::UInt16>>(
+            variants.method_variant));
+
+    // Build, mark and shrink the way the set sink and probe sink do
+    SetData<vectorized::UInt16> set;
+    std::vector<vectorized::UInt16> keys {3, 60000, 3, 511};
+    for (size_t i = 0; i < keys.size(); ++i) {
+        SetData<vectorized::UInt16>::LookupResult it;
+        bool inserted;
+        set.emplace(keys[i], it, inserted);
+        if (inserted) {
+            *lookup_result_get_mapped(it) = RowRefWithFlag(i);
+        }
+    }
+    ASSERT_EQ(set.size(), 3);
+    ASSERT_EQ(set.find(vectorized::UInt16(4)), nullptr);
+    auto* found = set.find(vectorized::UInt16(60000));
+    ASSERT_NE(found, nullptr);
+    EXPECT_EQ(lookup_result_get_mapped(found)->row_num, 1);
+    lookup_result_get_mapped(found)->visited = true;
+
+    SetData<vectorized::UInt16> shrunk;
+    for (auto iter = set.begin(); iter != set.end(); ++iter) {
+        if (iter.get_second().visited) {
+            shrunk.insert(iter);
+        }
+    }
+    ASSERT_EQ(shrunk.size(), 1);
+    EXPECT_EQ(shrunk.begin().get_first(), 60000);
+    EXPECT_TRUE(shrunk.begin().get_second().visited);
+}
+
 // Test error handling for invalid hash key type
 TEST_F(SetUtilsTest, TestInvalidHashKeyType) {
     SetDataVariants variants;
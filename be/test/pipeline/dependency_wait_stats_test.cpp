@@ -0,0 +1,67 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "pipeline/dependency_wait_stats.h"
+
+#include <gtest/gtest.h>
+
+namespace doris::pipeline {
+
+TEST(DependencyWaitStatsTest, TopWaits) {
+    DependencyWaitStats stats;
+    stats.update("EXCHANGE_OPERATOR_DEPENDENCY", 1, 100);
+    stats.update("RUNTIME_FILTER_DEPENDENCY", 2, 300);
+    stats.update("EXCHANGE_OPERATOR_DEPENDENCY", 1, 50);
+    stats.update("EXCHANGE_OPERATOR_DEPENDENCY", 3, 20);
+    EXPECT_EQ(stats.total_wait_ns(), 470);
+
+    auto waits = stats.top_waits();
+    ASSERT_EQ(waits.size(), 3);
+    EXPECT_EQ(waits[0].dependency, "RUNTIME_FILTER_DEPENDENCY");
+    EXPECT_EQ(waits[0].node_id, 2);
+    EXPECT_EQ(waits[1].dependency, "EXCHANGE_OPERATOR_DEPENDENCY");
+    EXPECT_EQ(waits[1].node_id, 1);
+    EXPECT_EQ(waits[1].wait_ns, 150);
+    EXPECT_EQ(waits[1].wait_times, 2);
+
+    waits = stats.top_waits(1);
+    ASSERT_EQ(waits.size(), 1);
+    EXPECT_EQ(waits[0].wait_ns, 300);
+}
+
+TEST(DependencyWaitStatsTest, MergeByDependencyName) {
+    DependencyWaitStats query1;
+    query1.update("EXCHANGE_OPERATOR_DEPENDENCY", 1, 100);
+    query1.update("EXCHANGE_OPERATOR_DEPENDENCY", 3, 20);
+    DependencyWaitStats query2;
+    query2.update("EXCHANGE_OPERATOR_DEPENDENCY", 5, 30);
+    query2.update("MEMORY_SUFFICIENT_DEPENDENCY", 0, 10);
+
+    DependencyWaitStats backend;
+    query1.merge_to(&backend);
+    query2.merge_to(&backend);
+    auto waits = backend.top_waits();
+    ASSERT_EQ(waits.size(), 2);
+    EXPECT_EQ(waits[0].dependency, "EXCHANGE_OPERATOR_DEPENDENCY");
+    EXPECT_EQ(waits[0].node_id, -1);
+    EXPECT_EQ(waits[0].wait_ns, 150);
+    EXPECT_EQ(waits[0].wait_times, 3);
+    EXPECT_EQ(waits[1].dependency, "MEMORY_SUFFICIENT_DEPENDENCY");
+    EXPECT_EQ(waits[1].wait_ns, 10);
+}
+
+} // namespace doris::pipeline
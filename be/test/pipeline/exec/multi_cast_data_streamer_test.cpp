@@ -261,6 +261,44 @@ TEST_F(MultiCastDataStreamerTest, MultiTest) {
     }
 }
 
+TEST_F(MultiCastDataStreamerTest, ReleaseAfterSlowestReader) {
+    using namespace vectorized;
+
+    Block block1 = ColumnHelper::create_block<DataTypeInt64>({1, 2, 3});
+    Block block2 = ColumnHelper::create_block<DataTypeInt64>({4, 5});
+    const auto* column1 = block1.get_by_position(0).column.get();
+    const auto size1 = static_cast<int64_t>(block1.allocated_bytes());
+    const auto size2 = static_cast<int64_t>(block2.allocated_bytes());
+    EXPECT_TRUE(multi_cast_data_streamer->push(&state, &block1, false).ok());
+    EXPECT_TRUE(multi_cast_data_streamer->push(&state, &block2, true).ok());
+    EXPECT_EQ(multi_cast_data_streamer->buffered_mem_size(), size1 + size2);
+
+    bool eos = false;
+    for (int id = 0; id < cast_sender_count - 1; id++) {
+        Block block;
+        EXPECT_TRUE(multi_cast_data_streamer->pull(&state, id, &block, &eos).ok());
+        EXPECT_NE(block.get_by_position(0).column.get(), column1);
+        EXPECT_TRUE(multi_cast_data_streamer->pull(&state, id, &block, &eos).ok());
+        EXPECT_TRUE(eos);
+    }
+    EXPECT_EQ(multi_cast_data_streamer->buffered_mem_size(), size1 + size2);
+
+    // The slowest reader takes the blocks over and releases them one by one.
+    Block block;
+    EXPECT_TRUE(multi_cast_data_streamer->pull(&state, cast_sender_count - 1, &block, &eos).ok());
+    EXPECT_FALSE(eos);
+    EXPECT_EQ(block.get_by_position(0).column.get(), column1);
+    EXPECT_TRUE(ColumnHelper::block_equal(block,
+                                          ColumnHelper::create_block<DataTypeInt64>({1, 2, 3})));
+    EXPECT_EQ(multi_cast_data_streamer->buffered_mem_size(), size2);
+
+    EXPECT_TRUE(multi_cast_data_streamer->pull(&state, cast_sender_count - 1, &block, &eos).ok());
+    EXPECT_TRUE(eos);
+    EXPECT_TRUE(
+            ColumnHelper::block_equal(block, ColumnHelper::create_block<DataTypeInt64>({4, 5})));
+    EXPECT_EQ(multi_cast_data_streamer->buffered_mem_size(), 0);
+}
+
 TEST_F(MultiCastDataStreamerTest, SpillTest) {
     using namespace vectorized;
 
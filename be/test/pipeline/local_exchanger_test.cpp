@@ -18,6 +18,9 @@
 #include <glog/logging.h>
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <numeric>
+
 #include "common/status.h"
 #include "pipeline/dependency.h"
 #include "pipeline/exec/exchange_source_operator.h"
@@ -27,6 +30,7 @@
 #include "thrift_builder.h"
 #include "vec/columns/column.h"
 #include "vec/columns/column_vector.h"
+#include "vec/common/assert_cast.h"
 #include "vec/data_types/data_type.h"
 #include "vec/data_types/data_type_number.h"
 #include "vec/exprs/vslot_ref.h"
@@ -106,6 +110,8 @@ TEST_F(LocalExchangerTest, ShuffleExchanger) {
         _sink_local_states[i]->_exchanger = shared_state->exchanger.get();
         _sink_local_states[i]->_compute_hash_value_timer = compute_hash_value_timer;
         _sink_local_states[i]->_distribute_timer = distribute_timer;
+        _sink_local_states[i]->_single_partition_blocks_counter =
+                ADD_COUNTER(profile, "SinglePartitionBlocks" + std::to_string(i), TUnit::UNIT);
         _sink_local_states[i]->_partitioner.reset(
                 new vectorized::Crc32HashPartitioner<vectorized::ShuffleChannelIds>(
                         num_partitions));
@@ -178,6 +184,9 @@ TEST_F(LocalExchangerTest, ShuffleExchanger) {
                           Status::OK());
                 EXPECT_EQ(_sink_local_states[i]->_channel_id, i);
                 EXPECT_EQ(_sink_local_states[i]->_dependency->ready(), i < num_partitions - 1);
+                // All rows of a block share the same value, so no row index is built.
+                EXPECT_EQ(_sink_local_states[i]->_single_partition_blocks_counter->value(),
+                          static_cast<int64_t>(j + 1));
             }
         }
     }
@@ -1263,4 +1272,123 @@ TEST_F(LocalExchangerTest, TestShuffleExchangerWrongMap) {
                         .is<ErrorCode::INTERNAL_ERROR>());
     }
 }
+TEST_F(LocalExchangerTest, ShuffleExchangerMixedPartitions) {
+    const int num_sink = 1;
+    const int num_sources = 2;
+    const int num_partitions = 2;
+    std::map<int, int> shuffle_idx_to_instance_idx;
+    for (int i = 0; i < num_partitions; i++) {
+        shuffle_idx_to_instance_idx[i] = i;
+    }
+    auto profile = std::make_shared<RuntimeProfile>("");
+    auto shared_state = LocalExchangeSharedState::create_shared(num_partitions);
+    shared_state->exchanger =
+            ShuffleExchanger::create_unique(num_sink, num_sources, num_partitions, 0);
+    auto sink_dep = std::make_shared<Dependency>(0, 0, "LOCAL_EXCHANGE_SINK_DEPENDENCY", true);
+    sink_dep->set_shared_state(shared_state.get());
+    shared_state->sink_deps.push_back(sink_dep);
+    shared_state->create_source_dependencies(num_sources, 0, 0, "TEST");
+    auto* exchanger = (ShuffleExchanger*)shared_state->exchanger.get();
+
+    auto texpr = TExprNodeBuilder(TExprNodeType::SLOT_REF,
+                                  TTypeDescBuilder()
+                                          .set_types(TTypeNodeBuilder()
+                                                             .set_type(TTypeNodeType::SCALAR)
+                                                             .set_scalar_type(TPrimitiveType::INT)
+                                                             .build())
+                                          .build(),
+                                  0)
+                         .set_slot_ref(TSlotRefBuilder(0, 0).build())
+                         .build();
+    std::unique_ptr<LocalExchangeSinkLocalState> sink_local_state(
+            new LocalExchangeSinkLocalState(nullptr, nullptr));
+    sink_local_state->_exchanger = shared_state->exchanger.get();
+    sink_local_state->_compute_hash_value_timer = ADD_TIMER(profile, "ComputeHashValueTime");
+    sink_local_state->_distribute_timer = ADD_TIMER(profile, "DistributeDataTime");
+    sink_local_state->_partitioner.reset(
+            new vectorized::Crc32HashPartitioner<vectorized::ShuffleChannelIds>(num_partitions));
+    auto slot = doris::vectorized::VSlotRef::create_shared(texpr);
+    slot->_column_id = 0;
+    ((vectorized::Crc32HashPartitioner<vectorized::ShuffleChannelIds>*)sink_local_state
+             ->_partitioner.get())
+            ->_partition_expr_ctxs.push_back(
+                    std::make_shared<doris::vectorized::VExprContext>(slot));
+    sink_local_state->_channel_id = 0;
+    sink_local_state->_shared_state = shared_state.get();
+    sink_local_state->_dependency = sink_dep.get();
+    sink_local_state->_memory_used_counter =
+            profile->AddHighWaterMarkCounter("SinkMemoryUsage", TUnit::BYTES, "", 1);
+
+    std::vector<std::unique_ptr<LocalExchangeSourceLocalState>> local_states(num_sources);
+    for (int i = 0; i < num_sources; i++) {
+        local_states[i].reset(new LocalExchangeSourceLocalState(nullptr, nullptr));
+        local_states[i]->_exchanger = shared_state->exchanger.get();
+        local_states[i]->_copy_data_timer = ADD_TIMER(profile, "CopyDataTime" + std::to_string(i));
+        local_states[i]->_get_block_failed_counter =
+                ADD_TIMER(profile, "GetBlockFailed" + std::to_string(i));
+        local_states[i]->_channel_id = i;
+        local_states[i]->_shared_state = shared_state.get();
+        local_states[i]->_dependency = shared_state->get_dep_by_channel_id(i).front().get();
+        local_states[i]->_memory_used_counter = profile->AddHighWaterMarkCounter(
+                "MemoryUsage" + std::to_string(i), TUnit::BYTES, "", 1);
+        shared_state->mem_counters[i] = local_states[i]->_memory_used_counter;
+    }
+
+    // Values 0..15 in arbitrary order (rows are gathered) and clustered by partition (rows are
+    // copied as contiguous ranges).
+    const int num_values = 16;
+    std::vector<int32_t> values(num_values);
+    std::vector<uint32_t> hashes(num_values, 0);
+    std::iota(values.begin(), values.end(), 0);
+    {
+        auto col = vectorized::ColumnInt32::create();
+        col->insert_many_raw_data(reinterpret_cast<const char*>(values.data()), num_values);
+        col->update_crcs_with_value(hashes.data(), PrimitiveType::TYPE_INT, num_values, 0, nullptr);
+    }
+    std::vector<int32_t> clustered = values;
+    std::stable_sort(clustered.begin(), clustered.end(), [&](int32_t l, int32_t r) {
+        return hashes[l] % num_partitions < hashes[r] % num_partitions;
+    });
+    for (const auto& input : {values, clustered}) {
+        vectorized::Block in_block;
+        auto col = vectorized::ColumnInt32::create();
+        col->insert_many_raw_data(reinterpret_cast<const char*>(input.data()), num_values);
+        in_block.insert({std::move(col), std::make_shared<vectorized::DataTypeInt32>(),
+                         "test_int_col0"});
+        EXPECT_EQ(exchanger->sink(_runtime_state.get(), &in_block, false,
+                                  {sink_local_state->_compute_hash_value_timer,
+                                   sink_local_state->_distribute_timer, nullptr},
+                                  {&sink_local_state->_channel_id,
+                                   sink_local_state->_partitioner.get(), sink_local_state.get(),
+                                   &shuffle_idx_to_instance_idx}),
+                  Status::OK());
+    }
+
+    size_t total_rows = 0;
+    for (int i = 0; i < num_sources; i++) {
+        bool eos = false;
+        vectorized::Block block;
+        EXPECT_EQ(exchanger->get_block(_runtime_state.get(), &block, &eos,
+                                       {nullptr, nullptr, local_states[i]->_copy_data_timer},
+                                       {i, local_states[i].get()}),
+                  Status::OK());
+        std::vector<int32_t> expected;
+        for (const auto& input : {values, clustered}) {
+            for (auto v : input) {
+                if (hashes[v] % num_partitions == static_cast<uint32_t>(i)) {
+                    expected.push_back(v);
+                }
+            }
+        }
+        ASSERT_EQ(block.rows(), expected.size());
+        const auto& data =
+                assert_cast<const vectorized::ColumnInt32&>(*block.get_by_position(0).column)
+                        .get_data();
+        for (size_t row = 0; row < expected.size(); row++) {
+            EXPECT_EQ(data[row], expected[row]);
+        }
+        total_rows += block.rows();
+    }
+    EXPECT_EQ(total_rows, static_cast<size_t>(2 * num_values));
+}
 } // namespace doris::pipeline
@@ -27,7 +27,9 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include <map>
 #include <memory>
+#include <variant>
 #include <vector>
 
 #include "common/config.h"
@@ -37,6 +39,7 @@
 #include "runtime/descriptors.h"
 #include "runtime/runtime_state.h"
 #include "testutil/mock/mock_runtime_state.h"
+#include "util/defer_op.h"
 #include "vec/core/block.h"
 #include "vec/exprs/vexpr_context.h"
 
@@ -358,4 +361,133 @@ TEST_F(HashJoinBuildSinkTest, Terminate) {
     run_test_block(test_block);
 }
 
-} // namespace doris::pipeline
\ No newline at end of file
+// A build instance that takes the shared hash table of a broadcast join finishes without
+// receiving the rest of its copy of the build side, and wakes up its probe side.
+TEST_F(HashJoinBuildSinkTest, BroadcastJoinEarlyFinish) {
+    auto origin_early_finish = config::enable_broadcast_join_early_finish;
+    Defer defer {[&]() { config::enable_broadcast_join_early_finish = origin_early_finish; }};
+
+    for (bool early_finish : {true, false}) {
+        config::enable_broadcast_join_early_finish = early_finish;
+        auto tnode = _helper.create_test_plan_node(TJoinOp::INNER_JOIN, {TPrimitiveType::INT},
+                                                   {false}, {false});
+        tnode.hash_join_node.__set_is_broadcast_join(true);
+        auto [probe_operator, sink_operator] = _helper.create_operators(tnode);
+        ASSERT_TRUE(probe_operator);
+        ASSERT_TRUE(sink_operator);
+
+        std::vector<std::unique_ptr<MockRuntimeState>> runtime_states;
+        for (int i = 0; i < 2; ++i) {
+            auto runtime_state = std::make_unique<MockRuntimeState>();
+            runtime_state->_query_ctx = _helper.query_ctx.get();
+            runtime_state->_query_id = _helper.query_ctx->query_id();
+            runtime_state->resize_op_id_to_local_state(-100);
+            runtime_state->set_max_operator_id(-100);
+            runtime_state->set_desc_tbl(_helper.desc_tbl);
+            runtime_states.push_back(std::move(runtime_state));
+        }
+
+        auto st = sink_operator->init(tnode, runtime_states[0].get());
+        ASSERT_TRUE(st.ok()) << "init failed: " << st.to_string();
+        st = sink_operator->prepare(runtime_states[0].get());
+        ASSERT_TRUE(st.ok()) << "prepare failed: " << st.to_string();
+        ASSERT_TRUE(sink_operator->_use_shared_hash_table);
+
+        // the shared state of 2 instances, created the way the fragment context does
+        auto shared_state = HashJoinSharedState::create_shared(2);
+        for (int i = 0; i < 2; ++i) {
+            auto sink_dep = std::make_shared<Dependency>(probe_operator->operator_id(),
+                                                         probe_operator->node_id(),
+                                                         "HASH_JOIN_BUILD_DEPENDENCY");
+            sink_dep->set_shared_state(shared_state.get());
+            shared_state->sink_deps.push_back(sink_dep);
+        }
+        shared_state->create_source_dependencies(2, probe_operator->operator_id(),
+                                                 probe_operator->node_id(), "HASH_JOIN_PROBE");
+        std::map<int, std::pair<std::shared_ptr<BasicSharedState>,
+                                std::vector<std::shared_ptr<Dependency>>>>
+                shared_state_map {{probe_operator->operator_id(),
+                                   {shared_state, shared_state->sink_deps}}};
+
+        std::vector<HashJoinBuildSinkLocalState*> local_states;
+        for (int i = 0; i < 2; ++i) {
+            LocalSinkStateInfo info {.task_idx = i,
+                                     .parent_profile = _helper.runtime_profile.get(),
+                                     .sender_id = 0,
+                                     .shared_state = shared_state.get(),
+                                     .shared_state_map = shared_state_map,
+                                     .tsink = TDataSink()};
+            st = sink_operator->setup_local_state(runtime_states[i].get(), info);
+            ASSERT_TRUE(st.ok()) << "setup_local_state failed: " << st.to_string();
+            local_states.push_back(reinterpret_cast<HashJoinBuildSinkLocalState*>(
+                    runtime_states[i]->get_sink_local_state()));
+            st = local_states.back()->open(runtime_states[i].get());
+            ASSERT_TRUE(st.ok()) << "open failed: " << st.to_string();
+        }
+        ASSERT_TRUE(local_states[0]->_should_build_hash_table);
+        ASSERT_FALSE(local_states[1]->_should_build_hash_table);
+
+        const auto& row_desc = sink_operator->child()->row_desc();
+        vectorized::Block empty_block(row_desc.tuple_descriptors()[0]->slots(), 0);
+        auto make_build_block = [&]() {
+            auto mutable_block = vectorized::MutableBlock(empty_block.clone_empty());
+            for (auto& col : mutable_block.mutable_columns()) {
+                col->insert_default();
+                if (col->is_nullable()) {
+                    auto& nullable_column = assert_cast<vectorized::ColumnNullable&>(*col);
+                    nullable_column.insert_not_null_elements(1);
+                } else {
+                    col->insert_default();
+                }
+            }
+            return mutable_block.to_block();
+        };
+
+        // task 0 builds the hash table, closing it signals the other instance
+        auto block = make_build_block();
+        st = sink_operator->sink(runtime_states[0].get(), &block, false);
+        ASSERT_TRUE(st.ok()) << "sink failed: " << st.to_string();
+        st = sink_operator->sink(runtime_states[0].get(), &empty_block, true);
+        ASSERT_TRUE(st.ok()) << "sink failed: " << st.to_string();
+        st = local_states[0]->close(runtime_states[0].get(), Status::OK());
+        ASSERT_TRUE(st.ok()) << "close failed: " << st.to_string();
+        ASSERT_TRUE(sink_operator->_signaled);
+        ASSERT_FALSE(shared_state->source_deps[1]->ready());
+
+        block = make_build_block();
+        st = sink_operator->sink(runtime_states[1].get(), &block, false);
+        if (early_finish) {
+            ASSERT_TRUE(st.is<ErrorCode::END_OF_FILE>()) << st.to_string();
+            EXPECT_TRUE(local_states[1]->_finished_with_shared_hash_table);
+            EXPECT_TRUE(shared_state->source_deps[1]->ready());
+            // the task is woken up early, which terminates its sink
+            st = local_states[1]->terminate(runtime_states[1].get());
+            ASSERT_TRUE(st.ok()) << "terminate failed: " << st.to_string();
+        } else {
+            ASSERT_TRUE(st.ok()) << "sink failed: " << st.to_string();
+            EXPECT_FALSE(local_states[1]->_finished_with_shared_hash_table);
+            EXPECT_FALSE(shared_state->source_deps[1]->ready());
+            st = sink_operator->sink(runtime_states[1].get(), &empty_block, true);
+            ASSERT_TRUE(st.ok()) << "sink failed: " << st.to_string();
+            EXPECT_TRUE(shared_state->source_deps[1]->ready());
+        }
+        // both instances probe the hash table built by task 0
+        std::visit(
+                [](auto&& dst, auto&& src) {
+                    if constexpr (!std::is_same_v<std::monostate, std::decay_t<decltype(dst)>> &&
+                                  std::is_same_v<std::decay_t<decltype(src)>,
+                                                 std::decay_t<decltype(dst)>>) {
+                        EXPECT_EQ(dst.hash_table, src.hash_table);
+                    } else {
+                        FAIL() << "the instances use different hash table types";
+                    }
+                },
+                shared_state->hash_table_variant_vector[1]->method_variant,
+                shared_state->hash_table_variant_vector.front()->method_variant);
+
+        st = local_states[1]->close(runtime_states[1].get(), Status::OK());
+        ASSERT_TRUE(st.ok()) << "close failed: " << st.to_string();
+    }
+}
+
+} // namespace doris::pipeline
@@ -0,0 +1,612 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "pipeline/exec/nested_loop_join_probe_operator.h"
+
+#include <fmt/format.h>
+#include <gen_cpp/Exprs_types.h>
+#include <gen_cpp/PlanNodes_types.h>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <optional>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "common/config.h"
+#include "join_test_helper.h"
+#include "pipeline/exec/nested_loop_join_build_operator.h"
+#include "runtime/descriptor_helper.h"
+#include "testutil/column_helper.h"
+#include "testutil/creators.h"
+#include "testutil/mock/mock_operators.h"
+#include "util/defer_op.h"
+#include "vec/columns/column_const.h"
+#include "vec/data_types/data_type_number.h"
+
+namespace doris::pipeline {
+using namespace vectorized;
+
+namespace {
+using Value = std::optional<int32_t>;
+// (a, c) of the probe side or (s, e) of the build side
+using Row = std::pair<Value, Value>;
+using Rows = std::vector<Row>;
+
+// `build <fn_name> probe` if build_on_left, `probe <fn_name> build` otherwise
+struct BandPredicate {
+    std::string fn_name;
+    bool build_on_left;
+    // 0 for `a`, 1 for `c`
+    int probe_column;
+    // 0 for `s`, 1 for `e`
+    int build_column;
+};
+
+struct JoinCase {
+    TJoinOp::type join_op = TJoinOp::INNER_JOIN;
+    std::vector<BandPredicate> predicates;
+    bool probe_nullable = false;
+    bool build_nullable = false;
+    std::vector<Rows> build_blocks;
+    std::vector<Rows> probe_blocks;
+};
+
+// slot ids of the intermediate tuple, which are allocated after the probe and build tuples
+constexpr TSlotId INTERMEDIATE_PROBE_SLOT = 4;
+constexpr TSlotId INTERMEDIATE_BUILD_SLOT = 6;
+
+bool compare(const std::string& fn_name, int32_t lhs, int32_t rhs) {
+    if (fn_name == "lt") {
+        return lhs < rhs;
+    }
+    if (fn_name == "le") {
+        return lhs <= rhs;
+    }
+    if (fn_name == "gt") {
+        return lhs > rhs;
+    }
+    return lhs >= rhs;
+}
+
+Value get_value(const Row& row, int column) {
+    return column == 0 ? row.first : row.second;
+}
+
+std::string to_string(const Value& value) {
+    return value ? std::to_string(*value) : "NULL";
+}
+
+bool is_left_semi_anti(TJoinOp::type join_op) {
+    return join_op == TJoinOp::LEFT_SEMI_JOIN || join_op == TJoinOp::LEFT_ANTI_JOIN;
+}
+
+// The rows a nested loop join without any index outputs, semi and anti joins only output the
+// probe columns
+std::vector<std::string> reference_join(const JoinCase& join_case) {
+    std::vector<std::string> rows;
+    for (const auto& probe_block : join_case.probe_blocks) {
+        for (const auto& probe_row : probe_block) {
+            bool matched = false;
+            for (const auto& build_block : join_case.build_blocks) {
+                for (const auto& build_row : build_block) {
+                    bool match = true;
+                    for (const auto& predicate : join_case.predicates) {
+                        auto probe = get_value(probe_row, predicate.probe_column);
+                        auto build = get_value(build_row, predicate.build_column);
+                        match = match && probe && build &&
+                                (predicate.build_on_left
+                                         ? compare(predicate.fn_name, *build, *probe)
+                                         : compare(predicate.fn_name, *probe, *build));
+                    }
+                    if (match && !is_left_semi_anti(join_case.join_op)) {
+                        rows.push_back(fmt::format("{} {} {} {}", to_string(probe_row.first),
+                                                   to_string(probe_row.second),
+                                                   to_string(build_row.first),
+                                                   to_string(build_row.second)));
+                    }
+                    matched = matched || match;
+                }
+            }
+            if ((join_case.join_op == TJoinOp::LEFT_SEMI_JOIN && matched) ||
+                (join_case.join_op == TJoinOp::LEFT_ANTI_JOIN && !matched)) {
+                rows.push_back(fmt::format("{} {}", to_string(probe_row.first),
+                                           to_string(probe_row.second)));
+            } else if (join_case.join_op == TJoinOp::LEFT_OUTER_JOIN && !matched) {
+                rows.push_back(fmt::format("{} {} NULL NULL", to_string(probe_row.first),
+                                           to_string(probe_row.second)));
+            }
+        }
+    }
+    std::sort(rows.begin(), rows.end());
+    return rows;
+}
+
+ColumnWithTypeAndName create_int_column(const std::vector<Value>& values, bool nullable) {
+    std::vector<int32_t> data;
+    std::vector<uint8_t> null_map;
+    for (const auto& value : values) {
+        data.push_back(value.value_or(0));
+        null_map.push_back(!value.has_value());
+    }
+    if (nullable) {
+        return ColumnHelper::create_nullable_column_with_name<DataTypeInt32>(data, null_map);
+    }
+    return ColumnHelper::create_column_with_name<DataTypeInt32>(data);
+}
+
+Block create_block(const Rows& rows, bool nullable) {
+    std::vector<Value> first;
+    std::vector<Value> second;
+    for (const auto& [first_value, second_value] : rows) {
+        first.push_back(first_value);
+        second.push_back(second_value);
+    }
+    return Block({create_int_column(first, nullable), create_int_column(second, nullable)});
+}
+
+TExprNode create_int_slot_ref(TSlotId slot_id, bool nullable) {
+    TExprNode node;
+    node.node_type = TExprNodeType::SLOT_REF;
+    node.type.types.emplace_back();
+    node.type.types[0].type = TTypeNodeType::SCALAR;
+    node.type.types[0].scalar_type.type = TPrimitiveType::INT;
+    node.type.types[0].__isset.scalar_type = true;
+    node.__set_is_nullable(nullable);
+    node.num_children = 0;
+    node.slot_ref.slot_id = slot_id;
+    node.slot_ref.tuple_id = 2;
+    node.__isset.slot_ref = true;
+    return node;
+}
+
+TExpr create_band_conjunct(const BandPredicate& predicate, bool probe_nullable,
+                           bool build_nullable) {
+    auto probe = create_int_slot_ref(INTERMEDIATE_PROBE_SLOT + predicate.probe_column,
+                                     probe_nullable);
+    auto build = create_int_slot_ref(INTERMEDIATE_BUILD_SLOT + predicate.build_column,
+                                     build_nullable);
+
+    TExpr conjunct;
+    auto& node = conjunct.nodes.emplace_back();
+    node.node_type = TExprNodeType::BINARY_PRED;
+    node.opcode = predicate.fn_name == "lt"   ? TExprOpcode::LT
+                  : predicate.fn_name == "le" ? TExprOpcode::LE
+                  : predicate.fn_name == "gt" ? TExprOpcode::GT
+                                              : TExprOpcode::GE;
+    node.type.types.emplace_back();
+    node.type.types[0].type = TTypeNodeType::SCALAR;
+    node.type.types[0].scalar_type.type = TPrimitiveType::BOOLEAN;
+    node.type.types[0].__isset.scalar_type = true;
+    node.__set_is_nullable(probe_nullable || build_nullable);
+    node.num_children = 2;
+    node.fn.name.function_name = predicate.fn_name;
+    node.__isset.fn = true;
+    conjunct.nodes.emplace_back(predicate.build_on_left ? build : probe);
+    conjunct.nodes.emplace_back(predicate.build_on_left ? probe : build);
+    return conjunct;
+}
+} // namespace
+
+class NestedLoopJoinProbeOperatorTest : public testing::Test {
+public:
+    void SetUp() override {
+        _enable_band_index = config::enable_nested_loop_join_band_index;
+        _rng.seed(42);
+    }
+
+    void TearDown() override {
+        config::enable_nested_loop_join_band_index = _enable_band_index;
+    }
+
+protected:
+    // Random rows in [min, max), null with a probability of 1/8 if nullable
+    std::vector<Rows> generate_blocks(const std::vector<size_t>& block_rows, int32_t min,
+                                      int32_t max, bool nullable) {
+        std::uniform_int_distribution<int32_t> value_dist(min, max - 1);
+        std::uniform_int_distribution<int32_t> null_dist(0, 7);
+        auto generate_value = [&]() -> Value {
+            if (nullable && null_dist(_rng) == 0) {
+                return std::nullopt;
+            }
+            return value_dist(_rng);
+        };
+        std::vector<Rows> blocks(block_rows.size());
+        for (size_t i = 0; i < block_rows.size(); ++i) {
+            for (size_t j = 0; j < block_rows[i]; ++j) {
+                auto first = generate_value();
+                auto second = generate_value();
+                blocks[i].emplace_back(first, second);
+            }
+        }
+        return blocks;
+    }
+
+    // Three build blocks with values in [0, 20), and probe values in [-3, 23) so that some of
+    // the probe rows match no build row
+    JoinCase create_join_case(TJoinOp::type join_op, std::vector<BandPredicate> predicates,
+                              bool probe_nullable = false, bool build_nullable = false) {
+        JoinCase join_case {.join_op = join_op,
+                            .predicates = std::move(predicates),
+                            .probe_nullable = probe_nullable,
+                            .build_nullable = build_nullable};
+        join_case.build_blocks = generate_blocks({7, 5, 9}, 0, 20, build_nullable);
+        join_case.probe_blocks = generate_blocks({6, 6, 5}, -3, 23, probe_nullable);
+        return join_case;
+    }
+
+    TPlanNode create_test_plan_node(const JoinCase& join_case) {
+        const bool intermediate_probe_nullable =
+                join_case.probe_nullable || join_case.join_op == TJoinOp::RIGHT_OUTER_JOIN ||
+                join_case.join_op == TJoinOp::FULL_OUTER_JOIN;
+        const bool intermediate_build_nullable =
+                join_case.build_nullable || join_case.join_op == TJoinOp::LEFT_OUTER_JOIN ||
+                join_case.join_op == TJoinOp::FULL_OUTER_JOIN;
+
+        TDescriptorTableBuilder builder;
+        auto add_tuple = [&](const std::vector<std::string>& names, bool nullable) {
+            TTupleDescriptorBuilder tuple_builder;
+            for (const auto& name : names) {
+                tuple_builder.add_slot(TSlotDescriptorBuilder()
+                                               .type(TYPE_INT)
+                                               .nullable(nullable)
+                                               .column_name(name)
+                                               .build());
+            }
+            tuple_builder.build(&builder);
+        };
+        add_tuple({"a", "c"}, join_case.probe_nullable);
+        add_tuple({"s", "e"}, join_case.build_nullable);
+        TTupleDescriptorBuilder intermediate_builder;
+        for (const auto* name : {"a", "c"}) {
+            intermediate_builder.add_slot(TSlotDescriptorBuilder()
+                                                  .type(TYPE_INT)
+                                                  .nullable(intermediate_probe_nullable)
+                                                  .column_name(name)
+                                                  .build());
+        }
+        for (const auto* name : {"s", "e"}) {
+            intermediate_builder.add_slot(TSlotDescriptorBuilder()
+                                                  .type(TYPE_INT)
+                                                  .nullable(intermediate_build_nullable)
+                                                  .column_name(name)
+                                                  .build());
+        }
+        intermediate_builder.build(&builder);
+
+        auto st = DescriptorTbl::create(_helper->obj_pool.get(), builder.desc_tbl(),
+                                        &_helper->desc_tbl);
+        EXPECT_TRUE(st.ok()) << st.to_string();
+        _helper->runtime_state->set_desc_tbl(_helper->desc_tbl);
+
+        TPlanNode tnode;
+        tnode.node_id = 0;
+        tnode.node_type = TPlanNodeType::CROSS_JOIN_NODE;
+        tnode.num_children = 2;
+        tnode.limit = -1;
+        tnode.row_tuples = {0, 1};
+        tnode.nullable_tuples = {false, false};
+        tnode.__set_nested_loop_join_node(TNestedLoopJoinNode());
+        tnode.nested_loop_join_node.join_op = join_case.join_op;
+        tnode.nested_loop_join_node.__set_vintermediate_tuple_id_list({2});
+        std::vector<TExpr> join_conjuncts;
+        for (const auto& predicate : join_case.predicates) {
+            join_conjuncts.push_back(create_band_conjunct(predicate, intermediate_probe_nullable,
+                                                          intermediate_build_nullable));
+        }
+        tnode.nested_loop_join_node.__set_join_conjuncts(join_conjuncts);
+        // the output of get_block() is the intermediate block, projections are not needed
+        tnode.__set_output_tuple_id(2);
+        return tnode;
+    }
+
+    void create_operators(const JoinCase& join_case) {
+        _helper = std::make_unique<JoinTestHelper>();
+        _helper->SetUp();
+        // a small batch size to output the joined rows of a probe block in several blocks
+        _helper->runtime_state->batsh_size = 4;
+        auto tnode = create_test_plan_node(join_case);
+        auto* state = _helper->runtime_state.get();
+
+        _sink_operator = std::make_shared<NestedLoopJoinBuildSinkOperatorX>(
+                _helper->obj_pool.get(), 0, 0, tnode, state->desc_tbl());
+        _probe_operator = std::make_shared<NestedLoopJoinProbeOperatorX>(
+                _helper->obj_pool.get(), tnode, 0, state->desc_tbl());
+
+        auto build_side_source_operator = std::make_shared<MockSourceOperator>();
+        build_side_source_operator->_row_descriptor =
+                RowDescriptor(state->desc_tbl(), {1}, {false});
+        _probe_side_source_operator = std::make_shared<MockSourceOperator>();
+        _probe_side_source_operator->_row_descriptor =
+                RowDescriptor(state->desc_tbl(), {0}, {false});
+        auto probe_side_sink_operator = std::make_shared<MockSinkOperator>();
+
+        EXPECT_TRUE(_sink_operator->set_child(build_side_source_operator));
+        EXPECT_TRUE(_probe_operator->set_child(_probe_side_source_operator));
+        EXPECT_TRUE(_probe_operator->set_child(build_side_source_operator));
+
+        std::map<int, std::pair<std::shared_ptr<BasicSharedState>,
+                                std::vector<std::shared_ptr<Dependency>>>>
+                shared_state_map;
+        auto [source_pipeline, _] =
+                generate_sort_pipeline(_probe_operator, probe_side_sink_operator, _sink_operator,
+                                       build_side_source_operator);
+        _helper->pipeline_task = std::make_shared<PipelineTask>(source_pipeline, 0, state, nullptr,
+                                                                nullptr, shared_state_map, 0);
+
+        auto st = _probe_operator->init(tnode, state);
+        ASSERT_TRUE(st.ok()) << st.to_string();
+        st = _probe_operator->prepare(state);
+        ASSERT_TRUE(st.ok()) << st.to_string();
+        st = _sink_operator->init(tnode, state);
+        ASSERT_TRUE(st.ok()) << st.to_string();
+        st = _sink_operator->prepare(state);
+        ASSERT_TRUE(st.ok()) << st.to_string();
+
+        _shared_state = _sink_operator->create_shared_state();
+        LocalSinkStateInfo sink_local_state_info {.task_idx = 0,
+                                                  .parent_profile = _helper->runtime_profile.get(),
+                                                  .sender_id = 0,
+                                                  .shared_state = _shared_state.get(),
+                                                  .shared_state_map = {},
+                                                  .tsink = TDataSink()};
+        st = _sink_operator->setup_local_state(state, sink_local_state_info);
+        ASSERT_TRUE(st.ok()) << st.to_string();
+        st = state->get_sink_local_state()->open(state);
+        ASSERT_TRUE(st.ok()) << st.to_string();
+
+        LocalStateInfo info {.parent_profile = _helper->runtime_profile.get(),
+                             .scan_ranges = {},
+                             .shared_state = _shared_state.get(),
+                             .shared_state_map = {},
+                             .task_idx = 0};
+        st = _probe_operator->setup_local_state(state, info);
+        ASSERT_TRUE(st.ok()) << st.to_string();
+        _probe_local_state = assert_cast<NestedLoopJoinProbeLocalState*>(
+                state->get_local_state(_probe_operator->operator_id()));
+        st = _probe_local_state->open(state);
+        ASSERT_TRUE(st.ok()) << st.to_string();
+
+        for (const auto& rows : join_case.build_blocks) {
+            auto block = create_block(rows, join_case.build_nullable);
+            st = _sink_operator->sink(state, &block, false);
+            ASSERT_TRUE(st.ok()) << st.to_string();
+        }
+        Block empty_block;
+        st = _sink_operator->sink(state, &empty_block, true);
+        ASSERT_TRUE(st.ok()) << st.to_string();
+        st = _sink_operator->close(state, st);
+        ASSERT_TRUE(st.ok()) << st.to_string();
+    }
+
+    // Returns the sorted output rows, semi and anti joins only output the probe columns
+    std::vector<std::string> run_probe(const JoinCase& join_case) {
+        auto* state = _helper->runtime_state.get();
+        const int columns = is_left_semi_anti(join_case.join_op) ? 2 : 4;
+        std::vector<std::string> rows;
+        bool eos = false;
+        for (size_t i = 0; i < join_case.probe_blocks.size() && !eos; ++i) {
+            _probe_side_source_operator->set_block(
+                    create_block(join_case.probe_blocks[i], join_case.probe_nullable));
+            if (i + 1 == join_case.probe_blocks.size()) {
+                _probe_side_source_operator->set_eos();
+            }
+            do {
+                Block output_block;
+                auto st = _probe_operator->get_block(state, &output_block, &eos);
+                EXPECT_TRUE(st.ok()) << st.to_string();
+                if (!st.ok()) {
+                    return rows;
+                }
+                for (size_t row = 0; row < output_block.rows(); ++row) {
+                    rows.push_back(output_block.dump_one_line(row, columns));
+                }
+            } while (!eos && !_probe_operator->need_more_input_data(state));
+        }
+        EXPECT_TRUE(eos);
+        std::sort(rows.begin(), rows.end());
+        return rows;
+    }
+
+    // Runs the join with and without the band index, both must output the same rows as
+    // `reference_join()`. The operators of the run with the band index are kept for checks.
+    void check_join(const JoinCase& join_case) {
+        auto expected = reference_join(join_case);
+        for (bool enable_band_index : {false, true}) {
+            config::enable_nested_loop_join_band_index = enable_band_index;
+            create_operators(join_case);
+            if (HasFatalFailure()) {
+                return;
+            }
+            EXPECT_EQ(run_probe(join_case), expected)
+                    << "enable_nested_loop_join_band_index: " << enable_band_index;
+            if (enable_band_index) {
+                EXPECT_GE(_probe_operator->_band_key_column, 0);
+                EXPECT_GT(_probe_local_state->_band_skipped_rows_counter->value(), 0);
+            } else {
+                EXPECT_EQ(_probe_operator->_band_key_column, -1);
+                EXPECT_EQ(_probe_local_state->_band_skipped_rows_counter->value(), 0);
+            }
+        }
+    }
+
+    bool _enable_band_index = true;
+    std::mt19937 _rng;
+    std::unique_ptr<JoinTestHelper> _helper;
+    std::shared_ptr<NestedLoopJoinProbeOperatorX> _probe_operator;
+    std::shared_ptr<NestedLoopJoinBuildSinkOperatorX> _sink_operator;
+    std::shared_ptr<MockSourceOperator> _probe_side_source_operator;
+    std::shared_ptr<BasicSharedState> _shared_state;
+    NestedLoopJoinProbeLocalState* _probe_local_state = nullptr;
+};
+
+TEST_F(NestedLoopJoinProbeOperatorTest, KeyLowerBound) {
+    // s > a
+    check_join(create_join_case(TJoinOp::INNER_JOIN, {{"gt", true, 0, 0}}));
+    EXPECT_EQ(_probe_operator->_band_key_column, 0);
+    EXPECT_EQ(_probe_operator->_band_key_lower.probe_column, 0);
+    EXPECT_TRUE(_probe_operator->_band_key_lower.strict);
+    EXPECT_EQ(_probe_operator->_band_key_upper.probe_column, -1);
+
+    // a <= s
+    check_join(create_join_case(TJoinOp::INNER_JOIN, {{"le", false, 0, 0}}));
+    EXPECT_EQ(_probe_operator->_band_key_lower.probe_column, 0);
+    EXPECT_FALSE(_probe_operator->_band_key_lower.strict);
+    EXPECT_EQ(_probe_operator->_band_key_upper.probe_column, -1);
+}
+
+TEST_F(NestedLoopJoinProbeOperatorTest, KeyUpperBound) {
+    // s < a
+    check_join(create_join_case(TJoinOp::INNER_JOIN, {{"lt", true, 0, 0}}));
+    EXPECT_EQ(_probe_operator->_band_key_upper.probe_column, 0);
+    EXPECT_TRUE(_probe_operator->_band_key_upper.strict);
+    EXPECT_EQ(_probe_operator->_band_key_lower.probe_column, -1);
+
+    // a >= e
+    check_join(create_join_case(TJoinOp::INNER_JOIN, {{"ge", false, 0, 1}}));
+    EXPECT_EQ(_probe_operator->_band_key_column, 1);
+    EXPECT_EQ(_probe_operator->_band_key_upper.probe_column, 0);
+    EXPECT_FALSE(_probe_operator->_band_key_upper.strict);
+    EXPECT_EQ(_probe_operator->_band_key_lower.probe_column, -1);
+}
+
+TEST_F(NestedLoopJoinProbeOperatorTest, KeyBothBounds) {
+    // s >= a AND s <= c
+    check_join(create_join_case(TJoinOp::INNER_JOIN, {{"ge", true, 0, 0}, {"le", true, 1, 0}}));
+    EXPECT_EQ(_probe_operator->_band_key_lower.probe_column, 0);
+    EXPECT_FALSE(_probe_operator->_band_key_lower.strict);
+    EXPECT_EQ(_probe_operator->_band_key_upper.probe_column, 1);
+    EXPECT_FALSE(_probe_operator->_band_key_upper.strict);
+    // a key bounded on both sides does not use the other column
+    EXPECT_EQ(_probe_operator->_band_other_column, -1);
+
+    // a < s AND c > s AND e > a, the predicate on `e` is only evaluated by the conjuncts
+    check_join(create_join_case(TJoinOp::INNER_JOIN,
+                                {{"lt", false, 0, 0}, {"gt", false, 1, 0}, {"gt", true, 0, 1}}));
+    EXPECT_TRUE(_probe_operator->_band_key_lower.strict);
+    EXPECT_TRUE(_probe_operator->_band_key_upper.strict);
+    EXPECT_EQ(_probe_operator->_band_other_column, -1);
+}
+
+TEST_F(NestedLoopJoinProbeOperatorTest, OtherColumnPrefixMax) {
+    // s <= a AND e >= a, like `a BETWEEN s AND e`
+    const std::vector<BandPredicate> predicates {{"le", true, 0, 0}, {"ge", true, 0, 1}};
+    check_join(create_join_case(TJoinOp::INNER_JOIN, predicates));
+    EXPECT_EQ(_probe_operator->_band_key_column, 0);
+    EXPECT_EQ(_probe_operator->_band_key_upper.probe_column, 0);
+    EXPECT_EQ(_probe_operator->_band_other_column, 1);
+    EXPECT_FALSE(_probe_operator->_band_other_bound.strict);
+
+    // s < a AND e > c
+    check_join(create_join_case(TJoinOp::LEFT_OUTER_JOIN,
+                                {{"lt", true, 0, 0}, {"gt", true, 1, 1}}));
+    EXPECT_EQ(_probe_operator->_band_other_column, 1);
+    EXPECT_EQ(_probe_operator->_band_other_bound.probe_column, 1);
+    EXPECT_TRUE(_probe_operator->_band_other_bound.strict);
+}
+
+TEST_F(NestedLoopJoinProbeOperatorTest, OtherColumnSuffixMin) {
+    // s >= a AND e <= c
+    check_join(create_join_case(TJoinOp::INNER_JOIN, {{"ge", true, 0, 0}, {"le", true, 1, 1}}));
+    EXPECT_EQ(_probe_operator->_band_key_lower.probe_column, 0);
+    EXPECT_EQ(_probe_operator->_band_key_upper.probe_column, -1);
+    EXPECT_EQ(_probe_operator->_band_other_column, 1);
+    EXPECT_EQ(_probe_operator->_band_other_bound.probe_column, 1);
+    EXPECT_FALSE(_probe_operator->_band_other_bound.strict);
+
+    // a < s AND c > e
+    check_join(create_join_case(TJoinOp::LEFT_ANTI_JOIN,
+                                {{"lt", false, 0, 0}, {"gt", false, 1, 1}}));
+    EXPECT_EQ(_probe_operator->_band_other_column, 1);
+    EXPECT_TRUE(_probe_operator->_band_other_bound.strict);
+}
+
+TEST_F(NestedLoopJoinProbeOperatorTest, NullableColumns) {
+    const std::vector<BandPredicate> predicates {{"le", true, 0, 0}, {"ge", true, 0, 1}};
+    for (auto join_op : {TJoinOp::INNER_JOIN, TJoinOp::LEFT_OUTER_JOIN, TJoinOp::LEFT_SEMI_JOIN,
+                         TJoinOp::LEFT_ANTI_JOIN}) {
+        check_join(create_join_case(join_op, predicates, true, false));
+        check_join(create_join_case(join_op, predicates, false, true));
+        check_join(create_join_case(join_op, predicates, true, true));
+    }
+}
+
+TEST_F(NestedLoopJoinProbeOperatorTest, LeftJoinsWithUnmatchedProbeRows) {
+    // s > a AND s < c, the probe rows with a >= c or a >= 19 match no build row
+    const std::vector<BandPredicate> predicates {{"gt", true, 0, 0}, {"lt", true, 1, 0}};
+    for (auto join_op :
+         {TJoinOp::LEFT_OUTER_JOIN, TJoinOp::LEFT_SEMI_JOIN, TJoinOp::LEFT_ANTI_JOIN}) {
+        auto join_case = create_join_case(join_op, predicates);
+        join_case.probe_blocks.push_back({{19, 30}, {5, 5}, {-10, 0}, {3, 6}});
+        // a probe block whose rows all match no build row
+        join_case.probe_blocks.push_back({{25, 30}, {-5, -1}});
+        check_join(join_case);
+    }
+}
+
+TEST_F(NestedLoopJoinProbeOperatorTest, ConstAndNullProbeColumn) {
+    config::enable_nested_loop_join_band_index = true;
+    // s <= a AND e >= a
+    auto join_case = create_join_case(TJoinOp::INNER_JOIN, {{"le", true, 0, 0}, {"ge", true, 0, 1}},
+                                      true, false);
+    create_operators(join_case);
+    ASSERT_FALSE(HasFatalFailure());
+    _probe_local_state->_build_band_indexes();
+    ASSERT_EQ(_probe_local_state->_band_indexes.size(), 3U);
+
+    auto& child_block = *_probe_local_state->_child_block;
+    auto set_probe_column = [&](ColumnWithTypeAndName column) {
+        child_block = Block({column, create_int_column({1, 2, 3}, true)});
+    };
+    for (const auto& index : _probe_local_state->_band_indexes) {
+        for (int32_t value : {-1, 0, 7, 19, 25}) {
+            set_probe_column(create_int_column({0, 1, value}, true));
+            _probe_local_state->_left_block_pos = 2;
+            auto expected = _probe_local_state->_band_matched_range(index);
+
+            // a const probe column uses its only row for every probe row
+            auto const_column = create_int_column({value}, true);
+            const_column.column = ColumnConst::create(const_column.column, 3);
+            set_probe_column(const_column);
+            for (int pos = 0; pos < 3; ++pos) {
+                _probe_local_state->_left_block_pos = pos;
+                EXPECT_EQ(_probe_local_state->_band_matched_range(index), expected);
+            }
+        }
+
+        // a null probe value matches nothing
+        set_probe_column(create_int_column({7, std::nullopt, 7}, true));
+        _probe_local_state->_left_block_pos = 1;
+        auto range = _probe_local_state->_band_matched_range(index);
+        EXPECT_EQ(range.first, range.second);
+    }
+}
+
+TEST_F(NestedLoopJoinProbeOperatorTest, NotUsedWithBuildSideFlags) {
+    config::enable_nested_loop_join_band_index = true;
+    for (auto join_op : {TJoinOp::RIGHT_OUTER_JOIN, TJoinOp::FULL_OUTER_JOIN,
+                         TJoinOp::RIGHT_SEMI_JOIN, TJoinOp::RIGHT_ANTI_JOIN}) {
+        create_operators(create_join_case(join_op, {{"le", true, 0, 0}}));
+        ASSERT_FALSE(HasFatalFailure());
+        EXPECT_EQ(_probe_operator->_band_key_column, -1);
+    }
+}
+
+} // namespace doris::pipeline
@@ -20,6 +20,7 @@
 #include <gtest/gtest.h>
 
 #include <algorithm>
+#include <map>
 #include <memory>
 
 #include "pipeline/exec/partition_sort_source_operator.h"
@@ -29,6 +30,7 @@
 #include "testutil/mock/mock_runtime_state.h"
 #include "testutil/mock/mock_slot_ref.h"
 #include "vec/core/block.h"
+#include "vec/spill/spill_stream_manager.h"
 namespace doris::pipeline {
 
 using namespace vectorized;
@@ -60,6 +62,59 @@ struct PartitionSortOperatorTest : public ::testing::Test {
         _child_op = std::make_unique<PartitionSortOperatorMockOperator>();
     }
 
+    void TearDown() override {
+        if (_spill_stream_mgr_inited) {
+            ExecEnv::GetInstance()->spill_stream_mgr()->async_cleanup_query(state->query_id());
+            ExecEnv::GetInstance()->spill_stream_mgr()->get_spill_io_thread_pool()->wait();
+            ExecEnv::GetInstance()->spill_stream_mgr()->stop();
+            SAFE_DELETE(ExecEnv::GetInstance()->_spill_stream_mgr);
+        }
+    }
+
+    void init_spill_stream_mgr() {
+        auto spill_data_dir = std::make_unique<vectorized::SpillDataDir>(
+                "./ut_dir/partition_sort_spill_test", 1024L * 1024 * 4);
+        EXPECT_TRUE(io::global_local_filesystem()
+                            ->create_directory(spill_data_dir->path(), false)
+                            .ok());
+        std::unordered_map<std::string, std::unique_ptr<vectorized::SpillDataDir>> data_map;
+        data_map.emplace("test", std::move(spill_data_dir));
+        auto* spill_stream_mgr = new vectorized::SpillStreamManager(std::move(data_map));
+        ExecEnv::GetInstance()->_spill_stream_mgr = spill_stream_mgr;
+        EXPECT_TRUE(spill_stream_mgr->init().ok());
+        _spill_stream_mgr_inited = true;
+    }
+
+    static void wait_for(Dependency* dependency) {
+        while (dependency->is_blocked_by(nullptr) != nullptr) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+    }
+
+    // sinks 8192 rows of 7 and 10 rows of 9, revokes the partition of 7 and sinks eos
+    void sink_with_spill() {
+        init_spill_stream_mgr();
+        test_for_sink_and_source(1, false, -1);
+        state->set_enable_spill(true);
+
+        std::vector<int64_t> data(8192, 7);
+        data.insert(data.end(), 10, 9);
+        Block block = ColumnHelper::create_block<DataTypeInt64>(data);
+        EXPECT_TRUE(sink->sink(state.get(), &block, false).ok());
+        EXPECT_GE(sink->revocable_mem_size(state.get()),
+                  vectorized::SpillStream::MIN_SPILL_WRITE_BATCH_MEM);
+        EXPECT_TRUE(sink->revoke_memory(state.get(), nullptr).ok());
+        wait_for(sink_local_state->_spill_dependency.get());
+        EXPECT_EQ(sink->revocable_mem_size(state.get()), 0);
+        EXPECT_EQ(sink_local_state->_spilled_partitions_counter->value(), 1);
+
+        Block block2 = ColumnHelper::create_block<DataTypeInt64>({7, 7, 9});
+        EXPECT_TRUE(sink->sink(state.get(), &block2, true).ok());
+        wait_for(sink_local_state->_spill_dependency.get());
+    }
+
+    bool _spill_stream_mgr_inited = false;
+
     RuntimeProfile profile {"test"};
     std::unique_ptr<PartitionSortSinkOperatorX> sink;
     std::unique_ptr<PartitionSortSourceOperatorX> source;
@@ -232,6 +287,78 @@ TEST_F(PartitionSortOperatorTest, test_one_partition) {
     test_partition_sort(partition_exprs_num, topn_num);
 }
 
+TEST_F(PartitionSortOperatorTest, test_revocable_mem_size) {
+    test_for_sink_and_source(1, false, -1);
+    std::vector<int64_t> data(8192, 7);
+
+    state->set_enable_spill(false);
+    Block block = ColumnHelper::create_block<DataTypeInt64>(data);
+    EXPECT_TRUE(sink->sink(state.get(), &block, false).ok());
+    EXPECT_EQ(sink->revocable_mem_size(state.get()), 0);
+
+    state->set_enable_spill(true);
+    Block block2 = ColumnHelper::create_block<DataTypeInt64>(data);
+    EXPECT_TRUE(sink->sink(state.get(), &block2, false).ok());
+    EXPECT_GE(sink->revocable_mem_size(state.get()),
+              vectorized::SpillStream::MIN_SPILL_WRITE_BATCH_MEM);
+}
+
+TEST_F(PartitionSortOperatorTest, test_revoke_and_read_back) {
+    sink_with_spill();
+    auto partition_sort_state =
+            std::static_pointer_cast<PartitionSortNodeSharedState>(shared_state);
+    ASSERT_EQ(partition_sort_state->spill_streams.size(), 2);
+    EXPECT_TRUE(partition_sort_state->spill_streams[0] != nullptr);
+    EXPECT_TRUE(partition_sort_state->spill_streams[1] == nullptr);
+
+    std::map<int64_t, size_t> rows;
+    bool eos = false;
+    while (!eos) {
+        if (!is_ready(source_local_state->dependencies())) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            continue;
+        }
+        Block output_block;
+        ASSERT_TRUE(source->get_block(state.get(), &output_block, &eos).ok());
+        wait_for(source_local_state->_spill_dependency.get());
+        for (size_t i = 0; i < output_block.rows(); ++i) {
+            ++rows[output_block.get_by_position(0).column->get_int(i)];
+        }
+    }
+    std::map<int64_t, size_t> expected {{7, 8194}, {9, 11}};
+    EXPECT_EQ(rows, expected);
+    // the stream is deleted once read back
+    EXPECT_TRUE(partition_sort_state->spill_streams[0] == nullptr);
+}
+
+TEST_F(PartitionSortOperatorTest, test_close_deletes_spill_streams) {
+    sink_with_spill();
+    auto partition_sort_state =
+            std::static_pointer_cast<PartitionSortNodeSharedState>(shared_state);
+    ASSERT_TRUE(partition_sort_state->spill_streams[0] != nullptr);
+
+    // cancelled before the source reads the spilled partition back
+    EXPECT_TRUE(sink_local_state->close(state.get(), Status::Cancelled("cancelled")).ok());
+    EXPECT_TRUE(partition_sort_state->is_closed);
+    EXPECT_TRUE(partition_sort_state->spill_streams[0] == nullptr);
+    EXPECT_TRUE(source_local_state->close(state.get()).ok());
+}
+
+TEST_F(PartitionSortOperatorTest, test_close_before_eos_deletes_spill_streams) {
+    init_spill_stream_mgr();
+    test_for_sink_and_source(1, false, -1);
+    state->set_enable_spill(true);
+    Block block = ColumnHelper::create_block<DataTypeInt64>(std::vector<int64_t>(8192, 7));
+    EXPECT_TRUE(sink->sink(state.get(), &block, false).ok());
+    EXPECT_TRUE(sink->revoke_memory(state.get(), nullptr).ok());
+    wait_for(sink_local_state->_spill_dependency.get());
+    auto* partition = sink_local_state->_value_places[0];
+    ASSERT_TRUE(partition->_spill_stream != nullptr);
+
+    EXPECT_TRUE(sink_local_state->close(state.get(), Status::Cancelled("cancelled")).ok());
+    EXPECT_TRUE(partition->_spill_stream == nullptr);
+}
+
 TEST_F(PartitionSortOperatorTest, TestWithoutKey) {
     std::vector<vectorized::DataTypePtr> types {std::make_shared<vectorized::DataTypeInt32>()};
     std::unique_ptr<PartitionedHashMapVariants> _variants =
@@ -21,8 +21,11 @@
 #include <memory>
 
 #include "pipeline/exec/cache_sink_operator.h"
+#include "olap/tablet_schema.h"
 #include "pipeline/exec/cache_source_operator.h"
 #include "pipeline/exec/repeat_operator.h"
+#include "runtime/descriptor_helper.h"
+#include "runtime/descriptors.h"
 #include "testutil/column_helper.h"
 #include "testutil/mock/mock_descriptors.h"
 #include "testutil/mock/mock_runtime_state.h"
@@ -270,4 +273,224 @@ TEST_F(QueryCacheOperatorTest, test_hit_cache) {
     query_cache_uptr.release();
 }
 
-} // namespace doris::pipeline
\ No newline at end of file
+TEST_F(QueryCacheOperatorTest, test_incremental_hit_cache) {
+    sink = std::make_unique<CacheSinkOperatorX>();
+    source = std::make_unique<CacheSourceOperatorX>();
+    EXPECT_TRUE(source->set_child(child_op));
+    child_op->_mock_row_desc.reset(
+            new MockRowDescriptor {{std::make_shared<vectorized::DataTypeInt64>()}, &pool});
+    TQueryCacheParam cache_param;
+    cache_param.node_id = 0;
+    cache_param.output_slot_mapping[0] = 0;
+    cache_param.tablet_to_range.insert({42, "test"});
+    cache_param.force_refresh_query_cache = false;
+    cache_param.entry_max_bytes = 1024 * 1024;
+    cache_param.entry_max_rows = 1000;
+
+    int64_t version = 0;
+    std::string cache_key;
+    EXPECT_TRUE(QueryCache::build_cache_key(scan_ranges, cache_param, &cache_key, &version));
+    {
+        // the cache holds the result of the previous version
+        CacheResult result;
+        result.push_back(std::make_unique<Block>());
+        *result.back() = ColumnHelper::create_block<DataTypeInt64>({1, 2, 3});
+        query_cache->insert(cache_key, version - 1, result, {0}, 1);
+    }
+    // the tablet check needs a real tablet, register the incremental decision directly
+    state->get_query_ctx()->get_or_create_query_cache_lookup(cache_key, [&]() {
+        auto lookup = std::make_shared<QueryCacheLookup>();
+        EXPECT_TRUE(query_cache->lookup(cache_key, version - 1, &lookup->handle));
+        lookup->delta_start_version = version;
+        return lookup;
+    });
+
+    source->_cache_param = cache_param;
+    create_local_state();
+    EXPECT_EQ(source_local_state->_hit_cache_results, nullptr);
+    EXPECT_NE(source_local_state->_delta_base_results, nullptr);
+
+    {
+        auto block = ColumnHelper::create_block<DataTypeInt64>({4, 5});
+        auto st = sink->sink(state.get(), &block, true);
+        EXPECT_TRUE(st.ok()) << st.msg();
+    }
+    {
+        Block block;
+        bool eos = false;
+        auto st = source->get_block(state.get(), &block, &eos);
+        EXPECT_TRUE(st.ok()) << st.msg();
+        EXPECT_FALSE(eos);
+        EXPECT_TRUE(ColumnHelper::block_equal(
+                block, ColumnHelper::create_block<DataTypeInt64>({1, 2, 3})));
+    }
+    {
+        Block block;
+        bool eos = false;
+        auto st = source->get_block(state.get(), &block, &eos);
+        EXPECT_TRUE(st.ok()) << st.msg();
+        EXPECT_TRUE(eos);
+        EXPECT_TRUE(ColumnHelper::block_equal(
+                block, ColumnHelper::create_block<DataTypeInt64>({4, 5})));
+    }
+
+    // the entry now holds the combined result of the new version
+    QueryCacheHandle handle;
+    EXPECT_TRUE(query_cache->lookup(cache_key, version, &handle));
+    size_t rows = 0;
+    for (const auto& block : *handle.get_cache_result()) {
+        rows += block->rows();
+    }
+    EXPECT_EQ(rows, 5);
+
+    query_cache_uptr.release();
+}
+
+TEST_F(QueryCacheOperatorTest, test_mergeable_aggregation) {
+    // slot i reads column i of the schema below
+    std::vector<std::string> names {"k", "v_sum", "v_max", "v_bitmap", "v_replace"};
+    TDescriptorTableBuilder table_builder;
+    TTupleDescriptorBuilder tuple_builder;
+    for (const auto& name : names) {
+        tuple_builder.add_slot(
+                TSlotDescriptorBuilder().type(TYPE_BIGINT).column_name(name).build());
+    }
+    tuple_builder.build(&table_builder);
+    DescriptorTbl* descs = nullptr;
+    EXPECT_TRUE(DescriptorTbl::create(&pool, table_builder.desc_tbl(), &descs).ok());
+
+    auto make_column = [](const std::string& name, bool is_key, FieldAggregationMethod agg) {
+        TabletColumn column;
+        column.set_name(name);
+        column.set_is_key(is_key);
+        column.set_aggregation_method(agg);
+        return column;
+    };
+    TabletSchema schema;
+    schema.append_column(
+            make_column("k", true, FieldAggregationMethod::OLAP_FIELD_AGGREGATION_NONE));
+    schema.append_column(
+            make_column("v_sum", false, FieldAggregationMethod::OLAP_FIELD_AGGREGATION_SUM));
+    schema.append_column(
+            make_column("v_max", false, FieldAggregationMethod::OLAP_FIELD_AGGREGATION_MAX));
+    schema.append_column(make_column("v_bitmap", false,
+                                     FieldAggregationMethod::OLAP_FIELD_AGGREGATION_BITMAP_UNION));
+    schema.append_column(make_column("v_replace", false,
+                                     FieldAggregationMethod::OLAP_FIELD_AGGREGATION_REPLACE));
+
+    auto slot_ref = [](SlotId id) {
+        TExprNode node;
+        node.node_type = TExprNodeType::SLOT_REF;
+        node.num_children = 0;
+        node.slot_ref.slot_id = id;
+        TExpr expr;
+        expr.nodes.push_back(node);
+        return expr;
+    };
+    auto agg_function = [&](const std::string& name, std::vector<SlotId> args) {
+        TExpr expr;
+        expr.nodes.emplace_back();
+        expr.nodes[0].node_type = TExprNodeType::AGG_EXPR;
+        expr.nodes[0].fn.name.function_name = name;
+        expr.nodes[0].num_children = static_cast<int>(args.size());
+        for (auto id : args) {
+            expr.nodes.push_back(slot_ref(id).nodes[0]);
+        }
+        return expr;
+    };
+    auto merge_info_of = [&](std::vector<TExpr> functions, std::vector<SlotId> group_by) {
+        TPlanNode agg_node;
+        agg_node.node_type = TPlanNodeType::AGGREGATION_NODE;
+        agg_node.agg_node.need_finalize = false;
+        agg_node.agg_node.aggregate_functions = std::move(functions);
+        for (auto id : group_by) {
+            agg_node.agg_node.grouping_exprs.push_back(slot_ref(id));
+        }
+        return QueryCacheMergeInfo::create(agg_node, *descs);
+    };
+
+    // each function repeats the aggregation of its column, grouped by the key
+    auto merge_info = merge_info_of({agg_function("sum", {1}), agg_function("max", {2}),
+                                     agg_function("min", {0}), agg_function("bitmap_union", {3})},
+                                    {0});
+    EXPECT_TRUE(merge_info.partial_states);
+    ASSERT_EQ(merge_info.agg_functions.size(), 4);
+    EXPECT_EQ(merge_info.agg_functions[0].name, "sum");
+    EXPECT_EQ(merge_info.agg_functions[0].column, "v_sum");
+    EXPECT_EQ(merge_info.group_by_columns, std::vector<std::string> {"k"});
+    EXPECT_TRUE(QueryCache::has_mergeable_aggregation(schema, merge_info));
+
+    // a filter on the key keeps it, a filter on a value sees the merged value only
+    TPlanNode scan_node;
+    scan_node.node_type = TPlanNodeType::OLAP_SCAN_NODE;
+    scan_node.conjuncts.push_back(slot_ref(0));
+    auto filtered = merge_info;
+    filtered.add_scan_node(scan_node, *descs);
+    EXPECT_TRUE(QueryCache::has_mergeable_aggregation(schema, filtered));
+    scan_node.conjuncts.push_back(slot_ref(1));
+    filtered = merge_info;
+    filtered.add_scan_node(scan_node, *descs);
+    EXPECT_FALSE(QueryCache::has_mergeable_aggregation(schema, filtered));
+
+    // count(*) counts a key merged from an old and a new rowset once
+    EXPECT_FALSE(QueryCache::has_mergeable_aggregation(
+            schema, merge_info_of({agg_function("count", {})}, {0})));
+    EXPECT_FALSE(QueryCache::has_mergeable_aggregation(
+            schema, merge_info_of({agg_function("count", {1})}, {0})));
+    // min of a SUM column differs before and after the merge
+    EXPECT_FALSE(QueryCache::has_mergeable_aggregation(
+            schema, merge_info_of({agg_function("min", {1})}, {0})));
+    EXPECT_FALSE(QueryCache::has_mergeable_aggregation(
+            schema, merge_info_of({agg_function("sum", {2})}, {0})));
+    // a replaced value depends on which rowset holds the latest row of the key
+    EXPECT_FALSE(QueryCache::has_mergeable_aggregation(
+            schema, merge_info_of({agg_function("max", {4})}, {0})));
+    // groups of a value column are split differently by the merge
+    EXPECT_FALSE(QueryCache::has_mergeable_aggregation(
+            schema, merge_info_of({agg_function("sum", {1})}, {2})));
+
+    TPlanNode finalized;
+    finalized.node_type = TPlanNodeType::AGGREGATION_NODE;
+    finalized.agg_node.need_finalize = true;
+    finalized.agg_node.aggregate_functions.push_back(agg_function("sum", {1}));
+    EXPECT_FALSE(QueryCache::has_mergeable_aggregation(
+            schema, QueryCacheMergeInfo::create(finalized, *descs)));
+}
+
+TEST_F(QueryCacheOperatorTest, test_incremental_needs_partial_states) {
+    DescriptorTbl* descs = nullptr;
+    EXPECT_TRUE(DescriptorTbl::create(&pool, TDescriptorTable {}, &descs).ok());
+    TPlanNode agg_node;
+    agg_node.node_type = TPlanNodeType::AGGREGATION_NODE;
+    agg_node.agg_node.need_finalize = false;
+    auto partial = QueryCacheMergeInfo::create(agg_node, *descs);
+    EXPECT_TRUE(partial.partial_states);
+
+    // finalized results, e.g. an avg, can not be emitted next to the ones of the new rowsets
+    agg_node.agg_node.need_finalize = true;
+    auto finalized = QueryCacheMergeInfo::create(agg_node, *descs);
+    EXPECT_FALSE(finalized.partial_states);
+    EXPECT_FALSE(QueryCache::can_scan_incrementally(42, 1, 2, finalized));
+
+    TQueryCacheParam cache_param;
+    cache_param.node_id = 0;
+    cache_param.output_slot_mapping[0] = 0;
+    cache_param.tablet_to_range.insert({42, "test"});
+    int64_t version = 0;
+    std::string cache_key;
+    EXPECT_TRUE(QueryCache::build_cache_key(scan_ranges, cache_param, &cache_key, &version));
+    {
+        CacheResult result;
+        result.push_back(std::make_unique<Block>());
+        *result.back() = ColumnHelper::create_block<DataTypeInt64>({1, 2, 3});
+        query_cache->insert(cache_key, version - 1, result, {0}, 1);
+    }
+    QueryCacheLookup lookup;
+    query_cache->lookup_incremental(cache_key, 42, version, finalized, &lookup);
+    EXPECT_FALSE(lookup.hit);
+    EXPECT_EQ(lookup.delta_start_version, 0);
+
+    query_cache_uptr.release();
+}
+
+} // namespace doris::pipeline
@@ -19,18 +19,26 @@
 
 #include <gtest/gtest.h>
 
+#include <filesystem>
 #include <limits>
 #include <memory>
+#include <numeric>
 
+#include "cloud/config.h"
 #include "common/config.h"
+#include "io/fs/local_file_system.h"
+#include "io/fs/remote_file_system.h"
 #include "pipeline/dependency.h"
 #include "pipeline/exec/operator.h"
 #include "runtime/exec_env.h"
 #include "spill_sort_test_helper.h"
 #include "testutil/column_helper.h"
 #include "testutil/mock/mock_runtime_state.h"
+#include "util/defer_op.h"
 #include "vec/core/block.h"
 #include "vec/data_types/data_type_number.h"
+#include "vec/spill/spill_stream.h"
+#include "vec/spill/spill_stream_manager.h"
 
 namespace doris::pipeline {
 class SpillSortSourceOperatorTest : public testing::Test {
@@ -576,4 +584,199 @@ TEST_F(SpillSortSourceOperatorTest, GetBlockWithSpillError) {
     ASSERT_TRUE(st.ok()) << "close failed: " << st.to_string();
 }
 
-} // namespace doris::pipeline
\ No newline at end of file
+// Small blocks are buffered before they are written, and read back through read-ahead windows
+// which hold a few blocks each.
+TEST_F(SpillSortSourceOperatorTest, SpillStreamBufferedIo) {
+    auto origin_write_buffer = config::spill_write_buffer_bytes;
+    auto origin_read_ahead = config::spill_read_ahead_bytes;
+    Defer defer {[&]() {
+        config::spill_write_buffer_bytes = origin_write_buffer;
+        config::spill_read_ahead_bytes = origin_read_ahead;
+    }};
+    config::spill_write_buffer_bytes = 256;
+    config::spill_read_ahead_bytes = 256;
+
+    vectorized::SpillStreamSPtr spill_stream;
+    auto st = ExecEnv::GetInstance()->spill_stream_mgr()->register_spill_stream(
+            _helper.runtime_state.get(), spill_stream, print_id(_helper.runtime_state->query_id()),
+            "SpillStreamBufferedIo", 0, 10, std::numeric_limits<int32_t>::max(),
+            _helper.operator_profile.get());
+    ASSERT_TRUE(st.ok()) << "register_spill_stream failed: " << st.to_string();
+    auto* data_dir = spill_stream->get_data_dir();
+    const auto written_before = data_dir->spill_disk_write_bytes->value();
+    const auto read_before = data_dir->spill_disk_read_bytes->value();
+
+    // every input block is spilled as blocks of 10 rows
+    const int num_input_blocks = 5;
+    for (int i = 0; i != num_input_blocks; ++i) {
+        std::vector<int32_t> data;
+        for (int j = 0; j != 100; ++j) {
+            data.emplace_back(i * 100 + j);
+        }
+        auto input_block = vectorized::ColumnHelper::create_block<vectorized::DataTypeInt32>(data);
+        st = spill_stream->spill_block(_helper.runtime_state.get(), input_block,
+                                       i == num_input_blocks - 1);
+        ASSERT_TRUE(st.ok()) << "spill_block failed: " << st.to_string();
+    }
+
+    std::vector<int32_t> values;
+    bool eos = false;
+    while (!eos) {
+        vectorized::Block block;
+        st = spill_stream->read_next_block_sync(&block, &eos);
+        ASSERT_TRUE(st.ok()) << "read_next_block_sync failed: " << st.to_string();
+        if (block.rows() > 0) {
+            ASSERT_EQ(block.rows(), 10);
+            const auto& column = assert_cast<const vectorized::ColumnInt32&>(
+                    *block.get_by_position(0).column);
+            values.insert(values.end(), column.get_data().begin(), column.get_data().end());
+        }
+    }
+    ASSERT_EQ(values.size(), num_input_blocks * 100);
+    for (int i = 0; i != num_input_blocks * 100; ++i) {
+        EXPECT_EQ(values[i], i);
+    }
+
+    // the blocks are read once each, only the meta written after them is not read ahead
+    const auto written = data_dir->spill_disk_write_bytes->value() - written_before;
+    const auto read = data_dir->spill_disk_read_bytes->value() - read_before;
+    EXPECT_GT(read, 0);
+    EXPECT_LT(read, written);
+    EXPECT_NE(data_dir->debug_string().find("read bandwidth"), std::string::npos);
+}
+
+// A remote file system that keeps its files under a local root path.
+class LocalBackedRemoteFileSystem : public io::RemoteFileSystem {
+public:
+    explicit LocalBackedRemoteFileSystem(io::Path root_path)
+            : RemoteFileSystem(std::move(root_path), "spill_remote_test", io::FileSystemType::S3),
+              _local_fs(io::global_local_filesystem()) {}
+
+protected:
+    Status create_file_impl(const io::Path& path, io::FileWriterPtr* writer,
+                            const io::FileWriterOptions* opts) override {
+        return _local_fs->create_file(path, writer, opts);
+    }
+    Status open_file_internal(const io::Path& file, io::FileReaderSPtr* reader,
+                              const io::FileReaderOptions& opts) override {
+        return _local_fs->open_file(file, reader, &opts);
+    }
+    Status create_directory_impl(const io::Path& dir, bool failed_if_exists) override {
+        return _local_fs->create_directory(dir, failed_if_exists);
+    }
+    Status delete_file_impl(const io::Path& file) override { return _local_fs->delete_file(file); }
+    Status batch_delete_impl(const std::vector<io::Path>& files) override {
+        return _local_fs->batch_delete(files);
+    }
+    Status delete_directory_impl(const io::Path& dir) override {
+        return _local_fs->delete_directory(dir);
+    }
+    Status exists_impl(const io::Path& path, bool* res) const override {
+        return _local_fs->exists(path, res);
+    }
+    Status file_size_impl(const io::Path& file, int64_t* file_size) const override {
+        return _local_fs->file_size(file, file_size);
+    }
+    Status list_impl(const io::Path& dir, bool only_file, std::vector<io::FileInfo>* files,
+                     bool* exists) override {
+        return _local_fs->list(dir, only_file, files, exists);
+    }
+    Status rename_impl(const io::Path& orig_name, const io::Path& new_name) override {
+        return _local_fs->rename(orig_name, new_name);
+    }
+    Status upload_impl(const io::Path& local_file, const io::Path& remote_file) override {
+        return _local_fs->copy_path(local_file, remote_file);
+    }
+    Status batch_upload_impl(const std::vector<io::Path>& local_files,
+                             const std::vector<io::Path>& remote_files) override {
+        for (size_t i = 0; i != local_files.size(); ++i) {
+            RETURN_IF_ERROR(upload_impl(local_files[i], remote_files[i]));
+        }
+        return Status::OK();
+    }
+    Status download_impl(const io::Path& remote_file, const io::Path& local_file) override {
+        return _local_fs->copy_path(remote_file, local_file);
+    }
+
+private:
+    std::shared_ptr<io::LocalFileSystem> _local_fs;
+};
+
+TEST_F(SpillSortSourceOperatorTest, SpillToRemoteStorageWhenLocalDisksFull) {
+    auto origin_enable_remote = config::enable_spill_to_remote_storage;
+    auto origin_deploy_mode = config::deploy_mode;
+    Defer defer {[&]() {
+        config::enable_spill_to_remote_storage = origin_enable_remote;
+        config::deploy_mode = origin_deploy_mode;
+    }};
+    auto* spill_stream_mgr = ExecEnv::GetInstance()->spill_stream_mgr();
+    for (auto& [_, store] : spill_stream_mgr->_spill_store_map) {
+        store->_spill_data_bytes = store->_spill_data_limit_bytes + 1;
+    }
+
+    const auto query_id = print_id(_helper.runtime_state->query_id());
+    vectorized::SpillStreamSPtr spill_stream;
+    auto st = spill_stream_mgr->register_spill_stream(
+            _helper.runtime_state.get(), spill_stream, query_id, "SpillToRemoteStorage", 0, 10,
+            std::numeric_limits<int32_t>::max(), _helper.operator_profile.get());
+    ASSERT_FALSE(st.ok()) << "local spill disks are full and remote spill is disabled";
+
+    config::enable_spill_to_remote_storage = true;
+    config::deploy_mode = "cloud";
+    const auto remote_root =
+            std::filesystem::absolute("./ut_dir/spill_remote_test").lexically_normal();
+    st = io::global_local_filesystem()->delete_directory(remote_root);
+    ASSERT_TRUE(st.ok()) << st.to_string();
+    // the storage vault fs is only looked up when the remote dir is not created yet
+    spill_stream_mgr->_remote_spill_store = std::make_unique<vectorized::SpillDataDir>(
+            std::make_shared<LocalBackedRemoteFileSystem>(remote_root), "spill_overflow/test");
+    st = spill_stream_mgr->_remote_spill_store->init();
+    ASSERT_TRUE(st.ok()) << st.to_string();
+
+    st = spill_stream_mgr->register_spill_stream(
+            _helper.runtime_state.get(), spill_stream, query_id, "SpillToRemoteStorage", 0, 10,
+            std::numeric_limits<int32_t>::max(), _helper.operator_profile.get());
+    ASSERT_TRUE(st.ok()) << "register_spill_stream failed: " << st.to_string();
+    ASSERT_TRUE(spill_stream->get_data_dir()->is_remote());
+    ASSERT_EQ(spill_stream->get_data_dir(), spill_stream_mgr->_remote_spill_store.get());
+
+    auto* io_context = _helper.runtime_state->get_query_ctx()->resource_ctx()->io_context();
+    const auto local_written_before = io_context->spill_write_bytes_to_local_storage();
+    std::vector<int32_t> data(100);
+    std::iota(data.begin(), data.end(), 0);
+    auto input_block = vectorized::ColumnHelper::create_block<vectorized::DataTypeInt32>(data);
+    st = spill_stream->spill_block(_helper.runtime_state.get(), input_block, true);
+    ASSERT_TRUE(st.ok()) << "spill_block failed: " << st.to_string();
+    EXPECT_GT(io_context->spill_write_bytes_to_remote_storage(), 0);
+    EXPECT_EQ(io_context->spill_write_bytes_to_local_storage(), local_written_before);
+
+    const auto remote_spill_dir = remote_root / spill_stream->get_spill_dir();
+    bool exists = false;
+    st = io::global_local_filesystem()->exists(remote_spill_dir, &exists);
+    ASSERT_TRUE(st.ok()) << st.to_string();
+    EXPECT_TRUE(exists);
+
+    std::vector<int32_t> values;
+    bool eos = false;
+    while (!eos) {
+        vectorized::Block block;
+        st = spill_stream->read_next_block_sync(&block, &eos);
+        ASSERT_TRUE(st.ok()) << "read_next_block_sync failed: " << st.to_string();
+        if (block.rows() > 0) {
+            const auto& column = assert_cast<const vectorized::ColumnInt32&>(
+                    *block.get_by_position(0).column);
+            values.insert(values.end(), column.get_data().begin(), column.get_data().end());
+        }
+    }
+    EXPECT_EQ(values, data);
+    EXPECT_GT(io_context->spill_read_bytes_from_remote_storage(), 0);
+
+    // remote spill data is deleted directly instead of being moved into the gc dir
+    spill_stream->gc();
+    spill_stream_mgr->get_spill_io_thread_pool()->wait();
+    st = io::global_local_filesystem()->exists(remote_spill_dir, &exists);
+    ASSERT_TRUE(st.ok()) << st.to_string();
+    EXPECT_FALSE(exists);
+}
+
+} // namespace doris::pipeline
@@ -20,6 +20,7 @@
 
 #include <memory>
 
+#include "common/config.h"
 #include "pipeline/exec/aggregation_sink_operator.h"
 #include "pipeline/exec/aggregation_source_operator.h"
 #include "pipeline/exec/mock_operator.h"
@@ -406,4 +407,56 @@ TEST_F(StreamingAggOperatorTest, test4) {
     { EXPECT_TRUE(local_state->close(state.get()).ok()); }
 }
 
+TEST_F(StreamingAggOperatorTest, adaptive_passthrough) {
+    op->_aggregate_evaluators.push_back(vectorized::create_mock_agg_fn_evaluator(
+            pool, MockSlotRef::create_mock_contexts(1, std::make_shared<DataTypeInt64>()), false,
+            false));
+    op->_pool = &pool;
+    op->_needs_finalize = false;
+    op->_is_merge = false;
+
+    EXPECT_TRUE(op->set_child(child_op));
+    EXPECT_TRUE(op->prepare(state.get()).ok());
+    op->_probe_expr_ctxs = MockSlotRef::create_mock_contexts(0, std::make_shared<DataTypeInt64>());
+
+    auto local_state = std::make_unique<MockStreamingAggLocalState>(state.get(), op.get());
+    LocalStateInfo info {.parent_profile = &profile,
+                         .scan_ranges = {},
+                         .shared_state = nullptr,
+                         .shared_state_map = {},
+                         .task_idx = 0};
+    EXPECT_TRUE(local_state->init(state.get(), info).ok());
+
+    const int64_t interval = config::streaming_agg_passthrough_blocks;
+    // Every row is a new group: switch to passthrough after a few sampled blocks.
+    for (int i = 0; i < 3; ++i) {
+        EXPECT_FALSE(local_state->_in_adaptive_passthrough);
+        local_state->_update_adaptive_passthrough(4096, 4096);
+    }
+    EXPECT_TRUE(local_state->_in_adaptive_passthrough);
+    EXPECT_EQ(local_state->_passthrough_blocks_left, interval);
+    EXPECT_EQ(local_state->_adaptive_passthrough_counter->value(), 1);
+    // The mock overrides `_should_not_do_pre_agg`, call the real one to check passthrough
+    for (int64_t i = 0; i < interval; ++i) {
+        EXPECT_TRUE(local_state->StreamingAggLocalState::_should_not_do_pre_agg(4096));
+    }
+    EXPECT_EQ(local_state->_passthrough_blocks_left, 0);
+    EXPECT_EQ(local_state->_adaptive_passthrough_rows_counter->value(), interval * 4096);
+
+    // A probe still without reduction backs off.
+    local_state->_update_adaptive_passthrough(4096, 4000);
+    EXPECT_EQ(local_state->_passthrough_blocks_left, interval * 2);
+
+    // Small blocks are not sampled.
+    local_state->_passthrough_blocks_left = 0;
+    local_state->_update_adaptive_passthrough(100, 1);
+    EXPECT_TRUE(local_state->_in_adaptive_passthrough);
+
+    // Once the keys repeat again, go back to aggregating.
+    local_state->_update_adaptive_passthrough(4096, 16);
+    EXPECT_FALSE(local_state->_in_adaptive_passthrough);
+    EXPECT_EQ(local_state->_passthrough_blocks_left, 0);
+    EXPECT_EQ(local_state->_adaptive_resume_counter->value(), 1);
+}
+
 } // namespace doris::pipeline
@@ -221,6 +221,61 @@ TEST_F(TableFunctionOperatorTest, single_fn_test2) {
     }
 }
 
+TEST_F(TableFunctionOperatorTest, single_fn_multi_child_rows_test) {
+    {
+        state->batsh_size = 4;
+        op->_vfn_ctxs =
+                MockSlotRef::create_mock_contexts(DataTypes {std::make_shared<DataTypeInt32>()});
+        auto fn = std::make_shared<MockTableFunction>();
+        fns.push_back(fn);
+        op->_fns.push_back(fn.get());
+        op->_output_slot_ids.push_back(true);
+        child_op->_mock_row_desc.reset(
+                new MockRowDescriptor {{std::make_shared<vectorized::DataTypeInt32>()}, &pool});
+        op->_mock_row_descriptor.reset(
+                new MockRowDescriptor {{std::make_shared<vectorized::DataTypeInt32>(),
+                                        std::make_shared<vectorized::DataTypeInt32>()},
+                                       &pool});
+        op->_fn_num = 1;
+        EXPECT_TRUE(op->prepare(state.get()));
+
+        local_state_uptr = std::make_unique<MockTableFunctionLocalState>(state.get(), op.get());
+        local_state = local_state_uptr.get();
+        LocalStateInfo info {.parent_profile = &profile,
+                             .scan_ranges = {},
+                             .shared_state = nullptr,
+                             .shared_state_map = {},
+                             .task_idx = 0};
+        EXPECT_TRUE(local_state->init(state.get(), info));
+        state->resize_op_id_to_local_state(-100);
+        state->emplace_local_state(op->operator_id(), std::move(local_state_uptr));
+        EXPECT_TRUE(local_state->open(state.get()));
+    }
+
+    {
+        *local_state->_child_block = ColumnHelper::create_block<DataTypeInt32>({1, 2, 3});
+        auto st = op->push(state.get(), local_state->_child_block.get(), true);
+        EXPECT_TRUE(st) << st.msg();
+        local_state->_child_eos = true;
+    }
+
+    // Every child row yields 5 rows, which span output blocks of 4 rows.
+    std::vector<std::vector<int32_t>> expected_child_values {
+            {1, 1, 1, 1}, {1, 2, 2, 2}, {2, 2, 3, 3}, {3, 3, 3}};
+    for (size_t i = 0; i < expected_child_values.size(); ++i) {
+        Block block;
+        bool eos = false;
+        auto st = op->pull(state.get(), &block, &eos);
+        EXPECT_TRUE(st) << st.msg();
+        EXPECT_EQ(eos, i + 1 == expected_child_values.size());
+        std::vector<int32_t> defaults(expected_child_values[i].size(), 0);
+        EXPECT_TRUE(ColumnHelper::block_equal(
+                block, ColumnHelper::create_block<DataTypeInt32>(expected_child_values[i],
+                                                                 defaults)))
+                << block.dump_data();
+    }
+}
+
 TEST_F(TableFunctionOperatorTest, single_two_test) {
     {
         op->_vfn_ctxs = MockSlotRef::create_mock_contexts(
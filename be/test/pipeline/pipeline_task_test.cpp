@@ -18,6 +18,11 @@
 #include <glog/logging.h>
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+
 #include "common/status.h"
 #include "dummy_task_queue.h"
 #include "pipeline/dependency.h"
@@ -405,9 +410,25 @@ TEST_F(PipelineTaskTest, TEST_EXECUTE) {
         EXPECT_FALSE(task->_wake_up_early);
         EXPECT_EQ(task->_exec_state, PipelineTask::State::RUNNABLE);
     }
+    {
+        // the waits stay in the task until it closes
+        auto read_wait = std::find_if(
+                task->_dependency_waits.begin(), task->_dependency_waits.end(),
+                [&](const PipelineTask::DependencyWait& w) { return w.dependency == read_dep; });
+        ASSERT_TRUE(read_wait != task->_dependency_waits.end());
+        EXPECT_EQ(read_wait->wait_times, 1);
+        EXPECT_EQ(task->_dependency_waits.size(), 4);
+        EXPECT_TRUE(_query_ctx->dependency_wait_stats()->top_waits().empty());
+    }
     {
         EXPECT_TRUE(task->close(Status::OK()).ok());
         EXPECT_EQ(task->_exec_state, PipelineTask::State::FINISHED);
+        EXPECT_TRUE(task->_dependency_waits.empty());
+        auto waits = _query_ctx->dependency_wait_stats()->top_waits();
+        EXPECT_EQ(waits.size(), 4);
+        EXPECT_TRUE(std::any_of(waits.begin(), waits.end(), [&](const auto& wait) {
+            return wait.dependency == read_dep->name() && wait.wait_times == 1;
+        }));
         EXPECT_TRUE(task->finalize().ok());
         EXPECT_EQ(task->_exec_state, PipelineTask::State::FINALIZED);
     }
@@ -1033,4 +1054,105 @@ TEST_F(PipelineTaskTest, TEST_INJECT_SHARED_STATE) {
     }
 }
 
+static PipelinePtr create_dummy_pipeline() {
+    auto pip = std::make_shared<Pipeline>(0, 1, 1);
+    OperatorPtr source_op;
+    source_op.reset(new DummyOperator());
+    EXPECT_TRUE(pip->add_operator(source_op, 1).ok());
+    DataSinkOperatorPtr sink_op;
+    sink_op.reset(new DummySinkOperatorX(1, 2, 3));
+    EXPECT_TRUE(pip->set_sink(sink_op).ok());
+    return pip;
+}
+
+// A task that ran longer goes to a lower priority level, the level with the smallest vruntime
+// is taken first in both queue modes.
+TEST_F(PipelineTaskTest, TEST_PRIORITY_TASK_QUEUE_ORDER) {
+    auto pip = create_dummy_pipeline();
+    auto profile = std::make_shared<RuntimeProfile>("Pipeline : 0");
+    std::map<int,
+             std::pair<std::shared_ptr<BasicSharedState>, std::vector<std::shared_ptr<Dependency>>>>
+            shared_state_map;
+    for (bool lock_free : {false, true}) {
+        PriorityTaskQueue queue(lock_free);
+        auto short_task = std::make_shared<PipelineTask>(pip, 0, _runtime_state.get(), _context,
+                                                         profile.get(), shared_state_map, 0);
+        auto long_task = std::make_shared<PipelineTask>(pip, 1, _runtime_state.get(), _context,
+                                                        profile.get(), shared_state_map, 1);
+        // 2s is above the 1s limit of level 0
+        long_task->inc_runtime_ns(2'000'000'000ULL);
+
+        EXPECT_TRUE(queue.push(short_task).ok());
+        EXPECT_TRUE(queue.push(long_task).ok());
+        EXPECT_EQ(queue._total_task_size.load(), 2);
+        EXPECT_EQ(queue.try_take(false), short_task);
+        EXPECT_EQ(short_task->get_queue_level(), 0);
+        EXPECT_EQ(queue.try_take(false), long_task);
+        EXPECT_EQ(long_task->get_queue_level(), 1);
+
+        // level 0 has used much more time, so level 1 comes first now
+        EXPECT_TRUE(queue.push(short_task).ok());
+        EXPECT_TRUE(queue.push(long_task).ok());
+        queue.inc_sub_queue_runtime(0, 100'000'000'000ULL);
+        EXPECT_EQ(queue.take(1), long_task);
+        EXPECT_EQ(queue.take(1), short_task);
+
+        // the size stops at 0 instead of wrapping around
+        EXPECT_EQ(queue._total_task_size.load(), 0);
+        EXPECT_EQ(queue.try_take(false), nullptr);
+        EXPECT_EQ(queue.take(1), nullptr);
+        EXPECT_EQ(queue._total_task_size.load(), 0);
+
+        queue.close();
+        EXPECT_FALSE(queue.push(short_task).ok());
+    }
+}
+
+// Concurrent pushes and takes of the lock free queue hand out every task exactly once, and the
+// size never drops below the number of queued tasks.
+TEST_F(PipelineTaskTest, TEST_LOCK_FREE_TASK_QUEUE_CONCURRENT) {
+    constexpr int NUM_THREADS = 4;
+    constexpr int TASKS_PER_THREAD = 200;
+    auto pip = create_dummy_pipeline();
+    auto profile = std::make_shared<RuntimeProfile>("Pipeline : 0");
+    std::map<int,
+             std::pair<std::shared_ptr<BasicSharedState>, std::vector<std::shared_ptr<Dependency>>>>
+            shared_state_map;
+    std::vector<PipelineTaskSPtr> tasks;
+    for (int i = 0; i < NUM_THREADS * TASKS_PER_THREAD; ++i) {
+        tasks.push_back(std::make_shared<PipelineTask>(pip, i, _runtime_state.get(), _context,
+                                                       profile.get(), shared_state_map, i));
+    }
+
+    PriorityTaskQueue queue(true);
+    std::atomic<int> num_taken = 0;
+    std::vector<std::atomic<int>> taken_times(tasks.size());
+    std::vector<std::thread> threads;
+    for (int t = 0; t < NUM_THREADS; ++t) {
+        threads.emplace_back([&, t]() {
+            for (int i = 0; i < TASKS_PER_THREAD; ++i) {
+                EXPECT_TRUE(queue.push(tasks[t * TASKS_PER_THREAD + i]).ok());
+            }
+        });
+        threads.emplace_back([&]() {
+            while (num_taken < NUM_THREADS * TASKS_PER_THREAD) {
+                auto task = queue.take(1);
+                if (task) {
+                    taken_times[task->task_id()]++;
+                    num_taken++;
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    for (const auto& times : taken_times) {
+        EXPECT_EQ(times.load(), 1);
+    }
+    EXPECT_EQ(queue._total_task_size.load(), 0);
+    EXPECT_EQ(queue.try_take(false), nullptr);
+    queue.close();
+}
+
 } // namespace doris::pipeline
@@ -0,0 +1,72 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "pipeline/task_queue.h"
+
+#include <gtest/gtest.h>
+
+namespace doris::pipeline {
+
+TEST(MultiCoreTaskQueueTest, TestSingleNumaNode) {
+    MultiCoreTaskQueue queue(8);
+    EXPECT_EQ(queue.numa_node_num(), 1);
+    for (int core_id = 0; core_id < queue.cores(); ++core_id) {
+        EXPECT_EQ(queue.numa_node_of_core(core_id), 0);
+    }
+    queue.close();
+}
+
+TEST(MultiCoreTaskQueueTest, TestNumaNodeGrouping) {
+    MultiCoreTaskQueue queue(8, 2);
+    EXPECT_EQ(queue.numa_node_num(), 2);
+    for (int core_id = 0; core_id < 4; ++core_id) {
+        EXPECT_EQ(queue.numa_node_of_core(core_id), 0);
+    }
+    for (int core_id = 4; core_id < 8; ++core_id) {
+        EXPECT_EQ(queue.numa_node_of_core(core_id), 1);
+    }
+    queue.close();
+}
+
+TEST(MultiCoreTaskQueueTest, TestMoreNumaNodesThanCores) {
+    MultiCoreTaskQueue queue(3, 4);
+    EXPECT_EQ(queue.numa_node_num(), 3);
+    EXPECT_EQ(queue.numa_node_of_core(0), 0);
+    EXPECT_EQ(queue.numa_node_of_core(1), 1);
+    EXPECT_EQ(queue.numa_node_of_core(2), 2);
+    queue.close();
+}
+
+TEST(PriorityTaskQueueTest, TestLockFreeEmptyTake) {
+    PriorityTaskQueue queue(true);
+    EXPECT_TRUE(queue.is_lock_free());
+    EXPECT_EQ(queue.try_take(false), nullptr);
+    EXPECT_EQ(queue.try_take(true), nullptr);
+    EXPECT_EQ(queue.take(1), nullptr);
+    queue.close();
+    EXPECT_EQ(queue.take(0), nullptr);
+}
+
+TEST(PriorityTaskQueueTest, TestLockedEmptyTake) {
+    PriorityTaskQueue queue(false);
+    EXPECT_FALSE(queue.is_lock_free());
+    EXPECT_EQ(queue.try_take(false), nullptr);
+    EXPECT_EQ(queue.take(1), nullptr);
+    queue.close();
+}
+
+} // namespace doris::pipeline
@@ -0,0 +1,98 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <gen_cpp/PaloInternalService_types.h>
+#include <gtest/gtest.h>
+
+#include <memory>
+
+#include "common/status.h"
+#include "http/action/drain_action.h"
+#include "runtime/exec_env.h"
+#include "runtime/fragment_mgr.h"
+#include "testutil/mock/mock_query_context.h"
+
+namespace doris {
+
+class DrainTest : public testing::Test {
+public:
+    void SetUp() override {
+        _fragment_mgr = std::make_unique<FragmentMgr>(ExecEnv::GetInstance());
+        _query_id.__set_hi(1);
+        _query_id.__set_lo(2);
+    }
+
+    void TearDown() override {
+        ExecEnv::cancel_drain();
+        _fragment_mgr->stop();
+    }
+
+protected:
+    Status get_or_create_query_ctx(std::shared_ptr<QueryContext>& query_ctx) {
+        TPipelineFragmentParams params;
+        params.__set_query_id(_query_id);
+        params.__set_is_simplified_param(false);
+        return _fragment_mgr->_get_or_create_query_ctx(params, TPipelineFragmentParamsList {},
+                                                       QuerySource::INTERNAL_FRONTEND, query_ctx);
+    }
+
+    std::unique_ptr<FragmentMgr> _fragment_mgr;
+    TUniqueId _query_id;
+};
+
+TEST_F(DrainTest, RejectNewQuery) {
+    ExecEnv::GetInstance()->start_drain();
+    ASSERT_TRUE(ExecEnv::is_draining());
+    std::shared_ptr<QueryContext> query_ctx;
+    auto st = get_or_create_query_ctx(query_ctx);
+    EXPECT_TRUE(st.is<ErrorCode::SERVICE_UNAVAILABLE>()) << st;
+    EXPECT_EQ(query_ctx, nullptr);
+}
+
+TEST_F(DrainTest, AcceptFragmentOfRunningQuery) {
+    std::shared_ptr<QueryContext> running_query = MockQueryContext::create(_query_id);
+    _fragment_mgr->_query_ctx_map.insert(_query_id, running_query);
+
+    ExecEnv::GetInstance()->start_drain();
+    std::shared_ptr<QueryContext> query_ctx;
+    EXPECT_TRUE(get_or_create_query_ctx(query_ctx).ok());
+    EXPECT_EQ(query_ctx, running_query);
+}
+
+TEST_F(DrainTest, CancelDrain) {
+    ExecEnv::GetInstance()->start_drain();
+    int64_t drain_start_ms = ExecEnv::drain_start_ms();
+    EXPECT_GT(drain_start_ms, 0);
+    // starting again keeps the first start time
+    ExecEnv::GetInstance()->start_drain();
+    EXPECT_EQ(ExecEnv::drain_start_ms(), drain_start_ms);
+
+    ExecEnv::cancel_drain();
+    EXPECT_FALSE(ExecEnv::is_draining());
+    EXPECT_EQ(ExecEnv::drain_start_ms(), 0);
+}
+
+TEST_F(DrainTest, Drained) {
+    // not drained until the drain starts, even when idle
+    EXPECT_FALSE(DrainAction::drained(0, 0));
+    ExecEnv::GetInstance()->start_drain();
+    EXPECT_TRUE(DrainAction::drained(0, 0));
+    EXPECT_FALSE(DrainAction::drained(1, 0));
+    EXPECT_FALSE(DrainAction::drained(0, 1024));
+}
+
+} // namespace doris
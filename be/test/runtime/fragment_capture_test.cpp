@@ -0,0 +1,113 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "runtime/fragment_capture.h"
+
+#include <gen_cpp/PaloInternalService_types.h>
+#include <gen_cpp/PlanNodes_types.h>
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+#include "common/config.h"
+#include "io/fs/local_file_system.h"
+
+namespace doris {
+
+class FragmentCaptureTest : public testing::Test {
+public:
+    void SetUp() override {
+        _saved_dir = config::fragment_capture_dir;
+        config::fragment_capture_dir = "./ut_dir/fragment_capture_test";
+        static_cast<void>(
+                io::global_local_filesystem()->delete_directory(config::fragment_capture_dir));
+    }
+
+    void TearDown() override {
+        static_cast<void>(
+                io::global_local_filesystem()->delete_directory(config::fragment_capture_dir));
+        config::fragment_capture_dir = _saved_dir;
+    }
+
+    static TPipelineFragmentParams make_params(int64_t query_id_hi, int fragment_id) {
+        TPipelineFragmentParams params;
+        params.query_id.hi = query_id_hi;
+        params.query_id.lo = 1;
+        params.fragment_id = fragment_id;
+        TPlanNode node;
+        node.node_id = 0;
+        node.node_type = TPlanNodeType::OLAP_SCAN_NODE;
+        params.fragment.plan.nodes.push_back(node);
+        params.__isset.fragment = true;
+        return params;
+    }
+
+private:
+    std::string _saved_dir;
+};
+
+TEST_F(FragmentCaptureTest, CaptureAndFinish) {
+    FragmentCapture capture;
+    auto params = make_params(100, 2);
+    capture.capture(params);
+    // not captured, ignored
+    capture.finish(params.query_id, 3, 1000);
+    capture.finish(params.query_id, 2, 5000000);
+
+    auto name = FragmentCapture::fragment_name(params.query_id, 2);
+    auto path = std::filesystem::path(config::fragment_capture_dir) /
+                (name + FragmentCapture::FRAGMENT_FILE_SUFFIX);
+    TPipelineFragmentParams read_params;
+    ASSERT_TRUE(FragmentCapture::read_fragment(path, &read_params).ok());
+    EXPECT_EQ(read_params.query_id, params.query_id);
+    EXPECT_EQ(read_params.fragment_id, 2);
+    ASSERT_EQ(read_params.fragment.plan.nodes.size(), 1);
+    EXPECT_EQ(read_params.fragment.plan.nodes[0].node_type, TPlanNodeType::OLAP_SCAN_NODE);
+
+    uint64_t fingerprint = 0;
+    ASSERT_TRUE(FragmentCapture::fingerprint(params, &fingerprint).ok());
+    std::ifstream timing(std::filesystem::path(config::fragment_capture_dir) /
+                         FragmentCapture::TIMING_FILE_NAME);
+    std::string read_name;
+    uint64_t read_fingerprint = 0;
+    int64_t exec_time_us = 0;
+    ASSERT_TRUE(timing >> read_name >> read_fingerprint >> exec_time_us);
+    EXPECT_EQ(read_name, name);
+    EXPECT_EQ(read_fingerprint, fingerprint);
+    EXPECT_EQ(exec_time_us, 5000);
+    EXPECT_FALSE(timing >> read_name);
+}
+
+TEST_F(FragmentCaptureTest, FingerprintIgnoresQueryId) {
+    uint64_t lhs = 0;
+    uint64_t rhs = 0;
+    ASSERT_TRUE(FragmentCapture::fingerprint(make_params(1, 2), &lhs).ok());
+    ASSERT_TRUE(FragmentCapture::fingerprint(make_params(2, 2), &rhs).ok());
+    EXPECT_EQ(lhs, rhs);
+
+    auto params = make_params(1, 2);
+    params.fragment.plan.nodes[0].node_type = TPlanNodeType::HASH_JOIN_NODE;
+    ASSERT_TRUE(FragmentCapture::fingerprint(params, &rhs).ok());
+    EXPECT_NE(lhs, rhs);
+
+    params.__isset.fragment = false;
+    EXPECT_FALSE(FragmentCapture::fingerprint(params, &rhs).ok());
+}
+
+} // namespace doris
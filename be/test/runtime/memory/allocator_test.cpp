@@ -20,8 +20,11 @@
 #include <gtest/gtest-message.h>
 #include <gtest/gtest-test-part.h>
 
+#include <cstring>
 #include <memory>
+#include <string>
 
+#include "common/config.h"
 #include "gtest/gtest_pred_impl.h"
 #include "vec/common/allocator_fwd.h"
 
@@ -59,4 +62,31 @@ TEST(AllocatorTest, TestNormal) {
     test_normal();
 }
 
+TEST(AllocatorTest, TestHugePage) {
+    const std::string mode = config::huge_page_alloc_mode;
+    const int64_t threshold = config::huge_page_alloc_threshold_bytes;
+    config::huge_page_alloc_threshold_bytes = 4 * 1024 * 1024;
+    for (const auto* huge_page_mode : {"madvise", "hugetlb"}) {
+        config::huge_page_alloc_mode = huge_page_mode;
+        Allocator<true, true> allocator;
+        // Grows across the threshold, up within it and back below it.
+        auto* ptr = reinterpret_cast<char*>(allocator.alloc(1024 * 1024));
+        memset(ptr, 1, 1024 * 1024);
+        ptr = reinterpret_cast<char*>(allocator.realloc(ptr, 1024 * 1024, 5 * 1024 * 1024));
+        EXPECT_EQ(reinterpret_cast<uintptr_t>(ptr) % (2 * 1024 * 1024), 0);
+        EXPECT_EQ(ptr[1024 * 1024 - 1], 1);
+        EXPECT_EQ(ptr[5 * 1024 * 1024 - 1], 0);
+        ptr = reinterpret_cast<char*>(
+                allocator.realloc(ptr, 5 * 1024 * 1024, 9 * 1024 * 1024 + 100));
+        EXPECT_EQ(reinterpret_cast<uintptr_t>(ptr) % (2 * 1024 * 1024), 0);
+        EXPECT_EQ(ptr[1024 * 1024 - 1], 1);
+        EXPECT_EQ(ptr[9 * 1024 * 1024 + 99], 0);
+        ptr = reinterpret_cast<char*>(allocator.realloc(ptr, 9 * 1024 * 1024 + 100, 4096));
+        EXPECT_EQ(ptr[4095], 1);
+        allocator.free(ptr, 4096);
+    }
+    config::huge_page_alloc_mode = mode;
+    config::huge_page_alloc_threshold_bytes = threshold;
+}
+
 } // namespace doris
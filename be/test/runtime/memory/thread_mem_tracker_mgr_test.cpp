@@ -20,10 +20,13 @@
 #include <gtest/gtest-message.h>
 #include <gtest/gtest-test-part.h>
 
+#include "common/config.h"
 #include "gtest/gtest_pred_impl.h"
+#include "runtime/memory/jemalloc_control.h"
 #include "runtime/memory/mem_tracker_limiter.h"
 #include "runtime/thread_context.h"
 #include "runtime/workload_group/workload_group_manager.h"
+#include "util/defer_op.h"
 
 namespace doris {
 
@@ -548,4 +551,56 @@ TEST_F(ThreadMemTrackerMgrTest, ReserveMemoryFailed) {
     }
 }
 
+TEST_F(ThreadMemTrackerMgrTest, WorkloadGroupJemallocArena) {
+    auto origin_enable_arena = config::enable_workload_group_jemalloc_arena;
+    Defer defer {[&]() { config::enable_workload_group_jemalloc_arena = origin_enable_arena; }};
+    std::unique_ptr<ThreadContext> thread_context = std::make_unique<ThreadContext>();
+    std::shared_ptr<MemTrackerLimiter> t = MemTrackerLimiter::create_shared(
+            MemTrackerLimiter::Type::OTHER, "UT-WorkloadGroupJemallocArena");
+    const auto origin_arena = JemallocControl::get_jemallctl_value<unsigned>("thread.arena");
+
+    // without the config the group has no arena and attaching does not rebind the thread
+    config::enable_workload_group_jemalloc_arena = false;
+    WorkloadGroupInfo wg_info {.id = 3};
+    auto wg = _wg_manager->get_or_create_workload_group(wg_info);
+    EXPECT_EQ(wg->jemalloc_arena(), -1);
+    std::shared_ptr<ResourceContext> rc = ResourceContext::create_shared();
+    rc->memory_context()->set_mem_tracker(t);
+    rc->set_workload_group(wg);
+    thread_context->attach_task(rc);
+    EXPECT_EQ(JemallocControl::get_jemallctl_value<unsigned>("thread.arena"), origin_arena);
+    thread_context->detach_task();
+
+    config::enable_workload_group_jemalloc_arena = true;
+    WorkloadGroupInfo arena_wg_info {.id = 4};
+    auto arena_wg = _wg_manager->get_or_create_workload_group(arena_wg_info);
+    auto arena = arena_wg->jemalloc_arena();
+#ifdef USE_JEMALLOC
+    ASSERT_GE(arena, 0);
+#else
+    EXPECT_EQ(arena, -1);
+#endif
+    // the arena is created once per group
+    EXPECT_EQ(arena_wg->jemalloc_arena(), arena);
+
+    std::shared_ptr<ResourceContext> arena_rc = ResourceContext::create_shared();
+    arena_rc->memory_context()->set_mem_tracker(t);
+    arena_rc->set_workload_group(arena_wg);
+    thread_context->attach_task(arena_rc);
+#ifdef USE_JEMALLOC
+    EXPECT_EQ(JemallocControl::get_jemallctl_value<unsigned>("thread.arena"), arena);
+#endif
+    // a nested attach without a group keeps the thread on the group arena
+    std::shared_ptr<MemTrackerLimiter> t2 = MemTrackerLimiter::create_shared(
+            MemTrackerLimiter::Type::OTHER, "UT-WorkloadGroupJemallocArena2");
+    thread_context->thread_mem_tracker_mgr->attach_limiter_tracker(t2);
+    thread_context->thread_mem_tracker_mgr->detach_limiter_tracker();
+#ifdef USE_JEMALLOC
+    EXPECT_EQ(JemallocControl::get_jemallctl_value<unsigned>("thread.arena"), arena);
+#endif
+    thread_context->detach_task();
+    // detaching restores the arena the thread used before
+    EXPECT_EQ(JemallocControl::get_jemallctl_value<unsigned>("thread.arena"), origin_arena);
+}
+
 } // end namespace doris
@@ -0,0 +1,86 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "runtime/runtime_predicate.h"
+
+#include <gen_cpp/PlanNodes_types.h>
+#include <gtest/gtest.h>
+
+#include <memory>
+
+#include "runtime/descriptors.h"
+#include "vec/data_types/data_type_number.h"
+#include "vec/data_types/data_type_string.h"
+
+namespace doris::vectorized {
+
+class RuntimePredicateTest : public testing::Test {
+protected:
+    static TTopnFilterDesc create_desc(TPrimitiveType::type type, bool is_asc) {
+        TScalarType scalar_type;
+        scalar_type.__set_type(type);
+        TTypeNode type_node;
+        type_node.__set_type(TTypeNodeType::SCALAR);
+        type_node.__set_scalar_type(scalar_type);
+        TExprNode node;
+        node.__set_node_type(TExprNodeType::SLOT_REF);
+        node.type.types.push_back(type_node);
+        TExpr expr;
+        expr.nodes.push_back(node);
+
+        TTopnFilterDesc desc;
+        desc.__set_is_asc(is_asc);
+        desc.__set_null_first(false);
+        desc.target_node_id_to_target_expr[0] = expr;
+        return desc;
+    }
+
+    static std::unique_ptr<SlotDescriptor> create_slot(DataTypePtr type) {
+        auto slot = std::make_unique<SlotDescriptor>();
+        slot->_col_name = "k";
+        slot->_type = std::move(type);
+        return slot;
+    }
+};
+
+TEST_F(RuntimePredicateTest, ascToValueRange) {
+    RuntimePredicate pred(create_desc(TPrimitiveType::INT, true));
+    auto slot = create_slot(std::make_shared<DataTypeInt32>());
+    ColumnValueRangeType range;
+    EXPECT_FALSE(pred.to_value_range(Field(), *slot, &range));
+
+    auto value = Field::create_field<TYPE_INT>(10);
+    ASSERT_TRUE(pred.to_value_range(value, *slot, &range));
+    const auto& int_range = std::get<ColumnValueRange<TYPE_INT>>(range);
+    EXPECT_EQ(int_range.column_name(), "k");
+    EXPECT_EQ(int_range.get_range_min_value(), type_limit<int32_t>::min());
+    EXPECT_EQ(int_range.get_range_max_value(), 10);
+}
+
+TEST_F(RuntimePredicateTest, descToValueRange) {
+    RuntimePredicate pred(create_desc(TPrimitiveType::STRING, false));
+    auto slot = create_slot(std::make_shared<DataTypeString>());
+    auto value = Field::create_field<TYPE_STRING>(String("abc"));
+    ColumnValueRangeType range;
+    ASSERT_TRUE(pred.to_value_range(value, *slot, &range));
+    const auto& string_range = std::get<ColumnValueRange<TYPE_STRING>>(range);
+    EXPECT_EQ(string_range.get_range_min_value().to_string(), "abc");
+    EXPECT_FALSE(string_range.is_low_value_mininum());
+    EXPECT_TRUE(string_range.is_high_value_maximum());
+}
+
+} // namespace doris::vectorized
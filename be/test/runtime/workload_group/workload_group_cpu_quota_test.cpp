@@ -0,0 +1,71 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "runtime/workload_group/workload_group_cpu_quota.h"
+
+#include <gtest/gtest.h>
+
+#include "util/cpu_info.h"
+
+namespace doris {
+
+class WorkloadGroupCpuQuotaTest : public testing::Test {
+protected:
+    static constexpr int64_t MS = 1000L * 1000;
+    static constexpr int64_t PERIOD = WorkloadGroupCpuQuota::PERIOD_NS;
+
+    // periods are global, every test starts far after the periods of the previous ones
+    static int64_t next_start_time() {
+        static int64_t start_time = 0;
+        start_time += 1000 * PERIOD;
+        return start_time;
+    }
+};
+
+TEST_F(WorkloadGroupCpuQuotaTest, HardLimit) {
+    const int64_t cores = CpuInfo::num_cores();
+    const int64_t now = next_start_time();
+    WorkloadGroupCpuQuota quota;
+    quota.update(1024, 10);
+    EXPECT_EQ(quota.throttle_time_ns(now), 0);
+
+    quota.consume(PERIOD * cores / 10, now + MS);
+    // the hard limit quota is used up, wait for the rest of the period
+    EXPECT_EQ(quota.throttle_time_ns(now + 2 * MS), PERIOD - 2 * MS);
+    EXPECT_EQ(quota.throttle_time_ns(now + PERIOD + 1), 0);
+}
+
+TEST_F(WorkloadGroupCpuQuotaTest, WeightedShare) {
+    const int64_t cores = CpuInfo::num_cores();
+    const int64_t now = next_start_time();
+    WorkloadGroupCpuQuota low;
+    WorkloadGroupCpuQuota high;
+    low.update(1024, 0);
+    high.update(3072, 0);
+    EXPECT_EQ(low.throttle_time_ns(now), 0);
+
+    // low keeps all cores busy while high just started
+    low.consume(10 * MS * cores, now + 10 * MS);
+    high.consume(1, now + 10 * MS);
+    EXPECT_EQ(low.throttle_time_ns(now + 10 * MS), WorkloadGroupCpuQuota::WAIT_STEP_NS);
+    EXPECT_EQ(high.throttle_time_ns(now + 10 * MS), 0);
+
+    // idle cores are free to use whatever the shares
+    EXPECT_EQ(low.throttle_time_ns(now + 50 * MS), 0);
+}
+
+} // namespace doris
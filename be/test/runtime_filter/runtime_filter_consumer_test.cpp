@@ -23,6 +23,7 @@
 
 #include "runtime_filter/runtime_filter_producer.h"
 #include "runtime_filter/runtime_filter_test_utils.h"
+#include "vec/data_types/data_type_number.h"
 
 namespace doris {
 
@@ -212,6 +213,95 @@ TEST_F(RuntimeFilterConsumerTest, bitmap_filter) {
             RuntimeFilterConsumer::create(_query_ctx.get(), &desc, 0, &consumer));
 }
 
+TEST_F(RuntimeFilterConsumerTest, in_to_bloom) {
+    auto desc = TRuntimeFilterDescBuilder()
+                        .set_type(TRuntimeFilterType::IN_OR_BLOOM)
+                        .add_planId_to_target_expr(0)
+                        .build();
+    const_cast<TQueryOptions&>(_query_ctx->_query_options).__set_runtime_filter_max_in_num(1024);
+
+    auto column = vectorized::ColumnInt32::create();
+    column->insert(vectorized::Field::create_field<TYPE_INT>(1));
+    column->insert(vectorized::Field::create_field<TYPE_INT>(2));
+    column->insert(vectorized::Field::create_field<TYPE_INT>(3));
+    vectorized::ColumnPtr build_column = std::move(column);
+
+    auto acquire = [&](std::vector<vectorized::VRuntimeFilterPtr>& push_exprs,
+                       std::shared_ptr<RuntimeFilterConsumer>& consumer) {
+        FAIL_IF_ERROR_OR_CATCH_EXCEPTION(
+                RuntimeFilterConsumer::create(_query_ctx.get(), &desc, 0, &consumer));
+        std::shared_ptr<RuntimeFilterProducer> producer;
+        FAIL_IF_ERROR_OR_CATCH_EXCEPTION(
+                RuntimeFilterProducer::create(_query_ctx.get(), &desc, &producer));
+        FAIL_IF_ERROR_OR_CATCH_EXCEPTION(producer->init(build_column->size()));
+        FAIL_IF_ERROR_OR_CATCH_EXCEPTION(producer->insert(build_column, 0));
+        producer->set_wrapper_state_and_ready_to_publish(RuntimeFilterWrapper::State::READY);
+        consumer->signal(producer.get());
+        FAIL_IF_ERROR_OR_CATCH_EXCEPTION(consumer->acquire_expr(push_exprs));
+    };
+
+    auto origin_threshold = config::runtime_filter_in_to_bloom_threshold;
+    {
+        config::runtime_filter_in_to_bloom_threshold = 4;
+        std::shared_ptr<RuntimeFilterConsumer> consumer;
+        std::vector<vectorized::VRuntimeFilterPtr> push_exprs;
+        acquire(push_exprs, consumer);
+        ASSERT_EQ(push_exprs.size(), 1);
+        ASSERT_EQ(push_exprs[0]->node_type(), TExprNodeType::IN_PRED);
+        ASSERT_EQ(consumer->_in_to_bloom_counter->value(), 0);
+    }
+    {
+        config::runtime_filter_in_to_bloom_threshold = 3;
+        std::shared_ptr<RuntimeFilterConsumer> consumer;
+        std::vector<vectorized::VRuntimeFilterPtr> push_exprs;
+        acquire(push_exprs, consumer);
+        ASSERT_EQ(push_exprs.size(), 1);
+        ASSERT_EQ(push_exprs[0]->node_type(), TExprNodeType::BLOOM_PRED);
+        ASSERT_EQ(consumer->_in_to_bloom_counter->value(), 1);
+        // the shared wrapper keeps its in filter
+        ASSERT_EQ(consumer->_wrapper->get_real_type(), RuntimeFilterType::IN_FILTER);
+    }
+    config::runtime_filter_in_to_bloom_threshold = origin_threshold;
+}
+
+TEST_F(RuntimeFilterConsumerTest, disable_useless_filter) {
+    std::shared_ptr<RuntimeFilterConsumer> consumer;
+    auto desc = TRuntimeFilterDescBuilder().add_planId_to_target_expr(0).build();
+    FAIL_IF_ERROR_OR_CATCH_EXCEPTION(
+            RuntimeFilterConsumer::create(_query_ctx.get(), &desc, 0, &consumer));
+    std::shared_ptr<RuntimeFilterProducer> producer;
+    FAIL_IF_ERROR_OR_CATCH_EXCEPTION(
+            RuntimeFilterProducer::create(_query_ctx.get(), &desc, &producer));
+    producer->set_wrapper_state_and_ready_to_publish(RuntimeFilterWrapper::State::READY);
+    consumer->signal(producer.get());
+
+    std::vector<vectorized::VRuntimeFilterPtr> push_exprs;
+    FAIL_IF_ERROR_OR_CATCH_EXCEPTION(consumer->acquire_expr(push_exprs));
+    ASSERT_EQ(push_exprs.size(), 1);
+    auto wrapper = push_exprs[0];
+
+    auto origin_periods = config::runtime_filter_max_useless_sampling_periods;
+    config::runtime_filter_max_useless_sampling_periods = 2;
+
+    // a useful period resets the count of useless periods
+    wrapper->_always_true = true;
+    wrapper->_finish_sampling_period();
+    wrapper->_always_true = false;
+    wrapper->_finish_sampling_period();
+    wrapper->_always_true = true;
+    wrapper->_finish_sampling_period();
+    ASSERT_FALSE(wrapper->is_disabled());
+    ASSERT_FALSE(wrapper->_always_true);
+
+    wrapper->_always_true = true;
+    wrapper->_finish_sampling_period();
+    ASSERT_TRUE(wrapper->is_disabled());
+    ASSERT_TRUE(wrapper->_always_true);
+    ASSERT_EQ(consumer->_disabled_counter->value(), 1);
+
+    config::runtime_filter_max_useless_sampling_periods = origin_periods;
+}
+
 TEST_F(RuntimeFilterConsumerTest, aquire_signal_at_same_time) {
     for (int i = 0; i < 100; i++) {
         std::shared_ptr<RuntimeFilterConsumer> consumer;
@@ -95,6 +95,37 @@ TEST_F(RuntimeFilterMergerTest, basic) {
                     RuntimeFilterWrapper::State::READY, RuntimeFilterWrapper::State::READY);
 }
 
+TEST_F(RuntimeFilterMergerTest, merge_from_partial_merger) {
+    auto desc = TRuntimeFilterDescBuilder().build();
+    std::shared_ptr<RuntimeFilterMerger> partial;
+    FAIL_IF_ERROR_OR_CATCH_EXCEPTION(
+            RuntimeFilterMerger::create(_query_ctx.get(), &desc, &partial));
+    partial->set_expected_producer_num(2);
+    for (int i = 0; i < 2; i++) {
+        std::shared_ptr<RuntimeFilterProducer> producer;
+        FAIL_IF_ERROR_OR_CATCH_EXCEPTION(
+                _runtime_states[i]->register_producer_runtime_filter(desc, &producer));
+        producer->set_wrapper_state_and_ready_to_publish(RuntimeFilterWrapper::State::READY);
+        FAIL_IF_ERROR_OR_CATCH_EXCEPTION(partial->merge_from(producer.get()));
+    }
+    ASSERT_TRUE(partial->ready());
+
+    std::shared_ptr<RuntimeFilterMerger> merger;
+    FAIL_IF_ERROR_OR_CATCH_EXCEPTION(RuntimeFilterMerger::create(_query_ctx.get(), &desc, &merger));
+    merger->set_expected_producer_num(3);
+    FAIL_IF_ERROR_OR_CATCH_EXCEPTION(
+            merger->merge_from(partial.get(), partial->expected_producer_num()));
+    ASSERT_FALSE(merger->ready());
+
+    std::shared_ptr<RuntimeFilterProducer> producer;
+    FAIL_IF_ERROR_OR_CATCH_EXCEPTION(
+            _runtime_states[0]->register_producer_runtime_filter(desc, &producer));
+    producer->set_wrapper_state_and_ready_to_publish(RuntimeFilterWrapper::State::READY);
+    FAIL_IF_ERROR_OR_CATCH_EXCEPTION(merger->merge_from(producer.get()));
+    ASSERT_TRUE(merger->ready());
+    ASSERT_EQ(merger->_wrapper->_state, RuntimeFilterWrapper::State::READY);
+}
+
 TEST_F(RuntimeFilterMergerTest, add_rf_size) {
     std::shared_ptr<RuntimeFilterMerger> merger;
     auto desc = TRuntimeFilterDescBuilder().build();
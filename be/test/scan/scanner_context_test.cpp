@@ -128,7 +128,8 @@ private:
 TEST_F(ScannerContextTest, test_init) {
     const int parallel_tasks = 1;
     auto scan_operator = std::make_unique<pipeline::OlapScanOperatorX>(
-            obj_pool.get(), tnode, 0, *descs, parallel_tasks, TQueryCacheParam {});
+            obj_pool.get(), tnode, 0, *descs, parallel_tasks, TQueryCacheParam {},
+            QueryCacheMergeInfo {});
 
     auto olap_scan_local_state =
             pipeline::OlapScanLocalState::create_unique(state.get(), scan_operator.get());
@@ -191,7 +192,8 @@ TEST_F(ScannerContextTest, test_init) {
 TEST_F(ScannerContextTest, test_serial_run) {
     const int parallel_tasks = 1;
     auto scan_operator = std::make_unique<pipeline::OlapScanOperatorX>(
-            obj_pool.get(), tnode, 0, *descs, parallel_tasks, TQueryCacheParam {});
+            obj_pool.get(), tnode, 0, *descs, parallel_tasks, TQueryCacheParam {},
+            QueryCacheMergeInfo {});
 
     auto olap_scan_local_state =
             pipeline::OlapScanLocalState::create_unique(state.get(), scan_operator.get());
@@ -249,7 +251,8 @@ TEST_F(ScannerContextTest, test_serial_run) {
 TEST_F(ScannerContextTest, test_max_column_reader_num) {
     const int parallel_tasks = 1;
     auto scan_operator = std::make_unique<pipeline::OlapScanOperatorX>(
-            obj_pool.get(), tnode, 0, *descs, parallel_tasks, TQueryCacheParam {});
+            obj_pool.get(), tnode, 0, *descs, parallel_tasks, TQueryCacheParam {},
+            QueryCacheMergeInfo {});
 
     auto olap_scan_local_state =
             pipeline::OlapScanLocalState::create_unique(state.get(), scan_operator.get());
@@ -299,7 +302,8 @@ TEST_F(ScannerContextTest, test_max_column_reader_num) {
 TEST_F(ScannerContextTest, test_push_back_scan_task) {
     const int parallel_tasks = 1;
     auto scan_operator = std::make_unique<pipeline::OlapScanOperatorX>(
-            obj_pool.get(), tnode, 0, *descs, parallel_tasks, TQueryCacheParam {});
+            obj_pool.get(), tnode, 0, *descs, parallel_tasks, TQueryCacheParam {},
+            QueryCacheMergeInfo {});
 
     auto olap_scan_local_state =
             pipeline::OlapScanLocalState::create_unique(state.get(), scan_operator.get());
@@ -336,7 +340,8 @@ TEST_F(ScannerContextTest, test_push_back_scan_task) {
 TEST_F(ScannerContextTest, get_margin) {
     const int parallel_tasks = 4;
     auto scan_operator = std::make_unique<pipeline::OlapScanOperatorX>(
-            obj_pool.get(), tnode, 0, *descs, parallel_tasks, TQueryCacheParam {});
+            obj_pool.get(), tnode, 0, *descs, parallel_tasks, TQueryCacheParam {},
+            QueryCacheMergeInfo {});
 
     auto olap_scan_local_state =
             pipeline::OlapScanLocalState::create_unique(state.get(), scan_operator.get());
@@ -432,7 +437,8 @@ TEST_F(ScannerContextTest, get_margin) {
 TEST_F(ScannerContextTest, pull_next_scan_task) {
     const int parallel_tasks = 4;
     auto scan_operator = std::make_unique<pipeline::OlapScanOperatorX>(
-            obj_pool.get(), tnode, 0, *descs, parallel_tasks, TQueryCacheParam {});
+            obj_pool.get(), tnode, 0, *descs, parallel_tasks, TQueryCacheParam {},
+            QueryCacheMergeInfo {});
 
     auto olap_scan_local_state =
             pipeline::OlapScanLocalState::create_unique(state.get(), scan_operator.get());
@@ -507,7 +513,8 @@ TEST_F(ScannerContextTest, pull_next_scan_task) {
 TEST_F(ScannerContextTest, schedule_scan_task) {
     const int parallel_tasks = 4;
     auto scan_operator = std::make_unique<pipeline::OlapScanOperatorX>(
-            obj_pool.get(), tnode, 0, *descs, parallel_tasks, TQueryCacheParam {});
+            obj_pool.get(), tnode, 0, *descs, parallel_tasks, TQueryCacheParam {},
+            QueryCacheMergeInfo {});
 
     auto olap_scan_local_state =
             pipeline::OlapScanLocalState::create_unique(state.get(), scan_operator.get());
@@ -634,7 +641,8 @@ TEST_F(ScannerContextTest, scan_queue_mem_limit) {
 
     const int parallel_tasks = 1;
     auto scan_operator = std::make_unique<pipeline::OlapScanOperatorX>(
-            obj_pool.get(), tnode, 0, *descs, parallel_tasks, TQueryCacheParam {});
+            obj_pool.get(), tnode, 0, *descs, parallel_tasks, TQueryCacheParam {},
+            QueryCacheMergeInfo {});
 
     auto olap_scan_local_state =
             pipeline::OlapScanLocalState::create_unique(state.get(), scan_operator.get());
@@ -678,7 +686,8 @@ TEST_F(ScannerContextTest, scan_queue_mem_limit) {
 TEST_F(ScannerContextTest, get_free_block) {
     const int parallel_tasks = 1;
     auto scan_operator = std::make_unique<pipeline::OlapScanOperatorX>(
-            obj_pool.get(), tnode, 0, *descs, parallel_tasks, TQueryCacheParam {});
+            obj_pool.get(), tnode, 0, *descs, parallel_tasks, TQueryCacheParam {},
+            QueryCacheMergeInfo {});
 
     auto olap_scan_local_state =
             pipeline::OlapScanLocalState::create_unique(state.get(), scan_operator.get());
@@ -731,7 +740,8 @@ TEST_F(ScannerContextTest, get_free_block) {
 TEST_F(ScannerContextTest, return_free_block) {
     const int parallel_tasks = 1;
     auto scan_operator = std::make_unique<pipeline::OlapScanOperatorX>(
-            obj_pool.get(), tnode, 0, *descs, parallel_tasks, TQueryCacheParam {});
+            obj_pool.get(), tnode, 0, *descs, parallel_tasks, TQueryCacheParam {},
+            QueryCacheMergeInfo {});
 
     auto olap_scan_local_state =
             pipeline::OlapScanLocalState::create_unique(state.get(), scan_operator.get());
@@ -775,7 +785,8 @@ TEST_F(ScannerContextTest, return_free_block) {
 TEST_F(ScannerContextTest, get_block_from_queue) {
     const int parallel_tasks = 1;
     auto scan_operator = std::make_unique<pipeline::OlapScanOperatorX>(
-            obj_pool.get(), tnode, 0, *descs, parallel_tasks, TQueryCacheParam {});
+            obj_pool.get(), tnode, 0, *descs, parallel_tasks, TQueryCacheParam {},
+            QueryCacheMergeInfo {});
 
     auto olap_scan_local_state =
             pipeline::OlapScanLocalState::create_unique(state.get(), scan_operator.get());
@@ -847,4 +858,97 @@ TEST_F(ScannerContextTest, get_block_from_queue) {
     EXPECT_EQ(scanner_context->_num_finished_scanners, 1);
 }
 
+TEST_F(ScannerContextTest, adjust_scan_concurrency) {
+    const int parallel_tasks = 1;
+    auto scan_operator = std::make_unique<pipeline::OlapScanOperatorX>(
+            obj_pool.get(), tnode, 0, *descs, parallel_tasks, TQueryCacheParam {},
+            QueryCacheMergeInfo {});
+
+    auto olap_scan_local_state =
+            pipeline::OlapScanLocalState::create_unique(state.get(), scan_operator.get());
+
+    const int64_t limit = 100;
+
+    OlapScanner::Params scanner_params;
+    scanner_params.state = state.get();
+    scanner_params.profile = profile.get();
+    scanner_params.limit = limit;
+    scanner_params.key_ranges = std::vector<OlapScanRange*>(); // empty
+
+    std::shared_ptr<Scanner> scanner =
+            OlapScanner::create_shared(olap_scan_local_state.get(), std::move(scanner_params));
+
+    std::list<std::shared_ptr<ScannerDelegate>> scanners;
+    for (int i = 0; i < 11; ++i) {
+        scanners.push_back(std::make_shared<ScannerDelegate>(scanner));
+    }
+
+    std::shared_ptr<ScannerContext> scanner_context = ScannerContext::create_shared(
+            state.get(), olap_scan_local_state.get(), output_tuple_desc, output_row_descriptor,
+            scanners, limit, scan_dependency, parallel_tasks);
+
+    auto adaptive_concurrency_counter =
+            std::make_unique<RuntimeProfile::Counter>(TUnit::UNIT, 0, 3);
+    olap_scan_local_state->_adaptive_scan_concurrency = adaptive_concurrency_counter.get();
+    olap_scan_local_state->_parent = scan_operator.get();
+    scanner_context->_min_scan_concurrency = 1;
+    scanner_context->_max_scan_concurrency = 4;
+    scanner_context->_max_adaptive_scan_concurrency = 8;
+    scanner_context->_max_bytes_in_queue = 100 * 1024 * 1024;
+
+    // No feedback yet, keep _max_scan_concurrency.
+    scanner_context->_adjust_scan_concurrency();
+    ASSERT_EQ(scanner_context->_current_max_scan_concurrency(), 4);
+
+    // The consumer is starved and scanners mostly wait for io, scale up by half.
+    scanner_context->_scan_feedback = {.rounds = 1,
+                                       .wait_worker_time_ns = 1000,
+                                       .run_time_ns = 10000,
+                                       .cpu_time_ns = 1000,
+                                       .consumer_starved = 1};
+    scanner_context->_last_adjust_concurrency_ns = 0;
+    scanner_context->_adjust_scan_concurrency();
+    ASSERT_EQ(scanner_context->_current_max_scan_concurrency(), 6);
+    ASSERT_EQ(adaptive_concurrency_counter->value(), 6);
+
+    // Adjusted within the interval, nothing changes.
+    scanner_context->_scan_feedback = {.rounds = 1, .run_time_ns = 10000, .consumer_starved = 1};
+    scanner_context->_adjust_scan_concurrency();
+    ASSERT_EQ(scanner_context->_current_max_scan_concurrency(), 6);
+
+    // Cpu bound scanners scale up one by one, but never beyond the upper bound.
+    for (int i = 0; i < 5; ++i) {
+        scanner_context->_scan_feedback = {
+                .rounds = 1, .run_time_ns = 10000, .cpu_time_ns = 10000, .consumer_starved = 1};
+        scanner_context->_last_adjust_concurrency_ns = 0;
+        scanner_context->_adjust_scan_concurrency();
+    }
+    ASSERT_EQ(scanner_context->_current_max_scan_concurrency(), 8);
+
+    // Scan tasks wait for workers longer than they run, do not scale up.
+    scanner_context->_adaptive_scan_concurrency = 6;
+    scanner_context->_scan_feedback = {.rounds = 1,
+                                       .wait_worker_time_ns = 20000,
+                                       .run_time_ns = 10000,
+                                       .consumer_starved = 1};
+    scanner_context->_last_adjust_concurrency_ns = 0;
+    scanner_context->_adjust_scan_concurrency();
+    ASSERT_EQ(scanner_context->_current_max_scan_concurrency(), 6);
+
+    // Ready blocks pile up in memory, scale down.
+    scanner_context->_block_memory_usage = 90 * 1024 * 1024;
+    scanner_context->_scan_feedback = {.rounds = 1, .run_time_ns = 10000};
+    scanner_context->_last_adjust_concurrency_ns = 0;
+    scanner_context->_adjust_scan_concurrency();
+    ASSERT_EQ(scanner_context->_current_max_scan_concurrency(), 5);
+
+    // Never below _min_scan_concurrency.
+    for (int i = 0; i < 10; ++i) {
+        scanner_context->_scan_feedback = {.rounds = 1, .run_time_ns = 10000};
+        scanner_context->_last_adjust_concurrency_ns = 0;
+        scanner_context->_adjust_scan_concurrency();
+    }
+    ASSERT_EQ(scanner_context->_current_max_scan_concurrency(), 1);
+}
+
 } // namespace doris::vectorized
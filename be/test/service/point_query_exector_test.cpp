@@ -15,19 +15,40 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <bvar/variable.h>
 #include <gen_cpp/AgentService_types.h>
 #include <gtest/gtest.h>
 
+#include <chrono>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "common/config.h"
+#include "common/consts.h"
+#include "common/exception.h"
 #include "common/object_pool.h"
 #include "gen_cpp/Descriptors_types.h"
 #include "gen_cpp/Types_types.h"
 #include "gen_cpp/internal_service.pb.h"
+#include "io/fs/local_file_system.h"
+#include "olap/data_dir.h"
+#include "olap/rowset/rowset_factory.h"
+#include "olap/rowset/rowset_writer.h"
+#include "olap/rowset/rowset_writer_context.h"
+#include "olap/storage_engine.h"
+#include "olap/tablet.h"
+#include "olap/tablet_meta.h"
 #include "olap/tablet_schema.h"
 #include "runtime/descriptor_helper.h"
 #include "runtime/descriptors.h"
 #include "runtime/exec_env.h"
 #include "runtime/runtime_state.h"
 #include "service/point_query_executor.h"
+#include "util/debug_points.h"
+#include "vec/columns/column_string.h"
+#include "vec/columns/column_vector.h"
 #include "vec/core/block.h"
 #include "vec/exprs/vexpr.h"
 
@@ -419,4 +440,246 @@ TEST_F(LookupConnectionCacheTest, PQTestEntryLifetime) {
     EXPECT_EQ(entry.use_count(), 2) << "Cache should maintain sole ownership after scope exit";
 }
 
+// Concurrent point queries of a tablet that look up their keys in one batch. The tablet has no
+// rowset, so no key is found, but every lookup runs.
+class PointQueryBatchTest : public testing::Test {
+protected:
+    void SetUp() override {
+        _saved_window_us = config::point_query_batch_window_us;
+        _saved_wait_timeout_ms = config::point_query_batch_wait_timeout_ms;
+        _saved_enable_debug_points = config::enable_debug_points;
+        _saved_disable_row_cache = config::disable_storage_row_cache;
+        config::disable_storage_row_cache = true;
+        _engine = std::make_unique<StorageEngine>(EngineOptions {});
+        _tablet = std::make_shared<Tablet>(*_engine, std::make_shared<TabletMeta>(), nullptr);
+    }
+
+    void TearDown() override {
+        config::point_query_batch_window_us = _saved_window_us;
+        config::point_query_batch_wait_timeout_ms = _saved_wait_timeout_ms;
+        config::enable_debug_points = _saved_enable_debug_points;
+        config::disable_storage_row_cache = _saved_disable_row_cache;
+        DebugPoints::instance()->clear();
+    }
+
+    std::unique_ptr<PointQueryExecutor> create_executor(const std::string& key) {
+        auto executor = std::make_unique<PointQueryExecutor>();
+        executor->_tablet = _tablet;
+        executor->_row_read_ctxs.resize(1);
+        executor->_row_read_ctxs[0]._primary_key = key;
+        return executor;
+    }
+
+    static int64_t bvar_value(const std::string& name) {
+        return std::stoll(bvar::Variable::describe_exposed("point_query_" + name));
+    }
+
+    int32_t _saved_window_us;
+    int32_t _saved_wait_timeout_ms;
+    bool _saved_enable_debug_points;
+    bool _saved_disable_row_cache;
+    std::unique_ptr<StorageEngine> _engine;
+    TabletSharedPtr _tablet;
+};
+
+TEST_F(PointQueryBatchTest, JoinBatch) {
+    config::point_query_batch_window_us = 500 * 1000;
+    auto batched_requests = bvar_value("batched_requests");
+    auto first = create_executor("k0");
+    Status first_st;
+    std::thread first_thread([&]() { first_st = first->_batched_lookup_row_key(); });
+    // let the first request open the batch
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+    std::vector<std::unique_ptr<PointQueryExecutor>> executors;
+    std::vector<Status> statuses(3);
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 3; ++i) {
+        executors.push_back(create_executor("k" + std::to_string(i + 1)));
+    }
+    for (int i = 0; i < 3; ++i) {
+        threads.emplace_back([&, i]() { statuses[i] = executors[i]->_batched_lookup_row_key(); });
+    }
+    first_thread.join();
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    ASSERT_TRUE(first_st.ok()) << first_st;
+    for (const auto& st : statuses) {
+        ASSERT_TRUE(st.ok()) << st;
+    }
+    EXPECT_EQ(bvar_value("batched_requests") - batched_requests, 3);
+}
+
+TEST_F(PointQueryBatchTest, FirstRequestThrows) {
+    config::point_query_batch_window_us = 300 * 1000;
+    config::enable_debug_points = true;
+    DebugPoints::instance()->add("PointQueryExecutor._batched_lookup_row_key.throw");
+    auto first = create_executor("k0");
+    std::thread first_thread([&]() {
+        EXPECT_THROW(static_cast<void>(first->_batched_lookup_row_key()), Exception);
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+    // the joined request is woken up with an error instead of waiting forever
+    auto joined = create_executor("k1");
+    auto st = joined->_batched_lookup_row_key();
+    first_thread.join();
+    EXPECT_FALSE(st.ok());
+}
+
+TEST_F(PointQueryBatchTest, JoinedRequestTimesOut) {
+    config::point_query_batch_window_us = 2 * 1000 * 1000;
+    config::point_query_batch_wait_timeout_ms = 100;
+    auto timeouts = bvar_value("batch_wait_timeouts");
+    auto first = create_executor("k0");
+    Status first_st;
+    std::thread first_thread([&]() { first_st = first->_batched_lookup_row_key(); });
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+    // the batch does not start its lookup in time, so the joined request looks up alone
+    auto joined = create_executor("k1");
+    auto start = std::chrono::steady_clock::now();
+    auto st = joined->_batched_lookup_row_key();
+    auto waited = std::chrono::steady_clock::now() - start;
+    ASSERT_TRUE(st.ok()) << st;
+    EXPECT_LT(waited, std::chrono::seconds(1));
+    EXPECT_EQ(bvar_value("batch_wait_timeouts") - timeouts, 1);
+    // the executor is gone before the batch looks up its keys
+    joined.reset();
+
+    first_thread.join();
+    ASSERT_TRUE(first_st.ok()) << first_st;
+}
+
+
+// Multi-key point queries read the row store values of rows in the same segment in one batch.
+class PointQueryRowStoreTest : public testing::Test {
+protected:
+    void SetUp() override {
+        _saved_disable_row_cache = config::disable_storage_row_cache;
+        config::disable_storage_row_cache = true;
+        char buffer[1024];
+        EXPECT_NE(getcwd(buffer, sizeof(buffer)), nullptr);
+        _absolute_dir = std::string(buffer) + "/ut_dir/point_query_row_store";
+        EXPECT_TRUE(io::global_local_filesystem()->delete_directory(_absolute_dir).ok());
+        EXPECT_TRUE(io::global_local_filesystem()->create_directory(_absolute_dir).ok());
+        _engine = std::make_unique<StorageEngine>(EngineOptions {});
+        _data_dir = std::make_unique<DataDir>(*_engine, _absolute_dir);
+        static_cast<void>(_data_dir->update_capacity());
+
+        TabletSchemaPB schema_pb;
+        schema_pb.set_keys_type(KeysType::DUP_KEYS);
+        auto* key = schema_pb.add_column();
+        key->set_unique_id(0);
+        key->set_name("k");
+        key->set_type("INT");
+        key->set_is_key(true);
+        key->set_is_nullable(false);
+        auto* row_store = schema_pb.add_column();
+        row_store->set_unique_id(1);
+        row_store->set_name(BeConsts::ROW_STORE_COL);
+        row_store->set_type("STRING");
+        row_store->set_is_key(false);
+        row_store->set_is_nullable(false);
+        row_store->set_length(2147483643);
+        _tablet_schema = std::make_shared<TabletSchema>();
+        _tablet_schema->init_from_pb(schema_pb);
+        _tablet = std::make_shared<Tablet>(*_engine, std::make_shared<TabletMeta>(_tablet_schema),
+                                           _data_dir.get());
+        EXPECT_TRUE(_tablet->init().ok());
+        EXPECT_TRUE(io::global_local_filesystem()->create_directory(_tablet->tablet_path()).ok());
+
+        RowsetWriterContext context;
+        context.rowset_id.init(10000);
+        context.rowset_type = BETA_ROWSET;
+        context.data_dir = _data_dir.get();
+        context.rowset_state = VISIBLE;
+        context.tablet_schema = _tablet_schema;
+        context.tablet_path = _tablet->tablet_path();
+        context.version = Version(2, 2);
+        auto writer = RowsetFactory::create_rowset_writer(*_engine, context, false);
+        ASSERT_TRUE(writer.has_value()) << writer.error();
+        auto block = _tablet_schema->create_block();
+        auto columns = block.mutate_columns();
+        for (int32_t i = 0; i < kRows; ++i) {
+            assert_cast<vectorized::ColumnInt32&>(*columns[0]).insert_value(i);
+            auto value = row_value(i);
+            columns[1]->insert_data(value.data(), value.size());
+        }
+        block.set_columns(std::move(columns));
+        ASSERT_TRUE(writer.value()->add_block(&block).ok());
+        ASSERT_TRUE(writer.value()->flush().ok());
+        ASSERT_TRUE(writer.value()->build(_rowset).ok());
+    }
+
+    void TearDown() override {
+        config::disable_storage_row_cache = _saved_disable_row_cache;
+        EXPECT_TRUE(io::global_local_filesystem()->delete_directory(_absolute_dir).ok());
+    }
+
+    static std::string row_value(int32_t row) { return "row store value " + std::to_string(row); }
+
+    static constexpr int32_t kRows = 4096;
+    bool _saved_disable_row_cache;
+    std::string _absolute_dir;
+    std::unique_ptr<StorageEngine> _engine;
+    std::unique_ptr<DataDir> _data_dir;
+    TabletSchemaSPtr _tablet_schema;
+    TabletSharedPtr _tablet;
+    RowsetSharedPtr _rowset;
+};
+
+TEST_F(PointQueryRowStoreTest, LookupRowDataBatch) {
+    std::vector<segment_v2::rowid_t> row_ids {0, 7, 8, 2048, 4095};
+    OlapReaderStatistics stats;
+    vectorized::MutableColumnPtr values;
+    ASSERT_TRUE(_tablet->lookup_row_data_batch(_rowset, 0, row_ids, stats, values).ok());
+    ASSERT_EQ(values->size(), row_ids.size());
+    for (size_t i = 0; i < row_ids.size(); ++i) {
+        // the same value as a single row lookup
+        std::string single;
+        ASSERT_TRUE(_tablet->lookup_row_data({}, RowLocation(_rowset->rowset_id(), 0, row_ids[i]),
+                                             _rowset, stats, single)
+                            .ok());
+        EXPECT_EQ(values->get_data_at(i).to_string(), single);
+        EXPECT_EQ(single, row_value(row_ids[i]));
+    }
+
+    EXPECT_FALSE(_tablet->lookup_row_data_batch(_rowset, 1, row_ids, stats, values).ok());
+}
+
+TEST_F(PointQueryRowStoreTest, BatchLookupRowStore) {
+    PointQueryExecutor executor;
+    executor._tablet = _tablet;
+    // keys of an IN list in request order, one of them twice and one not found
+    std::vector<std::optional<uint32_t>> rows {3000, 5, std::nullopt, 3000, 17};
+    executor._row_read_ctxs.resize(rows.size());
+    for (size_t i = 0; i < rows.size(); ++i) {
+        auto& ctx = executor._row_read_ctxs[i];
+        ctx._primary_key = "k" + std::to_string(i);
+        if (rows[i].has_value()) {
+            ctx._row_location = RowLocation(_rowset->rowset_id(), 0, *rows[i]);
+            _rowset->acquire();
+            ctx._rowset_ptr.reset(new RowsetSharedPtr(_rowset));
+        }
+    }
+    ASSERT_TRUE(executor._batch_lookup_row_store().ok());
+    for (size_t i = 0; i < rows.size(); ++i) {
+        const auto& ctx = executor._row_read_ctxs[i];
+        if (rows[i].has_value()) {
+            ASSERT_TRUE(ctx._row_store_value.has_value()) << i;
+            EXPECT_EQ(*ctx._row_store_value, row_value(*rows[i]));
+        } else {
+            EXPECT_FALSE(ctx._row_store_value.has_value());
+        }
+    }
+
+    // a single row of a segment is left to lookup_row_data
+    executor._row_read_ctxs.resize(1);
+    executor._row_read_ctxs[0]._row_store_value.reset();
+    ASSERT_TRUE(executor._batch_lookup_row_store().ok());
+    EXPECT_FALSE(executor._row_read_ctxs[0]._row_store_value.has_value());
+}
+
 } // namespace doris
@@ -25,6 +25,7 @@
 #include <string>
 #include <vector>
 
+#include "common/cast_set.h"
 #include "gtest/gtest_pred_impl.h"
 #include "util/bit_stream_utils.inline.h"
 #include "util/bit_util.h"
@@ -218,4 +219,34 @@ TEST(TestBitStreamUtil, TestUint64) {
     reader.GetValue(16, &v4);
     EXPECT_EQ(v4, 126);
 }
+
+TEST(TestBitStreamUtil, TestGetBatch) {
+    const int num_values = 100;
+    for (int num_bits = 1; num_bits <= 32; ++num_bits) {
+        faststring buffer(1);
+        BitWriter writer(&buffer);
+        // A leading 3-bit value makes the batch start in the middle of a byte.
+        writer.PutValue(5, 3);
+        for (int i = 0; i < num_values; ++i) {
+            writer.PutValue(i % (1ULL << num_bits), num_bits);
+        }
+        writer.PutValue(1, 1);
+        writer.Flush();
+
+        BitReader reader(buffer.data(), cast_set<int>(buffer.size()));
+        int32_t head;
+        EXPECT_TRUE(reader.GetValue(3, &head));
+        EXPECT_EQ(head, 5);
+
+        std::vector<int32_t> values(num_values);
+        EXPECT_EQ(reader.GetBatch(num_bits, num_values, values.data()), num_values);
+        for (int i = 0; i < num_values; ++i) {
+            EXPECT_EQ(values[i], static_cast<int32_t>(i % (1ULL << num_bits)))
+                    << "num_bits=" << num_bits;
+        }
+        bool tail = false;
+        EXPECT_TRUE(reader.GetValue(1, &tail));
+        EXPECT_TRUE(tail);
+    }
+}
 } // namespace doris
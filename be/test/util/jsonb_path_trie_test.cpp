@@ -0,0 +1,81 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "util/jsonb_path_trie.h"
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#include "runtime/jsonb_value.h"
+#include "util/jsonb_document.h"
+#include "util/jsonb_utils.h"
+
+namespace doris {
+
+class JsonbPathTrieTest : public testing::Test {
+protected:
+    static const JsonbValue* parse(JsonBinaryValue& jsonb, std::string_view json) {
+        EXPECT_TRUE(jsonb.from_json_string(json.data(), json.size()).ok());
+        JsonbDocument* doc = nullptr;
+        EXPECT_TRUE(JsonbDocument::checkAndCreateDocument(jsonb.value(), jsonb.size(), &doc).ok());
+        return doc->getValue();
+    }
+
+    static std::string to_json(const JsonbValue* value) {
+        return value ? JsonbToJson().to_json_string(value) : "<null>";
+    }
+};
+
+TEST_F(JsonbPathTrieTest, SameAsFindValue) {
+    JsonBinaryValue jsonb;
+    const auto* root = parse(jsonb, R"({"a":{"x":1,"y":[10,20,30],"z":"s"},"b":2,"a2":null,)"
+                                    R"("c":[{"k":1},{"k":2}],"b":3})");
+    std::vector<std::string> path_strs = {"$.a.x",  "$.a.y[1]", "$.a.y[last]", "$.b",
+                                          "$.a.z",  "$.c[1].k", "$.missing",   "$.a.x",
+                                          "$.b[0]", "$",        "$.a.y[5]",    "$.a2"};
+    std::vector<JsonbPath> paths(path_strs.size());
+    JsonbPathTrie trie;
+    for (size_t i = 0; i < path_strs.size(); ++i) {
+        ASSERT_TRUE(paths[i].seek(path_strs[i].data(), path_strs[i].size()));
+        ASSERT_TRUE(trie.add_path(paths[i], i));
+    }
+    ASSERT_EQ(trie.num_slots(), path_strs.size());
+
+    std::vector<const JsonbValue*> values;
+    trie.find_values(root, values);
+    ASSERT_EQ(values.size(), path_strs.size());
+    for (size_t i = 0; i < path_strs.size(); ++i) {
+        EXPECT_EQ(to_json(values[i]), to_json(root->findValue(paths[i]).value)) << path_strs[i];
+    }
+    EXPECT_EQ(to_json(values[0]), "1");
+    EXPECT_EQ(values[6], nullptr);
+}
+
+TEST_F(JsonbPathTrieTest, RejectWildcard) {
+    JsonbPathTrie trie;
+    for (std::string path_str : {"$.*", "$.a[*]", "$**.a"}) {
+        JsonbPath path;
+        if (path.seek(path_str.data(), path_str.size())) {
+            EXPECT_FALSE(trie.add_path(path, 0)) << path_str;
+        }
+    }
+    EXPECT_EQ(trie.num_slots(), 0U);
+}
+
+} // namespace doris
@@ -299,6 +299,23 @@ TEST(StringToInt, Int8_Exhaustive) {
     }
 }
 
+TEST(StringToInt, EightDigitChunks) {
+    test_int_value<int32_t>("123456789", 123456789, StringParser::PARSE_SUCCESS);
+    test_int_value<int32_t>("-000000001", -1, StringParser::PARSE_SUCCESS);
+    test_int_value<int64_t>("12345678901234567", 12345678901234567LL, StringParser::PARSE_SUCCESS);
+    test_int_value<int64_t>("-98765432109876543", -98765432109876543LL,
+                            StringParser::PARSE_SUCCESS);
+    test_int_value<int64_t>("999999999999999999", 999999999999999999LL,
+                            StringParser::PARSE_SUCCESS);
+    // A non-digit inside a chunk falls back to the per-digit loop.
+    test_int_value<int64_t>("1234567x90123", 0, StringParser::PARSE_FAILURE);
+    test_int_value<int64_t>("123456789012:4", 0, StringParser::PARSE_FAILURE);
+    test_int_value<int64_t>("1234567890 12", 0, StringParser::PARSE_FAILURE);
+    test_int_value<int64_t>("123456789.123456", 123456789, StringParser::PARSE_SUCCESS);
+    test_unsigned_int_value<uint64_t>("123456789012345678", 123456789012345678ULL,
+                                      StringParser::PARSE_SUCCESS);
+}
+
 TEST(StringToIntWithBase, Basic) {
     test_int_value<int8_t>("123", 10, 123, StringParser::PARSE_SUCCESS);
     test_int_value<int16_t>("123", 10, 123, StringParser::PARSE_SUCCESS);
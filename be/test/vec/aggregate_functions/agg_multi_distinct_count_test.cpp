@@ -0,0 +1,88 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <gtest/gtest.h>
+
+#include "agg_function_test.h"
+#include "vec/aggregate_functions/aggregate_function_uniq.h"
+#include "vec/data_types/data_type_number.h"
+
+namespace doris::vectorized {
+
+struct AggregateFunctionMultiDistinctCountTest : public AggregateFunctiontest {};
+
+TEST_F(AggregateFunctionMultiDistinctCountTest, test_int64) {
+    create_agg("multi_distinct_count", false, {std::make_shared<DataTypeInt64>()});
+
+    execute(Block({ColumnHelper::create_column_with_name<DataTypeInt64>({1, 2, 2, 3, -1, 1})}),
+            ColumnHelper::create_column_with_name<DataTypeInt64>({4}));
+}
+
+TEST_F(AggregateFunctionMultiDistinctCountTest, test_int64_many_keys) {
+    create_agg("multi_distinct_count", false, {std::make_shared<DataTypeInt64>()});
+
+    std::vector<Int64> values;
+    for (Int64 i = 0; i < 10000; ++i) {
+        values.push_back(i % 5000 - 2500);
+    }
+    execute(Block({ColumnHelper::create_column_with_name<DataTypeInt64>(values)}),
+            ColumnHelper::create_column_with_name<DataTypeInt64>({5000}));
+}
+
+TEST(AggregateFunctionUniqExactDataTest, inline_set_and_bitmap) {
+    using Data = AggregateFunctionUniqExactData<TYPE_BIGINT>;
+    Data data;
+    for (Int64 i = 0; i < 4; ++i) {
+        data.insert(i);
+        data.insert(i);
+    }
+    EXPECT_EQ(data.size(), 4);
+    EXPECT_TRUE(data.set.empty());
+
+    for (Int64 i = -5000; i < 5000; ++i) {
+        data.insert(i);
+    }
+    EXPECT_TRUE(data.is_bitmap());
+    EXPECT_EQ(data.size(), 10000);
+
+    Data sparse;
+    for (Int64 i = 0; i < 10000; ++i) {
+        sparse.insert(i * 1000);
+    }
+    EXPECT_FALSE(sparse.is_bitmap());
+    EXPECT_EQ(sparse.size(), 10000);
+
+    sparse.merge(data);
+    EXPECT_TRUE(sparse.is_bitmap());
+    // 0..4000 step 1000 are in both
+    EXPECT_EQ(sparse.size(), 19995);
+
+    Int64 min_key = std::numeric_limits<Int64>::max();
+    size_t num_keys = 0;
+    data.for_each([&](Int64 key) {
+        min_key = std::min(min_key, key);
+        ++num_keys;
+    });
+    EXPECT_EQ(min_key, -5000);
+    EXPECT_EQ(num_keys, 10000);
+
+    data.reset();
+    EXPECT_FALSE(data.is_bitmap());
+    EXPECT_EQ(data.size(), 0);
+}
+
+} // namespace doris::vectorized
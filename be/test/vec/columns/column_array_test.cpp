@@ -871,6 +871,48 @@ TEST_F(ColumnArrayTest, String64ArrayTest) {
     EXPECT_EQ(get<std::string>(v[0]), vals[3]);
 }
 
+TEST_F(ColumnArrayTest, StringArrayFilterRunsTest) {
+    // [["a","bc"],[],["d"],["ef","g","h"],[""],["ij"]]
+    std::vector<std::vector<std::string>> rows = {{"a", "bc"}, {}, {"d"}, {"ef", "g", "h"},
+                                                  {""},        {"ij"}};
+    auto str_array_column = ColumnArray::create(ColumnString::create());
+    for (const auto& row : rows) {
+        Array arr;
+        for (const auto& v : row) {
+            arr.push_back(Field::create_field<TYPE_STRING>(v));
+        }
+        str_array_column->insert(Field::create_field<TYPE_ARRAY>(arr));
+    }
+
+    IColumn::Filter filter = {1, 1, 0, 1, 1, 0};
+    auto res = str_array_column->filter(filter, -1);
+    std::vector<size_t> expected_rows = {0, 1, 3, 4};
+    ASSERT_EQ(res->size(), expected_rows.size());
+    for (size_t i = 0; i < expected_rows.size(); ++i) {
+        auto v = get<Array>(res->operator[](i));
+        const auto& expected = rows[expected_rows[i]];
+        ASSERT_EQ(v.size(), expected.size());
+        for (size_t j = 0; j < v.size(); ++j) {
+            EXPECT_EQ(get<std::string>(v[j]), expected[j]);
+        }
+    }
+
+    // gather rows, including repeated and empty ones
+    std::vector<uint32_t> indices = {5, 1, 3, 3, 0};
+    auto gathered = ColumnArray::create(ColumnString::create());
+    gathered->insert_indices_from(*str_array_column, indices.data(),
+                                  indices.data() + indices.size());
+    ASSERT_EQ(gathered->size(), indices.size());
+    for (size_t i = 0; i < indices.size(); ++i) {
+        auto v = get<Array>(gathered->operator[](i));
+        const auto& expected = rows[indices[i]];
+        ASSERT_EQ(v.size(), expected.size());
+        for (size_t j = 0; j < v.size(); ++j) {
+            EXPECT_EQ(get<std::string>(v[j]), expected[j]);
+        }
+    }
+}
+
 TEST_F(ColumnArrayTest, IntArrayPermuteTest) {
     auto off_column = ColumnOffset64::create();
     auto data_column = ColumnInt32::create();
@@ -919,6 +919,37 @@ TEST_F(ColumnStringTest, filter) {
         EXPECT_THROW(column_str64->filter(filter), Exception);
     }
 }
+TEST_F(ColumnStringTest, filter_runs) {
+    // runs of kept rows inside and across the 32 rows blocks the filter is processed in
+    auto source = ColumnString::create();
+    const size_t rows = 100;
+    for (size_t i = 0; i < rows; ++i) {
+        auto value = std::string(i % 7, static_cast<char>('a' + i % 26));
+        source->insert_data(value.data(), value.size());
+    }
+    IColumn::Filter filter(rows, 0);
+    for (size_t i = 0; i < rows; ++i) {
+        filter[i] = (i % 10 < 4) || (i >= 40 && i < 70) || i == rows - 1;
+    }
+
+    auto check = [&](const IColumn& res) {
+        size_t res_row = 0;
+        for (size_t i = 0; i < rows; ++i) {
+            if (filter[i]) {
+                ASSERT_LT(res_row, res.size());
+                EXPECT_EQ(res.get_data_at(res_row).to_string(),
+                          source->get_data_at(i).to_string());
+                ++res_row;
+            }
+        }
+        EXPECT_EQ(res_row, res.size());
+    };
+    check(*source->filter(filter, -1));
+
+    auto inplace = source->clone();
+    inplace->filter(filter);
+    check(*inplace);
+}
 TEST_F(ColumnStringTest, filter_by_selector) {
     auto test_func = [&](const auto& source_column) {
         auto src_size = source_column->size();
@@ -177,6 +177,30 @@ TEST_F(ColumnVariantTest, basic_finalize) {
     }
 }
 
+TEST_F(ColumnVariantTest, pick_subcolumns_prefers_materialized_paths) {
+    auto variant = VariantUtil::construct_basic_varint_column();
+    variant->finalize(ColumnVariant::FinalizeMode::WRITE_MODE);
+    // v.b.d only has values in half of the rows and would be pushed to the sparse column
+    std::unordered_set<std::string> preferred_paths {"v.b.d"};
+    EXPECT_TRUE(variant->pick_subcolumns_to_sparse_column({}, false, preferred_paths).ok());
+    EXPECT_EQ(variant->subcolumns.size(), 6);
+    EXPECT_NE(variant->get_subcolumn(PathInData("v.b.d")), nullptr);
+
+    const auto& [path, value] = variant->get_sparse_data_paths_and_values();
+    for (size_t i = 0; i < path->size(); ++i) {
+        EXPECT_NE(path->get_data_at(i), StringRef("v.b.d", 5));
+    }
+    // one of the dense paths gives way to v.b.d, v.c.d and v.d.d stay sparse
+    const auto& offsets = variant->serialized_sparse_column_offsets();
+    EXPECT_EQ(offsets[0], 1);
+    for (int row = 1; row < 5; ++row) {
+        EXPECT_EQ(offsets[row] - offsets[row - 1], 1);
+    }
+    for (int row = 5; row < 10; ++row) {
+        EXPECT_EQ(offsets[row] - offsets[row - 1], 3);
+    }
+}
+
 // TEST
 TEST_F(ColumnVariantTest, basic_deserialize) {
     auto variant = VariantUtil::construct_basic_varint_column();
@@ -0,0 +1,153 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "vec/common/column_buffer_pool.h"
+
+#include <gtest/gtest.h>
+
+#include <future>
+#include <thread>
+
+#include "common/config.h"
+#include "vec/common/allocator.h"
+#include "vec/common/pod_array.h"
+
+namespace doris {
+
+class ColumnBufferPoolTest : public testing::Test {
+protected:
+    void SetUp() override {
+        _enable = config::enable_column_buffer_pool;
+        _thread_cache_bytes = config::column_buffer_pool_thread_cache_bytes;
+        config::enable_column_buffer_pool = true;
+        ColumnBufferPool::thread_local_pool()->clear();
+    }
+
+    void TearDown() override {
+        ColumnBufferPool::thread_local_pool()->clear();
+        config::enable_column_buffer_pool = _enable;
+        config::column_buffer_pool_thread_cache_bytes = _thread_cache_bytes;
+    }
+
+    bool _enable = false;
+    int64_t _thread_cache_bytes = 0;
+};
+
+TEST_F(ColumnBufferPoolTest, PooledSize) {
+    EXPECT_FALSE(ColumnBufferPool::is_pooled_size(2048));
+    EXPECT_TRUE(ColumnBufferPool::is_pooled_size(4096));
+    EXPECT_FALSE(ColumnBufferPool::is_pooled_size(4096 + 16));
+    EXPECT_TRUE(ColumnBufferPool::is_pooled_size(ColumnBufferPool::MAX_BUFFER_BYTES));
+    EXPECT_FALSE(ColumnBufferPool::is_pooled_size(ColumnBufferPool::MAX_BUFFER_BYTES * 2));
+}
+
+TEST_F(ColumnBufferPoolTest, AllocatorReusesFreedBuffer) {
+    Allocator<false, false, false, DefaultMemoryAllocator, true> allocator;
+    auto* pool = ColumnBufferPool::thread_local_pool();
+
+    void* buf = allocator.alloc(8192);
+    allocator.free(buf, 8192);
+    EXPECT_EQ(pool->cached_bytes(), 8192);
+
+    // Another size class does not hit the cached buffer.
+    void* other = allocator.alloc(4096);
+    EXPECT_NE(other, buf);
+    EXPECT_EQ(pool->cached_bytes(), 8192);
+
+    void* reused = allocator.alloc(8192);
+    EXPECT_EQ(reused, buf);
+    EXPECT_EQ(pool->cached_bytes(), 0);
+
+    allocator.free(other, 4096);
+    allocator.free(reused, 8192);
+    EXPECT_EQ(pool->cached_bytes(), 4096 + 8192);
+}
+
+TEST_F(ColumnBufferPoolTest, PODArrayReusesFreedBuffer) {
+    const void* data = nullptr;
+    {
+        vectorized::PaddedPODArray<uint64_t> arr;
+        arr.resize(1000);
+        data = arr.data();
+    }
+    EXPECT_GT(ColumnBufferPool::thread_local_pool()->cached_bytes(), 0);
+    vectorized::PaddedPODArray<uint64_t> arr;
+    arr.resize(1000);
+    EXPECT_EQ(arr.data(), data);
+    EXPECT_EQ(ColumnBufferPool::thread_local_pool()->cached_bytes(), 0);
+}
+
+TEST_F(ColumnBufferPoolTest, ClearedMemoryIsNotPooled) {
+    Allocator<true, false, false, DefaultMemoryAllocator, true> allocator;
+    void* buf = allocator.alloc(8192);
+    allocator.free(buf, 8192);
+    EXPECT_EQ(ColumnBufferPool::thread_local_pool()->cached_bytes(), 0);
+}
+
+TEST_F(ColumnBufferPoolTest, HighWaterMark) {
+    config::column_buffer_pool_thread_cache_bytes = 8192;
+    auto* pool = ColumnBufferPool::thread_local_pool();
+    void* buf1 = DefaultMemoryAllocator::malloc(4096);
+    void* buf2 = DefaultMemoryAllocator::malloc(4096);
+    void* buf3 = DefaultMemoryAllocator::malloc(4096);
+    EXPECT_TRUE(pool->put(buf1, 4096));
+    EXPECT_TRUE(pool->put(buf2, 4096));
+    EXPECT_FALSE(pool->put(buf3, 4096));
+    DefaultMemoryAllocator::free(buf3);
+    EXPECT_EQ(pool->cached_bytes(), 8192);
+}
+
+TEST_F(ColumnBufferPoolTest, PurgeAll) {
+    auto* pool = ColumnBufferPool::thread_local_pool();
+    EXPECT_TRUE(pool->put(DefaultMemoryAllocator::malloc(4096), 4096));
+    EXPECT_EQ(pool->cached_bytes(), 4096);
+
+    ColumnBufferPool::purge_all();
+    EXPECT_EQ(pool->take(4096), nullptr);
+    EXPECT_EQ(pool->cached_bytes(), 0);
+
+    ColumnBufferPool::set_memory_pressure(true);
+    void* buf = DefaultMemoryAllocator::malloc(4096);
+    EXPECT_FALSE(pool->put(buf, 4096));
+    DefaultMemoryAllocator::free(buf);
+    ColumnBufferPool::set_memory_pressure(false);
+}
+
+TEST_F(ColumnBufferPoolTest, PurgeAllFreesIdleThreads) {
+    int64_t before = ColumnBufferPool::total_cached_bytes();
+    std::promise<ColumnBufferPool*> cached;
+    std::promise<void> purged;
+    std::thread idle([&]() {
+        auto* pool = ColumnBufferPool::thread_local_pool();
+        EXPECT_TRUE(pool->put(DefaultMemoryAllocator::malloc(8192), 8192));
+        cached.set_value(pool);
+        purged.get_future().wait();
+    });
+    auto* pool = cached.get_future().get();
+    EXPECT_EQ(pool->cached_bytes(), 8192);
+    EXPECT_EQ(ColumnBufferPool::total_cached_bytes(), before + 8192);
+
+    // The idle thread never touches its pool again, the purge has to free it from here.
+    ColumnBufferPool::purge_all();
+    EXPECT_EQ(pool->cached_bytes(), 0);
+    EXPECT_EQ(ColumnBufferPool::total_cached_bytes(), before);
+
+    purged.set_value();
+    idle.join();
+}
+
+} // namespace doris
@@ -716,6 +716,91 @@ TEST(BlockTest, SerializeAndDeserializeBlock) {
     serialize_and_deserialize_test_one();
 }
 
+TEST(BlockTest, SerializeAndDeserializeColumnWise) {
+    auto int_col = vectorized::ColumnInt32::create();
+    auto low_card_col = vectorized::ColumnString::create();
+    auto high_card_col = vectorized::ColumnString::create();
+    auto nullable_col = vectorized::ColumnNullable::create(vectorized::ColumnString::create(),
+                                                           vectorized::ColumnUInt8::create());
+    for (int i = 0; i < 1024; ++i) {
+        int_col->insert_value(i);
+        std::string low = "city_" + std::to_string(i % 8);
+        low_card_col->insert_data(low.c_str(), low.size());
+        std::string high = std::to_string(i);
+        high_card_col->insert_data(high.c_str(), high.size());
+        if (i % 3 == 0) {
+            nullable_col->insert_default();
+        } else {
+            nullable_col->insert_data(low.c_str(), low.size());
+        }
+    }
+    vectorized::DataTypePtr int_type(std::make_shared<vectorized::DataTypeInt32>());
+    vectorized::DataTypePtr str_type(std::make_shared<vectorized::DataTypeString>());
+    vectorized::DataTypePtr nullable_type(std::make_shared<vectorized::DataTypeNullable>(str_type));
+    vectorized::Block block({{int_col->get_ptr(), int_type, "k"},
+                             {low_card_col->get_ptr(), str_type, "low"},
+                             {high_card_col->get_ptr(), str_type, "high"},
+                             {nullable_col->get_ptr(), nullable_type, "nullable"}});
+
+    for (auto compression_type : {segment_v2::CompressionTypePB::NO_COMPRESSION,
+                                  segment_v2::CompressionTypePB::LZ4,
+                                  segment_v2::CompressionTypePB::ZSTD}) {
+        PBlock row_wise;
+        size_t uncompressed_bytes = 0;
+        size_t compressed_bytes = 0;
+        ASSERT_TRUE(block.serialize(BeExecVersionManager::get_newest_version(), &row_wise,
+                                    &uncompressed_bytes, &compressed_bytes, compression_type)
+                            .ok());
+        const size_t row_wise_bytes = compressed_bytes;
+
+        PBlock column_wise;
+        ASSERT_TRUE(block.serialize(BeExecVersionManager::get_newest_version(), &column_wise,
+                                    &uncompressed_bytes, &compressed_bytes, compression_type,
+                                    false, true)
+                            .ok());
+        EXPECT_TRUE(column_wise.compressed());
+        EXPECT_EQ(column_wise.compression_type(), segment_v2::CompressionTypePB::NO_COMPRESSION);
+        EXPECT_EQ(compressed_bytes, column_wise.column_values().size());
+        if (compression_type == segment_v2::CompressionTypePB::NO_COMPRESSION) {
+            // the dictionaries alone must beat the plain layout
+            EXPECT_LT(compressed_bytes, row_wise_bytes);
+        }
+
+        vectorized::Block block2;
+        ASSERT_TRUE(block2.deserialize(column_wise).ok());
+        EXPECT_EQ(block.dump_data(), block2.dump_data());
+        EXPECT_EQ(block.dump_names(), block2.dump_names());
+    }
+
+    // corrupted payload is rejected instead of decoded
+    PBlock column_wise;
+    size_t uncompressed_bytes = 0;
+    size_t compressed_bytes = 0;
+    ASSERT_TRUE(block.serialize(BeExecVersionManager::get_newest_version(), &column_wise,
+                                &uncompressed_bytes, &compressed_bytes,
+                                segment_v2::CompressionTypePB::LZ4, false, true)
+                        .ok());
+    // projection only decodes the wanted columns, for both layouts
+    PBlock row_wise;
+    ASSERT_TRUE(block.serialize(BeExecVersionManager::get_newest_version(), &row_wise,
+                                &uncompressed_bytes, &compressed_bytes,
+                                segment_v2::CompressionTypePB::LZ4)
+                        .ok());
+    for (const auto* pblock : {&column_wise, &row_wise}) {
+        vectorized::Block projected;
+        ASSERT_TRUE(projected.deserialize(*pblock, {0, 2}).ok());
+        ASSERT_EQ(projected.columns(), 2);
+        EXPECT_EQ(projected.dump_names(), "k, high");
+        EXPECT_EQ(projected.get_by_position(1).column->get_data_at(5).to_string(), "5");
+        EXPECT_EQ(projected.rows(), 1024);
+        EXPECT_FALSE(projected.deserialize(*pblock, {1, 4}).ok());
+    }
+
+    column_wise.mutable_column_values()->resize(column_wise.column_values().size() / 2);
+    vectorized::Block block3;
+    EXPECT_FALSE(block3.deserialize(column_wise).ok());
+}
+
 TEST(BlockTest, dump_data) {
     auto vec = vectorized::ColumnInt32::create();
     auto& int32_data = vec->get_data();
@@ -0,0 +1,93 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "vec/core/sort_cursor.h"
+
+#include <gtest/gtest.h>
+
+#include "testutil/column_helper.h"
+#include "vec/data_types/data_type_nullable.h"
+#include "vec/data_types/data_type_number.h"
+#include "vec/data_types/data_type_string.h"
+
+namespace doris::vectorized {
+
+class SortCursorTest : public testing::Test {
+protected:
+    // Compares every row pair of lhs and rhs with and without key prefixes.
+    static void check_same_order(const Block& lhs, const Block& rhs, int direction,
+                                 int nulls_direction, bool expect_exact) {
+        SortDescription desc {SortColumnDescription(0, direction, nulls_direction),
+                              SortColumnDescription(1, 1, 1)};
+        MergeSortCursor plain_lhs(
+                MergeSortCursorImpl::create_shared(Block::create_shared(lhs), desc));
+        MergeSortCursor plain_rhs(
+                MergeSortCursorImpl::create_shared(Block::create_shared(rhs), desc));
+        MergeSortCursor prefix_lhs(
+                MergeSortCursorImpl::create_shared(Block::create_shared(lhs), desc));
+        MergeSortCursor prefix_rhs(
+                MergeSortCursorImpl::create_shared(Block::create_shared(rhs), desc));
+        prefix_lhs->enable_key_prefix();
+        prefix_rhs->enable_key_prefix();
+        ASSERT_EQ(prefix_lhs->key_prefixes.size(), lhs.rows());
+        EXPECT_EQ(prefix_lhs->key_prefix_exact, expect_exact);
+
+        for (size_t i = 0; i < lhs.rows(); ++i) {
+            for (size_t j = 0; j < rhs.rows(); ++j) {
+                EXPECT_EQ(plain_lhs.greater_at(plain_rhs, i, j),
+                          prefix_lhs.greater_at(prefix_rhs, i, j))
+                        << "row " << i << " vs row " << j;
+            }
+        }
+    }
+};
+
+TEST_F(SortCursorTest, IntegerPrefix) {
+    Block lhs {ColumnHelper::create_column_with_name<DataTypeInt32>({-5, 0, 3, 3, INT32_MIN}),
+               ColumnHelper::create_column_with_name<DataTypeInt32>({1, 2, 3, 4, 5})};
+    Block rhs {ColumnHelper::create_column_with_name<DataTypeInt32>({3, -1, INT32_MAX, 0}),
+               ColumnHelper::create_column_with_name<DataTypeInt32>({3, 1, 1, 2})};
+    check_same_order(lhs, rhs, 1, 1, true);
+    check_same_order(lhs, rhs, -1, -1, true);
+}
+
+TEST_F(SortCursorTest, NullablePrefix) {
+    Block lhs {ColumnHelper::create_nullable_column_with_name<DataTypeInt64>({0, INT64_MIN, 7, 0},
+                                                                             {1, 0, 0, 0}),
+               ColumnHelper::create_column_with_name<DataTypeInt32>({1, 2, 3, 4})};
+    Block rhs {ColumnHelper::create_nullable_column_with_name<DataTypeInt64>({INT64_MAX, 0, 7},
+                                                                             {0, 1, 0}),
+               ColumnHelper::create_column_with_name<DataTypeInt32>({1, 2, 3})};
+    for (int direction : {1, -1}) {
+        for (int nulls_direction : {1, -1}) {
+            check_same_order(lhs, rhs, direction, nulls_direction, false);
+        }
+    }
+}
+
+TEST_F(SortCursorTest, StringPrefix) {
+    Block lhs {ColumnHelper::create_column_with_name<DataTypeString>(
+                       {"", "abc", "abcdefgh1", "abcdefgh", "b"}),
+               ColumnHelper::create_column_with_name<DataTypeInt32>({1, 2, 3, 4, 5})};
+    Block rhs {ColumnHelper::create_column_with_name<DataTypeString>(
+                       {"abcdefgh2", "ab", std::string("a\0", 2), "abc"}),
+               ColumnHelper::create_column_with_name<DataTypeInt32>({1, 2, 3, 2})};
+    check_same_order(lhs, rhs, 1, 1, false);
+    check_same_order(lhs, rhs, -1, 1, false);
+}
+
+} // namespace doris::vectorized
@@ -22,6 +22,7 @@
 
 #include <cmath>
 #include <cstddef>
+#include <cstring>
 #include <iostream>
 #include <limits>
 #include <type_traits>
@@ -31,6 +32,8 @@
 #include "util/slice.h"
 #include "util/string_util.h"
 #include "vec/columns/column.h"
+#include "vec/columns/column_nullable.h"
+#include "vec/columns/column_string.h"
 #include "vec/common/assert_cast.h"
 #include "vec/core/types.h"
 #include "vec/data_types/common_data_type_serder_test.h"
@@ -283,4 +286,20 @@ TEST_F(DataTypeNumberSerDeTest, serdes) {
     test_func(*serde_int128, column_int128);
     test_func(*serde_uint8, column_uint8);
 }
+
+TEST_F(DataTypeNumberSerDeTest, from_string_strict_mode_batch_with_null_map) {
+    auto str_col = ColumnString::create();
+    for (const auto& s : {"12", "not a number", "123456789012", "-7"}) {
+        str_col->insert_data(s, strlen(s));
+    }
+    NullMap null_map = {0, 1, 0, 0};
+    auto int_col = ColumnInt64::create();
+    DataTypeSerDe::FormatOptions option;
+    auto st = serde_int64->from_string_strict_mode_batch(*str_col, *int_col, option,
+                                                         null_map.data());
+    ASSERT_TRUE(st.ok()) << st;
+    EXPECT_EQ(int_col->get_element(0), 12);
+    EXPECT_EQ(int_col->get_element(2), 123456789012L);
+    EXPECT_EQ(int_col->get_element(3), -7);
+}
 } // namespace doris::vectorized
\ No newline at end of file
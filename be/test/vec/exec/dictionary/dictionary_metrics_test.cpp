@@ -0,0 +1,72 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <gtest/gtest.h>
+
+#include <memory>
+
+#include "testutil/column_helper.h"
+#include "vec/core/columns_with_type_and_name.h"
+#include "vec/data_types/data_type_number.h"
+#include "vec/functions/complex_hash_map_dictionary.h"
+#include "vec/functions/dictionary.h"
+#include "vec/functions/dictionary_factory.h"
+
+namespace doris::vectorized {
+
+static DictionaryPtr create_test_dict() {
+    return create_complex_hash_map_dict_from_column(
+            "dict_metrics",
+            ColumnsWithTypeAndName {{ColumnHelper::create_column<DataTypeInt32>({1, 2, 3}),
+                                     std::make_shared<DataTypeInt32>(), ""}},
+            ColumnsWithTypeAndName {{ColumnHelper::create_column<DataTypeInt32>({10, 20, 30}),
+                                     std::make_shared<DataTypeInt32>(), "v"}});
+}
+
+TEST(DictionaryMetricsTest, test) {
+    auto dict_factory = std::make_shared<DictionaryFactory>();
+    auto dict = create_test_dict();
+    EXPECT_TRUE(dict_factory->refresh_dict(1, 1, dict));
+    EXPECT_TRUE(dict_factory->commit_refresh_dict(1, 1));
+
+    auto metrics = dict_factory->_dict_id_to_metrics_map[1];
+    ASSERT_NE(metrics, nullptr);
+    EXPECT_EQ(metrics->dictionary_refresh_count->value(), 1);
+    EXPECT_EQ(metrics->dictionary_memory_bytes->value(),
+              static_cast<int64_t>(dict->allocated_bytes()));
+
+    auto found = dict_factory->get(1, 1);
+    ASSERT_NE(found, nullptr);
+    EXPECT_EQ(dict_factory->get(1, 2), nullptr);
+    found->record_lookup(100, 2000);
+    found->record_lookup(50, 1000);
+    EXPECT_EQ(metrics->dictionary_lookup_count->value(), 2);
+    EXPECT_EQ(metrics->dictionary_lookup_rows->value(), 150);
+    EXPECT_EQ(metrics->dictionary_lookup_time_ns->value(), 3000);
+
+    // the metrics survive a refresh of the same dictionary
+    EXPECT_TRUE(dict_factory->refresh_dict(1, 2, create_test_dict()));
+    EXPECT_TRUE(dict_factory->commit_refresh_dict(1, 2));
+    EXPECT_EQ(dict_factory->_dict_id_to_metrics_map[1], metrics);
+    EXPECT_EQ(metrics->dictionary_refresh_count->value(), 2);
+    EXPECT_EQ(metrics->dictionary_lookup_rows->value(), 150);
+
+    EXPECT_TRUE(dict_factory->delete_dict(1));
+    EXPECT_FALSE(dict_factory->_dict_id_to_metrics_map.contains(1));
+}
+
+} // namespace doris::vectorized
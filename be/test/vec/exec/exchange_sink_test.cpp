@@ -22,7 +22,9 @@
 #include <memory>
 #include <vector>
 
+#include "common/config.h"
 #include "pipeline/exec/exchange_sink_buffer.h"
+#include "util/defer_op.h"
 
 namespace doris::vectorized {
 using namespace pipeline;
@@ -235,4 +237,50 @@ TEST_F(ExchangeSInkTest, test_queue_size) {
     }
 }
 
+TEST_F(ExchangeSInkTest, test_credit_flow_control) {
+    {
+        auto old_credit_bytes = config::exchange_sink_credit_bytes_per_instance;
+        config::exchange_sink_credit_bytes_per_instance = 100;
+        Defer restore([&]() {
+            config::exchange_sink_credit_bytes_per_instance = old_credit_bytes;
+        });
+        auto state = create_runtime_state();
+        auto buffer = create_buffer(state);
+        auto dep = std::make_shared<Dependency>(0, 0, "ExchangeSinkQueueDependency", true);
+        buffer->set_dependency(0, dep, nullptr);
+
+        auto sink1 = create_sink(state, buffer);
+        auto add_block = [&](int64_t id) {
+            auto block = std::make_unique<PBlock>();
+            block->set_column_values(std::string(60, 'x'));
+            TransmitInfo transmitInfo {.block = std::move(block), .eos = false};
+            return buffer->add_block(sink1.channels[id].get(), std::move(transmitInfo));
+        };
+
+        // the first block is in flight and still holds its credits
+        EXPECT_EQ(add_block(dest_ins_id_1), Status::OK());
+        EXPECT_TRUE(dep->ready());
+        EXPECT_EQ(add_block(dest_ins_id_2), Status::OK());
+        EXPECT_TRUE(dep->ready());
+
+        // the second block to instance 1 exhausts its credits
+        EXPECT_EQ(add_block(dest_ins_id_1), Status::OK());
+        EXPECT_FALSE(dep->ready());
+        EXPECT_TRUE(buffer->_rpc_instances[dest_ins_id_1]->credit_starved);
+        EXPECT_FALSE(buffer->_rpc_instances[dest_ins_id_2]->credit_starved);
+
+        // an accepted rpc of another instance does not wake up the sinks
+        pop_block(dest_ins_id_2, PopState::accept);
+        EXPECT_FALSE(dep->ready());
+
+        // the reply of instance 1 grants its credits back
+        pop_block(dest_ins_id_1, PopState::accept);
+        EXPECT_TRUE(dep->ready());
+        EXPECT_FALSE(buffer->_rpc_instances[dest_ins_id_1]->credit_starved);
+        EXPECT_EQ(buffer->_credit_starved_count, 1);
+        EXPECT_EQ(buffer->_credit_starved_instances, 0);
+        clear_all_done();
+    }
+}
+
 } // namespace doris::vectorized
@@ -0,0 +1,225 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "vec/exec/format/avro/avro_decoder.h"
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#include "vec/columns/column_nullable.h"
+#include "vec/columns/column_string.h"
+#include "vec/columns/column_vector.h"
+#include "vec/common/assert_cast.h"
+#include "vec/data_types/data_type_nullable.h"
+#include "vec/data_types/data_type_number.h"
+#include "vec/data_types/data_type_string.h"
+
+namespace doris::vectorized {
+
+class AvroDecoderTest : public testing::Test {
+protected:
+    void write_long(int64_t value) {
+        auto n = (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63);
+        while (n >= 0x80) {
+            _buf.push_back(static_cast<char>((n & 0x7f) | 0x80));
+            n >>= 7;
+        }
+        _buf.push_back(static_cast<char>(n));
+    }
+
+    void write_string(const std::string& value) {
+        write_long(static_cast<int64_t>(value.size()));
+        _buf += value;
+    }
+
+    void write_double(double value) {
+        _buf.append(reinterpret_cast<const char*>(&value), sizeof(value));
+    }
+
+    std::string _buf;
+};
+
+TEST_F(AvroDecoderTest, ReadLong) {
+    std::vector<int64_t> values = {0, 1, -1, 63, -64, 64, 300, -300, INT32_MAX, INT32_MIN,
+                                   INT64_MAX, INT64_MIN};
+    for (auto value : values) {
+        write_long(value);
+    }
+    AvroDecoder decoder(_buf.data(), _buf.size());
+    for (auto value : values) {
+        int64_t result = 0;
+        ASSERT_TRUE(decoder.read_long(&result).ok());
+        EXPECT_EQ(value, result);
+    }
+    EXPECT_EQ(0, decoder.remaining());
+    int64_t result = 0;
+    EXPECT_FALSE(decoder.read_long(&result).ok());
+
+    _buf.clear();
+    write_long(static_cast<int64_t>(INT32_MAX) + 1);
+    AvroDecoder int_decoder(_buf.data(), _buf.size());
+    int32_t int_result = 0;
+    EXPECT_FALSE(int_decoder.read_int(&int_result).ok());
+}
+
+TEST_F(AvroDecoderTest, ParseSchema) {
+    AvroSchema schema;
+    ASSERT_TRUE(schema.parse(R"({"type": "record", "name": "node", "namespace": "test",
+            "fields": [
+                {"name": "id", "type": "long"},
+                {"name": "kind", "type": {"type": "enum", "name": "Kind", "symbols": ["A", "B"]}},
+                {"name": "next", "type": ["null", "test.node"]},
+                {"name": "same_kind", "type": "Kind"},
+                {"name": "ts", "type": {"type": "long", "logicalType": "timestamp-millis"}}
+            ]})")
+                        .ok());
+    const auto* root = schema.root();
+    ASSERT_EQ(AvroSchemaNode::Type::RECORD, root->type);
+    ASSERT_EQ(5, root->children.size());
+    EXPECT_EQ("kind", root->field_names[1]);
+    EXPECT_EQ(AvroSchemaNode::Type::ENUM, root->children[1]->type);
+    EXPECT_EQ(root, root->children[2]->children[1]);
+    EXPECT_EQ(root->children[1], root->children[3]);
+    EXPECT_TRUE(root->children[4]->has_logical_type);
+
+    AvroSchema invalid_schema;
+    EXPECT_FALSE(invalid_schema.parse(R"({"type": "unknown_type"})").ok());
+    EXPECT_FALSE(invalid_schema.parse("not json").ok());
+}
+
+TEST_F(AvroDecoderTest, DecodeRecords) {
+    AvroSchema schema;
+    ASSERT_TRUE(schema.parse(R"({"type": "record", "name": "r", "fields": [
+                {"name": "ID", "type": "int"},
+                {"name": "tags", "type": {"type": "array", "items": "string"}},
+                {"name": "name", "type": ["null", "string"]},
+                {"name": "props", "type": {"type": "map", "values": "long"}},
+                {"name": "color", "type": {"type": "enum", "name": "c", "symbols": ["R", "G"]}},
+                {"name": "score", "type": ["double", "null"]}
+            ]})")
+                        .ok());
+    // 2 records, tags and props are not read
+    for (int i = 0; i < 2; ++i) {
+        write_long(i + 10);
+        // a tags block with a negative count and a byte size, then the end of the array
+        std::string tag_block;
+        std::swap(tag_block, _buf);
+        write_string("x");
+        write_string("yz");
+        std::swap(tag_block, _buf);
+        write_long(-2);
+        write_long(static_cast<int64_t>(tag_block.size()));
+        _buf += tag_block;
+        write_long(0);
+        if (i == 0) {
+            write_long(1);
+            write_string("alice");
+        } else {
+            write_long(0);
+        }
+        write_long(1);
+        write_string("k");
+        write_long(42);
+        write_long(0);
+        write_long(i);
+        if (i == 0) {
+            write_long(0);
+            write_double(1.5);
+        } else {
+            write_long(1);
+        }
+    }
+
+    std::vector<std::string> names = {"id", "name", "color", "score", "not_in_file"};
+    DataTypes types = {std::make_shared<DataTypeInt64>(),
+                       make_nullable(std::make_shared<DataTypeString>()),
+                       make_nullable(std::make_shared<DataTypeString>()),
+                       make_nullable(std::make_shared<DataTypeFloat64>()),
+                       make_nullable(std::make_shared<DataTypeString>())};
+    AvroRecordDecoder record_decoder;
+    std::vector<std::string> missing_columns;
+    ASSERT_TRUE(record_decoder.init(schema.root(), names, types, &missing_columns).ok());
+    ASSERT_EQ(1, missing_columns.size());
+    EXPECT_EQ("not_in_file", missing_columns[0]);
+
+    MutableColumns columns;
+    std::vector<IColumn*> column_ptrs;
+    for (size_t i = 0; i < types.size() - 1; ++i) {
+        columns.emplace_back(types[i]->create_column());
+        column_ptrs.push_back(columns.back().get());
+    }
+    column_ptrs.push_back(nullptr);
+
+    AvroDecoder decoder(_buf.data(), _buf.size());
+    ASSERT_TRUE(record_decoder.decode(decoder, 2, column_ptrs).ok());
+    EXPECT_EQ(0, decoder.remaining());
+
+    const auto& id_column = assert_cast<const ColumnInt64&>(*columns[0]);
+    EXPECT_EQ(10, id_column.get_element(0));
+    EXPECT_EQ(11, id_column.get_element(1));
+
+    const auto& name_column = assert_cast<const ColumnNullable&>(*columns[1]);
+    EXPECT_FALSE(name_column.is_null_at(0));
+    EXPECT_EQ("alice", name_column.get_nested_column().get_data_at(0).to_string());
+    EXPECT_TRUE(name_column.is_null_at(1));
+
+    const auto& color_column = assert_cast<const ColumnNullable&>(*columns[2]);
+    EXPECT_EQ("R", color_column.get_nested_column().get_data_at(0).to_string());
+    EXPECT_EQ("G", color_column.get_nested_column().get_data_at(1).to_string());
+
+    const auto& score_column = assert_cast<const ColumnNullable&>(*columns[3]);
+    EXPECT_DOUBLE_EQ(1.5, assert_cast<const ColumnFloat64&>(score_column.get_nested_column())
+                                  .get_element(0));
+    EXPECT_TRUE(score_column.is_null_at(1));
+
+    // a truncated record is an error
+    AvroDecoder truncated_decoder(_buf.data(), _buf.size() - 1);
+    for (auto& column : columns) {
+        column->clear();
+    }
+    EXPECT_FALSE(record_decoder.decode(truncated_decoder, 2, column_ptrs).ok());
+}
+
+TEST_F(AvroDecoderTest, UnsupportedColumns) {
+    AvroSchema schema;
+    ASSERT_TRUE(schema.parse(R"({"type": "record", "name": "r", "fields": [
+                {"name": "l", "type": "long"},
+                {"name": "arr", "type": {"type": "array", "items": "int"}},
+                {"name": "d", "type": {"type": "int", "logicalType": "date"}},
+                {"name": "u", "type": ["int", "string"]},
+                {"name": "n", "type": ["null", "int"]}
+            ]})")
+                        .ok());
+    auto check = [&](const std::string& name, const DataTypePtr& type) {
+        AvroRecordDecoder record_decoder;
+        std::vector<std::string> missing_columns;
+        return record_decoder.init(schema.root(), {name}, {type}, &missing_columns);
+    };
+    auto int_type = std::make_shared<DataTypeInt32>();
+    auto string_type = make_nullable(std::make_shared<DataTypeString>());
+    EXPECT_TRUE(check("l", int_type).is<ErrorCode::NOT_IMPLEMENTED_ERROR>());
+    EXPECT_TRUE(check("arr", string_type).is<ErrorCode::NOT_IMPLEMENTED_ERROR>());
+    EXPECT_TRUE(check("d", int_type).is<ErrorCode::NOT_IMPLEMENTED_ERROR>());
+    EXPECT_TRUE(check("u", string_type).is<ErrorCode::NOT_IMPLEMENTED_ERROR>());
+    EXPECT_TRUE(check("n", int_type).is<ErrorCode::NOT_IMPLEMENTED_ERROR>());
+    EXPECT_TRUE(check("n", make_nullable(int_type)).ok());
+    EXPECT_TRUE(check("l", std::make_shared<DataTypeInt64>()).ok());
+}
+
+} // namespace doris::vectorized
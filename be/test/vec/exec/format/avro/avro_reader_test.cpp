@@ -0,0 +1,337 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "vec/exec/format/avro/avro_reader.h"
+
+#include <gen_cpp/PlanNodes_types.h>
+#include <gen_cpp/Types_types.h>
+#include <gtest/gtest.h>
+#include <snappy.h>
+#include <zlib.h>
+#include <zstd.h>
+
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "common/object_pool.h"
+#include "io/fs/local_file_system.h"
+#include "runtime/descriptors.h"
+#include "runtime/runtime_state.h"
+#include "testutil/desc_tbl_builder.h"
+#include "util/runtime_profile.h"
+#include "vec/columns/column_nullable.h"
+#include "vec/columns/column_string.h"
+#include "vec/columns/column_vector.h"
+#include "vec/common/assert_cast.h"
+#include "vec/core/block.h"
+#include "vec/data_types/data_type_factory.hpp"
+
+namespace doris::vectorized {
+
+namespace {
+const std::string TEST_DIR = "./ut_dir/avro_reader_test";
+const std::string SCHEMA = R"({"type":"record","name":"row","fields":[)"
+                           R"({"name":"id","type":"long"},)"
+                           R"({"name":"name","type":["null","string"]}]})";
+const std::string SYNC_MARKER = "0123456789abcdef";
+const std::string NULL_NAME = "NULL";
+
+std::string name_of(int64_t id) {
+    return id % 3 == 0 ? NULL_NAME : "name_" + std::to_string(id);
+}
+
+void encode_long(std::string* buf, int64_t value) {
+    auto n = (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63);
+    while (n >= 0x80) {
+        buf->push_back(static_cast<char>((n & 0x7f) | 0x80));
+        n >>= 7;
+    }
+    buf->push_back(static_cast<char>(n));
+}
+
+void encode_string(std::string* buf, const std::string& value) {
+    encode_long(buf, static_cast<int64_t>(value.size()));
+    buf->append(value);
+}
+
+// Writes an object container file the way the java DataFileWriter lays it out: the header
+// with the metadata map and the sync marker, then blocks of records each followed by the marker.
+class AvroFileBuilder {
+public:
+    explicit AvroFileBuilder(std::string codec) : _codec(std::move(codec)) {}
+
+    void add_meta(const std::string& key, const std::string& value) {
+        _meta.emplace_back(key, value);
+    }
+
+    // Adds a block with the records [first_id, first_id + num_records).
+    void add_block(int64_t first_id, int64_t num_records) {
+        std::string data;
+        for (int64_t id = first_id; id < first_id + num_records; ++id) {
+            encode_long(&data, id);
+            std::string name = name_of(id);
+            if (name == NULL_NAME) {
+                encode_long(&data, 0);
+            } else {
+                encode_long(&data, 1);
+                encode_string(&data, name);
+            }
+        }
+        std::string block = _compress(data);
+        encode_long(&_blocks, num_records);
+        encode_long(&_blocks, static_cast<int64_t>(block.size()));
+        _blocks.append(block);
+        _blocks.append(SYNC_MARKER);
+    }
+
+    std::string build() const {
+        std::string file = std::string("Obj") + '\x01';
+        encode_long(&file, static_cast<int64_t>(_meta.size() + 2));
+        encode_string(&file, "avro.schema");
+        encode_string(&file, SCHEMA);
+        encode_string(&file, "avro.codec");
+        encode_string(&file, _codec);
+        for (const auto& [key, value] : _meta) {
+            encode_string(&file, key);
+            encode_string(&file, value);
+        }
+        encode_long(&file, 0);
+        file.append(SYNC_MARKER);
+        return file + _blocks;
+    }
+
+private:
+    std::string _compress(const std::string& data) const {
+        if (_codec == "deflate") {
+            z_stream stream {};
+            EXPECT_EQ(Z_OK, deflateInit2(&stream, Z_DEFAULT_COMPRESSION, Z_DEFLATED, -MAX_WBITS,
+                                         8, Z_DEFAULT_STRATEGY));
+            std::string out(deflateBound(&stream, data.size()), '\0');
+            stream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(data.data()));
+            stream.avail_in = static_cast<uInt>(data.size());
+            stream.next_out = reinterpret_cast<Bytef*>(out.data());
+            stream.avail_out = static_cast<uInt>(out.size());
+            EXPECT_EQ(Z_STREAM_END, deflate(&stream, Z_FINISH));
+            out.resize(stream.total_out);
+            deflateEnd(&stream);
+            return out;
+        }
+        if (_codec == "snappy") {
+            std::string out;
+            snappy::Compress(data.data(), data.size(), &out);
+            auto crc = static_cast<uint32_t>(crc32(0, reinterpret_cast<const Bytef*>(data.data()),
+                                                   static_cast<uInt>(data.size())));
+            for (int shift = 24; shift >= 0; shift -= 8) {
+                out.push_back(static_cast<char>((crc >> shift) & 0xff));
+            }
+            return out;
+        }
+        if (_codec == "zstandard") {
+            std::string out(ZSTD_compressBound(data.size()), '\0');
+            size_t size = ZSTD_compress(out.data(), out.size(), data.data(), data.size(), 3);
+            EXPECT_FALSE(ZSTD_isError(size));
+            out.resize(size);
+            return out;
+        }
+        return data;
+    }
+
+    std::string _codec;
+    std::vector<std::pair<std::string, std::string>> _meta;
+    std::string _blocks;
+};
+} // namespace
+
+class AvroReaderTest : public testing::Test {
+protected:
+    struct ReadResult {
+        size_t num_rows = 0;
+        std::vector<int64_t> ids;
+        std::vector<std::string> names;
+    };
+
+    void SetUp() override {
+        ASSERT_TRUE(io::global_local_filesystem()->delete_directory(TEST_DIR).ok());
+        ASSERT_TRUE(io::global_local_filesystem()->create_directory(TEST_DIR).ok());
+        _state = RuntimeState::create_unique();
+        DescriptorTblBuilder builder(&_pool);
+        builder.declare_tuple() << std::make_tuple<DataTypePtr, std::string>(
+                                           DataTypeFactory::instance().create_data_type(
+                                                   PrimitiveType::TYPE_BIGINT, true),
+                                           "id")
+                                << std::make_tuple<DataTypePtr, std::string>(
+                                           DataTypeFactory::instance().create_data_type(
+                                                   PrimitiveType::TYPE_STRING, true),
+                                           "name");
+        _slots = builder.build()->get_tuple_descriptor(0)->slots();
+    }
+
+    void TearDown() override {
+        EXPECT_TRUE(io::global_local_filesystem()->delete_directory(TEST_DIR).ok());
+    }
+
+    std::string write_file(const std::string& name, const std::string& content) {
+        std::string path = TEST_DIR + "/" + name;
+        std::ofstream out(path, std::ios::binary);
+        out.write(content.data(), static_cast<std::streamsize>(content.size()));
+        return path;
+    }
+
+    // Reads the range [start_offset, start_offset + size), a size of 0 reads the whole file.
+    Status read_range(const std::string& path, size_t start_offset, size_t size,
+                      ReadResult* result,
+                      TPushAggOp::type push_down_agg_type = TPushAggOp::type::NONE) {
+        TFileScanRangeParams params;
+        params.file_type = TFileType::FILE_LOCAL;
+        TFileRangeDesc range;
+        range.path = path;
+        range.start_offset = static_cast<int64_t>(start_offset);
+        range.size = static_cast<int64_t>(size);
+        auto reader = AvroReader::create_unique(_state.get(), &_profile, params, range, _slots,
+                                                nullptr);
+        reader->set_push_down_agg_type(push_down_agg_type);
+        RETURN_IF_ERROR(reader->init_reader());
+        bool eof = false;
+        while (!eof) {
+            Block block;
+            for (const auto* slot : _slots) {
+                block.insert(ColumnWithTypeAndName(slot->get_data_type_ptr()->create_column(),
+                                                   slot->get_data_type_ptr(), slot->col_name()));
+            }
+            size_t read_rows = 0;
+            RETURN_IF_ERROR(reader->get_next_block(&block, &read_rows, &eof));
+            result->num_rows += read_rows;
+            if (push_down_agg_type == TPushAggOp::type::COUNT) {
+                EXPECT_EQ(block.rows(), read_rows);
+                continue;
+            }
+            const auto& ids = assert_cast<const ColumnNullable&>(*block.get_by_name("id").column);
+            const auto& names =
+                    assert_cast<const ColumnNullable&>(*block.get_by_name("name").column);
+            for (size_t i = 0; i < read_rows; ++i) {
+                EXPECT_FALSE(ids.is_null_at(i));
+                result->ids.push_back(
+                        assert_cast<const ColumnInt64&>(ids.get_nested_column()).get_element(i));
+                const auto& name_data = names.get_nested_column();
+                result->names.push_back(names.is_null_at(i) ? NULL_NAME
+                                                            : name_data.get_data_at(i).to_string());
+            }
+        }
+        return Status::OK();
+    }
+
+    static void check_rows(const ReadResult& result, int64_t num_rows) {
+        ASSERT_EQ(result.num_rows, static_cast<size_t>(num_rows));
+        ASSERT_EQ(result.ids.size(), static_cast<size_t>(num_rows));
+        for (int64_t id = 0; id < num_rows; ++id) {
+            ASSERT_EQ(result.ids[id], id);
+            ASSERT_EQ(result.names[id], name_of(id));
+        }
+    }
+
+    ObjectPool _pool;
+    std::unique_ptr<RuntimeState> _state;
+    RuntimeProfile _profile {"AvroReaderTest"};
+    std::vector<SlotDescriptor*> _slots;
+};
+
+TEST_F(AvroReaderTest, Codecs) {
+    for (const std::string codec : {"null", "deflate", "snappy", "zstandard"}) {
+        AvroFileBuilder builder(codec);
+        // more records than a batch, so batches end inside a block
+        for (int64_t id = 0; id < 10000; id += 2500) {
+            builder.add_block(id, 2500);
+        }
+        std::string path = write_file(codec + ".avro", builder.build());
+        ReadResult result;
+        ASSERT_TRUE(read_range(path, 0, 0, &result).ok()) << codec;
+        check_rows(result, 10000);
+    }
+}
+
+TEST_F(AvroReaderTest, SplitRanges) {
+    AvroFileBuilder builder("null");
+    // the large blocks span several sync marker search windows
+    int64_t num_rows = 0;
+    for (int64_t block_rows : {500, 10000, 1, 500, 10000, 500}) {
+        builder.add_block(num_rows, block_rows);
+        num_rows += block_rows;
+    }
+    std::string file = builder.build();
+    std::string path = write_file("split.avro", file);
+    for (size_t num_ranges : {1, 2, 3, 7, 50, 1000}) {
+        size_t range_size = (file.size() + num_ranges - 1) / num_ranges;
+        ReadResult result;
+        for (size_t start = 0; start < file.size(); start += range_size) {
+            // every block is read by exactly the range its leading sync marker starts in
+            ASSERT_TRUE(read_range(path, start, std::min(range_size, file.size() - start), &result)
+                                .ok())
+                    << num_ranges << " " << start;
+        }
+        check_rows(result, num_rows);
+    }
+}
+
+TEST_F(AvroReaderTest, LargeHeader) {
+    // the header does not fit into the first read
+    AvroFileBuilder builder("snappy");
+    builder.add_meta("padding", std::string(300 * 1024, 'x'));
+    builder.add_block(0, 1000);
+    std::string path = write_file("large_header.avro", builder.build());
+    ReadResult result;
+    ASSERT_TRUE(read_range(path, 0, 0, &result).ok());
+    check_rows(result, 1000);
+
+    // the header read is bounded instead of growing to the whole file
+    AvroFileBuilder oversized("null");
+    oversized.add_meta("padding", std::string(17 * 1024 * 1024, 'x'));
+    oversized.add_block(0, 10);
+    path = write_file("oversized_header.avro", oversized.build());
+    ReadResult oversized_result;
+    EXPECT_TRUE(read_range(path, 0, 0, &oversized_result).is<ErrorCode::CORRUPTION>());
+}
+
+TEST_F(AvroReaderTest, CountPushDown) {
+    AvroFileBuilder builder("deflate");
+    for (int64_t id = 0; id < 9000; id += 3000) {
+        builder.add_block(id, 3000);
+    }
+    std::string path = write_file("count.avro", builder.build());
+    ReadResult result;
+    ASSERT_TRUE(read_range(path, 0, 0, &result, TPushAggOp::type::COUNT).ok());
+    EXPECT_EQ(result.num_rows, 9000);
+    EXPECT_TRUE(result.ids.empty());
+}
+
+TEST_F(AvroReaderTest, InvalidFiles) {
+    ReadResult result;
+    std::string path = write_file("not_avro.avro", "PAR1 this is not an avro file");
+    EXPECT_TRUE(read_range(path, 0, 0, &result).is<ErrorCode::CORRUPTION>());
+
+    AvroFileBuilder bzip2("bzip2");
+    path = write_file("bzip2.avro", bzip2.build());
+    EXPECT_TRUE(read_range(path, 0, 0, &result).is<ErrorCode::NOT_IMPLEMENTED_ERROR>());
+
+    AvroFileBuilder truncated("deflate");
+    truncated.add_block(0, 1000);
+    std::string file = truncated.build();
+    path = write_file("truncated.avro", file.substr(0, file.size() - 10));
+    EXPECT_TRUE(read_range(path, 0, 0, &result).is<ErrorCode::CORRUPTION>());
+}
+
+} // namespace doris::vectorized
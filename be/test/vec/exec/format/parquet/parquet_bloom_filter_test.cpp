@@ -0,0 +1,112 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "vec/exec/format/parquet/parquet_bloom_filter.h"
+
+#include <gen_cpp/parquet_types.h>
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#include "vec/exec/format/parquet/schema_desc.h"
+
+namespace doris::vectorized {
+
+class ParquetBloomFilterTest : public testing::Test {
+protected:
+    // Insert as described by the parquet spec, the reader only implements the lookup
+    static void insert(std::vector<uint32_t>& bitset, uint64_t hash) {
+        static constexpr uint32_t salt[8] = {0x47b6137bU, 0x44974d91U, 0x8824ad5bU,
+                                             0xa2b7289dU, 0x705495c7U, 0x2df1424bU,
+                                             0x9efc4947U, 0x5c6bfb31U};
+        uint64_t num_blocks = bitset.size() / 8;
+        uint64_t block_index = ((hash >> 32) * num_blocks) >> 32;
+        auto key = static_cast<uint32_t>(hash);
+        for (int i = 0; i < 8; ++i) {
+            bitset[block_index * 8 + i] |= 1U << ((key * salt[i]) >> 27);
+        }
+    }
+};
+
+TEST_F(ParquetBloomFilterTest, hash) {
+    // XXH64 of the empty input with seed 0
+    EXPECT_EQ(0xEF46DB3751D8E999ULL, ParquetBloomFilter::hash("", 0));
+}
+
+TEST_F(ParquetBloomFilterTest, find_hash) {
+    std::vector<uint32_t> bitset(64 * 8, 0);
+    std::vector<std::string> values = {"doris", "parquet", "bloom", "filter"};
+    for (const auto& value : values) {
+        insert(bitset, ParquetBloomFilter::hash(value.data(), value.size()));
+    }
+    ParquetBloomFilter bloom_filter;
+    ASSERT_TRUE(bloom_filter.init(bitset).ok());
+    for (const auto& value : values) {
+        EXPECT_TRUE(bloom_filter.find_hash(ParquetBloomFilter::hash(value.data(), value.size())));
+    }
+    int false_positives = 0;
+    for (int i = 0; i < 1000; ++i) {
+        auto value = "absent_" + std::to_string(i);
+        false_positives += bloom_filter.find_hash(ParquetBloomFilter::hash(value.data(),
+                                                                           value.size()));
+    }
+    EXPECT_LT(false_positives, 10);
+
+    EXPECT_FALSE(bloom_filter.init(std::vector<uint32_t>(7)).ok());
+}
+
+TEST_F(ParquetBloomFilterTest, predicate_hashes) {
+    FieldSchema int_schema;
+    int_schema.physical_type = tparquet::Type::INT32;
+    ColumnValueRange<TYPE_INT> int_range("c1");
+    ASSERT_TRUE(int_range.add_fixed_value(7).ok());
+    ASSERT_TRUE(int_range.add_fixed_value(9).ok());
+    std::vector<uint64_t> hashes;
+    ASSERT_TRUE(ParquetBloomFilter::get_predicate_hashes(int_range, &int_schema, &hashes));
+    int32_t seven = 7;
+    ASSERT_EQ(2, hashes.size());
+    EXPECT_EQ(ParquetBloomFilter::hash(&seven, sizeof(seven)), hashes[0]);
+
+    // physical type does not match the predicate type
+    hashes.clear();
+    int_schema.physical_type = tparquet::Type::INT64;
+    EXPECT_FALSE(ParquetBloomFilter::get_predicate_hashes(int_range, &int_schema, &hashes));
+
+    // decimal stored in int32 is not checked
+    int_schema.physical_type = tparquet::Type::INT32;
+    int_schema.parquet_schema.__set_converted_type(tparquet::ConvertedType::DECIMAL);
+    EXPECT_FALSE(ParquetBloomFilter::get_predicate_hashes(int_range, &int_schema, &hashes));
+
+    // range predicates can not be checked
+    ColumnValueRange<TYPE_BIGINT> bigint_range("c2");
+    ASSERT_TRUE(bigint_range.add_range(FILTER_LARGER, 10).ok());
+    FieldSchema bigint_schema;
+    bigint_schema.physical_type = tparquet::Type::INT64;
+    EXPECT_FALSE(ParquetBloomFilter::get_predicate_hashes(bigint_range, &bigint_schema, &hashes));
+
+    FieldSchema string_schema;
+    string_schema.physical_type = tparquet::Type::BYTE_ARRAY;
+    ColumnValueRange<TYPE_STRING> string_range("c3");
+    std::string value = "doris";
+    ASSERT_TRUE(string_range.add_fixed_value(StringRef(value)).ok());
+    ASSERT_TRUE(ParquetBloomFilter::get_predicate_hashes(string_range, &string_schema, &hashes));
+    ASSERT_EQ(1, hashes.size());
+    EXPECT_EQ(ParquetBloomFilter::hash(value.data(), value.size()), hashes[0]);
+}
+
+} // namespace doris::vectorized
@@ -0,0 +1,109 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <cctz/time_zone.h>
+#include <gen_cpp/PlanNodes_types.h>
+#include <gen_cpp/parquet_types.h>
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+#include "exec/olap_common.h"
+#include "vec/exec/format/parquet/vparquet_file_metadata.h"
+#include "vec/exec/format/parquet/vparquet_reader.h"
+#include "vec/exec/format/table/table_format_reader.h"
+
+namespace doris::vectorized {
+
+class ParquetColumnStatFilterTest : public testing::Test {
+protected:
+    void SetUp() override {
+        tparquet::SchemaElement root;
+        root.__set_name("schema");
+        root.__set_num_children(1);
+        tparquet::SchemaElement column;
+        column.__set_name("c");
+        column.__set_type(tparquet::Type::INT32);
+        column.__set_repetition_type(tparquet::FieldRepetitionType::OPTIONAL);
+        _t_metadata.schema = {root, column};
+        _file_metadata = std::make_unique<FileMetaData>(_t_metadata, 0);
+        ASSERT_TRUE(_file_metadata->init_schema().ok());
+
+        // the row group holds the values [0, 10] of c
+        auto& chunk = _columns.emplace_back();
+        chunk.meta_data.num_values = 10;
+        chunk.meta_data.statistics.__set_null_count(0);
+        chunk.meta_data.statistics.__set_min_value(encode(0));
+        chunk.meta_data.statistics.__set_max_value(encode(10));
+
+        _reader = std::make_unique<ParquetReader>(_params, _range, nullptr, nullptr);
+        _reader->_file_metadata = _file_metadata.get();
+        _reader->_t_metadata = &_t_metadata;
+        _reader->_ctz = &_ctz;
+    }
+
+    static std::string encode(int32_t value) {
+        std::string buf(sizeof(value), '\0');
+        memcpy(buf.data(), &value, sizeof(value));
+        return buf;
+    }
+
+    static ColumnValueRange<TYPE_INT> range_from(const std::string& col_name, int32_t low) {
+        ColumnValueRange<TYPE_INT> range(col_name);
+        EXPECT_TRUE(range.add_range(FILTER_LARGER_OR_EQUAL, low).ok());
+        return range;
+    }
+
+    bool filter_group(const std::unordered_map<std::string, ColumnValueRangeType>& ranges) {
+        bool filter_group = false;
+        EXPECT_TRUE(_reader->_process_column_stat_filter(_columns, ranges, &filter_group).ok());
+        return filter_group;
+    }
+
+    TFileScanRangeParams _params;
+    TFileRangeDesc _range;
+    cctz::time_zone _ctz;
+    tparquet::FileMetaData _t_metadata;
+    std::unique_ptr<FileMetaData> _file_metadata;
+    std::vector<tparquet::ColumnChunk> _columns;
+    std::unique_ptr<ParquetReader> _reader;
+};
+
+TEST_F(ParquetColumnStatFilterTest, FilterByFileColumn) {
+    _reader->_read_table_columns = {"c"};
+    EXPECT_TRUE(filter_group({{"c", range_from("c", 100)}}));
+    EXPECT_FALSE(filter_group({{"c", range_from("c", 5)}}));
+}
+
+TEST_F(ParquetColumnStatFilterTest, SkipColumnMissingFromFile) {
+    // the table has a column added after the file was written
+    auto table_info = std::make_shared<TableSchemaChangeHelper::StructNode>();
+    table_info->add_not_exist_children("added");
+    table_info->add_children("c", "c", std::make_shared<TableSchemaChangeHelper::ScalarNode>());
+    _reader->_table_info_node_ptr = table_info;
+    _reader->_read_table_columns = {"added", "c"};
+
+    // the missing column has no statistics and must not filter the group
+    EXPECT_FALSE(filter_group({{"added", range_from("added", 100)}}));
+    EXPECT_TRUE(filter_group({{"added", range_from("added", 100)}, {"c", range_from("c", 100)}}));
+    EXPECT_FALSE(filter_group({{"added", range_from("added", 100)}, {"c", range_from("c", 5)}}));
+}
+
+} // namespace doris::vectorized
@@ -0,0 +1,47 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "vec/exec/format/table/equality_delete.h"
+
+#include <gtest/gtest.h>
+
+#include "testutil/column_helper.h"
+#include "vec/data_types/data_type_number.h"
+
+namespace doris::vectorized {
+
+TEST(EqualityDeleteTest, multi_column_delete) {
+    // (1, 10), (2, 20) and a duplicated (2, 20) are deleted
+    Block delete_block = ColumnHelper::create_block<DataTypeInt32>({1, 2, 2}, {10, 20, 20});
+    auto delete_impl = EqualityDeleteBase::get_delete_impl(&delete_block);
+    RuntimeProfile profile("test");
+    ASSERT_TRUE(delete_impl->init(&profile).ok());
+
+    Block data_block =
+            ColumnHelper::create_block<DataTypeInt32>({1, 1, 2, 3, 2}, {10, 20, 20, 30, 10});
+    ASSERT_TRUE(delete_impl->filter_data_block(&data_block).ok());
+    Block expected = ColumnHelper::create_block<DataTypeInt32>({1, 3, 2}, {20, 30, 10});
+    EXPECT_TRUE(ColumnHelper::block_equal(expected, data_block));
+
+    // the hash table is reused by the next block
+    Block next_block = ColumnHelper::create_block<DataTypeInt32>({2, 4}, {20, 40});
+    ASSERT_TRUE(delete_impl->filter_data_block(&next_block).ok());
+    EXPECT_TRUE(ColumnHelper::block_equal(ColumnHelper::create_block<DataTypeInt32>({4}, {40}),
+                                          next_block));
+}
+
+} // namespace doris::vectorized
@@ -20,6 +20,7 @@
 #include <string>
 #include <vector>
 
+#include "vec/exec/format/csv/csv_reader.h"
 #include "vec/exec/format/text/text_reader.h"
 
 namespace doris::vectorized {
@@ -27,8 +28,22 @@ namespace doris::vectorized {
 class HiveTextFieldSplitterTest : public testing::Test {
 protected:
     void verify_field_split(const std::string& input, const std::string& delimiter,
-                            const std::vector<std::string>& expected_fields, char escape_char = 0) {
+                            const std::vector<std::string>& expected_fields, char escape_char = 0,
+                            size_t max_fields = 0) {
         HiveTextFieldSplitter splitter(false, false, delimiter, delimiter.size(), 0, escape_char);
+        splitter.set_max_fields(max_fields);
+        verify_split(splitter, input, delimiter, expected_fields);
+    }
+
+    void verify_plain_field_split(const std::string& input, const std::string& delimiter,
+                                  const std::vector<std::string>& expected_fields) {
+        PlainCsvTextFieldSplitter splitter(false, false, delimiter, delimiter.size());
+        verify_split(splitter, input, delimiter, expected_fields);
+    }
+
+    template <typename Splitter>
+    void verify_split(Splitter& splitter, const std::string& input, const std::string& delimiter,
+                      const std::vector<std::string>& expected_fields) {
         Slice line(input.data(), input.size());
         std::vector<Slice> splitted_values;
 
@@ -85,6 +100,24 @@ TEST_F(HiveTextFieldSplitterTest, EscapeCharacter) {
     verify_field_split("field1\\|+|field2|+|field3", "|+|", {"field1\\|+|field2", "field3"}, '\\');
 }
 
+// Test lines longer than one SIMD block
+TEST_F(HiveTextFieldSplitterTest, SingleCharDelimiterLongLine) {
+    verify_field_split("0123456789abcdef,ghij", ",", {"0123456789abcdef", "ghij"});
+    verify_field_split("0123456789\\,abcdefghijklmnopqrstu,k", ",",
+                       {"0123456789\\,abcdefghijklmnopqrstu", "k"}, '\\');
+    verify_field_split(",,,,,,,,,,,,,,,,,", ",", std::vector<std::string>(18, ""));
+}
+
+// Test stopping after the needed fields
+TEST_F(HiveTextFieldSplitterTest, MaxFields) {
+    verify_field_split("a,b,c", ",", {"a", "b"}, 0, 2);
+    verify_field_split("a,b,c", ",", {"a", "b", "c"}, 0, 4);
+    verify_field_split("a\\,b,c,d", ",", {"a\\,b", "c"}, '\\', 2);
+    verify_field_split("0123456789abcdef,0123456789abcdef,x", ",",
+                       {"0123456789abcdef", "0123456789abcdef"}, 0, 2);
+    verify_field_split("a|+|b|+|c", "|+|", {"a"}, 0, 1);
+}
+
 // Test real-world scenarios
 TEST_F(HiveTextFieldSplitterTest, RealWorldScenarios) {
     verify_field_split("1|+|100|+|test1", "|+|", {"1", "100", "test1"});
@@ -94,4 +127,22 @@ TEST_F(HiveTextFieldSplitterTest, RealWorldScenarios) {
     verify_field_split("a|+||+|c", "|+|", {"a", "", "c"});
 }
 
+// Test the plain csv splitter on lines longer than one SIMD block
+TEST_F(HiveTextFieldSplitterTest, PlainCsvSingleCharDelimiterLongLine) {
+    verify_plain_field_split("a,b,c", ",", {"a", "b", "c"});
+    verify_plain_field_split(",", ",", {"", ""});
+    verify_plain_field_split("0123456789abcde,fghij", ",", {"0123456789abcde", "fghij"});
+    verify_plain_field_split("0123456789abcdef,ghij", ",", {"0123456789abcdef", "ghij"});
+    verify_plain_field_split(",,,,,,,,,,,,,,,,,", ",", std::vector<std::string>(18, ""));
+    verify_plain_field_split("a||b||c", "||", {"a", "b", "c"});
+
+    std::string line;
+    std::vector<std::string> expected;
+    for (int i = 0; i < 100; ++i) {
+        expected.push_back(std::string(i % 7, 'x') + std::to_string(i));
+        line += (i == 0 ? "" : "|") + expected.back();
+    }
+    verify_plain_field_split(line, "|", expected);
+}
+
 } // namespace doris::vectorized
\ No newline at end of file
@@ -0,0 +1,88 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "vec/exec/scan/split_source_connector.h"
+
+#include <gtest/gtest.h>
+
+#include "common/config.h"
+#include "util/defer_op.h"
+
+namespace doris::vectorized {
+
+static TScanRangeParams make_scan_range(const std::vector<TFileRangeDesc>& ranges) {
+    TScanRangeParams scan_range;
+    scan_range.scan_range.ext_scan_range.file_scan_range.__set_ranges(ranges);
+    return scan_range;
+}
+
+static TFileRangeDesc make_range(const std::string& path, int64_t size,
+                                 TFileFormatType::type format = TFileFormatType::FORMAT_PARQUET) {
+    TFileRangeDesc range;
+    range.__set_path(path);
+    range.__set_start_offset(0);
+    range.__set_size(size);
+    range.__set_file_size(size);
+    range.__set_format_type(format);
+    return range;
+}
+
+TEST(SplitSourceConnectorTest, split_large_ranges) {
+    auto split_size_mb = config::file_scan_split_size_mb;
+    Defer defer {[&]() { config::file_scan_split_size_mb = split_size_mb; }};
+    config::file_scan_split_size_mb = 1;
+    constexpr int64_t MB = 1024 * 1024;
+
+    std::vector<TScanRangeParams> scan_ranges = {make_scan_range(
+            {make_range("large", 10 * MB), make_range("small", MB / 2),
+             make_range("csv", 10 * MB, TFileFormatType::FORMAT_CSV_PLAIN)})};
+    LocalSplitSourceConnector connector(scan_ranges, 4);
+    EXPECT_EQ(3, connector.num_scan_ranges());
+
+    int64_t large_size = 0;
+    int64_t next_offset = 0;
+    int num_ranges = 0;
+    bool has_next = true;
+    while (true) {
+        TFileRangeDesc range;
+        ASSERT_TRUE(connector.get_next(&has_next, &range).ok());
+        if (!has_next) {
+            break;
+        }
+        ++num_ranges;
+        if (range.path == "large") {
+            EXPECT_EQ(next_offset, range.start_offset);
+            next_offset += range.size;
+            large_size += range.size;
+        } else {
+            EXPECT_EQ(0, range.start_offset);
+        }
+    }
+    // one idle scanner, so the large file is cut into 2 pieces, the others are kept
+    EXPECT_EQ(4, num_ranges);
+    EXPECT_EQ(10 * MB, large_size);
+
+    // enough ranges for all scanners, nothing to split
+    LocalSplitSourceConnector no_split(scan_ranges, 3);
+    EXPECT_EQ(1, no_split.num_scan_ranges());
+
+    config::file_scan_split_size_mb = 0;
+    LocalSplitSourceConnector disabled(scan_ranges, 4);
+    EXPECT_EQ(1, disabled.num_scan_ranges());
+}
+
+} // namespace doris::vectorized
@@ -69,7 +69,8 @@ TEST_F(ScanOperatorTest, adaptive_pipeline_task_serial_read_on_limit) {
     std::vector<TExpr> conjuncts {conjunct};
     tnode.__set_conjuncts(conjuncts);
     auto scan_operator = std::make_unique<pipeline::OlapScanOperatorX>(
-            obj_pool.get(), tnode, 0, *descs, parallel_pipeline_task_num, TQueryCacheParam {});
+            obj_pool.get(), tnode, 0, *descs, parallel_pipeline_task_num, TQueryCacheParam {},
+            QueryCacheMergeInfo {});
 
     TQueryOptions query_options;
     // enable_adaptive_pipeline_task_serial_read_on_limit is true
@@ -86,7 +87,8 @@ TEST_F(ScanOperatorTest, adaptive_pipeline_task_serial_read_on_limit) {
     // limit 10
     tnode.__set_limit(10);
     scan_operator = std::make_unique<pipeline::OlapScanOperatorX>(
-            obj_pool.get(), tnode, 0, *descs, parallel_pipeline_task_num, TQueryCacheParam {});
+            obj_pool.get(), tnode, 0, *descs, parallel_pipeline_task_num, TQueryCacheParam {},
+            QueryCacheMergeInfo {});
 
     // enable_adaptive_pipeline_task_serial_read_on_limit is true
     query_options.__set_enable_adaptive_pipeline_task_serial_read_on_limit(true);
@@ -0,0 +1,222 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "vec/sink/writer/vhive_table_writer.h"
+
+#include <gen_cpp/DataSinks_types.h>
+#include <gtest/gtest.h>
+
+#include <fstream>
+#include <map>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "common/config.h"
+#include "io/fs/local_file_system.h"
+#include "testutil/column_helper.h"
+#include "testutil/mock/mock_runtime_state.h"
+#include "testutil/mock/mock_slot_ref.h"
+#include "util/defer_op.h"
+#include "util/runtime_profile.h"
+#include "vec/core/block.h"
+#include "vec/data_types/data_type_number.h"
+
+namespace doris::vectorized {
+
+// Writes (id, part) rows as text files into a local directory per partition `part`.
+class VHiveTableWriterTest : public testing::Test {
+public:
+    void SetUp() override {
+        _max_partitions = config::table_sink_partition_write_max_partition_nums_per_writer;
+        _close_idle_writers = config::hive_sink_close_idle_partition_writers;
+        _max_file_size = config::hive_sink_max_file_size;
+        _write_path = "./ut_dir/vhive_table_writer_test";
+        auto st = io::global_local_filesystem()->delete_directory(_write_path);
+        ASSERT_TRUE(st.ok()) << st;
+        for (int part = 1; part <= 3; ++part) {
+            st = io::global_local_filesystem()->create_directory(
+                    fmt::format("{}/part={}", _write_path, part));
+            ASSERT_TRUE(st.ok()) << st;
+        }
+        _profile.add_child(&_custom_profile, true);
+    }
+
+    void TearDown() override {
+        config::table_sink_partition_write_max_partition_nums_per_writer = _max_partitions;
+        config::hive_sink_close_idle_partition_writers = _close_idle_writers;
+        config::hive_sink_max_file_size = _max_file_size;
+        EXPECT_TRUE(io::global_local_filesystem()->delete_directory(_write_path).ok());
+    }
+
+protected:
+    std::unique_ptr<VHiveTableWriter> create_writer() {
+        THiveColumn id_column;
+        id_column.name = "id";
+        id_column.column_type = THiveColumnType::REGULAR;
+        THiveColumn part_column;
+        part_column.name = "part";
+        part_column.column_type = THiveColumnType::PARTITION_KEY;
+        THiveLocationParams location;
+        location.__set_write_path(_write_path);
+        location.__set_original_write_path(_write_path);
+        location.__set_target_path(_write_path);
+        location.__set_file_type(TFileType::FILE_LOCAL);
+        THiveSerDeProperties serde_properties;
+        serde_properties.__set_field_delim(",");
+        serde_properties.__set_line_delim("\n");
+        serde_properties.__set_collection_delim(",");
+        serde_properties.__set_mapkv_delim(":");
+        serde_properties.__set_null_format("\\N");
+        THiveTableSink hive_table_sink;
+        hive_table_sink.__set_columns({id_column, part_column});
+        hive_table_sink.__set_partitions({});
+        hive_table_sink.__set_location(location);
+        hive_table_sink.__set_file_format(TFileFormatType::FORMAT_CSV_PLAIN);
+        hive_table_sink.__set_compression_type(TFileCompressType::PLAIN);
+        hive_table_sink.__set_serde_properties(serde_properties);
+        hive_table_sink.__set_overwrite(false);
+        TDataSink t_sink;
+        t_sink.__set_hive_table_sink(hive_table_sink);
+
+        auto writer = std::make_unique<VHiveTableWriter>(
+                t_sink,
+                MockSlotRef::create_mock_contexts(DataTypes {std::make_shared<DataTypeInt32>(),
+                                                             std::make_shared<DataTypeInt32>()}),
+                nullptr, nullptr);
+        EXPECT_TRUE(writer->open(&_state, &_profile).ok());
+        return writer;
+    }
+
+    static Block make_block(const std::vector<int32_t>& ids, const std::vector<int32_t>& parts) {
+        return {ColumnHelper::create_column_with_name<DataTypeInt32>(ids),
+                ColumnHelper::create_column_with_name<DataTypeInt32>(parts)};
+    }
+
+    std::string read_file(const THivePartitionUpdate& update) {
+        EXPECT_EQ(update.file_names.size(), 1);
+        std::ifstream file(fmt::format("{}/{}/{}", _write_path, update.name,
+                                       update.file_names.front()));
+        std::stringstream content;
+        content << file.rdbuf();
+        return content.str();
+    }
+
+    std::string _write_path;
+    MockRuntimeState _state;
+    RuntimeProfile _profile {"VHiveTableWriterTest"};
+    RuntimeProfile _custom_profile {"CustomCounters"};
+
+private:
+    int32_t _max_partitions = 0;
+    bool _close_idle_writers = false;
+    int64_t _max_file_size = 0;
+};
+
+TEST_F(VHiveTableWriterTest, TooManyOpenPartitions) {
+    config::table_sink_partition_write_max_partition_nums_per_writer = 2;
+    config::hive_sink_close_idle_partition_writers = false;
+    auto writer = create_writer();
+    auto block = make_block({0, 1}, {1, 2});
+    ASSERT_TRUE(writer->write(&_state, block).ok());
+    block = make_block({2}, {3});
+    auto st = writer->write(&_state, block);
+    EXPECT_FALSE(st.ok());
+    EXPECT_TRUE(st.to_string().find("Too many open partitions") != std::string::npos) << st;
+    EXPECT_TRUE(writer->close(st).ok());
+}
+
+TEST_F(VHiveTableWriterTest, CloseAndReopenIdlePartitionWriter) {
+    config::table_sink_partition_write_max_partition_nums_per_writer = 2;
+    config::hive_sink_close_idle_partition_writers = true;
+    auto writer = create_writer();
+
+    auto block = make_block({0, 1}, {1, 2});
+    ASSERT_TRUE(writer->write(&_state, block).ok());
+    // part=1 is the least recently written one, its writer is closed and committed
+    block = make_block({2}, {3});
+    ASSERT_TRUE(writer->write(&_state, block).ok());
+    EXPECT_EQ(writer->_lru_partitions, (std::list<std::string> {"part=2", "part=3"}));
+    // part=1 shows up again and gets a new file, part=2 is closed in turn
+    block = make_block({3}, {1});
+    ASSERT_TRUE(writer->write(&_state, block).ok());
+    EXPECT_EQ(writer->_lru_partitions, (std::list<std::string> {"part=3", "part=1"}));
+    // the reopened file of part=1 is full and rolls over to the next file index
+    config::hive_sink_max_file_size = 1;
+    block = make_block({4}, {1});
+    ASSERT_TRUE(writer->write(&_state, block).ok());
+    ASSERT_TRUE(writer->close(Status::OK()).ok());
+    EXPECT_EQ(writer->_closed_idle_writer_count, 2);
+    EXPECT_EQ(writer->_write_file_count, 5);
+
+    auto updates = _state.hive_partition_updates();
+    ASSERT_EQ(updates.size(), 5);
+    std::map<std::string, std::vector<THivePartitionUpdate>> partition_updates;
+    for (const auto& update : updates) {
+        EXPECT_EQ(update.update_mode, TUpdateMode::NEW);
+        EXPECT_EQ(update.row_count, 1);
+        partition_updates[update.name].push_back(update);
+    }
+    EXPECT_EQ(updates[0].name, "part=1");
+    EXPECT_EQ(read_file(updates[0]), "0\n");
+    EXPECT_EQ(updates[1].name, "part=2");
+    EXPECT_EQ(read_file(updates[1]), "1\n");
+    ASSERT_EQ(partition_updates["part=3"].size(), 1);
+    EXPECT_EQ(read_file(partition_updates["part=3"][0]), "2\n");
+
+    // the first file, the reopened one and the file it rolled over to
+    const auto& part1 = partition_updates["part=1"];
+    ASSERT_EQ(part1.size(), 3);
+    const auto& first_file = part1[0].file_names.front();
+    const auto& reopened_file = part1[1].file_names.front();
+    const auto& rolled_file = part1[2].file_names.front();
+    EXPECT_NE(first_file, reopened_file);
+    EXPECT_TRUE(reopened_file.ends_with("-0")) << reopened_file;
+    EXPECT_EQ(rolled_file, reopened_file.substr(0, reopened_file.size() - 1) + "1");
+    EXPECT_EQ(read_file(part1[1]), "3\n");
+    EXPECT_EQ(read_file(part1[2]), "4\n");
+}
+
+TEST_F(VHiveTableWriterTest, ClusterRowsByPartition) {
+    auto writer = create_writer();
+    auto block = make_block({0, 1, 2, 3, 4, 5}, {2, 1, 2, 1, 2, 3});
+    ASSERT_TRUE(writer->write(&_state, block).ok());
+    // writers are opened in the order the partitions first show up in the block
+    EXPECT_EQ(writer->_lru_partitions,
+              (std::list<std::string> {"part=2", "part=1", "part=3"}));
+    block = make_block({6, 7}, {1, 1});
+    ASSERT_TRUE(writer->write(&_state, block).ok());
+    ASSERT_TRUE(writer->close(Status::OK()).ok());
+    EXPECT_EQ(writer->_write_file_count, 3);
+
+    // every partition gets one file holding its rows in input order
+    std::map<std::string, std::string> contents;
+    std::map<std::string, int64_t> row_counts;
+    for (const auto& update : _state.hive_partition_updates()) {
+        EXPECT_FALSE(contents.contains(update.name)) << update.name;
+        contents[update.name] = read_file(update);
+        row_counts[update.name] = update.row_count;
+    }
+    EXPECT_EQ(contents, (std::map<std::string, std::string> {
+                                {"part=1", "1\n3\n6\n7\n"}, {"part=2", "0\n2\n4\n"},
+                                {"part=3", "5\n"}}));
+    EXPECT_EQ(row_counts, (std::map<std::string, int64_t> {
+                                  {"part=1", 4}, {"part=2", 3}, {"part=3", 1}}));
+}
+
+} // namespace doris::vectorized
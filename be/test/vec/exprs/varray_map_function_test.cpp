@@ -0,0 +1,329 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <gen_cpp/Exprs_types.h>
+#include <gen_cpp/Types_types.h>
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "vec/columns/column_array.h"
+#include "vec/columns/column_const.h"
+#include "vec/columns/column_nullable.h"
+#include "vec/columns/column_vector.h"
+#include "vec/common/assert_cast.h"
+#include "vec/core/block.h"
+#include "vec/data_types/data_type_array.h"
+#include "vec/data_types/data_type_nullable.h"
+#include "vec/data_types/data_type_number.h"
+#include "vec/exprs/lambda_function/lambda_function_factory.h"
+#include "vec/exprs/vcolumn_ref.h"
+#include "vec/exprs/vexpr_context.h"
+#include "vec/exprs/vslot_ref.h"
+
+namespace doris::vectorized {
+
+namespace {
+// an array row, nullopt rows are null arrays and nullopt elements are null elements
+using Array = std::optional<std::vector<std::optional<int64_t>>>;
+
+// Returns a column of the outer block, like the array arguments of array_map.
+class MockColumnExpr : public VExpr {
+public:
+    explicit MockColumnExpr(int column_id) : _column_id(column_id) {
+        _node_type = TExprNodeType::FUNCTION_CALL;
+    }
+    const std::string& expr_name() const override { return _name; }
+    Status execute(VExprContext* context, Block* block, int* result_column_id) override {
+        *result_column_id = _column_id;
+        return Status::OK();
+    }
+
+private:
+    int _column_id;
+    std::string _name = "mock_column";
+};
+
+// The lambda body, adds up its children and is null if any of them is null.
+class MockSumExpr : public VExpr {
+public:
+    MockSumExpr()
+            : VExpr(std::make_shared<DataTypeNullable>(std::make_shared<DataTypeInt64>()), false) {
+        _node_type = TExprNodeType::FUNCTION_CALL;
+    }
+    const std::string& expr_name() const override { return _name; }
+    Status execute(VExprContext* context, Block* block, int* result_column_id) override {
+        ++num_executions;
+        max_rows = std::max(max_rows, block->rows());
+        Columns args;
+        for (const auto& child : _children) {
+            int column_id = -1;
+            RETURN_IF_ERROR(child->execute(context, block, &column_id));
+            args.push_back(
+                    block->get_by_position(column_id).column->convert_to_full_column_if_const());
+        }
+        auto sums = ColumnInt64::create();
+        auto null_map = ColumnUInt8::create();
+        for (size_t row = 0; row < args[0]->size(); ++row) {
+            int64_t sum = 0;
+            bool is_null = false;
+            for (const auto& arg : args) {
+                EXPECT_EQ(arg->size(), args[0]->size());
+                const IColumn* column = arg.get();
+                if (const auto* nullable = check_and_get_column<ColumnNullable>(column)) {
+                    is_null |= nullable->is_null_at(row);
+                    column = &nullable->get_nested_column();
+                }
+                sum += assert_cast<const ColumnInt64&>(*column).get_element(row);
+            }
+            sums->get_data().push_back(is_null ? 0 : sum);
+            null_map->get_data().push_back(is_null);
+        }
+        block->insert({ColumnNullable::create(std::move(sums), std::move(null_map)), _data_type,
+                       "sum"});
+        *result_column_id = static_cast<int>(block->columns()) - 1;
+        return Status::OK();
+    }
+
+    int num_executions = 0;
+    size_t max_rows = 0;
+
+private:
+    std::string _name = "mock_sum";
+};
+
+TTypeDesc bigint_type_desc() {
+    TScalarType scalar_type;
+    scalar_type.__set_type(TPrimitiveType::BIGINT);
+    TTypeNode type_node;
+    type_node.__set_type(TTypeNodeType::SCALAR);
+    type_node.__set_scalar_type(scalar_type);
+    TTypeDesc type_desc;
+    type_desc.types.push_back(type_node);
+    return type_desc;
+}
+
+// the index-th lambda argument
+VExprSPtr lambda_arg(int index) {
+    TColumnRef column_ref;
+    column_ref.__set_column_id(index);
+    column_ref.__set_column_name("x" + std::to_string(index));
+    TExprNode node;
+    node.__set_node_type(TExprNodeType::COLUMN_REF);
+    node.__set_type(bigint_type_desc());
+    node.__set_num_children(0);
+    node.__set_is_nullable(true);
+    node.__set_column_ref(column_ref);
+    auto expr = VColumnRef::create_shared(node);
+    expr->_open_finished = true;
+    return expr;
+}
+
+// a column of the outer block captured by the lambda
+VExprSPtr captured_column(int column_id) {
+    static const std::string name = "captured";
+    auto expr = std::make_shared<VSlotRef>();
+    expr->_node_type = TExprNodeType::SLOT_REF;
+    expr->_column_id = column_id;
+    expr->_column_name = &name;
+    return expr;
+}
+
+DataTypePtr array_type(bool nullable) {
+    DataTypePtr type = std::make_shared<DataTypeArray>(
+            std::make_shared<DataTypeNullable>(std::make_shared<DataTypeInt64>()));
+    return nullable ? std::make_shared<DataTypeNullable>(type) : type;
+}
+
+ColumnWithTypeAndName array_column(const std::vector<Array>& rows, bool nullable) {
+    auto elements = ColumnInt64::create();
+    auto element_null_map = ColumnUInt8::create();
+    auto offsets = ColumnArray::ColumnOffsets::create();
+    auto null_map = ColumnUInt8::create();
+    for (const auto& row : rows) {
+        if (row.has_value()) {
+            for (const auto& element : *row) {
+                elements->get_data().push_back(element.value_or(0));
+                element_null_map->get_data().push_back(!element.has_value());
+            }
+        }
+        offsets->get_data().push_back(elements->size());
+        null_map->get_data().push_back(!row.has_value());
+    }
+    ColumnPtr column = ColumnArray::create(
+            ColumnNullable::create(std::move(elements), std::move(element_null_map)),
+            std::move(offsets));
+    if (nullable) {
+        column = ColumnNullable::create(column, std::move(null_map));
+    }
+    return {column, array_type(nullable), "array"};
+}
+
+std::vector<Array> read_array_column(const ColumnPtr& column) {
+    const IColumn* array = column.get();
+    const NullMap* null_map = nullptr;
+    if (const auto* nullable = check_and_get_column<ColumnNullable>(array)) {
+        array = &nullable->get_nested_column();
+        null_map = &nullable->get_null_map_data();
+    }
+    const auto& array_column = assert_cast<const ColumnArray&>(*array);
+    const auto& elements = assert_cast<const ColumnNullable&>(array_column.get_data());
+    const auto& values = assert_cast<const ColumnInt64&>(elements.get_nested_column());
+    std::vector<Array> rows;
+    for (size_t row = 0; row < array_column.size(); ++row) {
+        if (null_map != nullptr && (*null_map)[row]) {
+            rows.emplace_back(std::nullopt);
+            continue;
+        }
+        auto& result = rows.emplace_back(std::vector<std::optional<int64_t>>());
+        for (size_t i = array_column.offset_at(row); i < array_column.offset_at(row + 1); ++i) {
+            result->push_back(elements.is_null_at(i) ? std::nullopt
+                                                     : std::optional(values.get_element(i)));
+        }
+    }
+    return rows;
+}
+} // namespace
+
+class ArrayMapFunctionTest : public testing::Test {
+protected:
+    // Runs array_map(body, arrays...) over the block, returns the result rows.
+    Status run(Block* block, const std::shared_ptr<MockSumExpr>& body,
+               const std::vector<int>& array_positions, bool nullable, int batch_size,
+               std::vector<Array>* result) {
+        auto function = LambdaFunctionFactory::instance().get_function("array_map");
+        function->batch_size = batch_size;
+        VExprSPtrs children {body};
+        for (int position : array_positions) {
+            children.push_back(std::make_shared<MockColumnExpr>(position));
+        }
+        auto context = std::make_shared<VExprContext>(body);
+        int result_column_id = -1;
+        RETURN_IF_ERROR(function->execute(context.get(), block, &result_column_id,
+                                          array_type(nullable), children));
+        *result = read_array_column(block->get_by_position(result_column_id).column);
+        return Status::OK();
+    }
+};
+
+TEST_F(ArrayMapFunctionTest, NonConstCapture) {
+    // array_map(x -> x + c, arr), the arrays cross the batches of 4 elements
+    Block block;
+    block.insert({ColumnInt64::create(std::vector<int64_t> {10, 20, 30}),
+                  std::make_shared<DataTypeInt64>(), "c"});
+    block.insert(array_column({{{1, 2, 3}}, {{}}, {{4, 5, 6, 7, 8}}}, false));
+    auto body = std::make_shared<MockSumExpr>();
+    body->add_child(lambda_arg(0));
+    body->add_child(captured_column(0));
+
+    std::vector<Array> result;
+    ASSERT_TRUE(run(&block, body, {1}, false, 4, &result).ok());
+    std::vector<Array> expected {{{11, 12, 13}}, {{}}, {{34, 35, 36, 37, 38}}};
+    EXPECT_EQ(result, expected);
+    EXPECT_LE(body->max_rows, 4);
+}
+
+TEST_F(ArrayMapFunctionTest, ConstCapture) {
+    // array_map(x -> x + c, arr) with a const c that is not the first column
+    Block block;
+    block.insert({ColumnInt64::create(std::vector<int64_t> {0, 0, 0}),
+                  std::make_shared<DataTypeInt64>(), "unused"});
+    block.insert({ColumnConst::create(ColumnInt64::create(std::vector<int64_t> {100}), 3),
+                  std::make_shared<DataTypeInt64>(), "c"});
+    block.insert(array_column({{{1, 2}}, {{3, 4, 5}}, {{6}}}, false));
+    auto body = std::make_shared<MockSumExpr>();
+    body->add_child(lambda_arg(0));
+    body->add_child(captured_column(1));
+
+    std::vector<Array> result;
+    ASSERT_TRUE(run(&block, body, {2}, false, 4, &result).ok());
+    std::vector<Array> expected {{{101, 102}}, {{103, 104, 105}}, {{106}}};
+    EXPECT_EQ(result, expected);
+    // the const capture is not materialized in the outer block
+    EXPECT_TRUE(is_column_const(*block.get_by_position(1).column));
+}
+
+TEST_F(ArrayMapFunctionTest, NullableArray) {
+    Block block;
+    block.insert({ColumnInt64::create(std::vector<int64_t> {10, 20, 30, 40}),
+                  std::make_shared<DataTypeInt64>(), "c"});
+    block.insert(array_column({{{1, std::nullopt}}, std::nullopt, {{}}, {{2, 3, 4}}}, true));
+    auto body = std::make_shared<MockSumExpr>();
+    body->add_child(lambda_arg(0));
+    body->add_child(captured_column(0));
+
+    std::vector<Array> result;
+    ASSERT_TRUE(run(&block, body, {1}, true, 2, &result).ok());
+    std::vector<Array> expected {{{11, std::nullopt}}, std::nullopt, {{}}, {{42, 43, 44}}};
+    EXPECT_EQ(result, expected);
+}
+
+TEST_F(ArrayMapFunctionTest, SeveralArrays) {
+    // array_map((x, y) -> x + y + c, arr1, arr2)
+    Block block;
+    block.insert({ColumnInt64::create(std::vector<int64_t> {100, 200}),
+                  std::make_shared<DataTypeInt64>(), "c"});
+    block.insert(array_column({{{1, 2, 3}}, {{4, 5}}}, false));
+    block.insert(array_column({{{10, 20, 30}}, {{40, 50}}}, false));
+    auto body = std::make_shared<MockSumExpr>();
+    body->add_child(lambda_arg(0));
+    body->add_child(lambda_arg(1));
+    body->add_child(captured_column(0));
+
+    std::vector<Array> result;
+    ASSERT_TRUE(run(&block, body, {1, 2}, false, 2, &result).ok());
+    std::vector<Array> expected {{{111, 122, 133}}, {{244, 255}}};
+    EXPECT_EQ(result, expected);
+
+    // the arrays must have the same sizes
+    block.insert(array_column({{{1, 2}}, {{3, 4, 5}}}, false));
+    auto mismatched_body = std::make_shared<MockSumExpr>();
+    mismatched_body->add_child(lambda_arg(0));
+    mismatched_body->add_child(lambda_arg(1));
+    EXPECT_FALSE(run(&block, mismatched_body, {1, 3}, false, 2, &result).ok());
+}
+
+TEST_F(ArrayMapFunctionTest, NoCapture) {
+    // array_map((x, y) -> x + y, arr1, arr2) runs on the nested columns
+    Block block;
+    block.insert(array_column({{{1, 2, 3, 4}}, {{5, 6, 7}}, {{8, 9, 10}}}, false));
+    block.insert(array_column({{{1, 1, 1, 1}}, {{2, 2, 2}}, {{3, 3, std::nullopt}}}, false));
+    std::vector<Array> expected {{{2, 3, 4, 5}}, {{7, 8, 9}}, {{11, 12, std::nullopt}}};
+
+    // still sliced into batches of batch_size elements
+    auto body = std::make_shared<MockSumExpr>();
+    body->add_child(lambda_arg(0));
+    body->add_child(lambda_arg(1));
+    std::vector<Array> result;
+    ASSERT_TRUE(run(&block, body, {0, 1}, false, 4, &result).ok());
+    EXPECT_EQ(result, expected);
+    EXPECT_EQ(body->num_executions, 3);
+    EXPECT_EQ(body->max_rows, 4);
+
+    // a single batch when the elements fit
+    auto single_batch_body = std::make_shared<MockSumExpr>();
+    single_batch_body->add_child(lambda_arg(0));
+    single_batch_body->add_child(lambda_arg(1));
+    ASSERT_TRUE(run(&block, single_batch_body, {0, 1}, false, 4096, &result).ok());
+    EXPECT_EQ(result, expected);
+    EXPECT_EQ(single_batch_body->num_executions, 1);
+}
+
+} // namespace doris::vectorized
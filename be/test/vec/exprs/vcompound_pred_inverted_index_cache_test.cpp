@@ -0,0 +1,236 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <gen_cpp/Exprs_types.h>
+#include <gen_cpp/Opcodes_types.h>
+#include <gen_cpp/Types_types.h>
+#include <gtest/gtest.h>
+
+#include <memory>
+
+#include "olap/rowset/segment_v2/inverted_index_cache.h"
+#include "olap/rowset/segment_v2/inverted_index_iterator.h"
+#include "olap/rowset/segment_v2/inverted_index_reader.h"
+#include "olap/tablet_schema.h"
+#include "runtime/exec_env.h"
+#include "vec/data_types/data_type_number.h"
+#include "vec/exprs/vcompound_pred.h"
+#include "vec/exprs/vectorized_fn_call.h"
+#include "vec/exprs/vexpr_context.h"
+#include "vec/exprs/vliteral.h"
+#include "vec/exprs/vslot_ref.h"
+
+namespace doris::vectorized {
+
+namespace {
+// only provides the index meta, the cache keys are built from
+class TestInvertedIndexReader final : public segment_v2::InvertedIndexReader {
+public:
+    explicit TestInvertedIndexReader(const TabletIndex* index_meta)
+            : InvertedIndexReader(index_meta, nullptr) {}
+
+    segment_v2::InvertedIndexReaderType type() override {
+        return segment_v2::InvertedIndexReaderType::FULLTEXT;
+    }
+
+    Status query(const segment_v2::IndexQueryContextPtr& context, const std::string& column_name,
+                 const void* query_value, segment_v2::InvertedIndexQueryType query_type,
+                 std::shared_ptr<roaring::Roaring>& bit_map) override {
+        return Status::OK();
+    }
+
+    Status try_query(const segment_v2::IndexQueryContextPtr& context,
+                     const std::string& column_name, const void* query_value,
+                     segment_v2::InvertedIndexQueryType query_type, size_t* count) override {
+        return Status::OK();
+    }
+
+    Status new_iterator(std::unique_ptr<segment_v2::IndexIterator>* iterator) override {
+        return Status::OK();
+    }
+};
+} // namespace
+
+class VCompoundPredInvertedIndexCacheTest : public testing::Test {
+public:
+    void SetUp() override {
+        _origin_cache = ExecEnv::GetInstance()->_inverted_index_query_cache;
+        _cache.reset(segment_v2::InvertedIndexQueryCache::create_global_cache(1024 * 1024, 1));
+        ExecEnv::GetInstance()->_inverted_index_query_cache = _cache.get();
+
+        auto type = std::make_shared<DataTypeInt32>();
+        _storage_name_and_type = {{"a", type}, {"b", type}};
+        _index_iterators.push_back(create_index_iterator(10, "english"));
+        _index_iterators.push_back(create_index_iterator(11, "english"));
+        _index_context = std::make_shared<InvertedIndexContext>(
+                _col_ids, _index_iterators, _storage_name_and_type, _status);
+        _index_context->set_segment_cache_key("/path/to/rowset_0.dat");
+        _expr_context = std::make_unique<VExprContext>(nullptr);
+        _expr_context->set_inverted_index_context(_index_context);
+    }
+
+    void TearDown() override {
+        ExecEnv::GetInstance()->_inverted_index_query_cache = _origin_cache;
+    }
+
+    static std::unique_ptr<segment_v2::IndexIterator> create_index_iterator(
+            int64_t index_id, const std::string& parser) {
+        TabletIndexPB index_pb;
+        index_pb.set_index_id(index_id);
+        index_pb.set_index_type(IndexType::INVERTED);
+        (*index_pb.mutable_properties())["parser"] = parser;
+        TabletIndex index;
+        index.init_from_pb(index_pb);
+        return segment_v2::InvertedIndexIterator::create_unique(
+                std::make_shared<TestInvertedIndexReader>(&index));
+    }
+
+    static TTypeDesc create_type_desc(TPrimitiveType::type type) {
+        TScalarType scalar_type;
+        scalar_type.__set_type(type);
+        TTypeNode type_node;
+        type_node.__set_type(TTypeNodeType::SCALAR);
+        type_node.__set_scalar_type(scalar_type);
+        TTypeDesc type_desc;
+        type_desc.types.push_back(type_node);
+        return type_desc;
+    }
+
+    static VExprSPtr create_compound(TExprOpcode::type op, VExprSPtr lhs, VExprSPtr rhs) {
+        TExprNode node;
+        node.__set_node_type(TExprNodeType::COMPOUND_PRED);
+        node.__set_opcode(op);
+        node.__set_type(create_type_desc(TPrimitiveType::BOOLEAN));
+        node.__set_is_nullable(true);
+        auto expr = VCompoundPred::create_shared(node);
+        expr->add_child(std::move(lhs));
+        if (rhs != nullptr) {
+            expr->add_child(std::move(rhs));
+        }
+        return expr;
+    }
+
+    // column_index = value
+    static VExprSPtr create_eq(int column_index, int32_t value) {
+        auto slot_ref = VSlotRef::create_shared();
+        slot_ref->_column_id = column_index;
+
+        TExprNode literal_node;
+        literal_node.__set_node_type(TExprNodeType::INT_LITERAL);
+        literal_node.__set_type(create_type_desc(TPrimitiveType::INT));
+        literal_node.__set_is_nullable(false);
+        TIntLiteral int_literal;
+        int_literal.__set_value(value);
+        literal_node.__set_int_literal(int_literal);
+
+        auto eq = VectorizedFnCall::create_shared();
+        eq->_fn.name.function_name = "eq";
+        eq->add_child(slot_ref);
+        eq->add_child(VLiteral::create_shared(literal_node));
+        return eq;
+    }
+
+    std::string cache_key(const VExprSPtr& expr) {
+        std::string key;
+        EXPECT_TRUE(expr->append_inverted_index_cache_key(_expr_context.get(), &key));
+        return key;
+    }
+
+protected:
+    segment_v2::InvertedIndexQueryCache* _origin_cache = nullptr;
+    std::unique_ptr<segment_v2::InvertedIndexQueryCache> _cache;
+    std::vector<ColumnId> _col_ids {0, 1};
+    std::vector<std::unique_ptr<segment_v2::IndexIterator>> _index_iterators;
+    std::vector<IndexFieldNameAndTypePair> _storage_name_and_type;
+    std::unordered_map<ColumnId, std::unordered_map<const VExpr*, bool>> _status;
+    std::shared_ptr<InvertedIndexContext> _index_context;
+    std::unique_ptr<VExprContext> _expr_context;
+};
+
+TEST_F(VCompoundPredInvertedIndexCacheTest, CacheKeyIsNormalized) {
+    auto a_and_b = create_compound(TExprOpcode::COMPOUND_AND, create_eq(0, 1), create_eq(1, 2));
+    auto b_and_a = create_compound(TExprOpcode::COMPOUND_AND, create_eq(1, 2), create_eq(0, 1));
+    auto a_or_b = create_compound(TExprOpcode::COMPOUND_OR, create_eq(0, 1), create_eq(1, 2));
+    auto a_and_c = create_compound(TExprOpcode::COMPOUND_AND, create_eq(0, 1), create_eq(1, 3));
+    auto not_a = create_compound(TExprOpcode::COMPOUND_NOT, create_eq(0, 1), nullptr);
+
+    EXPECT_EQ(cache_key(a_and_b), cache_key(b_and_a));
+    EXPECT_NE(cache_key(a_and_b), cache_key(a_or_b));
+    EXPECT_NE(cache_key(a_and_b), cache_key(a_and_c));
+    EXPECT_NE(cache_key(not_a), cache_key(create_eq(0, 1)));
+
+    // slots without a storage column can't be keyed
+    auto unknown = create_compound(TExprOpcode::COMPOUND_AND, create_eq(0, 1), create_eq(5, 1));
+    std::string key;
+    EXPECT_FALSE(unknown->append_inverted_index_cache_key(_expr_context.get(), &key));
+
+    // neither can slots without an index
+    _index_iterators[1].reset();
+    key.clear();
+    EXPECT_FALSE(a_and_b->append_inverted_index_cache_key(_expr_context.get(), &key));
+}
+
+TEST_F(VCompoundPredInvertedIndexCacheTest, CacheKeyChangesWithIndex) {
+    auto a_and_b = create_compound(TExprOpcode::COMPOUND_AND, create_eq(0, 1), create_eq(1, 2));
+    auto key = cache_key(a_and_b);
+
+    // the index file path stays the same when an index is rebuilt with another parser
+    _index_iterators[1] = create_index_iterator(11, "unicode");
+    auto other_parser_key = cache_key(a_and_b);
+    EXPECT_NE(key, other_parser_key);
+
+    // or with another index id
+    _index_iterators[1] = create_index_iterator(12, "english");
+    EXPECT_NE(key, cache_key(a_and_b));
+    EXPECT_NE(other_parser_key, cache_key(a_and_b));
+
+    _index_iterators[1] = create_index_iterator(11, "english");
+    EXPECT_EQ(key, cache_key(a_and_b));
+}
+
+TEST_F(VCompoundPredInvertedIndexCacheTest, ResultIsServedFromCache) {
+    auto a_and_b = create_compound(TExprOpcode::COMPOUND_AND, create_eq(0, 1), create_eq(1, 2));
+    auto b_and_a = create_compound(TExprOpcode::COMPOUND_AND, create_eq(1, 2), create_eq(0, 1));
+
+    auto data_bitmap = std::make_shared<roaring::Roaring>();
+    data_bitmap->addRange(10, 20);
+    auto null_bitmap = std::make_shared<roaring::Roaring>();
+    null_bitmap->add(30);
+    segment_v2::InvertedIndexQueryCache::CacheKey key {
+            _index_context->segment_cache_key(), "",
+            segment_v2::InvertedIndexQueryType::UNKNOWN_QUERY, cache_key(a_and_b)};
+    segment_v2::InvertedIndexQueryCacheHandle handle;
+    _cache->insert(key, data_bitmap, null_bitmap, &handle);
+
+    // the children have no function to evaluate them with, a hit must not evaluate them
+    ASSERT_TRUE(b_and_a->evaluate_inverted_index(_expr_context.get(), 100).ok());
+    const auto* result = _index_context->get_inverted_index_result_for_expr(b_and_a.get());
+    ASSERT_NE(result, nullptr);
+    EXPECT_EQ(*result->get_data_bitmap(), *data_bitmap);
+    EXPECT_EQ(*result->get_null_bitmap(), *null_bitmap);
+    // the cached bitmaps are copied out
+    EXPECT_NE(result->get_data_bitmap().get(), data_bitmap.get());
+
+    // a different segment misses
+    segment_v2::InvertedIndexQueryCache::CacheKey other_segment_key {
+            "/path/to/rowset_1.dat", "", segment_v2::InvertedIndexQueryType::UNKNOWN_QUERY,
+            cache_key(a_and_b)};
+    segment_v2::InvertedIndexQueryCacheHandle other_handle;
+    EXPECT_FALSE(_cache->lookup(other_segment_key, &other_handle));
+}
+
+} // namespace doris::vectorized
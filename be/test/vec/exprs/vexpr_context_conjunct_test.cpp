@@ -0,0 +1,198 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <gtest/gtest.h>
+
+#include <functional>
+#include <set>
+
+#include "common/config.h"
+#include "runtime/types.h"
+#include "testutil/column_helper.h"
+#include "testutil/mock/mock_slot_ref.h"
+#include "vec/core/block.h"
+#include "vec/data_types/data_type_number.h"
+#include "vec/exprs/vexpr_context.h"
+#include "vec/exprs/vruntimefilter_wrapper.h"
+
+namespace doris::vectorized {
+
+namespace {
+// filters an Int32 column with `pred` and remembers how many rows it was given
+class PredicateExpr final : public VExpr {
+public:
+    PredicateExpr(int column_id, std::function<bool(int32_t)> pred)
+            : VExpr(std::make_shared<DataTypeUInt8>(), false), _pred(std::move(pred)) {
+        _node_type = TExprNodeType::FUNCTION_CALL;
+        add_child(std::make_shared<MockSlotRef>(column_id, std::make_shared<DataTypeInt32>()));
+    }
+
+    Status execute(VExprContext* context, Block* block, int* result_column_id) override {
+        seen_rows = block->rows();
+        int arg = -1;
+        RETURN_IF_ERROR(_children[0]->execute(context, block, &arg));
+        const auto& data =
+                assert_cast<const ColumnInt32&>(*block->get_by_position(arg).column).get_data();
+        auto result = ColumnUInt8::create(data.size());
+        for (size_t i = 0; i < data.size(); ++i) {
+            result->get_data()[i] = _pred(data[i]);
+        }
+        block->insert({std::move(result), _data_type, _name});
+        *result_column_id = static_cast<int>(block->columns() - 1);
+        return Status::OK();
+    }
+
+    const std::string& expr_name() const override { return _name; }
+
+    size_t seen_rows = 0;
+
+private:
+    std::function<bool(int32_t)> _pred;
+    const std::string _name = "PredicateExpr";
+};
+} // namespace
+
+class VExprContextConjunctTest : public testing::Test {
+protected:
+    void SetUp() override {
+        _enable_order = config::enable_adaptive_conjunct_order;
+        _ratio = config::conjunct_compaction_ratio;
+    }
+    void TearDown() override {
+        config::enable_adaptive_conjunct_order = _enable_order;
+        config::conjunct_compaction_ratio = _ratio;
+    }
+
+    static Block make_block(size_t rows) {
+        std::vector<int32_t> a, b;
+        for (size_t i = 0; i < rows; ++i) {
+            a.push_back(static_cast<int32_t>(i));
+            b.push_back(static_cast<int32_t>(rows - i));
+        }
+        return {ColumnHelper::create_column_with_name<DataTypeInt32>(a),
+                ColumnHelper::create_column_with_name<DataTypeInt32>(b)};
+    }
+
+private:
+    bool _enable_order = false;
+    double _ratio = 0;
+};
+
+TEST_F(VExprContextConjunctTest, CompactAfterSelectiveConjunct) {
+    config::enable_adaptive_conjunct_order = false;
+    config::conjunct_compaction_ratio = 0.3;
+    auto selective = std::make_shared<PredicateExpr>(0, [](int32_t v) { return v < 100; });
+    auto even = std::make_shared<PredicateExpr>(1, [](int32_t v) { return v % 2 == 0; });
+    VExprContextSPtrs ctxs {VExprContext::create_shared(selective),
+                            VExprContext::create_shared(even)};
+
+    auto block = make_block(1000);
+    IColumn::Filter filter(1000, 1);
+    bool can_filter_all = false;
+    EXPECT_TRUE(VExprContext::execute_conjuncts(ctxs, nullptr, false, &block, &filter,
+                                                &can_filter_all)
+                        .ok());
+    EXPECT_FALSE(can_filter_all);
+    EXPECT_EQ(selective->seen_rows, 1000);
+    EXPECT_EQ(even->seen_rows, 100);
+    for (size_t i = 0; i < 1000; ++i) {
+        EXPECT_EQ(filter[i], i < 100 && (1000 - i) % 2 == 0) << i;
+    }
+    EXPECT_EQ(ctxs[0]->_conjunct_input_rows, 1000);
+    EXPECT_EQ(ctxs[0]->_conjunct_output_rows, 100);
+    EXPECT_EQ(ctxs[1]->_conjunct_input_rows, 100);
+    EXPECT_EQ(ctxs[1]->_conjunct_output_rows, 50);
+}
+
+TEST_F(VExprContextConjunctTest, CompactBeforeRuntimeFilterConjunct) {
+    config::enable_adaptive_conjunct_order = false;
+    config::conjunct_compaction_ratio = 0.3;
+    auto selective = std::make_shared<PredicateExpr>(0, [](int32_t v) { return v < 100; });
+    auto even = std::make_shared<PredicateExpr>(1, [](int32_t v) { return v % 2 == 0; });
+    TTypeDesc type_desc = create_type_desc(PrimitiveType::TYPE_BOOLEAN);
+    type_desc.__set_is_nullable(false);
+    TExprNode node;
+    node.__set_type(type_desc);
+    node.__set_node_type(TExprNodeType::FUNCTION_CALL);
+    node.__set_is_nullable(false);
+    // the wrapper keeps its children in the wrapped expr, not in _children
+    auto rf = VRuntimeFilterWrapper::create_shared(node, even, 0.0, false, 0);
+    rf->_open_finished = true;
+    std::set<int> column_ids;
+    rf->collect_slot_column_ids(column_ids);
+    EXPECT_EQ(column_ids, (std::set<int> {1}));
+    VExprContextSPtrs ctxs {VExprContext::create_shared(selective),
+                            VExprContext::create_shared(rf)};
+
+    auto block = make_block(1000);
+    IColumn::Filter filter(1000, 1);
+    bool can_filter_all = false;
+    EXPECT_TRUE(VExprContext::execute_conjuncts(ctxs, nullptr, false, &block, &filter,
+                                                &can_filter_all)
+                        .ok());
+    EXPECT_FALSE(can_filter_all);
+    EXPECT_EQ(even->seen_rows, 100);
+    for (size_t i = 0; i < 1000; ++i) {
+        EXPECT_EQ(filter[i], i < 100 && (1000 - i) % 2 == 0) << i;
+    }
+}
+
+TEST_F(VExprContextConjunctTest, ShortCircuitWhenAllFiltered) {
+    config::conjunct_compaction_ratio = 0.3;
+    auto none = std::make_shared<PredicateExpr>(0, [](int32_t v) { return false; });
+    auto all = std::make_shared<PredicateExpr>(1, [](int32_t v) { return true; });
+    VExprContextSPtrs ctxs {VExprContext::create_shared(none), VExprContext::create_shared(all)};
+
+    auto block = make_block(10);
+    IColumn::Filter filter(10, 1);
+    bool can_filter_all = false;
+    config::enable_adaptive_conjunct_order = false;
+    EXPECT_TRUE(VExprContext::execute_conjuncts(ctxs, nullptr, false, &block, &filter,
+                                                &can_filter_all)
+                        .ok());
+    EXPECT_TRUE(can_filter_all);
+    EXPECT_EQ(all->seen_rows, 0);
+}
+
+TEST_F(VExprContextConjunctTest, OrderByCostPerFilteredRow) {
+    config::enable_adaptive_conjunct_order = true;
+    VExprContextSPtrs ctxs;
+    for (int i = 0; i < 3; ++i) {
+        ctxs.push_back(VExprContext::create_shared(
+                std::make_shared<PredicateExpr>(0, [](int32_t v) { return true; })));
+    }
+    // cheap but keeps everything, expensive and selective, cheap and selective
+    ctxs[0]->_conjunct_exec_ns = 1000;
+    ctxs[0]->_conjunct_input_rows = 1000;
+    ctxs[0]->_conjunct_output_rows = 1000;
+    ctxs[1]->_conjunct_exec_ns = 100000;
+    ctxs[1]->_conjunct_input_rows = 1000;
+    ctxs[1]->_conjunct_output_rows = 100;
+    ctxs[2]->_conjunct_exec_ns = 1000;
+    ctxs[2]->_conjunct_input_rows = 1000;
+    ctxs[2]->_conjunct_output_rows = 500;
+
+    std::vector<size_t> order;
+    VExprContext::_order_conjuncts(ctxs, order);
+    EXPECT_EQ(order, (std::vector<size_t> {2, 1, 0}));
+
+    config::enable_adaptive_conjunct_order = false;
+    VExprContext::_order_conjuncts(ctxs, order);
+    EXPECT_EQ(order, (std::vector<size_t> {0, 1, 2}));
+}
+
+} // namespace doris::vectorized
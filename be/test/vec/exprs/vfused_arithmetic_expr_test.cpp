@@ -0,0 +1,115 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "vec/exprs/vfused_arithmetic_expr.h"
+
+#include <gtest/gtest.h>
+
+#include "testutil/column_helper.h"
+#include "testutil/mock/mock_fn_call.h"
+#include "testutil/mock/mock_literal_expr.h"
+#include "testutil/mock/mock_slot_ref.h"
+#include "vec/core/block.h"
+#include "vec/data_types/data_type_nullable.h"
+#include "vec/data_types/data_type_number.h"
+#include "vec/exprs/vexpr_context.h"
+
+namespace doris::vectorized {
+
+class VFusedArithmeticExprTest : public testing::Test {
+protected:
+    static VExprSPtr fn(const std::string& name, DataTypePtr type, VExprSPtr lhs, VExprSPtr rhs) {
+        auto call = MockFnCall::create(name);
+        call->_data_type = std::move(type);
+        call->add_child(std::move(lhs));
+        call->add_child(std::move(rhs));
+        return call;
+    }
+
+    static ColumnPtr execute(const VExprSPtr& expr, Block& block) {
+        VExprContext ctx(expr);
+        expr->_open_finished = true;
+        int result_column_id = -1;
+        EXPECT_TRUE(expr->execute(&ctx, &block, &result_column_id).ok());
+        return block.get_by_position(result_column_id).column;
+    }
+};
+
+TEST_F(VFusedArithmeticExprTest, FuseNestedArithmetic) {
+    auto type = std::make_shared<DataTypeInt64>();
+    // a * b + c - a
+    auto a = std::make_shared<MockSlotRef>(0, type);
+    auto root = fn("subtract", type,
+                   fn("add", type, fn("multiply", type, a, std::make_shared<MockSlotRef>(1, type)),
+                      std::make_shared<MockSlotRef>(2, type)),
+                   a);
+    auto fused = VFusedArithmeticExpr::fuse(root);
+    auto* fused_expr = dynamic_cast<VFusedArithmeticExpr*>(fused.get());
+    ASSERT_NE(fused_expr, nullptr);
+    EXPECT_EQ(fused_expr->get_num_children(), 4);
+    EXPECT_EQ(fused_expr->program_size(), 7);
+
+    std::vector<int64_t> va, vb, vc, expected;
+    for (int64_t i = 0; i < 3000; ++i) {
+        va.push_back(i);
+        vb.push_back(i % 7 - 3);
+        vc.push_back(-i * 5);
+        expected.push_back(va.back() * vb.back() + vc.back() - va.back());
+    }
+    Block block {ColumnHelper::create_column_with_name<DataTypeInt64>(va),
+                 ColumnHelper::create_column_with_name<DataTypeInt64>(vb),
+                 ColumnHelper::create_column_with_name<DataTypeInt64>(vc)};
+    EXPECT_TRUE(ColumnHelper::column_equal(execute(fused, block),
+                                           ColumnHelper::create_column<DataTypeInt64>(expected)));
+}
+
+TEST_F(VFusedArithmeticExprTest, NullableAndConstInputs) {
+    auto type = std::make_shared<DataTypeNullable>(std::make_shared<DataTypeFloat64>());
+    auto not_null_type = std::make_shared<DataTypeFloat64>();
+    // (a - 1.5) * b
+    auto root = fn("multiply", type,
+                   fn("subtract", type, std::make_shared<MockSlotRef>(0, type),
+                      std::make_shared<MockLiteral>(
+                              ColumnHelper::create_column_with_name<DataTypeFloat64>({1.5}))),
+                   std::make_shared<MockSlotRef>(1, not_null_type));
+    auto fused = VFusedArithmeticExpr::fuse(root);
+    ASSERT_NE(dynamic_cast<VFusedArithmeticExpr*>(fused.get()), nullptr);
+
+    Block block {ColumnHelper::create_nullable_column_with_name<DataTypeFloat64>({1.5, 2.5, 4.0},
+                                                                                 {0, 1, 0}),
+                 ColumnHelper::create_column_with_name<DataTypeFloat64>({2.0, 3.0, -1.0})};
+    EXPECT_TRUE(ColumnHelper::column_equal(
+            execute(fused, block), ColumnHelper::create_nullable_column<DataTypeFloat64>(
+                                           {0.0, 3.0, -2.5}, {0, 1, 0})));
+}
+
+TEST_F(VFusedArithmeticExprTest, SkipSingleOrMixedType) {
+    auto int_type = std::make_shared<DataTypeInt32>();
+    auto bigint_type = std::make_shared<DataTypeInt64>();
+    auto single = fn("add", int_type, std::make_shared<MockSlotRef>(0, int_type),
+                     std::make_shared<MockSlotRef>(1, int_type));
+    EXPECT_EQ(VFusedArithmeticExpr::fuse(single), single);
+
+    // the int adds are fused on their own, the bigint multiply over them is left alone
+    auto mixed = fn("multiply", bigint_type, fn("add", int_type, single, single),
+                    std::make_shared<MockSlotRef>(2, bigint_type));
+    auto fused = VFusedArithmeticExpr::fuse(mixed);
+    EXPECT_EQ(fused, mixed);
+    EXPECT_NE(dynamic_cast<VFusedArithmeticExpr*>(fused->get_child(0).get()), nullptr);
+}
+
+} // namespace doris::vectorized
@@ -0,0 +1,140 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "vec/exprs/vshared_expr.h"
+
+#include <gtest/gtest.h>
+
+#include "testutil/column_helper.h"
+#include "testutil/mock/mock_literal_expr.h"
+#include "testutil/mock/mock_slot_ref.h"
+#include "vec/core/block.h"
+#include "vec/data_types/data_type_number.h"
+#include "vec/data_types/data_type_string.h"
+#include "vec/exprs/vectorized_fn_call.h"
+#include "vec/exprs/vexpr_context.h"
+
+namespace doris::vectorized {
+
+namespace {
+// passes its argument through and counts how often it ran
+class CountingFnCall final : public VectorizedFnCall {
+public:
+    CountingFnCall(const std::string& name, VExprSPtr child) {
+        _fn.name.function_name = name;
+        _expr_name = name;
+        _data_type = std::make_shared<DataTypeInt32>();
+        add_child(std::move(child));
+    }
+
+    bool is_constant() const override { return false; }
+
+    Status execute(VExprContext* context, Block* block, int* result_column_id) override {
+        ++executed;
+        int arg = -1;
+        RETURN_IF_ERROR(_children[0]->execute(context, block, &arg));
+        block->insert({block->get_by_position(arg).column, _data_type, _expr_name});
+        *result_column_id = static_cast<int>(block->columns() - 1);
+        return Status::OK();
+    }
+
+    int executed = 0;
+};
+} // namespace
+
+class VSharedExprTest : public testing::Test {
+protected:
+    static VExprSPtr slot(int column_id) {
+        auto slot = std::make_shared<MockSlotRef>(column_id, std::make_shared<DataTypeInt32>());
+        slot->_slot_id = column_id;
+        return slot;
+    }
+
+    static VExprSPtr literal(const std::string& value) {
+        return std::make_shared<MockLiteral>(
+                ColumnHelper::create_column_with_name<DataTypeString>({value}));
+    }
+};
+
+TEST_F(VSharedExprTest, ShareAcrossContexts) {
+    auto f = std::make_shared<CountingFnCall>("f", slot(0));
+    auto f_again = std::make_shared<CountingFnCall>("f", slot(0));
+    auto g = std::make_shared<CountingFnCall>("g", f_again);
+    auto other = std::make_shared<CountingFnCall>("f", slot(1));
+    VExprContextSPtrs ctxs {VExprContext::create_shared(f), VExprContext::create_shared(g),
+                            VExprContext::create_shared(other)};
+
+    EXPECT_EQ(VSharedExpr::share_common_exprs(ctxs), 1);
+    EXPECT_NE(dynamic_cast<VSharedExpr*>(ctxs[0]->root().get()), nullptr);
+    EXPECT_NE(dynamic_cast<VSharedExpr*>(g->get_child(0).get()), nullptr);
+    EXPECT_EQ(dynamic_cast<VSharedExpr*>(ctxs[2]->root().get()), nullptr);
+    VExprContext::attach_expr_result_cache(ctxs);
+
+    Block block {ColumnHelper::create_column_with_name<DataTypeInt32>({1, 2, 3}),
+                 ColumnHelper::create_column_with_name<DataTypeInt32>({4, 5, 6})};
+    std::vector<int> result_ids(ctxs.size());
+    {
+        VExprResultCache::Scope scope(ctxs, &block);
+        for (size_t i = 0; i < ctxs.size(); ++i) {
+            EXPECT_TRUE(ctxs[i]->execute(&block, &result_ids[i]).ok());
+        }
+    }
+    EXPECT_EQ(f->executed + f_again->executed, 1);
+    EXPECT_EQ(g->executed, 1);
+    EXPECT_EQ(other->executed, 1);
+    EXPECT_TRUE(ColumnHelper::column_equal(block.get_by_position(result_ids[1]).column,
+                                           block.get_by_position(0).column));
+
+    // outside a scope every context evaluates on its own
+    int result_id = -1;
+    EXPECT_TRUE(ctxs[0]->execute(&block, &result_id).ok());
+    EXPECT_TRUE(ctxs[1]->execute(&block, &result_id).ok());
+    EXPECT_EQ(f->executed + f_again->executed, 3);
+}
+
+TEST_F(VSharedExprTest, SkipNonDeterministic) {
+    VExprContextSPtrs ctxs {
+            VExprContext::create_shared(std::make_shared<CountingFnCall>("random", slot(0))),
+            VExprContext::create_shared(std::make_shared<CountingFnCall>("random", slot(0)))};
+    EXPECT_EQ(VSharedExpr::share_common_exprs(ctxs), 0);
+    VExprContext::attach_expr_result_cache(ctxs);
+    EXPECT_EQ(ctxs[0]->expr_result_cache(), nullptr);
+}
+
+TEST_F(VSharedExprTest, LiteralsWithSeparatorsDoNotCollide) {
+    // f(slot, 'x),literal(String,y') and f(slot, 'x', 'y') must not be shared
+    auto one_literal = std::make_shared<CountingFnCall>("f", slot(0));
+    one_literal->add_child(literal("x),literal(String,y"));
+    auto two_literals = std::make_shared<CountingFnCall>("f", slot(0));
+    two_literals->add_child(literal("x"));
+    two_literals->add_child(literal("y"));
+    // nested fingerprints are length prefixed as well
+    auto nested = std::make_shared<CountingFnCall>("g", one_literal);
+    auto nested_again = std::make_shared<CountingFnCall>("g", two_literals);
+    VExprContextSPtrs ctxs {VExprContext::create_shared(nested),
+                            VExprContext::create_shared(nested_again)};
+    EXPECT_EQ(VSharedExpr::share_common_exprs(ctxs), 0);
+
+    // the same literals are still shared
+    auto same = std::make_shared<CountingFnCall>("f", slot(0));
+    same->add_child(literal("x"));
+    same->add_child(literal("y"));
+    ctxs.push_back(VExprContext::create_shared(same));
+    EXPECT_EQ(VSharedExpr::share_common_exprs(ctxs), 1);
+}
+
+} // namespace doris::vectorized
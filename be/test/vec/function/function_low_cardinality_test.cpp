@@ -0,0 +1,131 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <gtest/gtest.h>
+
+#include <string>
+
+#include "common/config.h"
+#include "vec/columns/column_const.h"
+#include "vec/columns/column_nullable.h"
+#include "vec/columns/column_string.h"
+#include "vec/data_types/data_type_nullable.h"
+#include "vec/data_types/data_type_string.h"
+#include "vec/functions/function.h"
+#include "vec/functions/function_helpers.h"
+
+namespace doris::vectorized {
+
+// concat(str, const suffix), counting the rows it really runs on
+class MockLowCardinalityConcat : public IFunction {
+public:
+    static constexpr auto name = "mock_low_cardinality_concat";
+    String get_name() const override { return name; }
+    bool use_default_implementation_for_low_cardinality() const override { return true; }
+    size_t get_number_of_arguments() const override { return 2; }
+
+    DataTypePtr get_return_type_impl(const DataTypes& arguments) const override {
+        return std::make_shared<DataTypeString>();
+    }
+
+    Status execute_impl(FunctionContext* context, Block& block, const ColumnNumbers& arguments,
+                        uint32_t result, size_t input_rows_count) const override {
+        const auto& strs = assert_cast<const ColumnString&>(
+                *block.get_by_position(arguments[0]).column);
+        const auto [suffix, suffix_const] =
+                unpack_if_const(block.get_by_position(arguments[1]).column);
+        auto res = ColumnString::create();
+        for (size_t i = 0; i < input_rows_count; ++i) {
+            auto value = strs.get_data_at(i).to_string() +
+                         suffix->get_data_at(index_check_const(i, suffix_const)).to_string();
+            res->insert_data(value.data(), value.size());
+        }
+        executed_rows += input_rows_count;
+        block.replace_by_position(result, std::move(res));
+        return Status::OK();
+    }
+
+    mutable size_t executed_rows = 0;
+};
+
+class LowCardinalityFunctionTest : public testing::Test {
+protected:
+    static Block make_block(size_t rows, size_t distinct, bool nullable) {
+        auto strs = ColumnString::create();
+        auto null_map = ColumnUInt8::create();
+        for (size_t i = 0; i < rows; ++i) {
+            auto value = "v" + std::to_string(i % distinct);
+            strs->insert_data(value.data(), value.size());
+            null_map->insert_value(i % 7 == 0);
+        }
+        DataTypePtr str_type = std::make_shared<DataTypeString>();
+        Block block;
+        if (nullable) {
+            block.insert({ColumnNullable::create(std::move(strs), std::move(null_map)),
+                          make_nullable(str_type), "str"});
+        } else {
+            block.insert({std::move(strs), str_type, "str"});
+        }
+        auto suffix = ColumnString::create();
+        suffix->insert_data("_x", 2);
+        block.insert({ColumnConst::create(std::move(suffix), rows), str_type, "suffix"});
+        block.insert({nullptr, nullable ? make_nullable(str_type) : str_type, "res"});
+        return block;
+    }
+
+    static void check_result(const Block& block, size_t distinct, bool nullable) {
+        const auto& res = block.get_by_position(2).column;
+        ASSERT_EQ(res->size(), block.rows());
+        for (size_t i = 0; i < res->size(); ++i) {
+            if (nullable && i % 7 == 0) {
+                EXPECT_TRUE(res->is_null_at(i));
+                continue;
+            }
+            EXPECT_EQ(res->get_data_at(i).to_string(), "v" + std::to_string(i % distinct) + "_x");
+        }
+    }
+};
+
+TEST_F(LowCardinalityFunctionTest, ExecuteOncePerDistinctValue) {
+    MockLowCardinalityConcat function;
+    auto block = make_block(2048, 5, true);
+    ASSERT_TRUE(function.execute(nullptr, block, {0, 1}, 2, 2048).ok());
+    // 5 distinct values plus one entry for null
+    EXPECT_EQ(function.executed_rows, 6U);
+    EXPECT_TRUE(block.get_by_position(2).column->is_nullable());
+    check_result(block, 5, true);
+}
+
+TEST_F(LowCardinalityFunctionTest, FallbackForHighCardinality) {
+    MockLowCardinalityConcat function;
+    auto block = make_block(2048, 2048, false);
+    ASSERT_TRUE(function.execute(nullptr, block, {0, 1}, 2, 2048).ok());
+    EXPECT_EQ(function.executed_rows, 2048U);
+    check_result(block, 2048, false);
+}
+
+TEST_F(LowCardinalityFunctionTest, DisabledByConfig) {
+    config::enable_low_cardinality_function_execution = false;
+    MockLowCardinalityConcat function;
+    auto block = make_block(2048, 5, false);
+    ASSERT_TRUE(function.execute(nullptr, block, {0, 1}, 2, 2048).ok());
+    config::enable_low_cardinality_function_execution = true;
+    EXPECT_EQ(function.executed_rows, 2048U);
+    check_result(block, 5, false);
+}
+
+} // namespace doris::vectorized
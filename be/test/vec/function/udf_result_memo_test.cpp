@@ -0,0 +1,107 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "vec/functions/udf_result_memo.h"
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "testutil/column_helper.h"
+#include "vec/columns/column_const.h"
+#include "vec/columns/column_vector.h"
+#include "vec/data_types/data_type_number.h"
+
+namespace doris::vectorized {
+
+// result = a * 10 + b, counting the rows it really runs on
+static UdfResultMemo::ExecuteFunc make_func(size_t& called_rows) {
+    return [&called_rows](Block& block, const ColumnNumbers& arguments, uint32_t result,
+                          size_t rows) {
+        auto a = block.get_by_position(arguments[0]).column->convert_to_full_column_if_const();
+        auto b = block.get_by_position(arguments[1]).column->convert_to_full_column_if_const();
+        auto res = ColumnInt32::create();
+        for (size_t i = 0; i < rows; ++i) {
+            res->insert_value(assert_cast<const ColumnInt32&>(*a).get_element(i) * 10 +
+                              assert_cast<const ColumnInt32&>(*b).get_element(i));
+        }
+        called_rows += rows;
+        block.replace_by_position(result, std::move(res));
+        return Status::OK();
+    };
+}
+
+static Block make_block(const std::vector<int32_t>& a, const std::vector<int32_t>& b) {
+    Block block = ColumnHelper::create_block<DataTypeInt32>(a, b);
+    block.insert({ColumnInt32::create(), std::make_shared<DataTypeInt32>(), "result"});
+    return block;
+}
+
+static std::vector<int32_t> result_of(const Block& block) {
+    const auto& col = assert_cast<const ColumnInt32&>(*block.get_by_position(2).column);
+    return {col.get_data().begin(), col.get_data().end()};
+}
+
+TEST(UdfResultMemoTest, dedup_within_and_across_blocks) {
+    UdfResultMemo memo(16);
+    size_t called_rows = 0;
+    auto func = make_func(called_rows);
+
+    auto block = make_block({1, 2, 1, 1, 2, 3}, {5, 5, 5, 6, 5, 5});
+    ASSERT_TRUE(memo.execute(block, {0, 1}, 2, 6, func).ok());
+    EXPECT_EQ(result_of(block), (std::vector<int32_t> {15, 25, 15, 16, 25, 35}));
+    EXPECT_EQ(called_rows, 4U);
+
+    // only (4, 5) is new
+    auto block2 = make_block({2, 4, 1}, {5, 5, 6});
+    ASSERT_TRUE(memo.execute(block2, {0, 1}, 2, 3, func).ok());
+    EXPECT_EQ(result_of(block2), (std::vector<int32_t> {25, 45, 16}));
+    EXPECT_EQ(called_rows, 5U);
+    EXPECT_EQ(memo.input_rows(), 9);
+    EXPECT_EQ(memo.call_rows(), 5);
+}
+
+TEST(UdfResultMemoTest, const_argument) {
+    UdfResultMemo memo(16);
+    size_t called_rows = 0;
+    auto func = make_func(called_rows);
+
+    auto block = make_block({1, 2, 1, 2}, {0, 0, 0, 0});
+    block.replace_by_position(
+            1, ColumnConst::create(ColumnHelper::create_column<DataTypeInt32>({7}), 4));
+    ASSERT_TRUE(memo.execute(block, {0, 1}, 2, 4, func).ok());
+    EXPECT_EQ(result_of(block), (std::vector<int32_t> {17, 27, 17, 27}));
+    EXPECT_EQ(called_rows, 2U);
+}
+
+TEST(UdfResultMemoTest, disabled_on_unique_inputs) {
+    UdfResultMemo memo(16);
+    size_t called_rows = 0;
+    auto func = make_func(called_rows);
+
+    std::vector<int32_t> a(UdfResultMemo::MIN_ROWS_BEFORE_DISABLE);
+    for (size_t i = 0; i < a.size(); ++i) {
+        a[i] = static_cast<int32_t>(i);
+    }
+    std::vector<int32_t> b(a.size(), 0);
+    auto block = make_block(a, b);
+    ASSERT_TRUE(memo.execute(block, {0, 1}, 2, a.size(), func).ok());
+    EXPECT_TRUE(memo.disabled());
+    EXPECT_EQ(result_of(block)[100], 1000);
+}
+
+} // namespace doris::vectorized
@@ -16,6 +16,7 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <bvar/bvar.h>
 #include <gen_cpp/AgentService_types.h>
 #include <gen_cpp/Descriptors_types.h>
 #include <gen_cpp/PaloInternalService_types.h>
@@ -36,7 +37,9 @@
 #include <utility>
 #include <vector>
 
+#include "common/config.h"
 #include "common/status.h"
+#include "cpp/sync_point.h"
 #include "gtest/gtest_pred_impl.h"
 #include "io/cache/block_file_cache_factory.h"
 #include "io/fs/local_file_system.h"
@@ -63,6 +66,7 @@
 #include "olap/tablet_schema.h"
 #include "olap/utils.h"
 #include "runtime/exec_env.h"
+#include "util/defer_op.h"
 #include "util/uid_util.h"
 #include "vec/columns/column.h"
 #include "vec/core/block.h"
@@ -72,6 +76,9 @@
 
 namespace doris {
 using namespace ErrorCode;
+
+extern bvar::Adder<int64_t> g_compaction_memory_wait_ms;
+
 namespace vectorized {
 
 static const uint32_t MAX_PATH_LEN = 1024;
@@ -436,6 +443,32 @@ TEST_F(VerticalCompactionTest, TestRowSourcesBuffer) {
     }
 }
 
+TEST_F(VerticalCompactionTest, TestRowSourcesBufferLongRuns) {
+    RowSourcesBuffer buffer(102, absolute_dir, ReaderType::READER_CUMULATIVE_COMPACTION);
+    std::vector<RowSource> row_sources;
+    // 37 rows from source 3 (agg flag on all but the first), then 5 rows from source 4
+    for (int i = 0; i < 37; ++i) {
+        row_sources.emplace_back(3, i != 0);
+    }
+    for (int i = 0; i < 5; ++i) {
+        row_sources.emplace_back(4, false);
+    }
+    EXPECT_TRUE(buffer.append(row_sources).ok());
+    static_cast<void>(buffer.flush());
+    static_cast<void>(buffer.seek_to_begin());
+    EXPECT_TRUE(buffer.has_remaining().ok());
+
+    EXPECT_EQ(buffer.same_source_count(3, 100), 37);
+    EXPECT_EQ(buffer.same_source_count(3, 20), 20);
+    EXPECT_EQ(buffer.same_source_count(3, 0), 1);
+    EXPECT_EQ(buffer.continuous_agg_count(0), 37);
+    EXPECT_EQ(buffer.continuous_agg_count(36), 1);
+    buffer.advance(37);
+    EXPECT_EQ(buffer.same_source_count(4, 100), 5);
+    buffer.advance(4);
+    EXPECT_EQ(buffer.same_source_count(4, 100), 1);
+}
+
 TEST_F(VerticalCompactionTest, TestDupKeyVerticalMerge) {
     auto num_input_rowset = 2;
     auto num_segments = 2;
@@ -1049,5 +1082,53 @@ TEST_F(VerticalCompactionTest, TestAggKeyVerticalMerge) {
     }
 }
 
+TEST_F(VerticalCompactionTest, TestMemoryWaitBoundedForWholeMerge) {
+    auto num_segments = 2;
+    auto rows_per_segment = 1024;
+    std::vector<std::vector<std::vector<std::tuple<int64_t, int64_t>>>> input_data;
+    generate_input_data(2, num_segments, rows_per_segment, NONOVERLAPPING, input_data);
+
+    TabletSchemaSPtr tablet_schema = create_schema();
+    std::vector<RowsetSharedPtr> input_rowsets;
+    std::vector<RowsetReaderSharedPtr> input_rs_readers;
+    for (auto i = 0; i < input_data.size(); i++) {
+        input_rowsets.push_back(create_rowset(tablet_schema, NONOVERLAPPING, input_data[i], i));
+        RowsetReaderSharedPtr rs_reader;
+        ASSERT_TRUE(input_rowsets.back()->create_reader(&rs_reader).ok());
+        input_rs_readers.push_back(std::move(rs_reader));
+    }
+    auto writer_context = create_rowset_writer_context(tablet_schema, NONOVERLAPPING, 3456,
+                                                       {0, input_rowsets.back()->end_version()});
+    auto res = RowsetFactory::create_rowset_writer(*engine_ref, writer_context, true);
+    ASSERT_TRUE(res.has_value()) << res.error();
+    auto output_rs_writer = std::move(res).value();
+
+    // pretend the process stays above its soft memory limit during the whole merge
+    auto old_wait_max_ms = config::compaction_memory_wait_max_ms;
+    config::compaction_memory_wait_max_ms = 300;
+    auto* sp = SyncPoint::get_instance();
+    sp->set_call_back("Merger::wait_for_memory", [](auto&& args) {
+        auto* exceed = try_any_cast<bool*>(args[0]);
+        *exceed = true;
+    });
+    sp->enable_processing();
+    Defer defer {[&] {
+        sp->disable_processing();
+        sp->clear_all_call_backs();
+        config::compaction_memory_wait_max_ms = old_wait_max_ms;
+    }};
+
+    // the key group and the value group share one bound
+    TabletSharedPtr tablet = create_tablet(*tablet_schema, false);
+    Merger::Statistics stats;
+    int64_t waited_ms = g_compaction_memory_wait_ms.get_value();
+    auto s = Merger::vertical_merge_rowsets(tablet, ReaderType::READER_BASE_COMPACTION,
+                                            *tablet_schema, input_rs_readers,
+                                            output_rs_writer.get(), 100, num_segments, &stats);
+    ASSERT_TRUE(s.ok()) << s;
+    EXPECT_EQ(g_compaction_memory_wait_ms.get_value() - waited_ms, 300);
+    EXPECT_EQ(stats.output_rows, 2 * num_segments * rows_per_segment);
+}
+
 } // namespace vectorized
 } // namespace doris
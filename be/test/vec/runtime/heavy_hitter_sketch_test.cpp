@@ -0,0 +1,70 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "vec/runtime/heavy_hitter_sketch.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+
+namespace doris::vectorized {
+
+TEST(HeavyHitterSketchTest, FindsHotValues) {
+    HeavyHitterSketch sketch(16);
+    // value 7 holds half of the updates, value 9 a quarter, the rest is a long tail
+    for (uint32_t i = 0; i < 40000; ++i) {
+        if (i % 2 == 0) {
+            sketch.update(7);
+        } else if (i % 4 == 1) {
+            sketch.update(9);
+        } else {
+            sketch.update(1000 + i);
+        }
+    }
+    EXPECT_EQ(sketch.total(), 40000);
+
+    auto hot = sketch.heavy_hitters(0.2);
+    ASSERT_EQ(hot.size(), 2);
+    EXPECT_EQ(hot[0].value, 7);
+    EXPECT_EQ(hot[1].value, 9);
+    // counts are never underestimated
+    EXPECT_GE(hot[0].count, 20000);
+    EXPECT_GE(hot[1].count, 10000);
+    EXPECT_LE(hot[0].count - hot[0].error, 20000);
+}
+
+TEST(HeavyHitterSketchTest, UniformHasNoHotValue) {
+    HeavyHitterSketch sketch(16);
+    for (uint32_t i = 0; i < 10000; ++i) {
+        sketch.update(i % 100);
+    }
+    EXPECT_TRUE(sketch.heavy_hitters(0.1).empty());
+}
+
+TEST(HeavyHitterSketchTest, WeightedUpdate) {
+    HeavyHitterSketch sketch(2);
+    sketch.update(1, 10);
+    sketch.update(2, 1);
+    sketch.update(3, 1);
+    auto hot = sketch.heavy_hitters(0.5);
+    ASSERT_EQ(hot.size(), 1);
+    EXPECT_EQ(hot[0].value, 1);
+    EXPECT_EQ(hot[0].count, 10);
+    EXPECT_EQ(hot[0].error, 0);
+}
+
+} // namespace doris::vectorized
@@ -17,8 +17,12 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <random>
+
 #include "testutil/column_helper.h"
 #include "testutil/mock/mock_slot_ref.h"
+#include "vec/common/assert_cast.h"
 #include "vec/data_types/data_type_nullable.h"
 #include "vec/data_types/data_type_number.h"
 #include "vec/runtime/vsorted_run_merger.h"
@@ -470,10 +474,10 @@ TEST(SortMergerTest, TEST_SINGLE_STREAM) {
             child_block_suppliers.push_back(block_supplier);
         }
         EXPECT_TRUE(merger->prepare(child_block_suppliers).ok());
-        EXPECT_EQ(merger->_priority_queue.size(), 1);
-        EXPECT_EQ(merger->_priority_queue.top()->pos, 0);
-        EXPECT_EQ(merger->_priority_queue.top()->rows, 1);
-        EXPECT_EQ(merger->_priority_queue.top()->block_ptr()->rows(), 1);
+        EXPECT_EQ(merger->_loser_tree.size(), 1);
+        EXPECT_EQ(merger->_loser_tree.top()->pos, 0);
+        EXPECT_EQ(merger->_loser_tree.top()->rows, 1);
+        EXPECT_EQ(merger->_loser_tree.top()->block_ptr()->rows(), 1);
     }
     {
         vectorized::Block block;
@@ -485,4 +489,59 @@ TEST(SortMergerTest, TEST_SINGLE_STREAM) {
     }
 }
 
-} // namespace doris::vectorized
\ No newline at end of file
+TEST(SortMergerTest, MANY_STREAMS) {
+    // 37 senders, each sending a random number of sorted blocks, the merged output
+    // must equal all values in sorted order.
+    const int num_children = 37;
+    const int batch_size = 64;
+    std::mt19937 rng(42);
+    std::vector<std::vector<std::vector<int64_t>>> inputs(num_children);
+    std::vector<int64_t> expected;
+    for (auto& blocks : inputs) {
+        std::vector<int64_t> values(rng() % 200);
+        for (auto& v : values) {
+            v = rng() % 1000;
+        }
+        std::sort(values.begin(), values.end());
+        expected.insert(expected.end(), values.begin(), values.end());
+        for (size_t start = 0; start < values.size();) {
+            size_t length = std::min<size_t>(1 + rng() % 50, values.size() - start);
+            blocks.emplace_back(values.begin() + start, values.begin() + start + length);
+            start += length;
+        }
+    }
+    std::sort(expected.begin(), expected.end());
+
+    auto profile = std::make_shared<RuntimeProfile>("");
+    auto ordering_expr = MockSlotRef::create_mock_contexts(std::make_shared<DataTypeInt64>());
+    VSortedRunMerger merger(ordering_expr, {true}, {false}, batch_size, -1, 0, profile.get());
+    std::vector<size_t> next_block(num_children, 0);
+    std::vector<vectorized::BlockSupplier> child_block_suppliers;
+    for (int child_idx = 0; child_idx < num_children; child_idx++) {
+        child_block_suppliers.emplace_back([&, id = child_idx](vectorized::Block* block,
+                                                               bool* eos) {
+            if (next_block[id] < inputs[id].size()) {
+                *block = ColumnHelper::create_block<DataTypeInt64>(inputs[id][next_block[id]++]);
+            }
+            *eos = next_block[id] == inputs[id].size();
+            return Status::OK();
+        });
+    }
+    EXPECT_TRUE(merger.prepare(child_block_suppliers).ok());
+
+    std::vector<int64_t> result;
+    bool eos = false;
+    while (!eos) {
+        vectorized::Block block;
+        EXPECT_TRUE(merger.get_next(&block, &eos).ok());
+        EXPECT_LE(block.rows(), static_cast<size_t>(batch_size));
+        if (block.rows() > 0) {
+            const auto& data =
+                    assert_cast<const ColumnInt64&>(*block.get_by_position(0).column).get_data();
+            result.insert(result.end(), data.begin(), data.end());
+        }
+    }
+    EXPECT_EQ(result, expected);
+}
+
+} // namespace doris::vectorized
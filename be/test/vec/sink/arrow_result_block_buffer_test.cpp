@@ -188,6 +188,36 @@ TEST_F(ArrowResultBlockBufferTest, TestArrowResultBlockBuffer) {
     }
 }
 
+TEST_F(ArrowResultBlockBufferTest, TestStreamingArrowResultBlockBuffer) {
+    MockRuntimeState state;
+    state.batsh_size = 1;
+    int buffer_size = 16;
+    auto dep = pipeline::Dependency::create_shared(0, 0, "Test", true);
+    auto ins_id = TUniqueId();
+    std::shared_ptr<arrow::Schema> schema;
+    config::enable_arrow_flight_result_streaming = true;
+    ArrowFlightResultBlockBuffer buffer(TUniqueId(), &state, schema, buffer_size);
+    config::enable_arrow_flight_result_streaming = false;
+    EXPECT_TRUE(buffer.is_streaming());
+    buffer.set_dependency(ins_id, dep);
+
+    // Blocks are queued as they are, not merged into the last queued block.
+    for (int i = 0; i < 2; i++) {
+        auto in_block = std::make_shared<Block>(ColumnHelper::create_block<DataTypeInt64>({1, 2}));
+        EXPECT_TRUE(buffer.add_batch(&state, in_block).ok());
+        EXPECT_EQ(buffer._result_batch_queue.size(), i + 1);
+        EXPECT_EQ(buffer._instance_rows[ins_id], 2 * (i + 1));
+        EXPECT_FALSE(dep->ready());
+    }
+    for (int i = 0; i < 2; i++) {
+        std::shared_ptr<Block> result;
+        EXPECT_TRUE(buffer.get_arrow_batch(&result).ok());
+        EXPECT_EQ(result->rows(), 2);
+    }
+    EXPECT_TRUE(buffer._result_batch_queue.empty());
+    EXPECT_TRUE(dep->ready());
+}
+
 TEST_F(ArrowResultBlockBufferTest, TestCancelArrowResultBlockBuffer) {
     MockRuntimeState state;
     state.batsh_size = 1;
@@ -0,0 +1,155 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "vec/sink/vmysql_result_writer.h"
+
+#include <gen_cpp/DataSinks_types.h>
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "common/exception.h"
+#include "runtime/exec_env.h"
+#include "testutil/mock/mock_runtime_state.h"
+#include "util/threadpool.h"
+#include "vec/columns/column_string.h"
+#include "vec/columns/column_vector.h"
+#include "vec/data_types/data_type_number.h"
+#include "vec/data_types/data_type_string.h"
+#include "vec/data_types/serde/data_type_number_serde.h"
+
+namespace doris::vectorized {
+
+// throws while converting one row, like a serde hitting a value it cannot convert
+class ThrowingInt32SerDe final : public DataTypeNumberSerDe<TYPE_INT> {
+public:
+    explicit ThrowingInt32SerDe(int64_t fail_row) : _fail_row(fail_row) {}
+
+    using DataTypeNumberSerDe<TYPE_INT>::write_column_to_mysql;
+    Status write_column_to_mysql(const IColumn& column, MysqlRowBuffer<false>& row_buffer,
+                                 int64_t row_idx, bool col_const,
+                                 const FormatOptions& options) const override {
+        if (row_idx == _fail_row) {
+            throw Exception(ErrorCode::INTERNAL_ERROR, "cannot convert row {}", row_idx);
+        }
+        return DataTypeNumberSerDe<TYPE_INT>::write_column_to_mysql(column, row_buffer, row_idx,
+                                                                    col_const, options);
+    }
+
+private:
+    int64_t _fail_row;
+};
+
+class VMysqlResultWriterTest : public testing::Test {
+public:
+    void SetUp() override {
+        ASSERT_TRUE(ThreadPoolBuilder("VMysqlResultWriterTest")
+                            .set_min_threads(1)
+                            .set_max_threads(4)
+                            .build(&ExecEnv::GetInstance()->_result_serialize_thread_pool)
+                            .ok());
+
+        auto int_column = ColumnInt32::create();
+        auto string_column = ColumnString::create();
+        for (int i = 0; i < kNumRows; ++i) {
+            int_column->insert_value(i);
+            auto str = "row_" + std::to_string(i);
+            string_column->insert_data(str.data(), str.size());
+        }
+        _int_column = std::move(int_column);
+        _string_column = std::move(string_column);
+        _arguments = {{_int_column.get(), false, std::make_shared<DataTypeInt32>()->get_serde()},
+                      {_string_column.get(), false,
+                       std::make_shared<DataTypeString>()->get_serde()}};
+    }
+
+    void TearDown() override { ExecEnv::GetInstance()->_result_serialize_thread_pool.reset(); }
+
+protected:
+    static constexpr int kNumRows = 5000;
+
+    // converts all rows sequentially, the expected output of the parallel conversion
+    void serialize(TFetchDataResult* result, uint64_t* bytes_sent) {
+        result->result_batch.rows.resize(kNumRows);
+        ASSERT_TRUE(_writer._serialize_rows(_arguments, result, 0, kNumRows, bytes_sent).ok());
+    }
+
+    MockRuntimeState _state;
+    VExprContextSPtrs _output_vexpr_ctxs;
+    VMysqlResultWriter<false> _writer {nullptr, _output_vexpr_ctxs, nullptr};
+    ColumnPtr _int_column;
+    ColumnPtr _string_column;
+    std::vector<VMysqlResultWriter<false>::Arguments> _arguments;
+};
+
+TEST_F(VMysqlResultWriterTest, ParallelSerializeKeepsRowOrder) {
+    TFetchDataResult expected;
+    uint64_t expected_bytes = 0;
+    serialize(&expected, &expected_bytes);
+
+    // 5000 rows make up to 4 ranges of at least 1024 rows, the last one shorter than the others
+    for (int parallelism : {2, 3, 4}) {
+        TFetchDataResult result;
+        result.result_batch.rows.resize(kNumRows);
+        uint64_t bytes_sent = 0;
+        auto st = _writer._parallel_serialize_rows(&_state, _arguments, &result, kNumRows,
+                                                   parallelism, &bytes_sent);
+        ASSERT_TRUE(st.ok()) << st;
+        EXPECT_EQ(bytes_sent, expected_bytes);
+        EXPECT_EQ(result.result_batch.rows, expected.result_batch.rows);
+    }
+}
+
+TEST_F(VMysqlResultWriterTest, ParallelSerializeWithoutPoolThreads) {
+    TFetchDataResult expected;
+    uint64_t expected_bytes = 0;
+    serialize(&expected, &expected_bytes);
+
+    // the pool rejects every task, the calling thread converts all rows
+    ExecEnv::GetInstance()->_result_serialize_thread_pool->shutdown();
+    TFetchDataResult result;
+    result.result_batch.rows.resize(kNumRows);
+    uint64_t bytes_sent = 0;
+    auto st = _writer._parallel_serialize_rows(&_state, _arguments, &result, kNumRows, 4,
+                                               &bytes_sent);
+    ASSERT_TRUE(st.ok()) << st;
+    EXPECT_EQ(bytes_sent, expected_bytes);
+    EXPECT_EQ(result.result_batch.rows, expected.result_batch.rows);
+}
+
+TEST_F(VMysqlResultWriterTest, ParallelSerializeRangeThrows) {
+    // 4 ranges of 1250 rows, the failing row is in the calling thread's range or in a task's
+    for (int64_t fail_row : {10, 3000}) {
+        auto arguments = _arguments;
+        arguments[0].serde = std::make_shared<ThrowingInt32SerDe>(fail_row);
+        TFetchDataResult result;
+        result.result_batch.rows.resize(kNumRows);
+        uint64_t bytes_sent = 0;
+        auto st = _writer._parallel_serialize_rows(&_state, arguments, &result, kNumRows, 4,
+                                                   &bytes_sent);
+        ASSERT_FALSE(st.ok());
+        EXPECT_EQ(st.code(), ErrorCode::INTERNAL_ERROR);
+        EXPECT_TRUE(st.to_string().find(fmt::format("cannot convert row {}", fail_row)) !=
+                    std::string::npos)
+                << st;
+        EXPECT_EQ(bytes_sent, 0);
+    }
+}
+
+} // namespace doris::vectorized
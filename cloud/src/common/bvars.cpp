@@ -98,6 +98,7 @@ bvar::Adder<int64_t> g_bvar_update_delete_bitmap_fail_counter;
 bvar::Window<bvar::Adder<int64_t> > g_bvar_update_delete_bitmap_fail_counter_minute("ms", "update_delete_bitmap_fail", &g_bvar_update_delete_bitmap_fail_counter, 60);
 bvar::Adder<int64_t> g_bvar_get_delete_bitmap_fail_counter;
 bvar::Window<bvar::Adder<int64_t> > g_bvar_get_delete_bitmap_fail_counter_minute("ms", "get_delete_bitmap_fail", &g_bvar_get_delete_bitmap_fail_counter, 60);
+bvar::Adder<int64_t> g_bvar_get_version_cached_read_version_counter("ms", "get_version_cached_read_version");
 
 // recycler's bvars
 // TODO: use mbvar for per instance, https://github.com/apache/brpc/blob/master/docs/cn/mbvar_c++.md
@@ -144,6 +145,12 @@ mBvarStatus<double> g_bvar_recycler_instance_recycle_time_per_resource("recycler
 // represents the bytes of resources that can be recycled per ms
 mBvarStatus<double> g_bvar_recycler_instance_recycle_bytes_per_ms("recycler_instance_recycle_bytes_per_ms", {"instance_id", "resource_type"});
 
+// txn lazy commit's latency breakdown in microseconds
+bvar::LatencyRecorder g_bvar_txn_lazy_commit_batch_get_latency("txn_lazy_commit", "batch_get");
+bvar::LatencyRecorder g_bvar_txn_lazy_commit_convert_tmp_rowsets_latency("txn_lazy_commit", "convert_tmp_rowsets");
+bvar::LatencyRecorder g_bvar_txn_lazy_commit_partitions_latency("txn_lazy_commit", "commit_partitions");
+bvar::LatencyRecorder g_bvar_txn_lazy_commit_make_visible_latency("txn_lazy_commit", "make_visible");
+
 // txn_kv's bvars
 bvar::LatencyRecorder g_bvar_txn_kv_get("txn_kv", "get");
 bvar::LatencyRecorder g_bvar_txn_kv_range_get("txn_kv", "range_get");
@@ -258,6 +258,7 @@ extern BvarLatencyRecorderWithTag g_bvar_ms_check_kv;
 extern BvarLatencyRecorderWithTag g_bvar_ms_get_schema_dict;
 extern bvar::Adder<int64_t> g_bvar_update_delete_bitmap_fail_counter;
 extern bvar::Adder<int64_t> g_bvar_get_delete_bitmap_fail_counter;
+extern bvar::Adder<int64_t> g_bvar_get_version_cached_read_version_counter;
 
 // recycler's bvars
 extern BvarStatusWithTag<int64_t> g_bvar_recycler_recycle_index_earlest_ts;
@@ -290,6 +291,12 @@ extern mBvarIntAdder g_bvar_recycler_instance_recycle_round;
 extern mBvarStatus<double> g_bvar_recycler_instance_recycle_time_per_resource;
 extern mBvarStatus<double> g_bvar_recycler_instance_recycle_bytes_per_ms;
 
+// txn lazy commit's latency breakdown in microseconds
+extern bvar::LatencyRecorder g_bvar_txn_lazy_commit_batch_get_latency;
+extern bvar::LatencyRecorder g_bvar_txn_lazy_commit_convert_tmp_rowsets_latency;
+extern bvar::LatencyRecorder g_bvar_txn_lazy_commit_partitions_latency;
+extern bvar::LatencyRecorder g_bvar_txn_lazy_commit_make_visible_latency;
+
 // txn_kv's bvars
 extern bvar::LatencyRecorder g_bvar_txn_kv_get;
 extern bvar::LatencyRecorder g_bvar_txn_kv_range_get;
@@ -175,6 +175,12 @@ CONF_mBool(snapshot_get_tablet_stats, "true");
 
 // Value codec version
 CONF_mInt16(meta_schema_value_version, "1");
+// Max number of parsed schemas cached in memory for get_rowset, 0 means disabled
+CONF_mInt64(meta_schema_cache_capacity, "10000");
+// get_version reuses a read version fetched by another get_version no longer than this many ms ago,
+// which saves a read version round trip per request but may return versions stale for up to this
+// long. 0 means disabled, it must be far less than the 5s mvcc window of fdb.
+CONF_mInt64(get_version_read_version_cache_ms, "0");
 
 // Limit kv size of Schema SchemaDictKeyList, default 5MB
 CONF_mInt32(schema_dict_kv_size_limit, "5242880");
@@ -265,6 +271,9 @@ CONF_mInt64(max_s3_client_retry, "10");
 
 // Max byte getting delete bitmap can return, default is 1GB
 CONF_mInt64(max_get_delete_bitmap_byte, "1073741824");
+// Max age of a txn reused to read the delete bitmaps of the next rowsets in get_delete_bitmap,
+// 0 means a new txn for every rowset
+CONF_mInt64(get_delete_bitmap_txn_reuse_ms, "1000");
 // retry configs of remove_delete_bitmap_update_lock txn_conflict
 CONF_Bool(delete_bitmap_enable_retry_txn_conflict, "true");
 
@@ -280,6 +289,8 @@ CONF_mInt64(max_txn_commit_byte, "7340032");
 CONF_Bool(enable_cloud_txn_lazy_commit, "true");
 CONF_Int32(txn_lazy_commit_rowsets_thresold, "1000");
 CONF_Int32(txn_lazy_commit_num_threads, "8");
+// Threads committing the partitions of lazily committed txns in parallel, <= 1 means serially
+CONF_Int32(txn_lazy_commit_partition_num_threads, "16");
 CONF_Int32(txn_lazy_max_rowsets_per_batch, "1000");
 // max TabletIndexPB num for batch get
 CONF_Int32(max_tablet_index_num_per_batch, "1000");
@@ -214,6 +214,42 @@ void get_tablet_idx(MetaServiceCode& code, std::string& msg, Transaction* txn,
     }
 }
 
+TxnErrorCode MetaServiceImpl::create_version_read_txn(std::unique_ptr<Transaction>* txn,
+                                                      bool* cached) {
+    *cached = false;
+    TxnErrorCode err = txn_kv_->create_txn(txn);
+    int64_t cache_ms = config::get_version_read_version_cache_ms;
+    if (err != TxnErrorCode::TXN_OK || cache_ms <= 0) {
+        return err;
+    }
+
+    using namespace std::chrono;
+    int64_t now_ms = duration_cast<milliseconds>(steady_clock::now().time_since_epoch()).count();
+    {
+        std::lock_guard lock(read_version_mtx_);
+        if (cached_read_version_ > 0 && now_ms - cached_read_version_time_ms_ < cache_ms) {
+            (*txn)->set_read_version(cached_read_version_);
+            *cached = true;
+            g_bvar_get_version_cached_read_version_counter << 1;
+            return TxnErrorCode::TXN_OK;
+        }
+    }
+
+    // The read version is at least as new as `now_ms`, so the staleness is bounded by `cache_ms`
+    int64_t read_version = 0;
+    err = (*txn)->get_read_version(&read_version);
+    if (err != TxnErrorCode::TXN_OK) {
+        LOG(WARNING) << "failed to get read version, err=" << err;
+        return err;
+    }
+    std::lock_guard lock(read_version_mtx_);
+    if (read_version > cached_read_version_) {
+        cached_read_version_ = read_version;
+        cached_read_version_time_ms_ = now_ms;
+    }
+    return TxnErrorCode::TXN_OK;
+}
+
 void MetaServiceImpl::get_version(::google::protobuf::RpcController* controller,
                                   const GetVersionRequest* request, GetVersionResponse* response,
                                   ::google::protobuf::Closure* done) {
@@ -301,7 +337,8 @@ void MetaServiceImpl::get_version(::google::protobuf::RpcController* controller,
 
     code = MetaServiceCode::OK;
 
-    TxnErrorCode err = txn_kv_->create_txn(&txn);
+    bool cached_read_version = false;
+    TxnErrorCode err = create_version_read_txn(&txn, &cached_read_version);
     if (err != TxnErrorCode::TXN_OK) {
         msg = "failed to create txn";
         code = cast_as<ErrCategory::CREATE>(err);
@@ -311,6 +348,16 @@ void MetaServiceImpl::get_version(::google::protobuf::RpcController* controller,
     std::string ver_val;
     // 0 for success get a key, 1 for key not found, negative for error
     err = txn->get(ver_key, &ver_val);
+    if (err == TxnErrorCode::TXN_TOO_OLD && cached_read_version) {
+        // The cached read version is out of the mvcc window, retry with a fresh one.
+        err = txn_kv_->create_txn(&txn);
+        if (err != TxnErrorCode::TXN_OK) {
+            msg = "failed to create txn";
+            code = cast_as<ErrCategory::CREATE>(err);
+            return;
+        }
+        err = txn->get(ver_key, &ver_val);
+    }
     VLOG_DEBUG << "xxx get version_key=" << hex(ver_key);
     if (err == TxnErrorCode::TXN_OK) {
         if (is_table_version) {
@@ -416,10 +463,16 @@ void MetaServiceImpl::batch_get_version(::google::protobuf::RpcController* contr
     version_keys.reserve(BATCH_SIZE);
     version_values.reserve(BATCH_SIZE);
 
+    // Only the first txn reuses the cached read version, the others are created because the
+    // previous one is too old.
+    bool first_txn = true;
     while ((code == MetaServiceCode::OK || code == MetaServiceCode::KV_TXN_TOO_OLD) &&
            response->versions_size() < num_acquired) {
         std::unique_ptr<Transaction> txn;
-        TxnErrorCode err = txn_kv_->create_txn(&txn);
+        bool cached_read_version = false;
+        TxnErrorCode err = first_txn ? create_version_read_txn(&txn, &cached_read_version)
+                                     : txn_kv_->create_txn(&txn);
+        first_txn = false;
         if (err != TxnErrorCode::TXN_OK) {
             msg = "failed to create txn";
             code = cast_as<ErrCategory::CREATE>(err);
@@ -2578,9 +2631,13 @@ std::vector<std::pair<int64_t, int64_t>> calc_sync_versions(int64_t req_bc_cnt,
     return versions;
 }
 
-static bool try_fetch_and_parse_schema(Transaction* txn, RowsetMetaCloudPB& rowset_meta,
-                                       const std::string& key, MetaServiceCode& code,
-                                       std::string& msg) {
+static bool try_fetch_and_parse_schema(Transaction* txn, SchemaCache& cache,
+                                       RowsetMetaCloudPB& rowset_meta, const std::string& key,
+                                       MetaServiceCode& code, std::string& msg) {
+    if (auto cached = cache.get(key); cached != nullptr) {
+        rowset_meta.mutable_tablet_schema()->CopyFrom(*cached);
+        return true;
+    }
     ValueBuf val_buf;
     TxnErrorCode err = cloud::blob_get(txn, key, &val_buf);
     if (err != TxnErrorCode::TXN_OK) {
@@ -2596,6 +2653,7 @@ static bool try_fetch_and_parse_schema(Transaction* txn, RowsetMetaCloudPB& rows
         msg = fmt::format("malformed schema value, key={}", key);
         return false;
     }
+    cache.put(key, std::make_shared<doris::TabletSchemaCloudPB>(*schema));
     return true;
 }
 
@@ -2812,7 +2870,8 @@ void MetaServiceImpl::get_rowset(::google::protobuf::RpcController* controller,
                 auto key = meta_schema_key(
                         {instance_id, idx.index_id(), rowset_meta.schema_version()});
                 if (!is_versioned_read) {
-                    if (!try_fetch_and_parse_schema(txn.get(), rowset_meta, key, code, msg)) {
+                    if (!try_fetch_and_parse_schema(txn.get(), schema_cache_, rowset_meta, key,
+                                                    code, msg)) {
                         return;
                     }
                 } else {
@@ -3531,20 +3590,33 @@ void MetaServiceImpl::get_delete_bitmap(google::protobuf::RpcController* control
     bool test = false;
     TEST_SYNC_POINT_CALLBACK("get_delete_bitmap_test", &test);
 
+    // Tablets with many small loads have many rowsets of a few bitmap keys each, so a txn is
+    // shared by the rowsets read within get_delete_bitmap_txn_reuse_ms instead of getting a new
+    // read version for every rowset. A long read still creates a new txn to avoid TXN_TOO_OLD.
+    std::unique_ptr<Transaction> txn;
+    StopWatch txn_sw;
+    DORIS_CLOUD_DEFER {
+        if (txn == nullptr) return;
+        stats.get_bytes += txn->get_bytes();
+        stats.get_counter += txn->num_get_keys();
+    };
     for (size_t i = 0; i < rowset_ids.size(); i++) {
-        // create a new transaction every time, avoid using one transaction that takes too long
-        std::unique_ptr<Transaction> txn;
-        TxnErrorCode err = txn_kv_->create_txn(&txn);
-        if (err != TxnErrorCode::TXN_OK) {
-            code = cast_as<ErrCategory::CREATE>(err);
-            msg = "failed to init txn";
-            return;
+        TxnErrorCode err = TxnErrorCode::TXN_OK;
+        if (txn == nullptr ||
+            txn_sw.elapsed_us() / 1000 >= config::get_delete_bitmap_txn_reuse_ms) {
+            if (txn != nullptr) {
+                stats.get_bytes += txn->get_bytes();
+                stats.get_counter += txn->num_get_keys();
+                txn = nullptr;
+            }
+            err = txn_kv_->create_txn(&txn);
+            if (err != TxnErrorCode::TXN_OK) {
+                code = cast_as<ErrCategory::CREATE>(err);
+                msg = "failed to init txn";
+                return;
+            }
+            txn_sw.reset();
         }
-        DORIS_CLOUD_DEFER {
-            if (txn == nullptr) return;
-            stats.get_bytes += txn->get_bytes();
-            stats.get_counter += txn->num_get_keys();
-        };
         MetaDeleteBitmapInfo start_key_info {instance_id, tablet_id, rowset_ids[i],
                                              begin_versions[i], 0};
         MetaDeleteBitmapInfo end_key_info {instance_id, tablet_id, rowset_ids[i], end_versions[i],
@@ -3581,6 +3653,7 @@ void MetaServiceImpl::get_delete_bitmap(google::protobuf::RpcController* control
                     msg = ss.str();
                     return;
                 }
+                txn_sw.reset();
                 if (test) {
                     err = txn->get(start_key, end_key, &it, false, 2);
                 } else {
@@ -24,6 +24,7 @@
 #include <google/protobuf/service.h>
 
 #include <chrono>
+#include <mutex>
 #include <random>
 #include <type_traits>
 
@@ -31,6 +32,7 @@
 #include "common/stats.h"
 #include "cpp/sync_point.h"
 #include "meta-service/delete_bitmap_lock_white_list.h"
+#include "meta-service/meta_service_schema.h"
 #include "meta-service/txn_lazy_committer.h"
 #include "meta-store/txn_kv.h"
 #include "rate-limiter/rate_limiter.h"
@@ -444,11 +446,20 @@ private:
             const GetVersionRequest* request, GetVersionResponse* response,
             std::string_view instance_id, KVStats& stats);
 
+    // Create a txn to read versions, which reuses the read version cached by a recent call if
+    // `config::get_version_read_version_cache_ms` allows, `*cached` tells whether it is reused.
+    TxnErrorCode create_version_read_txn(std::unique_ptr<Transaction>* txn, bool* cached);
+
     std::shared_ptr<TxnKv> txn_kv_;
     std::shared_ptr<ResourceManager> resource_mgr_;
     std::shared_ptr<RateLimiter> rate_limiter_;
     std::shared_ptr<TxnLazyCommitter> txn_lazy_committer_;
     std::shared_ptr<DeleteBitmapLockWhiteList> delete_bitmap_lock_white_list_;
+    SchemaCache schema_cache_;
+
+    std::mutex read_version_mtx_;
+    int64_t cached_read_version_ = -1;
+    int64_t cached_read_version_time_ms_ = 0;
 };
 
 class MetaServiceProxy final : public MetaService {
@@ -131,6 +131,35 @@ bool parse_schema_value(const ValueBuf& buf, doris::TabletSchemaCloudPB* schema)
     // TODO(plat1ko): Apply decompression based on value version
     return buf.to_pb(schema);
 }
+
+std::shared_ptr<const doris::TabletSchemaCloudPB> SchemaCache::get(const std::string& schema_key) {
+    std::lock_guard lock(mtx_);
+    auto it = entries_.find(schema_key);
+    if (it == entries_.end()) {
+        return nullptr;
+    }
+    lru_.splice(lru_.begin(), lru_, it->second.second);
+    return it->second.first;
+}
+
+void SchemaCache::put(const std::string& schema_key,
+                      std::shared_ptr<const doris::TabletSchemaCloudPB> schema) {
+    auto capacity = config::meta_schema_cache_capacity;
+    std::lock_guard lock(mtx_);
+    if (auto it = entries_.find(schema_key); it != entries_.end()) {
+        lru_.splice(lru_.begin(), lru_, it->second.second);
+        return;
+    }
+    if (capacity > 0) {
+        lru_.push_front(schema_key);
+        entries_.emplace(schema_key, Entry {std::move(schema), lru_.begin()});
+    }
+    // The capacity may be reduced at runtime
+    while (lru_.size() > static_cast<size_t>(std::max<int64_t>(capacity, 0))) {
+        entries_.erase(lru_.back());
+        lru_.pop_back();
+    }
+}
 /**
  * Processes dictionary items, mapping them to a dictionary key and adding the key to rowset meta.
  * If it's a new item, generates a new key and increments the item ID. This function is also responsible
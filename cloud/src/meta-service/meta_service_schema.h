@@ -20,10 +20,36 @@
 #include <gen_cpp/cloud.pb.h>
 #include <gen_cpp/olap_file.pb.h>
 
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
 namespace doris::cloud {
 class Transaction;
 struct ValueBuf;
 
+// Schema kvs are never modified once written, so the parsed schemas of the hottest schema keys are
+// kept in memory to save their kv reads and parsing in get_rowset. The capacity is given by
+// config::meta_schema_cache_capacity, 0 disables the cache.
+class SchemaCache {
+public:
+    std::shared_ptr<const doris::TabletSchemaCloudPB> get(const std::string& schema_key);
+
+    void put(const std::string& schema_key,
+             std::shared_ptr<const doris::TabletSchemaCloudPB> schema);
+
+private:
+    using Entry = std::pair<std::shared_ptr<const doris::TabletSchemaCloudPB>,
+                            std::list<std::string>::iterator>;
+
+    std::mutex mtx_;
+    // Most recently used at front
+    std::list<std::string> lru_;
+    std::unordered_map<std::string, Entry> entries_;
+};
+
 void put_schema_kv(MetaServiceCode& code, std::string& msg, Transaction* txn,
                    std::string_view schema_key, const doris::TabletSchemaCloudPB& schema);
 
@@ -142,41 +142,62 @@ void convert_tmp_rowsets(
     // tablet_id -> stats
     std::unordered_map<int64_t, TabletStats> tablet_stats;
 
+    // Read the tmp rowset keys and the missing tablet indexes of the batch in parallel
+    std::vector<std::string> tmp_rowset_keys;
+    std::vector<std::string> tablet_idx_keys;
+    // tablet_id -> index in tablet_idx_keys
+    std::unordered_map<int64_t, size_t> tablet_idx_key_pos;
     for (auto& [tmp_rowset_key, tmp_rowset_pb] : tmp_rowsets_meta) {
-        std::string tmp_rowst_data;
-        err = txn->get(tmp_rowset_key, &tmp_rowst_data);
-        if (TxnErrorCode::TXN_KEY_NOT_FOUND == err) {
+        tmp_rowset_keys.push_back(tmp_rowset_key);
+        if (!is_versioned_read && !tablet_ids.contains(tmp_rowset_pb.tablet_id()) &&
+            tablet_idx_key_pos.emplace(tmp_rowset_pb.tablet_id(), tablet_idx_keys.size()).second) {
+            tablet_idx_keys.push_back(
+                    meta_tablet_idx_key({instance_id, tmp_rowset_pb.tablet_id()}));
+        }
+    }
+    std::vector<std::optional<std::string>> tmp_rowset_values;
+    std::vector<std::optional<std::string>> tablet_idx_values;
+    {
+        StopWatch sw;
+        err = txn->batch_get(&tmp_rowset_values, tmp_rowset_keys);
+        if (err == TxnErrorCode::TXN_OK && !tablet_idx_keys.empty()) {
+            err = txn->batch_get(&tablet_idx_values, tablet_idx_keys,
+                                 Transaction::BatchGetOptions(true));
+        }
+        g_bvar_txn_lazy_commit_batch_get_latency << sw.elapsed_us();
+    }
+    if (TxnErrorCode::TXN_OK != err) {
+        code = cast_as<ErrCategory::READ>(err);
+        ss << "failed to batch get tmp rowsets and tablet indexes, txn_id=" << txn_id
+           << " err=" << err;
+        msg = ss.str();
+        LOG(WARNING) << msg;
+        return;
+    }
+
+    for (size_t rowset_idx = 0; rowset_idx < tmp_rowsets_meta.size(); ++rowset_idx) {
+        auto& [tmp_rowset_key, tmp_rowset_pb] = tmp_rowsets_meta[rowset_idx];
+        if (!tmp_rowset_values[rowset_idx].has_value()) {
             // the tmp rowset has been converted
             VLOG_DEBUG << "tmp rowset has been converted, key=" << hex(tmp_rowset_key);
             continue;
         }
 
-        if (TxnErrorCode::TXN_OK != err) {
-            code = cast_as<ErrCategory::READ>(err);
-            ss << "failed to get tmp_rowset_key, txn_id=" << txn_id
-               << " key=" << hex(tmp_rowset_key) << " err=" << err;
-            msg = ss.str();
-            LOG(WARNING) << msg;
-            return;
-        }
-
         if (!tablet_ids.contains(tmp_rowset_pb.tablet_id())) {
             TabletIndexPB tablet_idx_pb;
             if (!is_versioned_read) {
-                std::string tablet_idx_key =
-                        meta_tablet_idx_key({instance_id, tmp_rowset_pb.tablet_id()});
-                std::string tablet_idx_val;
-                err = txn->get(tablet_idx_key, &tablet_idx_val, true);
-                if (TxnErrorCode::TXN_OK != err) {
-                    code = err == TxnErrorCode::TXN_KEY_NOT_FOUND
-                                   ? MetaServiceCode::TXN_ID_NOT_FOUND
-                                   : cast_as<ErrCategory::READ>(err);
+                size_t pos = tablet_idx_key_pos.at(tmp_rowset_pb.tablet_id());
+                const std::string& tablet_idx_key = tablet_idx_keys[pos];
+                if (!tablet_idx_values[pos].has_value()) {
+                    code = MetaServiceCode::TXN_ID_NOT_FOUND;
                     ss << "failed to get tablet idx, txn_id=" << txn_id
-                       << " key=" << hex(tablet_idx_key) << " err=" << err;
+                       << " key=" << hex(tablet_idx_key)
+                       << " err=" << TxnErrorCode::TXN_KEY_NOT_FOUND;
                     msg = ss.str();
                     LOG(WARNING) << msg;
                     return;
                 }
+                const std::string& tablet_idx_val = *tablet_idx_values[pos];
 
                 if (!tablet_idx_pb.ParseFromString(tablet_idx_val)) {
                     code = MetaServiceCode::PROTOBUF_PARSE_ERR;
@@ -216,8 +237,8 @@ void convert_tmp_rowsets(
                     msg = ss.str();
                     return;
                 }
-                LOG(INFO) << "txn_id=" << txn_id << " key=" << hex(ver_key)
-                          << " version_pb:" << version_pb.ShortDebugString();
+                VLOG_DEBUG << "txn_id=" << txn_id << " key=" << hex(ver_key)
+                           << " version_pb:" << version_pb.ShortDebugString();
             } else {
                 CHECK(false) << "versioned read is not supported yet";
             }
@@ -265,8 +286,8 @@ void convert_tmp_rowsets(
         }
 
         txn->put(rowset_key, rowset_val);
-        LOG(INFO) << "put rowset_key=" << hex(rowset_key) << " txn_id=" << txn_id
-                  << " rowset_size=" << rowset_key.size() + rowset_val.size();
+        VLOG_DEBUG << "put rowset_key=" << hex(rowset_key) << " txn_id=" << txn_id
+                   << " rowset_size=" << rowset_key.size() + rowset_val.size();
 
         // Accumulate affected rows
         auto& stats = tablet_stats[tmp_rowset_pb.tablet_id()];
@@ -288,7 +309,7 @@ void convert_tmp_rowsets(
                 msg = ss.str();
                 return;
             }
-            LOG(INFO) << "put versioned rowset_key=" << hex(rowset_key) << " txn_id=" << txn_id;
+            VLOG_DEBUG << "put versioned rowset_key=" << hex(rowset_key) << " txn_id=" << txn_id;
         }
     }
 
@@ -322,8 +343,8 @@ void convert_tmp_rowsets(
                 return;
             }
 
-            LOG(INFO) << "put versioned tablet stats key=" << hex(stats_key)
-                      << " tablet_id=" << tablet_id << " txn_id=" << txn_id;
+            VLOG_DEBUG << "put versioned tablet stats key=" << hex(stats_key)
+                       << " tablet_id=" << tablet_id << " txn_id=" << txn_id;
         }
     }
 
@@ -472,7 +493,6 @@ void TxnLazyCommitTask::commit() {
     bool is_versioned_write = txn_info.versioned_write();
     bool is_versioned_read = txn_info.versioned_read();
 
-    std::stringstream ss;
     int retry_times = 0;
     do {
         LOG(INFO) << "lazy task commit txn_id=" << txn_id_ << " retry_times=" << retry_times;
@@ -505,178 +525,237 @@ void TxnLazyCommitTask::commit() {
                         tmp_rowset_pb;
             }
 
-            for (auto& [partition_id, tmp_rowset_metas] : partition_to_tmp_rowset_metas) {
-                // tablet_id -> TabletIndexPB
-                std::map<int64_t, TabletIndexPB> tablet_ids;
-                Versionstamp versionstamp;
-                if (is_versioned_write) {
-                    // Read the versionstamp from the partition key.
-                    bool is_partition_version_valid = false;
-                    auto [code, msg] = get_partition_versionstamp(
-                            txn_kv_.get(), instance_id_, txn_id_, partition_id, &versionstamp,
-                            &is_partition_version_valid);
-                    if (code != MetaServiceCode::OK) {
-                        code_ = code;
-                        ss << "failed to get partition versionstamp, txn_id=" << txn_id_
-                           << " partition_id=" << partition_id << " err=" << msg;
-                        msg_ = ss.str();
-                        LOG(WARNING) << msg_;
-                        break;
-                    }
-                    if (!is_partition_version_valid) {
-                        // The partition version is not valid, it might been committed, skip this partition.
-                        continue;
-                    }
-                }
-
-                for (size_t i = 0; i < tmp_rowset_metas.size();
-                     i += config::txn_lazy_max_rowsets_per_batch) {
-                    size_t end =
-                            (i + config::txn_lazy_max_rowsets_per_batch) > tmp_rowset_metas.size()
-                                    ? tmp_rowset_metas.size()
-                                    : i + config::txn_lazy_max_rowsets_per_batch;
-                    std::vector<std::pair<std::string, doris::RowsetMetaCloudPB>>
-                            sub_partition_tmp_rowset_metas(tmp_rowset_metas.begin() + i,
-                                                           tmp_rowset_metas.begin() + end);
-                    convert_tmp_rowsets(instance_id_, txn_id_, txn_kv_, code_, msg_, db_id,
-                                        sub_partition_tmp_rowset_metas, tablet_ids,
-                                        is_versioned_write, is_versioned_read, versionstamp);
-                    if (code_ != MetaServiceCode::OK) break;
-                }
-                if (code_ != MetaServiceCode::OK) break;
-
-                std::unique_ptr<Transaction> txn;
-                TxnErrorCode err = txn_kv_->create_txn(&txn);
-                if (err != TxnErrorCode::TXN_OK) {
-                    code_ = cast_as<ErrCategory::CREATE>(err);
-                    ss << "failed to create txn, txn_id=" << txn_id_ << " err=" << err;
-                    msg_ = ss.str();
-                    LOG(WARNING) << msg_;
-                    break;
-                }
-
-                int64_t table_id = -1;
-                DCHECK(tmp_rowset_metas.size() > 0);
-                if (table_id <= 0) {
-                    if (tablet_ids.size() > 0) {
-                        // get table_id from memory cache
-                        table_id = tablet_ids.begin()->second.table_id();
-                    } else if (!is_versioned_read) {
-                        // get table_id from storage
-                        int64_t first_tablet_id = tmp_rowset_metas.begin()->second.tablet_id();
-                        std::string tablet_idx_key =
-                                meta_tablet_idx_key({instance_id_, first_tablet_id});
-                        std::string tablet_idx_val;
-                        err = txn->get(tablet_idx_key, &tablet_idx_val, true);
-                        if (TxnErrorCode::TXN_OK != err) {
-                            code_ = err == TxnErrorCode::TXN_KEY_NOT_FOUND
-                                            ? MetaServiceCode::TXN_ID_NOT_FOUND
-                                            : cast_as<ErrCategory::READ>(err);
-                            ss << "failed to get tablet idx, txn_id=" << txn_id_
-                               << " key=" << hex(tablet_idx_key) << " err=" << err;
-                            msg_ = ss.str();
-                            LOG(WARNING) << msg_;
-                            break;
-                        }
-
-                        TabletIndexPB tablet_idx_pb;
-                        if (!tablet_idx_pb.ParseFromString(tablet_idx_val)) {
-                            code_ = MetaServiceCode::PROTOBUF_PARSE_ERR;
-                            ss << "failed to parse tablet idx pb txn_id=" << txn_id_
-                               << " key=" << hex(tablet_idx_key);
-                            msg_ = ss.str();
-                            break;
-                        }
-                        table_id = tablet_idx_pb.table_id();
-                    } else {
-                        CHECK(false) << "versioned read is not supported yet";
-                    }
-                }
-
-                DCHECK(table_id > 0);
-                DCHECK(partition_id > 0);
-
-                VersionPB version_pb;
-                std::string ver_val;
-                std::string ver_key =
-                        partition_version_key({instance_id_, db_id, table_id, partition_id});
-                if (!is_versioned_read) {
-                    err = txn->get(ver_key, &ver_val);
-                    if (TxnErrorCode::TXN_OK != err) {
-                        code_ = err == TxnErrorCode::TXN_KEY_NOT_FOUND
-                                        ? MetaServiceCode::TXN_ID_NOT_FOUND
-                                        : cast_as<ErrCategory::READ>(err);
-                        ss << "failed to get partiton version, txn_id=" << txn_id_
-                           << " key=" << hex(ver_key) << " err=" << err;
-                        msg_ = ss.str();
-                        LOG(WARNING) << msg_;
-                        break;
-                    }
-                    if (!version_pb.ParseFromString(ver_val)) {
-                        code_ = MetaServiceCode::PROTOBUF_PARSE_ERR;
-                        ss << "failed to parse version pb txn_id=" << txn_id_
-                           << " key=" << hex(ver_key);
-                        msg_ = ss.str();
-                        break;
-                    }
-                } else {
-                    CHECK(false) << "versioned read is not supported yet";
-                }
-
-                if (version_pb.pending_txn_ids_size() > 0 &&
-                    version_pb.pending_txn_ids(0) == txn_id_) {
-                    DCHECK(version_pb.pending_txn_ids_size() == 1);
-                    version_pb.clear_pending_txn_ids();
-                    ver_val.clear();
-
-                    if (version_pb.has_version()) {
-                        version_pb.set_version(version_pb.version() + 1);
-                    } else {
-                        // first commit txn version is 2
-                        version_pb.set_version(2);
-                    }
-                    if (!version_pb.SerializeToString(&ver_val)) {
-                        code_ = MetaServiceCode::PROTOBUF_SERIALIZE_ERR;
-                        ss << "failed to serialize version_pb when saving, txn_id=" << txn_id_;
-                        msg_ = ss.str();
-                        break;
-                    }
-                    txn->put(ver_key, ver_val);
-                    LOG(INFO) << "put ver_key=" << hex(ver_key) << " txn_id=" << txn_id_
-                              << " version_pb=" << version_pb.ShortDebugString();
-                    if (is_versioned_write) {
-                        // Update the partition version with the specified versionstamp.
-                        versioned_put(txn.get(), ver_key, versionstamp, ver_val);
-                        LOG(INFO) << "put versioned ver_key=" << hex(ver_key)
-                                  << " txn_id=" << txn_id_
-                                  << " version_pb=" << version_pb.ShortDebugString();
-                    }
-
-                    for (auto& [tmp_rowset_key, tmp_rowset_pb] : tmp_rowset_metas) {
-                        txn->remove(tmp_rowset_key);
-                        LOG(INFO) << "remove tmp_rowset_key=" << hex(tmp_rowset_key)
-                                  << " txn_id=" << txn_id_;
-                    }
-
-                    err = txn->commit();
-                    if (err != TxnErrorCode::TXN_OK) {
-                        code_ = cast_as<ErrCategory::COMMIT>(err);
-                        ss << "failed to commit kv txn, txn_id=" << txn_id_ << " err=" << err;
-                        msg_ = ss.str();
-                        break;
-                    }
-                }
+            {
+                StopWatch sw;
+                commit_partitions(db_id, partition_to_tmp_rowset_metas, is_versioned_write,
+                                  is_versioned_read);
+                g_bvar_txn_lazy_commit_partitions_latency << sw.elapsed_us();
             }
             if (code_ != MetaServiceCode::OK) {
                 LOG(WARNING) << "txn_id=" << txn_id_ << " code=" << code_ << " msg=" << msg_;
                 break;
             }
+            StopWatch sw;
             make_committed_txn_visible(instance_id_, db_id, txn_id_, txn_kv_, code_, msg_);
+            g_bvar_txn_lazy_commit_make_visible_latency << sw.elapsed_us();
         } while (false);
     } while (code_ == MetaServiceCode::KV_TXN_CONFLICT &&
              retry_times++ < config::txn_store_retry_times);
 }
 
+void TxnLazyCommitTask::commit_partitions(
+        int64_t db_id,
+        std::map<int64_t, std::vector<std::pair<std::string, doris::RowsetMetaCloudPB>>>&
+                partition_to_tmp_rowset_metas,
+        bool is_versioned_write, bool is_versioned_read) {
+    SimpleThreadPool* pool = txn_lazy_committer_->partition_worker_pool();
+    if (pool == nullptr || partition_to_tmp_rowset_metas.size() <= 1) {
+        for (auto& [partition_id, tmp_rowset_metas] : partition_to_tmp_rowset_metas) {
+            commit_partition(db_id, partition_id, tmp_rowset_metas, is_versioned_write,
+                             is_versioned_read, code_, msg_);
+            if (code_ != MetaServiceCode::OK) return;
+        }
+        return;
+    }
+
+    // Partitions have disjoint rowset, stats and version keys, so they are committed in parallel.
+    // The first failure is reported and the partitions not started yet are skipped.
+    std::mutex mutex;
+    std::condition_variable cond;
+    size_t num_pending = partition_to_tmp_rowset_metas.size();
+    bool failed = false;
+    for (auto& entry : partition_to_tmp_rowset_metas) {
+        auto commit_one = [&, this]() {
+            MetaServiceCode code = MetaServiceCode::OK;
+            std::string msg;
+            bool skip = false;
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                skip = failed;
+            }
+            if (!skip) {
+                commit_partition(db_id, entry.first, entry.second, is_versioned_write,
+                                 is_versioned_read, code, msg);
+            }
+            std::unique_lock<std::mutex> lock(mutex);
+            if (code != MetaServiceCode::OK && !failed) {
+                failed = true;
+                code_ = code;
+                msg_ = std::move(msg);
+            }
+            if (--num_pending == 0) {
+                cond.notify_all();
+            }
+        };
+        if (pool->submit(commit_one) != 0) {
+            commit_one();
+        }
+    }
+    std::unique_lock<std::mutex> lock(mutex);
+    cond.wait(lock, [&]() { return num_pending == 0; });
+}
+
+void TxnLazyCommitTask::commit_partition(
+        int64_t db_id, int64_t partition_id,
+        std::vector<std::pair<std::string, doris::RowsetMetaCloudPB>>& tmp_rowset_metas,
+        bool is_versioned_write, bool is_versioned_read, MetaServiceCode& code,
+        std::string& msg) {
+    TEST_SYNC_POINT_CALLBACK("TxnLazyCommitTask::commit_partition", &partition_id);
+    std::stringstream ss;
+    // tablet_id -> TabletIndexPB
+    std::map<int64_t, TabletIndexPB> tablet_ids;
+    Versionstamp versionstamp;
+    if (is_versioned_write) {
+        // Read the versionstamp from the partition key.
+        bool is_partition_version_valid = false;
+        std::string err_msg;
+        std::tie(code, err_msg) =
+                get_partition_versionstamp(txn_kv_.get(), instance_id_, txn_id_, partition_id,
+                                           &versionstamp, &is_partition_version_valid);
+        if (code != MetaServiceCode::OK) {
+            ss << "failed to get partition versionstamp, txn_id=" << txn_id_
+               << " partition_id=" << partition_id << " err=" << err_msg;
+            msg = ss.str();
+            LOG(WARNING) << msg;
+            return;
+        }
+        if (!is_partition_version_valid) {
+            // The partition version is not valid, it might been committed, skip this partition.
+            return;
+        }
+    }
+
+    for (size_t i = 0; i < tmp_rowset_metas.size(); i += config::txn_lazy_max_rowsets_per_batch) {
+        size_t end = (i + config::txn_lazy_max_rowsets_per_batch) > tmp_rowset_metas.size()
+                             ? tmp_rowset_metas.size()
+                             : i + config::txn_lazy_max_rowsets_per_batch;
+        std::vector<std::pair<std::string, doris::RowsetMetaCloudPB>>
+                sub_partition_tmp_rowset_metas(tmp_rowset_metas.begin() + i,
+                                               tmp_rowset_metas.begin() + end);
+        StopWatch sw;
+        convert_tmp_rowsets(instance_id_, txn_id_, txn_kv_, code, msg, db_id,
+                            sub_partition_tmp_rowset_metas, tablet_ids, is_versioned_write,
+                            is_versioned_read, versionstamp);
+        g_bvar_txn_lazy_commit_convert_tmp_rowsets_latency << sw.elapsed_us();
+        if (code != MetaServiceCode::OK) return;
+    }
+
+    std::unique_ptr<Transaction> txn;
+    TxnErrorCode err = txn_kv_->create_txn(&txn);
+    if (err != TxnErrorCode::TXN_OK) {
+        code = cast_as<ErrCategory::CREATE>(err);
+        ss << "failed to create txn, txn_id=" << txn_id_ << " err=" << err;
+        msg = ss.str();
+        LOG(WARNING) << msg;
+        return;
+    }
+
+    int64_t table_id = -1;
+    DCHECK(tmp_rowset_metas.size() > 0);
+    if (table_id <= 0) {
+        if (tablet_ids.size() > 0) {
+            // get table_id from memory cache
+            table_id = tablet_ids.begin()->second.table_id();
+        } else if (!is_versioned_read) {
+            // get table_id from storage
+            int64_t first_tablet_id = tmp_rowset_metas.begin()->second.tablet_id();
+            std::string tablet_idx_key = meta_tablet_idx_key({instance_id_, first_tablet_id});
+            std::string tablet_idx_val;
+            err = txn->get(tablet_idx_key, &tablet_idx_val, true);
+            if (TxnErrorCode::TXN_OK != err) {
+                code = err == TxnErrorCode::TXN_KEY_NOT_FOUND
+                               ? MetaServiceCode::TXN_ID_NOT_FOUND
+                               : cast_as<ErrCategory::READ>(err);
+                ss << "failed to get tablet idx, txn_id=" << txn_id_
+                   << " key=" << hex(tablet_idx_key) << " err=" << err;
+                msg = ss.str();
+                LOG(WARNING) << msg;
+                return;
+            }
+
+            TabletIndexPB tablet_idx_pb;
+            if (!tablet_idx_pb.ParseFromString(tablet_idx_val)) {
+                code = MetaServiceCode::PROTOBUF_PARSE_ERR;
+                ss << "failed to parse tablet idx pb txn_id=" << txn_id_
+                   << " key=" << hex(tablet_idx_key);
+                msg = ss.str();
+                return;
+            }
+            table_id = tablet_idx_pb.table_id();
+        } else {
+            CHECK(false) << "versioned read is not supported yet";
+        }
+    }
+
+    DCHECK(table_id > 0);
+    DCHECK(partition_id > 0);
+
+    VersionPB version_pb;
+    std::string ver_val;
+    std::string ver_key = partition_version_key({instance_id_, db_id, table_id, partition_id});
+    if (!is_versioned_read) {
+        err = txn->get(ver_key, &ver_val);
+        if (TxnErrorCode::TXN_OK != err) {
+            code = err == TxnErrorCode::TXN_KEY_NOT_FOUND ? MetaServiceCode::TXN_ID_NOT_FOUND
+                                                          : cast_as<ErrCategory::READ>(err);
+            ss << "failed to get partiton version, txn_id=" << txn_id_ << " key=" << hex(ver_key)
+               << " err=" << err;
+            msg = ss.str();
+            LOG(WARNING) << msg;
+            return;
+        }
+        if (!version_pb.ParseFromString(ver_val)) {
+            code = MetaServiceCode::PROTOBUF_PARSE_ERR;
+            ss << "failed to parse version pb txn_id=" << txn_id_ << " key=" << hex(ver_key);
+            msg = ss.str();
+            return;
+        }
+    } else {
+        CHECK(false) << "versioned read is not supported yet";
+    }
+
+    if (version_pb.pending_txn_ids_size() > 0 && version_pb.pending_txn_ids(0) == txn_id_) {
+        DCHECK(version_pb.pending_txn_ids_size() == 1);
+        version_pb.clear_pending_txn_ids();
+        ver_val.clear();
+
+        if (version_pb.has_version()) {
+            version_pb.set_version(version_pb.version() + 1);
+        } else {
+            // first commit txn version is 2
+            version_pb.set_version(2);
+        }
+        if (!version_pb.SerializeToString(&ver_val)) {
+            code = MetaServiceCode::PROTOBUF_SERIALIZE_ERR;
+            ss << "failed to serialize version_pb when saving, txn_id=" << txn_id_;
+            msg = ss.str();
+            return;
+        }
+        txn->put(ver_key, ver_val);
+        VLOG_DEBUG << "put ver_key=" << hex(ver_key) << " txn_id=" << txn_id_
+                   << " version_pb=" << version_pb.ShortDebugString();
+        if (is_versioned_write) {
+            // Update the partition version with the specified versionstamp.
+            versioned_put(txn.get(), ver_key, versionstamp, ver_val);
+            VLOG_DEBUG << "put versioned ver_key=" << hex(ver_key) << " txn_id=" << txn_id_
+                       << " version_pb=" << version_pb.ShortDebugString();
+        }
+
+        for (auto& [tmp_rowset_key, tmp_rowset_pb] : tmp_rowset_metas) {
+            txn->remove(tmp_rowset_key);
+            VLOG_DEBUG << "remove tmp_rowset_key=" << hex(tmp_rowset_key) << " txn_id=" << txn_id_;
+        }
+
+        err = txn->commit();
+        if (err != TxnErrorCode::TXN_OK) {
+            code = cast_as<ErrCategory::COMMIT>(err);
+            ss << "failed to commit kv txn, txn_id=" << txn_id_ << " err=" << err;
+            msg = ss.str();
+            return;
+        }
+    }
+}
+
 std::pair<MetaServiceCode, std::string> TxnLazyCommitTask::wait() {
     StopWatch sw;
     uint64_t round = 0;
@@ -705,6 +784,11 @@ TxnLazyCommitter::TxnLazyCommitter(std::shared_ptr<TxnKv> txn_kv) : txn_kv_(txn_
     worker_pool_ = std::make_unique<SimpleThreadPool>(config::txn_lazy_commit_num_threads,
                                                       "txn_lazy_commiter");
     worker_pool_->start();
+    if (config::txn_lazy_commit_partition_num_threads > 1) {
+        partition_worker_pool_ = std::make_unique<SimpleThreadPool>(
+                config::txn_lazy_commit_partition_num_threads, "txn_lazy_partition_commiter");
+        partition_worker_pool_->start();
+    }
 }
 
 /**
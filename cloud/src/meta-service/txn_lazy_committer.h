@@ -20,6 +20,9 @@
 #include <gen_cpp/cloud.pb.h>
 
 #include <atomic>
+#include <map>
+#include <string>
+#include <vector>
 
 #include "common/simple_thread_pool.h"
 #include "meta-store/txn_kv.h"
@@ -39,6 +42,19 @@ public:
 private:
     friend class TxnLazyCommitter;
 
+    void commit_partitions(
+            int64_t db_id,
+            std::map<int64_t, std::vector<std::pair<std::string, doris::RowsetMetaCloudPB>>>&
+                    partition_to_tmp_rowset_metas,
+            bool is_versioned_write, bool is_versioned_read);
+
+    // Converts the tmp rowsets of a partition and bumps its version
+    void commit_partition(
+            int64_t db_id, int64_t partition_id,
+            std::vector<std::pair<std::string, doris::RowsetMetaCloudPB>>& tmp_rowset_metas,
+            bool is_versioned_write, bool is_versioned_read, MetaServiceCode& code,
+            std::string& msg);
+
     std::string instance_id_;
     int64_t txn_id_;
     std::shared_ptr<TxnKv> txn_kv_;
@@ -56,10 +72,15 @@ public:
     std::shared_ptr<TxnLazyCommitTask> submit(const std::string& instance_id, int64_t txn_id);
     void remove(int64_t txn_id);
 
+    // nullptr if the partitions of a txn are committed serially
+    SimpleThreadPool* partition_worker_pool() { return partition_worker_pool_.get(); }
+
 private:
     std::shared_ptr<TxnKv> txn_kv_;
 
     std::unique_ptr<SimpleThreadPool> worker_pool_;
+    // Shared by all tasks, separated from worker_pool_ to not block on tasks waiting for it
+    std::unique_ptr<SimpleThreadPool> partition_worker_pool_;
 
     std::mutex mutex_;
     // <txn_id, TxnLazyCommitTask>
@@ -659,6 +659,11 @@ TxnErrorCode Transaction::get_read_version(int64_t* version) {
     return TxnErrorCode::TXN_OK;
 }
 
+void Transaction::set_read_version(int64_t version) {
+    std::lock_guard<std::mutex> l(lock_);
+    read_version_ = version;
+}
+
 TxnErrorCode Transaction::get_committed_version(int64_t* version) {
     std::lock_guard<std::mutex> l(lock_);
     if (!commited_) {
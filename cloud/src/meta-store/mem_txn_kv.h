@@ -213,6 +213,7 @@ public:
     TxnErrorCode commit() override;
 
     TxnErrorCode get_read_version(int64_t* version) override;
+    void set_read_version(int64_t version) override;
     TxnErrorCode get_committed_version(int64_t* version) override;
 
     TxnErrorCode abort() override;
@@ -634,6 +634,10 @@ TxnErrorCode Transaction::get_read_version(int64_t* version) {
     return TxnErrorCode::TXN_OK;
 }
 
+void Transaction::set_read_version(int64_t version) {
+    fdb_transaction_set_read_version(txn_, version);
+}
+
 TxnErrorCode Transaction::get_committed_version(int64_t* version) {
     StopWatch sw;
     auto err = fdb_transaction_get_committed_version(txn_, version);
@@ -258,6 +258,14 @@ public:
      */
     virtual TxnErrorCode get_read_version(int64_t* version) = 0;
 
+    /**
+     * Sets the read version of the txn, it saves the round trip to get a read version
+     * if a recent one is known. The reads of the txn might be stale, and fail with
+     * TXN_TOO_OLD if the version is older than the mvcc window.
+     * Must be called before any read of the txn.
+     */
+    virtual void set_read_version(int64_t version) = 0;
+
     /**
      * Gets the commited version used by the txn.
      * Note that it does not make any sense we call this function before
@@ -743,6 +751,7 @@ public:
     TxnErrorCode commit() override;
 
     TxnErrorCode get_read_version(int64_t* version) override;
+    void set_read_version(int64_t version) override;
     TxnErrorCode get_committed_version(int64_t* version) override;
 
     TxnErrorCode abort() override;
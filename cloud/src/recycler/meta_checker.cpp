@@ -44,30 +44,24 @@ MetaChecker::MetaChecker(std::shared_ptr<TxnKv> txn_kv) : txn_kv_(std::move(txn_
 bool MetaChecker::scan_and_handle_kv(
         std::string& start_key, const std::string& end_key,
         std::function<int(std::string_view, std::string_view)> handle_kv) {
-    std::unique_ptr<Transaction> txn;
-    TxnErrorCode err = txn_kv_->create_txn(&txn);
-    if (err != TxnErrorCode::TXN_OK) {
-        LOG(WARNING) << "failed to init txn";
+    // Each batch is read by a new txn, so that scanning millions of keys is not bounded by the
+    // 5s lifetime of a read version, and the next batch is prefetched while handling this one.
+    FullRangeGetOptions opts(txn_kv_);
+    opts.prefetch = true;
+    auto it = txn_kv_->full_range_get(start_key, end_key, std::move(opts));
+    for (auto kv = it->next(); kv.has_value(); kv = it->next()) {
+        auto [k, v] = *kv;
+        handle_kv(k, v);
+        if (!it->has_next()) {
+            start_key = k;
+            start_key.push_back('\x00');
+        }
+    }
+    if (!it->is_valid()) {
+        LOG(WARNING) << "failed to scan kv, start_key=" << hex(start_key)
+                     << " err=" << it->error_code();
         return false;
     }
-    std::unique_ptr<RangeGetIterator> it;
-    do {
-        err = txn->get(start_key, end_key, &it);
-        if (err != TxnErrorCode::TXN_OK) {
-            LOG(WARNING) << "failed to get tablet idx, ret=" << err;
-            return false;
-        }
-
-        while (it->has_next()) {
-            auto [k, v] = it->next();
-
-            handle_kv(k, v);
-            if (!it->has_next()) {
-                start_key = k;
-            }
-        }
-        start_key.push_back('\x00');
-    } while (it->more());
     return true;
 }
 
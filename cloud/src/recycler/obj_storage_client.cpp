@@ -38,6 +38,8 @@ ObjectStorageResponse ObjStorageClient::delete_objects_recursively_(ObjectStorag
 
     ObjectStorageResponse ret;
     std::vector<std::string> keys;
+    // The batches are already issued on option.executor, don't issue them again from inside it
+    ObjClientOptions batch_option {.prefetch = option.prefetch};
     SyncExecutor<int> concurrent_delete_executor(
             option.executor,
             fmt::format("delete objects under bucket {}, path {}", path.bucket, path.key),
@@ -53,8 +55,8 @@ ObjectStorageResponse ObjStorageClient::delete_objects_recursively_(ObjectStorag
         if (keys.size() < batch_size) {
             continue;
         }
-        concurrent_delete_executor.add([this, &path, k = std::move(keys), option]() mutable {
-            return delete_objects(path.bucket, std::move(k), option).ret;
+        concurrent_delete_executor.add([this, &path, k = std::move(keys), batch_option]() mutable {
+            return delete_objects(path.bucket, std::move(k), batch_option).ret;
         });
     }
 
@@ -65,8 +67,8 @@ ObjectStorageResponse ObjStorageClient::delete_objects_recursively_(ObjectStorag
     }
 
     if (!keys.empty()) {
-        concurrent_delete_executor.add([this, &path, k = std::move(keys), option]() mutable {
-            return delete_objects(path.bucket, std::move(k), option).ret;
+        concurrent_delete_executor.add([this, &path, k = std::move(keys), batch_option]() mutable {
+            return delete_objects(path.bucket, std::move(k), batch_option).ret;
         });
     }
     bool finished = true;
@@ -34,6 +34,7 @@
 #include "cpp/s3_rate_limiter.h"
 #include "cpp/sync_point.h"
 #include "recycler/s3_accessor.h"
+#include "recycler/sync_executor.h"
 #include "recycler/util.h"
 
 namespace doris::cloud {
@@ -227,15 +228,14 @@ ObjectStorageResponse S3ObjClient::delete_objects(const std::string& bucket,
         return {0};
     }
 
-    Aws::S3::Model::DeleteObjectsRequest delete_request;
-    delete_request.SetBucket(bucket);
-
-    auto issue_delete = [&bucket, &delete_request,
+    auto issue_delete = [&bucket,
                          this](std::vector<Aws::S3::Model::ObjectIdentifier> objects) -> int {
         if (objects.size() == 1) {
             return delete_object({.bucket = bucket, .key = objects[0].GetKey()}).ret;
         }
 
+        Aws::S3::Model::DeleteObjectsRequest delete_request;
+        delete_request.SetBucket(bucket);
         Aws::S3::Model::Delete del;
         del.WithObjects(std::move(objects)).SetQuiet(true);
         delete_request.SetDelete(std::move(del));
@@ -265,6 +265,31 @@ ObjectStorageResponse S3ObjClient::delete_objects(const std::string& bucket,
     size_t delete_batch_size = MaxDeleteBatch;
     TEST_INJECTION_POINT_CALLBACK("S3ObjClient::delete_objects", &delete_batch_size);
 
+    if (option.executor != nullptr && keys.size() > delete_batch_size) {
+        // Issue the batches concurrently, the requests are still limited by s3_put_rate_limit
+        SyncExecutor<int> concurrent_delete_executor(
+                option.executor,
+                fmt::format("delete {} objects under bucket {}", keys.size(), bucket),
+                [](const int& ret) { return ret != 0; });
+        for (size_t i = 0; i < keys.size(); i += delete_batch_size) {
+            std::vector<Aws::S3::Model::ObjectIdentifier> batch;
+            for (size_t j = i; j < std::min(i + delete_batch_size, keys.size()); ++j) {
+                batch.emplace_back().SetKey(std::move(keys[j]));
+            }
+            concurrent_delete_executor.add([&issue_delete, b = std::move(batch)]() mutable {
+                return issue_delete(std::move(b));
+            });
+        }
+        bool finished = true;
+        std::vector<int> rets = concurrent_delete_executor.when_all(&finished);
+        for (int r : rets) {
+            if (r != 0) {
+                ret = r;
+            }
+        }
+        return {finished ? ret : -1};
+    }
+
     // std::views::chunk(1000)
     for (auto&& key : keys) {
         objects.emplace_back().SetKey(std::move(key));
@@ -6982,6 +6982,43 @@ TEST(MetaServiceTest, GetVersion) {
     }
 }
 
+TEST(MetaServiceTest, GetVersionWithCachedReadVersion) {
+    auto service = get_meta_service();
+    auto cache_ms = config::get_version_read_version_cache_ms;
+    config::get_version_read_version_cache_ms = 3600 * 1000;
+    DORIS_CLOUD_DEFER {
+        config::get_version_read_version_cache_ms = cache_ms;
+    };
+
+    int64_t table_id = 1;
+    int64_t partition_id = 1;
+    int64_t tablet_id = 1;
+    create_tablet(service.get(), table_id, 1, partition_id, tablet_id);
+    insert_rowset(service.get(), 1, "get_version_label_1", table_id, partition_id, tablet_id);
+
+    auto get_version = [&]() {
+        brpc::Controller ctrl;
+        GetVersionRequest req;
+        req.set_cloud_unique_id("test_cloud_unique_id");
+        req.set_db_id(1);
+        req.set_table_id(table_id);
+        req.set_partition_id(partition_id);
+        GetVersionResponse resp;
+        service->get_version(&ctrl, &req, &resp, nullptr);
+        EXPECT_EQ(resp.status().code(), MetaServiceCode::OK)
+                << " status is " << resp.status().DebugString();
+        return resp.version();
+    };
+
+    ASSERT_EQ(get_version(), 2);
+    insert_rowset(service.get(), 1, "get_version_label_2", table_id, partition_id, tablet_id);
+    // Read with the cached read version, the new version is not visible
+    ASSERT_EQ(get_version(), 2);
+
+    config::get_version_read_version_cache_ms = 0;
+    ASSERT_EQ(get_version(), 3);
+}
+
 TEST(MetaServiceTest, BatchGetVersion) {
     struct TestCase {
         std::vector<int64_t> table_ids;
@@ -27,6 +27,7 @@
 #include "common/defer.h"
 #include "cpp/sync_point.h"
 #include "meta-service/meta_service.h"
+#include "meta-service/meta_service_schema.h"
 #include "meta-store/keys.h"
 #include "meta-store/txn_kv.h"
 #include "meta-store/txn_kv_error.h"
@@ -814,4 +815,34 @@ TEST(AlterSchemaKVTest, AlterDisableAutoCompactionTest) {
     }
 }
 
+TEST(DetachSchemaKVTest, SchemaCacheTest) {
+    auto old_capacity = config::meta_schema_cache_capacity;
+    DORIS_CLOUD_DEFER {
+        config::meta_schema_cache_capacity = old_capacity;
+    };
+    config::meta_schema_cache_capacity = 2;
+
+    auto make_schema = [](int32_t schema_version) {
+        auto schema = std::make_shared<doris::TabletSchemaCloudPB>();
+        schema->set_schema_version(schema_version);
+        return schema;
+    };
+    SchemaCache cache;
+    EXPECT_EQ(cache.get("k1"), nullptr);
+    cache.put("k1", make_schema(1));
+    cache.put("k2", make_schema(2));
+    ASSERT_NE(cache.get("k1"), nullptr);
+    EXPECT_EQ(cache.get("k1")->schema_version(), 1);
+    // k2 is the least recently used one
+    cache.put("k3", make_schema(3));
+    EXPECT_EQ(cache.get("k2"), nullptr);
+    ASSERT_NE(cache.get("k3"), nullptr);
+    EXPECT_EQ(cache.get("k3")->schema_version(), 3);
+
+    config::meta_schema_cache_capacity = 0;
+    cache.put("k4", make_schema(4));
+    EXPECT_EQ(cache.get("k1"), nullptr);
+    EXPECT_EQ(cache.get("k4"), nullptr);
+}
+
 } // namespace doris::cloud
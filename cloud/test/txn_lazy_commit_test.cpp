@@ -24,16 +24,20 @@
 #include <gtest/gtest.h>
 
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
 #include <cstddef>
 #include <cstdint>
 #include <limits>
 #include <memory>
+#include <mutex>
 #include <random>
+#include <set>
 #include <string>
 #include <thread>
 
 #include "common/config.h"
+#include "common/defer.h"
 #include "common/logging.h"
 #include "common/util.h"
 #include "cpp/sync_point.h"
@@ -2680,4 +2684,168 @@ TEST(TxnLazyCommitTest, CommitTxnEventuallyWithMultiTableTest) {
     sp->disable_processing();
 }
 
+// Begins a txn and commits two tmp rowsets to each of num_partitions partitions of one table
+static int64_t begin_txn_with_partitions(MetaServiceProxy* meta_service, int64_t db_id,
+                                         int64_t table_id, int64_t index_id,
+                                         int64_t partition_id_base, int num_partitions,
+                                         int64_t tablet_id_base, const std::string& label) {
+    brpc::Controller cntl;
+    BeginTxnRequest req;
+    req.set_cloud_unique_id("test_cloud_unique_id");
+    TxnInfoPB txn_info_pb;
+    txn_info_pb.set_db_id(db_id);
+    txn_info_pb.set_label(label);
+    txn_info_pb.add_table_ids(table_id);
+    txn_info_pb.set_timeout_ms(36000);
+    req.mutable_txn_info()->CopyFrom(txn_info_pb);
+    BeginTxnResponse res;
+    meta_service->begin_txn(reinterpret_cast<::google::protobuf::RpcController*>(&cntl), &req, &res,
+                            nullptr);
+    EXPECT_EQ(res.status().code(), MetaServiceCode::OK);
+    int64_t txn_id = res.txn_id();
+
+    for (int i = 0; i < num_partitions * 2; ++i) {
+        int64_t partition_id = partition_id_base + i / 2;
+        create_tablet_with_db_id(meta_service, db_id, table_id, index_id, partition_id,
+                                 tablet_id_base + i);
+        auto tmp_rowset = create_rowset(txn_id, tablet_id_base + i, index_id, partition_id);
+        CreateRowsetResponse res;
+        commit_rowset(meta_service, tmp_rowset, res);
+        EXPECT_EQ(res.status().code(), MetaServiceCode::OK);
+    }
+    return txn_id;
+}
+
+static void commit_txn_lazily(MetaServiceProxy* meta_service, int64_t db_id, int64_t txn_id) {
+    brpc::Controller cntl;
+    CommitTxnRequest req;
+    req.set_cloud_unique_id("test_cloud_unique_id");
+    req.set_db_id(db_id);
+    req.set_txn_id(txn_id);
+    req.set_is_2pc(false);
+    req.set_enable_txn_lazy_commit(true);
+    CommitTxnResponse res;
+    meta_service->commit_txn(reinterpret_cast<::google::protobuf::RpcController*>(&cntl), &req,
+                             &res, nullptr);
+    ASSERT_EQ(res.status().code(), MetaServiceCode::OK);
+}
+
+TEST(TxnLazyCommitTest, CommitPartitionsInParallelTest) {
+    auto partition_num_threads = config::txn_lazy_commit_partition_num_threads;
+    config::txn_lazy_commit_partition_num_threads = 4;
+    auto sp = SyncPoint::get_instance();
+    DORIS_CLOUD_DEFER {
+        config::txn_lazy_commit_partition_num_threads = partition_num_threads;
+        sp->clear_all_call_backs();
+        sp->clear_trace();
+        sp->disable_processing();
+    };
+
+    auto txn_kv = get_mem_txn_kv();
+    int64_t db_id = 8812341;
+    int64_t table_id = 8812342;
+    int64_t index_id = 8812343;
+    int64_t partition_id_base = 8812400;
+    int64_t tablet_id_base = 8812500;
+    int num_partitions = 8;
+    std::string label = "test_label_commit_partitions_in_parallel";
+    // the committer and its partition pool are created with the meta service
+    auto meta_service = get_meta_service(txn_kv, true);
+    int64_t txn_id = begin_txn_with_partitions(meta_service.get(), db_id, table_id, index_id,
+                                               partition_id_base, num_partitions, tablet_id_base,
+                                               label);
+
+    std::mutex mutex;
+    std::condition_variable cond;
+    std::set<int64_t> committed_partitions;
+    std::set<std::thread::id> threads;
+    int num_running = 0;
+    bool overlapped = false;
+    sp->set_call_back("TxnLazyCommitTask::commit_partition", [&](auto&& args) {
+        int64_t partition_id = *try_any_cast<int64_t*>(args[0]);
+        std::unique_lock lock(mutex);
+        committed_partitions.insert(partition_id);
+        threads.insert(std::this_thread::get_id());
+        // the first partitions wait for each other, which only returns if they run in parallel
+        ++num_running;
+        cond.notify_all();
+        overlapped |= cond.wait_for(lock, std::chrono::seconds(10),
+                                    [&] { return num_running >= 2 || overlapped; });
+        --num_running;
+    });
+    MetaServiceCode lazy_commit_code = MetaServiceCode::UNDEFINED_ERR;
+    sp->set_call_back("commit_txn_eventually::task->wait", [&](auto&& args) {
+        lazy_commit_code = try_any_cast<std::pair<MetaServiceCode, std::string>*>(args[0])->first;
+    });
+    sp->enable_processing();
+
+    commit_txn_lazily(meta_service.get(), db_id, txn_id);
+    ASSERT_EQ(lazy_commit_code, MetaServiceCode::OK);
+    EXPECT_TRUE(overlapped);
+    EXPECT_GT(threads.size(), 1);
+    EXPECT_EQ(committed_partitions.size(), static_cast<size_t>(num_partitions));
+
+    std::unique_ptr<Transaction> txn;
+    ASSERT_EQ(txn_kv->create_txn(&txn), TxnErrorCode::TXN_OK);
+    for (int i = 0; i < num_partitions * 2; ++i) {
+        check_tmp_rowset_not_exist(txn, tablet_id_base + i, txn_id);
+        check_rowset_meta_exist(txn, tablet_id_base + i, 2);
+    }
+    check_txn_visible(txn, db_id, txn_id, label);
+}
+
+TEST(TxnLazyCommitTest, CommitPartitionsInParallelFailureTest) {
+    auto partition_num_threads = config::txn_lazy_commit_partition_num_threads;
+    config::txn_lazy_commit_partition_num_threads = 2;
+    auto sp = SyncPoint::get_instance();
+    DORIS_CLOUD_DEFER {
+        config::txn_lazy_commit_partition_num_threads = partition_num_threads;
+        sp->clear_all_call_backs();
+        sp->clear_trace();
+        sp->disable_processing();
+    };
+
+    auto txn_kv = get_mem_txn_kv();
+    int64_t db_id = 8822341;
+    int64_t table_id = 8822342;
+    int64_t index_id = 8822343;
+    int64_t partition_id_base = 8822400;
+    int64_t tablet_id_base = 8822500;
+    int num_partitions = 8;
+    std::string label = "test_label_commit_partitions_in_parallel_failure";
+    auto meta_service = get_meta_service(txn_kv, true);
+    int64_t txn_id = begin_txn_with_partitions(meta_service.get(), db_id, table_id, index_id,
+                                               partition_id_base, num_partitions, tablet_id_base,
+                                               label);
+
+    std::atomic<int> num_committed_partitions = 0;
+    sp->set_call_back("TxnLazyCommitTask::commit_partition",
+                      [&](auto&& args) { ++num_committed_partitions; });
+    // every partition fails before its kv txn is committed
+    sp->set_call_back("convert_tmp_rowsets::before_commit", [&](auto&& args) {
+        *try_any_cast<MetaServiceCode*>(args[0]) = MetaServiceCode::KV_TXN_COMMIT_ERR;
+        *try_any_cast<bool*>(args.back()) = true;
+    });
+    MetaServiceCode lazy_commit_code = MetaServiceCode::OK;
+    sp->set_call_back("commit_txn_eventually::task->wait", [&](auto&& args) {
+        lazy_commit_code = try_any_cast<std::pair<MetaServiceCode, std::string>*>(args[0])->first;
+    });
+    sp->enable_processing();
+
+    // the txn is committed, only making it visible failed
+    commit_txn_lazily(meta_service.get(), db_id, txn_id);
+    EXPECT_EQ(lazy_commit_code, MetaServiceCode::KV_TXN_COMMIT_ERR);
+    // at most the partitions started before the first failure ran, the others were skipped
+    EXPECT_GE(num_committed_partitions.load(), 1);
+    EXPECT_LE(num_committed_partitions.load(), 2);
+
+    std::unique_ptr<Transaction> txn;
+    ASSERT_EQ(txn_kv->create_txn(&txn), TxnErrorCode::TXN_OK);
+    for (int i = 0; i < num_partitions * 2; ++i) {
+        check_tmp_rowset_exist(txn, tablet_id_base + i, txn_id);
+        check_rowset_meta_not_exist(txn, tablet_id_base + i, 2);
+    }
+    check_txn_committed(txn, db_id, txn_id, label);
+}
+
 } // namespace doris::cloud